@@ -16,6 +16,19 @@ namespace baljsn {
 // PRIVATE MANIPULATORS
 int Decoder::skipUnknownElement(const bslstl::StringRef& elementName)
 {
+    if (!d_validateSkippedElements
+     && Tokenizer::e_ELEMENT_NAME == d_tokenizer.tokenType()) {
+        bsls::Types::Uint64 numBytesSkipped;
+        const int rc = d_tokenizer.skipValue(&numBytesSkipped);
+        if (rc) {
+            d_logStream << "Error skipping the value of unknown element '"
+                        << elementName << "'\n";
+            return -1;                                                // RETURN
+        }
+        d_numBytesSkipped += numBytesSkipped;
+        return 0;                                                     // RETURN
+    }
+
     int rc = d_tokenizer.advanceToNextToken();
     if (rc) {
         d_logStream << "Error advancing to token after '"
@@ -40,6 +40,19 @@ BSLS_IDENT("$Id: $")
 // Refer to the details of the JSON encoding format supported by this decoder
 // in the package documentation file (doc/baljsn.txt).
 //
+///Skipping Unknown Elements
+///--------------------------
+// If the 'skipUnknownElements' option is 'true', elements in the JSON data
+// that do not correspond to an attribute or selection of the object being
+// decoded are skipped.  By default, a skipped element is tokenized and
+// validated like any other element, and counts towards the 'maxDepth' limit.
+// If the 'validateSkippedElements' option is 'false', the value of a skipped
+// element is instead located by counting brackets and quotes only (see
+// 'baljsn::Tokenizer::skipValue'), which is considerably faster for large
+// unknown elements, but does not detect malformed JSON within them and does
+// not apply the 'maxDepth' limit to them.  The number of bytes skipped in
+// this way is available from 'numBytesSkipped'.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -238,6 +251,11 @@ class Decoder {
     int                 d_currentDepth;         // current decoding depth
     int                 d_maxDepth;             // max decoding depth
     bool                d_skipUnknownElements;  // skip unknown elements flag
+    bool                d_validateSkippedElements;
+                                                // validate skipped elements
+                                                // flag
+    bsls::Types::Uint64 d_numBytesSkipped;      // number of bytes skipped
+                                                // without validation
 
     // FRIENDS
     friend struct Decoder_DecodeImpProxy;
@@ -278,6 +296,8 @@ class Decoder {
         // Skip the unknown element specified by 'elementName' by discarding
         // all the data associated with it and advancing the parser to the next
         // element.  Return 0 on success and a non-zero value otherwise.
+        // Note that, unless skipped elements are validated, the value of the
+        // element is skipped by 'Tokenizer::skipValue' without tokenizing it.
 
   private:
     // Not implemented:
@@ -353,6 +373,13 @@ class Decoder {
         // Return a string containing any error, warning, or trace messages
         // that were logged during the last call to the 'decode' method.  The
         // log is reset each time 'decode' is called.
+
+    bsls::Types::Uint64 numBytesSkipped() const;
+        // Return the number of bytes of input that were skipped, without
+        // being validated, as part of unknown elements during the last call
+        // to the 'decode' method.  Note that this value is 0 unless the
+        // 'skipUnknownElements' option was 'true' and the
+        // 'validateSkippedElements' option was 'false' for that call.
 };
 
                        // =============================
@@ -931,6 +958,8 @@ Decoder::Decoder(bslma::Allocator *basicAllocator)
 , d_currentDepth(0)
 , d_maxDepth(0)
 , d_skipUnknownElements(false)
+, d_validateSkippedElements(true)
+, d_numBytesSkipped(0)
 {
 }
 
@@ -972,8 +1001,10 @@ int Decoder::decode(bsl::streambuf        *streamBuf,
     d_logStream.clear();
     d_logStream.str("");
 
-    d_maxDepth            = options.maxDepth();
-    d_skipUnknownElements = options.skipUnknownElements();
+    d_maxDepth                = options.maxDepth();
+    d_skipUnknownElements     = options.skipUnknownElements();
+    d_validateSkippedElements = options.validateSkippedElements();
+    d_numBytesSkipped         = 0;
 
     rc = decodeImp(value, 0, TypeCategory());
 
@@ -1038,6 +1069,12 @@ bsl::string Decoder::loggedMessages() const
     return d_logStream.str();
 }
 
+inline
+bsls::Types::Uint64 Decoder::numBytesSkipped() const
+{
+    return d_numBytesSkipped;
+}
+
                        // -----------------------------
                        // struct Decoder_ElementVisitor
                        // -----------------------------
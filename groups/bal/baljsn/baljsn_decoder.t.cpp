@@ -75,6 +75,7 @@ using bsl::endl;
 //
 // ACCESSORS
 // [ 4] bsl::string loggedMessages() const;
+// [ 3] bsls::Types::Uint64 numBytesSkipped() const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 7] USAGE EXAMPLE
@@ -39169,6 +39170,13 @@ int main(int argc, char *argv[])
         //:
         //: 2 The decoder returns an error on encountering unknown elements if
         //:   the 'skipUnknownElement' decoder option is *not* specified.
+        //:
+        //: 3 The decoder skips unknown elements in the same way if the
+        //:   'validateSkippedElements' decoder option is 'false', and reports
+        //:   the number of bytes so skipped, which is 0 otherwise.
+        //:
+        //: 4 Malformed unknown elements are reported as errors only if the
+        //:   'validateSkippedElements' decoder option is 'true'.
         //
         // Plan:
         //: 1 Using the table-driven technique, specify a table with JSON text.
@@ -39190,11 +39198,20 @@ int main(int argc, char *argv[])
         //:
         //:   7 Repeat steps 1 - 6 with the 'skipUnknownElements' option set
         //:     to 'false'.  Verify that an error code is returned by 'decode'.
+        //:
+        //:   8 Repeat steps 1 - 6 with the 'validateSkippedElements' option
+        //:     set to 'false', and verify that 'numBytesSkipped' is non-zero,
+        //:     and is 0 when that option is 'true'.  (C-3)
+        //:
+        //: 3 Decode JSON text having a malformed unknown element with the
+        //:   'validateSkippedElements' option set to 'true' and 'false', and
+        //:   verify that an error is returned only in the first case.  (C-4)
         //
         // Testing:
         //   int decode(bsl::streambuf *streamBuf, TYPE *v, options);
         //   int decode(bsl::istream& stream, TYPE *v, options);
         //   bsl::string loggedMessages() const;
+        //   bsls::Types::Uint64 numBytesSkipped() const;
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -39744,6 +39761,52 @@ int main(int argc, char *argv[])
                 ASSERT("Some City"   == bob.homeAddress().city());
                 ASSERT("Some State"  == bob.homeAddress().state());
                 ASSERTV(LINE, 21     == bob.age());
+                ASSERTV(LINE, 0 == decoder.numBytesSkipped());
+            }
+
+            // With skipping option, without validation
+            options.setValidateSkippedElements(false);
+            {
+                test::Employee     bob;
+                bsl::istringstream iss(jsonText);
+                ASSERTV(LINE, 0 == decoder.decode(iss, &bob, mO));
+                ASSERTV(bob.name(), "Bob" == bob.name());
+                ASSERT("Some Street" == bob.homeAddress().street());
+                ASSERT("Some City"   == bob.homeAddress().city());
+                ASSERT("Some State"  == bob.homeAddress().state());
+                ASSERTV(LINE, 21     == bob.age());
+                ASSERTV(LINE, decoder.numBytesSkipped(),
+                        0 < decoder.numBytesSkipped());
+                ASSERTV(LINE, decoder.numBytesSkipped(),
+                        jsonText.length() > decoder.numBytesSkipped());
+            }
+        }
+
+        if (verbose) cout << "\nTesting malformed unknown elements." << endl;
+        {
+            const char INPUT[] = "{\"name\":\"Bob\","
+                                 "\"extra\":[{\"a\":1 2},\"{\"],"
+                                 "\"age\":21}";
+
+            baljsn::Decoder        decoder;
+            baljsn::DecoderOptions options;
+            options.setSkipUnknownElements(true);
+            {
+                test::Employee     bob;
+                bsl::istringstream iss(INPUT);
+                ASSERT(0 != decoder.decode(iss, &bob, options));
+                ASSERT(0 == decoder.numBytesSkipped());
+            }
+
+            options.setValidateSkippedElements(false);
+            {
+                test::Employee     bob;
+                bsl::istringstream iss(INPUT);
+                ASSERT(0 == decoder.decode(iss, &bob, options));
+                ASSERT("Bob" == bob.name());
+                ASSERT(21    == bob.age());
+                ASSERTV(decoder.numBytesSkipped(),
+                        16 == decoder.numBytesSkipped());
             }
         }
       } break;
@@ -37,6 +37,8 @@ const int DecoderOptions::DEFAULT_INITIALIZER_MAX_DEPTH = 32;
 
 const bool DecoderOptions::DEFAULT_INITIALIZER_SKIP_UNKNOWN_ELEMENTS = true;
 
+const bool DecoderOptions::DEFAULT_INITIALIZER_VALIDATE_SKIPPED_ELEMENTS = true;
+
 const bdlat_AttributeInfo DecoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
     {
         ATTRIBUTE_ID_MAX_DEPTH,
@@ -51,6 +53,13 @@ const bdlat_AttributeInfo DecoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
         sizeof("SkipUnknownElements") - 1,
         "",
         bdlat_FormattingMode::e_TEXT
+    },
+    {
+        ATTRIBUTE_ID_VALIDATE_SKIPPED_ELEMENTS,
+        "ValidateSkippedElements",
+        sizeof("ValidateSkippedElements") - 1,
+        "",
+        bdlat_FormattingMode::e_TEXT
     }
 };
 
@@ -60,7 +69,7 @@ const bdlat_AttributeInfo *DecoderOptions::lookupAttributeInfo(
         const char *name,
         int         nameLength)
 {
-    for (int i = 0; i < 2; ++i) {
+    for (int i = 0; i < 3; ++i) {
         const bdlat_AttributeInfo& attributeInfo =
                     DecoderOptions::ATTRIBUTE_INFO_ARRAY[i];
 
@@ -81,6 +90,9 @@ const bdlat_AttributeInfo *DecoderOptions::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_MAX_DEPTH];
       case ATTRIBUTE_ID_SKIP_UNKNOWN_ELEMENTS:
         return &ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS];
+      case ATTRIBUTE_ID_VALIDATE_SKIPPED_ELEMENTS:
+        return &ATTRIBUTE_INFO_ARRAY[
+                                   ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS];
       default:
         return 0;
     }
@@ -91,12 +103,14 @@ const bdlat_AttributeInfo *DecoderOptions::lookupAttributeInfo(int id)
 DecoderOptions::DecoderOptions()
 : d_maxDepth(DEFAULT_INITIALIZER_MAX_DEPTH)
 , d_skipUnknownElements(DEFAULT_INITIALIZER_SKIP_UNKNOWN_ELEMENTS)
+, d_validateSkippedElements(DEFAULT_INITIALIZER_VALIDATE_SKIPPED_ELEMENTS)
 {
 }
 
 DecoderOptions::DecoderOptions(const DecoderOptions& original)
 : d_maxDepth(original.d_maxDepth)
 , d_skipUnknownElements(original.d_skipUnknownElements)
+, d_validateSkippedElements(original.d_validateSkippedElements)
 {
 }
 
@@ -112,6 +126,7 @@ DecoderOptions::operator=(const DecoderOptions& rhs)
     if (this != &rhs) {
         d_maxDepth = rhs.d_maxDepth;
         d_skipUnknownElements = rhs.d_skipUnknownElements;
+        d_validateSkippedElements = rhs.d_validateSkippedElements;
     }
 
     return *this;
@@ -121,6 +136,7 @@ void DecoderOptions::reset()
 {
     d_maxDepth = DEFAULT_INITIALIZER_MAX_DEPTH;
     d_skipUnknownElements = DEFAULT_INITIALIZER_SKIP_UNKNOWN_ELEMENTS;
+    d_validateSkippedElements = DEFAULT_INITIALIZER_VALIDATE_SKIPPED_ELEMENTS;
 }
 
 // ACCESSORS
@@ -134,6 +150,8 @@ bsl::ostream& DecoderOptions::print(
     printer.start();
     printer.printAttribute("maxDepth", d_maxDepth);
     printer.printAttribute("skipUnknownElements", d_skipUnknownElements);
+    printer.printAttribute("validateSkippedElements",
+                           d_validateSkippedElements);
     printer.end();
     return stream;
 }
@@ -21,14 +21,20 @@ BSLS_IDENT("$Id: $")
 ///Attributes
 ///----------
 //..
-//  Name                  Type           Default         Simple Constraints
-//  ------------------    -----------    -------         ------------------
-//  maxDepth              int            32              >= 0
-//  skipUnknownElements   bool           true            none
+//  Name                     Type        Default         Simple Constraints
+//  -----------------------  ----------  -------         ------------------
+//  maxDepth                 int         32              >= 0
+//  skipUnknownElements      bool        true            none
+//  validateSkippedElements  bool        true            none
 //..
 //: o 'maxDepth': maximum depth of the decoded data
 //:
 //: o 'skipUnknownElements': flag specifying if unknown elements are skipped
+//:
+//: o 'validateSkippedElements': flag specifying if the syntax of skipped
+//:   unknown elements is validated; if 'false', unknown elements are skipped
+//:   by counting brackets and quotes, without tokenizing their contents, and
+//:   the 'maxDepth' limit does not apply to them
 //
 ///Implementation Note
 ///- - - - - - - - - -
@@ -114,21 +120,25 @@ class DecoderOptions {
         // maximum recursion depth
     bool  d_skipUnknownElements;
         // option to skip unknown elements 
+    bool  d_validateSkippedElements;
+        // option to validate the syntax of skipped unknown elements
 
   public:
     // TYPES
     enum {
         ATTRIBUTE_ID_MAX_DEPTH             = 0
       , ATTRIBUTE_ID_SKIP_UNKNOWN_ELEMENTS = 1
+      , ATTRIBUTE_ID_VALIDATE_SKIPPED_ELEMENTS = 2
     };
 
     enum {
-        NUM_ATTRIBUTES = 2
+        NUM_ATTRIBUTES = 3
     };
 
     enum {
         ATTRIBUTE_INDEX_MAX_DEPTH             = 0
       , ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS = 1
+      , ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS = 2
     };
 
     // CONSTANTS
@@ -138,6 +148,8 @@ class DecoderOptions {
 
     static const bool DEFAULT_INITIALIZER_SKIP_UNKNOWN_ELEMENTS;
 
+    static const bool DEFAULT_INITIALIZER_VALIDATE_SKIPPED_ELEMENTS;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -209,6 +221,10 @@ class DecoderOptions {
         // Set the "SkipUnknownElements" attribute of this object to the
         // specified 'value'.
 
+    void setValidateSkippedElements(bool value);
+        // Set the "ValidateSkippedElements" attribute of this object to the
+        // specified 'value'.
+
     // ACCESSORS
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
@@ -260,6 +276,10 @@ class DecoderOptions {
     bool skipUnknownElements() const;
         // Return a reference to the non-modifiable "SkipUnknownElements"
         // attribute of this object.
+
+    bool validateSkippedElements() const;
+        // Return a reference to the non-modifiable "ValidateSkippedElements"
+        // attribute of this object.
 };
 
 // FREE OPERATORS
@@ -314,6 +334,11 @@ int DecoderOptions::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;
     }
 
+    ret = manipulator(&d_validateSkippedElements, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -329,6 +354,9 @@ int DecoderOptions::manipulateAttribute(MANIPULATOR& manipulator, int id)
       case ATTRIBUTE_ID_SKIP_UNKNOWN_ELEMENTS: {
         return manipulator(&d_skipUnknownElements, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS]);
       } break;
+      case ATTRIBUTE_ID_VALIDATE_SKIPPED_ELEMENTS: {
+        return manipulator(&d_validateSkippedElements, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS]);
+      } break;
       default:
         return NOT_FOUND;
     }
@@ -365,6 +393,12 @@ void DecoderOptions::setSkipUnknownElements(bool value)
     d_skipUnknownElements = value;
 }
 
+inline
+void DecoderOptions::setValidateSkippedElements(bool value)
+{
+    d_validateSkippedElements = value;
+}
+
 // ACCESSORS
 template <class ACCESSOR>
 int DecoderOptions::accessAttributes(ACCESSOR& accessor) const
@@ -381,6 +415,11 @@ int DecoderOptions::accessAttributes(ACCESSOR& accessor) const
         return ret;
     }
 
+    ret = accessor(d_validateSkippedElements, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS]);
+    if (ret) {
+        return ret;
+    }
+
     return ret;
 }
 
@@ -396,6 +435,9 @@ int DecoderOptions::accessAttribute(ACCESSOR& accessor, int id) const
       case ATTRIBUTE_ID_SKIP_UNKNOWN_ELEMENTS: {
         return accessor(d_skipUnknownElements, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS]);
       } break;
+      case ATTRIBUTE_ID_VALIDATE_SKIPPED_ELEMENTS: {
+        return accessor(d_validateSkippedElements, ATTRIBUTE_INFO_ARRAY[ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS]);
+      } break;
       default:
         return NOT_FOUND;
     }
@@ -430,6 +472,12 @@ bool DecoderOptions::skipUnknownElements() const
     return d_skipUnknownElements;
 }
 
+inline
+bool DecoderOptions::validateSkippedElements() const
+{
+    return d_validateSkippedElements;
+}
+
 }  // close package namespace
 
 // FREE FUNCTIONS
@@ -440,7 +488,8 @@ bool baljsn::operator==(
         const baljsn::DecoderOptions& rhs)
 {
     return  lhs.maxDepth() == rhs.maxDepth()
-         && lhs.skipUnknownElements() == rhs.skipUnknownElements();
+         && lhs.skipUnknownElements() == rhs.skipUnknownElements()
+         && lhs.validateSkippedElements() == rhs.validateSkippedElements();
 }
 
 inline
@@ -449,7 +498,8 @@ bool baljsn::operator!=(
         const baljsn::DecoderOptions& rhs)
 {
     return  lhs.maxDepth() != rhs.maxDepth()
-         || lhs.skipUnknownElements() != rhs.skipUnknownElements();
+         || lhs.skipUnknownElements() != rhs.skipUnknownElements()
+         || lhs.validateSkippedElements() != rhs.validateSkippedElements();
 }
 
 inline
@@ -33,10 +33,12 @@ using namespace bsl;
 // Primary Manipulators:
 //: o 'setMaxDepth'
 //: o 'setSkipUnknownElements'
+//: o 'setValidateSkippedElements'
 //
 // Basic Accessors:
 //: o 'maxDepth'
 //: o 'skipUnknownElements'
+//: o 'validateSkippedElements'
 //
 // Certain standard value-semantic-type test cases are omitted:
 //: o [ 8] -- 'swap' is not implemented for this class.
@@ -63,11 +65,13 @@ using namespace bsl;
 // [10] STREAM& bdexStreamIn(STREAM& stream, int version);
 // [ 3] setMaxDepth(int value);
 // [ 3] setSkipUnknownElements(bool value);
+// [ 3] setValidateSkippedElements(bool value);
 //
 // ACCESSORS
 // [10] STREAM& bdexStreamOut(STREAM& stream, int version) const;
 // [ 4] int  maxDepth() const;
 // [ 4] bool skipUnknownElements() const;
+// [ 4] bool validateSkippedElements() const;
 //
 // [ 5] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
 //
@@ -161,27 +165,32 @@ struct DefaultDataRow {
     int         d_line;           // source line number
     int         d_maxDepth;
     bool        d_skipUnknownElements;
+    bool        d_validateSkippedElements;
 };
 
 static
 const DefaultDataRow DEFAULT_DATA[] =
 {
-    //LINE  MAX_DEPTH   SKIP_ELEMS
-    //----  ---------   ----------
+    //LINE  MAX_DEPTH   SKIP_ELEMS  VALIDATE
+    //----  ---------   ----------  --------
 
     // default (must be first)
-    { L_,        32,    true },
+    { L_,        32,    true,       true  },
 
     // 'maxDepth'
-    { L_,         1,  false },
-    { L_,   INT_MAX,  false },
+    { L_,         1,  false,        true  },
+    { L_,   INT_MAX,  false,        true  },
 
     // 'skipUnknownElements'
-    { L_,         0,   true },
+    { L_,         0,   true,        true  },
+
+    // 'validateSkippedElements'
+    { L_,        32,   true,        false },
+    { L_,         1,  false,        false },
 
     // other
-    { L_,         1,   true },
-    { L_,   INT_MAX,   true },
+    { L_,         1,   true,        true  },
+    { L_,   INT_MAX,   true,        true  },
 };
 const int DEFAULT_NUM_DATA = sizeof DEFAULT_DATA / sizeof *DEFAULT_DATA;
 
@@ -384,14 +393,17 @@ int main(int argc, char *argv[])
             const int   LINE1    = DATA[ti].d_line;
             const int   DEPTH1  = DATA[ti].d_maxDepth;
             const int   SKIP1     = DATA[ti].d_skipUnknownElements;
+            const bool  VALIDATE1 = DATA[ti].d_validateSkippedElements;
 
             Obj mZ;  const Obj& Z = mZ;
             mZ.setMaxDepth(DEPTH1);
             mZ.setSkipUnknownElements(SKIP1);
+            mZ.setValidateSkippedElements(VALIDATE1);
 
             Obj mZZ;  const Obj& ZZ = mZZ;
             mZZ.setMaxDepth(DEPTH1);
             mZZ.setSkipUnknownElements(SKIP1);
+            mZZ.setValidateSkippedElements(VALIDATE1);
 
             if (veryVerbose) { T_ P_(LINE1) P_(Z) P(ZZ) }
 
@@ -408,10 +420,12 @@ int main(int argc, char *argv[])
                 const int   LINE2    = DATA[tj].d_line;
                 const int   DEPTH2  = DATA[tj].d_maxDepth;
                 const int   SKIP2     = DATA[tj].d_skipUnknownElements;
+                const bool  VALIDATE2 = DATA[tj].d_validateSkippedElements;
 
                 Obj mX;  const Obj& X = mX;
                 mX.setMaxDepth(DEPTH2);
                 mX.setSkipUnknownElements(SKIP2);
+                mX.setValidateSkippedElements(VALIDATE2);
 
                 if (veryVerbose) { T_ P_(LINE2) P(X) }
 
@@ -430,10 +444,12 @@ int main(int argc, char *argv[])
                 Obj mX;  const Obj& X = mX;
                 mX.setMaxDepth(DEPTH1);
                 mX.setSkipUnknownElements(SKIP1);
+                mX.setValidateSkippedElements(VALIDATE1);
 
                 Obj mZZ;  const Obj& ZZ = mZZ;
                 mZZ.setMaxDepth(DEPTH1);
                 mZZ.setSkipUnknownElements(SKIP1);
+                mZZ.setValidateSkippedElements(VALIDATE1);
 
                 const Obj& Z = mX;
 
@@ -522,14 +538,17 @@ int main(int argc, char *argv[])
             const int   LINE    = DATA[ti].d_line;
             const int   DEPTH   = DATA[ti].d_maxDepth;
             const int   SKIP    = DATA[ti].d_skipUnknownElements;
+            const bool  VALIDATE = DATA[ti].d_validateSkippedElements;
 
             Obj mZ;  const Obj& Z = mZ;
             mZ.setMaxDepth(DEPTH);
             mZ.setSkipUnknownElements(SKIP);
+            mZ.setValidateSkippedElements(VALIDATE);
 
             Obj mZZ;  const Obj& ZZ = mZZ;
             mZZ.setMaxDepth(DEPTH);
             mZZ.setSkipUnknownElements(SKIP);
+            mZZ.setValidateSkippedElements(VALIDATE);
 
             if (veryVerbose) { T_ P_(Z) P(ZZ) }
 
@@ -655,6 +674,7 @@ int main(int argc, char *argv[])
 
         typedef int   T1;        // 'maxDepth'
         typedef bool  T2;        // 'skipUnknownElements'
+        typedef bool  T3;        // 'validateSkippedElements'
 
                       // ------------------------------
                       // Attribute 1 Values: 'maxDepth'
@@ -670,6 +690,13 @@ int main(int argc, char *argv[])
         const T2 A2 = true;                  // baseline
         const T2 B2 = false;
 
+              // ---------------------------------------------
+              // Attribute 3 Values: 'validateSkippedElements'
+              // ---------------------------------------------
+
+        const T3 A3 = true;                  // baseline
+        const T3 B3 = false;
+
         if (verbose) cout <<
             "\nCreate a table of distinct, but similar object values." << endl;
 
@@ -677,6 +704,7 @@ int main(int argc, char *argv[])
             int   d_line;        // source line number
             int   d_maxDepth;
             bool  d_skipUnknownElements;
+            bool  d_validateSkippedElements;
         } DATA[] = {
 
         // The first row of the table below represents an object value
@@ -684,13 +712,14 @@ int main(int argc, char *argv[])
         // row differs (slightly) from the first in exactly one attribute value
         // (Bi).
 
-        //LINE  DEPTH   SKIP
-        //----  -----   ----
+        //LINE  DEPTH   SKIP   VALIDATE
+        //----  -----   ----   --------
 
-        { L_,       A1,   A2   },          // baseline
+        { L_,       A1,   A2,    A3   },          // baseline
 
-        { L_,       B1,   A2   },
-        { L_,       A1,   B2   },
+        { L_,       B1,   A2,    A3   },
+        { L_,       A1,   B2,    A3   },
+        { L_,       A1,   A2,    B3   },
 
         };
         const int NUM_DATA = sizeof DATA / sizeof *DATA;
@@ -701,8 +730,11 @@ int main(int argc, char *argv[])
             const int   LINE1    = DATA[ti].d_line;
             const int   DEPTH1  = DATA[ti].d_maxDepth;
             const int   SKIP1     = DATA[ti].d_skipUnknownElements;
+            const bool  VALIDATE1 = DATA[ti].d_validateSkippedElements;
 
-            if (veryVerbose) { T_ P_(LINE1) P_(DEPTH1) P_(SKIP1)  }
+            if (veryVerbose) {
+                T_ P_(LINE1) P_(DEPTH1) P_(SKIP1) P(VALIDATE1)
+            }
 
             // Ensure an object compares correctly with itself (alias test).
             {
@@ -710,6 +742,7 @@ int main(int argc, char *argv[])
 
                 mX.setMaxDepth(DEPTH1);
                 mX.setSkipUnknownElements(SKIP1);
+                mX.setValidateSkippedElements(VALIDATE1);
 
                 LOOP2_ASSERT(LINE1, X,   X == X);
                 LOOP2_ASSERT(LINE1, X, !(X != X));
@@ -719,8 +752,11 @@ int main(int argc, char *argv[])
                 const int   LINE2    = DATA[tj].d_line;
                 const int   DEPTH2  = DATA[tj].d_maxDepth;
                 const int   SKIP2     = DATA[tj].d_skipUnknownElements;
+                const bool  VALIDATE2 = DATA[tj].d_validateSkippedElements;
 
-                if (veryVerbose) { T_ P_(LINE1) P_(DEPTH2) P_(SKIP2) }
+                if (veryVerbose) {
+                    T_ P_(LINE1) P_(DEPTH2) P_(SKIP2) P(VALIDATE2)
+                }
 
                 const bool EXP = ti == tj;  // expected for equality comparison
 
@@ -729,9 +765,11 @@ int main(int argc, char *argv[])
 
                 mX.setMaxDepth(DEPTH1);
                 mX.setSkipUnknownElements(SKIP1);
+                mX.setValidateSkippedElements(VALIDATE1);
 
                 mY.setMaxDepth(DEPTH2);
                 mY.setSkipUnknownElements(SKIP2);
+                mY.setValidateSkippedElements(VALIDATE2);
 
                 if (veryVerbose) { T_ T_ T_ P_(EXP) P_(X) P(Y) }
 
@@ -778,7 +816,7 @@ int main(int argc, char *argv[])
         //:   having distinct values for each corresponding salient attribute,
         //:   and various values for the two formatting parameters, along with
         //:   the expected output
-        //:     ( 'value' x  'level'   x 'skipUnknownElements' ):
+        //:     ( 'value' x  'level'   x 'spacesPerLevel' ):
         //:     1 { A   } x {  0     } x {  0, 1, -1 }  -->  3 expected outputs
         //:     2 { A   } x {  3, -3 } x {  0, 2, -2 }  -->  6 expected outputs
         //:     3 { B   } x {  2     } x {  3        }  -->  1 expected output
@@ -837,6 +875,7 @@ int main(int argc, char *argv[])
 
             int         d_maxDepth;
             bool        d_skipUnknownElements;
+            bool        d_validateSkippedElements;
 
             const char *d_expected_p;
         } DATA[] = {
@@ -848,24 +887,30 @@ int main(int argc, char *argv[])
         // P-2.1.1: { A } x { 0 } x { 0, 1, -1 } --> 3 expected outputs
         // ------------------------------------------------------------------
 
-        //LINE L SPL  MD   SUE  EXP
-        //---- - ---  ---  ---  ---
+        //LINE L SPL  MD  SUE    VSE
+        //---- - ---  --  ---    ---
 
-        { L_,  0,  0, 89, true,  "["                                         NL
+        { L_,  0,  0, 89, true,  true,
+                                 "["                                         NL
                                  "maxDepth = 89"                             NL
                                  "skipUnknownElements = true"                NL
+                                 "validateSkippedElements = true"            NL
                                  "]"                                         NL
                                                                              },
 
-        { L_,  0,  1, 89, true,  "["                                         NL
+        { L_,  0,  1, 89, true,  true,
+                                 "["                                         NL
                                  " maxDepth = 89"                            NL
                                  " skipUnknownElements = true"               NL
+                                 " validateSkippedElements = true"           NL
                                  "]"                                         NL
                                                                              },
 
-        { L_,  0, -1, 89, false, "["                                         SP
+        { L_,  0, -1, 89, false, false,
+                                 "["                                         SP
                                  "maxDepth = 89"                             SP
                                  "skipUnknownElements = false"               SP
+                                 "validateSkippedElements = false"           SP
                                  "]"
                                                                              },
 
@@ -873,42 +918,54 @@ int main(int argc, char *argv[])
         // P-2.1.2: { A } x { 3, -3 } x { 0, 2, -2 } --> 6 expected outputs
         // ------------------------------------------------------------------
 
-        //LINE L SPL  MD   SUE  EXP
-        //---- - ---  ---  ---  ---
+        //LINE L SPL  MD  SUE    VSE
+        //---- - ---  --  ---    ---
 
-        { L_,  3,  0, 89, true,  "["                                         NL
+        { L_,  3,  0, 89, true,  true,
+                                 "["                                         NL
                                  "maxDepth = 89"                             NL
                                  "skipUnknownElements = true"                NL
+                                 "validateSkippedElements = true"            NL
                                  "]"                                         NL
                                                                              },
 
-        { L_,  3,  2, 89, false, "      ["                                   NL
+        { L_,  3,  2, 89, false, false,
+                                 "      ["                                   NL
                                  "        maxDepth = 89"                     NL
                                  "        skipUnknownElements = false"       NL
+                                 "        validateSkippedElements = false"   NL
                                  "      ]"                                   NL
                                                                              },
 
-        { L_,  3, -2, 89, false, "      ["                                   SP
+        { L_,  3, -2, 89, false, false,
+                                 "      ["                                   SP
                                  "maxDepth = 89"                             SP
                                  "skipUnknownElements = false"               SP
+                                 "validateSkippedElements = false"           SP
                                  "]"
                                                                              },
 
-        { L_, -3,  0, 89, true,  "["                                         NL
+        { L_, -3,  0, 89, true,  true,
+                                 "["                                         NL
                                  "maxDepth = 89"                             NL
                                  "skipUnknownElements = true"                NL
+                                 "validateSkippedElements = true"            NL
                                  "]"                                         NL
                                                                              },
 
-        { L_, -3,  2, 89, false, "["                                         NL
+        { L_, -3,  2, 89, false, false,
+                                 "["                                         NL
                                  "        maxDepth = 89"                     NL
                                  "        skipUnknownElements = false"       NL
+                                 "        validateSkippedElements = false"   NL
                                  "      ]"                                   NL
                                                                              },
 
-        { L_, -3, -2, 89, true,  "["                                         SP
+        { L_, -3, -2, 89, true,  true,
+                                 "["                                         SP
                                  "maxDepth = 89"                             SP
                                  "skipUnknownElements = true"                SP
+                                 "validateSkippedElements = true"            SP
                                  "]"
                                                                              },
 
@@ -916,12 +973,14 @@ int main(int argc, char *argv[])
         // P-2.1.3: { B } x { 2 } x { 3 } --> 1 expected output
         // -----------------------------------------------------------------
 
-        //LINE L SPL  MD   SUE  EXP
-        //---- - ---  ---  ---  ---
+        //LINE L SPL  MD  SUE    VSE
+        //---- - ---  --  ---    ---
 
-        { L_,  2,  3, 89, true,  "      ["                                   NL
+        { L_,  2,  3, 89, true,  true,
+                                 "      ["                                   NL
                                  "         maxDepth = 89"                    NL
                                  "         skipUnknownElements = true"       NL
+                                 "         validateSkippedElements = true"   NL
                                  "      ]"                                   NL
                                                                              },
 
@@ -929,17 +988,21 @@ int main(int argc, char *argv[])
         // P-2.1.4: { A B } x { -9 } x { -9 } --> 2 expected outputs
         // -----------------------------------------------------------------
 
-        //LINE L SPL  MD   SUE  EXP
-        //---- - ---  ---  ---  ---
+        //LINE L SPL  MD  SUE    VSE
+        //---- - ---  --  ---    ---
 
-        { L_, -9, -9,  89, true, "["                                         SP
+        { L_, -9, -9,  89, true,  true,
+                                 "["                                         SP
                                  "maxDepth = 89"                             SP
                                  "skipUnknownElements = true"                SP
+                                 "validateSkippedElements = true"            SP
                                  "]"                                         },
 
-        { L_, -9, -9,   7, false, "["                                        SP
+        { L_, -9, -9,   7, false, false,
+                                 "["                                         SP
                                  "maxDepth = 7"                              SP
                                  "skipUnknownElements = false"               SP
+                                 "validateSkippedElements = false"           SP
                                  "]"                                         },
 
 #undef NL
@@ -958,6 +1021,7 @@ int main(int argc, char *argv[])
 
                 const int         MAX_DEPTH  = DATA[ti].d_maxDepth;
                 const int         SKIP_ELEMS = DATA[ti].d_skipUnknownElements;
+                const bool  VALIDATE = DATA[ti].d_validateSkippedElements;
 
                 const char *const EXP    = DATA[ti].d_expected_p;
 
@@ -968,6 +1032,7 @@ int main(int argc, char *argv[])
                 Obj mX;  const Obj& X = mX;
                 mX.setMaxDepth(MAX_DEPTH);
                 mX.setSkipUnknownElements(SKIP_ELEMS);
+                mX.setValidateSkippedElements(VALIDATE);
 
                 ostringstream os;
 
@@ -1028,6 +1093,7 @@ int main(int argc, char *argv[])
         // Testing:
         //   int  maxDepth() const;
         //   bool skipUnknownElements() const;
+        //   bool validateSkippedElements() const;
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -1038,6 +1104,7 @@ int main(int argc, char *argv[])
 
         typedef int   T1;        // 'maxDepth'
         typedef bool  T2;        // 'skipUnknownElements'
+        typedef bool  T3;        // 'validateSkippedElements'
 
         if (verbose) cout << "\nEstablish suitable attribute values." << endl;
 
@@ -1047,6 +1114,7 @@ int main(int argc, char *argv[])
 
         const int   D1   = 32;                    // 'maxDepth'
         const int   D2   = true;                  // 'skipUnknownElements'
+        const bool  D3   = true;                  // 'validateSkippedElements'
 
                        // ----------------------------
                        // 'A' values: Boundary values.
@@ -1054,6 +1122,7 @@ int main(int argc, char *argv[])
 
         const int   A1   = INT_MAX;              // 'maxDepth'
         const int   A2   = false;                // 'skipUnknownElements'
+        const bool  A3   = false;                // 'validateSkippedElements'
 
         if (verbose) cout << "\nCreate an object." << endl;
 
@@ -1067,6 +1136,10 @@ int main(int argc, char *argv[])
 
             const T2& skipUnknownElements = X.skipUnknownElements();
             LOOP2_ASSERT(D2, skipUnknownElements, D2 == skipUnknownElements);
+
+            const T3& validateSkippedElements = X.validateSkippedElements();
+            LOOP2_ASSERT(D3, validateSkippedElements,
+                         D3 == validateSkippedElements);
         }
 
         if (verbose) cout <<
@@ -1087,6 +1160,15 @@ int main(int argc, char *argv[])
             const T2& skipUnknownElements = X.skipUnknownElements();
             LOOP2_ASSERT(A2, skipUnknownElements, A2 == skipUnknownElements);
         }
+
+        if (veryVerbose) { T_ Q(validateSkippedElements) }
+        {
+            mX.setValidateSkippedElements(A3);
+
+            const T3& validateSkippedElements = X.validateSkippedElements();
+            LOOP2_ASSERT(A3, validateSkippedElements,
+                         A3 == validateSkippedElements);
+        }
       } break;
       case 3: {
         // --------------------------------------------------------------------
@@ -1132,6 +1214,7 @@ int main(int argc, char *argv[])
         // Testing:
         //   setMaxDepth(int value);
         //   setSkipUnknownElements(int value);
+        //   setValidateSkippedElements(bool value);
         // --------------------------------------------------------------------
 
         if (verbose) cout << endl
@@ -1144,16 +1227,19 @@ int main(int argc, char *argv[])
 
         const int   D1   = 32;                   // 'maxDepth'
         const bool  D2   = true;                 // 'skipUnknownElements'
+        const bool  D3   = true;                 // 'validateSkippedElements'
 
         // 'A' values.
 
         const int   A1   = 1;                    // 'maxDepth'
         const int   A2   = false;                // 'skipUnknownElements'
+        const bool  A3   = false;                // 'validateSkippedElements'
 
         // 'B' values.
 
         const int   B1   = INT_MAX;              // 'maxDepth'
         const int   B2   = true;                 // 'skipUnknownElements'
+        const bool  B3   = true;                 // 'validateSkippedElements'
 
         Obj mX;  const Obj& X = mX;
 
@@ -1167,14 +1253,17 @@ int main(int argc, char *argv[])
             mX.setMaxDepth(A1);
             ASSERT(A1 == X.maxDepth());
             ASSERT(D2 == X.skipUnknownElements());
+            ASSERT(D3 == X.validateSkippedElements());
 
             mX.setMaxDepth(B1);
             ASSERT(B1 == X.maxDepth());
             ASSERT(D2 == X.skipUnknownElements());
+            ASSERT(D3 == X.validateSkippedElements());
 
             mX.setMaxDepth(D1);
             ASSERT(D1 == X.maxDepth());
             ASSERT(D2 == X.skipUnknownElements());
+            ASSERT(D3 == X.validateSkippedElements());
         }
 
         // ---------------------
@@ -1184,14 +1273,37 @@ int main(int argc, char *argv[])
             mX.setSkipUnknownElements(A2);
             ASSERT(D1 == X.maxDepth());
             ASSERT(A2 == X.skipUnknownElements());
+            ASSERT(D3 == X.validateSkippedElements());
 
             mX.setSkipUnknownElements(B2);
             ASSERT(D1 == X.maxDepth());
             ASSERT(B2 == X.skipUnknownElements());
+            ASSERT(D3 == X.validateSkippedElements());
 
             mX.setSkipUnknownElements(D2);
             ASSERT(D1 == X.maxDepth());
             ASSERT(D2 == X.skipUnknownElements());
+            ASSERT(D3 == X.validateSkippedElements());
+        }
+
+        // -------------------------
+        // 'validateSkippedElements'
+        // -------------------------
+        {
+            mX.setValidateSkippedElements(A3);
+            ASSERT(D1 == X.maxDepth());
+            ASSERT(D2 == X.skipUnknownElements());
+            ASSERT(A3 == X.validateSkippedElements());
+
+            mX.setValidateSkippedElements(B3);
+            ASSERT(D1 == X.maxDepth());
+            ASSERT(D2 == X.skipUnknownElements());
+            ASSERT(B3 == X.validateSkippedElements());
+
+            mX.setValidateSkippedElements(D3);
+            ASSERT(D1 == X.maxDepth());
+            ASSERT(D2 == X.skipUnknownElements());
+            ASSERT(D3 == X.validateSkippedElements());
         }
 
         if (verbose) cout << "Corroborate attribute independence." << endl;
@@ -1202,9 +1314,11 @@ int main(int argc, char *argv[])
 
             mX.setMaxDepth(A1);
             mX.setSkipUnknownElements(A2);
+            mX.setValidateSkippedElements(A3);
 
             ASSERT(A1 == X.maxDepth());
             ASSERT(A2 == X.skipUnknownElements());
+            ASSERT(A3 == X.validateSkippedElements());
 
                  // ---------------------------------------
                  // Set all attributes to their 'B' values.
@@ -1214,11 +1328,19 @@ int main(int argc, char *argv[])
 
             ASSERT(B1 == X.maxDepth());
             ASSERT(A2 == X.skipUnknownElements());
+            ASSERT(A3 == X.validateSkippedElements());
 
             mX.setSkipUnknownElements(B2);
 
             ASSERT(B1 == X.maxDepth());
             ASSERT(B2 == X.skipUnknownElements());
+            ASSERT(A3 == X.validateSkippedElements());
+
+            mX.setValidateSkippedElements(B3);
+
+            ASSERT(B1 == X.maxDepth());
+            ASSERT(B2 == X.skipUnknownElements());
+            ASSERT(B3 == X.validateSkippedElements());
         }
 
         if (verbose) cout << "\nNegative Testing." << endl;
@@ -1264,6 +1386,7 @@ int main(int argc, char *argv[])
 
         const int   D1   = 32;                   // 'maxDepth'
         const bool  D2   = true;                 // 'skipUnknownElements'
+        const bool  D3   = true;                 // 'validateSkippedElements'
 
         if (verbose) cout <<
                      "Create an object using the default constructor." << endl;
@@ -1279,6 +1402,8 @@ int main(int argc, char *argv[])
         LOOP2_ASSERT(D1, X.maxDepth(), D1 == X.maxDepth());
         LOOP2_ASSERT(D2, X.skipUnknownElements(),
                      D2 == X.skipUnknownElements());
+        LOOP2_ASSERT(D3, X.validateSkippedElements(),
+                     D3 == X.validateSkippedElements());
       } break;
       case 1: {
         // --------------------------------------------------------------------
@@ -1312,6 +1437,7 @@ int main(int argc, char *argv[])
 
         typedef int    T1;        // 'maxDepth'
         typedef bool   T2;        // 'skipUnknownElements'
+        typedef bool   T3;        // 'validateSkippedElements'
 
         // Attribute 1 Values: 'maxDepth'
 
@@ -1323,6 +1449,11 @@ int main(int argc, char *argv[])
         const T2 D2 = true;    // default value
         const T2 A2 = false;
 
+        // Attribute 3 Values: 'validateSkippedElements'
+
+        const T3 D3 = true;    // default value
+        const T3 A3 = false;
+
         // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
         if (verbose) cout << "\n 1. Create an object 'w' (default ctor)."
@@ -1335,6 +1466,7 @@ int main(int argc, char *argv[])
 
         ASSERT(D1 == W.maxDepth());
         ASSERT(D2 == W.skipUnknownElements());
+        ASSERT(D3 == W.validateSkippedElements());
 
         if (veryVerbose) cout <<
                   "\tb. Try equality operators: 'w' <op> 'w'." << endl;
@@ -1353,6 +1485,7 @@ int main(int argc, char *argv[])
 
         ASSERT(D1 == X.maxDepth());
         ASSERT(D2 == X.skipUnknownElements());
+        ASSERT(D3 == X.validateSkippedElements());
 
         if (veryVerbose) cout <<
                    "\tb. Try equality operators: 'x' <op> 'w', 'x'." << endl;
@@ -1367,12 +1500,14 @@ int main(int argc, char *argv[])
 
         mX.setMaxDepth(A1);
         mX.setSkipUnknownElements(A2);
+        mX.setValidateSkippedElements(A3);
 
         if (veryVerbose) cout << "\ta. Check new value of 'x'." << endl;
         if (veryVeryVerbose) { T_ T_ P(X) }
 
         ASSERT(A1 == X.maxDepth());
         ASSERT(A2 == X.skipUnknownElements());
+        ASSERT(A3 == X.validateSkippedElements());
 
         if (veryVerbose) cout <<
              "\tb. Try equality operators: 'x' <op> 'w', 'x'." << endl;
@@ -1388,12 +1523,14 @@ int main(int argc, char *argv[])
         Obj mY;  const Obj& Y = mY;
         mY.setMaxDepth(A1);
         mY.setSkipUnknownElements(A2);
+        mY.setValidateSkippedElements(A3);
 
         if (veryVerbose) cout << "\ta. Check initial value of 'y'." << endl;
         if (veryVeryVerbose) { T_ T_ P(Y) }
 
         ASSERT(A1 == Y.maxDepth());
         ASSERT(A2 == Y.skipUnknownElements());
+        ASSERT(A3 == Y.validateSkippedElements());
 
         if (veryVerbose) cout <<
              "\tb. Try equality operators: 'y' <op> 'w', 'x', 'y'" << endl;
@@ -1414,6 +1551,7 @@ int main(int argc, char *argv[])
 
         ASSERT(A1 == Z.maxDepth());
         ASSERT(A2 == Z.skipUnknownElements());
+        ASSERT(A3 == Z.validateSkippedElements());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: 'z' <op> 'w', 'x', 'y', 'z'." << endl;
@@ -1430,12 +1568,14 @@ int main(int argc, char *argv[])
 
         mZ.setMaxDepth(D1);
         mZ.setSkipUnknownElements(D2);
+        mZ.setValidateSkippedElements(D3);
 
         if (veryVerbose) cout << "\ta. Check new value of 'z'." << endl;
         if (veryVeryVerbose) { T_ T_ P(Z) }
 
         ASSERT(D1 == Z.maxDepth());
         ASSERT(D2 == Z.skipUnknownElements());
+        ASSERT(D3 == Z.validateSkippedElements());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: 'z' <op> 'w', 'x', 'y', 'z'." << endl;
@@ -1456,6 +1596,7 @@ int main(int argc, char *argv[])
 
         ASSERT(A1 == W.maxDepth());
         ASSERT(A2 == W.skipUnknownElements());
+        ASSERT(A3 == W.validateSkippedElements());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: 'w' <op> 'w', 'x', 'y', 'z'." << endl;
@@ -1476,6 +1617,7 @@ int main(int argc, char *argv[])
 
         ASSERT(D1 == W.maxDepth());
         ASSERT(D2 == W.skipUnknownElements());
+        ASSERT(D3 == W.validateSkippedElements());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: 'x' <op> 'w', 'x', 'y', 'z'." << endl;
@@ -1496,6 +1638,7 @@ int main(int argc, char *argv[])
 
         ASSERT(A1 == X.maxDepth());
         ASSERT(A2 == X.skipUnknownElements());
+        ASSERT(A3 == X.validateSkippedElements());
 
         if (veryVerbose) cout <<
            "\tb. Try equality operators: 'x' <op> 'w', 'x', 'y', 'z'." << endl;
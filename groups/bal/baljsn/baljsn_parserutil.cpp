@@ -10,6 +10,7 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bdlde_charconvertutf32.h>
 
 #include <bdlb_chartype.h>
+#include <bdlb_numericparseutil.h>
 #include <bdlb_string.h>
 
 #include <bdldfp_decimalutil.h>
@@ -20,7 +21,6 @@ BSLS_IDENT_RCSID(baljsn_parserutil_cpp,"$Id$ $CSID$")
 #include <bsl_algorithm.h>
 #include <bsl_cmath.h>
 #include <bsl_cctype.h>
-#include <bsl_cerrno.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
 #include <bsl_iosfwd.h>
@@ -312,24 +312,9 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
         return loadInfOrNan(value, data);                             // RETURN
     }
 
-    const int k_MAX_STRING_LENGTH = 63;
-    char      buffer[k_MAX_STRING_LENGTH + 1];
-
-    bdlma::BufferedSequentialAllocator allocator(buffer,
-                                                 k_MAX_STRING_LENGTH + 1);
-    bsl::string                        dataString(data.data(),
-                                                  data.length(),
-                                                  &allocator);
-
-    char   *endPtr = 0;
-    errno          = 0;
-    double  tmp    = bsl::strtod(dataString.c_str(), &endPtr);
-
-    if (endPtr    != dataString.end()
-     || (0        == tmp && 0 != errno)
-     ||  HUGE_VAL == tmp
-     || -HUGE_VAL == tmp
-     || !bsl::isdigit(*(dataString.end() - 1))) {
+    double tmp;
+    if (0 != bdlb::NumericParseUtil::parseDouble(&tmp, data)
+     || !bdlb::CharType::isDigit(data[data.length() - 1])) {
         return -1;                                                    // RETURN
     }
 
@@ -340,6 +325,13 @@ int ParserUtil::getValue(double *value, bslstl::StringRef data)
 int ParserUtil::getUint64(bsls::Types::Uint64 *value,
                           bslstl::StringRef    data)
 {
+    // Parse a plain integer, the most common form, directly.
+
+    if (0 != data.length() && bdlb::CharType::isDigit(data[0])
+     && 0 == bdlb::NumericParseUtil::parseUint64(value, data)) {
+        return 0;                                                     // RETURN
+    }
+
     const char *iter  = data.begin();
     const char *end   = data.end();
 
@@ -31,7 +31,11 @@
 #include <bslma_defaultallocatorguard.h>
 #include <bslma_testallocator.h>
 
+#include <bsls_stopwatch.h>
+
+#include <bsl_cstdio.h>
 #include <bsl_cstdlib.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -79,6 +83,7 @@ using bsl::endl;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [22] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: DECODING NUMERIC ARRAYS
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -2214,6 +2219,26 @@ int main(int argc, char *argv[])
                 {  L_,    "1e-1",                    0.1,       true    },
                 {  L_,    "1E-1",                    0.1,       true    },
 
+                {  L_,    "1.7976931348623157e308",
+                                      bsl::numeric_limits<Type>::max(),
+                                                                true    },
+                {  L_,    "2.2250738585072014e-308",
+                                      bsl::numeric_limits<Type>::min(),
+                                                                true    },
+                {  L_,    "4.9406564584124654e-324",
+                                      bsl::numeric_limits<Type>::denorm_min(),
+                                                                true    },
+                {  L_,    "1e-400",                    0,       true    },
+                {  L_,    "-1e-400",                   0,       true    },
+
+                {  L_,    "0.10000000000000000555111512312578"
+                          "27021181583404541015625",  0.1,       true    },
+                {  L_,    "3.14159265358979323846264338327950"
+                          "28841971693993751058209749445923"
+                          "07816406286208998628034825342117",
+                                              3.141592653589793,
+                                                                true    },
+
                 {  L_,    "\"NaN\"", bsl::numeric_limits<Type>::quiet_NaN(),
                                                                 true    },
 
@@ -2295,6 +2320,11 @@ int main(int argc, char *argv[])
                 {  L_,  "34.56Z1",    ERROR_VALUE,   false   },
                 {  L_,  "34.56eZ",    ERROR_VALUE,   false   },
 
+                {  L_,  "1e400",      ERROR_VALUE,   false   },
+                {  L_,  "-1e400",     ERROR_VALUE,   false   },
+                {  L_,  "1.7976931348623159e308",
+                                      ERROR_VALUE,   false   },
+
 // TBD:
 //                 {  L_,    "0x12",     ERROR_VALUE,   false   },
 //                 {  L_,    "0x256",    ERROR_VALUE,   false   },
@@ -4865,6 +4895,130 @@ int main(int argc, char *argv[])
             }
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: DECODING NUMERIC ARRAYS
+        //
+        // Concerns:
+        //: 1 Parsing the elements of a JSON array of numbers with 'getValue'
+        //:   is substantially faster than copying each element to a
+        //:   null-terminated buffer and calling 'strtod' or 'strtol'.
+        //
+        // Plan:
+        //: 1 For JSON arrays of random 'double' values written with 17
+        //:   digits, of prices written with 2 decimal places, and of random
+        //:   'int' values, split the array into its elements, as the decoder
+        //:   does, and measure the time taken to parse all elements with
+        //:   'getValue', and with the C library.  Optionally specify the
+        //:   number of elements on the command line.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: DECODING NUMERIC ARRAYS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: DECODING NUMERIC ARRAYS"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        const int NUM_ELEMENTS = argc > 2 ? atoi(argv[2]) : 1000000;
+        ASSERT(0 < NUM_ELEMENTS);
+
+        enum { k_NUM_ARRAYS = 3 };
+        const char *ARRAY_NAMES[k_NUM_ARRAYS] = {
+            "doubles (%.17g)",
+            "prices (%.2f)",
+            "integers"
+        };
+
+        unsigned int seed = 12345;
+
+        for (int a = 0; a < k_NUM_ARRAYS; ++a) {
+            bsl::string array("[");
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                char buffer[64];
+                seed = seed * 1103515245 + 12345;
+                const int random = static_cast<int>(seed >> 1);
+                switch (a) {
+                  case 0: {
+                    bsl::sprintf(buffer,
+                                 "%.17g",
+                                 (random - 0x3FFFFFFF) * 1e-7 / 3);
+                  } break;
+                  case 1: {
+                    bsl::sprintf(buffer, "%.2f", (random % 10000000) / 100.0);
+                  } break;
+                  default: {
+                    bsl::sprintf(buffer, "%d", random - 0x3FFFFFFF);
+                  } break;
+                }
+                if (i) {
+                    array += ',';
+                }
+                array += buffer;
+            }
+            array += ']';
+
+            bsl::vector<StringRef> elements;
+            elements.reserve(NUM_ELEMENTS);
+            const char *begin = array.data() + 1;
+            for (const char *end = begin; *end; ++end) {
+                if (',' == *end || ']' == *end) {
+                    elements.push_back(StringRef(begin, end));
+                    begin = end + 1;
+                }
+            }
+            ASSERT(NUM_ELEMENTS == static_cast<int>(elements.size()));
+
+            double checksum = 0;
+
+            bsls::Stopwatch timer;
+            timer.start(true);
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                if (2 == a) {
+                    int value = 0;
+                    Util::getValue(&value, elements[i]);
+                    checksum += value;
+                }
+                else {
+                    double value = 0;
+                    Util::getValue(&value, elements[i]);
+                    checksum += value;
+                }
+            }
+            timer.stop();
+            const double getValueTime = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start(true);
+            for (int i = 0; i < NUM_ELEMENTS; ++i) {
+                char buffer[64];
+                bsl::memcpy(buffer,
+                            elements[i].data(),
+                            elements[i].length());
+                buffer[elements[i].length()] = '\0';
+
+                char *end = 0;
+                if (2 == a) {
+                    checksum += static_cast<double>(
+                                              bsl::strtol(buffer, &end, 10));
+                }
+                else {
+                    checksum += bsl::strtod(buffer, &end);
+                }
+            }
+            timer.stop();
+            const double libcTime = timer.accumulatedWallTime();
+
+            cout << ARRAY_NAMES[a]
+                 << ": getValue "
+                 << getValueTime * 1e9 / NUM_ELEMENTS << " ns, C library "
+                 << libcTime * 1e9 / NUM_ELEMENTS << " ns, ratio "
+                 << libcTime / getValueTime
+                 << " (checksum " << checksum << ")" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
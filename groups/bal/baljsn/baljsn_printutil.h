@@ -95,6 +95,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlb_float.h>
 #endif
 
+#ifndef INCLUDED_BDLB_FLOATFORMATUTIL
+#include <bdlb_floatformatutil.h>
+#endif
+
 #ifndef INCLUDED_BDLDFP_DECIMAL
 #include <bdldfp_decimal.h>
 #endif
@@ -330,22 +334,12 @@ int PrintUtil::printFloatingPoint(bsl::ostream&                 stream,
         }
       } break;
       default: {
-        const int SIZE = 32;
-        char      buffer[SIZE];
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-        const int len = snprintf(buffer,
-                                 SIZE,
-                                 "%-1.*g",
-                                 maxStreamPrecision<TYPE>(options),
-                                 value);
+        char buffer[bdlb::FloatFormatUtil::k_MAX_LENGTH + 1];
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+        const int len = bdlb::FloatFormatUtil::formatGeneral(
+                                            buffer,
+                                            value,
+                                            maxStreamPrecision<TYPE>(options));
         stream.write(buffer, len);
       }
     }
@@ -759,30 +759,16 @@ int main(int argc, char *argv[])
                 { L_,         1.0e-1, 1, "0.1" },
                 { L_,   0.1234567891, 1, "0.1" },
                 { L_,   0.1234567891, 4, "0.1235" },
-                { L_,   0.1234567891, 9, "0.123456791" },
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-                // 'snprintf' on Windows outputs an additional '0' in the
-                // scientific notation.
-
-                { L_,           10.0, 1, "1e+001" },
-                { L_,         -1.5e1, 1, "-2e+001" },
-                { L_,-1.23456789e-20, 1, "-1e-020" },
-                { L_,-1.23456789e-20, 2, "-1.2e-020" },
-                { L_,-1.23456789e-20, 8, "-1.2345679e-020"  },
-                { L_,-1.23456789e-20, 9, "-1.23456787e-020" },
-                { L_, 1.23456789e-20, 1, "1e-020" },
-                { L_, 1.23456789e-20, 9, "1.23456787e-020" },
-#else
+                { L_,   0.1234567891, 9, "0.12345679" },
+
                 { L_,           10.0, 1, "1e+01" },
                 { L_,         -1.5e1, 1, "-2e+01" },
                 { L_,-1.23456789e-20, 1, "-1e-20" },
                 { L_,-1.23456789e-20, 2, "-1.2e-20" },
                 { L_,-1.23456789e-20, 8, "-1.2345679e-20"  },
-                { L_,-1.23456789e-20, 9, "-1.23456787e-20" },
+                { L_,-1.23456789e-20, 9, "-1.2345679e-20" },
                 { L_, 1.23456789e-20, 1, "1e-20" },
-                { L_, 1.23456789e-20, 9, "1.23456787e-20" },
-#endif
+                { L_, 1.23456789e-20, 9, "1.2345679e-20" },
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -868,32 +854,20 @@ int main(int argc, char *argv[])
       { L_,                     -1.5,  2, "-1.5" },
       { L_,                 -9.9e100,  2, "-9.9e+100" },
       { L_,                 -9.9e100, 15, "-9.9e+100" },
-      { L_,                 -9.9e100, 17, "-9.9000000000000003e+100" },
+      { L_,                 -9.9e100, 17, "-9.9e+100" },
       { L_,                -3.14e300, 15, "-3.14e+300" },
-      { L_,                -3.14e300, 17, "-3.1400000000000001e+300" },
+      { L_,                -3.14e300, 17, "-3.14e+300" },
       { L_,                 3.14e300,  2, "3.1e+300" },
-      { L_,                 3.14e300, 17, "3.1400000000000001e+300" },
+      { L_,                 3.14e300, 17, "3.14e+300" },
       { L_,                   1.0e-1,  1, "0.1" },
       { L_,                2.23e-308,  2, "2.2e-308" },
-      { L_,                2.23e-308, 17, "2.2300000000000001e-308" },
+      { L_,                2.23e-308, 17, "2.23e-308" },
       { L_,     0.123456789012345678,  1, "0.1" },
       { L_,     0.123456789012345678,  2, "0.12" },
       { L_,     0.123456789012345678, 15, "0.123456789012346" },
       { L_,     0.123456789012345678, 16, "0.1234567890123457" },
       { L_,     0.123456789012345678, 17, "0.12345678901234568" },
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-                // 'snprintf' on Windows outputs an additional '0' in the
-                // scientific notation.
-
-      { L_,                     10.0,  1, "1e+001" },
-      { L_,                   -1.5e1,  1, "-2e+001" },
-      { L_,  -1.2345678901234567e-20,  1, "-1e-020" },
-      { L_,  -1.2345678901234567e-20,  2, "-1.2e-020" },
-      { L_,  -1.2345678901234567e-20, 15, "-1.23456789012346e-020"  },
-      { L_,  -1.2345678901234567e-20, 16, "-1.234567890123457e-020" },
-      { L_,  -1.2345678901234567e-20, 17, "-1.2345678901234567e-020" },
-#else
       { L_,                     10.0,  1, "1e+01" },
       { L_,                   -1.5e1,  1, "-2e+01" },
       { L_,  -1.2345678901234567e-20,  1, "-1e-20" },
@@ -901,7 +875,6 @@ int main(int argc, char *argv[])
       { L_,  -1.2345678901234567e-20, 15, "-1.23456789012346e-20"  },
       { L_,  -1.2345678901234567e-20, 16, "-1.234567890123457e-20" },
       { L_,  -1.2345678901234567e-20, 17, "-1.2345678901234567e-20" },
-#endif
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -4,14 +4,29 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 
-#include <bdlb_chartype.h>
+#include <bdlb_bitutil.h>
 
+#include <bdlsb_fixedmeminstreambuf.h>
+
+#include <bsls_assert.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdint.h>
 #include <bsl_cstring.h>
 #include <bsl_ios.h>
 #include <bsl_streambuf.h>
 
 #include <baljsn_parserutil.h>                 // for testing only
 
+// LOCAL MACROS
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ || (defined(BSLS_PLATFORM_CPU_X86) && defined(__SSE2__))
+#define BALJSN_TOKENIZER_SSE2 1
+#include <emmintrin.h>
+#endif
+
 // IMPLEMENTATION NOTES
 // --------------------
 // The following table provides the various transitions that need to be handled
@@ -53,11 +68,230 @@ BSLS_IDENT_RCSID(baljsn_tokenizer_cpp,"$Id$ $CSID$")
 //   END_ARRAY                    ']'         ']'              END_ARRAY
 //..
 
+// The scanning functions below examine 16 bytes at a time using SSE2 where
+// available: each byte of a chunk is compared with the characters of interest,
+// the comparisons are combined into a 16-bit mask with 'movemask', and the
+// position of the first character of interest is the number of trailing zero
+// bits of the mask.  Elsewhere, 'findQuoteOrBackslash' uses the same technique
+// on 64-bit words (a byte of 'word ^ pattern' is zero where 'word' has the
+// byte of 'pattern'), and the other functions examine one byte at a time.
+//
+// When the held 'streambuf' is a 'bdlsb::FixedMemInStreamBuf', the tokenizer
+// does not copy the input into 'd_stringBuffer': 'reset' consumes the whole
+// input of the 'streambuf', and 'd_data_p' refers directly to its memory, so
+// that the values loaded by 'value' are references into the input.  Otherwise
+// 'd_data_p' refers to the contents of 'd_stringBuffer', and must be updated
+// whenever 'd_stringBuffer' is modified.
+
 namespace BloombergLP {
 namespace {
 
-    static const char *WHITESPACE = " \n\t\v\f\r";
-    static const char *TOKENS     = "{}[]:,";
+inline
+bool isWhitespace(char character)
+    // Return 'true' if the specified 'character' is a JSON whitespace
+    // character (' ', '\t', '\n', '\v', '\f', or '\r'), and 'false'
+    // otherwise.
+{
+    return ' ' == character
+        || static_cast<unsigned char>(character - '\t') <= '\r' - '\t';
+}
+
+inline
+bool isWhitespaceOrToken(char character)
+    // Return 'true' if the specified 'character' is a JSON whitespace
+    // character or one of '{', '}', '[', ']', ':', and ',', and 'false'
+    // otherwise.
+{
+    switch (character) {
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',': {
+        return true;                                                  // RETURN
+      }
+    }
+    return isWhitespace(character);
+}
+
+#ifdef BALJSN_TOKENIZER_SSE2
+inline
+int firstSetBit(int mask)
+    // Return the index of the lowest set bit in the specified non-zero
+    // 'mask'.
+{
+    return bdlb::BitUtil::numTrailingUnsetBits(
+                                            static_cast<bsl::uint32_t>(mask));
+}
+
+inline
+__m128i whitespaceMask(__m128i chunk)
+    // Return a vector having 0xFF in each byte where the specified 'chunk'
+    // has a JSON whitespace character, and 0 elsewhere.  Note that the bytes
+    // in the range '[\t .. \r]' are those left unchanged by both an unsigned
+    // maximum with '\t' and an unsigned minimum with '\r'.
+{
+    const __m128i inRange = _mm_and_si128(
+             _mm_cmpeq_epi8(_mm_max_epu8(chunk, _mm_set1_epi8('\t')), chunk),
+             _mm_cmpeq_epi8(_mm_min_epu8(chunk, _mm_set1_epi8('\r')), chunk));
+
+    return _mm_or_si128(inRange, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')));
+}
+#endif
+
+const char *findQuoteOrBackslash(const char *begin, const char *end)
+    // Return the address of the first '"' or '\\' in the specified range
+    // '[begin, end)', or 'end' if there is no such character.
+{
+#ifdef BALJSN_TOKENIZER_SSE2
+    const __m128i quote     = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+
+    while (end - begin >= 16) {
+        const __m128i chunk =
+                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+        const int     mask  = _mm_movemask_epi8(
+                               _mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                                            _mm_cmpeq_epi8(chunk, backslash)));
+        if (mask) {
+            return begin + firstSetBit(mask);                         // RETURN
+        }
+        begin += 16;
+    }
+#else
+    const bsl::uint64_t k_ONES      = 0x0101010101010101ULL;
+    const bsl::uint64_t k_HIGH_BITS = 0x8080808080808080ULL;
+
+    while (end - begin >= 8) {
+        bsl::uint64_t word;
+        bsl::memcpy(&word, begin, sizeof word);
+
+        const bsl::uint64_t quotes      = word ^ (k_ONES * '"');
+        const bsl::uint64_t backslashes = word ^ (k_ONES * '\\');
+        if (((quotes      - k_ONES) & ~quotes      & k_HIGH_BITS)
+          | ((backslashes - k_ONES) & ~backslashes & k_HIGH_BITS)) {
+            break;
+        }
+        begin += 8;
+    }
+#endif
+
+    while (begin < end && '"' != *begin && '\\' != *begin) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *findNonWhitespace(const char *begin, const char *end)
+    // Return the address of the first character that is not a JSON whitespace
+    // character in the specified range '[begin, end)', or 'end' if there is no
+    // such character.
+{
+    // Most tokens are preceded by no whitespace, or by a single space.
+
+    if (begin < end && !isWhitespace(*begin)) {
+        return begin;                                                 // RETURN
+    }
+
+#ifdef BALJSN_TOKENIZER_SSE2
+    while (end - begin >= 16) {
+        const __m128i chunk =
+                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+        const int     mask  =
+                          _mm_movemask_epi8(whitespaceMask(chunk)) ^ 0xFFFF;
+        if (mask) {
+            return begin + firstSetBit(mask);                         // RETURN
+        }
+        begin += 16;
+    }
+#endif
+
+    while (begin < end && isWhitespace(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *findWhitespaceOrToken(const char *begin, const char *end)
+    // Return the address of the first JSON whitespace character, or of the
+    // first of '{', '}', '[', ']', ':', and ',', in the specified range
+    // '[begin, end)', or 'end' if there is no such character.
+{
+#ifdef BALJSN_TOKENIZER_SSE2
+    // Setting bit 5 maps '[' to '{' and ']' to '}', and no other character to
+    // either of them.
+
+    const __m128i bit5         = _mm_set1_epi8(0x20);
+    const __m128i openBrace    = _mm_set1_epi8('{');
+    const __m128i closeBrace   = _mm_set1_epi8('}');
+    const __m128i colon        = _mm_set1_epi8(':');
+    const __m128i comma        = _mm_set1_epi8(',');
+
+    while (end - begin >= 16) {
+        const __m128i chunk  =
+                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+        const __m128i folded = _mm_or_si128(chunk, bit5);
+        const __m128i tokens = _mm_or_si128(
+                           _mm_or_si128(_mm_cmpeq_epi8(folded, openBrace),
+                                        _mm_cmpeq_epi8(folded, closeBrace)),
+                           _mm_or_si128(_mm_cmpeq_epi8(chunk, colon),
+                                        _mm_cmpeq_epi8(chunk, comma)));
+        const int     mask   = _mm_movemask_epi8(
+                                  _mm_or_si128(tokens, whitespaceMask(chunk)));
+        if (mask) {
+            return begin + firstSetBit(mask);                         // RETURN
+        }
+        begin += 16;
+    }
+#endif
+
+    while (begin < end && !isWhitespaceOrToken(*begin)) {
+        ++begin;
+    }
+    return begin;
+}
+
+const char *findQuoteOrBracket(const char *begin, const char *end)
+    // Return the address of the first '"', '{', '}', '[', or ']' in the
+    // specified range '[begin, end)', or 'end' if there is no such character.
+{
+#ifdef BALJSN_TOKENIZER_SSE2
+    const __m128i bit5       = _mm_set1_epi8(0x20);
+    const __m128i openBrace  = _mm_set1_epi8('{');
+    const __m128i closeBrace = _mm_set1_epi8('}');
+    const __m128i quote      = _mm_set1_epi8('"');
+
+    while (end - begin >= 16) {
+        const __m128i chunk  =
+                     _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+        const __m128i folded = _mm_or_si128(chunk, bit5);
+        const int     mask   = _mm_movemask_epi8(
+                          _mm_or_si128(
+                              _mm_or_si128(_mm_cmpeq_epi8(folded, openBrace),
+                                           _mm_cmpeq_epi8(folded, closeBrace)),
+                              _mm_cmpeq_epi8(chunk, quote)));
+        if (mask) {
+            return begin + firstSetBit(mask);                         // RETURN
+        }
+        begin += 16;
+    }
+#endif
+
+    while (begin < end) {
+        switch (*begin) {
+          case '"':
+          case '{':
+          case '}':
+          case '[':
+          case ']': {
+            return begin;                                             // RETURN
+          }
+        }
+        ++begin;
+    }
+    return end;
+}
 
 }  // close unnamed namespace
 
@@ -70,52 +304,74 @@ namespace baljsn {
 // PRIVATE MANIPULATORS
 int Tokenizer::reloadStringBuffer()
 {
+    if (d_isContiguousInput) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.resize(k_MAX_STRING_SIZE);
     const int numRead =
                      static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[0],
                                                            k_MAX_STRING_SIZE));
     d_cursor = 0;
     d_stringBuffer.resize(numRead);
+
+    d_data_p     = d_stringBuffer.data();
+    d_dataLength = d_stringBuffer.length();
     return numRead;
 }
 
 int Tokenizer::expandBufferForLargeValue()
 {
-    d_stringBuffer.resize(d_stringBuffer.length() + k_MAX_STRING_SIZE);
+    if (d_isContiguousInput) {
+        return -1;                                                    // RETURN
+    }
+
+    const bsl::size_t length = d_stringBuffer.length();
+    d_stringBuffer.resize(length + k_MAX_STRING_SIZE);
 
     const int numRead =
-            static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[d_valueIter],
-                                                  k_MAX_STRING_SIZE));
+                static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[length],
+                                                      k_MAX_STRING_SIZE));
+    d_stringBuffer.resize(length + numRead);
+
+    d_data_p     = d_stringBuffer.data();
+    d_dataLength = d_stringBuffer.length();
     return numRead ? 0 : -1;
 }
 
 int Tokenizer::moveValueCharsToStartAndReloadBuffer()
 {
+    if (d_isContiguousInput) {
+        return 0;                                                     // RETURN
+    }
+
     d_stringBuffer.erase(d_stringBuffer.begin(),
                          d_stringBuffer.begin() + d_valueBegin);
-    d_stringBuffer.resize(k_MAX_STRING_SIZE);
 
-    d_valueIter = d_valueIter - d_valueBegin;
+    d_valueIter  = d_valueIter - d_valueBegin;
+    d_valueBegin = 0;
 
-    const int numRead =
-       static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[d_valueIter],
-                                             k_MAX_STRING_SIZE - d_valueIter));
+    const bsl::size_t length = d_stringBuffer.length();
+    d_stringBuffer.resize(k_MAX_STRING_SIZE);
 
-    if (numRead > 0) {
-        d_stringBuffer.resize(d_valueIter + numRead);
-        d_valueBegin = 0;
-    }
+    const int numRead =
+                static_cast<int>(d_streambuf_p->sgetn(&d_stringBuffer[length],
+                                                      k_MAX_STRING_SIZE
+                                                                   - length));
+    d_stringBuffer.resize(length + numRead);
 
+    d_data_p     = d_stringBuffer.data();
+    d_dataLength = d_stringBuffer.length();
     return numRead;
 }
 
 int Tokenizer::skipWhitespace()
 {
     while (true) {
-        bsl::size_t pos = d_stringBuffer.find_first_not_of(WHITESPACE,
-                                                           d_cursor);
-        if (bsl::string::npos != pos) {
-            d_cursor = pos;
+        const char *end = d_data_p + d_dataLength;
+        const char *pos = findNonWhitespace(d_data_p + d_cursor, end);
+        if (pos != end) {
+            d_cursor = pos - d_data_p;
             break;
         }
 
@@ -129,61 +385,56 @@ int Tokenizer::skipWhitespace()
 
 int Tokenizer::extractStringValue()
 {
-    bool firstTime    = true;
-    char previousChar = 0;
+    bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && '"' != d_stringBuffer[d_valueIter]) {
+        const char *end  = d_data_p + d_dataLength;
+        const char *iter = d_data_p + d_valueIter;
 
-            if ('\\' == d_stringBuffer[d_valueIter]
-             && '\\' == previousChar) {
-                previousChar = 0;
-            }
-            else {
-                previousChar = d_stringBuffer[d_valueIter];
+        while (iter < end) {
+            iter = findQuoteOrBackslash(iter, end);
+            if (iter == end) {
+                break;
             }
 
-            ++d_valueIter;
-        }
+            if ('"' == *iter) {
+                d_valueIter = iter - d_data_p;
+                d_valueEnd  = d_valueIter;
+                return 0;                                             // RETURN
+            }
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+            // Skip the backslash and the escaped character, which may not have
+            // been read yet.
 
-            // There isn't enough room in the internal buffer to hold the
-            // value.  If this is the first time through the loop, we move the
-            // current sequence of characters being processed to the front of
-            // the internal buffer, otherwise we must expand the internal
-            // buffer to hold additional characters.  If we are at the
-            // beginning of the string buffer then we dont need to move any
-            // characters and we simply expand the string buffer.
+            iter += 2;
+        }
+        d_valueIter = iter - d_data_p;
+
+        // There isn't enough room in the internal buffer to hold the value.
+        // If this is the first time through the loop, we move the current
+        // sequence of characters being processed to the front of the internal
+        // buffer, otherwise we must expand the internal buffer to hold
+        // additional characters.  If we are at the beginning of the string
+        // buffer then we dont need to move any characters and we simply
+        // expand the string buffer.
+
+        if (0 == d_valueBegin) {
+            firstTime = false;
+        }
 
-            if (0 == d_valueBegin) {
-                firstTime = false;
+        if (firstTime) {
+            const int numRead = moveValueCharsToStartAndReloadBuffer();
+            if (0 == numRead) {
+                return -1;                                            // RETURN
             }
 
-            if (firstTime) {
-                const int numRead = moveValueCharsToStartAndReloadBuffer();
-                if (0 == numRead) {
-                    return -1;                                        // RETURN
-                }
-
-                firstTime = false;
-            }
-            else {
-                const int rc = expandBufferForLargeValue();
-                if (rc) {
-                    return rc;                                        // RETURN
-                }
-            }
+            firstTime = false;
         }
         else {
-            if ('\\' == previousChar) {
-                ++d_valueIter;
-                previousChar = 0;
-                continue;
+            const int rc = expandBufferForLargeValue();
+            if (rc) {
+                return rc;                                            // RETURN
             }
-            d_valueEnd = d_valueIter;
-            return 0;                                                 // RETURN
         }
     }
     return 0;
@@ -194,39 +445,36 @@ int Tokenizer::skipNonWhitespaceOrTillToken()
     bool firstTime = true;
 
     while (true) {
-        while (d_valueIter < d_stringBuffer.length()
-            && !bdlb::CharType::isSpace(d_stringBuffer[d_valueIter])
-            && !bsl::strchr(TOKENS, d_stringBuffer[d_valueIter])) {
-            ++d_valueIter;
-        }
+        const char *end  = d_data_p + d_dataLength;
+        const char *iter = findWhitespaceOrToken(d_data_p + d_valueIter, end);
 
-        if (d_valueIter >= d_stringBuffer.length()) {
+        d_valueIter = iter - d_data_p;
 
-            // There isn't enough room in the internal buffer to hold the
-            // value.  If this is the first time through the loop, we move the
-            // current sequence of characters being processed to the front of
-            // the internal buffer, otherwise we must expand the internal
-            // buffer to hold additional characters.
+        if (iter != end) {
+            d_valueEnd = d_valueIter;
+            return 0;                                                 // RETURN
+        }
 
-            if (firstTime) {
-                const int numRead = moveValueCharsToStartAndReloadBuffer();
+        // There isn't enough room in the internal buffer to hold the value.
+        // If this is the first time through the loop, we move the current
+        // sequence of characters being processed to the front of the internal
+        // buffer, otherwise we must expand the internal buffer to hold
+        // additional characters.
 
-                if (0 == numRead) {
-                    d_valueEnd = d_valueIter;
-                    return 0;                                         // RETURN
-                }
-                firstTime = false;
-            }
-            else {
-                const int rc = expandBufferForLargeValue();
-                if (rc) {
-                    return rc;                                        // RETURN
-                }
+        if (firstTime) {
+            const int numRead = moveValueCharsToStartAndReloadBuffer();
+
+            if (0 == numRead) {
+                d_valueEnd = d_valueIter;
+                return 0;                                             // RETURN
             }
+            firstTime = false;
         }
         else {
-            d_valueEnd = d_valueIter;
-            return 0;                                                 // RETURN
+            const int rc = expandBufferForLargeValue();
+            if (rc) {
+                return rc;                                            // RETURN
+            }
         }
     }
     return 0;
@@ -239,7 +487,7 @@ int Tokenizer::advanceToNextToken()
         return -1;                                                    // RETURN
     }
 
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= d_dataLength) {
         const int numRead = reloadStringBuffer();
         if (0 == numRead) {
             d_tokenType = e_ERROR;
@@ -258,7 +506,7 @@ int Tokenizer::advanceToNextToken()
             return -1;                                                // RETURN
         }
 
-        switch (d_stringBuffer[d_cursor]) {
+        switch (d_data_p[d_cursor]) {
           case '{': {
             if ((e_ELEMENT_NAME == d_tokenType && ':' == previousChar)
              || e_START_ARRAY   == d_tokenType
@@ -462,14 +710,187 @@ int Tokenizer::advanceToNextToken()
     return 0;
 }
 
+void Tokenizer::reset(bsl::streambuf *streambuf)
+{
+    d_streambuf_p       = streambuf;
+    d_stringBuffer.clear();
+    d_data_p            = d_stringBuffer.data();
+    d_dataLength        = 0;
+    d_isContiguousInput = false;
+    d_cursor            = 0;
+    d_valueBegin        = 0;
+    d_valueEnd          = 0;
+    d_valueIter         = 0;
+    d_tokenType         = e_BEGIN;
+
+    bdlsb::FixedMemInStreamBuf *fixedMemStreamBuf =
+                         dynamic_cast<bdlsb::FixedMemInStreamBuf *>(streambuf);
+    if (fixedMemStreamBuf) {
+        // Consume the rest of the input, which is tokenized in place.
+
+        const bsl::streamoff position = fixedMemStreamBuf->pubseekoff(
+                                                            0,
+                                                            bsl::ios_base::cur,
+                                                            bsl::ios_base::in);
+        const bsl::streamoff end      = fixedMemStreamBuf->pubseekoff(
+                                                            0,
+                                                            bsl::ios_base::end,
+                                                            bsl::ios_base::in);
+        if (0 <= position && position <= end) {
+            d_data_p            = fixedMemStreamBuf->data() + position;
+            d_dataLength        = static_cast<bsl::size_t>(end - position);
+            d_isContiguousInput = true;
+        }
+    }
+}
+
+int Tokenizer::skipValue(bsls::Types::Uint64 *numBytesSkipped)
+{
+    BSLS_ASSERT(numBytesSkipped);
+
+    if (e_ELEMENT_NAME != d_tokenType) {
+        return -1;                                                    // RETURN
+    }
+
+    enum State {
+        e_COLON,   // before the ':' following the element name
+        e_VALUE,   // before the first character of the value
+        e_SCALAR,  // in a number, literal, or other unquoted value
+        e_STRING,  // in a string, at a depth of 'depth' brackets
+        e_NESTED,  // in an object or array, at a depth of 'depth' brackets
+        e_DONE     // after the value
+    };
+
+    State               state      = e_COLON;
+    int                 depth      = 0;
+    bsls::Types::Uint64 numSkipped = 0;
+    bsl::size_t         begin      = d_cursor;
+
+    while (true) {
+        const char *end  = d_data_p + d_dataLength;
+        const char *iter = d_data_p + d_cursor;
+
+        while (e_DONE != state && iter < end) {
+            if (e_STRING == state) {
+                iter = findQuoteOrBackslash(iter, end);
+                if (iter == end) {
+                    continue;
+                }
+                if ('\\' == *iter) {
+                    // Skip the escaped character, which may not have been
+                    // read yet.
+
+                    iter += 2;
+                    continue;
+                }
+                ++iter;
+                if (0 == depth) {
+                    d_tokenType = e_ELEMENT_VALUE;
+                    state       = e_DONE;
+                }
+                else {
+                    state = e_NESTED;
+                }
+            }
+            else if (e_NESTED == state) {
+                iter = findQuoteOrBracket(iter, end);
+                if (iter == end) {
+                    continue;
+                }
+                const char character = *iter++;
+                if ('"' == character) {
+                    state = e_STRING;
+                }
+                else if ('{' == character || '[' == character) {
+                    ++depth;
+                }
+                else if (0 == --depth) {
+                    d_tokenType = '}' == character ? e_END_OBJECT
+                                                   : e_END_ARRAY;
+                    state       = e_DONE;
+                }
+            }
+            else if (e_SCALAR == state) {
+                iter = findWhitespaceOrToken(iter, end);
+                if (iter != end) {
+                    d_tokenType = e_ELEMENT_VALUE;
+                    state       = e_DONE;
+                }
+            }
+            else {
+                iter = findNonWhitespace(iter, end);
+                if (iter == end) {
+                    continue;
+                }
+                const char character = *iter++;
+                if (e_COLON == state) {
+                    if (':' != character) {
+                        d_tokenType = e_ERROR;
+                        return -1;                                    // RETURN
+                    }
+                    state = e_VALUE;
+                }
+                else if ('"' == character) {
+                    state = e_STRING;
+                }
+                else if ('{' == character || '[' == character) {
+                    depth = 1;
+                    state = e_NESTED;
+                }
+                else if (isWhitespaceOrToken(character)) {
+                    d_tokenType = e_ERROR;
+                    return -1;                                        // RETURN
+                }
+                else {
+                    state = e_SCALAR;
+                }
+            }
+        }
+
+        if (e_DONE == state) {
+            d_cursor    = iter - d_data_p;
+            numSkipped += d_cursor - begin;
+            break;
+        }
+
+        // The value continues beyond the characters read so far, which need
+        // not be retained.  Note that 'iter' may be one past 'end' if the
+        // last character read is a backslash.
+
+        const bsl::size_t pending = iter - end;
+
+        numSkipped += d_dataLength - begin;
+        if (0 == reloadStringBuffer()) {
+            if (e_SCALAR != state) {
+                d_tokenType = e_ERROR;
+                return -1;                                            // RETURN
+            }
+
+            // The value ends at the end of the data.
+
+            d_cursor    = d_dataLength;
+            d_tokenType = e_ELEMENT_VALUE;
+            break;
+        }
+        begin    = 0;
+        d_cursor = pending;
+    }
+
+    d_context    = e_OBJECT_CONTEXT;
+    d_valueBegin = d_cursor;
+    d_valueEnd   = d_cursor;
+
+    *numBytesSkipped = numSkipped;
+    return 0;
+}
+
 int Tokenizer::resetStreamBufGetPointer()
 {
-    if (d_cursor >= d_stringBuffer.size()) {
+    if (d_cursor >= d_dataLength) {
         return 0;                                                     // RETURN
     }
 
-    const int numExtraCharsRead = static_cast<int>(d_stringBuffer.size()
-                                                                   - d_cursor);
+    const int numExtraCharsRead = static_cast<int>(d_dataLength - d_cursor);
     const bsl::streamoff newPos = d_streambuf_p->pubseekoff(-numExtraCharsRead,
                                                             bsl::ios_base::cur,
                                                             bsl::ios_base::in);
@@ -483,8 +904,7 @@ int Tokenizer::value(bslstl::StringRef *data) const
     if ((e_ELEMENT_NAME == d_tokenType
                                         || e_ELEMENT_VALUE == d_tokenType)
      && d_valueBegin != d_valueEnd) {
-        data->assign(&d_stringBuffer[d_valueBegin],
-                     &d_stringBuffer[d_valueEnd]);
+        data->assign(d_data_p + d_valueBegin, d_data_p + d_valueEnd);
         return 0;                                                     // RETURN
     }
     return -1;
@@ -25,6 +25,24 @@ BSLS_IDENT("$Id: $")
 // package and in most cases clients should use the 'baljsn_decoder' component
 // instead of using this 'class'.
 //
+///Performance
+///-----------
+// The tokenizer locates the end of each whitespace sequence, string, and
+// number by examining 16 characters at a time (using SSE2 instructions where
+// available).  In general, the tokenizer reads the data from the 'streambuf'
+// in blocks of 8K characters, and the references loaded by 'value' refer to a
+// copy of the data held by the tokenizer.  If the 'streambuf' is a
+// 'bdlsb::FixedMemInStreamBuf', however, the tokenizer does not copy the data:
+// 'reset' consumes all the characters available from the 'streambuf', and the
+// references loaded by 'value' refer directly to the memory of the
+// 'streambuf'.  Note that, in both cases, 'resetStreamBufGetPointer' restores
+// the get pointer of the 'streambuf' to the character following the last
+// token.
+//
+// 'skipValue' skips a whole value, however deeply nested, without producing
+// tokens: it examines 16 characters at a time for brackets and quotes only,
+// and does not need to retain the skipped characters.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -202,6 +220,22 @@ class Tokenizer {
     bsl::string                          d_stringBuffer;         // string
                                                                  // buffer
 
+    const char                          *d_data_p;               // data being
+                                                                 // tokenized,
+                                                                 // either in
+                                                                 // string
+                                                                 // buffer or
+                                                                 // in
+                                                                 // streambuf
+
+    bsl::size_t                          d_dataLength;           // length of
+                                                                 // data
+
+    bool                                 d_isContiguousInput;    // 'true' if
+                                                                 // data is the
+                                                                 // memory of
+                                                                 // streambuf
+
     bsl::streambuf                      *d_streambuf_p;          // streambuf
                                                                  // (held, not
                                                                  // owned)
@@ -291,9 +325,12 @@ class Tokenizer {
     // MANIPULATORS
     void reset(bsl::streambuf *streambuf);
         // Reset this tokenizer to read data from the specified 'streambuf'.
-        // Note that the reader will not be on a valid node until
-        // 'advanceToNextToken' is called.  Note that this function does not
-        // change the value of the 'allowStandAloneValues' option.
+        // If 'streambuf' is a 'bdlsb::FixedMemInStreamBuf', consume all the
+        // characters available from 'streambuf', which are tokenized without
+        // being copied (see {Performance}).  Note that the reader will not be
+        // on a valid node until 'advanceToNextToken' is called.  Note that
+        // this function does not change the value of the
+        // 'allowStandAloneValues' option.
 
     int advanceToNextToken();
         // Move to the next token in the data steam.  Return 0 on success and a
@@ -313,6 +350,20 @@ class Tokenizer {
         // invoked on this object should only be done after calling 'reset' and
         // specifying a new 'streambuf'.
 
+    int skipValue(bsls::Types::Uint64 *numBytesSkipped);
+        // Skip the value of the element whose name is the current token,
+        // including all the elements nested within that value, and load into
+        // the specified 'numBytesSkipped' the number of characters consumed.
+        // Return 0 on success, and a non-zero value if the current token is
+        // not an 'e_ELEMENT_NAME', if that name is not followed by ':', or if
+        // the value is incomplete.  On success the current token is
+        // 'e_END_OBJECT' if the value was an object, 'e_END_ARRAY' if it was
+        // an array, and 'e_ELEMENT_VALUE' (having an empty 'value')
+        // otherwise.  Note that the value is located by counting brackets and
+        // quotes only: unlike repeated calls to 'advanceToNextToken', this
+        // method does not verify that the skipped characters are valid JSON
+        // (e.g., '[1 2}' is skipped as an array).
+
     void setAllowStandAloneValues(bool value);
         // Set the 'allowStandAloneValues' option to the specified 'value'.  If
         // the 'allowStandAloneValues' value is 'true' this tokenizer will
@@ -358,6 +409,9 @@ inline
 Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 : d_allocator(d_buffer.buffer(), k_BUFSIZE, basicAllocator)
 , d_stringBuffer(&d_allocator)
+, d_data_p(0)
+, d_dataLength(0)
+, d_isContiguousInput(false)
 , d_streambuf_p(0)
 , d_cursor(0)
 , d_valueBegin(0)
@@ -369,6 +423,7 @@ Tokenizer::Tokenizer(bslma::Allocator *basicAllocator)
 , d_allowHeterogenousArrays(true)
 {
     d_stringBuffer.reserve(k_MAX_STRING_SIZE);
+    d_data_p = d_stringBuffer.data();
 }
 
 inline
@@ -377,18 +432,6 @@ Tokenizer::~Tokenizer()
 }
 
 // MANIPULATORS
-inline
-void Tokenizer::reset(bsl::streambuf *streambuf)
-{
-    d_streambuf_p = streambuf;
-    d_stringBuffer.clear();
-    d_cursor      = 0;
-    d_valueBegin  = 0;
-    d_valueEnd    = 0;
-    d_valueIter   = 0;
-    d_tokenType   = e_BEGIN;
-}
-
 inline
 void Tokenizer::setAllowStandAloneValues(bool value)
 {
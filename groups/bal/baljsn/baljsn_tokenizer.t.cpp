@@ -19,8 +19,11 @@
 #include <bdlsb_fixedmemoutstreambuf.h>       // for testing only
 #include <bdlsb_fixedmeminstreambuf.h>        // for testing only
 
+#include <bsls_stopwatch.h>
+
 #include <bsl_cstring.h>
 #include <bsl_cstdlib.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -51,6 +54,7 @@ using bsl::endl;
 // [13] void setAllowStandAloneValues(bool value);
 // [14] void setAllowHeterogenousArrays(bool value);
 // [ 3] int advanceToNextToken();
+// [16] int skipValue(bsls::Types::Uint64 *numBytesSkipped);
 //
 // ACCESSORS
 // [ 3] TokenType tokenType() const;
@@ -59,7 +63,9 @@ using bsl::endl;
 // [ 3] int value(bslstl::StringRef *data) const;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [15] CONCERN: 'bdlsb::FixedMemInStreamBuf' INPUT IS NOT COPIED
+// [17] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -173,6 +179,120 @@ void confirmStreamBufReset(bsl::streambuf     *sb,
     }
 }
 
+struct Token {
+    // This 'struct' holds a token, and a copy of its value if it has one.
+
+    Obj::TokenType d_type;
+    bsl::string    d_value;
+};
+
+void tokenize(bsl::vector<Token> *tokens, bsl::streambuf *streambuf)
+    // Load into the specified 'tokens' all the tokens read from the specified
+    // 'streambuf' by a tokenizer, until the end of the data or an error.
+{
+    Obj mX;  const Obj& X = mX;
+    mX.reset(streambuf);
+
+    tokens->clear();
+    while (0 == mX.advanceToNextToken()) {
+        Token             token;
+        bslstl::StringRef value;
+
+        token.d_type = X.tokenType();
+        if (0 == X.value(&value)) {
+            token.d_value = value;
+        }
+        tokens->push_back(token);
+    }
+}
+
+void appendWhitespace(bsl::string *document, unsigned int *seed)
+    // Append to the specified 'document' a pseudo-random sequence of 0 to 40
+    // whitespace characters, using and updating the specified 'seed'.
+{
+    static const char WHITESPACE[] = " \t\n\v\f\r";
+
+    *seed = *seed * 1103515245 + 12345;
+    const unsigned int length = (*seed >> 16) % 41 < 30 ? (*seed >> 16) % 3
+                                                        : (*seed >> 16) % 41;
+    for (unsigned int i = 0; i < length; ++i) {
+        *seed = *seed * 1103515245 + 12345;
+        *document += WHITESPACE[(*seed >> 16) % 6];
+    }
+}
+
+void appendString(bsl::string  *document,
+                  unsigned int *seed,
+                  unsigned int  maxLength)
+    // Append to the specified 'document' a quoted JSON string of
+    // pseudo-random length in the range '[0, maxLength)', having pseudo-random
+    // escaped quotes and backslashes, using and updating the specified
+    // 'seed'.
+{
+    *seed = *seed * 1103515245 + 12345;
+    const unsigned int length = (*seed >> 8) % maxLength;
+
+    *document += '"';
+    for (unsigned int i = 0; i < length; ++i) {
+        *seed = *seed * 1103515245 + 12345;
+        switch ((*seed >> 16) % 16) {
+          case 0: {
+            *document += "\\\"";
+          } break;
+          case 1: {
+            *document += "\\\\";
+          } break;
+          case 2: {
+            *document += " ,:[]{}";
+          } break;
+          default: {
+            *document += static_cast<char>('a' + (*seed >> 16) % 26);
+          } break;
+        }
+    }
+    *document += '"';
+}
+
+void generateDocument(bsl::string  *document,
+                      unsigned int  seed,
+                      int           numElements)
+    // Load into the specified 'document' a JSON array of the specified
+    // 'numElements' objects having pseudo-random names, strings, numbers,
+    // arrays, and whitespace, determined by the specified 'seed'.
+{
+    document->clear();
+    appendWhitespace(document, &seed);
+    *document += '[';
+    for (int i = 0; i < numElements; ++i) {
+        if (i) {
+            *document += ',';
+        }
+        appendWhitespace(document, &seed);
+        *document += '{';
+        appendWhitespace(document, &seed);
+        appendString(document, &seed, 20);
+        appendWhitespace(document, &seed);
+        *document += ':';
+        appendWhitespace(document, &seed);
+        appendString(document, &seed, 0 == i % 50 ? 10000 : 100);
+        appendWhitespace(document, &seed);
+        *document += ',';
+        appendString(document, &seed, 20);
+        *document += ':';
+        appendWhitespace(document, &seed);
+        *document += "[-1.25e-3,";
+        appendWhitespace(document, &seed);
+        *document += "42";
+        appendWhitespace(document, &seed);
+        *document += ",true]";
+        appendWhitespace(document, &seed);
+        *document += '}';
+    }
+    appendWhitespace(document, &seed);
+    *document += ']';
+    appendWhitespace(document, &seed);
+}
+
 // ============================================================================
 //                               MAIN PROGRAM
 // ----------------------------------------------------------------------------
@@ -194,7 +314,7 @@ int main(int argc, char *argv[])
     bslma::Default::setGlobalAllocator(&globalAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -316,6 +436,374 @@ int main(int argc, char *argv[])
     ASSERT(10022           == address.d_zipcode);
 //..
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'skipValue'
+        //
+        // Concerns:
+        //: 1 'skipValue' skips the value of the current element name, whether
+        //:   it is a string, a number, a literal, an object, or an array, and
+        //:   leaves the tokenizer such that 'advanceToNextToken' yields the
+        //:   token following that value.
+        //:
+        //: 2 The token type after 'skipValue' is 'e_END_OBJECT' for an
+        //:   object, 'e_END_ARRAY' for an array, and 'e_ELEMENT_VALUE'
+        //:   otherwise.
+        //:
+        //: 3 The number of characters skipped, from the end of the element
+        //:   name to the end of the value, is loaded into 'numBytesSkipped'.
+        //:
+        //: 4 Brackets within strings, and escaped quotes, are ignored.
+        //:
+        //: 5 Values spanning several blocks of input read from the
+        //:   'streambuf', including values in which an escape sequence spans
+        //:   two blocks, are skipped correctly.
+        //:
+        //: 6 An error is returned if the current token is not an element
+        //:   name, if the element name is not followed by ':', or if the
+        //:   value is incomplete.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, skip the value of an element
+        //:   in a set of documents, from both a 'bsl::stringbuf' and a
+        //:   'bdlsb::FixedMemInStreamBuf', and verify the return value, the
+        //:   token type, the number of characters skipped, and the token
+        //:   following the value.  (C-1..4, 6)
+        //:
+        //: 2 Skip pseudo-random JSON documents of more than 8K characters
+        //:   embedded as the value of an element, and verify the number of
+        //:   characters skipped and the token following the value.  (C-5)
+        //:
+        //: 3 Verify that 'skipValue' fails if the current token is not an
+        //:   element name.  (C-6)
+        //
+        // Testing:
+        //   int skipValue(bsls::Types::Uint64 *numBytesSkipped);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'skipValue'" << endl
+                          << "===================" << endl;
+
+        if (verbose) cout << "\nTable-driven test." << endl;
+        {
+            const Obj::TokenType V  = Obj::e_ELEMENT_VALUE;
+            const Obj::TokenType EO = Obj::e_END_OBJECT;
+            const Obj::TokenType EA = Obj::e_END_ARRAY;
+            const Obj::TokenType ER = Obj::e_ERROR;
+
+            static const struct {
+                int              d_line;
+                const char      *d_text_p;     // text following the name
+                int              d_rc;         // 0 for success
+                Obj::TokenType   d_type;       // token type after skipping
+                int              d_numBytes;   // characters skipped
+            } DATA[] = {
+                //LINE  TEXT                                 RC  TYPE  NUM
+                //----  -----------------------------------  --  ----  ---
+                { L_,   ":1,\"next\":2}",                    0,  V,    2 },
+                { L_,   " : -1.5e3 ,\"next\":2}",            0,  V,    9 },
+                { L_,   ":true}",                             0,  V,    5 },
+                { L_,   ":\"\",\"next\":2}",                 0,  V,    3 },
+                { L_,   ":\"a\\\"}]\",\"next\":2}",           0,  V,    8 },
+                { L_,   ":\"\\\\\",\"next\":2}",             0,  V,    5 },
+                { L_,   ":{},\"next\":2}",                   0,  EO,   3 },
+                { L_,   ":[],\"next\":2}",                   0,  EA,   3 },
+                { L_,   ":{\"a\":[1,{\"b\":\"}\"}]},\"next\":2}",
+                                                             0,  EO,  20 },
+                { L_,   ":[[\"]\"],{\"a\":{}}] ,\"next\":2}",
+                                                             0,  EA,  17 },
+                { L_,   ":[1 2}, \"next\":2}",                0,  EO,   6 },
+                { L_,   "1,\"next\":2}",                     1,  ER,   0 },
+                { L_,   ":,\"next\":2}",                     1,  ER,   0 },
+                { L_,   ":}",                                 1,  ER,   0 },
+                { L_,   ":",                                  1,  ER,   0 },
+                { L_,   ":\"abc",                             1,  ER,   0 },
+                { L_,   ":\"abc\\",                          1,  ER,   0 },
+                { L_,   ":{\"a\":[1,2]",                       1,  ER,   0 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int            LINE      = DATA[ti].d_line;
+                const bsl::string    TEXT      = bsl::string("{\"skip\"")
+                                                          + DATA[ti].d_text_p;
+                const int            RC        = DATA[ti].d_rc;
+                const Obj::TokenType TYPE      = DATA[ti].d_type;
+                const Uint64         NUM_BYTES = DATA[ti].d_numBytes;
+
+                if (veryVerbose) { P_(LINE) P(TEXT) }
+
+                for (int cfg = 0; cfg < 2; ++cfg) {
+                    bsl::stringbuf             sb(TEXT);
+                    bdlsb::FixedMemInStreamBuf isb(TEXT.data(), TEXT.size());
+
+                    Obj mX;  const Obj& X = mX;
+                    if (0 == cfg) {
+                        mX.reset(&sb);
+                    }
+                    else {
+                        mX.reset(&isb);
+                    }
+
+                    ASSERTV(LINE, cfg, 0 == mX.advanceToNextToken());
+                    ASSERTV(LINE, cfg, 0 == mX.advanceToNextToken());
+                    ASSERTV(LINE, cfg, Obj::e_ELEMENT_NAME == X.tokenType());
+
+                    Uint64 numBytes = 0;
+                    const int rc = mX.skipValue(&numBytes);
+                    ASSERTV(LINE, cfg, rc, RC == !!rc);
+                    ASSERTV(LINE, cfg, TYPE, X.tokenType(),
+                            TYPE == X.tokenType());
+                    if (rc) {
+                        ASSERTV(LINE, cfg, 0 != mX.advanceToNextToken());
+                        continue;
+                    }
+                    ASSERTV(LINE, cfg, NUM_BYTES, numBytes,
+                            NUM_BYTES == numBytes);
+
+                    if (bsl::string::npos == TEXT.find("next")) {
+                        ASSERTV(LINE, cfg, 0 == mX.advanceToNextToken());
+                        ASSERTV(LINE, cfg, X.tokenType(),
+                                Obj::e_END_OBJECT == X.tokenType());
+                        continue;
+                    }
+
+                    bslstl::StringRef value;
+
+                    ASSERTV(LINE, cfg, 0 == mX.advanceToNextToken());
+                    ASSERTV(LINE, cfg, X.tokenType(),
+                            Obj::e_ELEMENT_NAME == X.tokenType());
+                    ASSERTV(LINE, cfg, 0 == X.value(&value));
+                    ASSERTV(LINE, cfg, value, "next" == value);
+                    ASSERTV(LINE, cfg, 0 == mX.advanceToNextToken());
+                    ASSERTV(LINE, cfg, 0 == X.value(&value));
+                    ASSERTV(LINE, cfg, value, "2" == value);
+                    ASSERTV(LINE, cfg, 0 == mX.advanceToNextToken());
+                    ASSERTV(LINE, cfg, Obj::e_END_OBJECT == X.tokenType());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nSkipping large values." << endl;
+
+        for (unsigned int seed = 1; seed <= 50; ++seed) {
+            bsl::string document;
+            generateDocument(&document, seed, seed * 2);
+
+            const bsl::string TEXT = "{\"skip\":" + document + ",\"next\":2}";
+            const Uint64      NUM_BYTES = document.find_last_of(']') + 2;
+
+            if (veryVeryVerbose) { P(TEXT) }
+
+            for (int cfg = 0; cfg < 2; ++cfg) {
+                bsl::stringbuf             sb(TEXT);
+                bdlsb::FixedMemInStreamBuf isb(TEXT.data(), TEXT.size());
+
+                Obj mX;  const Obj& X = mX;
+                if (0 == cfg) {
+                    mX.reset(&sb);
+                }
+                else {
+                    mX.reset(&isb);
+                }
+
+                ASSERTV(seed, cfg, 0 == mX.advanceToNextToken());
+                ASSERTV(seed, cfg, 0 == mX.advanceToNextToken());
+
+                Uint64 numBytes = 0;
+                ASSERTV(seed, cfg, 0 == mX.skipValue(&numBytes));
+                ASSERTV(seed, cfg, Obj::e_END_ARRAY == X.tokenType());
+                ASSERTV(seed, cfg, NUM_BYTES, numBytes,
+                        NUM_BYTES == numBytes);
+
+                bslstl::StringRef value;
+
+                ASSERTV(seed, cfg, 0 == mX.advanceToNextToken());
+                ASSERTV(seed, cfg, 0 == X.value(&value));
+                ASSERTV(seed, cfg, value, "next" == value);
+            }
+        }
+
+        if (verbose) cout << "\nSkipping without an element name." << endl;
+        {
+            bsl::stringbuf sb("{\"name\":[1]}");
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&sb);
+
+            Uint64 numBytes = 0;
+            ASSERT(0 != mX.skipValue(&numBytes));
+            ASSERT(Obj::e_BEGIN == X.tokenType());
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(0 != mX.skipValue(&numBytes));
+            ASSERT(Obj::e_START_OBJECT == X.tokenType());
+        }
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // CONCERN: 'bdlsb::FixedMemInStreamBuf' INPUT IS NOT COPIED
+        //
+        // Concerns:
+        //: 1 Tokenizing the data of a 'bdlsb::FixedMemInStreamBuf' yields the
+        //:   same tokens and values as tokenizing the same data from any
+        //:   other 'streambuf', including for whitespace sequences, escaped
+        //:   characters, and strings at any position relative to the blocks
+        //:   scanned at once, and for strings longer than the internal buffer
+        //:   of the tokenizer.
+        //:
+        //: 2 The values of the tokens read from a 'bdlsb::FixedMemInStreamBuf'
+        //:   refer to its memory, and no memory is allocated.
+        //:
+        //: 3 The data is tokenized from the current position of the
+        //:   'bdlsb::FixedMemInStreamBuf'.
+        //:
+        //: 4 Unterminated strings are reported as errors.
+        //
+        // Plan:
+        //: 1 Generate pseudo-random JSON documents, and tokenize each of them
+        //:   from a 'bsl::stringbuf' and from a 'bdlsb::FixedMemInStreamBuf'.
+        //:   Verify that the sequences of tokens and values are the same, and
+        //:   that the values of the second sequence are within the document.
+        //:   Verify that the default allocator is not used while tokenizing
+        //:   the second sequence.  (C-1..2)
+        //:
+        //: 2 Tokenize a document from a 'bdlsb::FixedMemInStreamBuf' after
+        //:   reading some characters from it.  (C-3)
+        //:
+        //: 3 Tokenize documents having an unterminated string, and verify
+        //:   that an error is reported.  (C-4)
+        //
+        // Testing:
+        //   CONCERN: 'bdlsb::FixedMemInStreamBuf' INPUT IS NOT COPIED
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCERN: FixedMemInStreamBuf INPUT IS NOT COPIED"
+                          << endl
+                          << "================================================"
+                          << endl;
+
+        if (verbose) cout << "\nComparing with 'bsl::stringbuf'." << endl;
+
+        for (unsigned int seed = 1; seed <= 100; ++seed) {
+            bsl::string document;
+            generateDocument(&document, seed, seed * 3);
+
+            if (veryVeryVerbose) { P(document) }
+
+            bsl::vector<Token> expected;
+            bsl::stringbuf     sb(document);
+            tokenize(&expected, &sb);
+            ASSERTV(seed, expected.size(), 10 < expected.size());
+            ASSERTV(seed, Obj::e_END_ARRAY == expected.back().d_type);
+
+            bdlsb::FixedMemInStreamBuf isb(document.data(), document.size());
+
+            bslma::TestAllocator         da("default", veryVeryVerbose);
+            bslma::DefaultAllocatorGuard dag(&da);
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            bsl::size_t numTokens = 0;
+            while (0 == mX.advanceToNextToken()) {
+                if (numTokens >= expected.size()) {
+                    ++numTokens;
+                    continue;
+                }
+                const Token& EXP = expected[numTokens];
+
+                ASSERTV(seed, numTokens, EXP.d_type, X.tokenType(),
+                        EXP.d_type == X.tokenType());
+
+                bslstl::StringRef value;
+                if (0 == X.value(&value)) {
+                    ASSERTV(seed, numTokens, EXP.d_value, value,
+                            EXP.d_value == value);
+                    ASSERTV(seed, document.data() <= value.begin());
+                    ASSERTV(seed,
+                            value.end() <= document.data() + document.size());
+                }
+                else {
+                    ASSERTV(seed, numTokens, EXP.d_value.empty());
+                }
+                ++numTokens;
+            }
+            ASSERTV(seed, expected.size(), numTokens,
+                    expected.size() == numTokens);
+            ASSERTV(seed, da.numBlocksTotal(), 0 == da.numBlocksTotal());
+        }
+
+        if (verbose) cout << "\nTesting from the current position." << endl;
+        {
+            const char INPUT[] = "XXX{\"name\":\"value\"} ";
+
+            bdlsb::FixedMemInStreamBuf isb(INPUT, sizeof INPUT - 1);
+            ASSERT(3 == isb.pubseekoff(3, bsl::ios_base::beg));
+
+            Obj mX;  const Obj& X = mX;
+            mX.reset(&isb);
+
+            bslstl::StringRef value;
+
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_START_OBJECT == X.tokenType());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_NAME == X.tokenType());
+            ASSERT(0 == X.value(&value));
+            ASSERT("name" == value);
+            ASSERT(INPUT + 5 == value.begin());
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_ELEMENT_VALUE == X.tokenType());
+            ASSERT(0 == X.value(&value));
+            ASSERT("\"value\"" == value);
+            ASSERT(0 == mX.advanceToNextToken());
+            ASSERT(Obj::e_END_OBJECT == X.tokenType());
+            ASSERT(0 != mX.advanceToNextToken());
+
+            ASSERT(0 == mX.resetStreamBufGetPointer());
+            ASSERT(1 == isb.in_avail());
+        }
+
+        if (verbose) cout << "\nTesting unterminated strings." << endl;
+        {
+            static const struct {
+                int         d_line;
+                const char *d_text_p;
+                int         d_numTokens;  // tokens before the error
+            } DATA[] = {
+                //LINE  TEXT                                        NUM
+                //----  ------------------------------------------  ---
+                { L_,   "{\"name",                                    1 },
+                { L_,   "{\"name\":\"value",                          2 },
+                { L_,   "{\"name\":\"value\\\"",                     2 },
+                { L_,   "{\"name\":\"value\\",                        2 },
+                { L_,   "[\"0123456789abcdef0123456789abcdef\\\"",  1 },
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int   LINE       = DATA[ti].d_line;
+                const char *TEXT       = DATA[ti].d_text_p;
+                const int   NUM_TOKENS = DATA[ti].d_numTokens;
+
+                bdlsb::FixedMemInStreamBuf isb(TEXT, bsl::strlen(TEXT));
+                bsl::stringbuf             sb(TEXT);
+
+                bsl::vector<Token> tokens;
+
+                tokenize(&tokens, &isb);
+                ASSERTV(LINE, tokens.size(),
+                        NUM_TOKENS == static_cast<int>(tokens.size()));
+
+                tokenize(&tokens, &sb);
+                ASSERTV(LINE, tokens.size(),
+                        NUM_TOKENS == static_cast<int>(tokens.size()));
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING 'setAllowHeterogenousArrays' and 'allowHeterogenousArrays'
@@ -6394,6 +6882,66 @@ int main(int argc, char *argv[])
         Obj mX;  const Obj& X = mX;
         ASSERTV(X.tokenType(), Obj::e_BEGIN == X.tokenType());
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The throughput of the tokenizer is high on large documents,
+        //:   particularly when the input is a 'bdlsb::FixedMemInStreamBuf'.
+        //
+        // Plan:
+        //: 1 Generate a large pseudo-random document (optionally specify the
+        //:   number of elements on the command line), tokenize it repeatedly
+        //:   from a 'bsl::stringbuf' and from a 'bdlsb::FixedMemInStreamBuf',
+        //:   and report the throughput of each.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_ELEMENTS = argc > 2 ? atoi(argv[2]) : 100000;
+        ASSERT(0 < NUM_ELEMENTS);
+
+        bsl::string document;
+        generateDocument(&document, 12345, NUM_ELEMENTS);
+
+        enum { k_NUM_ITERATIONS = 5 };
+
+        for (int mode = 0; mode < 2; ++mode) {
+            bsls::Types::Int64 numTokens = 0;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                bsl::stringbuf             sb(document);
+                bdlsb::FixedMemInStreamBuf isb(document.data(),
+                                               document.size());
+
+                Obj mX;
+                mX.reset(mode ? static_cast<bsl::streambuf *>(&isb) : &sb);
+                while (0 == mX.advanceToNextToken()) {
+                    ++numTokens;
+                }
+                ASSERT(Obj::e_END_ARRAY == mX.tokenType()
+                    || Obj::e_ERROR     == mX.tokenType());
+            }
+            timer.stop();
+
+            const double seconds = timer.elapsedTime();
+            cout << (mode ? "bdlsb::FixedMemInStreamBuf: "
+                          : "bsl::stringbuf:             ")
+                 << static_cast<double>(document.size()) * k_NUM_ITERATIONS
+                                                           / seconds / 1e6
+                 << " MB/s, "
+                 << static_cast<double>(numTokens) / seconds / 1e6
+                 << " M tokens/s" << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -27,7 +27,9 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 #include <bslmt_lockguard.h>
 #include <bslmt_threadattributes.h>
 #include <bsls_assert.h>
+#include <bsls_timeutil.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_functional.h>
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
@@ -41,6 +43,14 @@ BSLS_IDENT_RCSID(ball_asyncfileobserver_cpp,"$Id$ $CSID$")
 // record (when the thread is restarted) the queue is cleared.  Alternative
 // designs are possible, but are not perceived to be worth the added
 // complexity.
+//
+// The publication thread publishes records in batches (see 'collectBatch' and
+// 'publishBatch').  'd_batch' and 'd_batchRecords' are used only by that
+// thread, so they need no synchronization; their capacity is retained across
+// batches so that, once they have grown to the maximum batch size, collecting
+// a batch allocates no memory.  The flush statistics are written only by the
+// publication thread, so their maximum is maintained without a
+// compare-and-swap loop.
 
 namespace BloombergLP {
 namespace ball {
@@ -48,8 +58,12 @@ namespace ball {
 namespace {
 
 enum {
-    DEFAULT_FIXED_QUEUE_SIZE = 8192,
-    FORCE_WARN_THRESHOLD     = 5000
+    DEFAULT_FIXED_QUEUE_SIZE  = 8192,
+    FORCE_WARN_THRESHOLD      = 5000,
+    DEFAULT_MAX_BATCH_RECORDS = 256,
+    DEFAULT_MAX_BATCH_BYTES   = 64 * 1024,
+    MAX_LINGER_SLEEP_USEC     = 1000    // longest single sleep while waiting
+                                        // for a batch to fill
 };
 
 static const char LOG_CATEGORY[] = "BALL.ASYNCFILEOBSERVER";
@@ -75,6 +89,54 @@ static void populateWarnRecord(ball::Record *record,
                        // -----------------------
 
 // PRIVATE MANIPULATORS
+bool AsyncFileObserver::collectBatch()
+{
+    const int                maxRecords = d_maxBatchRecords.loadRelaxed();
+    const int                maxBytes   = d_maxBatchBytes.loadRelaxed();
+    const bsls::Types::Int64 maxLatency = d_maxBatchLatency.loadRelaxed();
+
+    AsyncRecord asyncRecord = d_recordQueue.popFront();
+
+    const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+    int                      numBytes  = 0;
+
+    while (true) {
+        // Stop without publishing the record if the observer is shutting
+        // down, or the record signals the end of publication.
+
+        if (Transmission::e_END == asyncRecord.d_context.transmissionCause()
+            || d_shuttingDownFlag) {
+            return true;                                              // RETURN
+        }
+
+        numBytes += static_cast<int>(
+                    asyncRecord.d_record->fixedFields().messageRef().length());
+        d_batch.push_back(asyncRecord);
+
+        if (maxRecords <= static_cast<int>(d_batch.size())
+         || maxBytes   <= numBytes) {
+            return false;                                             // RETURN
+        }
+
+        // Take the next record if one is available.  Otherwise, wait for one
+        // until the maximum batch latency has elapsed since the batch was
+        // started.
+
+        while (0 != d_recordQueue.tryPopFront(&asyncRecord)) {
+            const bsls::Types::Int64 remaining =
+                       maxLatency - (bsls::TimeUtil::getTimer() - startTime);
+
+            if (0 >= remaining) {
+                return false;                                         // RETURN
+            }
+
+            bslmt::ThreadUtil::microSleep(static_cast<int>(
+                     bsl::min<bsls::Types::Int64>(remaining / 1000 + 1,
+                                                  MAX_LINGER_SLEEP_USEC)));
+        }
+    }
+}
+
 void AsyncFileObserver::logDroppedMessageWarning(int numDropped)
 {
     // Log the record, unconditionally, to the file observer (i.e., without
@@ -86,6 +148,32 @@ void AsyncFileObserver::logDroppedMessageWarning(int numDropped)
     d_fileObserver.publish(d_droppedRecordWarning, context);
 }
 
+void AsyncFileObserver::publishBatch()
+{
+    d_batchRecords.clear();
+    for (bsl::size_t i = 0; i < d_batch.size(); ++i) {
+        d_batchRecords.push_back(d_batch[i].d_record.get());
+    }
+
+    const bsls::Types::Int64 startTime = bsls::TimeUtil::getTimer();
+
+    d_fileObserver.publishBatch(&d_batchRecords.front(),
+                                static_cast<int>(d_batchRecords.size()));
+
+    const bsls::Types::Int64 latency = bsls::TimeUtil::getTimer() - startTime;
+
+    d_numPublishedBatches.addRelaxed(1);
+    d_totalFlushLatency.addRelaxed(latency);
+    if (latency > d_maxFlushLatency.loadRelaxed()) {
+        d_maxFlushLatency.storeRelaxed(latency);
+    }
+
+    // Release the records promptly.
+
+    d_batch.clear();
+    d_batchRecords.clear();
+}
+
 void AsyncFileObserver::publishThreadEntryPoint()
 {
     bool done = false;
@@ -93,19 +181,14 @@ void AsyncFileObserver::publishThreadEntryPoint()
                                           bslmt::ThreadUtil::selfIdAsUint64());
 
     while (!done) {
-        AsyncRecord asyncRecord = d_recordQueue.popFront();
+        done = collectBatch();
 
-        // Publish the next log record on the queue only if the observer is
-        // not shutting down.
+        // Publish the batch only if the observer is not shutting down.
 
-        if (Transmission::e_END == asyncRecord.d_context.transmissionCause()
-            || d_shuttingDownFlag) {
-            done = true;
-        }
-        else {
-            d_fileObserver.publish(*asyncRecord.d_record,
-                                   asyncRecord.d_context);
+        if (!d_batch.empty() && !d_shuttingDownFlag) {
+            publishBatch();
         }
+        d_batch.clear();
 
         // Publish the count of dropped records.  To avoid repeatedly
         // publishing this information when the record queue is full, we
@@ -184,6 +267,12 @@ void AsyncFileObserver::construct()
     d_shuttingDownFlag = 0;
     d_dropCount        = 0;
 
+    d_maxBatchRecords = DEFAULT_MAX_BATCH_RECORDS;
+    d_maxBatchBytes   = DEFAULT_MAX_BATCH_BYTES;
+    d_maxBatchLatency = 0;
+    d_batch.reserve(DEFAULT_MAX_BATCH_RECORDS);
+    d_batchRecords.reserve(DEFAULT_MAX_BATCH_RECORDS);
+
     d_publishThreadEntryPoint = bsl::function<void()>(
             bsl::allocator_arg_t(),
             bsl::allocator<bsl::function<void()> >(d_allocator_p),
@@ -203,6 +292,8 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_droppedRecordWarning(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -216,6 +307,8 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(DEFAULT_FIXED_QUEUE_SIZE, basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_droppedRecordWarning(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -230,6 +323,8 @@ AsyncFileObserver::AsyncFileObserver(Severity::Level   stdoutThreshold,
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(Severity::e_OFF)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_droppedRecordWarning(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -246,6 +341,8 @@ AsyncFileObserver::AsyncFileObserver(
 , d_recordQueue(maxRecordQueueSize, basicAllocator)
 , d_shuttingDownFlag(0)
 , d_dropRecordsOnFullQueueThreshold(dropRecordsOnFullQueueThreshold)
+, d_batch(basicAllocator)
+, d_batchRecords(basicAllocator)
 , d_droppedRecordWarning(basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
 {
@@ -279,6 +376,7 @@ void AsyncFileObserver::publish(const bsl::shared_ptr<const Record>& record,
     if (record->fixedFields().severity() > d_dropRecordsOnFullQueueThreshold) {
         if (0 != d_recordQueue.tryPushBack(asyncRecord)) {
             d_dropCount.addRelaxed(1);
+            d_numDroppedRecords.addRelaxed(1);
         }
     }
     else {
@@ -286,6 +384,20 @@ void AsyncFileObserver::publish(const bsl::shared_ptr<const Record>& record,
     }
 }
 
+void AsyncFileObserver::setFlushPolicy(
+                                     int                       maxBatchRecords,
+                                     int                       maxBatchBytes,
+                                     const bsls::TimeInterval& maxBatchLatency)
+{
+    BSLS_ASSERT(0 < maxBatchRecords);
+    BSLS_ASSERT(0 < maxBatchBytes);
+    BSLS_ASSERT(bsls::TimeInterval() <= maxBatchLatency);
+
+    d_maxBatchRecords = maxBatchRecords;
+    d_maxBatchBytes   = maxBatchBytes;
+    d_maxBatchLatency = maxBatchLatency.totalNanoseconds();
+}
+
 int AsyncFileObserver::startPublicationThread()
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
@@ -52,6 +52,7 @@ BSLS_IDENT("$Id: $")
 //                         |              setOnFileRotationCallback
 //                         |              setStdoutThreshold
 //                         |              setLogFormat
+//                         |              setFlushPolicy
 //                         |              shutdownPublicationThread
 //                         |              startPublicationThread
 //                         |              stopPublicationThread
@@ -61,6 +62,13 @@ BSLS_IDENT("$Id: $")
 //                         |              isPublishInLocalTimeEnabled
 //                         |              isPublicationThreadRunning
 //                         |              recordQueueLength
+//                         |              maxBatchRecords
+//                         |              maxBatchBytes
+//                         |              maxBatchLatency
+//                         |              numDroppedRecords
+//                         |              numPublishedBatches
+//                         |              maxFlushLatency
+//                         |              totalFlushLatency
 //                         |              rotationLifetime
 //                         |              rotationSize
 //                         |              localTimeOffset
@@ -193,6 +201,54 @@ BSLS_IDENT("$Id: $")
 // Note that timestamp pattern elements in a log file name are typically
 // selected so they produce unique names for each rotation.
 //
+///Batched Publication
+///-------------------
+// The publication thread does not write records one at a time.  It removes a
+// batch of records from the record queue, formats the whole batch into a
+// reusable contiguous buffer, and writes that buffer to the log file with a
+// single system call (see 'ball::FileObserver2::publishBatch'); records
+// destined to 'stdout' are likewise written with a single 'fwrite'.  Under a
+// burst of log records this amortizes the cost of the system call over the
+// batch, where publishing the records individually would issue one system
+// call per record.
+//
+// The size of a batch is governed by a flush policy, set by 'setFlushPolicy',
+// that has three parameters:
+//
+//: o 'maxBatchRecords': the maximum number of records in a batch (256 by
+//:   default).
+//:
+//: o 'maxBatchBytes': the number of bytes of record messages that, once
+//:   reached, ends a batch (64K by default).  The messages are measured
+//:   before formatting, so the formatted batch is somewhat larger.
+//:
+//: o 'maxBatchLatency': how long the publication thread waits for more
+//:   records when the queue becomes empty before a batch is full (0 by
+//:   default).  With the default, a batch is written as soon as the queue is
+//:   drained, so a record is never delayed to wait for other records; a
+//:   positive latency trades delay for fewer, larger writes when records
+//:   arrive at a steady, moderate rate.
+//
+// Note that the flush policy has no effect on the contents of the log file,
+// only on the number of system calls used to write it.
+//
+///Statistics
+///----------
+// A 'ball::AsyncFileObserver' exposes the following statistics, each
+// accumulated since construction:
+//
+//: o 'numDroppedRecords': the number of records discarded because the record
+//:   queue was full.
+//:
+//: o 'numPublishedBatches': the number of batches written.
+//:
+//: o 'maxFlushLatency' and 'totalFlushLatency': the maximum and total time
+//:   spent formatting and writing a batch.  The average flush latency is
+//:   'totalFlushLatency() / numPublishedBatches()'.
+//
+// Together with 'recordQueueLength', these statistics allow an application to
+// monitor the health of its logging.
+//
 ///Thread Safety
 ///-------------
 // All public methods of 'ball::AsyncFileObserver' are thread-safe, and can be
@@ -351,6 +407,14 @@ BSLS_IDENT("$Id: $")
 #include <bsls_atomic.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_BSL_FUNCTIONAL
 #include <bsl_functional.h>
 #endif
@@ -363,6 +427,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 namespace BloombergLP {
 namespace ball {
 
@@ -410,6 +478,44 @@ class AsyncFileObserver : public Observer {
                                                      // records, reset when
                                                      // published
 
+    bsls::AtomicInt                d_maxBatchRecords;
+                                                     // maximum number of
+                                                     // records in a batch
+
+    bsls::AtomicInt                d_maxBatchBytes;  // number of message
+                                                     // bytes that ends a batch
+
+    bsls::AtomicInt64              d_maxBatchLatency;
+                                                     // time, in nanoseconds,
+                                                     // to wait for a batch to
+                                                     // fill
+
+    bsl::vector<AsyncRecord>       d_batch;          // records of the batch
+                                                     // being published (used
+                                                     // only by the publication
+                                                     // thread)
+
+    bsl::vector<const Record *>    d_batchRecords;   // addresses of the
+                                                     // records in 'd_batch'
+
+    bsls::AtomicInt64              d_numDroppedRecords;
+                                                     // number of dropped
+                                                     // records, never reset
+
+    bsls::AtomicInt64              d_numPublishedBatches;
+                                                     // number of batches
+                                                     // written
+
+    bsls::AtomicInt64              d_maxFlushLatency;
+                                                     // maximum time, in
+                                                     // nanoseconds, to write
+                                                     // a batch
+
+    bsls::AtomicInt64              d_totalFlushLatency;
+                                                     // total time, in
+                                                     // nanoseconds, spent
+                                                     // writing batches
+
     bsl::function<void()>          d_publishThreadEntryPoint;
                                                      // functor that contains
                                                      // publication thread
@@ -437,6 +543,15 @@ class AsyncFileObserver : public Observer {
         // constructor overloads.  Note that this method should be removed when
         // C++11 constructor chaining is available.
 
+    bool collectBatch();
+        // Remove records from the record queue and append them to the batch
+        // of this object until the batch is complete according to the flush
+        // policy of this object, blocking until at least one record is
+        // available.  Return 'true' if the publication thread must stop (in
+        // which case the record that signaled it is not appended to the
+        // batch), and 'false' otherwise.  The behavior is undefined unless
+        // this method is invoked by the publication thread.
+
     void logDroppedMessageWarning(int numDropped);
         // Synchronously write an entry into the underlying file observer
         // indicating that the specified 'numDropped' number of records have
@@ -444,6 +559,12 @@ class AsyncFileObserver : public Observer {
         // concurrently from multiple threads (i.e., it is *not*
         // *thread-safe*).
 
+    void publishBatch();
+        // Write the records of the batch of this object, in order, to the
+        // underlying file observer, update the flush statistics of this
+        // object, and clear the batch.  The behavior is undefined unless this
+        // method is invoked by the publication thread.
+
     void publishThreadEntryPoint();
         // Thread function of the publication thread.  The publication thread
         // pops record shared pointers and contexts from queue and writes the
@@ -681,6 +802,21 @@ class AsyncFileObserver : public Observer {
         // used when publishing log records.  See "Log Record Formatting" under
         // @DESCRIPTION for details of formatting syntax.
 
+    void setFlushPolicy(int                       maxBatchRecords,
+                        int                       maxBatchBytes,
+                        const bsls::TimeInterval& maxBatchLatency);
+        // Set the flush policy of this async file observer so that the
+        // publication thread writes a batch of records once it holds the
+        // specified 'maxBatchRecords' records, or records whose messages hold
+        // at least the specified 'maxBatchBytes' bytes, or once the record
+        // queue has been empty for the specified 'maxBatchLatency' since the
+        // first record of the batch was removed from it, whichever happens
+        // first.  The new policy applies from the next batch on.  The
+        // behavior is undefined unless '0 < maxBatchRecords',
+        // '0 < maxBatchBytes', and
+        // 'bsls::TimeInterval() <= maxBatchLatency'.  See "Batched
+        // Publication" under @DESCRIPTION.
+
     int shutdownPublicationThread();
         // Stop the publication thread without waiting for remaining log
         // records in the record queue to be published.  Discard currently
@@ -738,6 +874,33 @@ class AsyncFileObserver : public Observer {
         // file rotation by this async file observer if rotation-on-size is in
         // effect, and 0 otherwise.
 
+    int maxBatchRecords() const;
+        // Return the maximum number of records in a batch written by the
+        // publication thread of this async file observer.
+
+    int maxBatchBytes() const;
+        // Return the number of bytes of record messages that ends a batch
+        // written by the publication thread of this async file observer.
+
+    bsls::TimeInterval maxBatchLatency() const;
+        // Return the time that the publication thread of this async file
+        // observer waits for a batch to fill once the record queue is empty.
+
+    bsls::Types::Int64 numDroppedRecords() const;
+        // Return the number of records discarded by this async file observer
+        // because its record queue was full.
+
+    bsls::Types::Int64 numPublishedBatches() const;
+        // Return the number of batches of records written by the publication
+        // thread of this async file observer.
+
+    bsls::TimeInterval maxFlushLatency() const;
+        // Return the maximum time taken by the publication thread of this
+        // async file observer to format and write a batch of records.
+
+    bsls::TimeInterval totalFlushLatency() const;
+        // Return the total time spent by the publication thread of this async
+        // file observer formatting and writing batches of records.
 
     Severity::Level stdoutThreshold() const;
         // Return the minimum severity of messages that will be logged to
@@ -887,6 +1050,53 @@ int AsyncFileObserver::rotationSize() const
     return d_fileObserver.rotationSize();
 }
 
+inline
+int AsyncFileObserver::maxBatchRecords() const
+{
+    return d_maxBatchRecords;
+}
+
+inline
+int AsyncFileObserver::maxBatchBytes() const
+{
+    return d_maxBatchBytes;
+}
+
+inline
+bsls::TimeInterval AsyncFileObserver::maxBatchLatency() const
+{
+    bsls::TimeInterval result;
+    result.addNanoseconds(d_maxBatchLatency);
+    return result;
+}
+
+inline
+bsls::Types::Int64 AsyncFileObserver::numDroppedRecords() const
+{
+    return d_numDroppedRecords;
+}
+
+inline
+bsls::Types::Int64 AsyncFileObserver::numPublishedBatches() const
+{
+    return d_numPublishedBatches;
+}
+
+inline
+bsls::TimeInterval AsyncFileObserver::maxFlushLatency() const
+{
+    bsls::TimeInterval result;
+    result.addNanoseconds(d_maxFlushLatency);
+    return result;
+}
+
+inline
+bsls::TimeInterval AsyncFileObserver::totalFlushLatency() const
+{
+    bsls::TimeInterval result;
+    result.addNanoseconds(d_totalFlushLatency);
+    return result;
+}
 
 inline
 Severity::Level AsyncFileObserver::stdoutThreshold() const
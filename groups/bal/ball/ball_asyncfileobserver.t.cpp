@@ -41,6 +41,7 @@
 #include <bsl_iomanip.h>     // 'setfill'
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 
 #include <bsl_c_stdio.h>     // 'tempname'
@@ -97,11 +98,19 @@ using bsl::flush;
 // [ 3] void rotateOnTimeInterval(const bdlt::DatetimeInterval timeInterval)
 // [ 1] void setStdoutThreshold(ball::Severity::Level stdoutThreshold)
 // [ 1] void setLogFormat(const char*, const char*)
+// [10] void setFlushPolicy(int, int, const bsls::TimeInterval&);
 // [ 1] void startPublicationThread();
 // [ 1] void stopPublicationThread();
 //
 // ACCESSORS
 // [ 9] int recordQueueLength() const
+// [10] int maxBatchRecords() const;
+// [10] int maxBatchBytes() const;
+// [10] bsls::TimeInterval maxBatchLatency() const;
+// [10] bsls::Types::Int64 numDroppedRecords() const;
+// [10] bsls::Types::Int64 numPublishedBatches() const;
+// [10] bsls::TimeInterval maxFlushLatency() const;
+// [10] bsls::TimeInterval totalFlushLatency() const;
 // [ 1] bool isFileLoggingEnabled() const
 // [ 1] bool isStdoutLoggingPrefixEnabled() const
 // [ 1] void getLogFormat(const char**, const char**) const
@@ -111,7 +120,8 @@ using bsl::flush;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCERN: CONCURRENT PUBLICATION
-// [10] USAGE EXAMPLE
+// [10] CONCERN: BATCHED PUBLICATION
+// [11] USAGE EXAMPLE
 //
 //=============================================================================
 //                        STANDARD BDE ASSERT TEST MACROS
@@ -367,6 +377,33 @@ int countLoggedRecords(const bsl::string& fileName)
     return numLines / 2;
 }
 
+void publishMessage(Obj *observer, const char *message)
+    // Publish to the specified 'observer' a record having the specified
+    // 'message' and a severity of 'ball::Severity::e_ERROR'.
+{
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace();
+    record->fixedFields().setSeverity(ball::Severity::e_ERROR);
+    record->fixedFields().setMessage(message);
+
+    observer->publish(record, ball::Context());
+}
+
+void readLines(bsl::vector<bsl::string> *lines, const bsl::string& fileName)
+    // Load into the specified 'lines' the lines of the file having the
+    // specified 'fileName'.
+{
+    lines->clear();
+
+    bsl::ifstream fs(fileName.c_str());
+    ASSERT(fs.is_open());
+
+    bsl::string line;
+    while (getline(fs, line)) {
+        lines->push_back(line);
+    }
+}
+
 // Removed with bdlpcre_regex removal.
 #if 0
 int countMatchingRecords(const bsl::string&  fileName,
@@ -604,7 +641,7 @@ int main(int argc, char *argv[])
     bslma::TestAllocator allocator; bslma::TestAllocator *Z = &allocator;
 
     switch (test) { case 0:
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -663,6 +700,224 @@ int main(int argc, char *argv[])
         asyncFileObserver.stopPublicationThread();
         removeFilesByPrefix(fileName.c_str());
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // TESTING: BATCHED PUBLICATION
+        //
+        // Concerns:
+        //:  1 The default flush policy is 256 records, 64K message bytes, and
+        //:    no latency, and 'setFlushPolicy' sets the policy.
+        //:
+        //:  2 All statistics are 0 on construction.
+        //:
+        //:  3 The publication thread writes the queued records, in order, in
+        //:    batches no larger than 'maxBatchRecords' records.
+        //:
+        //:  4 A batch ends once its messages reach 'maxBatchBytes' bytes.
+        //:
+        //:  5 With a positive 'maxBatchLatency', records that arrive within
+        //:    that latency are written in one batch.
+        //:
+        //:  6 'numDroppedRecords' counts the records discarded because the
+        //:    record queue is full.
+        //:
+        //:  7 The flush latency statistics are consistent.
+        //
+        // Plan:
+        //:  1 Verify the flush policy and the statistics of a default
+        //:    constructed object, then set and verify the flush policy.
+        //:    (C-1..2)
+        //:
+        //:  2 Queue 1000 records before starting the publication thread,
+        //:    with a maximum of 100 records per batch, then start and stop
+        //:    the thread.  Verify the contents of the log file, and that 10
+        //:    batches were published.  (C-3, 7)
+        //:
+        //:  3 Repeat P-2 with 12-byte messages, and a maximum of 50 bytes per
+        //:    batch, and verify that 200 batches of 5 records were published.
+        //:    (C-4)
+        //:
+        //:  4 With a latency of 1 second, publish three records spaced by 10
+        //:    milliseconds to a running publication thread, and verify that
+        //:    they are written in one batch.  (C-5)
+        //:
+        //:  5 Publish 15 records to an observer having a queue of 10 records
+        //:    and no publication thread, and verify that 5 records were
+        //:    dropped.  (C-6)
+        //
+        // Testing:
+        //   void setFlushPolicy(int, int, const bsls::TimeInterval&);
+        //   int maxBatchRecords() const;
+        //   int maxBatchBytes() const;
+        //   bsls::TimeInterval maxBatchLatency() const;
+        //   bsls::Types::Int64 numDroppedRecords() const;
+        //   bsls::Types::Int64 numPublishedBatches() const;
+        //   bsls::TimeInterval maxFlushLatency() const;
+        //   bsls::TimeInterval totalFlushLatency() const;
+        //   CONCERN: BATCHED PUBLICATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING: BATCHED PUBLICATION" << endl
+                          << "============================" << endl;
+
+        if (veryVerbose) cout << "\tFlush policy and statistics." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+            ASSERT(256                  == X.maxBatchRecords());
+            ASSERT(64 * 1024            == X.maxBatchBytes());
+            ASSERT(bsls::TimeInterval() == X.maxBatchLatency());
+
+            ASSERT(0                    == X.numDroppedRecords());
+            ASSERT(0                    == X.numPublishedBatches());
+            ASSERT(bsls::TimeInterval() == X.maxFlushLatency());
+            ASSERT(bsls::TimeInterval() == X.totalFlushLatency());
+
+            mX.setFlushPolicy(10, 1000, bsls::TimeInterval(0, 5000000));
+
+            ASSERT(10                               == X.maxBatchRecords());
+            ASSERT(1000                             == X.maxBatchBytes());
+            ASSERT(bsls::TimeInterval(0, 5000000) == X.maxBatchLatency());
+        }
+
+        if (veryVerbose) cout << "\tBatches limited by records and bytes."
+                              << endl;
+        {
+            static const struct {
+                int d_line;
+                int d_maxBatchRecords;
+                int d_maxBatchBytes;
+                int d_expNumBatches;
+            } DATA[] = {
+                //LINE  MAX RECORDS  MAX BYTES  EXP BATCHES
+                //----  -----------  ---------  -----------
+                { L_,          100,   1 << 20,          10 },
+                { L_,            1,   1 << 20,        1000 },
+                { L_,         1000,        50,         200 },
+                { L_,         1000,   1 << 20,           1 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            enum { k_NUM_RECORDS = 1000 };
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE        = DATA[ti].d_line;
+                const int MAX_RECORDS = DATA[ti].d_maxBatchRecords;
+                const int MAX_BYTES   = DATA[ti].d_maxBatchBytes;
+                const int EXP_BATCHES = DATA[ti].d_expNumBatches;
+
+                const bsl::string fileName = tempFileName(veryVerbose);
+
+                bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+                Obj mX(ball::Severity::e_OFF, false, 2 * k_NUM_RECORDS, &ta);
+                const Obj& X = mX;
+
+                mX.setLogFormat("%m\n", "%m\n");
+                mX.setFlushPolicy(MAX_RECORDS,
+                                  MAX_BYTES,
+                                  bsls::TimeInterval());
+                ASSERTV(LINE, 0 == mX.enableFileLogging(fileName.c_str()));
+
+                // Each message is 12 bytes long.
+
+                for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                    char message[16];
+                    sprintf(message, "message %04d", i);
+                    publishMessage(&mX, message);
+                }
+                ASSERTV(LINE, k_NUM_RECORDS == X.recordQueueLength());
+
+                ASSERTV(LINE, 0 == mX.startPublicationThread());
+                ASSERTV(LINE, 0 == mX.stopPublicationThread());
+
+                ASSERTV(LINE, EXP_BATCHES, X.numPublishedBatches(),
+                        EXP_BATCHES == X.numPublishedBatches());
+                ASSERTV(LINE, 0 == X.numDroppedRecords());
+                ASSERTV(LINE, X.maxFlushLatency() <= X.totalFlushLatency());
+                ASSERTV(LINE,
+                        bsls::TimeInterval() < X.totalFlushLatency());
+
+                mX.disableFileLogging();
+
+                bsl::vector<bsl::string> lines;
+                readLines(&lines, fileName);
+
+                ASSERTV(LINE, lines.size(), k_NUM_RECORDS == lines.size());
+                for (int i = 0; i < static_cast<int>(lines.size()); ++i) {
+                    char message[16];
+                    sprintf(message, "message %04d", i);
+                    ASSERTV(LINE, i, lines[i], message == lines[i]);
+                }
+
+                removeFilesByPrefix(fileName.c_str());
+            }
+        }
+
+        if (veryVerbose) cout << "\tBatches limited by latency." << endl;
+        {
+            const bsl::string fileName = tempFileName(veryVerbose);
+
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(ball::Severity::e_OFF, &ta);  const Obj& X = mX;
+
+            mX.setLogFormat("%m\n", "%m\n");
+            mX.setFlushPolicy(1000, 1 << 20, bsls::TimeInterval(1.0));
+            ASSERT(0 == mX.enableFileLogging(fileName.c_str()));
+            ASSERT(0 == mX.startPublicationThread());
+
+            publishMessage(&mX, "first");
+            bslmt::ThreadUtil::microSleep(10000);
+            publishMessage(&mX, "second");
+            bslmt::ThreadUtil::microSleep(10000);
+            publishMessage(&mX, "third");
+
+            // Wait for the batch to be written.
+
+            bsls::Stopwatch timer;
+            timer.start();
+            while (0 == X.numPublishedBatches() && timer.elapsedTime() < 5) {
+                bslmt::ThreadUtil::microSleep(10000);
+            }
+
+            ASSERTV(X.numPublishedBatches(), 1 == X.numPublishedBatches());
+
+            ASSERT(0 == mX.stopPublicationThread());
+            mX.disableFileLogging();
+
+            bsl::vector<bsl::string> lines;
+            readLines(&lines, fileName);
+
+            ASSERTV(lines.size(), 3 == lines.size());
+            if (3 == lines.size()) {
+                ASSERT("first"  == lines[0]);
+                ASSERT("second" == lines[1]);
+                ASSERT("third"  == lines[2]);
+            }
+
+            removeFilesByPrefix(fileName.c_str());
+        }
+
+        if (veryVerbose) cout << "\tDropped records." << endl;
+        {
+            bslma::TestAllocator ta(veryVeryVeryVerbose);
+
+            Obj mX(ball::Severity::e_OFF, false, 10, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 15; ++i) {
+                publishMessage(&mX, "dropped?");
+            }
+
+            ASSERTV(X.numDroppedRecords(), 5 == X.numDroppedRecords());
+            ASSERT(10 == X.recordQueueLength());
+
+            mX.shutdownPublicationThread();
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING: 'recordQueueLength'
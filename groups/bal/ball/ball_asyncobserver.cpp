@@ -0,0 +1,494 @@
+// ball_asyncobserver.cpp                                             -*-C++-*-
+#include <ball_asyncobserver.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(ball_asyncobserver_cpp,"$Id$ $CSID$")
+
+#include <ball_recordattributes.h>
+#include <ball_severity.h>
+#include <ball_transmission.h>
+
+#include <bdlb_bitutil.h>
+#include <bdlf_memfn.h>
+#include <bdls_processutil.h>
+#include <bdlt_currenttime.h>
+
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+#include <bslma_default.h>
+#include <bslma_rawdeleterproctor.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_threadattributes.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_ostream.h>
+
+///Implementation Note
+///===================
+// Each ring is a single-producer, single-consumer queue: 'd_tail' is written
+// only by the thread that claimed the ring, and 'd_head' only by the
+// publication thread.  Both are monotonically increasing counts (the index of
+// a slot being the count modulo the capacity), so that a ring is empty if
+// 'd_head == d_tail', and full if 'd_tail - d_head' is the capacity.  The
+// producer caches the last value of 'd_head' it loaded, and reloads it only
+// when the ring appears to be full, so that in the common case the producer
+// does not access the cache line written by the consumer.
+//
+// The rings are held in a singly-linked list to which rings are only ever
+// prepended (with a compare-and-swap), and from which rings are only removed
+// when the observer is destroyed, so that the publication thread can traverse
+// the list without synchronization.  A ring is owned by at most one thread at
+// a time ('d_isClaimed'); when its thread exits, the ring is released by the
+// destructor of the thread-specific key, and can be claimed by another thread
+// (with the records it holds, which are published as usual).
+//
+// The publication thread waits on a semaphore only when all the rings are
+// empty.  Before waiting, it sets 'd_isIdle', and checks the rings again; a
+// producer, after pushing a record, checks 'd_isIdle' and, if it is set,
+// clears it and posts the semaphore.  The store of 'd_tail' by the producer
+// and the store of 'd_isIdle' by the publication thread, as well as the loads
+// that follow them, are sequentially consistent, so that either the producer
+// observes that the publication thread is idle (and wakes it up), or the
+// publication thread observes the record (and does not wait).  Since
+// 'd_isIdle' is rarely written while records are published at a high rate,
+// the load of 'd_isIdle' by the producers is inexpensive.
+//
+// The slots hold records preallocated by the observer, into which 'publish'
+// copies the supplied records.  The copy reuses the memory already allocated
+// by the strings and the message buffer of the record of the slot.  A
+// downstream observer may retain the shared pointer supplied to its 'publish'
+// method (e.g., 'ball::AsyncFileObserver'); the publication thread therefore
+// replaces the record of a slot whose shared pointer is no longer unique once
+// it has been published, so that a record referred to by the downstream
+// observer is never modified.
+//
+// 'releaseRecords' must not invoke the downstream observer while the
+// publication thread publishes records.  While the publication thread runs,
+// 'releaseRecords' therefore sets 'd_releaseFlag', wakes up the publication
+// thread as a producer would, and waits on 'd_releaseDone', which the
+// publication thread posts once it has forwarded the request between two
+// calls to 'drainRings'.  'd_mutex' is held meanwhile, so that there is at
+// most one pending request, and the publication thread cannot be stopped
+// before it services the request.
+
+namespace BloombergLP {
+namespace ball {
+
+namespace {
+
+const char k_LOG_CATEGORY[] = "BALL.ASYNCOBSERVER";
+
+}  // close unnamed namespace
+
+                           // -------------------
+                           // class AsyncObserver
+                           // -------------------
+
+// PRIVATE CLASS METHODS
+void AsyncObserver::releaseRing(void *ring)
+{
+    static_cast<Ring *>(ring)->d_isClaimed.storeRelease(0);
+}
+
+// PRIVATE MANIPULATORS
+AsyncObserver::Ring *AsyncObserver::claimRing()
+{
+    // Recycle a ring released by an exited thread, if any.
+
+    for (Ring *ring = d_rings.loadAcquire(); ring; ring = ring->d_next_p) {
+        if (0 == ring->d_isClaimed.loadRelaxed()
+         && 0 == ring->d_isClaimed.testAndSwap(0, 1)) {
+            bslmt::ThreadUtil::setSpecific(d_key, ring);
+            return ring;                                              // RETURN
+        }
+    }
+
+    Ring *ring = new (*d_allocator_p) Ring();
+    bslma::RawDeleterProctor<Ring, bslma::Allocator> ringProctor(
+                                                                ring,
+                                                                d_allocator_p);
+
+    Slot *slots = static_cast<Slot *>(
+                     d_allocator_p->allocate(d_ringCapacity * sizeof(Slot)));
+    bslma::DeallocatorProctor<bslma::Allocator> slotsProctor(slots,
+                                                             d_allocator_p);
+    bslma::AutoDestructor<Slot> slotsDestructor(slots);
+
+    for (int i = 0; i < d_ringCapacity; ++i) {
+        new (slots + i) Slot();
+        ++slotsDestructor;
+
+        slots[i].d_record.createInplace(d_allocator_p, d_allocator_p);
+    }
+
+    slotsDestructor.release();
+    slotsProctor.release();
+
+    ring->d_slots_p     = slots;
+    ring->d_tail        = 0;
+    ring->d_cachedHead  = 0;
+    ring->d_numDropped  = 0;
+    ring->d_head        = 0;
+    ring->d_numReported = 0;
+    ring->d_mask        = d_ringCapacity - 1;
+    ring->d_isClaimed   = 1;
+
+    ringProctor.release();
+
+    Ring *head = d_rings.loadRelaxed();
+    do {
+        ring->d_next_p = head;
+        Ring *previous = d_rings.testAndSwap(head, ring);
+        if (previous == head) {
+            break;
+        }
+        head = previous;
+    } while (true);
+
+    bslmt::ThreadUtil::setSpecific(d_key, ring);
+    return ring;
+}
+
+bsls::Types::Int64 AsyncObserver::drainRings()
+{
+    Int64 numPublished = 0;
+    Int64 numDropped   = 0;
+
+    for (Ring *ring = d_rings.loadAcquire(); ring; ring = ring->d_next_p) {
+        Int64       head = ring->d_head.loadRelaxed();
+        const Int64 tail = ring->d_tail.loadAcquire();
+
+        numPublished += tail - head;
+
+        for (; head != tail; ++head) {
+            Slot& slot = ring->d_slots_p[head & ring->d_mask];
+
+            d_observer_p->publish(slot.d_record, slot.d_context);
+
+            if (!slot.d_record.unique()) {
+                // The downstream observer retained the record: replace it, so
+                // that the producer does not modify it.
+
+                slot.d_record.createInplace(d_allocator_p, d_allocator_p);
+            }
+            ring->d_head.storeRelease(head + 1);
+        }
+
+        const Int64 dropped  = ring->d_numDropped.loadRelaxed();
+        numDropped          += dropped - ring->d_numReported;
+        ring->d_numReported  = dropped;
+    }
+
+    if (0 < numDropped && e_DROP_AND_REPORT == d_overflowPolicy) {
+        reportDroppedRecords(numDropped);
+    }
+    return numPublished;
+}
+
+void AsyncObserver::enqueue(const Record& record, const Context& context)
+{
+    Ring *ring = static_cast<Ring *>(bslmt::ThreadUtil::getSpecific(d_key));
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == ring)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        ring = claimRing();
+    }
+
+    const Int64 tail = ring->d_tail.loadRelaxed();
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                   tail - ring->d_cachedHead > ring->d_mask)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        ring->d_cachedHead = ring->d_head.loadAcquire();
+        while (tail - ring->d_cachedHead > ring->d_mask) {
+            // Only the publication thread drains the rings: if it is the
+            // caller, waiting would never end.
+
+            if (e_BLOCK != d_overflowPolicy || isPublicationThread()) {
+                ring->d_numDropped.storeRelaxed(
+                                        ring->d_numDropped.loadRelaxed() + 1);
+                return;                                               // RETURN
+            }
+            if (d_isIdle.loadRelaxed() && 1 == d_isIdle.testAndSwap(1, 0)) {
+                d_wakeUp.post();
+            }
+            bslmt::ThreadUtil::yield();
+            ring->d_cachedHead = ring->d_head.loadAcquire();
+        }
+    }
+
+    Slot& slot = ring->d_slots_p[tail & ring->d_mask];
+
+    *slot.d_record = record;
+    slot.d_context = context;
+
+    ring->d_tail = tail + 1;  // sequentially consistent
+
+    if (d_isIdle && 1 == d_isIdle.testAndSwap(1, 0)) {
+        d_wakeUp.post();
+    }
+}
+
+void AsyncObserver::publishThreadEntryPoint()
+{
+    d_threadId = static_cast<Int64>(bslmt::ThreadUtil::selfIdAsUint64());
+
+    while (!d_stopFlag) {
+        if (d_releaseFlag.loadRelaxed()) {
+            d_releaseFlag = 0;
+            d_observer_p->releaseRecords();
+            d_releaseDone.post();
+        }
+
+        if (0 < drainRings()) {
+            continue;
+        }
+
+        d_isIdle = 1;
+        if (!d_stopFlag && !d_releaseFlag && !hasPendingRecords()) {
+            d_wakeUp.wait();
+        }
+        d_isIdle = 0;
+    }
+
+    // Publish the records pushed before the publication thread was signaled
+    // to stop.
+
+    drainRings();
+
+    d_threadId = 0;
+}
+
+void AsyncObserver::reportDroppedRecords(Int64 numDropped)
+{
+    if (!d_droppedRecordWarning.unique()) {
+        d_droppedRecordWarning.createInplace(d_allocator_p, d_allocator_p);
+    }
+
+    RecordAttributes& attributes = d_droppedRecordWarning->fixedFields();
+
+    attributes.setTimestamp(bdlt::CurrentTime::utc());
+    attributes.setProcessID(bdls::ProcessUtil::getProcessId());
+    attributes.setThreadID(bslmt::ThreadUtil::selfIdAsUint64());
+    attributes.setFileName(__FILE__);
+    attributes.setLineNumber(__LINE__);
+    attributes.setCategory(k_LOG_CATEGORY);
+    attributes.setSeverity(Severity::e_WARN);
+    attributes.clearMessage();
+
+    bsl::ostream os(&attributes.messageStreamBuf());
+    os << "Dropped " << numDropped << " log records." << bsl::ends;
+
+    d_observer_p->publish(d_droppedRecordWarning,
+                          Context(Transmission::e_PASSTHROUGH, 0, 1));
+}
+
+// PRIVATE ACCESSORS
+bool AsyncObserver::hasPendingRecords() const
+{
+    for (Ring *ring = d_rings.loadAcquire(); ring; ring = ring->d_next_p) {
+        if (ring->d_head.loadRelaxed() != ring->d_tail.load()) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+}
+
+bool AsyncObserver::isPublicationThread() const
+{
+    const Int64 self = static_cast<Int64>(bslmt::ThreadUtil::selfIdAsUint64());
+
+    return self == d_threadId.loadRelaxed();
+}
+
+// CREATORS
+AsyncObserver::AsyncObserver(Observer         *observer,
+                             bslma::Allocator *basicAllocator)
+: d_observer_p(observer)
+, d_rings(0)
+, d_ringCapacity(k_DEFAULT_RING_CAPACITY)
+, d_overflowPolicy(e_DROP_AND_REPORT)
+, d_isIdle(0)
+, d_wakeUp(0)
+, d_stopFlag(0)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_threadId(0)
+, d_releaseFlag(0)
+, d_releaseDone(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+
+    d_droppedRecordWarning.createInplace(d_allocator_p, d_allocator_p);
+
+    int rc = bslmt::ThreadUtil::createKey(
+                                  &d_key,
+                                  (bslmt::ThreadUtil::Destructor)&releaseRing);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+}
+
+AsyncObserver::AsyncObserver(Observer         *observer,
+                             int               ringCapacity,
+                             OverflowPolicy    overflowPolicy,
+                             bslma::Allocator *basicAllocator)
+: d_observer_p(observer)
+, d_rings(0)
+, d_ringCapacity(static_cast<int>(
+       bdlb::BitUtil::roundUpToBinaryPower(
+                                    static_cast<bsl::uint32_t>(ringCapacity))))
+, d_overflowPolicy(overflowPolicy)
+, d_isIdle(0)
+, d_wakeUp(0)
+, d_stopFlag(0)
+, d_threadHandle(bslmt::ThreadUtil::invalidHandle())
+, d_threadId(0)
+, d_releaseFlag(0)
+, d_releaseDone(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(observer);
+    BSLS_ASSERT(0 < ringCapacity);
+
+    d_droppedRecordWarning.createInplace(d_allocator_p, d_allocator_p);
+
+    int rc = bslmt::ThreadUtil::createKey(
+                                  &d_key,
+                                  (bslmt::ThreadUtil::Destructor)&releaseRing);
+    BSLS_ASSERT_OPT(0 == rc);
+    (void)rc;
+}
+
+AsyncObserver::~AsyncObserver()
+{
+    stopPublicationThread();
+
+    bslmt::ThreadUtil::deleteKey(d_key);
+
+    Ring *ring = d_rings.loadAcquire();
+    while (ring) {
+        Ring *next = ring->d_next_p;
+
+        for (int i = 0; i < d_ringCapacity; ++i) {
+            ring->d_slots_p[i].~Slot();
+        }
+        d_allocator_p->deallocate(ring->d_slots_p);
+        d_allocator_p->deleteObjectRaw(ring);
+
+        ring = next;
+    }
+}
+
+// MANIPULATORS
+void AsyncObserver::publish(const Record& record, const Context& context)
+{
+    enqueue(record, context);
+}
+
+void AsyncObserver::publish(const bsl::shared_ptr<const Record>& record,
+                            const Context&                       context)
+{
+    enqueue(*record, context);
+}
+
+void AsyncObserver::releaseRecords()
+{
+    if (isPublicationThread()) {
+        // Invoked from the publication thread (e.g., by the downstream
+        // observer), which is not publishing a record meanwhile.  Note that
+        // 'd_mutex' may be held by 'stopPublicationThread', which is waiting
+        // for this thread to exit.
+
+        d_observer_p->releaseRecords();
+        return;                                                       // RETURN
+    }
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (bslmt::ThreadUtil::invalidHandle() == d_threadHandle) {
+        // No record is published while the publication thread is not running
+        // (and 'd_mutex' prevents it from being started).
+
+        d_observer_p->releaseRecords();
+        return;                                                       // RETURN
+    }
+
+    d_releaseFlag = 1;  // sequentially consistent
+
+    if (d_isIdle && 1 == d_isIdle.testAndSwap(1, 0)) {
+        d_wakeUp.post();
+    }
+
+    d_releaseDone.wait();
+}
+
+int AsyncObserver::startPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (bslmt::ThreadUtil::invalidHandle() != d_threadHandle) {
+        return 0;                                                     // RETURN
+    }
+
+    d_stopFlag = 0;
+
+    bslmt::ThreadAttributes attributes;
+    return bslmt::ThreadUtil::create(
+        &d_threadHandle,
+        attributes,
+        bdlf::MemFnUtil::memFn(&AsyncObserver::publishThreadEntryPoint, this));
+}
+
+int AsyncObserver::stopPublicationThread()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (bslmt::ThreadUtil::invalidHandle() == d_threadHandle) {
+        return 0;                                                     // RETURN
+    }
+
+    d_stopFlag = 1;
+    d_wakeUp.post();
+
+    int rc = bslmt::ThreadUtil::join(d_threadHandle);
+    d_threadHandle = bslmt::ThreadUtil::invalidHandle();
+    return rc;
+}
+
+// ACCESSORS
+bool AsyncObserver::isPublicationThreadRunning() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return bslmt::ThreadUtil::invalidHandle() != d_threadHandle;
+}
+
+bsls::Types::Int64 AsyncObserver::numDroppedRecords() const
+{
+    Int64 numDropped = 0;
+    for (Ring *ring = d_rings.loadAcquire(); ring; ring = ring->d_next_p) {
+        numDropped += ring->d_numDropped.loadRelaxed();
+    }
+    return numDropped;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,538 @@
+// ball_asyncobserver.h                                               -*-C++-*-
+#ifndef INCLUDED_BALL_ASYNCOBSERVER
+#define INCLUDED_BALL_ASYNCOBSERVER
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an observer publishing to another observer asynchronously.
+//
+//@CLASSES:
+//  ball::AsyncObserver: observer forwarding records through per-thread rings
+//
+//@SEE_ALSO: ball_observer, ball_multiplexobserver, ball_asyncfileobserver
+//
+//@DESCRIPTION: This component provides a concrete implementation of the
+// 'ball::Observer' protocol, 'ball::AsyncObserver', that removes the cost of
+// publication from the threads that log.  A 'ball::AsyncObserver' copies each
+// record supplied to its 'publish' method into a bounded, lock-free,
+// single-producer ring owned by the calling thread, and returns immediately.
+// A single publication thread drains the rings of all the threads, and
+// publishes the records to the (downstream) observer supplied at construction
+// (typically a 'ball::MultiplexObserver' fanning out to the observers that
+// format and write the records).  The following inheritance hierarchy diagram
+// shows the classes involved and their methods:
+//..
+//             ,-------------------.
+//            ( ball::AsyncObserver )
+//             `-------------------'
+//                       |              ctor
+//                       |              startPublicationThread
+//                       |              stopPublicationThread
+//                       |              isPublicationThreadRunning
+//                       |              numDroppedRecords
+//                       |              overflowPolicy
+//                       |              ringCapacity
+//                       V
+//               ,--------------.
+//              ( ball::Observer )
+//               `--------------'
+//                                      dtor
+//                                      publish
+//                                      releaseRecords
+//..
+// Unlike 'ball::AsyncFileObserver', which holds a shared reference to each
+// queued record, 'ball::AsyncObserver' copies the fixed fields, the (already
+// formatted) message, and the user fields of a record into a record that was
+// preallocated in a slot of the ring, so that the logger can reuse its record
+// as soon as 'publish' returns.  Once a thread has published a few records,
+// and unless the messages it logs grow longer than the ones it logged before,
+// 'publish' neither allocates memory nor acquires a lock: it is a copy, two
+// atomic loads, and one atomic store.
+//
+///Ordering
+///--------
+// The records published by a given thread are published to the downstream
+// observer in the order in which they were supplied to 'publish'.  No order
+// is guaranteed among records published by different threads.  All the
+// records are published to the downstream observer from the publication
+// thread, and 'releaseRecords' is forwarded to the downstream observer by the
+// publication thread (between two batches of records) while it is running, so
+// the downstream observer is never invoked concurrently by a
+// 'ball::AsyncObserver'.
+//
+///Overflow Policy
+///---------------
+// The capacity of each ring is fixed at construction.  The
+// 'ball::AsyncObserver::OverflowPolicy' supplied at construction determines
+// what 'publish' does if the ring of the calling thread is full (i.e., if the
+// thread logs faster than the publication thread publishes):
+//
+//: 'e_DROP':
+//:   The record is discarded.  The number of records discarded is available
+//:   from 'numDroppedRecords'.
+//:
+//: 'e_DROP_AND_REPORT':
+//:   The record is discarded, as for 'e_DROP', and the publication thread
+//:   also publishes a warning record reporting the number of records
+//:   discarded since the previous report to the downstream observer.  This
+//:   is the default policy.
+//:
+//: 'e_BLOCK':
+//:   The calling thread waits until the publication thread has drained a
+//:   record from its ring.  Note that a thread publishing records when the
+//:   publication thread is not running will wait indefinitely.  Records
+//:   published by the publication thread itself (e.g., logged by the
+//:   downstream observer) are discarded, as for 'e_DROP', if its ring is
+//:   full, since the publication thread cannot wait for itself.
+//
+///Thread Safety
+///-------------
+// 'ball::AsyncObserver' is fully *thread-safe*, meaning that all non-creator
+// operations on a given instance can be safely invoked simultaneously from
+// multiple threads.  The rings are allocated on the first call to 'publish'
+// from each thread, and are recycled when a thread exits, so that the number
+// of rings is bounded by the maximum number of threads that published records
+// concurrently.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Records Asynchronously
+/// - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we publish records asynchronously to an observer that
+// writes them to a stream.
+//
+// First, we define the downstream observer, which formats the records it
+// receives into a stream (a 'ball::MultiplexObserver' would typically be used
+// instead, so that the records can be published to several observers):
+//..
+//  class StreamObserver : public ball::Observer {
+//      // This class provides an observer writing the message of each record
+//      // it publishes to a stream.
+//
+//      // DATA
+//      bsl::ostream *d_stream_p;  // output stream (held, not owned)
+//
+//    public:
+//      // CREATORS
+//      explicit StreamObserver(bsl::ostream *stream)
+//      : d_stream_p(stream)
+//      {
+//      }
+//
+//      // MANIPULATORS
+//      using ball::Observer::publish;
+//
+//      virtual void publish(const bsl::shared_ptr<const ball::Record>& record,
+//                           const ball::Context&)
+//      {
+//          *d_stream_p << record->fixedFields().message() << '\n';
+//      }
+//  };
+//..
+// Then, we create the downstream observer, and an asynchronous observer that
+// publishes to it, and we start the publication thread:
+//..
+//  bsl::ostringstream stream;
+//  StreamObserver     streamObserver(&stream);
+//
+//  ball::AsyncObserver asyncObserver(&streamObserver);
+//
+//  int rc = asyncObserver.startPublicationThread();
+//  assert(0 == rc);
+//..
+// Next, we publish a record to the asynchronous observer (a logger manager
+// supplied with 'asyncObserver' would publish the records logged through the
+// 'BALL_LOG_*' macros the same way):
+//..
+//  bsl::shared_ptr<ball::Record> record;
+//  record.createInplace();
+//  record->fixedFields().setMessage("Hello world!");
+//
+//  asyncObserver.publish(record,
+//                        ball::Context(ball::Transmission::e_PASSTHROUGH,
+//                                      0,
+//                                      1));
+//..
+// Now, note that 'publish' copied the record: the original record can be
+// modified (or reused) without affecting the record that is published:
+//..
+//  record->fixedFields().setMessage("Goodbye world!");
+//..
+// Finally, we stop the publication thread, which publishes the records
+// remaining in the rings before returning, and we verify the output:
+//..
+//  rc = asyncObserver.stopPublicationThread();
+//  assert(0 == rc);
+//
+//  assert("Hello world!\n" == stream.str());
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BALL_CONTEXT
+#include <ball_context.h>
+#endif
+
+#ifndef INCLUDED_BALL_OBSERVER
+#include <ball_observer.h>
+#endif
+
+#ifndef INCLUDED_BALL_RECORD
+#include <ball_record.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_SEMAPHORE
+#include <bslmt_semaphore.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_MEMORY
+#include <bsl_memory.h>
+#endif
+
+namespace BloombergLP {
+namespace ball {
+
+                           // ===================
+                           // class AsyncObserver
+                           // ===================
+
+class AsyncObserver : public Observer {
+    // This class implements the 'Observer' protocol.  The 'publish' method of
+    // this class copies the supplied record into a ring owned by the calling
+    // thread, from which a publication thread later publishes it to the
+    // observer supplied at construction.  This class is thread-safe; different
+    // threads can operate on this object concurrently.
+
+  public:
+    // TYPES
+    enum OverflowPolicy {
+        // Enumerate the behaviors of 'publish' when the ring of the calling
+        // thread is full.
+
+        e_DROP,             // discard the record
+
+        e_DROP_AND_REPORT,  // discard the record, and report the number of
+                            // discarded records to the downstream observer
+
+        e_BLOCK             // wait until the ring is no longer full
+    };
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_RING_CAPACITY = 256  // default capacity of each ring
+    };
+
+  private:
+    // PRIVATE CONSTANTS
+    enum {
+        k_CACHE_LINE_SIZE = bslmt::Platform::e_CACHE_LINE_SIZE
+    };
+
+    // PRIVATE TYPES
+    typedef bsls::Types::Int64 Int64;
+
+    struct Slot {
+        // This 'struct' holds a record (and its publication context) copied
+        // into a ring.
+
+        // DATA
+        bsl::shared_ptr<Record> d_record;   // preallocated record
+        Context                 d_context;  // publication context
+    };
+
+    struct Ring {
+        // This 'struct' provides a bounded, single-producer, single-consumer
+        // queue of records, owned by one publishing thread at a time.
+
+        // DATA
+        bsls::AtomicInt64  d_tail;        // number of records pushed; written
+                                          // by the producer only
+
+        Int64              d_cachedHead;  // last value of 'd_head' loaded by
+                                          // the producer
+
+        bsls::AtomicInt64  d_numDropped;  // number of records dropped; written
+                                          // by the producer only
+
+        char               d_pad0[k_CACHE_LINE_SIZE];
+
+        bsls::AtomicInt64  d_head;        // number of records popped; written
+                                          // by the consumer only
+
+        Int64              d_numReported; // value of 'd_numDropped' when the
+                                          // dropped records were last reported
+                                          // (consumer only)
+
+        char               d_pad1[k_CACHE_LINE_SIZE];
+
+        Slot              *d_slots_p;     // array of slots (owned)
+
+        Int64              d_mask;        // number of slots minus one
+
+        bsls::AtomicInt    d_isClaimed;   // 1 if a thread owns this ring, and
+                                          // 0 otherwise
+
+        Ring              *d_next_p;      // next ring of the observer
+                                          // (immutable once published)
+    };
+
+    // DATA
+    Observer                  *d_observer_p;      // downstream observer (held,
+                                                  // not owned)
+
+    bslmt::ThreadUtil::Key     d_key;             // key of the ring of each
+                                                  // thread
+
+    bsls::AtomicPointer<Ring>  d_rings;           // list of all the rings
+
+    int                        d_ringCapacity;    // number of slots per ring
+
+    OverflowPolicy             d_overflowPolicy;  // behavior on a full ring
+
+    bsls::AtomicInt            d_isIdle;          // 1 if the publication
+                                                  // thread may be waiting on
+                                                  // 'd_wakeUp', and 0
+                                                  // otherwise
+
+    bslmt::Semaphore           d_wakeUp;          // wakes up the publication
+                                                  // thread
+
+    bsls::AtomicInt            d_stopFlag;        // 1 if the publication
+                                                  // thread must stop
+
+    bslmt::ThreadUtil::Handle  d_threadHandle;    // publication thread
+
+    bsls::AtomicInt64          d_threadId;        // ID of the publication
+                                                  // thread while it runs,
+                                                  // and 0 otherwise
+
+    bsls::AtomicInt            d_releaseFlag;     // 1 if 'releaseRecords' is
+                                                  // to be forwarded by the
+                                                  // publication thread
+
+    bslmt::Semaphore           d_releaseDone;     // posted by the
+                                                  // publication thread once
+                                                  // it forwarded
+                                                  // 'releaseRecords'
+
+    bsl::shared_ptr<Record>    d_droppedRecordWarning;
+                                                  // record used to report
+                                                  // dropped records
+
+    mutable bslmt::Mutex       d_mutex;           // serializes the start and
+                                                  // stop of the publication
+                                                  // thread, and the calls to
+                                                  // 'releaseRecords'
+
+    bslma::Allocator          *d_allocator_p;     // memory allocator (held,
+                                                  // not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    AsyncObserver(const AsyncObserver&);
+    AsyncObserver& operator=(const AsyncObserver&);
+
+    // PRIVATE CLASS METHODS
+    static void releaseRing(void *ring);
+        // Release the ownership of the specified 'ring' by the calling thread,
+        // so that the ring can be claimed by another thread.  This function
+        // is invoked when a thread that claimed 'ring' exits.
+
+    // PRIVATE MANIPULATORS
+    Ring *claimRing();
+        // Claim a ring for the calling thread, recycling a ring released by
+        // an exited thread if one is available, and creating a new ring
+        // otherwise, and return the address of the claimed ring.
+
+    Int64 drainRings();
+        // Publish to the downstream observer all the records available in the
+        // rings, and, if the overflow policy is 'e_DROP_AND_REPORT', report
+        // the records dropped since the previous report.  Return the number of
+        // records published.  The behavior is undefined unless this method is
+        // invoked from the publication thread (or while the publication thread
+        // is not running).
+
+    void enqueue(const Record& record, const Context& context);
+        // Copy the specified 'record' and 'context' into the ring of the
+        // calling thread, applying the overflow policy if the ring is full,
+        // and wake up the publication thread if it is idle.  If the ring is
+        // full and the calling thread is the publication thread, discard the
+        // record whatever the overflow policy.
+
+    void publishThreadEntryPoint();
+        // Publish the records pushed into the rings, and forward the requests
+        // of 'releaseRecords' to the downstream observer, until signaled to
+        // stop, and then publish the remaining records.  This is the entry
+        // point of the publication thread.
+
+    void reportDroppedRecords(Int64 numDropped);
+        // Publish to the downstream observer a warning record reporting that
+        // the specified 'numDropped' records were discarded.
+
+    // PRIVATE ACCESSORS
+    bool hasPendingRecords() const;
+        // Return 'true' if any ring holds a record that was not published,
+        // and 'false' otherwise.
+
+    bool isPublicationThread() const;
+        // Return 'true' if the calling thread is the publication thread, and
+        // 'false' otherwise.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AsyncObserver, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit AsyncObserver(Observer         *observer,
+                           bslma::Allocator *basicAllocator = 0);
+    AsyncObserver(Observer         *observer,
+                  int               ringCapacity,
+                  OverflowPolicy    overflowPolicy,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an asynchronous observer that publishes the records supplied
+        // to 'publish' to the specified 'observer' from a publication thread.
+        // Optionally specify a 'ringCapacity' indicating the number of records
+        // that the ring of each publishing thread can hold (rounded up to a
+        // power of 2), and an 'overflowPolicy' indicating the behavior of
+        // 'publish' when the ring of the calling thread is full.  If
+        // 'ringCapacity' and 'overflowPolicy' are not specified,
+        // 'k_DEFAULT_RING_CAPACITY' and 'e_DROP_AND_REPORT' are used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'observer' is not 0 and
+        // remains valid for the lifetime of this object, and
+        // '0 < ringCapacity'.  Note that the publication thread is not started
+        // (see 'startPublicationThread').
+
+    virtual ~AsyncObserver();
+        // Stop the publication thread after publishing the remaining records,
+        // and destroy this observer.  The behavior is undefined unless no
+        // thread is invoking 'publish' on this object.
+
+    // MANIPULATORS
+    virtual void publish(const Record& record, const Context& context);
+    virtual void publish(const bsl::shared_ptr<const Record>& record,
+                         const Context&                       context);
+        // Copy the specified 'record' and 'context' into the ring of the
+        // calling thread, to be published to the downstream observer by the
+        // publication thread.  If the ring is full, apply the overflow policy
+        // of this observer.  Note that 'record' can be modified or destroyed
+        // as soon as this method returns.
+
+    virtual void releaseRecords();
+        // Discard any shared reference to a 'Record' object that was supplied
+        // to the 'publish' method of the downstream observer, and is held by
+        // the downstream observer.  If the publication thread is running, and
+        // is not the calling thread, the request is forwarded to the
+        // downstream observer by the publication thread, between two batches
+        // of records, and this method waits until it was.  Note that this
+        // observer does not hold any reference to the records supplied to its
+        // 'publish' method.
+
+    int startPublicationThread();
+        // Start the publication thread.  If the publication thread is already
+        // running, this operation has no effect.  Return 0 on success, and a
+        // non-zero value if there is an error creating the thread.
+
+    int stopPublicationThread();
+        // Stop the publication thread after all the records remaining in the
+        // rings have been published.  If the publication thread is not
+        // running, this operation has no effect.  Return 0 on success, and a
+        // non-zero value if there is an error joining the thread.
+
+    // ACCESSORS
+    bool isPublicationThreadRunning() const;
+        // Return 'true' if the publication thread is running, and 'false'
+        // otherwise.
+
+    bsls::Types::Int64 numDroppedRecords() const;
+        // Return the number of records discarded by 'publish' because the
+        // ring of the calling thread was full.
+
+    OverflowPolicy overflowPolicy() const;
+        // Return the overflow policy of this observer.
+
+    int ringCapacity() const;
+        // Return the number of records that the ring of each thread can hold.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                           // -------------------
+                           // class AsyncObserver
+                           // -------------------
+
+// ACCESSORS
+inline
+AsyncObserver::OverflowPolicy AsyncObserver::overflowPolicy() const
+{
+    return d_overflowPolicy;
+}
+
+inline
+int AsyncObserver::ringCapacity() const
+{
+    return d_ringCapacity;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
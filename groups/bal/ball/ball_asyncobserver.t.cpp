@@ -0,0 +1,1527 @@
+// ball_asyncobserver.t.cpp                                           -*-C++-*-
+#include <ball_asyncobserver.h>
+
+#include <ball_context.h>
+#include <ball_log.h>
+#include <ball_loggermanager.h>
+#include <ball_loggermanagerconfiguration.h>
+#include <ball_record.h>
+#include <ball_recordattributes.h>
+#include <ball_recordstringformatter.h>
+#include <ball_severity.h>
+#include <ball_transmission.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_timeutil.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_memory.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'ball::AsyncObserver' copies the records supplied to 'publish' into
+// per-thread rings, and publishes them to a downstream observer from a
+// publication thread.  We verify, with a downstream observer recording the
+// records it receives, that the records are published unchanged and in order,
+// that 'publish' copies the supplied record (which can be modified once
+// 'publish' returns), and that the records retained by the downstream
+// observer are never modified.  We verify each overflow policy by filling
+// the ring of a thread before starting the publication thread.  We verify
+// that, once a thread has published a record, 'publish' does not allocate
+// memory, and that the rings of exited threads are recycled.  A concurrency
+// test, with several threads publishing sequences of records, verifies that
+// every record is published, and that the records of each thread are
+// published in order.  Finally, 'ball::AsyncObserver' is used as the
+// observer of the logger manager, with records logged through the 'BALL_LOG_*'
+// macros.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] AsyncObserver(Observer *observer, bslma::Allocator *ba = 0);
+// [ 2] AsyncObserver(Observer *, int, OverflowPolicy, bslma::Allocator *);
+// [ 2] ~AsyncObserver();
+//
+// MANIPULATORS
+// [ 3] void publish(const Record& record, const Context& context);
+// [ 3] void publish(const shared_ptr<const Record>&, const Context&);
+// [ 3] void releaseRecords();
+// [ 2] int startPublicationThread();
+// [ 2] int stopPublicationThread();
+//
+// ACCESSORS
+// [ 2] bool isPublicationThreadRunning() const;
+// [ 4] bsls::Types::Int64 numDroppedRecords() const;
+// [ 2] OverflowPolicy overflowPolicy() const;
+// [ 2] int ringCapacity() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] OVERFLOW POLICIES
+// [ 5] MEMORY ALLOCATION AND RING RECYCLING
+// [ 6] CONCURRENCY TEST
+// [ 7] LOGGER MANAGER INTEGRATION
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: logging latency with and without 'AsyncObserver'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   THREAD-SAFE OUTPUT AND ASSERT MACROS
+// ----------------------------------------------------------------------------
+
+static bslmt::Mutex coutMutex;
+
+#define ASSERTT(X) {                                                          \
+   if (!(X)) {                                                                \
+       bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);                      \
+       aSsErT(1, #X, __LINE__); } }
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef ball::AsyncObserver Obj;
+typedef bsls::Types::Int64  Int64;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                          // =======================
+                          // class RecordingObserver
+                          // =======================
+
+class RecordingObserver : public ball::Observer {
+    // This class provides an observer that records the messages, the thread
+    // ids, and the contexts of the records it publishes, and that optionally
+    // retains the shared pointers to the records.  The observer also records
+    // the threads invoking it, and counts the invocations of 'publish' and
+    // 'releaseRecords' that overlap.
+
+    // DATA
+    bsl::vector<bsl::string>                         d_messages;
+    bsl::vector<bsls::Types::Uint64>                 d_threadIds;
+    bsl::vector<ball::Transmission::Cause>           d_causes;
+    bsl::vector<bsl::shared_ptr<const ball::Record> > d_retained;
+    bool                                             d_retainFlag;
+    bsls::AtomicInt                                  d_numReleases;
+    bsls::AtomicInt                                  d_numActive;
+    bsls::AtomicInt                                  d_numOverlaps;
+    bsls::Types::Uint64                              d_publishingThread;
+    bsls::Types::Uint64                              d_releasingThread;
+    mutable bslmt::Mutex                             d_mutex;
+
+    // PRIVATE MANIPULATORS
+    void enter()
+        // Record that the calling thread entered this observer, and whether
+        // another thread was already in it.
+    {
+        if (0 != d_numActive++) {
+            ++d_numOverlaps;
+        }
+    }
+
+    void leave()
+        // Record that the calling thread left this observer.
+    {
+        --d_numActive;
+    }
+
+  public:
+    // CREATORS
+    explicit RecordingObserver(bool              retainFlag     = false,
+                               bslma::Allocator *basicAllocator = 0)
+    : d_messages(basicAllocator)
+    , d_threadIds(basicAllocator)
+    , d_causes(basicAllocator)
+    , d_retained(basicAllocator)
+    , d_retainFlag(retainFlag)
+    , d_numReleases(0)
+    , d_numActive(0)
+    , d_numOverlaps(0)
+    , d_publishingThread(0)
+    , d_releasingThread(0)
+    {
+    }
+
+    // MANIPULATORS
+    using ball::Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const ball::Record>& record,
+                         const ball::Context&                       context)
+    {
+        enter();
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_messages.push_back(record->fixedFields().message());
+            d_threadIds.push_back(record->fixedFields().threadID());
+            d_causes.push_back(context.transmissionCause());
+            if (d_retainFlag) {
+                d_retained.push_back(record);
+            }
+            d_publishingThread = bslmt::ThreadUtil::selfIdAsUint64();
+        }
+        leave();
+    }
+
+    virtual void releaseRecords()
+    {
+        enter();
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+            d_retained.clear();
+            d_releasingThread = bslmt::ThreadUtil::selfIdAsUint64();
+            ++d_numReleases;
+        }
+        leave();
+    }
+
+    void reserve(int capacity)
+    {
+        d_messages.reserve(capacity);
+        d_threadIds.reserve(capacity);
+        d_causes.reserve(capacity);
+    }
+
+    // ACCESSORS
+    const bsl::vector<ball::Transmission::Cause>& causes() const
+    {
+        return d_causes;
+    }
+
+    const bsl::vector<bsl::string>& messages() const
+    {
+        return d_messages;
+    }
+
+    int numOverlaps() const
+    {
+        return d_numOverlaps;
+    }
+
+    int numReleases() const
+    {
+        return d_numReleases;
+    }
+
+    bsls::Types::Uint64 publishingThread() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return d_publishingThread;
+    }
+
+    bsls::Types::Uint64 releasingThread() const
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        return d_releasingThread;
+    }
+
+    const bsl::vector<bsl::shared_ptr<const ball::Record> >& retained() const
+    {
+        return d_retained;
+    }
+
+    const bsl::vector<bsls::Types::Uint64>& threadIds() const
+    {
+        return d_threadIds;
+    }
+};
+
+                          // ========================
+                          // class FormattingObserver
+                          // ========================
+
+class FormattingObserver : public ball::Observer {
+    // This class provides an observer that formats the records it publishes,
+    // as a file observer would, into a stream that is periodically emptied.
+
+    // DATA
+    ball::RecordStringFormatter d_formatter;
+    bsl::ostringstream          d_stream;
+    Int64                       d_numRecords;
+    bslmt::Mutex                d_mutex;
+
+  public:
+    // CREATORS
+    FormattingObserver()
+    : d_formatter("\n%d %p:%t %s %f:%l %c %m %u\n")
+    , d_numRecords(0)
+    {
+    }
+
+    // MANIPULATORS
+    using ball::Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const ball::Record>& record,
+                         const ball::Context&                       context)
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        d_formatter(d_stream, *record);
+        if (0 == ++d_numRecords % 1024) {
+            d_stream.str("");
+        }
+    }
+
+    // ACCESSORS
+    Int64 numRecords() const
+    {
+        return d_numRecords;
+    }
+};
+
+                          // ========================
+                          // class ForwardingObserver
+                          // ========================
+
+class ForwardingObserver : public ball::Observer {
+    // This class provides an observer that publishes the records it receives
+    // to another observer, that can be changed.
+
+    // DATA
+    bsls::AtomicPointer<ball::Observer> d_observer_p;  // (held, not owned)
+
+  public:
+    // CREATORS
+    explicit ForwardingObserver(ball::Observer *observer)
+    : d_observer_p(observer)
+    {
+    }
+
+    // MANIPULATORS
+    using ball::Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const ball::Record>& record,
+                         const ball::Context&                       context)
+    {
+        d_observer_p.loadAcquire()->publish(record, context);
+    }
+
+    void setObserver(ball::Observer *observer)
+    {
+        d_observer_p.storeRelease(observer);
+    }
+};
+
+                          // ========================
+                          // class ReentrantObserver
+                          // ========================
+
+class ReentrantObserver : public ball::Observer {
+    // This class provides an observer that, for each record it receives whose
+    // message does not start with "echo", publishes a number of records back
+    // to an asynchronous observer, and that counts the records it receives
+    // whose message starts with "echo".
+
+    // DATA
+    Obj             *d_observer_p;  // (held, not owned)
+    int              d_numEchoes;
+    bsls::AtomicInt  d_numEchoesReceived;
+
+  public:
+    // CREATORS
+    explicit ReentrantObserver(int numEchoes)
+    : d_observer_p(0)
+    , d_numEchoes(numEchoes)
+    , d_numEchoesReceived(0)
+    {
+    }
+
+    // MANIPULATORS
+    using ball::Observer::publish;
+
+    virtual void publish(const bsl::shared_ptr<const ball::Record>& record,
+                         const ball::Context&                       context)
+    {
+        if (0 == bsl::strncmp("echo", record->fixedFields().message(), 4)) {
+            ++d_numEchoesReceived;
+            return;                                                   // RETURN
+        }
+
+        ball::Record echo(*record);
+        echo.fixedFields().setMessage("echo");
+        for (int i = 0; i < d_numEchoes; ++i) {
+            d_observer_p->publish(echo, context);
+        }
+    }
+
+    void setObserver(Obj *observer)
+    {
+        d_observer_p = observer;
+    }
+
+    // ACCESSORS
+    int numEchoesReceived() const
+    {
+        return d_numEchoesReceived;
+    }
+};
+
+void setMessage(ball::Record *record, int value)
+    // Set the message of the specified 'record' to the decimal representation
+    // of the specified 'value'.
+{
+    bsl::ostringstream os;
+    os << value;
+    record->fixedFields().setMessage(os.str().c_str());
+}
+
+void publishSequence(Obj *observer, int threadIndex, int numRecords)
+    // Publish to the specified 'observer' the specified 'numRecords' records,
+    // having the messages "<threadIndex>:<i>", where 'threadIndex' is the
+    // specified 'threadIndex', and 'i' is in the range '[0 .. numRecords)'.
+{
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace();
+    record->fixedFields().setThreadID(bslmt::ThreadUtil::selfIdAsUint64());
+
+    const ball::Context context(ball::Transmission::e_PASSTHROUGH, 0, 1);
+
+    for (int i = 0; i < numRecords; ++i) {
+        char buffer[32];
+        bsl::sprintf(buffer, "%d:%d", threadIndex, i);
+        record->fixedFields().setMessage(buffer);
+        observer->publish(record, context);
+    }
+}
+
+void measureLatencies(bsl::vector<Int64> *latencies, int numRecords)
+    // Log the specified 'numRecords' records with 'BALL_LOG_INFO', and load
+    // into the specified 'latencies' the duration, in nanoseconds, of each
+    // 'BALL_LOG_INFO' statement.
+{
+    BALL_LOG_SET_CATEGORY("PERFORMANCE.TEST");
+
+    latencies->resize(numRecords);
+    for (int i = 0; i < numRecords; ++i) {
+        const Int64 start = bsls::TimeUtil::getTimer();
+        BALL_LOG_INFO << "record " << i << " of " << numRecords
+                      << BALL_LOG_END;
+        (*latencies)[i] = bsls::TimeUtil::getTimer() - start;
+    }
+}
+
+void publishOnce(Obj *observer)
+    // Publish one record to the specified 'observer'.
+{
+    publishSequence(observer, 0, 1);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace UsageExample1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Publishing Records Asynchronously
+/// - - - - - - - - - - - - - - - - - - - - - -
+// In this example, we publish records asynchronously to an observer that
+// writes them to a stream.
+//
+// First, we define the downstream observer, which formats the records it
+// receives into a stream (a 'ball::MultiplexObserver' would typically be used
+// instead, so that the records can be published to several observers):
+//..
+    class StreamObserver : public ball::Observer {
+        // This class provides an observer writing the message of each record
+        // it publishes to a stream.
+
+        // DATA
+        bsl::ostream *d_stream_p;  // output stream (held, not owned)
+
+      public:
+        // CREATORS
+        explicit StreamObserver(bsl::ostream *stream)
+        : d_stream_p(stream)
+        {
+        }
+
+        // MANIPULATORS
+        using ball::Observer::publish;
+
+        virtual void publish(const bsl::shared_ptr<const ball::Record>& record,
+                             const ball::Context&)
+        {
+            *d_stream_p << record->fixedFields().message() << '\n';
+        }
+    };
+//..
+
+}  // close namespace UsageExample1
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose         = argc > 2;
+    veryVerbose     = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace UsageExample1;
+
+// Then, we create the downstream observer, and an asynchronous observer that
+// publishes to it, and we start the publication thread:
+//..
+    bsl::ostringstream stream;
+    StreamObserver     streamObserver(&stream);
+
+    ball::AsyncObserver asyncObserver(&streamObserver);
+
+    int rc = asyncObserver.startPublicationThread();
+    ASSERT(0 == rc);
+//..
+// Next, we publish a record to the asynchronous observer (a logger manager
+// supplied with 'asyncObserver' would publish the records logged through the
+// 'BALL_LOG_*' macros the same way):
+//..
+    bsl::shared_ptr<ball::Record> record;
+    record.createInplace();
+    record->fixedFields().setMessage("Hello world!");
+
+    asyncObserver.publish(record,
+                          ball::Context(ball::Transmission::e_PASSTHROUGH,
+                                        0,
+                                        1));
+//..
+// Now, note that 'publish' copied the record: the original record can be
+// modified (or reused) without affecting the record that is published:
+//..
+    record->fixedFields().setMessage("Goodbye world!");
+//..
+// Finally, we stop the publication thread, which publishes the records
+// remaining in the rings before returning, and we verify the output:
+//..
+    rc = asyncObserver.stopPublicationThread();
+    ASSERT(0 == rc);
+
+    ASSERT("Hello world!\n" == stream.str());
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // LOGGER MANAGER INTEGRATION
+        //
+        // Concerns:
+        //: 1 An 'AsyncObserver' supplied to the logger manager publishes the
+        //:   records logged through the 'BALL_LOG_*' macros to the downstream
+        //:   observer, with their fields (category, severity, file, line, and
+        //:   message) unchanged.
+        //:
+        //: 2 The records published on a "Trigger" event are published with
+        //:   their context.
+        //:
+        //: 3 The records published by the logger manager can be reused by
+        //:   the logger manager as soon as they are published.
+        //
+        // Plan:
+        //: 1 Create a logger manager with an 'AsyncObserver' publishing to a
+        //:   'RecordingObserver', log records with the 'BALL_LOG_*' macros,
+        //:   and verify the records published.  (C-1)
+        //:
+        //: 2 Set the "Trigger" threshold, log records at the "Record"
+        //:   threshold and then a record at the "Trigger" threshold, and
+        //:   verify the causes of the records published.  (C-2)
+        //:
+        //: 3 Verify that the number of records in use by the logger is 0
+        //:   before the publication thread is started.  (C-3)
+        //
+        // Testing:
+        //   LOGGER MANAGER INTEGRATION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "LOGGER MANAGER INTEGRATION" << endl
+                          << "==========================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        RecordingObserver downstream(false, &ta);
+        Obj               mX(&downstream, &ta);  const Obj& X = mX;
+
+        {
+            ball::LoggerManagerConfiguration configuration;
+            configuration.setDefaultThresholdLevelsIfValid(
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_INFO,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_OFF);
+
+            ball::LoggerManagerScopedGuard lmGuard(&mX, configuration, &ta);
+
+            BALL_LOG_SET_CATEGORY("TEST.ASYNC");
+
+            BALL_LOG_INFO  << "first"   << BALL_LOG_END;
+            BALL_LOG_WARN  << "second"  << BALL_LOG_END;
+            BALL_LOG_DEBUG << "ignored" << BALL_LOG_END;
+
+            // The records of the logger were released, although they were not
+            // published yet.
+
+            ASSERT(0 == ball::LoggerManager::singleton().getLogger()
+                                                         .numRecordsInUse());
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+
+            ASSERTV(downstream.messages().size(),
+                    2 == downstream.messages().size());
+            ASSERT("first"  == downstream.messages()[0]);
+            ASSERT("second" == downstream.messages()[1]);
+            ASSERT(bslmt::ThreadUtil::selfIdAsUint64() ==
+                                                  downstream.threadIds()[0]);
+
+            ball::LoggerManager::singleton().setCategory(
+                                                      "TEST.ASYNC",
+                                                      ball::Severity::e_TRACE,
+                                                      ball::Severity::e_INFO,
+                                                      ball::Severity::e_ERROR,
+                                                      ball::Severity::e_OFF);
+
+            BALL_LOG_DEBUG << "buffered" << BALL_LOG_END;
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            BALL_LOG_ERROR << "trigger" << BALL_LOG_END;
+
+            ASSERT(0 == mX.stopPublicationThread());
+
+            // The trigger record is passed through, and then published with
+            // the buffered record (most recent first), between markers.
+
+            const bsl::vector<bsl::string>&               messages =
+                                                        downstream.messages();
+            const bsl::vector<ball::Transmission::Cause>& causes   =
+                                                          downstream.causes();
+
+            ASSERTV(messages.size(), 7 == messages.size());
+            if (veryVerbose) {
+                for (bsl::size_t i = 0; i < messages.size(); ++i) {
+                    P_(i) P_(causes[i]) P(messages[i])
+                }
+            }
+            if (7 == messages.size()) {
+                ASSERT(ball::Transmission::e_PASSTHROUGH == causes[2]);
+                ASSERT("trigger"  == messages[2]);
+                for (int i = 3; i < 7; ++i) {
+                    ASSERTV(i, ball::Transmission::e_TRIGGER == causes[i]);
+                }
+                ASSERT(0 == messages[3].find("--- BEGIN"));
+                ASSERT("trigger"  == messages[4]);
+                ASSERT("buffered" == messages[5]);
+                ASSERT(0 == messages[6].find("--- END"));
+            }
+
+            ASSERT(0 == X.numDroppedRecords());
+        }
+        ASSERT(1 == downstream.numReleases());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 The records published concurrently by several threads are all
+        //:   published to the downstream observer.
+        //:
+        //: 2 The records published by a thread are published to the
+        //:   downstream observer in the order in which they were published.
+        //:
+        //: 3 No record is dropped if the overflow policy is 'e_BLOCK'.
+        //
+        // Plan:
+        //: 1 With small rings and the 'e_BLOCK' policy, publish a sequence of
+        //:   numbered records from each of several threads, while the
+        //:   publication thread is running.  Verify that the downstream
+        //:   observer received every record, in order for each thread.
+        //:   (C-1..3)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_THREADS = 8;
+        const int NUM_RECORDS = 10000;
+        const int CAPACITIES[] = { 1, 4, 64 };
+
+        for (int ci = 0; ci < 3; ++ci) {
+            const int CAPACITY = CAPACITIES[ci];
+
+            if (veryVerbose) { P(CAPACITY) }
+
+            RecordingObserver downstream;
+            downstream.reserve(NUM_THREADS * NUM_RECORDS);
+
+            Obj mX(&downstream, CAPACITY, Obj::e_BLOCK);
+            ASSERT(0 == mX.startPublicationThread());
+
+            bslmt::ThreadGroup threadGroup;
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                threadGroup.addThread(bdlf::BindUtil::bind(&publishSequence,
+                                                           &mX,
+                                                           i,
+                                                           NUM_RECORDS));
+            }
+            threadGroup.joinAll();
+
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERT(0 == mX.numDroppedRecords());
+
+            const bsl::vector<bsl::string>& messages = downstream.messages();
+            ASSERTV(messages.size(),
+                    NUM_THREADS * NUM_RECORDS == (int)messages.size());
+
+            bsl::vector<int> next(NUM_THREADS, 0);
+            for (bsl::size_t i = 0; i < messages.size(); ++i) {
+                int threadIndex;
+                int value;
+                ASSERT(2 == bsl::sscanf(messages[i].c_str(),
+                                        "%d:%d",
+                                        &threadIndex,
+                                        &value));
+                ASSERTV(threadIndex, 0 <= threadIndex
+                                  && threadIndex < NUM_THREADS);
+                ASSERTV(threadIndex,
+                        value,
+                        next[threadIndex],
+                        next[threadIndex] == value);
+                next[threadIndex] = value + 1;
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // MEMORY ALLOCATION AND RING RECYCLING
+        //
+        // Concerns:
+        //: 1 Once a thread has published records, 'publish' does not
+        //:   allocate memory (from the observer allocator or from the default
+        //:   allocator), provided that the messages are not longer than the
+        //:   messages previously published.
+        //:
+        //: 2 The records in a ring are not reallocated if the downstream
+        //:   observer does not retain them.
+        //:
+        //: 3 The ring of an exited thread is reused by a thread publishing
+        //:   records later.
+        //:
+        //: 4 All memory is released on destruction.
+        //
+        // Plan:
+        //: 1 Publish a number of records larger than the ring capacity, and
+        //:   verify that the number of allocations does not change when
+        //:   publishing more records of the same size.  (C-1..2)
+        //:
+        //: 2 Publish records from several threads, one after the other, and
+        //:   verify that the memory in use is not larger than after the first
+        //:   thread published.  (C-3)
+        //:
+        //: 3 Verify that no memory is in use after destruction.  (C-4)
+        //
+        // Testing:
+        //   MEMORY ALLOCATION AND RING RECYCLING
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MEMORY ALLOCATION AND RING RECYCLING" << endl
+                          << "====================================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            RecordingObserver downstream;
+            downstream.reserve(4096);
+
+            Obj mX(&downstream, 16, Obj::e_BLOCK, &ta);
+            ASSERT(0 == mX.startPublicationThread());
+
+            bsl::shared_ptr<ball::Record> record;
+            record.createInplace();
+            record->fixedFields().setFileName(__FILE__);
+            record->fixedFields().setCategory("TEST.CATEGORY");
+
+            const ball::Context context(ball::Transmission::e_PASSTHROUGH,
+                                        0,
+                                        1);
+
+            for (int i = 0; i < 64; ++i) {
+                setMessage(record.get(), 100000 + i);
+                mX.publish(record, context);
+            }
+
+            const Int64 NUM_ALLOCATIONS         = ta.numAllocations();
+            const Int64 NUM_DEFAULT_ALLOCATIONS =
+                                             defaultAllocator.numAllocations();
+
+            for (int i = 0; i < 1024; ++i) {
+                record->fixedFields().setMessage("123456");
+                mX.publish(record, context);
+            }
+
+            ASSERTV(NUM_ALLOCATIONS, ta.numAllocations(),
+                    NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERTV(NUM_DEFAULT_ALLOCATIONS, defaultAllocator.numAllocations(),
+                    NUM_DEFAULT_ALLOCATIONS ==
+                                            defaultAllocator.numAllocations());
+
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERT(64 + 1024 == downstream.messages().size());
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+        {
+            // Each slot of the ring allocates a message buffer when it is
+            // first used, so the threads publish enough records to use every
+            // slot before the memory in use is measured.
+
+            RecordingObserver downstream;
+
+            Obj mX(&downstream, 4, Obj::e_BLOCK, &ta);
+            ASSERT(0 == mX.startPublicationThread());
+
+            const int NUM_THREADS = 8;
+
+            for (int round = 0; round < 2; ++round) {
+                const Int64 NUM_BYTES = ta.numBytesInUse();
+
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    bslmt::ThreadUtil::Handle handle;
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                      &handle,
+                                     bdlf::BindUtil::bind(&publishOnce, &mX)));
+                    ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                }
+
+                if (round) {
+                    ASSERTV(NUM_BYTES, ta.numBytesInUse(),
+                            NUM_BYTES == ta.numBytesInUse());
+                }
+            }
+
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERTV(downstream.messages().size(),
+                    2 * NUM_THREADS == (int)downstream.messages().size());
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // OVERFLOW POLICIES
+        //
+        // Concerns:
+        //: 1 With the 'e_DROP' policy, the records published to a full ring
+        //:   are discarded and counted.
+        //:
+        //: 2 With the 'e_DROP_AND_REPORT' policy, the records published to a
+        //:   full ring are discarded and counted, and a warning record
+        //:   reporting their number is published to the downstream observer.
+        //:
+        //: 3 With the 'e_BLOCK' policy, no record is discarded.
+        //:
+        //: 4 The records that were not discarded are published in order.
+        //:
+        //: 5 With the 'e_BLOCK' policy, the records published by the
+        //:   publication thread itself (i.e., by the downstream observer) to
+        //:   a full ring are discarded and counted, instead of blocking that
+        //:   thread forever.
+        //
+        // Plan:
+        //: 1 For each policy, publish more records than the capacity of the
+        //:   ring before starting the publication thread (from another
+        //:   thread for 'e_BLOCK'), and verify the records published, and
+        //:   the value of 'numDroppedRecords'.  (C-1..4)
+        //:
+        //: 2 With the 'e_BLOCK' policy, and a downstream observer publishing,
+        //:   for each record it receives, more records than the capacity of
+        //:   the ring back to the object under test, publish records, and
+        //:   verify that the publication thread can be stopped, and that each
+        //:   record published by the downstream observer was either
+        //:   published or counted by 'numDroppedRecords'.  (C-5)
+        //
+        // Testing:
+        //   OVERFLOW POLICIES
+        //   bsls::Types::Int64 numDroppedRecords() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "OVERFLOW POLICIES" << endl
+                          << "=================" << endl;
+
+        const int CAPACITY    = 8;
+        const int NUM_RECORDS = 20;
+
+        if (verbose) cout << "\t'e_DROP'" << endl;
+        {
+            RecordingObserver downstream;
+            Obj               mX(&downstream, CAPACITY, Obj::e_DROP);
+            const Obj&        X = mX;
+
+            publishSequence(&mX, 0, NUM_RECORDS);
+
+            ASSERTV(X.numDroppedRecords(),
+                    NUM_RECORDS - CAPACITY == X.numDroppedRecords());
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+
+            const bsl::vector<bsl::string>& messages = downstream.messages();
+            ASSERTV(messages.size(), CAPACITY == (int)messages.size());
+            for (int i = 0; i < (int)messages.size(); ++i) {
+                char buffer[32];
+                bsl::sprintf(buffer, "0:%d", i);
+                ASSERTV(i, messages[i], buffer == messages[i]);
+            }
+
+            // Records can be published again once the ring is drained.
+
+            publishSequence(&mX, 1, 1);
+            ASSERT(NUM_RECORDS - CAPACITY == X.numDroppedRecords());
+        }
+
+        if (verbose) cout << "\t'e_DROP_AND_REPORT'" << endl;
+        {
+            RecordingObserver downstream;
+            Obj mX(&downstream, CAPACITY, Obj::e_DROP_AND_REPORT);
+            const Obj& X = mX;
+
+            publishSequence(&mX, 0, NUM_RECORDS);
+
+            ASSERT(NUM_RECORDS - CAPACITY == X.numDroppedRecords());
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+
+            const bsl::vector<bsl::string>& messages = downstream.messages();
+            ASSERTV(messages.size(), CAPACITY + 1 == (int)messages.size());
+            if (CAPACITY + 1 == (int)messages.size()) {
+                ASSERTV(messages.back(),
+                        "Dropped 12 log records." == messages.back());
+            }
+
+            // Dropped records are reported once.
+
+            ASSERT(0 == mX.startPublicationThread());
+            publishSequence(&mX, 1, 1);
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERTV(messages.size(), CAPACITY + 2 == (int)messages.size());
+        }
+
+        if (verbose) cout << "\t'e_BLOCK'" << endl;
+        {
+            RecordingObserver downstream;
+            Obj               mX(&downstream, CAPACITY, Obj::e_BLOCK);
+            const Obj&        X = mX;
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                        &handle,
+                                        bdlf::BindUtil::bind(&publishSequence,
+                                                             &mX,
+                                                             0,
+                                                             NUM_RECORDS)));
+
+            // Let the publishing thread fill its ring, and block.
+
+            bslmt::ThreadUtil::microSleep(10000);
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(0 == mX.stopPublicationThread());
+
+            ASSERT(0 == X.numDroppedRecords());
+
+            const bsl::vector<bsl::string>& messages = downstream.messages();
+            ASSERTV(messages.size(), NUM_RECORDS == (int)messages.size());
+            for (int i = 0; i < (int)messages.size(); ++i) {
+                char buffer[32];
+                bsl::sprintf(buffer, "0:%d", i);
+                ASSERTV(i, messages[i], buffer == messages[i]);
+            }
+        }
+
+        if (verbose) cout << "\t'e_BLOCK' from the publication thread"
+                          << endl;
+        {
+            const int NUM_ECHOES   = 2 * CAPACITY;
+            const int NUM_ORIGINAL = 5;
+
+            ReentrantObserver downstream(NUM_ECHOES);
+            Obj               mX(&downstream, CAPACITY, Obj::e_BLOCK);
+            const Obj&        X = mX;
+
+            downstream.setObserver(&mX);
+
+            ASSERT(0 == mX.startPublicationThread());
+            publishSequence(&mX, 0, NUM_ORIGINAL);
+            ASSERT(0 == mX.stopPublicationThread());
+
+            // Publish the records echoed while the thread was stopping.
+
+            ASSERT(0 == mX.startPublicationThread());
+            ASSERT(0 == mX.stopPublicationThread());
+
+            const int numReceived = downstream.numEchoesReceived();
+
+            ASSERTV(numReceived, CAPACITY <= numReceived);
+            ASSERTV(numReceived, X.numDroppedRecords(),
+                    NUM_ECHOES * NUM_ORIGINAL ==
+                                          numReceived + X.numDroppedRecords());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // PUBLISH AND RELEASE RECORDS
+        //
+        // Concerns:
+        //: 1 Both 'publish' overloads copy the supplied record, so that the
+        //:   supplied record can be modified as soon as 'publish' returns.
+        //:
+        //: 2 The fields of the record and the context are published
+        //:   unchanged.
+        //:
+        //: 3 A record retained by the downstream observer is never modified.
+        //:
+        //: 4 'releaseRecords' invokes 'releaseRecords' on the downstream
+        //:   observer.
+        //:
+        //: 5 While the publication thread is running, 'releaseRecords' is
+        //:   forwarded to the downstream observer by the publication thread,
+        //:   and returns once the downstream observer released its records.
+        //:
+        //: 6 The downstream observer is never invoked concurrently, even if
+        //:   'releaseRecords' is invoked while records are being published.
+        //
+        // Plan:
+        //: 1 Publish records with both overloads, modifying the supplied
+        //:   record after each call, and verify the records published.
+        //:   (C-1..2)
+        //:
+        //: 2 Publish, with a downstream observer retaining the records, more
+        //:   records than the capacity of the ring, and verify the retained
+        //:   records.  (C-3)
+        //:
+        //: 3 Invoke 'releaseRecords', and verify that the downstream observer
+        //:   released the records.  (C-4)
+        //:
+        //: 4 Invoke 'releaseRecords' while the publication thread is running,
+        //:   and verify that the downstream observer released the records,
+        //:   from the thread publishing the records, before the call
+        //:   returned.  (C-5)
+        //:
+        //: 5 Invoke 'releaseRecords' repeatedly while another thread publishes
+        //:   records, and verify that the invocations of the downstream
+        //:   observer never overlapped.  (C-6)
+        //
+        // Testing:
+        //   void publish(const Record& record, const Context& context);
+        //   void publish(const shared_ptr<const Record>&, const Context&);
+        //   void releaseRecords();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PUBLISH AND RELEASE RECORDS" << endl
+                          << "===========================" << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+        {
+            RecordingObserver downstream(true, &ta);
+            Obj               mX(&downstream, 4, Obj::e_BLOCK, &ta);
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            ball::Record record(&ta);
+            record.fixedFields().setFileName("file.cpp");
+            record.fixedFields().setLineNumber(42);
+            record.fixedFields().setCategory("CATEGORY");
+            record.fixedFields().setSeverity(ball::Severity::e_ERROR);
+            record.fixedFields().setThreadID(17);
+            record.fixedFields().setProcessID(23);
+
+            bsl::shared_ptr<ball::Record> sharedRecord;
+            sharedRecord.createInplace(&ta, record, &ta);
+
+            const int NUM_RECORDS = 20;
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                const ball::Context context(ball::Transmission::e_TRIGGER,
+                                            i,
+                                            NUM_RECORDS);
+                if (i % 2) {
+                    setMessage(&record, i);
+                    mX.publish(record, context);
+                    setMessage(&record, -1);
+                }
+                else {
+                    setMessage(sharedRecord.get(), i);
+                    mX.publish(sharedRecord, context);
+                    setMessage(sharedRecord.get(), -1);
+                }
+            }
+
+            ASSERT(0 == mX.stopPublicationThread());
+
+            const bsl::vector<bsl::shared_ptr<const ball::Record> >&
+                                              retained = downstream.retained();
+
+            ASSERTV(retained.size(), NUM_RECORDS == (int)retained.size());
+            for (int i = 0; i < (int)retained.size(); ++i) {
+                const ball::RecordAttributes& attributes =
+                                                    retained[i]->fixedFields();
+
+                ASSERTV(i, !bsl::strcmp("file.cpp", attributes.fileName()));
+                ASSERTV(i, 42 == attributes.lineNumber());
+                ASSERTV(i, !bsl::strcmp("CATEGORY", attributes.category()));
+                ASSERTV(i, ball::Severity::e_ERROR == attributes.severity());
+                ASSERTV(i, 17 == attributes.threadID());
+                ASSERTV(i, 23 == attributes.processID());
+
+                bsl::ostringstream os;
+                os << i;
+                ASSERTV(i, attributes.message(),
+                        os.str() == attributes.message());
+
+                ASSERTV(i, ball::Transmission::e_TRIGGER ==
+                                                      downstream.causes()[i]);
+            }
+
+            mX.releaseRecords();
+            ASSERT(1 == downstream.numReleases());
+            ASSERT(0 == downstream.retained().size());
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tReleasing with the thread running." << endl;
+        {
+            RecordingObserver downstream(true, &ta);
+            Obj               mX(&downstream, 4, Obj::e_BLOCK, &ta);
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            publishSequence(&mX, 0, 10);
+
+            mX.releaseRecords();
+
+            ASSERTV(downstream.numReleases(), 1 == downstream.numReleases());
+            ASSERTV(downstream.releasingThread(),
+                    bslmt::ThreadUtil::selfIdAsUint64() !=
+                                                downstream.releasingThread());
+            ASSERTV(downstream.releasingThread(),
+                    downstream.publishingThread(),
+                    downstream.publishingThread() ==
+                                                downstream.releasingThread());
+
+            ASSERT(0 == mX.stopPublicationThread());
+            ASSERT(0 == downstream.numOverlaps());
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+        if (verbose) cout << "\tReleasing while publishing." << endl;
+        {
+            const int NUM_RECORDS  = 20000;
+            const int NUM_RELEASES = 100;
+
+            RecordingObserver downstream(true, &ta);
+            Obj               mX(&downstream, 64, Obj::e_BLOCK, &ta);
+
+            ASSERT(0 == mX.startPublicationThread());
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                                        &handle,
+                                        bdlf::BindUtil::bind(&publishSequence,
+                                                             &mX,
+                                                             0,
+                                                             NUM_RECORDS)));
+
+            for (int i = 0; i < NUM_RELEASES; ++i) {
+                mX.releaseRecords();
+                ASSERTV(i, downstream.numReleases(),
+                        i + 1 == downstream.numReleases());
+            }
+
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+            ASSERT(0 == mX.stopPublicationThread());
+
+            ASSERTV(downstream.messages().size(),
+                    NUM_RECORDS == (int)downstream.messages().size());
+            ASSERTV(downstream.numOverlaps(), 0 == downstream.numOverlaps());
+
+            mX.releaseRecords();
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, ACCESSORS, AND THE PUBLICATION THREAD
+        //
+        // Concerns:
+        //: 1 The constructors set the downstream observer, the ring capacity
+        //:   (rounded up to a power of 2), and the overflow policy, with the
+        //:   documented defaults.
+        //:
+        //: 2 'startPublicationThread' and 'stopPublicationThread' start and
+        //:   stop the publication thread, have no effect if the thread is
+        //:   already in the requested state, and can be invoked repeatedly.
+        //:
+        //: 3 The destructor stops the publication thread, and releases all
+        //:   memory.
+        //:
+        //: 4 The records published before 'stopPublicationThread' is invoked
+        //:   are published before it returns.
+        //
+        // Plan:
+        //: 1 Create objects with both constructors, and verify the
+        //:   accessors.  (C-1)
+        //:
+        //: 2 Start and stop the publication thread repeatedly, publishing a
+        //:   record each time, and verify 'isPublicationThreadRunning', and
+        //:   the records published.  (C-2, 4)
+        //:
+        //: 3 Destroy an object whose publication thread is running, and
+        //:   verify that all memory is released.  (C-3)
+        //
+        // Testing:
+        //   AsyncObserver(Observer *observer, bslma::Allocator *ba = 0);
+        //   AsyncObserver(Observer *, int, OverflowPolicy, Allocator *);
+        //   ~AsyncObserver();
+        //   int startPublicationThread();
+        //   int stopPublicationThread();
+        //   bool isPublicationThreadRunning() const;
+        //   OverflowPolicy overflowPolicy() const;
+        //   int ringCapacity() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, ACCESSORS, AND THE PUBLICATION THREAD"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        bslma::TestAllocator ta("test", veryVeryVerbose);
+
+        RecordingObserver downstream;
+
+        {
+            Obj mX(&downstream, &ta);  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_RING_CAPACITY == X.ringCapacity());
+            ASSERT(Obj::e_DROP_AND_REPORT       == X.overflowPolicy());
+            ASSERT(0                            == X.numDroppedRecords());
+            ASSERT(!X.isPublicationThreadRunning());
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+
+        static const struct {
+            int                 d_line;
+            int                 d_capacity;
+            Obj::OverflowPolicy d_policy;
+            int                 d_expCapacity;
+        } DATA[] = {
+            { L_,    1, Obj::e_DROP,              1 },
+            { L_,    2, Obj::e_DROP_AND_REPORT,   2 },
+            { L_,    3, Obj::e_BLOCK,             4 },
+            { L_,  100, Obj::e_DROP,            128 },
+            { L_, 1024, Obj::e_BLOCK,          1024 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int                 LINE         = DATA[ti].d_line;
+            const int                 CAPACITY     = DATA[ti].d_capacity;
+            const Obj::OverflowPolicy POLICY       = DATA[ti].d_policy;
+            const int                 EXP_CAPACITY = DATA[ti].d_expCapacity;
+
+            Obj mX(&downstream, CAPACITY, POLICY, &ta);  const Obj& X = mX;
+
+            ASSERTV(LINE, EXP_CAPACITY == X.ringCapacity());
+            ASSERTV(LINE, POLICY       == X.overflowPolicy());
+        }
+
+        {
+            Obj mX(&downstream, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 3; ++i) {
+                ASSERT(0     == mX.startPublicationThread());
+                ASSERT(true  == X.isPublicationThreadRunning());
+                ASSERT(0     == mX.startPublicationThread());
+                ASSERT(true  == X.isPublicationThreadRunning());
+
+                publishSequence(&mX, 0, 1);
+
+                ASSERT(0     == mX.stopPublicationThread());
+                ASSERT(false == X.isPublicationThreadRunning());
+                ASSERT(0     == mX.stopPublicationThread());
+
+                ASSERTV(downstream.messages().size(),
+                        i + 1 == (int)downstream.messages().size());
+            }
+
+            ASSERT(0 == mX.startPublicationThread());
+        }
+        ASSERTV(ta.numBytesInUse(), 0 == ta.numBytesInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing.
+        //
+        // Plan:
+        //: 1 Publish a few records, and verify that they are published to the
+        //:   downstream observer.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        RecordingObserver downstream;
+        Obj               mX(&downstream);
+
+        ASSERT(0 == mX.startPublicationThread());
+
+        publishSequence(&mX, 0, 3);
+
+        ASSERT(0 == mX.stopPublicationThread());
+
+        ASSERT(3 == downstream.messages().size());
+        ASSERT("0:0" == downstream.messages()[0]);
+        ASSERT("0:1" == downstream.messages()[1]);
+        ASSERT("0:2" == downstream.messages()[2]);
+        ASSERT(bslmt::ThreadUtil::selfIdAsUint64() ==
+                                                  downstream.threadIds()[0]);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Logging through an 'AsyncObserver' reduces the latency observed
+        //:   by the logging threads compared to publishing synchronously to
+        //:   the observer formatting the records.
+        //
+        // Plan:
+        //: 1 Create a logger manager publishing (with the "Pass" threshold)
+        //:   directly to a 'FormattingObserver', log records from a number of
+        //:   threads, measuring the latency of each 'BALL_LOG_INFO'
+        //:   statement, and report percentiles of the latencies.  Repeat with
+        //:   an 'AsyncObserver' publishing to the 'FormattingObserver'.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: logging latency with and without 'AsyncObserver'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_THREADS = argc > 2 ? atoi(argv[2]) : 2;
+        const int NUM_RECORDS = argc > 3 ? atoi(argv[3]) : 100000;
+
+        // The logger manager singleton can be initialized only once, so the
+        // logger manager publishes to a 'ForwardingObserver' that publishes
+        // either directly to the formatting observer, or to the asynchronous
+        // observer.
+
+        FormattingObserver formattingObserver;
+        Obj                asyncObserver(&formattingObserver,
+                                         4096,
+                                         Obj::e_BLOCK);
+        ForwardingObserver forwardingObserver(&formattingObserver);
+
+        ball::LoggerManagerConfiguration configuration;
+        configuration.setDefaultThresholdLevelsIfValid(ball::Severity::e_OFF,
+                                                       ball::Severity::e_INFO,
+                                                       ball::Severity::e_OFF,
+                                                       ball::Severity::e_OFF);
+
+        ball::LoggerManagerScopedGuard lmGuard(&forwardingObserver,
+                                               configuration);
+
+        for (int mode = 0; mode < 2; ++mode) {
+            if (mode) {
+                forwardingObserver.setObserver(&asyncObserver);
+                asyncObserver.startPublicationThread();
+            }
+
+            const Int64 NUM_PUBLISHED = formattingObserver.numRecords();
+
+            bsl::vector<bsl::vector<Int64> > latencies(NUM_THREADS);
+
+            bslmt::ThreadGroup threadGroup;
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                threadGroup.addThread(bdlf::BindUtil::bind(&measureLatencies,
+                                                           &latencies[i],
+                                                           NUM_RECORDS));
+            }
+            threadGroup.joinAll();
+
+            asyncObserver.stopPublicationThread();
+
+            bsl::vector<Int64> all;
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                all.insert(all.end(),
+                           latencies[i].begin(),
+                           latencies[i].end());
+            }
+            bsl::sort(all.begin(), all.end());
+
+            const bsl::size_t N = all.size();
+            cout << (mode ? "AsyncObserver:     " : "FormattingObserver:")
+                 << " p50 = "     << all[N / 2]
+                 << "ns p90 = "   << all[N * 9 / 10]
+                 << "ns p99 = "   << all[N * 99 / 100]
+                 << "ns p99.9 = " << all[N * 999 / 1000]
+                 << "ns max = "   << all[N - 1]
+                 << "ns (published "
+                 << formattingObserver.numRecords() - NUM_PUBLISHED
+                 << " records)" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------------------------------------------------------
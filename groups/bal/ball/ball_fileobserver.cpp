@@ -22,6 +22,7 @@ BSLS_IDENT_RCSID(ball_fileobserver_cpp,"$Id$ $CSID$")
 #include <ball_multiplexobserver.h>           // for testing only
 
 #include <bslmt_lockguard.h>
+#include <bsls_assert.h>
 
 #include <bsl_cstdio.h>
 #include <bsl_cstring.h>   // for 'bsl::strcmp'
@@ -66,6 +67,7 @@ FileObserver::FileObserver(Severity::Level   stdoutThreshold,
 , d_stdoutLongFormat(DEFAULT_LONG_FORMAT, basicAllocator)
 , d_stdoutShortFormat(DEFAULT_SHORT_FORMAT, basicAllocator)
 , d_fileObserver2(basicAllocator)
+, d_stdoutBatchStreamBuf(basicAllocator)
 {
 }
 
@@ -85,6 +87,7 @@ FileObserver::FileObserver(Severity::Level   stdoutThreshold,
 , d_stdoutLongFormat(DEFAULT_LONG_FORMAT, basicAllocator)
 , d_stdoutShortFormat(DEFAULT_SHORT_FORMAT, basicAllocator)
 , d_fileObserver2(basicAllocator)
+, d_stdoutBatchStreamBuf(basicAllocator)
 {
     if (d_publishInLocalTime) {
         d_fileObserver2.enablePublishInLocalTime();
@@ -205,6 +208,35 @@ void FileObserver::publish(const Record& record, const Context& context)
     d_fileObserver2.publish(record, context);
 }
 
+void FileObserver::publishBatch(const Record *const *records, int numRecords)
+{
+    BSLS_ASSERT(records || 0 == numRecords);
+    BSLS_ASSERT(0 <= numRecords);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    if (Severity::e_OFF != d_stdoutThreshold) {
+        bsl::ostream stream(&d_stdoutBatchStreamBuf);
+
+        for (int i = 0; i < numRecords; ++i) {
+            if (records[i]->fixedFields().severity() <= d_stdoutThreshold) {
+                d_stdoutFormatter(stream, *records[i]);
+            }
+        }
+
+        if (0 < d_stdoutBatchStreamBuf.length()) {
+            bsl::fwrite(d_stdoutBatchStreamBuf.data(),
+                        1,
+                        d_stdoutBatchStreamBuf.length(),
+                        stdout);
+            bsl::fflush(stdout);
+            d_stdoutBatchStreamBuf.pubseekpos(0);
+        }
+    }
+
+    d_fileObserver2.publishBatch(records, numRecords);
+}
+
 void FileObserver::setStdoutThreshold(Severity::Level stdoutThreshold)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
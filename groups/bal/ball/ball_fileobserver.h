@@ -40,6 +40,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableStdoutLoggingPrefix
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setOnFileRotationCallback
@@ -275,6 +276,10 @@ BSLS_IDENT("$Id: $")
 #include <ball_severity.h>
 #endif
 
+#ifndef INCLUDED_BDLSB_MEMOUTSTREAMBUF
+#include <bdlsb_memoutstreambuf.h>
+#endif
+
 #ifndef INCLUDED_BDLT_DATETIMEINTERVAL
 #include <bdlt_datetimeinterval.h>
 #endif
@@ -355,6 +360,12 @@ class FileObserver : public Observer {
     FileObserver2         d_fileObserver2;      // forward most operations
                                                 // this object
 
+    bdlsb::MemOutStreamBuf
+                          d_stdoutBatchStreamBuf;
+                                                // reusable buffer into which
+                                                // 'publishBatch' formats
+                                                // records for 'stdout'
+
   private:
     // NOT IMPLEMENTED
     FileObserver(const FileObserver&);
@@ -509,6 +520,16 @@ class FileObserver : public Observer {
         // 'stdout' if the severity of 'record' is at least as severe as the
         // severity level specified at construction.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Write the specified 'numRecords' log records of the specified
+        // 'records' array, in order, to a file if file logging is enabled for
+        // this file observer, and write those records whose severity is at
+        // least as severe as the 'stdout' threshold to 'stdout'.  The records
+        // written to each destination are formatted into a contiguous buffer
+        // and written with a single call (see 'FileObserver2::publishBatch').
+        // The behavior is undefined unless '0 <= numRecords', and each of the
+        // first 'numRecords' elements of 'records' is a valid address.
+
     void releaseRecords();
         // Discard any shared reference to a 'Record' object that was supplied
         // to the 'publish' method, and is held by this observer.  Note that
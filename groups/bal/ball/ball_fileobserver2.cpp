@@ -50,6 +50,8 @@ BSLS_IDENT_RCSID(ball_fileobserver2_cpp,"$Id$ $CSID$")
 #include <bsl_iostream.h>
 #include <bsl_memory.h>
 #include <bsl_sstream.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_errno.h>
 #include <bsl_c_time.h>
@@ -492,33 +494,89 @@ int FileObserver2::rotateFile(bsl::string *rotatedLogFileName)
     return returnStatus;
 }
 
-int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
-                                     const bdlt::Datetime&  currentLogTimeUtc)
+bool FileObserver2::isRotationDue(
+                                 bsls::Types::Int64    logFileSize,
+                                 const bdlt::Datetime& currentLogTimeUtc) const
 {
     BSLS_ASSERT(d_rotationSize >= 0);
     BSLS_ASSERT(d_rotationInterval.totalSeconds() >= 0);
+
+    // Rotate the log file if either its size could not be determined, or the
+    // rotation size is exceeded.
+
+    const bsls::Types::Uint64 maxSize =
+                       static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024;
+
+    if (d_rotationSize
+     && static_cast<bsls::Types::Uint64>(logFileSize) > maxSize) {
+        return true;                                                  // RETURN
+    }
+
+    return d_rotationInterval.totalSeconds()
+        && d_nextRotationTimeUtc <= currentLogTimeUtc;
+}
+
+int FileObserver2::rotateIfNecessary(bsl::string           *rotatedLogFileName,
+                                     const bdlt::Datetime&  currentLogTimeUtc)
+{
     BSLS_ASSERT(rotatedLogFileName);
 
     if (!d_logStreamBuf.isOpened()) {
         return 1;                                                     // RETURN
     }
 
-    if (d_rotationSize) {
-        // 'tellp' returns -1 on failure.  Rotate the log file if either
-        // 'tellp' fails, or the rotation size is exceeded.
+    // 'tellp' returns -1 on failure, and is called only if the size of the log
+    // file matters.
+
+    const bsls::Types::Int64 logFileSize =
+                  d_rotationSize
+                  ? static_cast<bsls::Types::Int64>(d_logOutStream.tellp())
+                  : 0;
+
+    if (isRotationDue(logFileSize, currentLogTimeUtc)) {
+        return rotateFile(rotatedLogFileName);                        // RETURN
+    }
+    return 1;
+}
+
+int FileObserver2::writeBatchBuffer()
+{
+    BSLS_ASSERT(d_logStreamBuf.isOpened());
+
+    const char *data      = d_batchStreamBuf.data();
+    int         numBytes  = static_cast<int>(d_batchStreamBuf.length());
+    int         rc        = 0;
+
+    // Flush anything the stream buffer holds, so that writing directly to the
+    // file descriptor preserves the order of the output, and the file
+    // position reported by 'tellp' stays accurate.
 
-        if (static_cast<bsls::Types::Uint64>(d_logOutStream.tellp()) >
-            static_cast<bsls::Types::Uint64>(d_rotationSize) * 1024) {
+    d_logOutStream.flush();
 
-            return rotateFile(rotatedLogFileName);                    // RETURN
+    while (d_logOutStream && 0 < numBytes) {
+        const int numWritten = bdls::FilesystemUtil::write(
+                                               d_logStreamBuf.fileDescriptor(),
+                                               data,
+                                               numBytes);
+        if (0 >= numWritten) {
+            rc = -1;
+            break;
         }
+        data     += numWritten;
+        numBytes -= numWritten;
     }
 
-    if (d_rotationInterval.totalSeconds()
-     && d_nextRotationTimeUtc <= currentLogTimeUtc) {
-        return rotateFile(rotatedLogFileName);                        // RETURN
+    d_batchStreamBuf.pubseekpos(0);
+
+    if (0 != rc || !d_logOutStream) {
+        fprintf(stderr, "%s Error on file stream for %s: %s\n",
+                errorMsgPrefix,
+                d_logFileName.c_str(), bsl::strerror(getErrorCode()));
+
+        d_logStreamBuf.clear();
+        return -1;                                                    // RETURN
     }
-    return 1;
+    return 0;
 }
 
 // CREATORS
@@ -536,6 +594,7 @@ FileObserver2::FileObserver2(bslma::Allocator *basicAllocator)
 , d_rotationInterval(0)
 , d_onRotationCb()
 , d_rotationCbMutex()
+, d_batchStreamBuf(basicAllocator)
 {
 }
 
@@ -682,6 +741,86 @@ void FileObserver2::publish(const Record& record, const Context&)
     }
 }
 
+void FileObserver2::publishBatch(const Record *const *records,
+                                 int                  numRecords)
+{
+    BSLS_ASSERT(records || 0 == numRecords);
+    BSLS_ASSERT(0 <= numRecords);
+
+    // Rotations are rare, so the (allocating) list of rotation results is
+    // populated only when one occurs.
+
+    bsl::vector<bsl::pair<int, bsl::string> > rotations;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        if (!d_logStreamBuf.isOpened()) {
+            return;                                                   // RETURN
+        }
+
+        bsl::ostream batchStream(&d_batchStreamBuf);
+
+        // 'tellp' is called once per batch (and after each rotation) rather
+        // than once per record; the size of the log file is then tracked by
+        // adding the length of the records formatted so far.
+
+        bsls::Types::Int64 logFileSize =
+                  d_rotationSize
+                  ? static_cast<bsls::Types::Int64>(d_logOutStream.tellp())
+                  : 0;
+
+        for (int i = 0; i < numRecords; ++i) {
+            const Record& record = *records[i];
+
+            const bsls::Types::Int64 batchSize = d_batchStreamBuf.length();
+
+            if (isRotationDue(0 > logFileSize ? logFileSize
+                                              : logFileSize + batchSize,
+                              record.fixedFields().timestamp())) {
+                if (0 < batchSize && 0 != writeBatchBuffer()) {
+                    break;
+                }
+
+                bsl::string rotatedFileName;
+                const int   rotationStatus = rotateFile(&rotatedFileName);
+
+                rotations.push_back(bsl::make_pair(rotationStatus,
+                                                   rotatedFileName));
+
+                if (!d_logStreamBuf.isOpened()) {
+                    break;
+                }
+
+                logFileSize =
+                  d_rotationSize
+                  ? static_cast<bsls::Types::Int64>(d_logOutStream.tellp())
+                  : 0;
+            }
+
+            d_logFileFunctor(batchStream, record);
+        }
+
+        if (d_logStreamBuf.isOpened() && 0 < d_batchStreamBuf.length()) {
+            writeBatchBuffer();
+        }
+
+        d_batchStreamBuf.pubseekpos(0);
+    }
+
+    // The file-rotation callback must be invoked without a lock on 'd_mutex'
+    // to allow the callback to invoke other manipulators on this object.
+
+    if (!rotations.empty()) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_rotationCbMutex);
+        if (d_onRotationCb) {
+            for (bsl::size_t i = 0; i < rotations.size(); ++i) {
+                d_onRotationCb(rotations[i].first, rotations[i].second);
+            }
+        }
+    }
+}
+
 void FileObserver2::rotateOnLifetime(
                                     const bdlt::DatetimeInterval& timeInterval)
 {
@@ -39,6 +39,7 @@ BSLS_IDENT("$Id: $")
 //                         |              enableFileLogging
 //                         |              enablePublishInLocalTime
 //                         |              forceRotation
+//                         |              publishBatch
 //                         |              rotateOnSize
 //                         |              rotateOnTimeInterval
 //                         |              setLogFileFunctor
@@ -62,6 +63,11 @@ BSLS_IDENT("$Id: $")
 // below).  In addition, a file observer may be configured to perform automatic
 // log file rotation (see "Log File Rotation" below).
 //
+// Records can also be written in batches using the 'publishBatch' method,
+// which formats a sequence of records into a single buffer and writes that
+// buffer to the log file with one system call (see "Batched Publication"
+// below).
+//
 ///Log Record Formatting
 ///---------------------
 // By default, the output format of published log records is:
@@ -166,6 +172,20 @@ BSLS_IDENT("$Id: $")
 // Note that timestamp pattern elements in a log file name are typically
 // selected so they produce unique names for each rotation.
 //
+///Batched Publication
+///-------------------
+// Each call to 'publish' formats one record directly into the stream of the
+// log file, and flushes that stream, which costs one 'write' system call per
+// record.  A client that has several records at hand, such as the publication
+// thread of 'ball::AsyncFileObserver', can instead call 'publishBatch'.  That
+// method formats all the records into a contiguous buffer owned by the file
+// observer, and writes the buffer to the log file in one system call.  The
+// buffer is reused, so its memory is allocated only while it grows to the
+// size of the largest batch.  Rotation rules are applied per record, exactly
+// as for 'publish'; when a rotation is due in the middle of a batch, the
+// records formatted so far are written to the old log file before it is
+// rotated.
+//
 ///Thread Safety
 ///-------------
 // All methods of 'ball::FileObserver2' are thread-safe, and can be called
@@ -225,6 +245,10 @@ BSLS_IDENT("$Id: $")
 #include <bdls_fdstreambuf.h>
 #endif
 
+#ifndef INCLUDED_BDLSB_MEMOUTSTREAMBUF
+#include <bdlsb_memoutstreambuf.h>
+#endif
+
 #ifndef INCLUDED_BDLT_DATETIME
 #include <bdlt_datetime.h>
 #endif
@@ -249,6 +273,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmt_mutex.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_BSL_FSTREAM
 #include <bsl_fstream.h>
 #endif
@@ -368,6 +396,10 @@ class FileObserver2 : public Observer {
                                                        // called with 'd_mutex'
                                                        // unlocked
 
+    bdlsb::MemOutStreamBuf d_batchStreamBuf;           // reusable buffer into
+                                                       // which 'publishBatch'
+                                                       // formats records
+
   private:
     // NOT IMPLEMENTED
     FileObserver2(const FileObserver2&);
@@ -389,6 +421,15 @@ class FileObserver2 : public Observer {
         // filename, as determined by the 'logFilenamePattern' of latest call
         // to 'enableFileLogging', is the same as the old log filename.
 
+    bool isRotationDue(bsls::Types::Int64    logFileSize,
+                       const bdlt::Datetime& currentLogTimeUtc) const;
+        // Return 'true' if a log file having the specified 'logFileSize' (in
+        // bytes) must be rotated before a record having the specified
+        // 'currentLogTimeUtc' timestamp is written to it, and 'false'
+        // otherwise.  A negative 'logFileSize' indicates that the size of the
+        // log file could not be determined.  The behavior is undefined unless
+        // the caller acquired the lock for this object.
+
     int rotateIfNecessary(bsl::string           *rotatedLogFileName,
                           const bdlt::Datetime&  currentLogTimeUtc);
         // Perform log file rotation if the specified 'currentLogTimeUtc' is
@@ -402,6 +443,14 @@ class FileObserver2 : public Observer {
         // and the 'rotateOnSize' methods respectively.  The behavior is
         // undefined unless the caller acquired the lock for this object.
 
+    int writeBatchBuffer();
+        // Write the records formatted into the batch buffer of this file
+        // observer to the log file, with as few system calls as possible, and
+        // empty the batch buffer.  Return 0 on success, and a non-zero value
+        // otherwise, in which case file logging is disabled.  The behavior is
+        // undefined unless the caller acquired the lock for this object, and
+        // file logging is enabled.
+
   public:
     // TRAITS
     BSLMF_NESTED_TRAIT_DECLARATION(FileObserver2, bslma::UsesBslmaAllocator);
@@ -514,6 +563,19 @@ class FileObserver2 : public Observer {
         // a file if file logging is enabled for this file observer.  The
         // method has no effect if file logging is not enabled.
 
+    void publishBatch(const Record *const *records, int numRecords);
+        // Write the specified 'numRecords' log records of the specified
+        // 'records' array, in order, to a file if file logging is enabled for
+        // this file observer.  The records are formatted into a contiguous
+        // buffer that is reused across calls, and the buffer is written to
+        // the log file with a single system call (barring partial writes),
+        // rather than one per record as 'publish' does.  If the log file must
+        // be rotated before one of the records is written, the records that
+        // precede it are first written to the current log file.  The method
+        // has no effect if file logging is not enabled.  The behavior is
+        // undefined unless '0 <= numRecords', and each of the first
+        // 'numRecords' elements of 'records' is a valid address.
+
     void releaseRecords();
         // Discard any shared reference to a 'Record' object that was supplied
         // to the 'publish' method, and is held by this observer.  Note that
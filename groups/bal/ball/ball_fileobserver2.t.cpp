@@ -56,6 +56,7 @@
 #include <bsl_iomanip.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_vector.h>
 
 #include <bsl_c_stdio.h>  // tempname()
 
@@ -101,6 +102,7 @@ using bsl::flush;
 // [ 1] int enableFileLogging(const char *fileName, bool timestampFlag = false)
 // [ 1] void enablePublishInLocalTime()
 // [ 1] void publish(const ball::Record& record, const ball::Context& context)
+// [13] void publishBatch(const ball::Record *const *records, int numRecords);
 // [ 2] void forceRotation()
 // [ 2] void rotateOnSize(int size)
 // [ 9] void rotateOnTimeInterval(const bdlt::DatetimeInterval& interval);
@@ -508,6 +510,13 @@ void publishRecord(Obj *mX, const char *message)
 }
 
 
+void logMessage(bsl::ostream& stream, const ball::Record& record)
+    // Write the message of the specified 'record', followed by a newline, to
+    // the specified 'stream'.
+{
+    stream << record.fixedFields().message() << '\n';
+}
+
 int getNumLines(const char *filename)
 {
     bsl::ifstream fs;
@@ -730,6 +739,207 @@ int main(int argc, char *argv[])
     bslma::DefaultAllocatorGuard guard(&defaultAllocator);
 
     switch (test) { case 0:
+      case 13: {
+        // --------------------------------------------------------------------
+        // TESTING 'publishBatch'
+        //
+        // Concerns:
+        //: 1 'publishBatch' has no effect if file logging is not enabled.
+        //:
+        //: 2 'publishBatch' writes the records, in order, exactly as a
+        //:   sequence of calls to 'publish' would.
+        //:
+        //: 3 Once the batch buffer has grown to the size of a batch,
+        //:   'publishBatch' allocates no memory.
+        //:
+        //: 4 When the log file must be rotated in the middle of a batch, the
+        //:   records preceding the rotation are written to the rotated file,
+        //:   the remaining records are written to the new log file, and the
+        //:   rotation callback is invoked.
+        //
+        // Plan:
+        //: 1 Call 'publishBatch' on an observer with file logging disabled.
+        //:   (C-1)
+        //:
+        //: 2 Write a batch of records with 'publishBatch' to one file, and
+        //:   with 'publish' to another, and compare the contents of the two
+        //:   files.  (C-2)
+        //:
+        //: 3 Publish the batch a second time, and verify that neither the
+        //:   object allocator nor the default allocator is used.  (C-3)
+        //:
+        //: 4 Configure a rotation on size of 1K, and publish a batch of six
+        //:   records whose formatted length is 301 bytes.  Verify that the
+        //:   log file was rotated once, before the fifth record, and verify
+        //:   the contents of both files.  (C-4)
+        //
+        // Testing:
+        //   void publishBatch(const Record *const *records, int numRecords);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'publishBatch'"
+                          << "\n======================" << endl;
+
+        enum { k_NUM_RECORDS = 100 };
+
+        bslma::TestAllocator ta("ta", veryVeryVeryVerbose);
+
+        bsl::vector<bsl::shared_ptr<ball::Record> > records(&ta);
+        bsl::vector<const ball::Record *>           recordAddresses(&ta);
+
+        for (int i = 0; i < k_NUM_RECORDS; ++i) {
+            bsl::ostringstream oss;
+            oss << "message " << i;
+
+            ball::RecordAttributes attr(bdlt::CurrentTime::utc(),
+                                        1,
+                                        2,
+                                        "FILENAME",
+                                        3,
+                                        "CATEGORY",
+                                        ball::Severity::e_WARN,
+                                        oss.str().c_str(),
+                                        &ta);
+
+            records.push_back(bsl::allocate_shared<ball::Record>(
+                                                         &ta,
+                                                         attr,
+                                                         ball::UserFields()));
+            recordAddresses.push_back(records.back().get());
+        }
+
+        if (verbose) cout << "\tFile logging disabled." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(!X.isFileLoggingEnabled());
+
+            mX.publishBatch(&recordAddresses.front(), k_NUM_RECORDS);
+            mX.publishBatch(0, 0);
+
+            ASSERT(!X.isFileLoggingEnabled());
+        }
+
+        if (verbose) cout << "\tBatches match individual records." << endl;
+        {
+            const bsl::string BATCH_FILE      = tempFileName(veryVerbose);
+            const bsl::string INDIVIDUAL_FILE = tempFileName(veryVerbose);
+
+            Obj mB(&ta);
+            Obj mI(&ta);
+
+            ASSERT(0 == mB.enableFileLogging(BATCH_FILE.c_str()));
+            ASSERT(0 == mI.enableFileLogging(INDIVIDUAL_FILE.c_str()));
+
+            mB.publishBatch(&recordAddresses.front(), k_NUM_RECORDS);
+
+            const ball::Context context(ball::Transmission::e_PASSTHROUGH,
+                                        0,
+                                        1);
+            for (int i = 0; i < k_NUM_RECORDS; ++i) {
+                mI.publish(*records[i], context);
+            }
+
+            bsl::string batchContent, individualContent;
+            readFileIntoString(__LINE__, BATCH_FILE, batchContent);
+            readFileIntoString(__LINE__, INDIVIDUAL_FILE, individualContent);
+
+            ASSERT(!batchContent.empty());
+            ASSERT(batchContent == individualContent);
+
+            if (verbose) cout << "\tNo allocation after warm-up." << endl;
+
+            const bsls::Types::Int64 NUM_ALLOCATIONS = ta.numAllocations();
+            const bsls::Types::Int64 NUM_DEFAULT_ALLOCATIONS =
+                                             defaultAllocator.numAllocations();
+
+            mB.publishBatch(&recordAddresses.front(), k_NUM_RECORDS);
+
+            ASSERTV(NUM_ALLOCATIONS, ta.numAllocations(),
+                    NUM_ALLOCATIONS == ta.numAllocations());
+            ASSERTV(NUM_DEFAULT_ALLOCATIONS, defaultAllocator.numAllocations(),
+                    NUM_DEFAULT_ALLOCATIONS ==
+                                            defaultAllocator.numAllocations());
+
+            readFileIntoString(__LINE__, BATCH_FILE, batchContent);
+            ASSERT(individualContent + individualContent == batchContent);
+
+            mB.disableFileLogging();
+            mI.disableFileLogging();
+            removeFilesByPrefix(BATCH_FILE.c_str());
+            removeFilesByPrefix(INDIVIDUAL_FILE.c_str());
+        }
+
+        if (verbose) cout << "\tRotation within a batch." << endl;
+        {
+            enum { k_NUM_BATCH_RECORDS = 6, k_MESSAGE_LENGTH = 300 };
+
+            bsl::vector<bsl::shared_ptr<ball::Record> > batch(&ta);
+            bsl::vector<const ball::Record *>           batchAddresses(&ta);
+
+            for (int i = 0; i < k_NUM_BATCH_RECORDS; ++i) {
+                const bsl::string message(k_MESSAGE_LENGTH, 'a' + i, &ta);
+
+                ball::RecordAttributes attr(&ta);
+                attr.setTimestamp(bdlt::CurrentTime::utc());
+                attr.setMessage(message.c_str());
+
+                batch.push_back(bsl::allocate_shared<ball::Record>(
+                                                         &ta,
+                                                         attr,
+                                                         ball::UserFields()));
+                batchAddresses.push_back(batch.back().get());
+            }
+
+            const bsl::string BASENAME = tempFileName(veryVerbose);
+
+            Obj mX(&ta);
+
+            RotCb cb(&ta);
+            mX.setOnFileRotationCallback(cb);
+            mX.setLogFileFunctor(&logMessage);
+            mX.rotateOnSize(1);
+
+            ASSERT(0 == mX.enableFileLogging(BASENAME.c_str()));
+
+            mX.publishBatch(&batchAddresses.front(), k_NUM_BATCH_RECORDS);
+
+            ASSERTV(cb.numInvocations(), 1 == cb.numInvocations());
+            ASSERTV(cb.status(),         0 == cb.status());
+
+            bsl::string rotatedContent, currentContent;
+            {
+                bsl::ifstream fs(cb.rotatedFileName().c_str());
+                bsl::string   line;
+                while (getline(fs, line)) {
+                    rotatedContent += line;
+                    rotatedContent += '\n';
+                }
+            }
+            {
+                bsl::ifstream fs(BASENAME.c_str());
+                bsl::string   line;
+                while (getline(fs, line)) {
+                    currentContent += line;
+                    currentContent += '\n';
+                }
+            }
+
+            bsl::string expectedRotated, expectedCurrent;
+            for (int i = 0; i < k_NUM_BATCH_RECORDS; ++i) {
+                bsl::string& expected = i < 4 ? expectedRotated
+                                              : expectedCurrent;
+                expected += batch[i]->fixedFields().message();
+                expected += '\n';
+            }
+
+            ASSERT(expectedRotated == rotatedContent);
+            ASSERT(expectedCurrent == currentContent);
+
+            mX.disableFileLogging();
+            removeFilesByPrefix(BASENAME.c_str());
+        }
+      } break;
       case 12: {
         // --------------------------------------------------------------------
         // TESTING: Published Records Show Current Local-Time Offset
@@ -248,6 +248,7 @@ Logger::Logger(
            LoggerManagerConfiguration::TriggerMarkers  triggerMarkers,
            bslma::Allocator                           *globalAllocator)
 : d_recordPool(-1, globalAllocator)
+, d_handleAllocator(globalAllocator)
 , d_observer_p(observer)
 , d_recordBuffer_p(recordBuffer)
 , d_populator(populator)
@@ -327,7 +328,7 @@ void Logger::logMessage(const Category&            category,
         d_populator(&record->customFields());
     }
 
-    bsl::shared_ptr<Record> handle(record, &d_recordPool, d_allocator_p);
+    bsl::shared_ptr<Record> handle(record, &d_recordPool, &d_handleAllocator);
 
     if (levels.recordLevel() >= severity) {
         d_recordBuffer_p->pushBack(handle);
@@ -357,7 +358,7 @@ void Logger::logMessage(const Category&            category,
 
             bsl::shared_ptr<Record> handle(marker,
                                            &d_recordPool,
-                                           d_allocator_p);
+                                           &d_handleAllocator);
 
             copyAttributesWithoutMessage(handle.get(), record->fixedFields());
 
@@ -391,7 +392,7 @@ void Logger::logMessage(const Category&            category,
 
             bsl::shared_ptr<Record> handle(marker,
                                            &d_recordPool,
-                                           d_allocator_p);
+                                           &d_handleAllocator);
 
             copyAttributesWithoutMessage(handle.get(), record->fixedFields());
 
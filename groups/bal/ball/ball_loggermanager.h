@@ -878,6 +878,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlcc_objectpool.h>
 #endif
 
+#ifndef INCLUDED_BDLMA_CONCURRENTPOOLALLOCATOR
+#include <bdlma_concurrentpoolallocator.h>
+#endif
+
 #ifndef INCLUDED_BSLMA_ALLOCATOR
 #include <bslma_allocator.h>
 #endif
@@ -941,6 +945,11 @@ class Logger {
     bdlcc::ObjectPool<Record>
                           d_recordPool;         // pool of records
 
+    bdlma::ConcurrentPoolAllocator
+                          d_handleAllocator;    // pool of the representations
+                                                // of the shared pointers to
+                                                // the records
+
     Observer             *d_observer_p;         // holds observer (not owned)
 
     RecordBuffer         *d_recordBuffer_p;     // holds log record buffer
@@ -13,6 +13,28 @@
 // significant performance overhead.  For this reason, the 'operator()' method
 // is implemented by writing the formatted string to a buffer before inserting
 // to a stream.
+//
+// The format specification is parsed once, by 'compileFormat', into a vector
+// of 'Operation' objects; consecutive literal characters (after '\'-escape
+// interpolation) are coalesced into a single operation referring to a range
+// of 'd_literals'.  Formatting a record is then a single pass over that
+// vector.
+//
+// Formatting a timestamp with 'bdlt::Datetime::printToBuffer' or
+// 'bdlt::Iso8601Util::generateRaw' is comparatively expensive, and consecutive
+// records are usually logged within the same second.  The timestamp text
+// preceding the fractional seconds (and, for ISO 8601, the time zone
+// designator following them) is therefore cached in 'd_cache', keyed by the
+// date, second of the day, and time zone offset it was generated for; only
+// the fractional seconds are formatted for each record.  Since 'operator()' is
+// 'const', and may be called concurrently, the cache is guarded by
+// 'd_cacheLock', which is only ever *tried*: a thread that finds the cache in
+// use formats its record using a cache on its own stack.
+//
+// Finally, appending each field to a 'bsl::string' individually is relatively
+// costly, so fields are accumulated in a fixed-size 'OutputBuffer' on the
+// stack that is appended to the result string when full, and when the record
+// has been formatted.
 
 #include <ball_recordstringformatter.h>
 
@@ -30,11 +52,13 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <bdlma_bufferedsequentialallocator.h>
 
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_currenttime.h>
 #include <bdlt_localtimeoffset.h>
 #include <bdlt_iso8601util.h>
 #include <bdlt_iso8601utilconfiguration.h>
 
+#include <bsls_assert.h>
 #include <bsls_platform.h>
 #include <bsls_types.h>
 
@@ -43,7 +67,6 @@ BSLS_IDENT_RCSID(ball_recordstringformatter_cpp,"$Id$ $CSID$")
 #include <bsl_climits.h>   // for 'INT_MAX'
 #include <bsl_cstring.h>   // for 'bsl::strcmp'
 #include <bsl_c_stdlib.h>
-#include <bsl_c_stdio.h>   // for 'snprintf'
 
 #include <bsl_iomanip.h>
 #include <bsl_ostream.h>
@@ -57,46 +80,157 @@ const char *const DEFAULT_FORMAT_SPEC = "\n%d %p:%t %s %f:%l %c %m %u\n";
 
 namespace BloombergLP {
 
+namespace {
+
+                            // ==================
+                            // class OutputBuffer
+                            // ==================
+
+class OutputBuffer {
+    // This class accumulates formatted output in a fixed-size buffer on the
+    // stack, appending it to a string when the buffer is full and on
+    // destruction, so that a formatted record is appended to the string in a
+    // small number of operations.
+
+    // DATA
+    char         d_buffer[512];  // accumulated output
+    int          d_length;       // number of characters in 'd_buffer'
+    bsl::string *d_result_p;     // string to which output is appended (held)
+
+    // NOT IMPLEMENTED
+    OutputBuffer(const OutputBuffer&);
+    OutputBuffer& operator=(const OutputBuffer&);
+
+  public:
+    // CREATORS
+    explicit OutputBuffer(bsl::string *result)
+        // Create an output buffer appending to the specified 'result'.
+    : d_length(0)
+    , d_result_p(result)
+    {
+    }
+
+    ~OutputBuffer()
+        // Append any accumulated output to the string supplied at
+        // construction and destroy this object.
+    {
+        flush();
+    }
+
+    // MANIPULATORS
+    void append(const char *data, bsl::size_t length)
+        // Append the specified 'length' characters starting at the specified
+        // 'data' to this buffer.
+    {
+        if (d_length + length > sizeof d_buffer) {
+            flush();
+            if (length > sizeof d_buffer) {
+                d_result_p->append(data, length);
+                return;                                               // RETURN
+            }
+        }
+        bsl::memcpy(d_buffer + d_length, data, length);
+        d_length += static_cast<int>(length);
+    }
+
+    void append(const char *string)
+        // Append the specified null-terminated 'string' to this buffer.
+    {
+        append(string, bsl::strlen(string));
+    }
+
+    void append(const bsl::string& string)
+        // Append the specified 'string' to this buffer.
+    {
+        append(string.data(), string.length());
+    }
+
+    void flush()
+        // Append any accumulated output to the string supplied at
+        // construction.
+    {
+        d_result_p->append(d_buffer, d_length);
+        d_length = 0;
+    }
+};
+
+}  // close unnamed namespace
+
 // STATIC HELPER FUNCTIONS
-static void appendToString(bsl::string *result, int value)
+static void appendToString(OutputBuffer *output, bsls::Types::Uint64 value)
     // Convert the specified 'value' into ASCII characters and append it to the
-    // specified 'result.
+    // specified 'output'.
 {
-    char buffer[16];
+    char  buffer[24];
+    char *end = buffer + sizeof buffer;
+    char *p   = end;
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    snprintf(buffer, sizeof buffer, "%d", value);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+    do {
+        *--p  = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
 
-    *result += buffer;
+    output->append(p, end - p);
 }
 
-static void appendToString(bsl::string *result, bsls::Types::Uint64 value)
+static void appendToString(OutputBuffer *output, int value)
     // Convert the specified 'value' into ASCII characters and append it to the
-    // specified 'result.
+    // specified 'output'.
 {
-    char buffer[32];
+    if (value < 0) {
+        output->append("-", 1);
+        appendToString(output,
+                       static_cast<bsls::Types::Uint64>(
+                                  -static_cast<bsls::Types::Int64>(value)));
+    }
+    else {
+        appendToString(output, static_cast<bsls::Types::Uint64>(value));
+    }
+}
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
+static void appendFraction(OutputBuffer *output, int value, int numDigits)
+    // Append to the specified 'output' a '.' followed by the specified
+    // non-negative 'value' formatted as exactly the specified 'numDigits'
+    // decimal digits (with leading zeros).
+{
+    char buffer[8];
 
-    snprintf(buffer, sizeof(buffer), "%llu", value);
+    buffer[0] = '.';
+    for (int i = numDigits; i > 0; --i) {
+        buffer[i]  = static_cast<char>('0' + value % 10);
+        value     /= 10;
+    }
+    output->append(buffer, numDigits + 1);
+}
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
+namespace ball {
+
+                // --------------------------------------------
+                // struct RecordStringFormatter::TimestampCache
+                // --------------------------------------------
 
-    *result += buffer;
+// CREATORS
+RecordStringFormatter::TimestampCache::TimestampCache()
+{
+    invalidate();
 }
 
-namespace ball {
+// MANIPULATORS
+void RecordStringFormatter::TimestampCache::invalidate()
+{
+    // Note that 'INT_MIN' is never a valid offset (in minutes), so neither
+    // cached prefix matches any timestamp; the date and second are set so
+    // that no key member is ever read uninitialized.
+
+    d_datetimeDate   = bdlt::Date();
+    d_datetimeSecond = -1;
+    d_datetimeOffset = INT_MIN;
+    d_datetimeLength = 0;
+    d_iso8601Date    = bdlt::Date();
+    d_iso8601Second  = -1;
+    d_iso8601Offset  = INT_MIN;
+    d_iso8601Length  = 0;
+}
 
                         // ---------------------------
                         // class RecordStringFormatter
@@ -110,18 +244,323 @@ const int RecordStringFormatter::k_DISABLE_PUBLISH_IN_LOCALTIME = INT_MIN;
 // appear in practice.  Real values are (always?) less than one day (plus or
 // minus).
 
+// PRIVATE MANIPULATORS
+void RecordStringFormatter::compileFormat()
+{
+    d_program.clear();
+    d_literals.clear();
+
+    d_cache.invalidate();
+
+    const char *iter = d_formatSpec.data();
+    const char *end  = iter + d_formatSpec.length();
+
+    // Each literal character is appended to 'd_literals'; consecutive literal
+    // characters are described by a single 'e_LITERAL' operation.
+
+    Operation literal = { e_LITERAL, 0, 0 };
+
+    while (iter != end) {
+        Field field = e_LITERAL;
+
+        switch (*iter) {
+          case '%': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case '%': {
+                d_literals += '%';
+              } break;
+              case 'd': field = e_DATETIME;          break;
+              case 'D': field = e_DATETIME_MICRO;    break;
+              case 'i': field = e_ISO8601;           break;
+              case 'I': field = e_ISO8601_MILLI;     break;
+              case 'O': field = e_ISO8601_MICRO;     break;
+              case 'p': field = e_PROCESS_ID;        break;
+              case 't': field = e_THREAD_ID;         break;
+              case 's': field = e_SEVERITY;          break;
+              case 'f': field = e_FILENAME;          break;
+              case 'F': field = e_BASENAME;          break;
+              case 'l': field = e_LINE;              break;
+              case 'c': field = e_CATEGORY;          break;
+              case 'm': field = e_MESSAGE;           break;
+              case 'x': field = e_MESSAGE_PRINTABLE; break;
+              case 'X': field = e_MESSAGE_HEX;       break;
+              case 'u': field = e_USER_FIELDS;       break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                d_literals += '%';
+                d_literals += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          case '\\': {
+            if (++iter == end) {
+                break;
+            }
+            switch (*iter) {
+              case 'n': {
+                d_literals += '\n';
+              } break;
+              case 't': {
+                d_literals += '\t';
+              } break;
+              case '\\': {
+                d_literals += '\\';
+              } break;
+              default: {
+                // Undefined: we just output the verbatim characters.
+
+                d_literals += '\\';
+                d_literals += *iter;
+              }
+            }
+            ++iter;
+          } break;
+          default: {
+            d_literals += *iter;
+            ++iter;
+          }
+        }
+
+        if (e_LITERAL != field) {
+            literal.d_length = static_cast<int>(d_literals.length())
+                             - literal.d_offset;
+            if (literal.d_length) {
+                d_program.push_back(literal);
+            }
+            literal.d_offset = static_cast<int>(d_literals.length());
+
+            Operation operation = { field, 0, 0 };
+            d_program.push_back(operation);
+        }
+    }
+
+    literal.d_length = static_cast<int>(d_literals.length()) -
+                                                              literal.d_offset;
+    if (literal.d_length) {
+        d_program.push_back(literal);
+    }
+}
+
+// PRIVATE ACCESSORS
+void RecordStringFormatter::formatRecord(bsl::string    *result,
+                                         const Record&   record,
+                                         TimestampCache *cache) const
+{
+    const RecordAttributes& fixedFields = record.fixedFields();
+    bdlt::DatetimeInterval  offset;
+
+    if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
+                                       d_timestampOffset.totalMilliseconds()) {
+        bsls::Types::Int64 localTimeOffsetInSeconds =
+            bdlt::LocalTimeOffset::localTimeOffset(
+                                       fixedFields.timestamp()).totalSeconds();
+        offset.setTotalSeconds(localTimeOffsetInSeconds);
+    } else if (k_DISABLE_PUBLISH_IN_LOCALTIME !=
+                                       d_timestampOffset.totalMilliseconds()) {
+        offset = d_timestampOffset;
+    }
+
+    const int            offsetInMinutes =
+                                     static_cast<int>(offset.totalMinutes());
+    const bdlt::Datetime timestamp = fixedFields.timestamp() + offset;
+
+    // Step through the compiled format, outputting the required elements.
+
+    OutputBuffer output(result);
+
+    const Operation *iter = d_program.data();
+    const Operation *end  = iter + d_program.size();
+
+    for (; iter != end; ++iter) {
+        switch (iter->d_field) {
+          case e_LITERAL: {
+            output.append(d_literals.data() + iter->d_offset,
+                          iter->d_length);
+          } break;
+          case e_DATETIME:                                      // FALL THROUGH
+          case e_DATETIME_MICRO: {
+            int hour, minute, second, millisecond, microsecond;
+            timestamp.getTime(&hour,
+                              &minute,
+                              &second,
+                              &millisecond,
+                              &microsecond);
+
+            const int secondOfDay = (hour * 60 + minute) * 60 + second;
+
+            if (cache->d_datetimeSecond != secondOfDay
+             || cache->d_datetimeOffset != offsetInMinutes
+             || cache->d_datetimeDate   != timestamp.date()) {
+                cache->d_datetimeLength = timestamp.printToBuffer(
+                                                   cache->d_datetime,
+                                                   sizeof cache->d_datetime,
+                                                   0);
+                cache->d_datetimeDate   = timestamp.date();
+                cache->d_datetimeSecond = secondOfDay;
+                cache->d_datetimeOffset = offsetInMinutes;
+            }
+
+            output.append(cache->d_datetime, cache->d_datetimeLength);
+
+            if (e_DATETIME == iter->d_field) {
+                appendFraction(&output, millisecond, 3);
+            }
+            else {
+                appendFraction(&output, millisecond * 1000 + microsecond, 6);
+            }
+          } break;
+          case e_ISO8601:                                       // FALL THROUGH
+          case e_ISO8601_MILLI:                                 // FALL THROUGH
+          case e_ISO8601_MICRO: {
+            // Use ISO8601 "extended" format.  The cached prefix holds the
+            // timestamp without fractional seconds, the first
+            // 'k_DECIMAL_SIGN_OFFSET' characters of which precede the decimal
+            // sign; the remainder is the time zone designator.
+
+            enum { k_DECIMAL_SIGN_OFFSET = 19 };
+
+            int hour, minute, second, millisecond, microsecond;
+            timestamp.getTime(&hour,
+                              &minute,
+                              &second,
+                              &millisecond,
+                              &microsecond);
+
+            const int secondOfDay = (hour * 60 + minute) * 60 + second;
+
+            if (cache->d_iso8601Second != secondOfDay
+             || cache->d_iso8601Offset != offsetInMinutes
+             || cache->d_iso8601Date   != timestamp.date()) {
+                bdlt::Iso8601UtilConfiguration config;
+                config.setFractionalSecondPrecision(0);
+                config.setUseZAbbreviationForUtc(true);
+
+                cache->d_iso8601Length = bdlt::Iso8601Util::generateRaw(
+                                   cache->d_iso8601,
+                                   bdlt::DatetimeTz(timestamp,
+                                                    offsetInMinutes),
+                                   config);
+                cache->d_iso8601Date   = timestamp.date();
+                cache->d_iso8601Second = secondOfDay;
+                cache->d_iso8601Offset = offsetInMinutes;
+            }
+
+            output.append(cache->d_iso8601, k_DECIMAL_SIGN_OFFSET);
+
+            if (e_ISO8601_MILLI == iter->d_field) {
+                appendFraction(&output, millisecond, 3);
+            }
+            else if (e_ISO8601_MICRO == iter->d_field) {
+                appendFraction(&output, millisecond * 1000 + microsecond, 6);
+            }
+
+            output.append(cache->d_iso8601 + k_DECIMAL_SIGN_OFFSET,
+                          cache->d_iso8601Length - k_DECIMAL_SIGN_OFFSET);
+          } break;
+          case e_PROCESS_ID: {
+            appendToString(&output, fixedFields.processID());
+          } break;
+          case e_THREAD_ID: {
+            appendToString(&output, fixedFields.threadID());
+          } break;
+          case e_SEVERITY: {
+            output.append(Severity::toAscii(
+                                 (Severity::Level)fixedFields.severity()));
+          } break;
+          case e_FILENAME: {
+            output.append(fixedFields.fileName());
+          } break;
+          case e_BASENAME: {
+            const bsl::string& filename = fixedFields.fileName();
+            const char        *begin    = filename.data();
+            const char        *basename = begin + filename.length();
+
+            while (basename != begin) {
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+                if ('\\' == basename[-1]) {
+#else
+                if ('/' == basename[-1]) {
+#endif
+                    break;
+                }
+                --basename;
+            }
+            output.append(basename, begin + filename.length() - basename);
+          } break;
+          case e_LINE: {
+            appendToString(&output, fixedFields.lineNumber());
+          } break;
+          case e_CATEGORY: {
+            output.append(fixedFields.category());
+          } break;
+          case e_MESSAGE: {
+            bslstl::StringRef message = fixedFields.messageRef();
+            output.append(message.data(), message.length());
+          } break;
+          case e_MESSAGE_PRINTABLE: {
+            bsl::stringstream ss;
+            int length = static_cast<int>(
+                                      fixedFields.messageStreamBuf().length());
+            bdlb::Print::printString(ss,
+                                     fixedFields.message(),
+                                     length,
+                                     false);
+            output.append(ss.str());
+          } break;
+          case e_MESSAGE_HEX: {
+            bsl::stringstream ss;
+            int length = static_cast<int>(
+                                      fixedFields.messageStreamBuf().length());
+            bdlb::Print::singleLineHexDump(ss,
+                                           fixedFields.message(),
+                                           length);
+            output.append(ss.str());
+          } break;
+          case e_USER_FIELDS: {
+            typedef ball::UserFields Values;
+            const Values& customFields = record.customFields();
+            const int numCustomFields  = customFields.length();
+
+            if (numCustomFields > 0) {
+                bsl::stringstream ss;
+                Values::ConstIterator it = customFields.begin();
+                ss << *it;
+                ++it;
+                for (; it != customFields.end(); ++it) {
+                    ss << " " << *it;
+                }
+                output.append(ss.str());
+            }
+          } break;
+        }
+    }
+}
+
 // CREATORS
 RecordStringFormatter::RecordStringFormatter(bslma::Allocator *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(0)
+, d_literals(basicAllocator)
+, d_program(basicAllocator)
+, d_cacheLock(0)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(const char       *format,
                                              bslma::Allocator *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(0)
+, d_literals(basicAllocator)
+, d_program(basicAllocator)
+, d_cacheLock(0)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -129,7 +568,11 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(DEFAULT_FORMAT_SPEC, basicAllocator)
 , d_timestampOffset(offset)
+, d_literals(basicAllocator)
+, d_program(basicAllocator)
+, d_cacheLock(0)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -143,7 +586,11 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_literals(basicAllocator)
+, d_program(basicAllocator)
+, d_cacheLock(0)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -152,7 +599,11 @@ RecordStringFormatter::RecordStringFormatter(
                                  bslma::Allocator              *basicAllocator)
 : d_formatSpec(format, basicAllocator)
 , d_timestampOffset(offset)
+, d_literals(basicAllocator)
+, d_program(basicAllocator)
+, d_cacheLock(0)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -167,7 +618,11 @@ RecordStringFormatter::RecordStringFormatter(
                     publishInLocalTime
                     ?  k_ENABLE_PUBLISH_IN_LOCALTIME
                     : k_DISABLE_PUBLISH_IN_LOCALTIME)
+, d_literals(basicAllocator)
+, d_program(basicAllocator)
+, d_cacheLock(0)
 {
+    compileFormat();
 }
 
 RecordStringFormatter::RecordStringFormatter(
@@ -175,7 +630,11 @@ RecordStringFormatter::RecordStringFormatter(
                                   bslma::Allocator             *basicAllocator)
 : d_formatSpec(original.d_formatSpec, basicAllocator)
 , d_timestampOffset(original.d_timestampOffset)
+, d_literals(basicAllocator)
+, d_program(basicAllocator)
+, d_cacheLock(0)
 {
+    compileFormat();
 }
 
 // MANIPULATORS
@@ -185,38 +644,23 @@ RecordStringFormatter& RecordStringFormatter::operator=(
     if (this != &rhs) {
         d_formatSpec      = rhs.d_formatSpec;
         d_timestampOffset = rhs.d_timestampOffset;
+        compileFormat();
     }
 
     return *this;
 }
 
+void RecordStringFormatter::setFormat(const char *format)
+{
+    d_formatSpec = format;
+    compileFormat();
+}
+
 // ACCESSORS
 void RecordStringFormatter::operator()(bsl::ostream& stream,
                                        const Record& record) const
 
 {
-    const RecordAttributes& fixedFields = record.fixedFields();
-    bdlt::DatetimeInterval  offset;
-
-    if (k_ENABLE_PUBLISH_IN_LOCALTIME ==
-                                       d_timestampOffset.totalMilliseconds()) {
-        bsls::Types::Int64 localTimeOffsetInSeconds =
-            bdlt::LocalTimeOffset::localTimeOffset(
-                                       fixedFields.timestamp()).totalSeconds();
-        offset.setTotalSeconds(localTimeOffsetInSeconds);
-    } else if (k_DISABLE_PUBLISH_IN_LOCALTIME !=
-                                       d_timestampOffset.totalMilliseconds()) {
-        offset = d_timestampOffset;
-    }
-
-    bdlt::DatetimeTz timestamp(fixedFields.timestamp() + offset,
-                               static_cast<int>(offset.totalMinutes()));
-
-    // Step through the format string, outputting the required elements.
-
-    const char* iter = d_formatSpec.data();
-    const char* end  = iter + d_formatSpec.length();
-
     // Create a buffer on the stack for formatting the record.  Note that the
     // size of the buffer should be slightly larger than the amount we reserve
     // in order to ensure only a single allocation occurs.
@@ -231,183 +675,29 @@ void RecordStringFormatter::operator()(bsl::ostream& stream,
     bsl::string output(&stringAllocator);
     output.reserve(STRING_RESERVATION);
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define snprintf _snprintf
-#endif
-
-    while (iter != end) {
-        switch (*iter) {
-          case '%': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case '%': {
-                output += '%';
-              } break;
-              case 'd': // fall through intentionally
-              case 'D': {
-                const int fractionalSecondPrecision = 'd' == *iter ? 3 : 6;
-
-                char buffer[32];
-                timestamp.localDatetime().printToBuffer(
-                                                    buffer,
-                                                    sizeof buffer,
-                                                    fractionalSecondPrecision);
-
-                output += buffer;
-              } break;
-              case 'I':                                         // FALL THROUGH
-              case 'O':                                         // FALL THROUGH
-              case 'i': {
-                // Use ISO8601 "extended" format.
-
-                const int fractionalSecondPrecision = 'O' == *iter ? 6 : 3;
-
-                bdlt::Iso8601UtilConfiguration config;
-                config.setFractionalSecondPrecision(fractionalSecondPrecision);
-                config.setUseZAbbreviationForUtc(true);
-
-                char buffer[bdlt::Iso8601Util::k_DATETIMETZ_STRLEN + 1];
-
-                int outputLength = bdlt::Iso8601Util::generateRaw(buffer,
-                                                                  timestamp,
-                                                                  config);
-
-                if ('i' == *iter) {
-                    // Remove milliseconds part.
+    formatRecord(&output, record);
 
-                    enum { k_DECIMAL_SIGN_OFFSET = 19,
-                           k_TZINFO_OFFSET       = k_DECIMAL_SIGN_OFFSET + 4 };
-                    bslstl::StringRef head(buffer, k_DECIMAL_SIGN_OFFSET);
-
-                    bslstl::StringRef tail(buffer + k_TZINFO_OFFSET,
-                                           outputLength - k_TZINFO_OFFSET);
+    stream.write(output.c_str(), output.size());
+    stream.flush();
+}
 
-                    output += head + tail;
-                }
-                else {
-                    output.append(buffer, outputLength);
-                }
-              } break;
-              case 'p': {
-                appendToString(&output, fixedFields.processID());
-              } break;
-              case 't': {
-                appendToString(&output, fixedFields.threadID());
-              } break;
-              case 's': {
-                output += Severity::toAscii(
-                                 (Severity::Level)fixedFields.severity());
-              } break;
-              case 'f': {
-                output += fixedFields.fileName();
-              } break;
-              case 'F': {
-                const bsl::string& filename = fixedFields.fileName();
-                bsl::string::size_type rightmostSlashIndex =
-#ifdef BSLS_PLATFORM_OS_WINDOWS
-                    filename.rfind('\\');
-#else
-                    filename.rfind('/');
-#endif
-                if (bsl::string::npos == rightmostSlashIndex) {
-                    output += filename;
-                }
-                else {
-                    output += filename.substr(rightmostSlashIndex + 1);
-                }
-              } break;
-              case 'l': {
-                appendToString(&output, fixedFields.lineNumber());
-              } break;
-              case 'c': {
-                output += fixedFields.category();
-              } break;
-              case 'm': {
-                bslstl::StringRef message = fixedFields.messageRef();
-                output.append(message.data(), message.length());
-              } break;
-              case 'x': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
-                                      fixedFields.messageStreamBuf().length());
-                bdlb::Print::printString(ss,
-                                        fixedFields.message(),
-                                        length,
-                                        false);
-                output += ss.str();
-              } break;
-              case 'X': {
-                bsl::stringstream ss;
-                int length = static_cast<int>(
-                                      fixedFields.messageStreamBuf().length());
-                bdlb::Print::singleLineHexDump(ss,
-                                              fixedFields.message(),
-                                              length);
-                output += ss.str();
-              } break;
-              case 'u': {
-                typedef ball::UserFields Values;
-                const Values& customFields = record.customFields();
-                const int numCustomFields  = customFields.length();
-
-                if (numCustomFields > 0) {
-                    bsl::stringstream ss;
-                    Values::ConstIterator it = customFields.begin();
-                    ss << *it;
-                    ++it;
-                    for (; it != customFields.end(); ++it) {
-                        ss << " " << *it;
-                    }
-                    output += ss.str();
-                }
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
+void RecordStringFormatter::formatRecord(bsl::string   *result,
+                                         const Record&  record) const
+{
+    BSLS_ASSERT(result);
 
-                output += '%';
-                output += *iter;
-              }
-            }
-            ++iter;
-          } break;
-          case '\\': {
-            if (++iter == end) {
-                break;
-            }
-            switch (*iter) {
-              case 'n': {
-                output += '\n';
-              } break;
-              case 't': {
-                output += '\t';
-              } break;
-              case '\\': {
-                output += '\\';
-              } break;
-              default: {
-                // Undefined: we just output the verbatim characters.
+    // The timestamp cache is used only if no other thread is using it;
+    // otherwise, a (cold) cache on the stack is used instead.
 
-                output += '\\';
-                output += *iter;
-              }
-            }
-            ++iter;
-          } break;
-          default: {
-            output += *iter;
-            ++iter;
-          }
-        }
+    if (0 == d_cacheLock.testAndSwap(0, 1)) {
+        formatRecord(result, record, &d_cache);
+        d_cacheLock = 0;
     }
+    else {
+        TimestampCache cache;
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#undef snprintf
-#endif
-
-    stream.write(output.c_str(), output.size());
-    stream.flush();
+        formatRecord(result, record, &cache);
+    }
 }
 
 }  // close package namespace
@@ -94,6 +94,20 @@ BSLS_IDENT("$Id: $")
 // 27AUG2007_16:09:46.161 2040:1 WARN subdir/process.cpp:542 FOO.BAR.BAZ <text>
 //..
 //
+///Performance
+///-----------
+// The format specification of a record formatter is compiled, when it is set,
+// into a sequence of operations, each of which either outputs a literal run
+// of characters (with any '\'-escape sequences already interpolated) or a
+// single attribute of the record.  Formatting a record therefore does not
+// re-parse the format specification.  In addition, the portion of a formatted
+// timestamp that precedes the fractional seconds (and, for the ISO 8601
+// formats, the time zone designator that follows them) is cached, so that
+// successive records logged within the same second only need their
+// fractional seconds formatted.  The 'formatRecord' method appends the
+// formatted record directly to a caller-supplied string; 'operator()' formats
+// into a buffer on the stack and writes it to the stream in a single call.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate how to use an instance of
@@ -132,6 +146,10 @@ BSLS_IDENT("$Id: $")
 #include <balscm_version.h>
 #endif
 
+#ifndef INCLUDED_BDLT_DATE
+#include <bdlt_date.h>
+#endif
+
 #ifndef INCLUDED_BDLT_DATETIMEINTERVAL
 #include <bdlt_datetimeinterval.h>
 #endif
@@ -148,6 +166,10 @@ BSLS_IDENT("$Id: $")
 #include <bslmf_nestedtraitdeclaration.h>
 #endif
 
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
 #ifndef INCLUDED_BSL_IOSFWD
 #include <bsl_iosfwd.h>
 #endif
@@ -156,6 +178,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_string.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 #ifndef BDE_DONT_ALLOW_TRANSITIVE_INCLUDES
 
 #ifndef INCLUDED_BSLALG_TYPETRAITS
@@ -198,9 +224,89 @@ class RecordStringFormatter {
                                               // adjusted to the current local
                                               // time.
 
+    // PRIVATE TYPES
+    enum Field {
+        // Enumerate the kinds of operation in a compiled format
+        // specification.
+
+        e_LITERAL,            // literal text
+        e_DATETIME,           // '%d'
+        e_DATETIME_MICRO,     // '%D'
+        e_ISO8601,            // '%i'
+        e_ISO8601_MILLI,      // '%I'
+        e_ISO8601_MICRO,      // '%O'
+        e_PROCESS_ID,         // '%p'
+        e_THREAD_ID,          // '%t'
+        e_SEVERITY,           // '%s'
+        e_FILENAME,           // '%f'
+        e_BASENAME,           // '%F'
+        e_LINE,               // '%l'
+        e_CATEGORY,           // '%c'
+        e_MESSAGE,            // '%m'
+        e_MESSAGE_PRINTABLE,  // '%x'
+        e_MESSAGE_HEX,        // '%X'
+        e_USER_FIELDS         // '%u'
+    };
+
+    struct Operation {
+        // This 'struct' describes one step of a compiled format
+        // specification.
+
+        Field d_field;   // kind of this operation
+        int   d_offset;  // offset of the literal text in 'd_literals'
+        int   d_length;  // length of the literal text
+    };
+
+    struct TimestampCache {
+        // This 'struct' holds the most recently formatted timestamp prefixes
+        // (i.e., everything up to the fractional seconds) together with the
+        // second, and time zone offset, to which they apply.
+
+        bdlt::Date d_datetimeDate;       // date of 'd_datetime'
+        int        d_datetimeSecond;     // second of day of 'd_datetime'
+        int        d_datetimeOffset;     // offset (minutes) of 'd_datetime'
+        char       d_datetime[32];       // "DDMONYYYY_HH:MM:SS"
+        int        d_datetimeLength;     // length of 'd_datetime'
+
+        bdlt::Date d_iso8601Date;        // date of 'd_iso8601'
+        int        d_iso8601Second;      // second of day of 'd_iso8601'
+        int        d_iso8601Offset;      // offset (minutes) of 'd_iso8601'
+        char       d_iso8601[40];        // "YYYY-MM-DDTHH:MM:SS" followed by
+                                         // the time zone designator
+        int        d_iso8601Length;      // length of 'd_iso8601'
+
+        // CREATORS
+        TimestampCache();
+            // Create a cache matching no timestamp.
+
+        // MANIPULATORS
+        void invalidate();
+            // Set the key (date, second of day, and offset) of each cached
+            // prefix to a value matching no timestamp.
+    };
+
     // DATA
     bsl::string            d_formatSpec;       // 'printf'-style format spec.
     bdlt::DatetimeInterval d_timestampOffset;  // offset added to timestamps
+    bsl::string            d_literals;         // literal text referred to by
+                                               // 'd_program'
+    bsl::vector<Operation> d_program;          // compiled 'd_formatSpec'
+    mutable bsls::AtomicInt
+                           d_cacheLock;        // 1 while 'd_cache' is in use
+    mutable TimestampCache d_cache;            // cached timestamp prefixes
+
+    // PRIVATE MANIPULATORS
+    void compileFormat();
+        // Compile 'd_formatSpec' into 'd_program' and 'd_literals', and
+        // invalidate the timestamp cache.
+
+    // PRIVATE ACCESSORS
+    void formatRecord(bsl::string     *result,
+                      const Record&    record,
+                      TimestampCache  *cache) const;
+        // Append to the specified 'result' the specified 'record' formatted
+        // according to 'd_program', using (and updating) the specified
+        // 'cache' to format timestamps.
 
   public:
     // TRAITS
@@ -320,6 +426,14 @@ class RecordStringFormatter {
         // 'stream'.  The timestamp offset of this record formatter is added to
         // each timestamp that is output to 'stream'.
 
+    void formatRecord(bsl::string *result, const Record& record) const;
+        // Append to the specified 'result' the specified 'record' formatted
+        // according to the format specification of this record formatter.
+        // The timestamp offset of this record formatter is added to each
+        // timestamp that is appended to 'result'.  Note that this method
+        // produces the same characters as 'operator()' without the overhead of
+        // an intermediate stream.
+
     const char *format() const;
         // Return the format specification of this record formatter.
 
@@ -376,12 +490,6 @@ void RecordStringFormatter::enablePublishInLocalTime()
     d_timestampOffset.setTotalMilliseconds(k_ENABLE_PUBLISH_IN_LOCALTIME);
 }
 
-inline
-void RecordStringFormatter::setFormat(const char *format)
-{
-    d_formatSpec = format;
-}
-
 inline
 void RecordStringFormatter::setTimestampOffset(
                                           const bdlt::DatetimeInterval& offset)
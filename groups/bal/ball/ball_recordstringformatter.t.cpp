@@ -19,7 +19,9 @@
 #include <bslim_testutil.h>
 
 #include <bdlt_datetime.h>
+#include <bdlt_datetimetz.h>
 #include <bdlt_iso8601util.h>
+#include <bdlt_iso8601utilconfiguration.h>
 #include <bdlt_localtimeoffset.h>
 
 #include <bslma_default.h>
@@ -27,6 +29,7 @@
 #include <bslma_testallocator.h>
 #include <bslma_testallocatormonitor.h>
 #include <bsls_platform.h>
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 
@@ -85,6 +88,7 @@ using bsl::string;
 // [13] bool isPublishInLocalTimeEnabled() const;
 // [ 2] const bdlt::DatetimeInterval& timestampOffset() const;
 // [11] void operator()(bsl::ostream&, const ball::Record&) const;
+// [14] void formatRecord(bsl::string *, const ball::Record&) const;
 // FREE OPERATORS
 // [ 6] bool operator==(const ball::RSF& lhs, const ball::RSF& rhs);
 // [ 6] bool operator!=(const ball::RSF& lhs, const ball::RSF& rhs);
@@ -92,6 +96,9 @@ using bsl::string;
 // ----------------------------------------------------------------------------
 // [ 1] breathing test
 // [12] USAGE example
+// [14] CONCERN: compiled format matches the format specification
+// [14] CONCERN: cached timestamp prefixes track the record timestamp
+// [-1] CONCERN: PERFORMANCE
 
 // ============================================================================
 //                     STANDARD BDE ASSERT TEST FUNCTION
@@ -265,6 +272,232 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
+      case 14: {
+        // --------------------------------------------------------------------
+        // TESTING 'formatRecord'
+        //
+        // Concerns:
+        //: 1 'formatRecord' appends (rather than assigns) to the supplied
+        //:   string.
+        //:
+        //: 2 The format specification, once compiled, produces exactly the
+        //:   output described in the component documentation, including
+        //:   adjacent fields, '\'-escape sequences, undefined conversions,
+        //:   and a trailing '%' or '\'.
+        //:
+        //: 3 'formatRecord' and 'operator()' produce identical output.
+        //:
+        //: 4 Changing the format (by 'setFormat' or assignment) recompiles
+        //:   it.
+        //:
+        //: 5 Timestamps are correct when consecutive records fall within the
+        //:   same second, in a later second, on a later day, in an earlier
+        //:   second, and when the timestamp offset changes (i.e., the cached
+        //:   timestamp prefixes are refreshed when, and only when,
+        //:   necessary).
+        //
+        // Plan:
+        //: 1 Using a table-driven approach, format a record having known
+        //:   attributes with a variety of format specifications into a
+        //:   non-empty string, and into a stream, and verify the results.
+        //:   (C-1..3)
+        //:
+        //: 2 Set the format of an object, copy-assign a second object, and
+        //:   verify both format according to their new specifications.
+        //:   (C-4)
+        //:
+        //: 3 Using a table-driven approach, format a sequence of records
+        //:   with each of the timestamp conversions and offsets, comparing
+        //:   each result with that computed by 'bdlt::Datetime' and
+        //:   'bdlt::Iso8601Util'.  (C-5)
+        //
+        // Testing:
+        //   void formatRecord(bsl::string *, const ball::Record&) const;
+        //   CONCERN: compiled format matches the format specification
+        //   CONCERN: cached timestamp prefixes track the record timestamp
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'formatRecord'" << endl
+                          << "======================" << endl;
+
+        ball::RecordAttributes fixedFields(
+                             bdlt::Datetime(2007, 8, 27, 16, 9, 46, 161, 324),
+                             2040,
+                             1,
+                             "subdir/process.cpp",
+                             542,
+                             "FOO.BAR.BAZ",
+                             ball::Severity::e_WARN,
+                             "text");
+
+        ball::Record        mR(fixedFields, ball::UserFields());
+        const ball::Record& R = mR;
+
+        if (verbose) cout << "\nTesting compiled formats." << endl;
+        {
+            static const struct {
+                int         d_line;      // source line number
+                const char *d_format_p;  // format specification
+                const char *d_exp_p;     // expected output
+            } DATA[] = {
+                //LINE  FORMAT              EXPECTED
+                //----  ------------------  -------------------------------
+                { L_,   "",                 ""                              },
+                { L_,   "abc",              "abc"                           },
+                { L_,   "%d",               "27AUG2007_16:09:46.161"        },
+                { L_,   "%D",               "27AUG2007_16:09:46.161324"     },
+                { L_,   "%i",               "2007-08-27T16:09:46Z"          },
+                { L_,   "%I",               "2007-08-27T16:09:46.161Z"      },
+                { L_,   "%O",               "2007-08-27T16:09:46.161324Z"   },
+                { L_,   "%d|%D",            "27AUG2007_16:09:46.161|"
+                                            "27AUG2007_16:09:46.161324"     },
+                { L_,   "%i%O",             "2007-08-27T16:09:46Z"
+                                            "2007-08-27T16:09:46.161324Z"   },
+                { L_,   "%p:%t",            "2040:1"                        },
+                { L_,   "%s",               "WARN"                          },
+                { L_,   "%f:%l",            "subdir/process.cpp:542"        },
+                { L_,   "%F",               "process.cpp"                   },
+                { L_,   "<%c> %m",          "<FOO.BAR.BAZ> text"            },
+                { L_,   "%m%m",             "texttext"                      },
+                { L_,   "%X",               "74657874"                      },
+                { L_,   "%u",               ""                              },
+                { L_,   "%%",               "%"                             },
+                { L_,   "%%d",              "%d"                            },
+                { L_,   "%q%",              "%q"                            },
+                { L_,   "a\\n\\t\\\\b",     "a\n\t\\b"                      },
+                { L_,   "\\q\\",            "\\q"                           },
+                { L_,   "\n%s\n",           "\nWARN\n"                      },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int         LINE   = DATA[ti].d_line;
+                const char *const FORMAT = DATA[ti].d_format_p;
+                const bsl::string EXP    = DATA[ti].d_exp_p;
+
+                Obj mX(FORMAT);  const Obj& X = mX;
+
+                bsl::string result("prefix");
+                X.formatRecord(&result, R);
+
+                if (veryVerbose) { T_ P_(LINE) P(result) }
+
+                ASSERTV(LINE, result, "prefix" + EXP == result);
+
+                ostringstream oss;
+                X(oss, R);
+                ASSERTV(LINE, oss.str(), EXP == oss.str());
+
+                // Formatting a second time uses the cached timestamp.
+
+                result.clear();
+                X.formatRecord(&result, R);
+                ASSERTV(LINE, result, EXP == result);
+            }
+        }
+
+        if (verbose) cout << "\nTesting recompilation." << endl;
+        {
+            Obj mX("%s");  const Obj& X = mX;
+            Obj mY("%l");  const Obj& Y = mY;
+
+            bsl::string result;
+            X.formatRecord(&result, R);
+            Y.formatRecord(&result, R);
+            ASSERTV(result, "WARN542" == result);
+
+            mX.setFormat("%c");
+            result.clear();
+            X.formatRecord(&result, R);
+            ASSERTV(result, "FOO.BAR.BAZ" == result);
+
+            mY = X;
+            result.clear();
+            Y.formatRecord(&result, R);
+            ASSERTV(result, "FOO.BAR.BAZ" == result);
+        }
+
+        if (verbose) cout << "\nTesting cached timestamps." << endl;
+        {
+            static const struct {
+                int d_line;     // source line number
+                int d_day;      // day of August 2007
+                int d_hour;     // hour
+                int d_minute;   // minute
+                int d_second;   // second
+                int d_milli;    // millisecond
+                int d_micro;    // microsecond
+                int d_offset;   // timestamp offset (minutes)
+            } DATA[] = {
+                //LINE  DAY  HR  MIN  SEC  MSEC  USEC  OFFSET
+                //----  ---  --  ---  ---  ----  ----  ------
+                { L_,    27, 16,   9,  46,  161,  324,      0 },
+                { L_,    27, 16,   9,  46,  161,  325,      0 },
+                { L_,    27, 16,   9,  46,  999,  999,      0 },
+                { L_,    27, 16,   9,  47,    0,    0,      0 },
+                { L_,    27, 16,  10,  47,    0,    0,      0 },
+                { L_,    28, 16,  10,  47,    0,    0,      0 },
+                { L_,    28, 16,  10,  47,    0,    0,     90 },
+                { L_,    28, 16,  10,  47,    1,    0,    -90 },
+                { L_,    28, 16,  10,  47,    1,    0,      0 },
+                { L_,    27, 16,   9,  46,    7,   11,      0 },
+                { L_,    27, 23,  59,  59,  999,  999,      1 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            Obj mX("%d|%D|%i|%I|%O");  const Obj& X = mX;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE   = DATA[ti].d_line;
+                const int OFFSET = DATA[ti].d_offset;
+
+                const bdlt::Datetime UTC(2007,
+                                         8,
+                                         DATA[ti].d_day,
+                                         DATA[ti].d_hour,
+                                         DATA[ti].d_minute,
+                                         DATA[ti].d_second,
+                                         DATA[ti].d_milli,
+                                         DATA[ti].d_micro);
+
+                mR.fixedFields().setTimestamp(UTC);
+                mX.setTimestampOffset(bdlt::DatetimeInterval(0, 0, OFFSET));
+
+                bdlt::Datetime local(UTC);
+                local.addMinutes(OFFSET);
+                const bdlt::DatetimeTz localTz(local, OFFSET);
+
+                bsl::string EXP;
+                char        buffer[64];
+
+                local.printToBuffer(buffer, sizeof buffer, 3);
+                EXP += buffer;
+                EXP += '|';
+                local.printToBuffer(buffer, sizeof buffer, 6);
+                EXP += buffer;
+
+                for (int precision = 0; precision <= 6; precision += 3) {
+                    bdlt::Iso8601UtilConfiguration config;
+                    config.setFractionalSecondPrecision(precision);
+                    config.setUseZAbbreviationForUtc(true);
+
+                    int length = bdlt::Iso8601Util::generateRaw(buffer,
+                                                                localTz,
+                                                                config);
+                    EXP += '|';
+                    EXP.append(buffer, length);
+                }
+
+                bsl::string result;
+                X.formatRecord(&result, R);
+
+                if (veryVerbose) { T_ P_(LINE) P(result) }
+
+                ASSERTV(LINE, EXP, result, EXP == result);
+            }
+        }
+      } break;
       case 13: {
         // --------------------------------------------------------------------
         // TESTING: Records Show Calculated Local-Time Offset
@@ -1769,6 +2002,84 @@ int main(int argc, char *argv[])
         ASSERT( 1 == (X1 == X4));        ASSERT(0 == (X1 != X4));
       } break;
 
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Formatting a record with the default format specification is
+        //:   fast enough to sustain high logging rates.
+        //
+        // Plan:
+        //: 1 Format a large number of records, whose timestamps advance by
+        //:   one microsecond, with the default format specification using
+        //:   both 'operator()' and 'formatRecord', and report the average
+        //:   time per record.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: PERFORMANCE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_RECORDS = 1000000;
+
+        ball::RecordAttributes fixedFields(bdlt::CurrentTime::utc(),
+                                           2040,
+                                           1,
+                                           "subdir/process.cpp",
+                                           542,
+                                           "FOO.BAR.BAZ",
+                                           ball::Severity::e_WARN,
+                                           "Hello world!");
+        ball::Record        mR(fixedFields, ball::UserFields());
+        const ball::Record& R = mR;
+
+        const bdlt::Datetime START = R.fixedFields().timestamp();
+
+        Obj mX;  const Obj& X = mX;
+
+        {
+            ostringstream   oss;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                bdlt::Datetime timestamp(START);
+                timestamp.addMicroseconds(i);
+                mR.fixedFields().setTimestamp(timestamp);
+
+                oss.seekp(0);
+                X(oss, R);
+            }
+            timer.stop();
+
+            cout << "operator():   "
+                 << timer.elapsedTime() * 1e9 / NUM_RECORDS
+                 << " ns/record" << endl;
+        }
+        {
+            bsl::string     result;
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int i = 0; i < NUM_RECORDS; ++i) {
+                bdlt::Datetime timestamp(START);
+                timestamp.addMicroseconds(i);
+                mR.fixedFields().setTimestamp(timestamp);
+
+                result.clear();
+                X.formatRecord(&result, R);
+            }
+            timer.stop();
+
+            cout << "formatRecord: "
+                 << timer.elapsedTime() * 1e9 / NUM_RECORDS
+                 << " ns/record" << endl;
+        }
+      } break;
       default:
         {
             cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
@@ -12,12 +12,171 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_collector_cpp,"$Id$ $CSID$")
 
+#include <bslmf_assert.h>
+#include <bsls_assert.h>
+#include <bsls_types.h>
+
+#include <bsl_new.h>
+
 namespace BloombergLP {
+namespace balm {
+
+                          // ------------------------
+                          // struct Collector::Stripe
+                          // ------------------------
+
+// CREATORS
+Collector::Stripe::Stripe()
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_count(0)
+, d_total(0.0)
+, d_min(MetricRecord::k_DEFAULT_MIN)
+, d_max(MetricRecord::k_DEFAULT_MAX)
+{
+}
 
                               // ---------------
                               // class Collector
                               // ---------------
 
+// PRIVATE ACCESSORS
+void Collector::lockAll() const
+{
+    // Stripes are always locked in the same order, and 'update' and
+    // 'accumulateCountTotalMinMax' lock a single stripe, so this cannot
+    // deadlock.
+
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].d_lock.lock();
+    }
+}
+
+void Collector::unlockAll() const
+{
+    for (int i = k_NUM_STRIPES - 1; i >= 0; --i) {
+        d_stripes_p[i].d_lock.unlock();
+    }
+}
+
+// CREATORS
+Collector::Collector(const MetricId& metricId)
+: d_metricId(metricId)
+{
+    BSLMF_ASSERT(0 == sizeof(PaddedStripe) % k_CACHE_LINE_SIZE);
+
+    // Place the stripes on the first cache-line boundary in
+    // 'd_stripeBuffer', so that each stripe occupies its own cache lines.
+
+    const bsls::Types::UintPtr address =
+                        reinterpret_cast<bsls::Types::UintPtr>(d_stripeBuffer);
+    const bsls::Types::UintPtr mask    = k_CACHE_LINE_SIZE - 1;
+
+    d_stripes_p = reinterpret_cast<PaddedStripe *>((address + mask) & ~mask);
+
+    BSLS_ASSERT_SAFE(0 == (reinterpret_cast<bsls::Types::UintPtr>(d_stripes_p)
+                                                                      & mask));
+    BSLS_ASSERT_SAFE(reinterpret_cast<char *>(d_stripes_p + k_NUM_STRIPES)
+                               <= d_stripeBuffer + sizeof d_stripeBuffer);
+
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        new (d_stripes_p + i) PaddedStripe();
+    }
+}
+
+Collector::~Collector()
+{
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].~PaddedStripe();
+    }
+}
+
+// MANIPULATORS
+void Collector::reset()
+{
+    lockAll();
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        Stripe& stripe = d_stripes_p[i];
+
+        stripe.d_count = 0;
+        stripe.d_total = 0.0;
+        stripe.d_min   = MetricRecord::k_DEFAULT_MIN;
+        stripe.d_max   = MetricRecord::k_DEFAULT_MAX;
+    }
+    unlockAll();
+}
+
+void Collector::loadAndReset(MetricRecord *record)
+{
+    record->metricId() = d_metricId;
+    record->count()    = 0;
+    record->total()    = 0.0;
+    record->min()      = MetricRecord::k_DEFAULT_MIN;
+    record->max()      = MetricRecord::k_DEFAULT_MAX;
+
+    lockAll();
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        Stripe& stripe = d_stripes_p[i];
+
+        record->count() += stripe.d_count;
+        record->total() += stripe.d_total;
+        record->min()   =  bsl::min(record->min(), stripe.d_min);
+        record->max()   =  bsl::max(record->max(), stripe.d_max);
+
+        stripe.d_count = 0;
+        stripe.d_total = 0.0;
+        stripe.d_min   = MetricRecord::k_DEFAULT_MIN;
+        stripe.d_max   = MetricRecord::k_DEFAULT_MAX;
+    }
+    unlockAll();
+}
+
+void Collector::setCountTotalMinMax(int    count,
+                                    double total,
+                                    double min,
+                                    double max)
+{
+    lockAll();
+
+    Stripe& first = d_stripes_p[0];
+
+    first.d_count = count;
+    first.d_total = total;
+    first.d_min   = min;
+    first.d_max   = max;
+
+    for (int i = 1; i < k_NUM_STRIPES; ++i) {
+        Stripe& stripe = d_stripes_p[i];
+
+        stripe.d_count = 0;
+        stripe.d_total = 0.0;
+        stripe.d_min   = MetricRecord::k_DEFAULT_MIN;
+        stripe.d_max   = MetricRecord::k_DEFAULT_MAX;
+    }
+    unlockAll();
+}
+
+// ACCESSORS
+void Collector::load(MetricRecord *record) const
+{
+    record->metricId() = d_metricId;
+    record->count()    = 0;
+    record->total()    = 0.0;
+    record->min()      = MetricRecord::k_DEFAULT_MIN;
+    record->max()      = MetricRecord::k_DEFAULT_MAX;
+
+    lockAll();
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        const Stripe& stripe = d_stripes_p[i];
+
+        record->count() += stripe.d_count;
+        record->total() += stripe.d_total;
+        record->min()   =  bsl::min(record->min(), stripe.d_min);
+        record->max()   =  bsl::max(record->max(), stripe.d_max);
+    }
+    unlockAll();
+}
+
+}  // close package namespace
 }  // close enterprise namespace
 
 // ----------------------------------------------------------------------------
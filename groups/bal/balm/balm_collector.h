@@ -42,6 +42,18 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 // operations on a given instance can be safely invoked simultaneously from
 // multiple threads.
 //
+///Striped Aggregation
+///-------------------
+// A collector is typically updated by many threads, but loaded (and reset)
+// only once per publication interval.  To avoid serializing all the updates
+// of a collector on a single lock, a 'balm::Collector' holds several
+// independent sets of aggregates (*stripes*), each protected by its own
+// (spin) lock and occupying its own cache lines.  Each thread updates the
+// stripe selected by a hash of its thread id, so that threads updating the
+// same collector rarely contend.  'load', 'loadAndReset', 'reset', and
+// 'setCountTotalMinMax' lock all the stripes (and therefore remain atomic
+// with respect to the updates), and merge (or reset) their aggregates.
+//
 ///Usage
 ///-----
 // The following example creates a 'balm::Collector', modifies its values, then
@@ -89,12 +101,20 @@ BSLS_IDENT("$Id: balm_collector.h,v 1.7 2008/04/16 20:00:49 hversche Exp $")
 #include <balm_metricid.h>
 #endif
 
-#ifndef INCLUDED_BSLMT_MUTEX
-#include <bslmt_mutex.h>
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_SPINLOCK
+#include <bsls_spinlock.h>
 #endif
 
-#ifndef INCLUDED_BSLMT_LOCKGUARD
-#include <bslmt_lockguard.h>
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
 #endif
 
 #ifndef INCLUDED_BSL_ALGORITHM
@@ -120,14 +140,72 @@ class Collector {
     // is 0.0, the default minimum value is 'MetricRecord::k_DEFAULT_MIN', and
     // the default maximum value is 'MetricRecord::k_DEFAULT_MAX'.
 
+    // PRIVATE CONSTANTS
+    enum {
+        k_NUM_STRIPES_LOG2 = 3,                        // log2 of the number
+                                                       // of stripes
+
+        k_NUM_STRIPES      = 1 << k_NUM_STRIPES_LOG2,  // number of stripes
+
+        k_CACHE_LINE_SIZE  = bslmt::Platform::e_CACHE_LINE_SIZE
+    };
+
+    // PRIVATE TYPES
+    struct Stripe {
+        // This 'struct' holds the aggregates of the updates performed by the
+        // threads assigned to a stripe.
+
+        // DATA
+        bsls::SpinLock d_lock;   // synchronizes access to the aggregates
+        int            d_count;  // aggregated count of events
+        double         d_total;  // total of values across events
+        double         d_min;    // minimum value across events
+        double         d_max;    // maximum value across events
+
+        // CREATORS
+        Stripe();
+            // Create a stripe having a count of 0, a total of 0.0, a minimum
+            // of 'MetricRecord::k_DEFAULT_MIN', and a maximum of
+            // 'MetricRecord::k_DEFAULT_MAX'.
+    };
+
+    struct PaddedStripe : Stripe {
+        // This 'struct' pads a 'Stripe' to a multiple of the cache line size,
+        // so that threads updating different stripes, placed consecutively
+        // from a cache-line boundary, do not contend on the same cache line.
+
+        // DATA
+        char d_pad[k_CACHE_LINE_SIZE - sizeof(Stripe) % k_CACHE_LINE_SIZE];
+    };
+
     // DATA
-    MetricRecord         d_record;  // the recorded metric information
-    mutable bslmt::Mutex d_lock;    // record synchronization mechanism
+    MetricId      d_metricId;        // metric identifier
+
+    char          d_stripeBuffer[k_NUM_STRIPES * sizeof(PaddedStripe)
+                                 + k_CACHE_LINE_SIZE - 1];
+                                     // storage for the stripes, large enough
+                                     // to align them on a cache-line boundary
+                                     // whatever the alignment of this object
+
+    PaddedStripe *d_stripes_p;       // 'k_NUM_STRIPES' aggregates, from the
+                                     // first cache-line boundary in
+                                     // 'd_stripeBuffer'
 
     // NOT IMPLEMENTED
     Collector(const Collector&);
     Collector& operator=(const Collector&);
 
+    // PRIVATE CLASS METHODS
+    static int stripeIndex();
+        // Return the index of the stripe updated by the calling thread.
+
+    // PRIVATE ACCESSORS
+    void lockAll() const;
+        // Acquire the locks of all the stripes of this collector.
+
+    void unlockAll() const;
+        // Release the locks of all the stripes of this collector.
+
   public:
      // CREATORS
     Collector(const MetricId& metricId);
@@ -198,49 +276,30 @@ class Collector {
                               // class Collector
                               // ---------------
 
-// CREATORS
+// PRIVATE CLASS METHODS
 inline
-Collector::Collector(const MetricId& metricId)
-: d_record(metricId)
-, d_lock()
+int Collector::stripeIndex()
 {
-}
+    // Spread the threads over the stripes using the Fibonacci hash of their
+    // id.
 
-inline
-Collector::~Collector()
-{
-}
-
-// MANIPULATORS
-inline
-void Collector::reset()
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
-}
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                                     * 0x9E3779B97F4A7C15ULL;
 
-inline
-void Collector::loadAndReset(MetricRecord *record)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record          = d_record;
-    d_record.count() = 0;
-    d_record.total() = 0.0;
-    d_record.min()   = MetricRecord::k_DEFAULT_MIN;
-    d_record.max()   = MetricRecord::k_DEFAULT_MAX;
+    return static_cast<int>(hash >> (64 - k_NUM_STRIPES_LOG2));
 }
 
+// MANIPULATORS
 inline
 void Collector::update(double value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    ++d_record.count();
-    d_record.total() += value;
-    d_record.min()   =  bsl::min(d_record.min(), value);
-    d_record.max()   =  bsl::max(d_record.max(), value);
+    Stripe& stripe = d_stripes_p[stripeIndex()];
+
+    bsls::SpinLockGuard guard(&stripe.d_lock);
+    ++stripe.d_count;
+    stripe.d_total += value;
+    stripe.d_min   =  bsl::min(stripe.d_min, value);
+    stripe.d_max   =  bsl::max(stripe.d_max, value);
 }
 
 inline
@@ -249,39 +308,22 @@ void Collector::accumulateCountTotalMinMax(int    count,
                                            double min,
                                            double max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() += count;
-    d_record.total() += total;
-    d_record.min()   =  bsl::min(d_record.min(), min);
-    d_record.max()   =  bsl::max(d_record.max(), max);
-}
+    Stripe& stripe = d_stripes_p[stripeIndex()];
 
-inline
-void Collector::setCountTotalMinMax(int    count,
-                                    double total,
-                                    double min,
-                                    double max)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    d_record.count() = count;
-    d_record.total() = total;
-    d_record.min()   = min;
-    d_record.max()   = max;
+    bsls::SpinLockGuard guard(&stripe.d_lock);
+    stripe.d_count += count;
+    stripe.d_total += total;
+    stripe.d_min   =  bsl::min(stripe.d_min, min);
+    stripe.d_max   =  bsl::max(stripe.d_max, max);
 }
 
 // ACCESSORS
 inline
 const MetricId& Collector::metricId() const
 {
-    return d_record.metricId();
+    return d_metricId;
 }
 
-inline
-void Collector::load(MetricRecord *record) const
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_lock);
-    *record = d_record;
-}
 }  // close package namespace
 
 }  // close enterprise namespace
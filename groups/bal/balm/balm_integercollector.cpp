@@ -12,9 +12,12 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(balm_integercollector_cpp,"$Id$ $CSID$")
 
+#include <bslmf_assert.h>
+#include <bsls_assert.h>
 #include <bsls_types.h>
 
 #include <bsl_climits.h>
+#include <bsl_new.h>
 
 namespace BloombergLP {
 
@@ -27,54 +30,61 @@ const int balm::IntegerCollector::k_DEFAULT_MIN = INT_MAX;
 const int balm::IntegerCollector::k_DEFAULT_MAX = INT_MIN;
 
 namespace balm {
-// MANIPULATORS
-void IntegerCollector::loadAndReset(MetricRecord *records)
+
+                      // -------------------------------
+                      // struct IntegerCollector::Stripe
+                      // -------------------------------
+
+// CREATORS
+IntegerCollector::Stripe::Stripe()
+: d_lock(bsls::SpinLock::s_unlocked)
+, d_count(0)
+, d_total(0)
+, d_min(k_DEFAULT_MIN)
+, d_max(k_DEFAULT_MAX)
+{
+}
+
+                           // ----------------------
+                           // class IntegerCollector
+                           // ----------------------
+
+// PRIVATE ACCESSORS
+void IntegerCollector::lockAll() const
 {
-    int                count;
-    bsls::Types::Int64 total;
-    int                min;
-    int                max;
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
-
-        d_count = 0;
-        d_total = 0;
-        d_min   = k_DEFAULT_MIN;
-        d_max   = k_DEFAULT_MAX;
+    // Stripes are always locked in the same order, and 'update' and
+    // 'accumulateCountTotalMinMax' lock a single stripe, so this cannot
+    // deadlock.
+
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].d_lock.lock();
     }
-    // Perform the conversion to double values outside of the lock.
-    records->metricId() = d_metricId;
-    records->count()    = count;
-    records->total()    = static_cast<double>(total);
-    records->min()      = (k_DEFAULT_MIN == min)
-                        ? MetricRecord::k_DEFAULT_MIN
-                        : min;
-    records->max()      = (k_DEFAULT_MAX == max)
-                        ? MetricRecord::k_DEFAULT_MAX
-                        : max;
 }
 
-// ACCESSORS
-void IntegerCollector::load(MetricRecord *record) const
+void IntegerCollector::loadAggregates(MetricRecord *record,
+                                      bool          resetFlag) const
 {
-    int                count;
-    bsls::Types::Int64 total;
-    int                min;
-    int                max;
-
-    {
-        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-        count = d_count;
-        total = d_total;
-        min   = d_min;
-        max   = d_max;
+    int                count = 0;
+    bsls::Types::Int64 total = 0;
+    int                min   = k_DEFAULT_MIN;
+    int                max   = k_DEFAULT_MAX;
+
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        Stripe& stripe = d_stripes_p[i];
+
+        count += stripe.d_count;
+        total += stripe.d_total;
+        min   =  bsl::min(min, stripe.d_min);
+        max   =  bsl::max(max, stripe.d_max);
+
+        if (resetFlag) {
+            stripe.d_count = 0;
+            stripe.d_total = 0;
+            stripe.d_min   = k_DEFAULT_MIN;
+            stripe.d_max   = k_DEFAULT_MAX;
+        }
     }
 
-    // Perform the conversion to double values outside of the lock.
     record->metricId() = d_metricId;
     record->count()    = count;
     record->total()    = static_cast<double>(total);
@@ -86,6 +96,100 @@ void IntegerCollector::load(MetricRecord *record) const
                        : max;
 }
 
+void IntegerCollector::unlockAll() const
+{
+    for (int i = k_NUM_STRIPES - 1; i >= 0; --i) {
+        d_stripes_p[i].d_lock.unlock();
+    }
+}
+
+// CREATORS
+IntegerCollector::IntegerCollector(const MetricId& metricId)
+: d_metricId(metricId)
+{
+    BSLMF_ASSERT(0 == sizeof(PaddedStripe) % k_CACHE_LINE_SIZE);
+
+    // Place the stripes on the first cache-line boundary in
+    // 'd_stripeBuffer', so that each stripe occupies its own cache lines.
+
+    const bsls::Types::UintPtr address =
+                        reinterpret_cast<bsls::Types::UintPtr>(d_stripeBuffer);
+    const bsls::Types::UintPtr mask    = k_CACHE_LINE_SIZE - 1;
+
+    d_stripes_p = reinterpret_cast<PaddedStripe *>((address + mask) & ~mask);
+
+    BSLS_ASSERT_SAFE(0 == (reinterpret_cast<bsls::Types::UintPtr>(d_stripes_p)
+                                                                      & mask));
+    BSLS_ASSERT_SAFE(reinterpret_cast<char *>(d_stripes_p + k_NUM_STRIPES)
+                               <= d_stripeBuffer + sizeof d_stripeBuffer);
+
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        new (d_stripes_p + i) PaddedStripe();
+    }
+}
+
+IntegerCollector::~IntegerCollector()
+{
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        d_stripes_p[i].~PaddedStripe();
+    }
+}
+
+// MANIPULATORS
+void IntegerCollector::reset()
+{
+    lockAll();
+    for (int i = 0; i < k_NUM_STRIPES; ++i) {
+        Stripe& stripe = d_stripes_p[i];
+
+        stripe.d_count = 0;
+        stripe.d_total = 0;
+        stripe.d_min   = k_DEFAULT_MIN;
+        stripe.d_max   = k_DEFAULT_MAX;
+    }
+    unlockAll();
+}
+
+void IntegerCollector::loadAndReset(MetricRecord *records)
+{
+    lockAll();
+    loadAggregates(records, true);
+    unlockAll();
+}
+
+void IntegerCollector::setCountTotalMinMax(int count,
+                                           int total,
+                                           int min,
+                                           int max)
+{
+    lockAll();
+
+    Stripe& first = d_stripes_p[0];
+
+    first.d_count = count;
+    first.d_total = total;
+    first.d_min   = min;
+    first.d_max   = max;
+
+    for (int i = 1; i < k_NUM_STRIPES; ++i) {
+        Stripe& stripe = d_stripes_p[i];
+
+        stripe.d_count = 0;
+        stripe.d_total = 0;
+        stripe.d_min   = k_DEFAULT_MIN;
+        stripe.d_max   = k_DEFAULT_MAX;
+    }
+    unlockAll();
+}
+
+// ACCESSORS
+void IntegerCollector::load(MetricRecord *record) const
+{
+    lockAll();
+    loadAggregates(record, false);
+    unlockAll();
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
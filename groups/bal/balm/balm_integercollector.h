@@ -41,6 +41,16 @@ BSLS_IDENT("$Id: $")
 // non-creator operations on a given instance can be safely invoked
 // simultaneously from multiple threads.
 //
+///Striped Aggregation
+///-------------------
+// As 'balm::Collector', a 'balm::IntegerCollector' holds several independent
+// sets of aggregates (*stripes*), each protected by its own (spin) lock and
+// occupying its own cache lines, so that threads updating the same collector
+// rarely contend: each thread updates the stripe selected by a hash of its
+// thread id.  'load', 'loadAndReset', 'reset', and 'setCountTotalMinMax' lock
+// all the stripes (and therefore remain atomic with respect to the updates),
+// and merge (or reset) their aggregates.
+//
 ///Usage
 ///-----
 // The following example creates a 'balm::IntegerCollector', modifies its
@@ -92,12 +102,16 @@ BSLS_IDENT("$Id: $")
 #include <balm_metricrecord.h>
 #endif
 
-#ifndef INCLUDED_BSLMT_MUTEX
-#include <bslmt_mutex.h>
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
 #endif
 
-#ifndef INCLUDED_BSLMT_LOCKGUARD
-#include <bslmt_lockguard.h>
+#ifndef INCLUDED_BSLS_SPINLOCK
+#include <bsls_spinlock.h>
 #endif
 
 #ifndef INCLUDED_BSLS_TYPES
@@ -121,18 +135,79 @@ class IntegerCollector {
     // default value for the minimum is 'k_DEFAULT_MIN', and the default value
     // for the maximum is 'k_DEFAULT_MAX'.
 
+    // PRIVATE CONSTANTS
+    enum {
+        k_NUM_STRIPES_LOG2 = 3,                        // log2 of the number
+                                                       // of stripes
+
+        k_NUM_STRIPES      = 1 << k_NUM_STRIPES_LOG2,  // number of stripes
+
+        k_CACHE_LINE_SIZE  = bslmt::Platform::e_CACHE_LINE_SIZE
+    };
+
+    // PRIVATE TYPES
+    struct Stripe {
+        // This 'struct' holds the aggregates of the updates performed by the
+        // threads assigned to a stripe.
+
+        // DATA
+        bsls::SpinLock     d_lock;   // synchronizes access to the aggregates
+        int                d_count;  // aggregated count of events
+        bsls::Types::Int64 d_total;  // total of values across events
+        int                d_min;    // minimum value across events
+        int                d_max;    // maximum value across events
+
+        // CREATORS
+        Stripe();
+            // Create a stripe having a count of 0, a total of 0, a minimum of
+            // 'k_DEFAULT_MIN', and a maximum of 'k_DEFAULT_MAX'.
+    };
+
+    struct PaddedStripe : Stripe {
+        // This 'struct' pads a 'Stripe' to a multiple of the cache line size,
+        // so that threads updating different stripes, placed consecutively
+        // from a cache-line boundary, do not contend on the same cache line.
+
+        // DATA
+        char d_pad[k_CACHE_LINE_SIZE - sizeof(Stripe) % k_CACHE_LINE_SIZE];
+    };
+
     // DATA
-    MetricId             d_metricId;  // metric identifier
-    int                  d_count;     // aggregated count of events
-    bsls::Types::Int64   d_total;     // total of values across events
-    int                  d_min;       // minimum value across events
-    int                  d_max;       // maximum value across events
-    mutable bslmt::Mutex d_mutex;     // synchronizes access to data
+    MetricId      d_metricId;        // metric identifier
+
+    char          d_stripeBuffer[k_NUM_STRIPES * sizeof(PaddedStripe)
+                                 + k_CACHE_LINE_SIZE - 1];
+                                     // storage for the stripes, large enough
+                                     // to align them on a cache-line boundary
+                                     // whatever the alignment of this object
+
+    PaddedStripe *d_stripes_p;       // 'k_NUM_STRIPES' aggregates, from the
+                                     // first cache-line boundary in
+                                     // 'd_stripeBuffer'
 
     // NOT IMPLEMENTED
     IntegerCollector(const IntegerCollector&);
     IntegerCollector& operator=(const IntegerCollector&);
 
+    // PRIVATE CLASS METHODS
+    static int stripeIndex();
+        // Return the index of the stripe updated by the calling thread.
+
+    // PRIVATE ACCESSORS
+    void lockAll() const;
+        // Acquire the locks of all the stripes of this collector.
+
+    void loadAggregates(MetricRecord *record, bool resetFlag) const;
+        // Load into the specified 'record' the id of the metric being
+        // collected, and the merged aggregates of all the stripes (converting
+        // default minimum and maximum values), and, if the specified
+        // 'resetFlag' is 'true', reset the aggregates of all the stripes.
+        // The behavior is undefined unless the locks of all the stripes are
+        // held by the calling thread.
+
+    void unlockAll() const;
+        // Release the locks of all the stripes of this collector.
+
   public:
     // PUBLIC CONSTANTS
     static const int k_DEFAULT_MIN;  // default minimum value (INT_MAX)
@@ -214,42 +289,30 @@ class IntegerCollector {
                            // class IntegerCollector
                            // ----------------------
 
-// CREATORS
+// PRIVATE CLASS METHODS
 inline
-IntegerCollector::IntegerCollector(const MetricId& metricId)
-: d_metricId(metricId)
-, d_count(0)
-, d_total(0)
-, d_min(k_DEFAULT_MIN)
-, d_max(k_DEFAULT_MAX)
-, d_mutex()
+int IntegerCollector::stripeIndex()
 {
-}
+    // Spread the threads over the stripes using the Fibonacci hash of their
+    // id.
 
-inline
-IntegerCollector::~IntegerCollector()
-{
-}
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                                     * 0x9E3779B97F4A7C15ULL;
 
-// MANIPULATORS
-inline
-void IntegerCollector::reset()
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = 0;
-    d_total = 0;
-    d_min   = k_DEFAULT_MIN;
-    d_max   = k_DEFAULT_MAX;
+    return static_cast<int>(hash >> (64 - k_NUM_STRIPES_LOG2));
 }
 
+// MANIPULATORS
 inline
 void IntegerCollector::update(int value)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    ++d_count;
-    d_total += value;
-    d_min = bsl::min(value, d_min);
-    d_max = bsl::max(value, d_max);
+    Stripe& stripe = d_stripes_p[stripeIndex()];
+
+    bsls::SpinLockGuard guard(&stripe.d_lock);
+    ++stripe.d_count;
+    stripe.d_total += value;
+    stripe.d_min = bsl::min(value, stripe.d_min);
+    stripe.d_max = bsl::max(value, stripe.d_max);
 }
 
 inline
@@ -258,24 +321,13 @@ void IntegerCollector::accumulateCountTotalMinMax(int count,
                                                   int min,
                                                   int max)
 {
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count += count;
-    d_total += total;
-    d_min   = bsl::min(min, d_min);
-    d_max   = bsl::max(max, d_max);
-}
+    Stripe& stripe = d_stripes_p[stripeIndex()];
 
-inline
-void IntegerCollector::setCountTotalMinMax(int count,
-                                           int total,
-                                           int min,
-                                           int max)
-{
-    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
-    d_count = count;
-    d_total = total;
-    d_min   = min;
-    d_max   = max;
+    bsls::SpinLockGuard guard(&stripe.d_lock);
+    stripe.d_count += count;
+    stripe.d_total += total;
+    stripe.d_min   = bsl::min(min, stripe.d_min);
+    stripe.d_max   = bsl::max(max, stripe.d_max);
 }
 
 // ACCESSORS
@@ -19,6 +19,7 @@
 
 #include <bsls_types.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_functional.h>
 #include <bsl_ostream.h>
 #include <bsl_cstring.h>
@@ -63,7 +64,8 @@ using bsl::flush;
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 8] CONCURRENCY TEST
-// [ 9] USAGE EXAMPLE
+// [ 9] CONCURRENT UPDATES
+// [10] USAGE EXAMPLE
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACRO
@@ -216,6 +218,24 @@ void ConcurrencyTest::runTest()
     d_pool.drain();
 }
 
+void updateJob(balm::IntegerCollector *collector,
+               int                     threadIndex,
+               int                     numUpdates,
+               bslmt::Barrier         *barrier)
+    // Wait on the specified 'barrier', then invoke 'update' on the specified
+    // 'collector' the specified 'numUpdates' times with the values in the
+    // range '[1 .. numUpdates]' and, if the specified 'threadIndex' is 0, an
+    // additional time with the value '-numUpdates'.
+{
+    barrier->wait();
+    for (int i = 1; i <= numUpdates; ++i) {
+        collector->update(i);
+    }
+    if (0 == threadIndex) {
+        collector->update(-numUpdates);
+    }
+}
+
 // ============================================================================
 //                               USAGE EXAMPLE
 // ----------------------------------------------------------------------------
@@ -248,7 +268,7 @@ int main(int argc, char *argv[])
     Id metric_E(DESC_E); const Id& METRIC_E = metric_E;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 9: {
+      case 10: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //
@@ -303,6 +323,99 @@ int main(int argc, char *argv[])
 //..
 
       } break;
+      case 9: {
+        // --------------------------------------------------------------------
+        // CONCURRENT UPDATES
+        //
+        // Concerns:
+        //: 1 The values supplied to 'update' by different threads (which may
+        //:   be aggregated in different stripes) are all accounted for by
+        //:   'load' and 'loadAndReset'.
+        //:
+        //: 2 The minimum and maximum values loaded are those across all the
+        //:   threads.
+        //:
+        //: 3 No update is lost or counted twice when 'loadAndReset' is
+        //:   invoked concurrently with 'update'.
+        //
+        // Plan:
+        //: 1 Invoke 'update' from several threads, each supplying a known
+        //:   sequence of values, while the main thread repeatedly invokes
+        //:   'loadAndReset', and merges the loaded records.  Verify that the
+        //:   merged aggregates are those of all the values supplied.  (C-1..3)
+        //
+        // Testing:
+        //     CONCURRENT UPDATES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl << "CONCURRENT UPDATES" << endl
+                                  << "==================" << endl;
+
+        bslma::TestAllocator defaultAllocator;
+        bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+        const int NUM_THREADS = 12;
+        const int NUM_UPDATES = 5000;
+
+        for (int iteration = 0; iteration < 2; ++iteration) {
+            const bool RESET = 1 == iteration;
+
+            if (veryVerbose) { P(RESET) }
+
+            balm::IntegerCollector mX(METRIC_A);
+            const balm::IntegerCollector& X = mX;
+
+            int    count = 0;
+            double total = 0;
+            double min   = Rec::k_DEFAULT_MIN;
+            double max   = Rec::k_DEFAULT_MAX;
+            {
+                bslmt::Barrier         barrier(NUM_THREADS + 1);
+                bdlmt::FixedThreadPool pool(NUM_THREADS,
+                                            NUM_THREADS,
+                                            &defaultAllocator);
+                pool.start();
+                for (int i = 0; i < NUM_THREADS; ++i) {
+                    pool.enqueueJob(bdlf::BindUtil::bind(&updateJob,
+                                                         &mX,
+                                                         i,
+                                                         NUM_UPDATES,
+                                                         &barrier));
+                }
+                barrier.wait();
+
+                while (RESET && count < NUM_THREADS * NUM_UPDATES / 2) {
+                    Rec record;
+                    mX.loadAndReset(&record);
+
+                    ASSERT(METRIC_A == record.metricId());
+
+                    count += record.count();
+                    total += record.total();
+                    min   =  bsl::min(min, record.min());
+                    max   =  bsl::max(max, record.max());
+                }
+                pool.drain();
+            }
+
+            Rec record;
+            X.load(&record);
+
+            count += record.count();
+            total += record.total();
+            min   =  bsl::min(min, record.min());
+            max   =  bsl::max(max, record.max());
+
+            const double EXP_TOTAL = NUM_THREADS
+                                   * (NUM_UPDATES * (NUM_UPDATES + 1.0) / 2)
+                                   - NUM_UPDATES;
+
+            ASSERTV(count, NUM_THREADS * NUM_UPDATES + 1 == count);
+            ASSERTV(total, EXP_TOTAL                     == total);
+            ASSERTV(min,   -NUM_UPDATES                  == min);
+            ASSERTV(max,   NUM_UPDATES                   == max);
+        }
+      } break;
       case 8: {
         // --------------------------------------------------------------------
         // CONCURRENCY TEST
@@ -0,0 +1,551 @@
+// balst_heapprofilingallocator.cpp                                   -*-C++-*-
+#include <balst_heapprofilingallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(balst_heapprofilingallocator_cpp,"$Id$ $CSID$")
+
+#include <balst_stacktrace.h>
+#include <balst_stacktraceutil.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_once.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bslma_deallocatorproctor.h>
+#include <bslma_mallocfreeallocator.h>
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_stackaddressutil.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cmath.h>
+#include <bsl_ios.h>
+#include <bsl_limits.h>
+#include <bsl_ostream.h>
+#include <bsl_utility.h>
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <stdio.h>     // 'fopen', 'fgets', 'fclose'
+#endif
+
+namespace BloombergLP {
+namespace {
+
+typedef bsls::Types::Int64   Int64;
+typedef bsls::Types::Uint64  Uint64;
+typedef bsls::Types::UintPtr UintPtr;
+
+union Header {
+    // This 'union' defines the header preceding each block returned by
+    // 'HeapProfilingAllocator::allocate'.
+
+    struct {
+        void                   *d_record_p;  // statistics of the call stack
+                                             // of a sampled block, or 0 if
+                                             // the block is not sampled
+
+        bsls::Types::size_type  d_size;      // size of a sampled block, as
+                                             // requested
+    } d_sample;
+
+    bsls::AlignmentUtil::MaxAlignedType d_dummy;  // force alignment
+};
+
+BSLMF_ASSERT(0 == sizeof(Header) % bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+
+enum {
+    k_SKIPPED_FRAMES = bsls::StackAddressUtil::k_IGNORE_FRAMES + 1
+        // Frames not recorded at the top of a call stack: the frame of
+        // 'getStackAddresses', on platforms where it is reported, and the
+        // frame of 'allocate'.
+};
+
+// Define the constants of the linear congruential generator of sampling
+// intervals (from Knuth's MMIX).
+
+static const Uint64 k_MULTIPLIER = 6364136223846793005ULL;
+static const Uint64 k_INCREMENT  = 1442695040888963407ULL;
+static const Uint64 k_SEED       = 0x9e3779b97f4a7c15ULL;
+
+// Define a thread-local variable, 'g_intervalsUntilSample', (on supported
+// platforms) holding the number of sampling intervals remaining until the
+// next sample of the calling thread, or 0 if the thread has not drawn one
+// yet; on other platforms, the count is allocated, on first use, in
+// 'bslmt::ThreadUtil' thread-specific storage.
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(double, g_intervalsUntilSample, 0.0);
+#else
+void deleteCount(void *count)
+    // Deallocate the specified 'count' of a thread that is exiting.
+{
+    bslma::MallocFreeAllocator::singleton().deallocate(count);
+}
+
+const bslmt::ThreadUtil::Key& countKey()
+    // Return the key of the thread-specific count of the sampling intervals
+    // remaining until the next sample, creating it on first use.
+{
+    static bslmt::ThreadUtil::Key s_countKey;
+    BSLMT_ONCE_DO {
+        bslmt::ThreadUtil::createKey(&s_countKey, &deleteCount);
+    }
+    return s_countKey;
+}
+#endif
+
+inline
+double& intervalsUntilSample()
+    // Return a reference providing modifiable access to the number of
+    // sampling intervals remaining until the next sample of the calling
+    // thread, which is 0 if the thread has not drawn one yet.
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    return g_intervalsUntilSample;
+#else
+    const bslmt::ThreadUtil::Key& key = countKey();
+
+    double *count = static_cast<double *>(bslmt::ThreadUtil::getSpecific(key));
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == count)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        count = static_cast<double *>(
+              bslma::MallocFreeAllocator::singleton().allocate(sizeof *count));
+        *count = 0.0;
+
+        const int rc = bslmt::ThreadUtil::setSpecific(key, count);
+        BSLS_ASSERT_OPT(0 == rc);  (void)rc;
+    }
+    return *count;
+#endif
+}
+
+template <class ENTRY>
+bool greaterBytesInUse(const ENTRY& lhs, const ENTRY& rhs)
+    // Return 'true' if the specified 'lhs' has more estimated bytes in use
+    // than the specified 'rhs', and 'false' otherwise.
+{
+    return lhs.second.d_estimatedBytesInUse >
+                                            rhs.second.d_estimatedBytesInUse;
+}
+
+Int64 roundToInt64(double value)
+    // Return the specified non-negative 'value' rounded to the nearest
+    // integer.
+{
+    return static_cast<Int64>(value + 0.5);
+}
+
+}  // close unnamed namespace
+
+namespace balst {
+
+                        // ----------------------------
+                        // class HeapProfilingAllocator
+                        // ----------------------------
+
+// PRIVATE MANIPULATORS
+double HeapProfilingAllocator::nextSamplingDistance()
+{
+    d_randomState = d_randomState * k_MULTIPLIER + k_INCREMENT;
+
+    // Use the 53 high-order bits for a uniform value in '(0 .. 1)', and
+    // transform it into an exponentially distributed, positive, value.
+
+    const double uniform = (static_cast<double>(d_randomState >> 11) + 0.5)
+                         / 9007199254740992.0;  // 2^53
+
+    return -bsl::log(uniform);
+}
+
+// PRIVATE ACCESSORS
+double HeapProfilingAllocator::probability(size_type size) const
+{
+    if (0 == d_samplingInterval) {
+        return 1.0;                                                   // RETURN
+    }
+
+    return 1.0 - bsl::exp(-static_cast<double>(size) * d_inverseInterval);
+}
+
+void HeapProfilingAllocator::loadSnapshot(
+                                  bsl::vector<SnapshotEntry> *result,
+                                  bsls::Types::Int64         *numSamples,
+                                  double                     *bytesInUse) const
+{
+    BSLS_ASSERT(result);
+    BSLS_ASSERT(numSamples);
+    BSLS_ASSERT(bytesInUse);
+
+    result->clear();
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        result->reserve(d_stacks.size());
+        for (StackTable::const_iterator it = d_stacks.begin();
+                                        it != d_stacks.end();
+                                        ++it) {
+            result->push_back(SnapshotEntry(&it->first, it->second));
+        }
+
+        *numSamples = d_numSamplesInUse;
+        *bytesInUse = d_estimatedBytesInUse;
+    }
+
+    bsl::stable_sort(result->begin(),
+                     result->end(),
+                     &greaterBytesInUse<SnapshotEntry>);
+}
+
+// CREATORS
+HeapProfilingAllocator::HeapProfilingAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_samplingInterval(k_DEFAULT_SAMPLING_INTERVAL)
+, d_inverseInterval(1.0 / k_DEFAULT_SAMPLING_INTERVAL)
+, d_randomState(k_SEED)
+, d_stacks(basicAllocator ? basicAllocator
+                          : &bslma::MallocFreeAllocator::singleton())
+, d_numSamplesInUse(0)
+, d_estimatedBytesInUse(0.0)
+, d_mutex()
+, d_allocator_p(basicAllocator ? basicAllocator
+                               : &bslma::MallocFreeAllocator::singleton())
+{
+}
+
+HeapProfilingAllocator::HeapProfilingAllocator(
+                                       bsls::Types::Int64  samplingInterval,
+                                       bslma::Allocator   *basicAllocator)
+: d_samplingInterval(samplingInterval)
+, d_inverseInterval(samplingInterval
+                    ? 1.0 / static_cast<double>(samplingInterval)
+                    : bsl::numeric_limits<double>::infinity())
+, d_randomState(k_SEED)
+, d_stacks(basicAllocator ? basicAllocator
+                          : &bslma::MallocFreeAllocator::singleton())
+, d_numSamplesInUse(0)
+, d_estimatedBytesInUse(0.0)
+, d_mutex()
+, d_allocator_p(basicAllocator ? basicAllocator
+                               : &bslma::MallocFreeAllocator::singleton())
+{
+    BSLS_ASSERT_OPT(0 <= samplingInterval);
+}
+
+HeapProfilingAllocator::~HeapProfilingAllocator()
+{
+    BSLS_ASSERT(0 == d_numSamplesInUse);
+}
+
+// MANIPULATORS
+void *HeapProfilingAllocator::allocate(size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    Header *header = static_cast<Header *>(
+                               d_allocator_p->allocate(sizeof(Header) + size));
+
+    // The allocation exhausting the count of sampling intervals until the
+    // next sample of this thread is sampled.  Note that 'intervals' is
+    // infinite if the sampling interval is 0, so that every allocation is
+    // sampled.
+
+    double&      remaining = intervalsUntilSample();
+    const double previous  = remaining;
+    const double intervals = static_cast<double>(size) * d_inverseInterval;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0.0 == previous)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // This is the first allocation of this thread.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        remaining = nextSamplingDistance() - intervals;
+    }
+    else {
+        remaining = previous - intervals;
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0.0 < remaining)) {
+        header->d_sample.d_record_p = 0;
+        return header + 1;                                            // RETURN
+    }
+
+    BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+    bslma::DeallocatorProctor<bslma::Allocator> proctor(header, d_allocator_p);
+
+    void *frames[k_MAX_RECORDED_FRAMES + k_SKIPPED_FRAMES];
+    const int numFrames = bsl::max(
+                      bsls::StackAddressUtil::getStackAddresses(
+                                     frames,
+                                     k_MAX_RECORDED_FRAMES + k_SKIPPED_FRAMES),
+                      static_cast<int>(k_SKIPPED_FRAMES));
+
+    const double p = probability(size);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    remaining = nextSamplingDistance();
+
+    Stack stack(frames + k_SKIPPED_FRAMES, frames + numFrames, d_allocator_p);
+
+    StackTable::iterator it = d_stacks.find(stack);
+    if (d_stacks.end() == it) {
+        const StackRecord empty = { 0, 0, 0, 0, 0.0, 0.0, 0.0, 0.0 };
+
+        it = d_stacks.insert(StackTable::value_type(stack,
+                                                    empty,
+                                                    d_allocator_p)).first;
+    }
+
+    StackRecord& record = it->second;
+
+    ++record.d_numSamplesInUse;
+    ++record.d_numSamplesAllocated;
+    record.d_numSampledBytesInUse      += size;
+    record.d_numSampledBytesAllocated  += size;
+    record.d_estimatedBlocksInUse      += 1.0 / p;
+    record.d_estimatedBytesInUse       += size / p;
+    record.d_estimatedBlocksAllocated  += 1.0 / p;
+    record.d_estimatedBytesAllocated   += size / p;
+
+    ++d_numSamplesInUse;
+    d_estimatedBytesInUse += size / p;
+
+    header->d_sample.d_record_p = &record;
+    header->d_sample.d_size     = size;
+
+    proctor.release();
+
+    return header + 1;
+}
+
+void HeapProfilingAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header *header = static_cast<Header *>(address) - 1;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(header->d_sample.d_record_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        StackRecord     *record = static_cast<StackRecord *>(
+                                                  header->d_sample.d_record_p);
+        const size_type  size   = header->d_sample.d_size;
+        const double     p      = probability(size);
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        BSLS_ASSERT(0 < record->d_numSamplesInUse);
+
+        --record->d_numSamplesInUse;
+        record->d_numSampledBytesInUse -= size;
+        --d_numSamplesInUse;
+
+        // Reset the estimates when no sample is left, so that rounding errors
+        // do not accumulate.
+
+        if (0 == record->d_numSamplesInUse) {
+            record->d_estimatedBlocksInUse = 0.0;
+            record->d_estimatedBytesInUse  = 0.0;
+        }
+        else {
+            record->d_estimatedBlocksInUse -= 1.0 / p;
+            record->d_estimatedBytesInUse  -= size / p;
+        }
+
+        if (0 == d_numSamplesInUse) {
+            d_estimatedBytesInUse = 0.0;
+        }
+        else {
+            d_estimatedBytesInUse -= size / p;
+        }
+    }
+
+    d_allocator_p->deallocate(header);
+}
+
+// ACCESSORS
+bsls::Types::Int64 HeapProfilingAllocator::estimatedBytesInUse() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return roundToInt64(d_estimatedBytesInUse);
+}
+
+int HeapProfilingAllocator::numStacks() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return static_cast<int>(d_stacks.size());
+}
+
+bsls::Types::Int64 HeapProfilingAllocator::numSamplesInUse() const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_numSamplesInUse;
+}
+
+void HeapProfilingAllocator::printProfile(bsl::ostream& stream,
+                                          int           maxNumStacks) const
+{
+    bsl::vector<SnapshotEntry> snapshot(d_allocator_p);
+    Int64                      numSamples;
+    double                     bytesInUse;
+
+    loadSnapshot(&snapshot, &numSamples, &bytesInUse);
+
+    // The stacks having blocks in use come first.
+
+    int    numLiveStacks = 0;
+    double blocksInUse   = 0.0;
+    for (bsl::size_t i = 0; i < snapshot.size(); ++i) {
+        if (0 < snapshot[i].second.d_numSamplesInUse) {
+            ++numLiveStacks;
+            blocksInUse += snapshot[i].second.d_estimatedBlocksInUse;
+        }
+    }
+
+    stream << "Heap profile: sampling interval " << d_samplingInterval
+           << " bytes\n"
+           << "Estimated " << roundToInt64(bytesInUse) << " byte(s) in "
+           << roundToInt64(blocksInUse) << " block(s) in use, from "
+           << numLiveStacks << " stack(s).\n";
+
+    if (0 <= maxNumStacks && maxNumStacks < numLiveStacks) {
+        numLiveStacks = maxNumStacks;
+    }
+
+    StackTrace stackTrace(d_allocator_p);
+    for (int i = 0; i < numLiveStacks; ++i) {
+        const Stack&       stack  = *snapshot[i].first;
+        const StackRecord& record = snapshot[i].second;
+
+        stream << "----------------------------------------"
+               << "---------------------------------------\n"
+               << "Stack " << i + 1 << ": estimated "
+               << roundToInt64(record.d_estimatedBytesInUse)
+               << " byte(s) in "
+               << roundToInt64(record.d_estimatedBlocksInUse)
+               << " block(s) in use, " << record.d_numSamplesInUse
+               << " sample(s).\n";
+
+        stackTrace.removeAll();
+
+        const int rc = stack.empty()
+                     ? -1
+                     : StackTraceUtil::loadStackTraceFromAddressArray(
+                                                  &stackTrace,
+                                                  &stack[0],
+                                                  static_cast<int>(
+                                                                stack.size()));
+        if (0 != rc || 0 == stackTrace.length()) {
+            stream << "... stack trace failed ...\n";
+        }
+        else {
+            StackTraceUtil::printFormatted(stream, stackTrace);
+        }
+    }
+
+    stream << bsl::flush;
+}
+
+bsls::Types::Int64 HeapProfilingAllocator::samplingInterval() const
+{
+    return d_samplingInterval;
+}
+
+void HeapProfilingAllocator::writeProfile(bsl::ostream& stream) const
+{
+    bsl::vector<SnapshotEntry> snapshot(d_allocator_p);
+    Int64                      numSamples;
+    double                     bytesInUse;
+
+    loadSnapshot(&snapshot, &numSamples, &bytesInUse);
+
+    Int64 totals[4] = { 0, 0, 0, 0 };
+    for (bsl::size_t i = 0; i < snapshot.size(); ++i) {
+        const StackRecord& record = snapshot[i].second;
+
+        totals[0] += record.d_numSamplesInUse;
+        totals[1] += record.d_numSampledBytesInUse;
+        totals[2] += record.d_numSamplesAllocated;
+        totals[3] += record.d_numSampledBytesAllocated;
+    }
+
+    // A rate of 1 tells 'pprof' that every allocation was sampled.
+
+    stream << "heap profile: " << totals[0] << ": " << totals[1]
+           << " [" << totals[2] << ": " << totals[3] << "] @ heap_v2/"
+           << (d_samplingInterval ? d_samplingInterval : 1) << '\n';
+
+    for (bsl::size_t i = 0; i < snapshot.size(); ++i) {
+        const Stack&       stack  = *snapshot[i].first;
+        const StackRecord& record = snapshot[i].second;
+
+        stream << record.d_numSamplesInUse << ": "
+               << record.d_numSampledBytesInUse << " ["
+               << record.d_numSamplesAllocated << ": "
+               << record.d_numSampledBytesAllocated << "] @";
+
+        for (bsl::size_t j = 0; j < stack.size(); ++j) {
+            stream << " 0x" << bsl::hex
+                   << reinterpret_cast<UintPtr>(stack[j]) << bsl::dec;
+        }
+        stream << '\n';
+    }
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+    // 'pprof' needs the memory map of the process to find the executable and
+    // the shared libraries the addresses belong to.
+
+    FILE *maps = fopen("/proc/self/maps", "r");
+    if (maps) {
+        stream << "\nMAPPED_LIBRARIES:\n";
+
+        char line[1024];
+        while (fgets(line, sizeof line, maps)) {
+            stream << line;
+        }
+        fclose(maps);
+    }
+
+#endif
+
+    stream << bsl::flush;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,431 @@
+// balst_heapprofilingallocator.h                                     -*-C++-*-
+#ifndef INCLUDED_BALST_HEAPPROFILINGALLOCATOR
+#define INCLUDED_BALST_HEAPPROFILINGALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator adaptor sampling allocations by call stack.
+//
+//@CLASSES:
+//  balst::HeapProfilingAllocator: sampling heap profiler allocator adaptor
+//
+//@SEE_ALSO: balst_stacktracetestallocator, balst_stacktraceutil
+//
+//@DESCRIPTION: This component provides an allocator adaptor,
+// 'balst::HeapProfilingAllocator', that implements the 'bslma::Allocator'
+// protocol by forwarding each request to an underlying allocator supplied at
+// construction, and that records, for a random sample of the allocations, the
+// call stack at which they were made.  At any time, the allocator can write a
+// heap profile: the estimated number of blocks and bytes in use, and
+// allocated since construction, for each call stack.
+//..
+//   ,-----------------------------.
+//  ( balst::HeapProfilingAllocator )
+//   `-----------------------------'
+//                  |       ctor/dtor
+//                  |       printProfile
+//                  |       writeProfile
+//                  |       estimatedBytesInUse
+//                  |       numSamplesInUse
+//                  |       numStacks
+//                  |       samplingInterval
+//                  V
+//          ,----------------.
+//         ( bslma::Allocator )
+//          `----------------'
+//                          allocate
+//                          deallocate
+//..
+// Unlike 'balst::StackTraceTestAllocator', which records the call stack of
+// every allocation, this allocator is intended to be left enabled in
+// production: the cost of obtaining a call stack is only incurred, on
+// average, once every 'samplingInterval()' bytes allocated.
+//
+///Sampling
+///--------
+// Each thread maintains a count of the sampling intervals remaining until its
+// next sample, which each allocation of 's' bytes decrements by
+// 's / samplingInterval'.  The allocation that exhausts the count is sampled,
+// and the count is reset to a random value drawn from an exponential
+// distribution of mean 1.  An allocation of 's' bytes is thus sampled with
+// probability 'p = 1 - exp(-s / samplingInterval)', independently of the
+// allocations preceding it, so that large allocations are almost always
+// sampled, and small allocations rarely.  Each sample stands for '1 / p'
+// blocks, and 's / p' bytes, from which unbiased estimates of the blocks and
+// bytes allocated by each call stack are obtained.  A sampling interval of 0
+// samples every allocation, and the estimates are then exact.
+//
+// The count is kept in thread-local storage ('BSLMT_THREAD_LOCAL_VARIABLE'
+// where the platform supports it, and 'bslmt::ThreadUtil' thread-specific
+// storage otherwise), so that an allocation that is not sampled writes to no
+// memory shared with other threads.  Since the count is expressed in
+// sampling intervals, and the exponential distribution is memoryless, a
+// thread can share its count between all the heap profiling allocators it
+// allocates from, whatever their sampling intervals, without biasing the
+// probability of sampling any allocation.
+//
+///Overhead
+///--------
+// Each block is preceded by a header of 'bsls::AlignmentUtil::
+// BSLS_MAX_ALIGNMENT' bytes, and the allocation of a block that is not
+// sampled costs, in addition to the underlying allocation, a multiplication
+// and a subtraction on a thread-local count, and one store; its deallocation
+// costs one load.  No atomic operation is made, and no lock is taken, unless
+// the block is sampled, so that threads allocating concurrently do not
+// contend with one another.  A sample costs a few microseconds, mostly spent
+// obtaining the call stack, and updates the table of call stacks under a
+// mutex; with the default sampling interval of 512KB, this amounts to a few
+// nanoseconds per kilobyte allocated.  The table of call stacks, and the call
+// stacks themselves, are allocated from the underlying allocator.
+//
+///Heap Profiles
+///-------------
+// Two formats of heap profile are provided:
+//
+//: 'printProfile':
+//:   A human-readable report of the call stacks having blocks in use, largest
+//:   first, with symbols resolved by 'balst::StackTraceUtil'.  Resolving
+//:   symbols is expensive, and should be done sparingly.
+//:
+//: 'writeProfile':
+//:   The sampled counts of all call stacks, in the legacy text heap profile
+//:   format of 'gperftools' ("heap_v2"), followed, on Linux, by the memory
+//:   map of the process.  No symbols are resolved, so writing this profile is
+//:   cheap, and the profile can be analyzed off-line by 'pprof', which scales
+//:   the sampled counts in the same way as described above.
+//
+// Both methods copy the statistics of the call stacks before writing them, so
+// that writing the profile does not hold a lock that would be needed by an
+// allocation made by the stream.
+//
+///Choosing the Underlying Allocator
+///---------------------------------
+// If no allocator is supplied at construction, the
+// 'bslma::MallocFreeAllocator' singleton is used, rather than the default
+// allocator, so that a heap profiling allocator can be installed as the
+// default allocator.
+//
+///Thread Safety
+///-------------
+// The 'balst::HeapProfilingAllocator' class is fully thread-safe (see
+// 'bsldoc_glossary'), provided that the underlying allocator is fully
+// thread-safe.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the Largest Consumer of Memory
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a long-running service grows steadily, and we want to find out
+// which of its code paths holds on to the memory.  We install a heap
+// profiling allocator in front of the allocator used by the service.
+//
+// First, we define two functions allocating memory, one of which keeps what it
+// allocates:
+//..
+//  void *cacheRecord(bsl::vector<void *> *cache, bslma::Allocator *allocator)
+//      // Allocate a record from the specified 'allocator' and keep it in the
+//      // specified 'cache'.
+//  {
+//      cache->push_back(allocator->allocate(1000));
+//      return cache->back();
+//  }
+//
+//  void processRequest(bslma::Allocator *allocator)
+//      // Allocate a temporary buffer from the specified 'allocator' and
+//      // release it.
+//  {
+//      allocator->deallocate(allocator->allocate(1000));
+//  }
+//..
+// Then, we create a heap profiling allocator sampling, on average, one
+// allocation for every 16KB allocated:
+//..
+//  balst::HeapProfilingAllocator profiler(16 * 1024);
+//
+//  assert(16 * 1024 == profiler.samplingInterval());
+//..
+// Next, we run our service, which allocates about 100MB, and keeps about 10MB:
+//..
+//  bsl::vector<void *> cache;
+//  for (int i = 0; i < 100 * 1000; ++i) {
+//      if (0 == i % 10) {
+//          cacheRecord(&cache, &profiler);
+//      }
+//      else {
+//          processRequest(&profiler);
+//      }
+//  }
+//..
+// Then, we observe that the allocator estimates that about 10MB are in use,
+// from about 600 samples:
+//..
+//  const bsls::Types::Int64 bytesInUse = profiler.estimatedBytesInUse();
+//
+//  assert( 8 * 1000 * 1000 < bytesInUse);
+//  assert(12 * 1000 * 1000 > bytesInUse);
+//  assert(400 < profiler.numSamplesInUse());
+//..
+// Now, we write a human-readable heap profile, which shows the call stack of
+// 'cacheRecord' as holding all the memory in use:
+//..
+//  bsl::ostringstream report;
+//  profiler.printProfile(report);
+//..
+// The report looks like this (with the stack trace abbreviated):
+//..
+//  Heap profile: sampling interval 16384 bytes
+//  Estimated 10454344 byte(s) in 10454 block(s) in use, from 1 stack(s).
+//  ---------------------------------------------------------------------------
+//  Stack 1: estimated 10454344 byte(s) in 10454 block(s) in use, 619
+//  sample(s).
+//  (0): cacheRecord(bsl::vector<void*>*, BloombergLP::bslma::Allocator*)+0x2a
+//  (1): main+0x1e7
+//  ...
+//..
+// Finally, we write a heap profile for 'pprof', and release the cache:
+//..
+//  bsl::ostringstream profile;
+//  profiler.writeProfile(profile);
+//
+//  assert(0 == profile.str().find("heap profile: "));
+//
+//  for (bsl::size_t i = 0; i < cache.size(); ++i) {
+//      profiler.deallocate(cache[i]);
+//  }
+//  assert(0 == profiler.numSamplesInUse());
+//..
+
+#ifndef INCLUDED_BALSCM_VERSION
+#include <balscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+#ifndef INCLUDED_BSL_MAP
+#include <bsl_map.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace balst {
+
+                        // ============================
+                        // class HeapProfilingAllocator
+                        // ============================
+
+class HeapProfilingAllocator : public bslma::Allocator {
+    // This class defines an allocator adaptor that implements the
+    // 'bslma::Allocator' protocol by forwarding to an underlying allocator,
+    // and that records the call stacks of a random sample of the allocations,
+    // from which a heap profile can be written at any time.
+
+  public:
+    // PUBLIC TYPES
+    enum {
+        k_DEFAULT_SAMPLING_INTERVAL = 512 * 1024,  // average number of bytes
+                                                   // allocated between two
+                                                   // samples
+
+        k_MAX_RECORDED_FRAMES       = 32           // maximum depth of a
+                                                   // recorded call stack
+    };
+
+  private:
+    // PRIVATE TYPES
+    struct StackRecord {
+        // This 'struct' holds the statistics of the samples taken at a call
+        // stack.
+
+        bsls::Types::Int64 d_numSamplesInUse;        // sampled blocks in use
+
+        bsls::Types::Int64 d_numSampledBytesInUse;   // bytes of sampled
+                                                     // blocks in use
+
+        bsls::Types::Int64 d_numSamplesAllocated;    // blocks ever sampled
+
+        bsls::Types::Int64 d_numSampledBytesAllocated;
+                                                     // bytes of blocks ever
+                                                     // sampled
+
+        double             d_estimatedBlocksInUse;   // estimated blocks and
+        double             d_estimatedBytesInUse;    // bytes in use
+
+        double             d_estimatedBlocksAllocated;
+        double             d_estimatedBytesAllocated;
+                                                     // estimated blocks and
+                                                     // bytes ever allocated
+    };
+
+    typedef bsl::vector<void *>                      Stack;
+    typedef bsl::map<Stack, StackRecord>             StackTable;
+
+    // Call stacks are never removed from the table before destruction, so a
+    // snapshot can refer to them without copying them.
+
+    typedef bsl::pair<const Stack *, StackRecord>    SnapshotEntry;
+
+    // DATA
+    const bsls::Types::Int64  d_samplingInterval;  // mean of the number of
+                                                   // bytes between samples
+
+    const double              d_inverseInterval;   // '1 / d_samplingInterval',
+                                                   // or infinity if
+                                                   // 'd_samplingInterval' is
+                                                   // 0
+
+    bsls::Types::Uint64       d_randomState;       // state of the generator
+                                                   // of sampling intervals
+
+    StackTable                d_stacks;            // statistics by call stack
+
+    bsls::Types::Int64        d_numSamplesInUse;   // sampled blocks in use
+
+    double                    d_estimatedBytesInUse;
+                                                   // estimated bytes in use
+
+    mutable bslmt::Mutex      d_mutex;             // guard the random state,
+                                                   // the table, and the
+                                                   // totals
+
+    bslma::Allocator         *d_allocator_p;       // underlying allocator
+                                                   // (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    HeapProfilingAllocator(const HeapProfilingAllocator&);
+    HeapProfilingAllocator& operator=(const HeapProfilingAllocator&);
+
+  private:
+    // PRIVATE MANIPULATORS
+    double nextSamplingDistance();
+        // Return a positive number of sampling intervals drawn from an
+        // exponential distribution of mean 1.  The behavior is undefined
+        // unless 'd_mutex' is locked by the calling thread.
+
+    // PRIVATE ACCESSORS
+    double probability(size_type size) const;
+        // Return the probability that an allocation of the specified 'size'
+        // is sampled.
+
+    void loadSnapshot(bsl::vector<SnapshotEntry> *result,
+                      bsls::Types::Int64         *numSamples,
+                      double                     *bytesInUse) const;
+        // Load, into the specified 'result', the address of each call stack
+        // and a copy of its statistics, ordered by decreasing estimated number
+        // of bytes in use, and load, into the specified 'numSamples' and
+        // 'bytesInUse', the number of samples in use and the estimated number
+        // of bytes in use.
+
+  public:
+    // CREATORS
+    explicit
+    HeapProfilingAllocator(bslma::Allocator *basicAllocator = 0);
+    explicit
+    HeapProfilingAllocator(bsls::Types::Int64  samplingInterval,
+                           bslma::Allocator   *basicAllocator = 0);
+        // Create a heap profiling allocator.  Optionally specify a
+        // 'samplingInterval', the average number of bytes allocated between
+        // two samples.  If 'samplingInterval' is not specified,
+        // 'k_DEFAULT_SAMPLING_INTERVAL' is used.  If 'samplingInterval' is 0,
+        // every allocation is sampled.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the
+        // 'bslma::MallocFreeAllocator' singleton is used.  The behavior is
+        // undefined unless '0 <= samplingInterval'.
+
+    virtual ~HeapProfilingAllocator();
+        // Destroy this allocator.  The behavior is undefined unless all the
+        // blocks allocated from this allocator have been deallocated.
+
+    // MANIPULATORS
+    virtual void *allocate(size_type size);
+        // Return a newly-allocated maximally-aligned block of memory of the
+        // specified 'size' (in bytes), obtained from the underlying allocator,
+        // and, if the allocation is sampled, record the call stack of the
+        // caller.  If 'size' is 0, a null pointer is returned with no other
+        // effect.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to the
+        // underlying allocator and, if its allocation was sampled, remove it
+        // from the blocks in use at its call stack.  If 'address' is 0, this
+        // function has no effect.  The behavior is undefined unless 'address'
+        // was allocated using this allocator object and has not already been
+        // deallocated.
+
+    // ACCESSORS
+    bsls::Types::Int64 estimatedBytesInUse() const;
+        // Return the estimated number of bytes in use, that is, allocated and
+        // not yet deallocated.
+
+    int numStacks() const;
+        // Return the number of distinct call stacks at which allocations have
+        // been sampled.
+
+    bsls::Types::Int64 numSamplesInUse() const;
+        // Return the number of sampled blocks in use.
+
+    void printProfile(bsl::ostream& stream, int maxNumStacks = -1) const;
+        // Write to the specified 'stream' a human-readable heap profile
+        // listing the call stacks having blocks in use, with their estimated
+        // number of blocks and bytes in use, in decreasing order of the
+        // latter, and their resolved stack traces.  Optionally specify
+        // 'maxNumStacks', the maximum number of call stacks listed.  If
+        // 'maxNumStacks' is negative or not specified, all call stacks having
+        // blocks in use are listed.
+
+    bsls::Types::Int64 samplingInterval() const;
+        // Return the average number of bytes allocated between two samples,
+        // or 0 if every allocation is sampled.
+
+    void writeProfile(bsl::ostream& stream) const;
+        // Write to the specified 'stream' the sampled counts of all call
+        // stacks in the legacy text heap profile format of 'gperftools'
+        // ("heap_v2"), followed, on Linux, by the memory map of the process.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
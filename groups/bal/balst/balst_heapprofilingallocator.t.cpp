@@ -0,0 +1,1167 @@
+// balst_heapprofilingallocator.t.cpp                                 -*-C++-*-
+#include <balst_heapprofilingallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_mallocfreeallocator.h>              // for testing only
+#include <bslma_testallocator.h>
+#include <bslma_testallocatorexception.h>           // for testing only
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>   // 'min'
+#include <bsl_cmath.h>       // 'exp', 'fabs', 'sqrt'
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>     // 'memset'
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'balst::HeapProfilingAllocator' is an allocator adaptor that forwards to an
+// underlying allocator and records the call stacks of a random sample of the
+// allocations.  With a sampling interval of 0, every allocation is sampled,
+// which makes the statistics exact and lets us test the bookkeeping
+// deterministically; with a positive interval, we verify that the estimates
+// are close to the actual values over many allocations.  Symbol resolution is
+// tested by 'balst_stacktraceutil'; we only verify the layout of the heap
+// profiles here.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] explicit HeapProfilingAllocator(bslma::Allocator *ba = 0);
+// [ 2] HeapProfilingAllocator(Int64 samplingInterval, Allocator *ba = 0);
+// [ 2] ~HeapProfilingAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 3] bsls::Types::Int64 estimatedBytesInUse() const;
+// [ 3] int numStacks() const;
+// [ 3] bsls::Types::Int64 numSamplesInUse() const;
+// [ 5] void printProfile(bsl::ostream& stream, int maxNumStacks) const;
+// [ 2] bsls::Types::Int64 samplingInterval() const;
+// [ 5] void writeProfile(bsl::ostream& stream) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] SAMPLING ESTIMATES
+// [ 6] CONCURRENCY
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef balst::HeapProfilingAllocator Obj;
+typedef bsls::Types::Int64            Int64;
+typedef bsls::Types::UintPtr          UintPtr;
+
+static const int MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+void allocateAtSiteA(void             **blocks,
+                     int                numBlocks,
+                     bslma::Allocator  *allocator,
+                     int                size)
+    // Load into the specified 'blocks' the specified 'numBlocks' blocks of the
+    // specified 'size' allocated from the specified 'allocator', all with the
+    // same call stack.
+{
+    for (int i = 0; i < numBlocks; ++i) {
+        blocks[i] = allocator->allocate(size);
+    }
+}
+
+void allocateAtSiteB(void             **blocks,
+                     int                numBlocks,
+                     bslma::Allocator  *allocator,
+                     int                size)
+    // Load into the specified 'blocks' the specified 'numBlocks' blocks of the
+    // specified 'size' allocated from the specified 'allocator', all with the
+    // same call stack, distinct from that of the blocks allocated by
+    // 'allocateAtSiteA'.
+{
+    for (int i = 0; i < numBlocks; ++i) {
+        blocks[i] = allocator->allocate(size);
+        memset(blocks[i], 'b', size);
+    }
+}
+
+static
+int countLines(const bsl::string& text, const char *prefix)
+    // Return the number of lines of the specified 'text' starting with the
+    // specified 'prefix'.
+{
+    bsl::istringstream stream(text);
+    bsl::string        line;
+    int                count = 0;
+
+    while (bsl::getline(stream, line)) {
+        if (0 == line.find(prefix)) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+namespace TestCase6 {
+
+enum { k_NUM_THREADS = 4, k_NUM_ITERATIONS = 20000, k_NUM_SLOTS = 64 };
+
+extern "C" void *threadFunction(void *arg)
+    // Allocate and deallocate blocks of various sizes from the allocator at
+    // the specified 'arg', keeping up to 'k_NUM_SLOTS' of them in use, and
+    // checking that they are not shared.
+{
+    Obj *mX = static_cast<Obj *>(arg);
+
+    char *slots[k_NUM_SLOTS] = { 0 };
+    int   sizes[k_NUM_SLOTS] = { 0 };
+
+    unsigned seed = static_cast<unsigned>(reinterpret_cast<UintPtr>(&slots));
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        seed = seed * 1103515245 + 12345;
+
+        const int slot = (seed >> 16) % k_NUM_SLOTS;
+
+        if (slots[slot]) {
+            ASSERT(static_cast<char>(slot) == slots[slot][0]);
+            ASSERT(static_cast<char>(slot) == slots[slot][sizes[slot] - 1]);
+            mX->deallocate(slots[slot]);
+            slots[slot] = 0;
+        }
+        else {
+            sizes[slot] = 1 + (seed >> 8) % 2000;
+            slots[slot] = static_cast<char *>(mX->allocate(sizes[slot]));
+            memset(slots[slot], slot, sizes[slot]);
+        }
+    }
+
+    for (int slot = 0; slot < k_NUM_SLOTS; ++slot) {
+        mX->deallocate(slots[slot]);
+    }
+    return 0;
+}
+
+}  // close namespace TestCase6
+
+namespace TestCaseMinus1 {
+
+enum {
+    k_NUM_THREADS    = 4,
+    k_NUM_SLOTS      = 1024,
+    k_NUM_ITERATIONS = 20 * 1000 * 1000
+};
+
+void churn(bslma::Allocator *allocator, int numIterations)
+    // Allocate and deallocate the specified 'numIterations' blocks of random
+    // sizes from 8 to 512 bytes from the specified 'allocator', keeping a
+    // window of 'k_NUM_SLOTS' blocks in use.
+{
+    void     *slots[k_NUM_SLOTS] = { 0 };
+    unsigned  seed               = 1;
+
+    for (int i = 0; i < numIterations; ++i) {
+        seed = seed * 1103515245 + 12345;
+
+        const int slot = (seed >> 12) % k_NUM_SLOTS;
+
+        allocator->deallocate(slots[slot]);
+        slots[slot] = allocator->allocate(8 + (seed >> 20) % 505);
+    }
+    for (int slot = 0; slot < k_NUM_SLOTS; ++slot) {
+        allocator->deallocate(slots[slot]);
+    }
+}
+
+extern "C" void *churnThreadFunction(void *arg)
+    // Call 'churn' with the allocator at the specified 'arg', and
+    // 'k_NUM_ITERATIONS / k_NUM_THREADS' iterations.
+{
+    churn(static_cast<bslma::Allocator *>(arg),
+          k_NUM_ITERATIONS / k_NUM_THREADS);
+    return 0;
+}
+
+}  // close namespace TestCaseMinus1
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Finding the Largest Consumer of Memory
+///- - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that a long-running service grows steadily, and we want to find out
+// which of its code paths holds on to the memory.  We install a heap
+// profiling allocator in front of the allocator used by the service.
+//
+// First, we define two functions allocating memory, one of which keeps what it
+// allocates:
+//..
+    void *cacheRecord(bsl::vector<void *> *cache, bslma::Allocator *allocator)
+        // Allocate a record from the specified 'allocator' and keep it in the
+        // specified 'cache'.
+    {
+        cache->push_back(allocator->allocate(1000));
+        return cache->back();
+    }
+
+    void processRequest(bslma::Allocator *allocator)
+        // Allocate a temporary buffer from the specified 'allocator' and
+        // release it.
+    {
+        allocator->deallocate(allocator->allocate(1000));
+    }
+//..
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Then, we create a heap profiling allocator sampling, on average, one
+// allocation for every 16KB allocated:
+//..
+    balst::HeapProfilingAllocator profiler(16 * 1024);
+
+    ASSERT(16 * 1024 == profiler.samplingInterval());
+//..
+// Next, we run our service, which allocates about 100MB, and keeps about 10MB:
+//..
+    bsl::vector<void *> cache;
+    for (int i = 0; i < 100 * 1000; ++i) {
+        if (0 == i % 10) {
+            cacheRecord(&cache, &profiler);
+        }
+        else {
+            processRequest(&profiler);
+        }
+    }
+//..
+// Then, we observe that the allocator estimates that about 10MB are in use,
+// from about 600 samples:
+//..
+    const bsls::Types::Int64 bytesInUse = profiler.estimatedBytesInUse();
+
+    ASSERT( 8 * 1000 * 1000 < bytesInUse);
+    ASSERT(12 * 1000 * 1000 > bytesInUse);
+    ASSERT(400 < profiler.numSamplesInUse());
+//..
+// Now, we write a human-readable heap profile, which shows the call stack of
+// 'cacheRecord' as holding all the memory in use:
+//..
+    bsl::ostringstream report;
+    profiler.printProfile(report);
+//..
+// The report looks like this (with the stack trace abbreviated):
+//..
+//  Heap profile: sampling interval 16384 bytes
+//  Estimated 10454344 byte(s) in 10454 block(s) in use, from 1 stack(s).
+//  ---------------------------------------------------------------------------
+//  Stack 1: estimated 10454344 byte(s) in 10454 block(s) in use, 619
+//  sample(s).
+//  (0): cacheRecord(bsl::vector<void*>*, BloombergLP::bslma::Allocator*)+0x2a
+//  (1): main+0x1e7
+//  ...
+//..
+// Finally, we write a heap profile for 'pprof', and release the cache:
+//..
+    bsl::ostringstream profile;
+    profiler.writeProfile(profile);
+
+    ASSERT(0 == profile.str().find("heap profile: "));
+
+    for (bsl::size_t i = 0; i < cache.size(); ++i) {
+        profiler.deallocate(cache[i]);
+    }
+    ASSERT(0 == profiler.numSamplesInUse());
+//..
+
+        if (verbose) {
+            P(bytesInUse);
+            cout << report.str();
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //   Ensure that 'allocate' and 'deallocate' are thread-safe.
+        //
+        // Concerns:
+        //: 1 Blocks allocated concurrently are not shared.
+        //:
+        //: 2 The statistics are consistent after concurrent allocations and
+        //:   deallocations, sampled or not.
+        //
+        // Plan:
+        //: 1 Create an allocator with a small sampling interval over a test
+        //:   allocator, and several threads that randomly allocate and
+        //:   deallocate blocks from it, writing a pattern into each block and
+        //:   checking it before deallocating the block.  (C-1)
+        //:
+        //: 2 Verify that, after the threads have deallocated all their
+        //:   blocks, no sample and no block is in use.  (C-2)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        using namespace TestCase6;
+
+        bslma::TestAllocator ta("underlying", veryVeryVerbose);
+
+        const Int64 INTERVALS[] = { 0, 256, 64 * 1024 };
+
+        for (int ii = 0; ii < 3; ++ii) {
+            Obj mX(INTERVALS[ii], &ta);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(&handles[i],
+                                                      &threadFunction,
+                                                      &mX));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+
+            if (verbose) { P_(INTERVALS[ii]) P(mX.numStacks()) }
+
+            ASSERTV(INTERVALS[ii], 0 == mX.numSamplesInUse());
+            ASSERTV(INTERVALS[ii], 0 == mX.estimatedBytesInUse());
+            ASSERTV(INTERVALS[ii], 0 <  mX.numStacks());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // HEAP PROFILES
+        //   Ensure that the heap profiles have the documented layout.
+        //
+        // Concerns:
+        //: 1 'writeProfile' writes a header line with the total sampled
+        //:   counts and the sampling interval, followed by one line per call
+        //:   stack with its sampled counts and addresses.
+        //:
+        //: 2 A sampling interval of 0 is written as a rate of 1.
+        //:
+        //: 3 'printProfile' writes a summary, and one section per call stack
+        //:   having blocks in use, largest first, up to 'maxNumStacks'.
+        //:
+        //: 4 Neither method allocates from the default allocator.
+        //
+        // Plan:
+        //: 1 With a sampling interval of 0, allocate blocks at two call
+        //:   sites, deallocate some, and verify the lines written by
+        //:   'writeProfile' and 'printProfile'.  (C-1..3)
+        //:
+        //: 2 Verify that the default allocator is not used.  (C-4)
+        //
+        // Testing:
+        //   void printProfile(bsl::ostream& stream, int maxNumStacks) const;
+        //   void writeProfile(bsl::ostream& stream) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "HEAP PROFILES" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVerbose);
+        bslma::TestAllocator sa("stream", veryVeryVerbose);
+
+        Obj mX(0, &ta);  const Obj& X = mX;
+
+        void *a[3];
+        void *b[2];
+        allocateAtSiteA(a, 3, &mX, 100);
+        allocateAtSiteB(b, 2, &mX, 1000);
+        mX.deallocate(a[2]);
+
+        ASSERT(2 == X.numStacks());
+
+        if (verbose) cout << "\nTesting 'writeProfile'." << endl;
+        {
+            bsl::ostringstream out(&sa);
+
+            const Int64 NUM_DEFAULT = defaultAllocator.numBlocksTotal();
+            X.writeProfile(out);
+            ASSERT(NUM_DEFAULT == defaultAllocator.numBlocksTotal());
+
+            const bsl::string profile(out.str(), &sa);
+
+            if (veryVerbose) cout << profile;
+
+            ASSERT(0 == profile.find(
+                           "heap profile: 4: 2200 [5: 2300] @ heap_v2/1\n"));
+
+            ASSERT(1 == countLines(profile, "2: 200 [3: 300] @ 0x"));
+            ASSERT(1 == countLines(profile, "2: 2000 [2: 2000] @ 0x"));
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+            ASSERT(1 == countLines(profile, "MAPPED_LIBRARIES:"));
+#endif
+        }
+
+        if (verbose) cout << "\nTesting 'printProfile'." << endl;
+        {
+            bsl::ostringstream out(&sa);
+
+            const Int64 NUM_DEFAULT = defaultAllocator.numBlocksTotal();
+            X.printProfile(out);
+            ASSERT(NUM_DEFAULT == defaultAllocator.numBlocksTotal());
+
+            const bsl::string report(out.str(), &sa);
+
+            if (veryVerbose) cout << report;
+
+            ASSERT(0 == report.find(
+                         "Heap profile: sampling interval 0 bytes\n"
+                         "Estimated 2200 byte(s) in 4 block(s) in use, from 2"
+                         " stack(s).\n"));
+
+            ASSERT(1 == countLines(report, "Stack 1: estimated 2000 byte(s)"
+                                           " in 2 block(s) in use, 2"
+                                           " sample(s)."));
+            ASSERT(1 == countLines(report, "Stack 2: estimated 200 byte(s)"
+                                           " in 2 block(s) in use, 2"
+                                           " sample(s)."));
+        }
+
+        if (verbose) cout << "\nTesting 'maxNumStacks'." << endl;
+        {
+            for (int max = -1; max <= 3; ++max) {
+                bsl::ostringstream out(&sa);
+                X.printProfile(out, max);
+
+                const int EXP = 0 <= max && max < 2 ? max : 2;
+
+                ASSERTV(max, EXP == countLines(out.str(), "Stack "));
+            }
+        }
+
+        if (verbose) cout << "\nTesting stacks without blocks in use." << endl;
+        {
+            mX.deallocate(b[0]);
+            mX.deallocate(b[1]);
+
+            bsl::ostringstream out(&sa);
+            X.printProfile(out);
+
+            ASSERT(1 == countLines(out.str(), "Stack "));
+            ASSERT(1 == countLines(out.str(), "Stack 1: estimated 200 "));
+
+            bsl::ostringstream out2(&sa);
+            X.writeProfile(out2);
+
+            ASSERT(1 == countLines(out2.str(), "0: 0 [2: 2000] @ 0x"));
+        }
+
+        mX.deallocate(a[0]);
+        mX.deallocate(a[1]);
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // SAMPLING ESTIMATES
+        //   Ensure that the estimates obtained from the samples are close to
+        //   the actual values.
+        //
+        // Concerns:
+        //: 1 The number of samples is close to its expected value,
+        //:   'sum(1 - exp(-size / interval))'.
+        //:
+        //: 2 The estimated number of bytes in use is close to the actual
+        //:   number, for small and large sizes relative to the sampling
+        //:   interval.
+        //:
+        //: 3 When all blocks are deallocated, the estimate is 0.
+        //:
+        //: 4 A thread allocating from several allocators having different
+        //:   sampling intervals samples the allocations from each of them
+        //:   with the expected probability.
+        //
+        // Plan:
+        //: 1 For several sampling intervals, allocate many blocks of random
+        //:   sizes, and compare the number of samples and the estimate with
+        //:   the expected values, allowing 5 standard deviations.  (C-1..2)
+        //:
+        //: 2 Deallocate half of the blocks, and compare again.  (C-2)
+        //:
+        //: 3 Deallocate all blocks, and verify that the statistics are 0.
+        //:   (C-3)
+        //:
+        //: 4 Alternate allocations of random sizes from two allocators with
+        //:   different sampling intervals, and compare the number of samples
+        //:   of each with its expected value.  (C-4)
+        //
+        // Testing:
+        //   SAMPLING ESTIMATES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "SAMPLING ESTIMATES" << endl
+                          << "==================" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVerbose);
+
+        const Int64 INTERVALS[] = { 1024, 16 * 1024, 512 * 1024 };
+        const int   MAX_SIZES[] = { 64, 4096, 300 * 1000 };
+
+        for (int ii = 0; ii < 3; ++ii) {
+            for (int si = 0; si < 3; ++si) {
+                const Int64 INTERVAL = INTERVALS[ii];
+                const int   MAX_SIZE = MAX_SIZES[si];
+
+                // Keep the expected number of samples around 2500.
+
+                const int NUM_BLOCKS = static_cast<int>(bsl::min<double>(
+                           200 * 1000,
+                           2500.0 / (1.0 - exp(-MAX_SIZE / 2.0 / INTERVAL))));
+
+                Obj mX(INTERVAL, &ta);  const Obj& X = mX;
+
+                bsl::vector<void *> blocks(&ta);
+                bsl::vector<int>    sizes(&ta);
+
+                unsigned seed      = 42;
+                double   expected  = 0.0;
+                double   variance  = 0.0;
+                Int64    totalSize = 0;
+
+                for (int i = 0; i < NUM_BLOCKS; ++i) {
+                    seed = seed * 1103515245 + 12345;
+
+                    const int    SIZE = 1 + (seed >> 8) % MAX_SIZE;
+                    const double p    = 1.0 - exp(-SIZE / (double)INTERVAL);
+
+                    blocks.push_back(mX.allocate(SIZE));
+                    sizes.push_back(SIZE);
+
+                    expected  += p;
+                    variance  += p * (1 - p);
+                    totalSize += SIZE;
+                }
+
+                const double numSamples = static_cast<double>(
+                                                         X.numSamplesInUse());
+                const double estimate   = static_cast<double>(
+                                                     X.estimatedBytesInUse());
+                const double sd         = sqrt(variance);
+
+                if (verbose) {
+                    P_(INTERVAL) P_(MAX_SIZE) P(NUM_BLOCKS)
+                    T_ P_(expected) P_(numSamples) P_(totalSize) P(estimate)
+                }
+
+                ASSERTV(INTERVAL, MAX_SIZE, expected, numSamples,
+                        fabs(numSamples - expected) < 5 * sd + 1);
+
+                // The relative error of the estimate is about
+                // '1 / sqrt(expected)' for sizes much smaller than the
+                // interval, and smaller otherwise.
+
+                const double TOLERANCE = bsl::max(0.12, 5 / sqrt(expected));
+
+                ASSERTV(INTERVAL, MAX_SIZE, totalSize, estimate,
+                        fabs(estimate - totalSize) < TOLERANCE * totalSize);
+
+                for (int i = 0; i < NUM_BLOCKS; i += 2) {
+                    mX.deallocate(blocks[i]);
+                    totalSize -= sizes[i];
+                }
+
+                const double estimate2 = static_cast<double>(
+                                                     X.estimatedBytesInUse());
+
+                ASSERTV(INTERVAL, MAX_SIZE, totalSize, estimate2,
+                        fabs(estimate2 - totalSize) <
+                                             1.5 * TOLERANCE * totalSize);
+
+                for (int i = 1; i < NUM_BLOCKS; i += 2) {
+                    mX.deallocate(blocks[i]);
+                }
+
+                ASSERTV(INTERVAL, MAX_SIZE, 0 == X.numSamplesInUse());
+                ASSERTV(INTERVAL, MAX_SIZE, 0 == X.estimatedBytesInUse());
+                ASSERTV(INTERVAL, MAX_SIZE, 1 == X.numStacks());
+            }
+        }
+
+        if (verbose) cout << "\nTesting interleaved allocators." << endl;
+        {
+            enum { k_NUM_BLOCKS = 100 * 1000, k_MAX_SIZE = 4096 };
+
+            const Int64 INTERVALS[] = { 1024, 64 * 1024 };
+
+            Obj mX(INTERVALS[0], &ta);  const Obj& X = mX;
+            Obj mY(INTERVALS[1], &ta);  const Obj& Y = mY;
+
+            Obj *const ALLOCATORS[] = { &mX, &mY };
+
+            bsl::vector<void *> blocks(&ta);
+            bsl::vector<int>    owners(&ta);
+
+            unsigned seed        = 7;
+            double   expected[2] = { 0.0, 0.0 };
+            double   variance[2] = { 0.0, 0.0 };
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                seed = seed * 1103515245 + 12345;
+
+                const int    SIZE  = 1 + (seed >> 8) % k_MAX_SIZE;
+                const int    OWNER = (seed >> 28) & 1;
+                const double p     = 1.0 - exp(-SIZE
+                                              / (double)INTERVALS[OWNER]);
+
+                blocks.push_back(ALLOCATORS[OWNER]->allocate(SIZE));
+                owners.push_back(OWNER);
+
+                expected[OWNER] += p;
+                variance[OWNER] += p * (1 - p);
+            }
+
+            const double numSamples[] = {
+                static_cast<double>(X.numSamplesInUse()),
+                static_cast<double>(Y.numSamplesInUse())
+            };
+
+            for (int j = 0; j < 2; ++j) {
+                if (verbose) {
+                    P_(INTERVALS[j]) P_(expected[j]) P(numSamples[j])
+                }
+
+                ASSERTV(INTERVALS[j], expected[j], numSamples[j],
+                        fabs(numSamples[j] - expected[j]) <
+                                                5 * sqrt(variance[j]) + 1);
+            }
+
+            for (int i = 0; i < k_NUM_BLOCKS; ++i) {
+                ALLOCATORS[owners[i]]->deallocate(blocks[i]);
+            }
+
+            ASSERT(0 == X.numSamplesInUse());
+            ASSERT(0 == Y.numSamplesInUse());
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE AND DEALLOCATE
+        //   Ensure that blocks are forwarded to the underlying allocator, and
+        //   that sampled blocks are accounted for by call stack.
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block of the requested
+        //:   size, obtained from the underlying allocator, and 'deallocate'
+        //:   returns it.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 With a sampling interval of 0, every allocation is sampled, and
+        //:   the statistics are exact.
+        //:
+        //: 4 Allocations at the same call site share a call stack, and
+        //:   allocations at different call sites do not.
+        //:
+        //: 5 'allocate' is exception-neutral: a failed allocation, sampled or
+        //:   not, leaves no block and no sample behind.
+        //
+        // Plan:
+        //: 1 Allocate blocks of sizes 1 to 100 from an allocator using a
+        //:   test allocator, verify their alignment, write over them, and
+        //:   verify the blocks in use in the test allocator.  (C-1)
+        //:
+        //: 2 Allocate 0 bytes and deallocate 0.  (C-2)
+        //:
+        //: 3 With a sampling interval of 0, allocate blocks at two call
+        //:   sites, and verify the number of samples, the estimated number of
+        //:   bytes in use, and the number of call stacks, as blocks are
+        //:   deallocated.  (C-3..4)
+        //:
+        //: 4 Allocate under the exception-test macros, with sampling
+        //:   intervals of 0 and the default.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(size_type size);
+        //   void deallocate(void *address);
+        //   bsls::Types::Int64 estimatedBytesInUse() const;
+        //   int numStacks() const;
+        //   bsls::Types::Int64 numSamplesInUse() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE AND DEALLOCATE" << endl
+                          << "=======================" << endl;
+
+        if (verbose) cout << "\nTesting alignment and forwarding." << endl;
+        {
+            bslma::TestAllocator ta("underlying", veryVeryVerbose);
+
+            Obj mX(&ta);
+
+            bsl::vector<void *> blocks;
+            for (int size = 1; size <= 100; ++size) {
+                void *p = mX.allocate(size);
+
+                ASSERTV(size, 0 == reinterpret_cast<UintPtr>(p) % MAX_ALIGN);
+                ASSERTV(size, size + MAX_ALIGN <= ta.lastAllocatedNumBytes());
+
+                memset(p, size, size);
+                blocks.push_back(p);
+            }
+            ASSERT(100 == ta.numBlocksInUse());
+
+            for (int i = 0; i < 100; ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting 'allocate(0)' and 'deallocate(0)'."
+                          << endl;
+        {
+            bslma::TestAllocator ta("underlying", veryVeryVerbose);
+
+            Obj mX(0, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            ASSERT(0 == ta.numBlocksTotal());
+            ASSERT(0 == X.numSamplesInUse());
+            ASSERT(0 == X.numStacks());
+        }
+
+        if (verbose) cout << "\nTesting exact statistics." << endl;
+        {
+            bslma::TestAllocator ta("underlying", veryVeryVerbose);
+
+            Obj mX(0, &ta);  const Obj& X = mX;
+
+            void *a[2];
+            allocateAtSiteA(a, 2, &mX, 20);
+            ASSERT(2  == X.numSamplesInUse());
+            ASSERT(40 == X.estimatedBytesInUse());
+            ASSERT(1  == X.numStacks());
+
+            void *b[1];
+            allocateAtSiteB(b, 1, &mX, 500);
+            ASSERT(3   == X.numSamplesInUse());
+            ASSERT(540 == X.estimatedBytesInUse());
+            ASSERT(2   == X.numStacks());
+
+            mX.deallocate(a[0]);
+            ASSERT(2   == X.numSamplesInUse());
+            ASSERT(520 == X.estimatedBytesInUse());
+
+            mX.deallocate(b[0]);
+            ASSERT(1   == X.numSamplesInUse());
+            ASSERT(20  == X.estimatedBytesInUse());
+
+            mX.deallocate(a[1]);
+            ASSERT(0 == X.numSamplesInUse());
+            ASSERT(0 == X.estimatedBytesInUse());
+            ASSERT(2 == X.numStacks());
+        }
+
+        if (verbose) cout << "\nTesting exception neutrality." << endl;
+        {
+            const Int64 INTERVALS[] = { 0, Obj::k_DEFAULT_SAMPLING_INTERVAL };
+
+            for (int ii = 0; ii < 2; ++ii) {
+                bslma::TestAllocator ta("underlying", veryVeryVerbose);
+
+                Obj mX(INTERVALS[ii], &ta);  const Obj& X = mX;
+
+                BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                    void *p;
+                    allocateAtSiteA(&p, 1, &mX, 1000);
+                    mX.deallocate(p);
+                } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+                ASSERTV(ii, 0 == X.numSamplesInUse());
+                ASSERTV(ii, 0 == X.estimatedBytesInUse());
+                ASSERTV(ii, X.numStacks() <= 1);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTOR, DTOR, AND 'samplingInterval'
+        //   Ensure that the allocator can be created with each constructor.
+        //
+        // Concerns:
+        //: 1 The default sampling interval is 'k_DEFAULT_SAMPLING_INTERVAL'.
+        //:
+        //: 2 The specified sampling interval, including 0, is reported by
+        //:   'samplingInterval'.
+        //:
+        //: 3 If no allocator is supplied, memory comes from neither the
+        //:   default nor the global allocator.
+        //:
+        //: 4 If an allocator is supplied, all memory comes from it.
+        //:
+        //: 5 The destructor releases the memory used for the call stacks.
+        //
+        // Plan:
+        //: 1 Create allocators with each constructor, with and without an
+        //:   allocator, and verify 'samplingInterval'.  (C-1..2)
+        //:
+        //: 2 Allocate from them with a sampling interval of 0, and verify
+        //:   which allocators are used.  (C-3..4)
+        //:
+        //: 3 Verify that no memory is in use in the supplied allocator after
+        //:   destruction.  (C-5)
+        //
+        // Testing:
+        //   explicit HeapProfilingAllocator(bslma::Allocator *ba = 0);
+        //   HeapProfilingAllocator(Int64 samplingInterval, Allocator *ba = 0);
+        //   ~HeapProfilingAllocator();
+        //   bsls::Types::Int64 samplingInterval() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTOR, DTOR, AND 'samplingInterval'" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator ga("global", veryVeryVerbose);
+        bslma::Default::setGlobalAllocator(&ga);
+
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::k_DEFAULT_SAMPLING_INTERVAL == X.samplingInterval());
+        }
+        {
+            const Int64 ZERO = 0;  // a literal 0 is also a null allocator
+
+            Obj mX(ZERO);  const Obj& X = mX;
+
+            ASSERT(0 == X.samplingInterval());
+
+            mX.deallocate(mX.allocate(100));
+            ASSERT(1 == X.numStacks());
+        }
+        {
+            Obj mX(12345);  const Obj& X = mX;
+
+            ASSERT(12345 == X.samplingInterval());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        ASSERT(0 == ga.numBlocksTotal());
+
+        {
+            bslma::TestAllocator ta("underlying", veryVeryVerbose);
+            {
+                Obj mX(&ta);  const Obj& X = mX;
+
+                ASSERT(Obj::k_DEFAULT_SAMPLING_INTERVAL ==
+                                                       X.samplingInterval());
+            }
+            {
+                Obj mX(0, &ta);  const Obj& X = mX;
+
+                ASSERT(0 == X.samplingInterval());
+
+                mX.deallocate(mX.allocate(100));
+
+                // The block, its call stack, and the node holding the call
+                // stack.
+
+                ASSERT(3 <= ta.numBlocksTotal());
+                ASSERT(2 <= ta.numBlocksInUse());
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksTotal());
+        ASSERT(0 == ga.numBlocksTotal());
+
+        bslma::Default::setGlobalAllocator(0);
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an allocator sampling every allocation, allocate and
+        //:   deallocate blocks, and write its heap profiles.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("underlying", veryVeryVerbose);
+
+        Obj mX(0, &ta);  const Obj& X = mX;
+
+        char *p = static_cast<char *>(mX.allocate(10));
+        memset(p, 'a', 10);
+
+        char *q = static_cast<char *>(mX.allocate(1000));
+        memset(q, 'b', 1000);
+
+        ASSERT(2    == X.numSamplesInUse());
+        ASSERT(1010 == X.estimatedBytesInUse());
+
+        mX.deallocate(p);
+
+        ASSERT(1    == X.numSamplesInUse());
+        ASSERT(1000 == X.estimatedBytesInUse());
+
+        bsl::ostringstream report(&ta);
+        X.printProfile(report);
+        if (veryVerbose) cout << report.str();
+
+        bsl::ostringstream profile(&ta);
+        X.writeProfile(profile);
+        if (veryVerbose) cout << profile.str();
+
+        mX.deallocate(q);
+
+        ASSERT(0 == X.numSamplesInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Measure the overhead of the heap profiling allocator.
+        //
+        // Concerns:
+        //: 1 With the default sampling interval, the overhead of the heap
+        //:   profiling allocator over its underlying allocator is small.
+        //:
+        //: 2 Threads allocating concurrently from the same heap profiling
+        //:   allocator do not contend with one another unless they sample.
+        //
+        // Plan:
+        //: 1 Time a loop allocating and deallocating blocks of random sizes
+        //:   from 8 to 512 bytes, keeping a window of 1024 blocks in use,
+        //:   directly from 'bslma::MallocFreeAllocator', and through heap
+        //:   profiling allocators with the default sampling interval and
+        //:   with smaller ones, and report the overhead.  (C-1)
+        //:
+        //: 2 Time the same loop, split between several threads sharing each
+        //:   allocator, and report the overhead in elapsed time.  (C-2)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        using namespace TestCaseMinus1;
+
+        bslma::Allocator *const base =
+                                 &bslma::MallocFreeAllocator::singleton();
+
+        Obj mDefault(base);
+        Obj mSmall(64 * 1024, base);
+        Obj mTiny(4 * 1024, base);
+
+        bslma::Allocator *const ALLOCATORS[] = {
+            base, &mDefault, &mSmall, &mTiny
+        };
+        const char *const NAMES[] = {
+            "malloc                   ",
+            "profiling, 512KB interval",
+            "profiling,  64KB interval",
+            "profiling,   4KB interval"
+        };
+        const int NUM_ALLOCATORS = sizeof NAMES / sizeof *NAMES;
+
+        double baseTime = 0.0;
+
+        // Repeat the measurements to reduce the noise.
+
+        for (int round = 0; round < 2; ++round) {
+            for (int a = 0; a < NUM_ALLOCATORS; ++a) {
+                bsls::Stopwatch timer;
+                timer.start(true);
+
+                churn(ALLOCATORS[a], k_NUM_ITERATIONS);
+
+                timer.stop();
+
+                const double time = timer.accumulatedUserTime()
+                                  + timer.accumulatedSystemTime();
+                if (0 == a) {
+                    baseTime = time;
+                }
+
+                cout << NAMES[a] << "  " << time << " s  ("
+                     << (time - baseTime) / baseTime * 100 << "%)" << endl;
+            }
+        }
+
+        cout << k_NUM_THREADS << " threads:" << endl;
+
+        for (int round = 0; round < 2; ++round) {
+            for (int a = 0; a < NUM_ALLOCATORS; ++a) {
+                bsls::Stopwatch timer;
+                timer.start();
+
+                bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                                       &handles[i],
+                                                       &churnThreadFunction,
+                                                       ALLOCATORS[a]));
+                }
+                for (int i = 0; i < k_NUM_THREADS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+                }
+
+                timer.stop();
+
+                const double time = timer.elapsedTime();
+                if (0 == a) {
+                    baseTime = time;
+                }
+
+                cout << NAMES[a] << "  " << time << " s  ("
+                     << (time - baseTime) / baseTime * 100 << "%)" << endl;
+            }
+        }
+
+        if (verbose) {
+            P(mDefault.numStacks());
+            P(mTiny.numStacks());
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -13,7 +13,7 @@
 BSLS_IDENT_RCSID(balxml_decoder_cpp,"$Id$ $CSID$")
 
 #include <balxml_elementattribute.h>
-#include <balxml_minireader.h>      // for testing purposes only
+#include <balxml_minireader.h>
 
 #include <bslalg_typetraits.h>
 
@@ -196,6 +196,7 @@ Decoder::Decoder(const DecoderOptions *options,
 , d_errorCount(0)
 , d_warningCount(0)
 , d_numUnknownElementsSkipped(0)
+, d_numBytesSkipped(0)
 , d_fatalError(false)
 , d_remainingDepth(1)
 {
@@ -220,6 +221,7 @@ Decoder::Decoder(const DecoderOptions *options,
 , d_errorCount(0)
 , d_warningCount(0)
 , d_numUnknownElementsSkipped(0)
+, d_numBytesSkipped(0)
 , d_fatalError(false)
 , d_remainingDepth(1)
 {
@@ -243,6 +245,7 @@ Decoder::resetErrors()
     d_warningCount = 0;
     d_fatalError = 0;
     d_numUnknownElementsSkipped = 0;
+    d_numBytesSkipped = 0;
 
     if (d_logStream != 0) {
         d_logStream->reset();
@@ -711,6 +714,40 @@ int Decoder_UnknownElementContext::parseSubElement(const char *,
     return beginParse(decoder);
 }
 
+// MANIPULATORS
+
+int Decoder_UnknownElementContext::skipElement(Decoder *decoder)
+{
+    enum { BAEXML_SUCCESS = 0, BAEXML_FAILURE = -1 };
+
+    MiniReader *miniReader = 0;
+    if (!decoder->options()->validateSkippedElements()) {
+        miniReader = dynamic_cast<MiniReader *>(decoder->reader());
+    }
+
+    if (0 == miniReader) {
+        return beginParse(decoder);                                   // RETURN
+    }
+
+    const int startPosition = miniReader->getCurrentPosition();
+
+    int rc1 = miniReader->skipToEndOfElement();
+    int rc2 = decoder->checkForReaderErrors();
+
+    if (rc1 != 0 || rc2 < 0) {
+        decoder->d_fatalError = true;
+        BALXML_DECODER_LOG_ERROR(decoder)
+            << "End of stream reached before element was done."
+            << BALXML_DECODER_LOG_END;
+
+        return BAEXML_FAILURE;                                        // RETURN
+    }
+
+    decoder->d_numBytesSkipped += miniReader->getCurrentPosition()
+                                - startPosition;
+    return BAEXML_SUCCESS;
+}
+
                        // ------------------------------
                        // class Decoder_StdStringContext
                        // ------------------------------
@@ -348,6 +348,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_objectbuffer.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_BSL_ALGORITHM
 #include <bsl_algorithm.h>            // bsl::min
 #endif
@@ -449,6 +453,7 @@ class Decoder {
     friend class  Decoder_ElementContext;
     friend struct Decoder_decodeImpProxy;
     friend class  Decoder_ErrorLogger;
+    friend class  Decoder_UnknownElementContext;
 
     // PRIVATE TYPES
     class MemOutStream : public bsl::ostream {
@@ -510,6 +515,9 @@ class Decoder {
                                                        // number of unknown
                                                        // elements skipped
 
+    bsls::Types::Uint64              d_numBytesSkipped;
+        // number of bytes of unknown elements skipped without validation
+
     bool                             d_fatalError;     // fatal error flag
     int                              d_remainingDepth;
         // remaining number of nesting levels allowed
@@ -682,6 +690,14 @@ class Decoder {
         // previous decoding operation.  Note that unknown elements are skipped
         // only if 'true == options()->skipUnknownElements()'.
 
+    bsls::Types::Uint64 numBytesSkipped() const;
+        // Return the number of bytes of input that were skipped, without
+        // being validated, as part of unknown elements during the previous
+        // decoding operation.  Note that unknown elements are skipped without
+        // validation only if 'true == options()->skipUnknownElements()',
+        // 'false == options()->validateSkippedElements()', and the reader is
+        // a 'MiniReader'.
+
     ErrorInfo::Severity  errorSeverity() const;
         // Return the severity of the most severe warning or error encountered
         // during the last call to the 'encode' method.  The severity is reset
@@ -1291,6 +1307,16 @@ class Decoder_UnknownElementContext : public Decoder_ElementContext {
                                Decoder     *decoder);
 
     virtual int parseSubElement(const char *elementName, Decoder *decoder);
+
+    // MANIPULATORS
+    int skipElement(Decoder *decoder);
+        // Skip the current element of the specified 'decoder', including all
+        // its sub-elements, and return 0 on success, and a non-zero value
+        // otherwise.  If 'decoder->options()->validateSkippedElements()' is
+        // 'false' and the reader of 'decoder' is a 'MiniReader', the element
+        // is skipped by 'MiniReader::skipToEndOfElement' without producing
+        // its nodes; otherwise, this method is equivalent to
+        // 'beginParse(decoder)'.
 };
 
                          // =========================
@@ -2023,6 +2049,12 @@ int Decoder::numUnknownElementsSkipped() const
     return d_numUnknownElementsSkipped;
 }
 
+inline
+bsls::Types::Uint64 Decoder::numBytesSkipped() const
+{
+    return d_numBytesSkipped;
+}
+
 inline
 bsl::ostream *Decoder::warningStream() const
 {
@@ -2279,7 +2311,7 @@ int Decoder_ChoiceContext<TYPE>::parseSubElement(const char *elementName,
         d_selectionName.assign(elementName, lenName);
 
         Decoder_UnknownElementContext unknownElement;
-        return unknownElement.beginParse(decoder);                    // RETURN
+        return unknownElement.skipElement(decoder);                   // RETURN
     }
 
     if (!wasSelectionNameKnown) {
@@ -2525,7 +2557,7 @@ int Decoder_SequenceContext<TYPE>::parseSubElement(const char *elementName,
         decoder->setNumUnknownElementsSkipped(
                                      decoder->numUnknownElementsSkipped() + 1);
         Decoder_UnknownElementContext unknownElement;
-        return unknownElement.beginParse(decoder);                    // RETURN
+        return unknownElement.skipElement(decoder);                   // RETURN
     }
 
     Decoder_ParseSequenceSubElement visitor(decoder, elementName, lenName);
@@ -3059,7 +3091,7 @@ int Decoder_ParseObject::executeImp(
             d_decoder->setNumUnknownElementsSkipped(
                                    d_decoder->numUnknownElementsSkipped() + 1);
             Decoder_UnknownElementContext unknownElement;
-            return unknownElement.beginParse(d_decoder);              // RETURN
+            return unknownElement.skipElement(d_decoder);             // RETURN
         }
 
         return bdlat_SequenceFunctions::manipulateAttribute(
@@ -3097,7 +3129,7 @@ int Decoder_ParseObject::executeImp(TYPE                       *object,
             d_decoder->setNumUnknownElementsSkipped(
                                    d_decoder->numUnknownElementsSkipped() + 1);
             Decoder_UnknownElementContext unknownElement;
-            return unknownElement.beginParse(d_decoder);              // RETURN
+            return unknownElement.skipElement(d_decoder);             // RETURN
         }
 
         if (0 != bdlat_ChoiceFunctions::makeSelection(
@@ -122,6 +122,7 @@ using namespace bsl;
 // [11] int balxml::Decoder::decode(istrm&, TYPE, ostrm&, ostrm&, b_A*);
 // [15] void setNumUnknownElementsSkipped(int value);
 // [15] int numUnknownElementsSkipped() const;
+// [15] bsls::Types::Uint64 numBytesSkipped() const;
 // [ 3] balxml::Decoder_SelectContext
 // [ 2] baexml_Decoder_ParserUtil
 // [ 5] baexml_Decoder_Base64Context
@@ -28030,12 +28031,17 @@ int main(int argc, char *argv[])
         //      elements correctly.
         //   c. Decoding of various functions correctly increments the number
         //      of unknown elements that are skipped.
+        //   d. If the 'ValidateSkippedElements' option is 'false', unknown
+        //      elements are skipped without being validated or counted
+        //      towards the maximum depth, and the numBytesSkipped returns the
+        //      number of bytes so skipped.
         //
         // Plan:
         //
         // Testing:
         //   void setNumUnknownElementsSkipped(int value);
         //   int numUnknownElementsSkipped() const;
+        //   bsls::Types::Uint64 numBytesSkipped() const;
         // --------------------------------------------------------------------
 
         if (verbose) cout << "\nFUNCTIONS related to skipped elements"
@@ -28467,6 +28473,68 @@ int main(int argc, char *argv[])
                            NUM_SKIPPED == decoder.numUnknownElementsSkipped());
             }
         }
+        if (verbose) cout << "\nTesting skipping without validation."
+                          << endl;
+        {
+            // The unknown element 'E3' is nested more deeply than the maximum
+            // depth, and its end tags do not match its start tags: it is
+            // skipped only if skipped elements are not validated.
+
+            const char SKIPPED[] = "<a x='>'><b><!-- </E3> -->"
+                                   "<c/></a></b>\n    </E3>";
+            bsl::string INPUT = "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n"
+                                "<TestSequence2 " XSI ">\n"
+                                "    <E3>";
+            INPUT += SKIPPED;
+            INPUT += "\n"
+                     "    <E1>123</E1>\n"
+                     "</TestSequence2>\n";
+
+            if (veryVerbose) {
+                T_ P(INPUT)
+            }
+
+            for (int validate = 0; validate < 2; ++validate) {
+                bsl::stringstream ss(INPUT);
+
+                TestSequence2 ts;
+
+                balxml::MiniReader     reader;
+                balxml::ErrorInfo      errInfo;
+                balxml::DecoderOptions options;
+                options.setMaxDepth(3);
+                options.setValidateSkippedElements(validate);
+
+                bsl::ostringstream errors;
+
+                balxml::Decoder mX(&options,
+                                   &reader,
+                                   &errInfo,
+                                   &errors,
+                                   &errors);
+                const balxml::Decoder& X = mX;
+                ASSERT(0 == X.numBytesSkipped());
+
+                mX.decode(ss, &ts);
+
+                LOOP_ASSERT(X.numUnknownElementsSkipped(),
+                            1 == X.numUnknownElementsSkipped());
+                if (validate) {
+                    LOOP_ASSERT(ss.fail(), ss.fail());
+                    LOOP_ASSERT(X.numBytesSkipped(),
+                                0 == X.numBytesSkipped());
+                }
+                else {
+                    LOOP2_ASSERT(ss.fail(), errors.str(), !ss.fail());
+                    LOOP_ASSERT(ts,
+                                ts == TestSequence2(
+                                           123,
+                                           TestSequence2::DEFAULT_ELEMENT2));
+                    LOOP_ASSERT(X.numBytesSkipped(),
+                                sizeof SKIPPED - 1 == X.numBytesSkipped());
+                }
+            }
+        }
       } break;
       case 14: {
         // --------------------------------------------------------------------
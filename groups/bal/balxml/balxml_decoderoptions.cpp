@@ -41,6 +41,8 @@ const int balxml::DecoderOptions::DEFAULT_INITIALIZER_FORMATTING_MODE = 0;
 
 const bool balxml::DecoderOptions::DEFAULT_INITIALIZER_SKIP_UNKNOWN_ELEMENTS = true;
 
+const bool balxml::DecoderOptions::DEFAULT_INITIALIZER_VALIDATE_SKIPPED_ELEMENTS = true;
+
 const bdlat_AttributeInfo balxml::DecoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
     {
         e_ATTRIBUTE_ID_MAX_DEPTH,
@@ -62,6 +64,13 @@ const bdlat_AttributeInfo balxml::DecoderOptions::ATTRIBUTE_INFO_ARRAY[] = {
         sizeof("SkipUnknownElements") - 1,
         "",
         bdlat_FormattingMode::e_TEXT
+    },
+    {
+        e_ATTRIBUTE_ID_VALIDATE_SKIPPED_ELEMENTS,
+        "ValidateSkippedElements",
+        sizeof("ValidateSkippedElements") - 1,
+        "",
+        bdlat_FormattingMode::e_TEXT
     }
 };
 
@@ -132,6 +141,35 @@ const bdlat_AttributeInfo *DecoderOptions::lookupAttributeInfo(
                                                                       // RETURN
             }
         } break;
+        case 23: {
+            if ((name[0]|0x20)=='v'
+             && (name[1]|0x20)=='a'
+             && (name[2]|0x20)=='l'
+             && (name[3]|0x20)=='i'
+             && (name[4]|0x20)=='d'
+             && (name[5]|0x20)=='a'
+             && (name[6]|0x20)=='t'
+             && (name[7]|0x20)=='e'
+             && (name[8]|0x20)=='s'
+             && (name[9]|0x20)=='k'
+             && (name[10]|0x20)=='i'
+             && (name[11]|0x20)=='p'
+             && (name[12]|0x20)=='p'
+             && (name[13]|0x20)=='e'
+             && (name[14]|0x20)=='d'
+             && (name[15]|0x20)=='e'
+             && (name[16]|0x20)=='l'
+             && (name[17]|0x20)=='e'
+             && (name[18]|0x20)=='m'
+             && (name[19]|0x20)=='e'
+             && (name[20]|0x20)=='n'
+             && (name[21]|0x20)=='t'
+             && (name[22]|0x20)=='s')
+            {
+                return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS];
+                                                                      // RETURN
+            }
+        } break;
     }
     return 0;
 }
@@ -145,6 +183,8 @@ const bdlat_AttributeInfo *DecoderOptions::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_FORMATTING_MODE];
       case e_ATTRIBUTE_ID_SKIP_UNKNOWN_ELEMENTS:
         return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS];
+      case e_ATTRIBUTE_ID_VALIDATE_SKIPPED_ELEMENTS:
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS];
       default:
         return 0;
     }
@@ -156,6 +196,7 @@ DecoderOptions::DecoderOptions()
 : d_maxDepth(DEFAULT_INITIALIZER_MAX_DEPTH)
 , d_formattingMode(DEFAULT_INITIALIZER_FORMATTING_MODE)
 , d_skipUnknownElements(DEFAULT_INITIALIZER_SKIP_UNKNOWN_ELEMENTS)
+, d_validateSkippedElements(DEFAULT_INITIALIZER_VALIDATE_SKIPPED_ELEMENTS)
 {
 }
 
@@ -163,6 +204,7 @@ DecoderOptions::DecoderOptions(const DecoderOptions& original)
 : d_maxDepth(original.d_maxDepth)
 , d_formattingMode(original.d_formattingMode)
 , d_skipUnknownElements(original.d_skipUnknownElements)
+, d_validateSkippedElements(original.d_validateSkippedElements)
 {
 }
 
@@ -179,6 +221,7 @@ DecoderOptions::operator=(const DecoderOptions& rhs)
         d_maxDepth = rhs.d_maxDepth;
         d_formattingMode = rhs.d_formattingMode;
         d_skipUnknownElements = rhs.d_skipUnknownElements;
+        d_validateSkippedElements = rhs.d_validateSkippedElements;
     }
     return *this;
 }
@@ -188,6 +231,7 @@ void DecoderOptions::reset()
     d_maxDepth = DEFAULT_INITIALIZER_MAX_DEPTH;
     d_formattingMode = DEFAULT_INITIALIZER_FORMATTING_MODE;
     d_skipUnknownElements = DEFAULT_INITIALIZER_SKIP_UNKNOWN_ELEMENTS;
+    d_validateSkippedElements = DEFAULT_INITIALIZER_VALIDATE_SKIPPED_ELEMENTS;
 }
 
 // ACCESSORS
@@ -226,6 +270,11 @@ bsl::ostream& DecoderOptions::print(
         bdlb::PrintMethods::print(stream, d_skipUnknownElements,
                                  -levelPlus1, spacesPerLevel);
 
+        bdlb::Print::indent(stream, levelPlus1, spacesPerLevel);
+        stream << "ValidateSkippedElements = ";
+        bdlb::PrintMethods::print(stream, d_validateSkippedElements,
+                                 -levelPlus1, spacesPerLevel);
+
         bdlb::Print::indent(stream, level, spacesPerLevel);
         stream << "]\n";
     }
@@ -249,6 +298,11 @@ bsl::ostream& DecoderOptions::print(
         bdlb::PrintMethods::print(stream, d_skipUnknownElements,
                                  -levelPlus1, spacesPerLevel);
 
+        stream << ' ';
+        stream << "ValidateSkippedElements = ";
+        bdlb::PrintMethods::print(stream, d_validateSkippedElements,
+                                 -levelPlus1, spacesPerLevel);
+
         stream << " ]";
     }
 
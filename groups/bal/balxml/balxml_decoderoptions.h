@@ -69,23 +69,27 @@ class DecoderOptions {
         // Formatting mode
     bool  d_skipUnknownElements;
         // Option to skip unknown elements
+    bool  d_validateSkippedElements;
+        // Option to validate the content of skipped unknown elements
 
   public:
     // TYPES
     enum {
-        e_ATTRIBUTE_ID_MAX_DEPTH             = 0
-      , e_ATTRIBUTE_ID_FORMATTING_MODE       = 1
-      , e_ATTRIBUTE_ID_SKIP_UNKNOWN_ELEMENTS = 2
+        e_ATTRIBUTE_ID_MAX_DEPTH                 = 0
+      , e_ATTRIBUTE_ID_FORMATTING_MODE           = 1
+      , e_ATTRIBUTE_ID_SKIP_UNKNOWN_ELEMENTS     = 2
+      , e_ATTRIBUTE_ID_VALIDATE_SKIPPED_ELEMENTS = 3
     };
 
     enum {
-        k_NUM_ATTRIBUTES = 3
+        k_NUM_ATTRIBUTES = 4
     };
 
     enum {
-        e_ATTRIBUTE_INDEX_MAX_DEPTH             = 0
-      , e_ATTRIBUTE_INDEX_FORMATTING_MODE       = 1
-      , e_ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS = 2
+        e_ATTRIBUTE_INDEX_MAX_DEPTH                 = 0
+      , e_ATTRIBUTE_INDEX_FORMATTING_MODE           = 1
+      , e_ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS     = 2
+      , e_ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS = 3
     };
 
     // CONSTANTS
@@ -97,6 +101,8 @@ class DecoderOptions {
 
     static const bool DEFAULT_INITIALIZER_SKIP_UNKNOWN_ELEMENTS;
 
+    static const bool DEFAULT_INITIALIZER_VALIDATE_SKIPPED_ELEMENTS;
+
     static const bdlat_AttributeInfo ATTRIBUTE_INFO_ARRAY[];
 
   public:
@@ -172,6 +178,10 @@ class DecoderOptions {
         // Set the "SkipUnknownElements" attribute of this object to the
         // specified 'value'.
 
+    void setValidateSkippedElements(bool value);
+        // Set the "ValidateSkippedElements" attribute of this object to the
+        // specified 'value'.
+
     // ACCESSORS
     bsl::ostream& print(bsl::ostream& stream,
                         int           level = 0,
@@ -227,6 +237,10 @@ class DecoderOptions {
     const bool& skipUnknownElements() const;
         // Return a reference to the non-modifiable "SkipUnknownElements"
         // attribute of this object.
+
+    const bool& validateSkippedElements() const;
+        // Return a reference to the non-modifiable "ValidateSkippedElements"
+        // attribute of this object.
 };
 
 // FREE OPERATORS
@@ -287,6 +301,11 @@ int DecoderOptions::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;                                                   // RETURN
     }
 
+    ret = manipulator(&d_validateSkippedElements, ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
     return ret;
 }
 
@@ -308,6 +327,10 @@ int DecoderOptions::manipulateAttribute(MANIPULATOR& manipulator, int id)
         return manipulator(&d_skipUnknownElements, ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS]);
                                                                       // RETURN
       } break;
+      case e_ATTRIBUTE_ID_VALIDATE_SKIPPED_ELEMENTS: {
+        return manipulator(&d_validateSkippedElements, ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS]);
+                                                                      // RETURN
+      } break;
       default:
         return k_NOT_FOUND;                                           // RETURN
     }
@@ -348,6 +371,12 @@ void DecoderOptions::setSkipUnknownElements(bool value)
     d_skipUnknownElements = value;
 }
 
+inline
+void DecoderOptions::setValidateSkippedElements(bool value)
+{
+    d_validateSkippedElements = value;
+}
+
 // ACCESSORS
 template <class ACCESSOR>
 int DecoderOptions::accessAttributes(ACCESSOR& accessor) const
@@ -369,6 +398,11 @@ int DecoderOptions::accessAttributes(ACCESSOR& accessor) const
         return ret;                                                   // RETURN
     }
 
+    ret = accessor(d_validateSkippedElements, ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
     return ret;
 }
 
@@ -390,6 +424,10 @@ int DecoderOptions::accessAttribute(ACCESSOR& accessor, int id) const
         return accessor(d_skipUnknownElements, ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_SKIP_UNKNOWN_ELEMENTS]);
                                                                       // RETURN
       } break;
+      case e_ATTRIBUTE_ID_VALIDATE_SKIPPED_ELEMENTS: {
+        return accessor(d_validateSkippedElements, ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS]);
+                                                                      // RETURN
+      } break;
       default:
         return k_NOT_FOUND;                                           // RETURN
     }
@@ -429,6 +467,12 @@ const bool& DecoderOptions::skipUnknownElements() const
 {
     return d_skipUnknownElements;
 }
+
+inline
+const bool& DecoderOptions::validateSkippedElements() const
+{
+    return d_validateSkippedElements;
+}
 }  // close package namespace
 
 
@@ -441,7 +485,8 @@ bool balxml::operator==(
 {
     return  lhs.maxDepth() == rhs.maxDepth()
          && lhs.formattingMode() == rhs.formattingMode()
-         && lhs.skipUnknownElements() == rhs.skipUnknownElements();
+         && lhs.skipUnknownElements() == rhs.skipUnknownElements()
+         && lhs.validateSkippedElements() == rhs.validateSkippedElements();
 }
 
 inline
@@ -451,7 +496,8 @@ bool balxml::operator!=(
 {
     return  lhs.maxDepth() != rhs.maxDepth()
          || lhs.formattingMode() != rhs.formattingMode()
-         || lhs.skipUnknownElements() != rhs.skipUnknownElements();
+         || lhs.skipUnknownElements() != rhs.skipUnknownElements()
+         || lhs.validateSkippedElements() != rhs.validateSkippedElements();
 }
 
 inline
@@ -11,9 +11,13 @@
 
 #include <bslim_testutil.h>
 
+#include <bdlat_formattingmode.h>
+
 #include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -23,8 +27,34 @@ using namespace bsl;
 // ----------------------------------------------------------------------------
 //                                 Overview
 //                                 --------
+// The component under test is a generated attribute class.  Test case 2
+// covers the "ValidateSkippedElements" attribute: its default value, its
+// manipulator and accessor, its contribution to the value of the object, its
+// output by 'print', and its attribute information.
 // ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static const bdlat_AttributeInfo *lookupAttributeInfo(int id);
+// [ 2] static const bdlat_AttributeInfo *lookupAttributeInfo(name, len);
+//
+// CREATORS
+// [ 2] balxml::DecoderOptions();
+// [ 2] balxml::DecoderOptions(const balxml::DecoderOptions& original);
+//
+// MANIPULATORS
+// [ 2] operator=(const balxml::DecoderOptions& rhs);
+// [ 2] void reset();
+// [ 2] void setValidateSkippedElements(bool value);
+//
+// ACCESSORS
+// [ 2] ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+// [ 2] const bool& validateSkippedElements() const;
+//
+// FREE OPERATORS
+// [ 2] bool operator==(const balxml::DecoderOptions& lhs, rhs);
+// [ 2] bool operator!=(const balxml::DecoderOptions& lhs, rhs);
 // ----------------------------------------------------------------------------
+// [ 1] BASIC ATTRIBUTE TEST
+// [ 2] 'ValidateSkippedElements' ATTRIBUTE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -75,6 +105,7 @@ void aSsErT(bool condition, const char *message, int line)
 //                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
 // ----------------------------------------------------------------------------
 
+typedef balxml::DecoderOptions Obj;
 
 static int verbose = 0;
 static int veryVerbose = 0;
@@ -96,6 +127,219 @@ int main(int argc, char *argv[])
     bsl::cout << "TEST " << __FILE__ << " CASE " << test << bsl::endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'ValidateSkippedElements' ATTRIBUTE
+        //   Ensure that the "ValidateSkippedElements" attribute is a salient,
+        //   printable attribute of the object, described by its attribute
+        //   information.
+        //
+        // Concerns:
+        //: 1 The default value of the attribute is 'true', which is also the
+        //:   value of 'DEFAULT_INITIALIZER_VALIDATE_SKIPPED_ELEMENTS'.
+        //:
+        //: 2 The accessor returns the value last set by the manipulator, and
+        //:   the manipulator does not change the other attributes.
+        //:
+        //: 3 Two objects differing only in this attribute do not compare
+        //:   equal, and objects having the same value compare equal.
+        //:
+        //: 4 The attribute is copied by the copy constructor and the
+        //:   assignment operator, and restored to its default by 'reset'.
+        //:
+        //: 5 'print' outputs the attribute, on its own line in multi-line
+        //:   mode, and after the other attributes in single-line mode.
+        //:
+        //: 6 The attribute information of the attribute is found by id and,
+        //:   case-insensitively, by name, and describes a text attribute.
+        //
+        // Plan:
+        //: 1 Default construct an object and verify the value of the
+        //:   attribute.  (C-1)
+        //:
+        //: 2 Set the attribute to 'false' and back to 'true', verifying the
+        //:   value of each attribute after each call.  (C-2)
+        //:
+        //: 3 Compare objects differing only in this attribute, and objects
+        //:   having the same value, using both operators.  (C-3)
+        //:
+        //: 4 Copy construct, assign, and reset objects, and verify the value
+        //:   of the attribute.  (C-4)
+        //:
+        //: 5 Print an object in multi-line and single-line mode, and compare
+        //:   the output with the expected output.  (C-5)
+        //:
+        //: 6 Look up the attribute information by id and by name, in several
+        //:   cases, and verify its contents.  (C-6)
+        //
+        // Testing:
+        //   balxml::DecoderOptions();
+        //   balxml::DecoderOptions(const balxml::DecoderOptions& original);
+        //   operator=(const balxml::DecoderOptions& rhs);
+        //   void reset();
+        //   void setValidateSkippedElements(bool value);
+        //   const bool& validateSkippedElements() const;
+        //   bool operator==(const balxml::DecoderOptions& lhs, rhs);
+        //   bool operator!=(const balxml::DecoderOptions& lhs, rhs);
+        //   ostream& print(ostream& s, int level = 0, int sPL = 4) const;
+        //   static const bdlat_AttributeInfo *lookupAttributeInfo(int id);
+        //   static const bdlat_AttributeInfo *lookupAttributeInfo(name, len);
+        //   'ValidateSkippedElements' ATTRIBUTE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'ValidateSkippedElements' ATTRIBUTE" << endl
+                          << "===================================" << endl;
+
+        if (verbose) cout << "\nTesting default value." << endl;
+        {
+            const Obj X;
+
+            ASSERT(true == Obj::DEFAULT_INITIALIZER_VALIDATE_SKIPPED_ELEMENTS);
+            ASSERT(true == X.validateSkippedElements());
+        }
+
+        if (verbose) cout << "\nTesting manipulator and accessor." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            mX.setMaxDepth(5);
+            mX.setFormattingMode(1);
+            mX.setSkipUnknownElements(false);
+
+            mX.setValidateSkippedElements(false);
+            ASSERT(false == X.validateSkippedElements());
+            ASSERT(5     == X.maxDepth());
+            ASSERT(1     == X.formattingMode());
+            ASSERT(false == X.skipUnknownElements());
+
+            mX.setValidateSkippedElements(true);
+            ASSERT(true  == X.validateSkippedElements());
+            ASSERT(5     == X.maxDepth());
+            ASSERT(1     == X.formattingMode());
+            ASSERT(false == X.skipUnknownElements());
+        }
+
+        if (verbose) cout << "\nTesting equality operators." << endl;
+        {
+            const bool VALUES[]   = { true, false };
+            const int  NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+            for (int ti = 0; ti < NUM_VALUES; ++ti) {
+                for (int tj = 0; tj < NUM_VALUES; ++tj) {
+                    const bool EXP = ti == tj;
+
+                    Obj mX;  const Obj& X = mX;
+                    Obj mY;  const Obj& Y = mY;
+
+                    mX.setValidateSkippedElements(VALUES[ti]);
+                    mY.setValidateSkippedElements(VALUES[tj]);
+
+                    if (veryVerbose) { T_ P_(ti) P_(tj) P(EXP) }
+
+                    LOOP2_ASSERT(ti, tj,  EXP == (X == Y));
+                    LOOP2_ASSERT(ti, tj,  EXP == (Y == X));
+                    LOOP2_ASSERT(ti, tj, !EXP == (X != Y));
+                    LOOP2_ASSERT(ti, tj, !EXP == (Y != X));
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting copy, assignment, and 'reset'."
+                          << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            mX.setValidateSkippedElements(false);
+
+            const Obj Y(X);
+            ASSERT(false == Y.validateSkippedElements());
+            ASSERT(X == Y);
+
+            Obj mZ;  const Obj& Z = mZ;
+            ASSERT(X != Z);
+
+            mZ = X;
+            ASSERT(false == Z.validateSkippedElements());
+            ASSERT(X == Z);
+
+            mZ.reset();
+            ASSERT(true == Z.validateSkippedElements());
+            ASSERT(Obj() == Z);
+        }
+
+        if (verbose) cout << "\nTesting 'print'." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+            mX.setValidateSkippedElements(false);
+
+            {
+                const char *EXP = "[\n"
+                                  "  MaxDepth = 32\n"
+                                  "  FormattingMode = 0\n"
+                                  "  SkipUnknownElements = 1\n"
+                                  "  ValidateSkippedElements = 0\n"
+                                  "]\n";
+
+                bsl::ostringstream os;
+                X.print(os, 0, 2);
+
+                if (veryVerbose) { P(os.str()) }
+
+                ASSERTV(os.str(), EXP == os.str());
+            }
+            {
+                const char *EXP = "[ MaxDepth = 32"
+                                  " FormattingMode = 0"
+                                  " SkipUnknownElements = 1"
+                                  " ValidateSkippedElements = 0 ]";
+
+                bsl::ostringstream os;
+                X.print(os, 0, -1);
+
+                if (veryVerbose) { P(os.str()) }
+
+                ASSERTV(os.str(), EXP == os.str());
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'lookupAttributeInfo'." << endl;
+        {
+            const int ID = Obj::e_ATTRIBUTE_ID_VALIDATE_SKIPPED_ELEMENTS;
+
+            const bdlat_AttributeInfo *INFO = Obj::lookupAttributeInfo(ID);
+
+            ASSERT(0 != INFO);
+            ASSERT(&Obj::ATTRIBUTE_INFO_ARRAY[
+                          Obj::e_ATTRIBUTE_INDEX_VALIDATE_SKIPPED_ELEMENTS]
+                                                                      == INFO);
+            ASSERT(ID == INFO->d_id);
+            ASSERT(0  == bsl::strcmp("ValidateSkippedElements",
+                                     INFO->d_name_p));
+            ASSERT(static_cast<int>(bsl::strlen("ValidateSkippedElements"))
+                                                     == INFO->d_nameLength);
+            ASSERT(bdlat_FormattingMode::e_TEXT == INFO->d_formattingMode);
+
+            const char *NAMES[] = {
+                "ValidateSkippedElements",
+                "validateSkippedElements",
+                "VALIDATESKIPPEDELEMENTS"
+            };
+            const int NUM_NAMES = sizeof NAMES / sizeof *NAMES;
+
+            for (int ti = 0; ti < NUM_NAMES; ++ti) {
+                const char *NAME = NAMES[ti];
+                const int   LEN  = static_cast<int>(bsl::strlen(NAME));
+
+                if (veryVerbose) { T_ P(NAME) }
+
+                LOOP_ASSERT(NAME, INFO == Obj::lookupAttributeInfo(NAME, LEN));
+            }
+
+            ASSERT(0 == Obj::lookupAttributeInfo("ValidateSkippedElement",
+                                                 22));
+            ASSERT(0 == Obj::lookupAttributeInfo(Obj::k_NUM_ATTRIBUTES));
+        }
+      } break;
       case 1: {
         // --------------------------------------------------------------------
         // Basic Attribute Test:
@@ -910,6 +910,76 @@ MiniReader::advanceToNextNode()
     return rc;
 }
 
+int
+MiniReader::skipToEndOfElement()
+{
+    BSLS_ASSERT(e_NODE_TYPE_ELEMENT == currentNode().d_type);
+
+    if (isEmptyElement()) {
+        return 0;                                                     // RETURN
+    }
+
+    // Push the current element on the stack of active nodes, so that its end
+    // element is matched by 'scanEndElement'.
+
+    preAdvance();
+
+    const char *name  = d_activeNodes[d_activeNodesCount - 1].first.c_str();
+    int         depth = 1;
+
+    while (1) {
+        // Nothing before the current position needs to be retained.
+
+        d_markPtr = d_scanPtr;
+
+        if (scanForSymbol('<') == 0) {
+            return setParseError("No End Element tags for the Element",
+                                 name,
+                                 0);                                  // RETURN
+        }
+        d_markPtr = d_scanPtr;
+        getChar();          // consume '<'
+
+        int ch = peekChar();
+        if ('/' == ch) {
+            getChar();      // consume '/'
+            if (0 == --depth) {
+                currentNode().d_startPos = getCurrentPosition() - 2;
+                return scanEndElement();                              // RETURN
+            }
+            ch = scanForSymbol('>');
+        }
+        else if (skipIfMatch("!--")) {
+            ch = scanForString("-->");
+            d_scanPtr += ch ? 2 : 0;
+        }
+        else if (skipIfMatch("![CDATA[")) {
+            ch = scanForString("]]>");
+            d_scanPtr += ch ? 2 : 0;
+        }
+        else if ('?' == ch) {
+            ch = scanForString("?>");
+            d_scanPtr += ch ? 1 : 0;
+        }
+        else if ('!' == ch) {
+            ch = scanForSymbol('>');
+        }
+        else {
+            ch = scanForTagEnd();
+            if (ch && '/' != d_scanPtr[-1]) {
+                ++depth;
+            }
+        }
+
+        if (0 == ch) {
+            return setParseError("Unexpected end of document, expected >",
+                                 name,
+                                 0);                                  // RETURN
+        }
+        getChar();          // consume '>'
+    }
+}
+
 // ----------------------------------------------------------------------------
 //                              PRIVATE methods
 // ----------------------------------------------------------------------------
@@ -1039,6 +1109,47 @@ MiniReader::scanForString(const char *str)
     return *d_scanPtr;
 }
 
+int
+MiniReader::scanForTagEnd()
+{
+    static const char strSet[] = { '>', '"', '\'', '\n', '\0' };
+
+    while (1) {
+        // find '>', a quote, or NL
+        size_t len = bsl::strcspn(d_scanPtr, strSet);
+        d_scanPtr +=len;
+
+        const char ch = *d_scanPtr;
+        if ('>' == ch) {
+            return ch;                                                // RETURN
+        }
+
+        if ('"' == ch || '\'' == ch) {
+            ++d_scanPtr;        //skip opening quote
+            if (scanForSymbol(ch) == 0) {
+                return 0;                                             // RETURN
+            }
+            ++d_scanPtr;        //skip closing quote
+            continue;
+        }
+
+        if (checkForNewLine()) {
+            ++d_scanPtr;        //skip NL
+            continue;
+        }
+
+        if (d_scanPtr < d_endPtr) {
+            break;
+        }
+
+        if (readInput() == 0) {
+            return 0;                                                 // RETURN
+        }
+    }
+
+    return *d_scanPtr;
+}
+
 bool
 MiniReader::skipIfMatch(const char *str)
 {
@@ -521,6 +521,13 @@ class MiniReader :  public Reader {
         // new current position.  If there were no symbols found, the current
         // position is set to end and returned value is zero.
 
+    int   scanForTagEnd();
+        // Scan for the '>' character ending the tag at the current position,
+        // skipping over quoted attribute values, and set the current position
+        // to the found symbol.  Return the character at the new current
+        // position.  If the symbol is not found, the current position is set
+        // to end and returned value is zero.
+
     bool skipIfMatch(const char *str);
         // Compare the content of the buffer, starting from the current
         // position, with the specified string 'str'.  If matches, advance the
@@ -805,6 +812,20 @@ class MiniReader :  public Reader {
     virtual unsigned int options() const;
         // Return the option flags.
 
+    // MANIPULATORS
+    // SPECIFIC FOR MiniReader
+    int skipToEndOfElement();
+        // Skip the content of the current element, and advance to its end
+        // element node.  Return 0 on success, and a non-zero value otherwise.
+        // If the current node is an empty element (i.e., 'isEmptyElement()'
+        // is 'true'), this method has no effect.  The behavior is undefined
+        // unless the current node is an element.  Note that the content is
+        // located by scanning for the '<' character beginning each nested
+        // tag and counting start and end tags: unlike repeated calls to
+        // 'advanceToNextNode', this method does not produce the nested nodes,
+        // does not verify that the names of the nested start and end tags
+        // match, and does not retain the skipped content in its buffer.
+
     // ACCESSORS
     // SPECIFIC FOR MiniReader
     int getCurrentPosition() const;
@@ -739,7 +739,7 @@ int main(int argc, char *argv[])
     switch (test)
     {
       case 0:  // Zero is always the leading case.
-      case 12: {
+      case 13: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //
@@ -780,6 +780,162 @@ int main(int argc, char *argv[])
 
       } break;
 
+      case 12: {
+        // --------------------------------------------------------------------
+        // TESTING 'skipToEndOfElement'
+        //
+        // Concerns:
+        //: 1 'skipToEndOfElement' skips nested elements, attribute values
+        //:   containing '>' or '/', text, comments, CDATA sections, and
+        //:   processing instructions, and leaves the reader on the end
+        //:   element node of the current element.
+        //:
+        //: 2 The nodes following the skipped element are read as usual.
+        //:
+        //: 3 If the current element is empty, 'skipToEndOfElement' has no
+        //:   effect.
+        //:
+        //: 4 Elements larger than the buffer of the reader are skipped
+        //:   without growing the buffer.
+        //:
+        //: 5 An incomplete element is reported as an error.
+        //
+        // Plan:
+        //: 1 Skip an element having each kind of content of C-1, and verify
+        //:   the current node and the nodes that follow.  (C-1..3)
+        //:
+        //: 2 Skip an element of about 1MB from a 'streambuf' using a reader
+        //:   having a 1KB buffer, and verify that no memory is allocated
+        //:   while skipping.  (C-4)
+        //:
+        //: 3 Skip incomplete elements, and verify that an error is returned.
+        //:   (C-5)
+        //
+        // Testing:
+        //   int skipToEndOfElement();
+        // --------------------------------------------------------------------
+
+        if (verbose) bsl::cout << bsl::endl
+                               << "TESTING 'skipToEndOfElement'" << bsl::endl
+                               << "============================" << bsl::endl;
+
+        if (verbose) bsl::cout << "\nSkipping each kind of content."
+                               << bsl::endl;
+        {
+            static const char XML[] =
+                "<root>"
+                  "<a x='1' y=\"p>q/\">"
+                    "<b/>"
+                    "<c z='/'>text &lt; &amp;"
+                      "<![CDATA[</a> <b>]]>"
+                      "<!-- </a> -->"
+                      "<?pi </a>?>"
+                      "<d></d>"
+                    "</c>\n"
+                  "</a>"
+                  "<e/>"
+                "</root>";
+
+            Obj reader;
+
+            ASSERT(0 == reader.open(XML, sizeof XML - 1));
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(0 == bsl::strcmp(reader.nodeName(), "root"));
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(0 == bsl::strcmp(reader.nodeName(), "a"));
+            ASSERT(2 == reader.numAttributes());
+
+            ASSERT(0 == reader.skipToEndOfElement());
+            ASSERT(reader.nodeType() ==
+                                    balxml::Reader::e_NODE_TYPE_END_ELEMENT);
+            ASSERT(0 == bsl::strcmp(reader.nodeName(), "a"));
+            ASSERT(2 == reader.nodeDepth());
+            ASSERT(bsl::strstr(XML, "<e/>") - XML ==
+                                                 reader.getCurrentPosition());
+            ASSERT(bsl::strstr(XML, "</a>\n") - XML + 1 <
+                                                 reader.nodeStartPosition());
+
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(reader.nodeType() == balxml::Reader::e_NODE_TYPE_ELEMENT);
+            ASSERT(0 == bsl::strcmp(reader.nodeName(), "e"));
+            ASSERT(reader.isEmptyElement());
+
+            ASSERT(0 == reader.skipToEndOfElement());
+            ASSERT(reader.nodeType() == balxml::Reader::e_NODE_TYPE_ELEMENT);
+            ASSERT(0 == bsl::strcmp(reader.nodeName(), "e"));
+
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(reader.nodeType() ==
+                                    balxml::Reader::e_NODE_TYPE_END_ELEMENT);
+            ASSERT(0 == bsl::strcmp(reader.nodeName(), "root"));
+            ASSERT(1 == reader.nodeDepth());
+            ASSERT(1 == reader.advanceToNextNode());
+            ASSERT(reader.errorInfo().isNoError());
+        }
+
+        if (verbose) bsl::cout << "\nSkipping a large element."
+                               << bsl::endl;
+        {
+            bsl::string xml = "<root><skip>";
+            while (xml.size() < 1024 * 1024) {
+                xml += "<item key='a&gt;b'>text<!-- > --><empty/></item>\n";
+            }
+            xml += "</skip><next>1</next></root>";
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+            bsl::stringbuf       sb(xml);
+
+            Obj reader(1024, &ta);
+
+            ASSERT(0 == reader.open(&sb, "STREAM.xml"));
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(0 == bsl::strcmp(reader.nodeName(), "skip"));
+
+            const bsls::Types::Int64 numBytes = ta.numBytesInUse();
+
+            ASSERT(0 == reader.skipToEndOfElement());
+            ASSERT(0 == bsl::strcmp(reader.nodeName(), "skip"));
+            ASSERTV(numBytes, ta.numBytesInUse(),
+                    numBytes == ta.numBytesInUse());
+            ASSERT(static_cast<int>(xml.find("<next>")) ==
+                                                 reader.getCurrentPosition());
+
+            ASSERT(0 == reader.advanceToNextNode());
+            ASSERT(0 == bsl::strcmp(reader.nodeName(), "next"));
+        }
+
+        if (verbose) bsl::cout << "\nSkipping incomplete elements."
+                               << bsl::endl;
+        {
+            static const char *const DATA[] = {
+                "<root><a>",
+                "<root><a><b></a>",
+                "<root><a><b x='>",
+                "<root><a><!-- </a>",
+                "<root><a><![CDATA[</a>",
+                "<root><a><?pi </a>",
+                "<root><a></",
+            };
+            const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const char *XML = DATA[ti];
+
+                Obj reader;
+
+                ASSERTV(ti, 0 == reader.open(XML, bsl::strlen(XML)));
+                ASSERTV(ti, 0 == reader.advanceToNextNode());
+                ASSERTV(ti, 0 == reader.advanceToNextNode());
+                ASSERTV(ti, 0 == bsl::strcmp(reader.nodeName(), "a"));
+
+                ASSERTV(ti, 0 != reader.skipToEndOfElement());
+                ASSERTV(ti, reader.errorInfo().isAnyError());
+                ASSERTV(ti, 0 > reader.advanceToNextNode());
+            }
+        }
+      } break;
+
       case 11: {
         // --------------------------------------------------------------------
         // TESTING 'xsi:nil' attribute
@@ -17,6 +17,8 @@ BSLS_IDENT_RCSID(balxml_typesparserutil_cpp,"$Id$ $CSID$")
 #include <balxml_base64parser.h>
 #include <balxml_hexparser.h>
 
+#include <bdlb_numericparseutil.h>
+
 #include <bdlsb_fixedmeminstreambuf.h>
 
 #include <bdldfp_decimalutil.h>
@@ -26,7 +28,6 @@ BSLS_IDENT_RCSID(balxml_typesparserutil_cpp,"$Id$ $CSID$")
 #include <bsl_cstring.h>
 #include <bsl_iterator.h>
 #include <bsl_limits.h>
-#include <bsl_cerrno.h>
 #include <bsl_cfloat.h>
 #include <bsl_cmath.h>
 
@@ -79,193 +80,79 @@ int parseBoolean(bool *result, const char *input, int inputLength)
     return BAEXML_FAILURE;
 }
 
-int parseDoubleImpl(double *result, const char *input, bool formatDecimal)
+int parseDouble(double     *result,
+                const char *input,
+                int         inputLength,
+                bool        formatDecimal)
     // Parse a string representing a double into the specified 'result'.  The
-    // specified 'input' is a null-terminated string.  The specified
-    // 'formatDecimal' should be true if 'input' should contain only decimal
-    // digits, period and sign characters (i.e., INF/NaN, and exponential
-    // notation are not allowed); otherwise 'input' can contain any floating-
-    // point representation form.  Return 0 on success and non-zero otherwise.
+    // specified 'formatDecimal' will be true if the specified 'input' of
+    // specified length 'inputLength' should contain only decimal digits,
+    // period and sign characters (i.e., INF/NaN, and exponential notation are
+    // not allowed); otherwise 'input' can contain "INF", "+INF", "-INF",
+    // "NaN", or a decimal number with an optional exponent.  Return 0 on
+    // success and non-zero otherwise.  Note that a value too small to be
+    // represented is parsed as zero, but that a value too large to be
+    // represented is an error.
 {
     enum { BAEXML_SUCCESS = 0, BAEXML_FAILURE = -1 };
-    static const char decimalChars[] = "+-.0123456789";
 
-    if (formatDecimal && input[bsl::strspn(input, decimalChars)] != '\0') {
-        // Non-decimal character (i.e., potential INF, NaN, or exponent) found.
-        return BAEXML_FAILURE;                                        // RETURN
+    if (formatDecimal) {
+        for (int i = 0; i < inputLength; ++i) {
+            const char c = input[i];
+            if (('0' > c || c > '9') && '.' != c && '+' != c && '-' != c) {
+                // Non-decimal character (i.e., potential INF, NaN, or
+                // exponent) found.
+
+                return BAEXML_FAILURE;                                // RETURN
+            }
+        }
     }
+    else {
+        const bslstl::StringRef inputRef(input, inputLength);
 
-    switch (input[0]) {
-      case 'N':
-        if (bsl::strcmp(input + 1, "aN") == 0) {
+        if ("NaN" == inputRef) {
             *result = bsl::numeric_limits<double>::quiet_NaN();
             return BAEXML_SUCCESS;                                    // RETURN
         }
-        break;
-      case 'I':
-        if (bsl::strcmp(input + 1, "NF") == 0) {
-            *result = bsl::numeric_limits<double>::infinity();
-            return BAEXML_SUCCESS;                                    // RETURN
-        }
-        break;
-      case '+':
-        if (bsl::strcmp(input + 1, "INF") == 0) {
+        if ("INF" == inputRef || "+INF" == inputRef) {
             *result = bsl::numeric_limits<double>::infinity();
             return BAEXML_SUCCESS;                                    // RETURN
         }
-        break;
-      case '-':
-        if (bsl::strcmp(input + 1, "INF") == 0) {
+        if ("-INF" == inputRef) {
             *result = -bsl::numeric_limits<double>::infinity();
             return BAEXML_SUCCESS;                                    // RETURN
         }
-        break;
-
-      default:
-        break;
-    } // End switch
-
-    char *end = 0;
-    errno = 0;
-    *result = bsl::strtod(input, &end);
-
-    if (end == input || *end != '\0') {  // nothing was consumed or not all
-                                         // characters were consumed
-        return BAEXML_FAILURE;                                        // RETURN
     }
 
-    // We ignore underflow errors.  If strtod sets errno to ERANGE, then it
-    // will also have set the result to a very large number for overflow or a
-    // very small number (or zero) for underflow -- exactly what we want.
-    if (ERANGE == errno) {
-        if (*result < -1.0 || 1.0 < *result) {
-            // Overflow is an error.
-            return BAEXML_FAILURE;                                    // RETURN
-        }
-        else {
-            // Underflow is OK (very small number).
-            return BAEXML_SUCCESS;                                    // RETURN
-        }
-    }
-    else if (errno != 0) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
-
-    return BAEXML_SUCCESS;
-}
-
-int parseDouble(double     *result,
-                const char *input,
-                int         inputLength,
-                bool        formatDecimal)
-    // Parse a string representing a double into the specified 'result'.  The
-    // specified 'formatDecimal' will be true if the specified 'input' of
-    // specified length 'inputLength' should contain only decimal digits,
-    // period and sign characters; otherwise 'input' can contain any floating-
-    // point representation form.  Return 0 on success and non-zero otherwise.
-{
-    // 'input' must be zero terminated string
-    enum { BAEXML_SUCCESS = 0, BAEXML_FAILURE = -1 };
-    enum { BUFLEN = 80 };
-
-    if (0 == inputLength) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
-
-    if (inputLength < BUFLEN) {
-        // Use a fixed-length buffer for efficiency.
-        char  buffer[BUFLEN];
-        bsl::memcpy(buffer, input, inputLength);
-        buffer[inputLength] = '\0';
-
-        return parseDoubleImpl(result, buffer, formatDecimal);        // RETURN
-
-    }
-    else {
-        // Use a string for dynamic allocation.
-        bsl::string tmp(input, inputLength);
-        return parseDoubleImpl(result, tmp.c_str(), formatDecimal);   // RETURN
-    }
+    return bdlb::NumericParseUtil::parseDouble(
+                                        result,
+                                        bslstl::StringRef(input, inputLength))
+           ? BAEXML_FAILURE
+           : BAEXML_SUCCESS;
 }
 
 int parseInt(int *result, const char *input, int inputLength)
-    // Parse an unsigned long decimal string
+    // Parse a signed decimal string.
 {
     enum { BAEXML_SUCCESS = 0, BAEXML_FAILURE = -1 };
-    enum { BUFLEN = 80 };
-
-    int consumed = 0;
-
-    if (0 == inputLength) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
-    else if (inputLength < BUFLEN) {
-        // Use a fixed-length buffer for efficiency.
-        char  buffer[BUFLEN];
-        bsl::memcpy(buffer, input, inputLength);
-        buffer[inputLength] = '\0';
-
-        errno = 0;
-        char *end = 0;
-        *result = (int) bsl::strtol(buffer, &end, 10);
-        consumed = static_cast<int>(end - buffer);
-    }
-    else {
-        // Use a string for dynamic allocation.
-        bsl::string tmp(input, inputLength);
-        const char *begin = tmp.c_str();
 
-        errno = 0;
-        char *end = 0;
-        *result = (int) bsl::strtol(begin, &end, 10);
-        consumed = static_cast<int>(end - begin);
-    }
-
-    if (errno != 0 || consumed != inputLength) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
-
-    return BAEXML_SUCCESS;
+    return bdlb::NumericParseUtil::parseInt(
+                                        result,
+                                        bslstl::StringRef(input, inputLength))
+           ? BAEXML_FAILURE
+           : BAEXML_SUCCESS;
 }
 
 int parseUnsignedInt(unsigned int *result, const char *input, int inputLength)
-    // Parse an unsigned long decimal string
+    // Parse an unsigned decimal string.
 {
     enum { BAEXML_SUCCESS = 0, BAEXML_FAILURE = -1 };
-    enum { BUFLEN = 80 };
 
-    int consumed = 0;
-
-    if (0 == inputLength) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
-    else if (inputLength < BUFLEN) {
-        // Use a fixed-length buffer for efficiency.
-        char  buffer[BUFLEN];
-        bsl::memcpy(buffer, input, inputLength);
-        buffer[inputLength] = '\0';
-
-        errno = 0;
-        char *end = 0;
-        *result = (int) bsl::strtoul(buffer, &end, 10);
-        consumed = static_cast<int>(end - buffer);
-    }
-    else {
-        // Use a string for dynamic allocation.
-        bsl::string tmp(input, inputLength);
-        const char *begin = tmp.c_str();
-
-        errno = 0;
-        char *end = 0;
-        *result = (unsigned int) bsl::strtoul(begin, &end, 10);
-        consumed = static_cast<int>(end - begin);
-    }
-
-    if (errno != 0 || consumed != inputLength) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
-
-    return BAEXML_SUCCESS;
+    return bdlb::NumericParseUtil::parseUint(
+                                        result,
+                                        bslstl::StringRef(input, inputLength))
+           ? BAEXML_FAILURE
+           : BAEXML_SUCCESS;
 }
 
 template <class INT_TYPE>
@@ -410,33 +297,15 @@ int
 TypesParserUtil_Imp::parseDecimal(bsls::Types::Int64         *result,
                                   const char                 *input,
                                   int                         inputLength,
-                                  bdlat_TypeCategory::Simple  sc)
+                                  bdlat_TypeCategory::Simple)
 {
     enum { BAEXML_SUCCESS = 0, BAEXML_FAILURE = -1 };
 
-    int sign = 0;
-    if (inputLength > 0 && '-' == input[0]) {
-        sign = -1;
-        ++input;
-        --inputLength;
-    }
-
-    // Parse remaining portion as unsigned
-    bsls::Types::Uint64 temp = 0;
-    int rc = parseDecimal(&temp, input, inputLength, sc);
-    if (rc != 0) {
-        return rc;                                                    // RETURN
-    }
-
-    // TBD Microsoft is warning that -temp is still an unsigned value.  Rather
-    // than silence the warning, note that there is an unvalidated assumption
-    // that temp <= INT_MAX.  It is not clear from the contract in the header
-    // how to handle such a case, although returning 'BAEXML_FAILURE' might be
-    // most appropriate.
-
-    *result = sign ? -temp : temp;
-
-    return BAEXML_SUCCESS;
+    return bdlb::NumericParseUtil::parseInt64(
+                                        result,
+                                        bslstl::StringRef(input, inputLength))
+           ? BAEXML_FAILURE
+           : BAEXML_SUCCESS;
 }
 
 int TypesParserUtil_Imp::parseDecimal(unsigned char              *result,
@@ -470,26 +339,11 @@ int TypesParserUtil_Imp::parseDecimal(bsls::Types::Uint64        *result,
 {
     enum { BAEXML_SUCCESS = 0, BAEXML_FAILURE = -1 };
 
-    if (0 == inputLength) {
-        return BAEXML_FAILURE;                                        // RETURN
-    }
-
-    bsls::Types::Uint64 val = 0;
-
-    for (; 0 < inputLength; --inputLength) {
-        int c = *input++;
-        if ('0' <= c && c <= '9') {
-            val *= 10;
-            val += c - '0';
-        }
-        else {
-            return BAEXML_FAILURE;                                    // RETURN
-        }
-    }
-
-    *result = val;
-
-    return BAEXML_SUCCESS;
+    return bdlb::NumericParseUtil::parseUint64(
+                                        result,
+                                        bslstl::StringRef(input, inputLength))
+           ? BAEXML_FAILURE
+           : BAEXML_SUCCESS;
 }
 
 int TypesParserUtil_Imp::parseDecimal(float                      *result,
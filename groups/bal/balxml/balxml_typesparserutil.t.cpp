@@ -1668,17 +1668,28 @@ int main(int argc, char *argv[])
             static const struct {
                 int         d_lineNum;
                 const char *d_input;
+                bool        d_isValid;
                 Type        d_result;
             } DATA[] = {
-                //line    input            result
-                //----    -----            ------
-                { L_,     "-2147483648X",   -2147483647-1    },
-                { L_,     "-2147483647X",   -2147483647,     },
-                { L_,     "-1X",            -1,              },
-                { L_,     "0X",             0,               },
-                { L_,     "1X",             1,               },
-                { L_,     "2147483646X",    2147483646,      },
-                { L_,     "2147483647X",    2147483647,      },
+                //line    input            valid   result
+                //----    -----            -----   ------
+                { L_,     "-2147483648X",  true,   -2147483647-1    },
+                { L_,     "-2147483647X",  true,   -2147483647,     },
+                { L_,     "-1X",           true,   -1,              },
+                { L_,     "0X",            true,   0,               },
+                { L_,     "1X",            true,   1,               },
+                { L_,     "2147483646X",   true,   2147483646,      },
+                { L_,     "2147483647X",   true,   2147483647,      },
+
+                // Leading whitespace is not accepted.
+
+                { L_,     " 1X",           false,  0,               },
+
+                // Out-of-range values are rejected instead of wrapping.
+
+                { L_,     "-2147483649X",  false,  0,               },
+                { L_,     "2147483648X",   false,  0,               },
+                { L_,     "4294967297X",   false,  0,               },
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -1686,14 +1697,20 @@ int main(int argc, char *argv[])
                 const int   LINE            = DATA[i].d_lineNum;
                 const char *INPUT           = DATA[i].d_input;
                 const int   INPUT_LENGTH    = bsl::strlen(INPUT)-1;
+                const bool  IS_VALID        = DATA[i].d_isValid;
                 const Type  EXPECTED_RESULT = DATA[i].d_result;
 
                 Type mX(!EXPECTED_RESULT);  const Type& X = mX;
 
                 int retCode = Util::parseDefault(&mX, INPUT, INPUT_LENGTH);
 
-                LOOP2_ASSERT(LINE, retCode, 0               == retCode);
-                LOOP2_ASSERT(LINE, X,       EXPECTED_RESULT == X);
+                if (IS_VALID) {
+                    LOOP2_ASSERT(LINE, retCode, 0               == retCode);
+                    LOOP2_ASSERT(LINE, X,       EXPECTED_RESULT == X);
+                }
+                else {
+                    LOOP2_ASSERT(LINE, retCode, 0               != retCode);
+                }
             }
         }
 
@@ -1704,18 +1721,32 @@ int main(int argc, char *argv[])
             static const struct {
                 int         d_lineNum;
                 const char *d_input;
+                bool        d_isValid;
                 Type        d_result;
             } DATA[] = {
-                //line    input                    result
-                //----    -----                    ------
-                { L_,     "-9223372036854775808X",
+                //line  input                    valid  result
+                //----  -----                    -----  ------
+                { L_,   "-9223372036854775808X", true,
                                 static_cast<Type>(-9223372036854775808ULL),  },
-                { L_,     "-9223372036854775807X",  -9223372036854775807LL,  },
-                { L_,     "-1X",                    -1LL,                    },
-                { L_,     "0X",                     0LL,                     },
-                { L_,     "1X",                     1LL,                     },
-                { L_,     "9223372036854775806X",   9223372036854775806LL,   },
-                { L_,     "9223372036854775807X",   9223372036854775807LL,   },
+                { L_,   "-9223372036854775807X", true,  -9223372036854775807LL,
+                                                                             },
+                { L_,   "-1X",                   true,  -1LL,                },
+                { L_,   "0X",                    true,  0LL,                 },
+                { L_,   "1X",                    true,  1LL,                 },
+                { L_,   "9223372036854775806X",  true,  9223372036854775806LL,
+                                                                             },
+                { L_,   "9223372036854775807X",  true,  9223372036854775807LL,
+                                                                             },
+
+                // Leading whitespace is not accepted.
+
+                { L_,   " 1X",                   false, 0LL,                 },
+
+                // Out-of-range values are rejected instead of wrapping.
+
+                { L_,   "-9223372036854775809X", false, 0LL,                 },
+                { L_,   "9223372036854775808X",  false, 0LL,                 },
+                { L_,   "18446744073709551617X", false, 0LL,                 },
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -1723,14 +1754,20 @@ int main(int argc, char *argv[])
                 const int   LINE            = DATA[i].d_lineNum;
                 const char *INPUT           = DATA[i].d_input;
                 const int   INPUT_LENGTH    = bsl::strlen(INPUT)-1;
+                const bool  IS_VALID        = DATA[i].d_isValid;
                 const Type  EXPECTED_RESULT = DATA[i].d_result;
 
                 Type mX(!EXPECTED_RESULT);  const Type& X = mX;
 
                 int retCode = Util::parseDefault(&mX, INPUT, INPUT_LENGTH);
 
-                LOOP2_ASSERT(LINE, retCode, 0               == retCode);
-                LOOP2_ASSERT(LINE, X,       EXPECTED_RESULT == X);
+                if (IS_VALID) {
+                    LOOP2_ASSERT(LINE, retCode, 0               == retCode);
+                    LOOP2_ASSERT(LINE, X,       EXPECTED_RESULT == X);
+                }
+                else {
+                    LOOP2_ASSERT(LINE, retCode, 0               != retCode);
+                }
             }
         }
 
@@ -1807,14 +1844,20 @@ int main(int argc, char *argv[])
             static const struct {
                 int         d_lineNum;
                 const char *d_input;
+                bool        d_isValid;
                 Type        d_result;
             } DATA[] = {
-                //line    input            result
-                //----    -----            ------
-                { L_,     "0X",             0,               },
-                { L_,     "1X",             1,               },
-                { L_,     "4294967294X",    4294967294,      },
-                { L_,     "4294967295X",    4294967295,      },
+                //line    input            valid   result
+                //----    -----            -----   ------
+                { L_,     "0X",            true,   0,               },
+                { L_,     "1X",            true,   1,               },
+                { L_,     "4294967294X",   true,   4294967294,      },
+                { L_,     "4294967295X",   true,   4294967295,      },
+
+                // Out-of-range values are rejected instead of wrapping.
+
+                { L_,     "4294967296X",   false,  0,               },
+                { L_,     "8589934593X",   false,  0,               },
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -1822,14 +1865,20 @@ int main(int argc, char *argv[])
                 const int   LINE            = DATA[i].d_lineNum;
                 const char *INPUT           = DATA[i].d_input;
                 const int   INPUT_LENGTH    = bsl::strlen(INPUT)-1;
+                const bool  IS_VALID        = DATA[i].d_isValid;
                 const Type  EXPECTED_RESULT = DATA[i].d_result;
 
                 Type mX(!EXPECTED_RESULT);  const Type& X = mX;
 
                 int retCode = Util::parseDefault(&mX, INPUT, INPUT_LENGTH);
 
-                LOOP2_ASSERT(LINE, retCode, 0               == retCode);
-                LOOP2_ASSERT(LINE, X,       EXPECTED_RESULT == X);
+                if (IS_VALID) {
+                    LOOP2_ASSERT(LINE, retCode, 0               == retCode);
+                    LOOP2_ASSERT(LINE, X,       EXPECTED_RESULT == X);
+                }
+                else {
+                    LOOP2_ASSERT(LINE, retCode, 0               != retCode);
+                }
             }
         }
 
@@ -1840,14 +1889,27 @@ int main(int argc, char *argv[])
             static const struct {
                 int         d_lineNum;
                 const char *d_input;
+                bool        d_isValid;
                 Type        d_result;
             } DATA[] = {
-                //line    input                    result
-                //----    -----                    ------
-                { L_,     "0X",                    0ULL,                    },
-                { L_,     "1X",                    1ULL,                    },
-                { L_,     "18446744073709551614X", 18446744073709551614ULL, },
-                { L_,     "18446744073709551615X", 18446744073709551615ULL, },
+                //line  input                    valid  result
+                //----  -----                    -----  ------
+                { L_,   "0X",                    true,  0ULL,                },
+                { L_,   "1X",                    true,  1ULL,                },
+                { L_,   "18446744073709551614X", true,
+                                                    18446744073709551614ULL, },
+                { L_,   "18446744073709551615X", true,
+                                                    18446744073709551615ULL, },
+
+                // Leading whitespace is not accepted.
+
+                { L_,   " 1X",                   false, 0ULL,                },
+
+                // Out-of-range values are rejected instead of wrapping.
+
+                { L_,   "18446744073709551616X", false, 0ULL,                },
+                { L_,   "18446744073709551617X", false, 0ULL,                },
+                { L_,   "99999999999999999999X", false, 0ULL,                },
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -1855,14 +1917,20 @@ int main(int argc, char *argv[])
                 const int   LINE            = DATA[i].d_lineNum;
                 const char *INPUT           = DATA[i].d_input;
                 const int   INPUT_LENGTH    = bsl::strlen(INPUT)-1;
+                const bool  IS_VALID        = DATA[i].d_isValid;
                 const Type  EXPECTED_RESULT = DATA[i].d_result;
 
                 Type mX(!EXPECTED_RESULT);  const Type& X = mX;
 
                 int retCode = Util::parseDefault(&mX, INPUT, INPUT_LENGTH);
 
-                LOOP2_ASSERT(LINE, retCode, 0               == retCode);
-                LOOP2_ASSERT(LINE, X,       EXPECTED_RESULT == X);
+                if (IS_VALID) {
+                    LOOP2_ASSERT(LINE, retCode, 0               == retCode);
+                    LOOP2_ASSERT(LINE, X,       EXPECTED_RESULT == X);
+                }
+                else {
+                    LOOP2_ASSERT(LINE, retCode, 0               != retCode);
+                }
             }
         }
 
@@ -1927,21 +1995,44 @@ int main(int argc, char *argv[])
             static const struct {
                 int         d_lineNum;
                 const char *d_input;
+                bool        d_isValid;
                 Type        d_result;
             } DATA[] = {
-                //line    input       result
-                //----    -----       ------
-                { L_,     "-1X",       -1.0,            },
-                { L_,     "-0.1X",     -0.1,            },
-                { L_,     "0X",        0.0,             },
-                { L_,     "0.1X",      0.1,             },
-                { L_,     "1X",        1.0,             },
-                { L_,     "123.4X",    123.4,           },
-                { L_,     "0.005X",    0.005            },
-                { L_,     "9.99E306X", 9.99E306         },
-                { L_,     "+INFX",     posInf,          },
-                { L_,     "-INFX",     -posInf,         },
-                { L_,     "NaNX",      qNaN             },
+                //line    input        valid  result
+                //----    -----        -----  ------
+                { L_,     "-1X",       true,  -1.0,            },
+                { L_,     "-0.1X",     true,  -0.1,            },
+                { L_,     "0X",        true,  0.0,             },
+                { L_,     "0.1X",      true,  0.1,             },
+                { L_,     "1X",        true,  1.0,             },
+                { L_,     "123.4X",    true,  123.4,           },
+                { L_,     "0.005X",    true,  0.005            },
+                { L_,     "9.99E306X", true,  9.99E306         },
+                { L_,     "+INFX",     true,  posInf,          },
+                { L_,     "-INFX",     true,  -posInf,         },
+                { L_,     "NaNX",      true,  qNaN             },
+
+                // Leading whitespace is not accepted.
+
+                { L_,     " 1X",       false, 0.0,             },
+                { L_,     "\t1X",      false, 0.0,             },
+
+                // Only "INF", "+INF", "-INF", and "NaN" are accepted for
+                // infinity and NaN.
+
+                { L_,     "infX",      false, 0.0,             },
+                { L_,     "-infX",     false, 0.0,             },
+                { L_,     "nanX",      false, 0.0,             },
+                { L_,     "NANX",      false, 0.0,             },
+
+                // Hexadecimal forms are not accepted.
+
+                { L_,     "0x10X",     false, 0.0,             },
+                { L_,     "0x1p3X",    false, 0.0,             },
+
+                // Values too large to be represented are rejected.
+
+                { L_,     "1e309X",    false, 0.0,             },
             };
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
@@ -1949,12 +2040,18 @@ int main(int argc, char *argv[])
                 const int   LINE            = DATA[i].d_lineNum;
                 const char *INPUT           = DATA[i].d_input;
                 const int   INPUT_LENGTH    = bsl::strlen(INPUT)-1;
+                const bool  IS_VALID        = DATA[i].d_isValid;
                 const Type  EXPECTED_RESULT = DATA[i].d_result;
 
                 Type mX;  const Type& X = mX;
 
                 int retCode = Util::parseDefault(&mX, INPUT, INPUT_LENGTH);
 
+                if (!IS_VALID) {
+                    LOOP2_ASSERT(LINE, retCode, 0 != retCode);
+                    continue;                                       // CONTINUE
+                }
+
                 LOOP2_ASSERT(LINE, retCode, 0 == retCode);
 
                 if (bdlb::Float::isNan(EXPECTED_RESULT)) {
@@ -14,6 +14,7 @@ BSLS_IDENT_RCSID(balxml_typesprintutil_cpp,"$Id$ $CSID$")
 
 #include <bdldfp_decimalutil.h>
 
+#include <bdlb_floatformatutil.h>
 #include <bdlb_print.h>
 
 #include <bdlde_base64encoder.h>
@@ -929,24 +930,15 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Write the shortest text that round-trips, which is several times
+        // faster to compute than the output of 'sprintf'.
 
-        char buffer[FLT_DIG + 20];  // buffer with headroom
+        char buffer[bdlb::FloatFormatUtil::k_MAX_LENGTH + 1];
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len = ::sprintf(buffer, "%.*g", FLT_DIG + 1,
-                                     (double) object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+        const int len = bdlb::FloatFormatUtil::formatGeneral(
+                                   buffer,
+                                   object,
+                                   bdlb::FloatFormatUtil::k_MAX_FLOAT_DIGITS);
 
         stream.write(buffer, len);
       } break;
@@ -975,23 +967,14 @@ bsl::ostream& TypesPrintUtil_Imp::printDefault(
       default: {
         // not a NaN and not +/- INFINITY
 
-        // On Sun, formatting a 'double' using 'ostream' is 60% slower than
-        // 'sprintf', even though the former calls the latter.  Also, note that
-        // 'snprintf' is 15% slower than 'sprintf' on Sun.
+        // Write the shortest text that round-trips (see 'float' above).
 
-        char buffer[DBL_DIG + 20];  // buffer with headroom
+        char buffer[bdlb::FloatFormatUtil::k_MAX_LENGTH + 1];
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(push)
-#pragma warning(disable:4996)     // suppress 'sprintf' deprecation warning
-#endif
-
-        const int len = ::sprintf(buffer, "%.*g", DBL_DIG + 1, object);
-        BSLS_ASSERT(len < (int) sizeof buffer);
-
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#pragma warning(pop)
-#endif
+        const int len = bdlb::FloatFormatUtil::formatGeneral(
+                                  buffer,
+                                  object,
+                                  bdlb::FloatFormatUtil::k_MAX_DOUBLE_DIGITS);
 
         stream.write(buffer, len);
       } break;
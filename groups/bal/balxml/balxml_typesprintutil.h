@@ -105,6 +105,10 @@ BSLS_IDENT("$Id: $")
 //      ---------------------               -----------------------
 //      Enumeration                         TEXT
 //..
+// In 'DEFAULT' mode, 'float' and 'double' values are written using the
+// shortest decimal text that parses back to the same value (see
+// 'bdlb_floatformatutil'), e.g., 0.1 is written as "0.1", and 1.0 / 3 as
+// "0.3333333333333333".
 //
 ///Behavior of 'printText' on Non-Valid Strings
 ///--------------------------------------------
@@ -1624,12 +1624,6 @@ int main(int argc, char *argv[])
         {
             typedef float Type;
 
-#if defined(BSLS_PLATFORM_CMP_MSVC)
-#define ZERO   "0"
-#else
-#define ZERO
-#endif
-
             static const struct {
                 int         d_lineNum;
                 Type        d_input;
@@ -1640,12 +1634,13 @@ int main(int argc, char *argv[])
                 { L_,     -1.0f,          "-1"                            },
                 { L_,     -0.1f,          "-0.1"                          },
                 { L_,     -0.1234567f,    "-0.1234567"                    },
-                { L_,     -1.234567e-35,  "-1.234567e-" ZERO "35"         },
+                { L_,     -1.234567e-35,  "-1.234567e-35"                 },
                 { L_,     0.0f,           "0"                             },
                 { L_,     0.1f,           "0.1"                           },
                 { L_,     1.0f,           "1"                             },
                 { L_,     1234567.0f,     "1234567"                       },
-                { L_,     1.234567e35,    "1.234567e+" ZERO "35"          },
+                { L_,     1.234567e35,    "1.234567e+35"                  },
+                { L_,     1.0f / 3,       "0.33333334"                    },
                 { L_,     bsl::numeric_limits<float>::infinity(),
                                           "+INF"                          },
                 { L_,    -bsl::numeric_limits<float>::infinity(),
@@ -1653,7 +1648,6 @@ int main(int argc, char *argv[])
                 { L_,     bsl::numeric_limits<float>::signaling_NaN(),
                                           "NaN"                           },
             };
-#undef ZERO
             const int NUM_DATA = sizeof DATA / sizeof *DATA;
 
             for (int i = 0; i < NUM_DATA; ++i) {
@@ -1689,6 +1683,7 @@ int main(int argc, char *argv[])
                 { L_,     1.0,        "1"              },
                 { L_,123456789012345.0, "123456789012345"},
                 { L_,1.23456789012345e105,"1.23456789012345e+105"  },
+                { L_,     0.1 + 0.2,  "0.30000000000000004"            },
                 { L_,  bsl::numeric_limits<double>::infinity(), "+INF"},
                 { L_, -bsl::numeric_limits<double>::infinity(), "-INF"},
                 { L_,  bsl::numeric_limits<double>::signaling_NaN(), "NaN"},
@@ -208,7 +208,9 @@ struct ScheduleGenerationUtil {
         // is undefined unless 'earliest <= latest',
         // '1 <= exampleYear <= 9999', '1 <= exampleMonth <= 12',
         // '1 <= intervalInMonths', and
-        // '1 <= abs(targetBusinessDayOfMonth) <= 31'.
+        // '1 <= abs(targetBusinessDayOfMonth) <= 31'.  Note that each date is
+        // located in time logarithmic in the length of the valid range of
+        // 'calendar', without iterating over the days of its month.
 
     static void generateFromDayOfWeekAfterDayOfMonth(
                                      bsl::vector<bdlt::Date> *schedule,
@@ -7,17 +7,6 @@ BSLS_IDENT_RCSID(bbldc_basicactual360_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace bbldc {
 
-                          // ---------------------
-                          // struct BasicActual360
-                          // ---------------------
-
-// CLASS METHODS
-double BasicActual360::yearsDiff(const bdlt::Date& beginDate,
-                                 const bdlt::Date& endDate)
-{
-    return (endDate - beginDate) / 360.0;
-}
-
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -116,6 +116,13 @@ int BasicActual360::daysDiff(const bdlt::Date& beginDate,
     return endDate - beginDate;
 }
 
+inline
+double BasicActual360::yearsDiff(const bdlt::Date& beginDate,
+                                 const bdlt::Date& endDate)
+{
+    return (endDate - beginDate) / 360.0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -7,17 +7,6 @@ BSLS_IDENT_RCSID(bbldc_basicactual365fixed_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace bbldc {
 
-                        // --------------------------
-                        // struct BasicActual365Fixed
-                        // --------------------------
-
-// CLASS METHODS
-double BasicActual365Fixed::yearsDiff(const bdlt::Date& beginDate,
-                                      const bdlt::Date& endDate)
-{
-    return (endDate - beginDate) / 365.0;
-}
-
 }  // close package namespace
 }  // close enterprise namespace
 
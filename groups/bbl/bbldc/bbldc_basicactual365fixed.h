@@ -119,6 +119,13 @@ int BasicActual365Fixed::daysDiff(const bdlt::Date& beginDate,
     return endDate - beginDate;
 }
 
+inline
+double BasicActual365Fixed::yearsDiff(const bdlt::Date& beginDate,
+                                      const bdlt::Date& endDate)
+{
+    return (endDate - beginDate) / 365.0;
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
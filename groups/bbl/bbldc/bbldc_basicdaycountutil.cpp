@@ -21,6 +21,38 @@ BSLS_IDENT_RCSID(bbldc_basicdaycountutil_cpp,"$Id$ $CSID$")
 namespace BloombergLP {
 namespace bbldc {
 
+// STATIC HELPER FUNCTIONS
+
+template <class CONVENTION>
+static void loadDaysDiff(int              *result,
+                         const bdlt::Date *beginDates,
+                         const bdlt::Date *endDates,
+                         int               numDates)
+    // Load, into each of the specified 'numDates' elements of the specified
+    // 'result' array, the number of days between the corresponding elements
+    // of the specified 'beginDates' and 'endDates' arrays as computed by the
+    // (template parameter) 'CONVENTION'.
+{
+    for (int i = 0; i < numDates; ++i) {
+        result[i] = CONVENTION::daysDiff(beginDates[i], endDates[i]);
+    }
+}
+
+template <class CONVENTION>
+static void loadYearsDiff(double           *result,
+                          const bdlt::Date *beginDates,
+                          const bdlt::Date *endDates,
+                          int               numDates)
+    // Load, into each of the specified 'numDates' elements of the specified
+    // 'result' array, the number of years between the corresponding elements
+    // of the specified 'beginDates' and 'endDates' arrays as computed by the
+    // (template parameter) 'CONVENTION'.
+{
+    for (int i = 0; i < numDates; ++i) {
+        result[i] = CONVENTION::yearsDiff(beginDates[i], endDates[i]);
+    }
+}
+
                          // ------------------------
                          // struct BasicDayCountUtil
                          // ------------------------
@@ -69,6 +101,75 @@ int BasicDayCountUtil::daysDiff(const bdlt::Date&        beginDate,
     return numDays;
 }
 
+void BasicDayCountUtil::daysDiff(int                      *result,
+                                 const bdlt::Date         *beginDates,
+                                 const bdlt::Date         *endDates,
+                                 int                       numDates,
+                                 DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numDates);
+
+    switch (convention) {
+      case DayCountConvention::e_ACTUAL_360: {
+        loadDaysDiff<bbldc::BasicActual360>(result,
+                                            beginDates,
+                                            endDates,
+                                            numDates);
+      } break;
+      case DayCountConvention::e_ACTUAL_365_FIXED: {
+        loadDaysDiff<bbldc::BasicActual365Fixed>(result,
+                                                 beginDates,
+                                                 endDates,
+                                                 numDates);
+      } break;
+      case DayCountConvention::e_ISDA_30_360_EOM: {
+        loadDaysDiff<bbldc::TerminatedIsda30360Eom>(result,
+                                                    beginDates,
+                                                    endDates,
+                                                    numDates);
+      } break;
+      case DayCountConvention::e_ISDA_ACTUAL_ACTUAL: {
+        loadDaysDiff<bbldc::BasicIsdaActualActual>(result,
+                                                   beginDates,
+                                                   endDates,
+                                                   numDates);
+      } break;
+      case DayCountConvention::e_ISMA_30_360: {
+        loadDaysDiff<bbldc::BasicIsma30360>(result,
+                                            beginDates,
+                                            endDates,
+                                            numDates);
+      } break;
+      case DayCountConvention::e_NL_365: {
+        loadDaysDiff<bbldc::BasicNl365>(result,
+                                        beginDates,
+                                        endDates,
+                                        numDates);
+      } break;
+      case DayCountConvention::e_PSA_30_360_EOM: {
+        loadDaysDiff<bbldc::BasicPsa30360Eom>(result,
+                                              beginDates,
+                                              endDates,
+                                              numDates);
+      } break;
+      case DayCountConvention::e_SIA_30_360_EOM: {
+        loadDaysDiff<bbldc::BasicSia30360Eom>(result,
+                                              beginDates,
+                                              endDates,
+                                              numDates);
+      } break;
+      case DayCountConvention::e_SIA_30_360_NEOM: {
+        loadDaysDiff<bbldc::BasicSia30360Neom>(result,
+                                               beginDates,
+                                               endDates,
+                                               numDates);
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 bool BasicDayCountUtil::isSupported(DayCountConvention::Enum convention)
 {
     bool rv = true;
@@ -136,6 +237,75 @@ double BasicDayCountUtil::yearsDiff(const bdlt::Date&        beginDate,
     return numYears;
 }
 
+void BasicDayCountUtil::yearsDiff(double                   *result,
+                                  const bdlt::Date         *beginDates,
+                                  const bdlt::Date         *endDates,
+                                  int                       numDates,
+                                  DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numDates);
+
+    switch (convention) {
+      case DayCountConvention::e_ACTUAL_360: {
+        loadYearsDiff<bbldc::BasicActual360>(result,
+                                             beginDates,
+                                             endDates,
+                                             numDates);
+      } break;
+      case DayCountConvention::e_ACTUAL_365_FIXED: {
+        loadYearsDiff<bbldc::BasicActual365Fixed>(result,
+                                                  beginDates,
+                                                  endDates,
+                                                  numDates);
+      } break;
+      case DayCountConvention::e_ISDA_30_360_EOM: {
+        loadYearsDiff<bbldc::TerminatedIsda30360Eom>(result,
+                                                     beginDates,
+                                                     endDates,
+                                                     numDates);
+      } break;
+      case DayCountConvention::e_ISDA_ACTUAL_ACTUAL: {
+        loadYearsDiff<bbldc::BasicIsdaActualActual>(result,
+                                                    beginDates,
+                                                    endDates,
+                                                    numDates);
+      } break;
+      case DayCountConvention::e_ISMA_30_360: {
+        loadYearsDiff<bbldc::BasicIsma30360>(result,
+                                             beginDates,
+                                             endDates,
+                                             numDates);
+      } break;
+      case DayCountConvention::e_NL_365: {
+        loadYearsDiff<bbldc::BasicNl365>(result,
+                                         beginDates,
+                                         endDates,
+                                         numDates);
+      } break;
+      case DayCountConvention::e_PSA_30_360_EOM: {
+        loadYearsDiff<bbldc::BasicPsa30360Eom>(result,
+                                               beginDates,
+                                               endDates,
+                                               numDates);
+      } break;
+      case DayCountConvention::e_SIA_30_360_EOM: {
+        loadYearsDiff<bbldc::BasicSia30360Eom>(result,
+                                               beginDates,
+                                               endDates,
+                                               numDates);
+      } break;
+      case DayCountConvention::e_SIA_30_360_NEOM: {
+        loadYearsDiff<bbldc::BasicSia30360Neom>(result,
+                                                beginDates,
+                                                endDates,
+                                                numDates);
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -22,6 +22,12 @@ BSLS_IDENT("$Id: $")
 // 'DayCountConvention::Enum' argument indicating which particular day-count
 // convention to apply.
 //
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// are also provided for computing many day counts or year fractions at once.
+// These overloads select the convention once per call, rather than once per
+// pair of dates, and then apply that convention in a loop that the compiler
+// can inline and, for the conventions counting actual days, vectorize.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -86,6 +92,20 @@ struct BasicDayCountUtil {
         // 'beginDate <= endDate' then the result is non-negative.  Note that
         // reversing the order of 'beginDate' and 'endDate' negates the result.
 
+    static void daysDiff(int                      *result,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         int                       numDates,
+                         DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numDates' elements of the
+        // specified 'result' array, the (signed) number of days between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention'; i.e.,
+        // 'result[i] = daysDiff(beginDates[i], endDates[i], convention)' for
+        // each 'i' in '[0 .. numDates)'.  The behavior is undefined unless
+        // 'isSupported(convention)', '0 <= numDates', and each array has at
+        // least 'numDates' elements.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -101,6 +121,21 @@ struct BasicDayCountUtil {
         // 'beginDate' and 'endDate' negates the result; specifically,
         // '|yearsDiff(b, e, c) + yearsDiff(e, b, c)| <= 1.0e-15' for all dates
         // 'b' and 'e', and day-count conventions 'c'.
+
+    static void yearsDiff(double                   *result,
+                          const bdlt::Date         *beginDates,
+                          const bdlt::Date         *endDates,
+                          int                       numDates,
+                          DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numDates' elements of the
+        // specified 'result' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates'
+        // and 'endDates' arrays according to the specified day-count
+        // 'convention'; i.e.,
+        // 'result[i] = yearsDiff(beginDates[i], endDates[i], convention)' for
+        // each 'i' in '[0 .. numDates)'.  The behavior is undefined unless
+        // 'isSupported(convention)', '0 <= numDates', and each array has at
+        // least 'numDates' elements.
 };
 
 }  // close package namespace
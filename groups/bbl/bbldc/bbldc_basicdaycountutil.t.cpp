@@ -8,9 +8,11 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -26,10 +28,13 @@ using namespace bsl;
 // functionality of these methods.
 // ----------------------------------------------------------------------------
 // [ 2] int daysDiff(beginDate, endDate, convention);
+// [ 4] void daysDiff(result, beginDates, endDates, numDates, conv);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(beginDate, endDate, convention);
+// [ 4] void yearsDiff(result, beginDates, endDates, numDates, conv);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE: BATCH 'daysDiff' AND 'yearsDiff'
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -106,6 +111,18 @@ const Enum PSA_30_360_EOM     = bbldc::DayCountConvention::e_PSA_30_360_EOM;
 const Enum SIA_30_360_EOM     = bbldc::DayCountConvention::e_SIA_30_360_EOM;
 const Enum SIA_30_360_NEOM    = bbldc::DayCountConvention::e_SIA_30_360_NEOM;
 
+const Enum CONVENTIONS[] = { ACTUAL_360,
+                             ACTUAL_365_FIXED,
+                             ISDA_30_360_EOM,
+                             ISDA_ACTUAL_ACTUAL,
+                             ISMA_30_360,
+                             NL_365,
+                             PSA_30_360_EOM,
+                             SIA_30_360_EOM,
+                             SIA_30_360_NEOM };
+
+const int NUM_CONVENTIONS = sizeof CONVENTIONS / sizeof *CONVENTIONS;
+
 //=============================================================================
 //                              MAIN PROGRAM
 //-----------------------------------------------------------------------------
@@ -119,7 +136,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -174,6 +191,152 @@ int main(int argc, char *argv[])
     ASSERT(0.1999 < yearsDiff && 0.2001 > yearsDiff);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'daysDiff' AND 'yearsDiff'
+        //   Verify the methods taking arrays of dates produce, for each pair
+        //   of dates, the same result as the methods taking a single pair.
+        //
+        // Concerns:
+        //: 1 Each element of the result of the batch methods equals the
+        //:   result of the corresponding single-pair method for every
+        //:   supported convention.
+        //:
+        //: 2 Only the first 'numDates' elements of the result are modified.
+        //:
+        //: 3 The methods accept 'numDates == 0'.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Form a set S of dates including month ends and leap days, and
+        //:   arrays of begin and end dates holding every pair of dates in S.
+        //:   For each supported convention, apply the batch methods to every
+        //:   prefix length of a sample of lengths, and compare each result
+        //:   element to the single-pair method, and verify the element past
+        //:   the prefix is unchanged.  (C-1..3)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   void daysDiff(result, beginDates, endDates, numDates, conv);
+        //   void yearsDiff(result, beginDates, endDates, numDates, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'daysDiff' AND 'yearsDiff'"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        static const struct {
+            int d_year;
+            int d_month;
+            int d_day;
+        } DATES[] = {
+            { 1999,  1,  1 }, { 1999,  2, 28 }, { 1999,  3, 31 },
+            { 1999,  4, 30 }, { 1999, 12, 31 }, { 2000,  1, 31 },
+            { 2000,  2, 28 }, { 2000,  2, 29 }, { 2000,  3,  1 },
+            { 2000,  6, 15 }, { 2000,  8, 31 }, { 2001,  2, 28 },
+            { 2003,  2, 28 }, { 2004,  2, 29 }, { 2004, 10, 30 },
+            { 2004, 10, 31 }, { 2005,  1,  1 }, { 2100,  2, 28 },
+        };
+        const int NUM_DATES = sizeof DATES / sizeof *DATES;
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+
+        for (int i = 0; i < NUM_DATES; ++i) {
+            for (int j = 0; j < NUM_DATES; ++j) {
+                beginDates.push_back(bdlt::Date(DATES[i].d_year,
+                                                DATES[i].d_month,
+                                                DATES[i].d_day));
+                endDates.push_back(bdlt::Date(DATES[j].d_year,
+                                              DATES[j].d_month,
+                                              DATES[j].d_day));
+            }
+        }
+
+        const int NUM_PAIRS = static_cast<int>(beginDates.size());
+        const int LENGTHS[] = { 0, 1, 2, 3, 7, 8, 9, 31, 64, NUM_PAIRS };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int    DAYS_SENTINEL  = -999999;
+        const double YEARS_SENTINEL = -999999.0;
+
+        for (int ci = 0; ci < NUM_CONVENTIONS; ++ci) {
+            const Enum CONV = CONVENTIONS[ci];
+
+            if (veryVerbose) { T_ P(CONV); }
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH = LENGTHS[li];
+
+                bsl::vector<int>    days(NUM_PAIRS + 1, DAYS_SENTINEL);
+                bsl::vector<double> years(NUM_PAIRS + 1, YEARS_SENTINEL);
+
+                Util::daysDiff(days.data(),
+                               beginDates.data(),
+                               endDates.data(),
+                               LENGTH,
+                               CONV);
+                Util::yearsDiff(years.data(),
+                                beginDates.data(),
+                                endDates.data(),
+                                LENGTH,
+                                CONV);
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    const bdlt::Date& X = beginDates[i];
+                    const bdlt::Date& Y = endDates[i];
+
+                    ASSERTV(CONV, LENGTH, X, Y,
+                            Util::daysDiff(X, Y, CONV) == days[i]);
+                    ASSERTV(CONV, LENGTH, X, Y,
+                            Util::yearsDiff(X, Y, CONV) == years[i]);
+                }
+                ASSERTV(CONV, LENGTH, DAYS_SENTINEL  == days[LENGTH]);
+                ASSERTV(CONV, LENGTH, YEARS_SENTINEL == years[LENGTH]);
+            }
+        }
+
+        { // negative testing
+            bsls::AssertFailureHandlerGuard
+                                          hG(bsls::AssertTest::failTestDriver);
+
+            int              days[1];
+            double           years[1];
+            const bdlt::Date dates[1];
+
+            ASSERT_PASS(Util::daysDiff(days, dates, dates, 0, ACTUAL_360));
+            ASSERT_FAIL(Util::daysDiff(days, dates, dates, -1, ACTUAL_360));
+
+            ASSERT_PASS(Util::yearsDiff(years, dates, dates, 0, ACTUAL_360));
+            ASSERT_FAIL(Util::yearsDiff(years, dates, dates, -1, ACTUAL_360));
+
+            ASSERT_OPT_PASS(Util::daysDiff(days,
+                                           dates,
+                                           dates,
+                                           1,
+                                           ACTUAL_360));
+            ASSERT_OPT_FAIL(Util::daysDiff(days,
+                                           dates,
+                                           dates,
+                                           1,
+                                           INVALID_CONVENTION));
+
+            ASSERT_OPT_PASS(Util::yearsDiff(years,
+                                            dates,
+                                            dates,
+                                            1,
+                                            ACTUAL_360));
+            ASSERT_OPT_FAIL(Util::yearsDiff(years,
+                                            dates,
+                                            dates,
+                                            1,
+                                            INVALID_CONVENTION));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
@@ -544,6 +707,104 @@ int main(int argc, char *argv[])
                    == Util::isSupported(convention));
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: BATCH 'daysDiff' AND 'yearsDiff'
+        //   Compare the cost of computing many day counts and year fractions
+        //   one pair at a time with the cost of the batch methods.
+        //
+        // Concerns:
+        //: 1 The batch methods are no slower than a loop over the single-pair
+        //:   methods, and substantially faster for the conventions that count
+        //:   actual days.
+        //
+        // Plan:
+        //: 1 Generate 10 million pairs of pseudo-random dates between 1990 and
+        //:   2060.  For each supported convention, time a loop calling the
+        //:   single-pair methods and a call to the batch methods over all the
+        //:   pairs, and report the time per pair.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: BATCH 'daysDiff' AND 'yearsDiff'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: BATCH 'daysDiff' AND 'yearsDiff'"
+                          << endl
+                          << "============================================="
+                          << endl;
+
+        const int NUM_PAIRS = 10 * 1000 * 1000;
+
+        const bdlt::Date FIRST(1990, 1, 1);
+        const int        NUM_DAYS = bdlt::Date(2060, 12, 31) - FIRST + 1;
+
+        bsl::vector<bdlt::Date> beginDates(NUM_PAIRS);
+        bsl::vector<bdlt::Date> endDates(NUM_PAIRS);
+
+        unsigned int seed = 12345;
+        for (int i = 0; i < NUM_PAIRS; ++i) {
+            seed = seed * 1103515245 + 12345;
+            beginDates[i] = FIRST + static_cast<int>((seed >> 8) % NUM_DAYS);
+            seed = seed * 1103515245 + 12345;
+            endDates[i]   = FIRST + static_cast<int>((seed >> 8) % NUM_DAYS);
+        }
+
+        bsl::vector<int>    days(NUM_PAIRS);
+        bsl::vector<double> years(NUM_PAIRS);
+
+        for (int ci = 0; ci < NUM_CONVENTIONS; ++ci) {
+            const Enum CONV = CONVENTIONS[ci];
+
+            bsls::Stopwatch timer;
+
+            timer.start();
+            for (int i = 0; i < NUM_PAIRS; ++i) {
+                days[i] = Util::daysDiff(beginDates[i], endDates[i], CONV);
+            }
+            timer.stop();
+            const double singleDays = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            Util::daysDiff(days.data(),
+                           beginDates.data(),
+                           endDates.data(),
+                           NUM_PAIRS,
+                           CONV);
+            timer.stop();
+            const double batchDays = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            for (int i = 0; i < NUM_PAIRS; ++i) {
+                years[i] = Util::yearsDiff(beginDates[i], endDates[i], CONV);
+            }
+            timer.stop();
+            const double singleYears = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+            Util::yearsDiff(years.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            NUM_PAIRS,
+                            CONV);
+            timer.stop();
+            const double batchYears = timer.elapsedTime();
+
+            const double NS_PER_PAIR = 1.0e9 / NUM_PAIRS;
+
+            cout << CONV << ":\n"
+                 << "\t'daysDiff':  "
+                 << singleDays * NS_PER_PAIR << " ns per pair singly, "
+                 << batchDays  * NS_PER_PAIR << " ns per pair in batch\n"
+                 << "\t'yearsDiff': "
+                 << singleYears * NS_PER_PAIR << " ns per pair singly, "
+                 << batchYears  * NS_PER_PAIR << " ns per pair in batch"
+                 << endl;
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT == FOUND." << endl;
         testStatus = -1;
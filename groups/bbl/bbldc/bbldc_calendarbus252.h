@@ -20,7 +20,9 @@ BSLS_IDENT("$Id: $")
 // 'beginDate < endDate', is exactly the number of *business* days occurring in
 // the time period '[beginDate .. endDate)'.  Reversing the order of the dates
 // negates the result.  When the two dates have the same value, the day count
-// is 0.  The year fraction is the day count divided by 252.
+// is 0.  The year fraction is the day count divided by 252.  The day count is
+// computed in constant time, regardless of the distance between the dates,
+// from the counts of business days maintained by 'bdlt::Calendar'.
 //
 ///Usage
 ///-----
@@ -129,13 +131,8 @@ int CalendarBus252::daysDiff(const bdlt::Date&     beginDate,
     BSLS_ASSERT_SAFE(calendar.isInRange(beginDate));
     BSLS_ASSERT_SAFE(calendar.isInRange(endDate));
 
-    if (beginDate < endDate) {
-        return calendar.numBusinessDays(beginDate, endDate - 1);      // RETURN
-    }
-    else if (beginDate > endDate) {
-        return -calendar.numBusinessDays(endDate, beginDate - 1);     // RETURN
-    }
-    return 0;
+    return calendar.numBusinessDaysBefore(endDate)
+         - calendar.numBusinessDaysBefore(beginDate);
 }
 
 inline
@@ -44,6 +44,32 @@ int CalendarDayCountUtil::daysDiff(const bdlt::Date&        beginDate,
     return numDays;
 }
 
+void CalendarDayCountUtil::daysDiff(int                      *result,
+                                    const bdlt::Date         *beginDates,
+                                    const bdlt::Date         *endDates,
+                                    int                       numDates,
+                                    const bdlt::Calendar&     calendar,
+                                    DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numDates);
+
+    switch (convention) {
+      case DayCountConvention::e_CALENDAR_BUS_252: {
+        for (int i = 0; i < numDates; ++i) {
+            BSLS_ASSERT_SAFE(calendar.isInRange(beginDates[i]));
+            BSLS_ASSERT_SAFE(calendar.isInRange(endDates[i]));
+
+            result[i] = bbldc::CalendarBus252::daysDiff(beginDates[i],
+                                                        endDates[i],
+                                                        calendar);
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 bool CalendarDayCountUtil::isSupported(DayCountConvention::Enum convention)
 {
     bool rv = true;
@@ -84,6 +110,32 @@ double CalendarDayCountUtil::yearsDiff(const bdlt::Date&        beginDate,
     return numYears;
 }
 
+void CalendarDayCountUtil::yearsDiff(double                   *result,
+                                     const bdlt::Date         *beginDates,
+                                     const bdlt::Date         *endDates,
+                                     int                       numDates,
+                                     const bdlt::Calendar&     calendar,
+                                     DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numDates);
+
+    switch (convention) {
+      case DayCountConvention::e_CALENDAR_BUS_252: {
+        for (int i = 0; i < numDates; ++i) {
+            BSLS_ASSERT_SAFE(calendar.isInRange(beginDates[i]));
+            BSLS_ASSERT_SAFE(calendar.isInRange(endDates[i]));
+
+            result[i] = bbldc::CalendarBus252::yearsDiff(beginDates[i],
+                                                         endDates[i],
+                                                         calendar);
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -22,6 +22,11 @@ BSLS_IDENT("$Id: $")
 // 'bbldc::CalendarDayCountUtil' take a trailing 'DayCountConvention::Enum'
 // argument indicating which particular day-count convention to apply.
 //
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// are also provided for computing many day counts or year fractions at once.
+// These overloads select the convention once per call, rather than once per
+// pair of dates.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -101,6 +106,24 @@ struct CalendarDayCountUtil {
         // Note that reversing the order of 'beginDate' and 'endDate' negates
         // the result and that the result is 0 when 'beginDate == endDate'.
 
+    static void daysDiff(int                      *result,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         int                       numDates,
+                         const bdlt::Calendar&     calendar,
+                         DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numDates' elements of the
+        // specified 'result' array, the (signed) number of days between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention' with the
+        // specified 'calendar' providing the definition of business days;
+        // i.e., 'result[i] = daysDiff(beginDates[i], endDates[i], calendar,
+        // convention)' for each 'i' in '[0 .. numDates)'.  The behavior is
+        // undefined unless 'isSupported(convention)', '0 <= numDates', each
+        // array has at least 'numDates' elements, and every date in
+        // 'beginDates' and 'endDates' is within the valid range of
+        // 'calendar'.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -120,6 +143,24 @@ struct CalendarDayCountUtil {
         // '|yearsDiff(b, e, cal, c) + yearsDiff(e, b, cal, c)| <= 1.0e-15' for
         // all calendars 'cal', valid dates 'b' and 'e', and day-count
         // conventions 'c'.
+
+    static void yearsDiff(double                   *result,
+                          const bdlt::Date         *beginDates,
+                          const bdlt::Date         *endDates,
+                          int                       numDates,
+                          const bdlt::Calendar&     calendar,
+                          DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numDates' elements of the
+        // specified 'result' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates'
+        // and 'endDates' arrays according to the specified day-count
+        // 'convention' with the specified 'calendar' providing the definition
+        // of business days; i.e., 'result[i] = yearsDiff(beginDates[i],
+        // endDates[i], calendar, convention)' for each 'i' in
+        // '[0 .. numDates)'.  The behavior is undefined unless
+        // 'isSupported(convention)', '0 <= numDates', each array has at least
+        // 'numDates' elements, and every date in 'beginDates' and 'endDates'
+        // is within the valid range of 'calendar'.
 };
 
 }  // close package namespace
@@ -12,6 +12,7 @@
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -27,10 +28,12 @@ using namespace bsl;
 // functionality of these methods.
 // ----------------------------------------------------------------------------
 // [ 2] int daysDiff(beginDate, endDate, calendar, convention);
+// [ 4] void daysDiff(result, begins, ends, numDates, calendar, conv);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(beginDate, endDate, calendar, convention);
+// [ 4] void yearsDiff(result, begins, ends, numDates, calendar, conv);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -124,7 +127,7 @@ int main(int argc, char *argv[])
     }
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -189,6 +192,142 @@ int main(int argc, char *argv[])
     ASSERT(0.2063 < yearsDiff && 0.2064 > yearsDiff);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'daysDiff' AND 'yearsDiff'
+        //   Verify the methods taking arrays of dates produce, for each pair
+        //   of dates, the same result as the methods taking a single pair.
+        //
+        // Concerns:
+        //: 1 Each element of the result of the batch methods equals the
+        //:   result of the corresponding single-pair method.
+        //:
+        //: 2 Only the first 'numDates' elements of the result are modified.
+        //:
+        //: 3 The methods accept 'numDates == 0'.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Form arrays of begin and end dates holding every pair of dates in
+        //:   the valid range of the calendars CA and CB.  For each calendar,
+        //:   apply the batch methods to every prefix length of a sample of
+        //:   lengths, compare each result element to the single-pair method,
+        //:   and verify the element past the prefix is unchanged.  (C-1..3)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   void daysDiff(result, begins, ends, numDates, calendar, conv);
+        //   void yearsDiff(result, begins, ends, numDates, calendar, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'daysDiff' AND 'yearsDiff'"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+
+        for (bdlt::Date b = CA.firstDate(); b <= CA.lastDate(); ++b) {
+            for (bdlt::Date e = CA.firstDate(); e <= CA.lastDate(); ++e) {
+                beginDates.push_back(b);
+                endDates.push_back(e);
+            }
+        }
+
+        const int NUM_PAIRS = static_cast<int>(beginDates.size());
+        const int LENGTHS[] = { 0, 1, 2, 3, 7, 8, 9, 31, 64, NUM_PAIRS };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int    DAYS_SENTINEL  = -999999;
+        const double YEARS_SENTINEL = -999999.0;
+
+        const bdlt::Calendar *CALENDARS[] = { &CA, &CB };
+        const int NUM_CALENDARS = sizeof CALENDARS / sizeof *CALENDARS;
+
+        for (int ci = 0; ci < NUM_CALENDARS; ++ci) {
+            const bdlt::Calendar& CAL = *CALENDARS[ci];
+
+            for (int li = 0; li < NUM_LENGTHS; ++li) {
+                const int LENGTH = LENGTHS[li];
+
+                if (veryVerbose) { T_ P_(ci) P(LENGTH); }
+
+                bsl::vector<int>    days(NUM_PAIRS + 1, DAYS_SENTINEL);
+                bsl::vector<double> years(NUM_PAIRS + 1, YEARS_SENTINEL);
+
+                Util::daysDiff(days.data(),
+                               beginDates.data(),
+                               endDates.data(),
+                               LENGTH,
+                               CAL,
+                               CALENDAR_BUS_252);
+                Util::yearsDiff(years.data(),
+                                beginDates.data(),
+                                endDates.data(),
+                                LENGTH,
+                                CAL,
+                                CALENDAR_BUS_252);
+
+                for (int i = 0; i < LENGTH; ++i) {
+                    const bdlt::Date& X = beginDates[i];
+                    const bdlt::Date& Y = endDates[i];
+
+                    ASSERTV(ci, LENGTH, X, Y,
+                            Util::daysDiff(X, Y, CAL, CALENDAR_BUS_252)
+                                                                  == days[i]);
+                    ASSERTV(ci, LENGTH, X, Y,
+                            Util::yearsDiff(X, Y, CAL, CALENDAR_BUS_252)
+                                                                 == years[i]);
+                }
+                ASSERTV(ci, LENGTH, DAYS_SENTINEL  == days[LENGTH]);
+                ASSERTV(ci, LENGTH, YEARS_SENTINEL == years[LENGTH]);
+            }
+        }
+
+        { // negative testing
+            bsls::AssertFailureHandlerGuard
+                                          hG(bsls::AssertTest::failTestDriver);
+
+            int              days[1];
+            double           years[1];
+            const bdlt::Date IN[1]  = { bdlt::Date(2015, 6, 1) };
+            const bdlt::Date OUT[1] = { bdlt::Date(2015, 7, 1) };
+            const Enum       BUS    = CALENDAR_BUS_252;
+
+            ASSERT_PASS(Util::daysDiff(days, IN, IN,  0, CA, BUS));
+            ASSERT_FAIL(Util::daysDiff(days, IN, IN, -1, CA, BUS));
+
+            ASSERT_PASS(Util::yearsDiff(years, IN, IN,  0, CA, BUS));
+            ASSERT_FAIL(Util::yearsDiff(years, IN, IN, -1, CA, BUS));
+
+            ASSERT_SAFE_PASS(Util::daysDiff(days, IN,  IN,  1, CA, BUS));
+            ASSERT_SAFE_FAIL(Util::daysDiff(days, OUT, IN,  1, CA, BUS));
+            ASSERT_SAFE_FAIL(Util::daysDiff(days, IN,  OUT, 1, CA, BUS));
+
+            ASSERT_SAFE_PASS(Util::yearsDiff(years, IN,  IN,  1, CA, BUS));
+            ASSERT_SAFE_FAIL(Util::yearsDiff(years, OUT, IN,  1, CA, BUS));
+            ASSERT_SAFE_FAIL(Util::yearsDiff(years, IN,  OUT, 1, CA, BUS));
+
+            ASSERT_OPT_FAIL(Util::daysDiff(
+                             days,
+                             IN,
+                             IN,
+                             1,
+                             CA,
+                             bbldc::DayCountConvention::e_ISDA_ACTUAL_ACTUAL));
+            ASSERT_OPT_FAIL(Util::yearsDiff(
+                             years,
+                             IN,
+                             IN,
+                             1,
+                             CA,
+                             bbldc::DayCountConvention::e_ISDA_ACTUAL_ACTUAL));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
@@ -62,6 +62,27 @@ int PeriodDayCountUtil::daysDiff(const bdlt::Date&        beginDate,
     return numDays;
 }
 
+void PeriodDayCountUtil::daysDiff(int                      *result,
+                                  const bdlt::Date         *beginDates,
+                                  const bdlt::Date         *endDates,
+                                  int                       numDates,
+                                  DayCountConvention::Enum  convention)
+{
+    BSLS_ASSERT(0 <= numDates);
+
+    switch (convention) {
+      case DayCountConvention::e_PERIOD_ICMA_ACTUAL_ACTUAL: {
+        for (int i = 0; i < numDates; ++i) {
+            result[i] = bbldc::PeriodIcmaActualActual::daysDiff(beginDates[i],
+                                                                endDates[i]);
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 bool PeriodDayCountUtil::isSupported(DayCountConvention::Enum convention)
 {
     bool rv = true;
@@ -110,6 +131,41 @@ double PeriodDayCountUtil::yearsDiff(
     return numYears;
 }
 
+void PeriodDayCountUtil::yearsDiff(
+                                double                         *result,
+                                const bdlt::Date               *beginDates,
+                                const bdlt::Date               *endDates,
+                                int                             numDates,
+                                const bsl::vector<bdlt::Date>&  periodDate,
+                                double                          periodYearDiff,
+                                DayCountConvention::Enum        convention)
+{
+    BSLS_ASSERT(0 <= numDates);
+    BSLS_ASSERT(periodDate.size() >= 2);
+
+    BSLS_ASSERT_SAFE(isSortedAndUnique(periodDate.begin(), periodDate.end()));
+
+    switch (convention) {
+      case DayCountConvention::e_PERIOD_ICMA_ACTUAL_ACTUAL: {
+        for (int i = 0; i < numDates; ++i) {
+            BSLS_ASSERT(periodDate.front() <= beginDates[i]);
+            BSLS_ASSERT(beginDates[i]      <= periodDate.back());
+            BSLS_ASSERT(periodDate.front() <= endDates[i]);
+            BSLS_ASSERT(endDates[i]        <= periodDate.back());
+
+            result[i] = bbldc::PeriodIcmaActualActual::yearsDiff(
+                                                               beginDates[i],
+                                                               endDates[i],
+                                                               periodDate,
+                                                               periodYearDiff);
+        }
+      } break;
+      default: {
+        BSLS_ASSERT_OPT(0 && "Unrecognized convention");
+      } break;
+    }
+}
+
 }  // close package namespace
 }  // close enterprise namespace
 
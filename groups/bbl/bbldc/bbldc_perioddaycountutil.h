@@ -22,6 +22,11 @@ BSLS_IDENT("$Id: $")
 // take a trailing 'DayCountConvention::Enum' argument indicating which
 // particular period-based day-count convention to apply.
 //
+// Overloads of 'daysDiff' and 'yearsDiff' taking arrays of begin and end dates
+// are also provided for computing many day counts or year fractions at once.
+// These overloads select the convention once per call, rather than once per
+// pair of dates.
+//
 ///Usage
 ///-----
 // This section illustrates intended use of this component.
@@ -99,6 +104,20 @@ struct PeriodDayCountUtil {
         // behavior is undefined unless 'isSupported(convention)'.  Note that
         // reversing the order of 'beginDate' and 'endDate' negates the result.
 
+    static void daysDiff(int                      *result,
+                         const bdlt::Date         *beginDates,
+                         const bdlt::Date         *endDates,
+                         int                       numDates,
+                         DayCountConvention::Enum  convention);
+        // Load, into each of the specified 'numDates' elements of the
+        // specified 'result' array, the (signed) number of days between the
+        // corresponding elements of the specified 'beginDates' and 'endDates'
+        // arrays according to the specified day-count 'convention'; i.e.,
+        // 'result[i] = daysDiff(beginDates[i], endDates[i], convention)' for
+        // each 'i' in '[0 .. numDates)'.  The behavior is undefined unless
+        // 'isSupported(convention)', '0 <= numDates', and each array has at
+        // least 'numDates' elements.
+
     static bool isSupported(DayCountConvention::Enum convention);
         // Return 'true' if the specified 'convention' is valid for use in
         // 'daysDiff' and 'yearsDiff', and 'false' otherwise.
@@ -123,6 +142,28 @@ struct PeriodDayCountUtil {
         // '|yearsDiff(b,e,pd,pyd,c) + yearsDiff(e,b,pd,pyd,c)| <= 1.0e-15' for
         // all dates 'b' and 'e', periods 'pd', and year fraction per period
         // 'pyd'.
+
+    static void yearsDiff(double                         *result,
+                          const bdlt::Date               *beginDates,
+                          const bdlt::Date               *endDates,
+                          int                             numDates,
+                          const bsl::vector<bdlt::Date>&  periodDate,
+                          double                          periodYearDiff,
+                          DayCountConvention::Enum        convention);
+        // Load, into each of the specified 'numDates' elements of the
+        // specified 'result' array, the (signed fractional) number of years
+        // between the corresponding elements of the specified 'beginDates'
+        // and 'endDates' arrays according to the specified day-count
+        // 'convention' with periods starting on the specified 'periodDate'
+        // values and each period having a duration of the specified
+        // 'periodYearDiff' years; i.e., 'result[i] = yearsDiff(beginDates[i],
+        // endDates[i], periodDate, periodYearDiff, convention)' for each 'i'
+        // in '[0 .. numDates)'.  The behavior is undefined unless
+        // 'isSupported(convention)', '0 <= numDates', each array has at least
+        // 'numDates' elements, 'periodDate.size() >= 2', the values contained
+        // in 'periodDate' are unique and sorted from minimum to maximum, and
+        // every date in 'beginDates' and 'endDates' is within
+        // '[periodDate.front() .. periodDate.back()]'.
 };
 
 }  // close package namespace
@@ -11,6 +11,7 @@
 
 #include <bsl_cstdlib.h>     // 'atoi'
 #include <bsl_iostream.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -26,10 +27,12 @@ using namespace bsl;
 // functionality of these methods.
 // ----------------------------------------------------------------------------
 // [ 2] int daysDiff(beginDate, endDate, convention);
+// [ 4] void daysDiff(result, begins, ends, numDates, convention);
 // [ 1] bool isSupported(convention);
 // [ 3] double yearsDiff(begin, end, periodDate, periodYearDiff, conv);
+// [ 4] void yearsDiff(result, begins, ends, numDates, pD, pYD, conv);
 // ----------------------------------------------------------------------------
-// [ 4] USAGE EXAMPLE
+// [ 5] USAGE EXAMPLE
 // ----------------------------------------------------------------------------
 
 // ============================================================================
@@ -110,7 +113,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:
-      case 4: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -174,6 +177,158 @@ int main(int argc, char *argv[])
     ASSERT(yearsDiff > 0.1983 && yearsDiff < 0.1985);
 //..
       } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING BATCH 'daysDiff' AND 'yearsDiff'
+        //   Verify the methods taking arrays of dates produce, for each pair
+        //   of dates, the same result as the methods taking a single pair.
+        //
+        // Concerns:
+        //: 1 Each element of the result of the batch methods equals the
+        //:   result of the corresponding single-pair method.
+        //:
+        //: 2 Only the first 'numDates' elements of the result are modified.
+        //:
+        //: 3 The methods accept 'numDates == 0'.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Specify a quarterly schedule of period dates, and form arrays of
+        //:   begin and end dates holding every pair of a sample of dates
+        //:   within the schedule, including the period dates themselves.
+        //:   Apply the batch methods to every prefix length of a sample of
+        //:   lengths, compare each result element to the single-pair method,
+        //:   and verify the element past the prefix is unchanged.  (C-1..3)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-4)
+        //
+        // Testing:
+        //   void daysDiff(result, begins, ends, numDates, convention);
+        //   void yearsDiff(result, begins, ends, numDates, pD, pYD, conv);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING BATCH 'daysDiff' AND 'yearsDiff'"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        const Enum ICMA = PERIOD_ICMA_ACTUAL_ACTUAL;
+
+        bsl::vector<bdlt::Date>        mSchedule;
+        const bsl::vector<bdlt::Date>& SCHEDULE = mSchedule;
+        {
+            for (int year = 2000; year <= 2002; ++year) {
+                for (int month = 1; month <= 12; month += 3) {
+                    mSchedule.push_back(bdlt::Date(year, month, 1));
+                }
+            }
+            mSchedule.push_back(bdlt::Date(2003, 1, 1));
+        }
+
+        bsl::vector<bdlt::Date> dates;
+        for (bdlt::Date d = SCHEDULE.front(); d <= SCHEDULE.back(); d += 23) {
+            dates.push_back(d);
+        }
+        dates.insert(dates.end(), SCHEDULE.begin(), SCHEDULE.end());
+
+        bsl::vector<bdlt::Date> beginDates;
+        bsl::vector<bdlt::Date> endDates;
+
+        for (bsl::size_t i = 0; i < dates.size(); ++i) {
+            for (bsl::size_t j = 0; j < dates.size(); ++j) {
+                beginDates.push_back(dates[i]);
+                endDates.push_back(dates[j]);
+            }
+        }
+
+        const int NUM_PAIRS = static_cast<int>(beginDates.size());
+        const int LENGTHS[] = { 0, 1, 2, 3, 7, 8, 9, 31, 64, NUM_PAIRS };
+        const int NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS;
+
+        const int    DAYS_SENTINEL  = -999999;
+        const double YEARS_SENTINEL = -999999.0;
+
+        for (int li = 0; li < NUM_LENGTHS; ++li) {
+            const int LENGTH = LENGTHS[li];
+
+            if (veryVerbose) { T_ P(LENGTH); }
+
+            bsl::vector<int>    days(NUM_PAIRS + 1, DAYS_SENTINEL);
+            bsl::vector<double> years(NUM_PAIRS + 1, YEARS_SENTINEL);
+
+            Util::daysDiff(days.data(),
+                           beginDates.data(),
+                           endDates.data(),
+                           LENGTH,
+                           ICMA);
+            Util::yearsDiff(years.data(),
+                            beginDates.data(),
+                            endDates.data(),
+                            LENGTH,
+                            SCHEDULE,
+                            0.25,
+                            ICMA);
+
+            for (int i = 0; i < LENGTH; ++i) {
+                const bdlt::Date& X = beginDates[i];
+                const bdlt::Date& Y = endDates[i];
+
+                ASSERTV(LENGTH, X, Y, Util::daysDiff(X, Y, ICMA) == days[i]);
+                ASSERTV(LENGTH, X, Y,
+                        Util::yearsDiff(X, Y, SCHEDULE, 0.25, ICMA)
+                                                                 == years[i]);
+            }
+            ASSERTV(LENGTH, DAYS_SENTINEL  == days[LENGTH]);
+            ASSERTV(LENGTH, YEARS_SENTINEL == years[LENGTH]);
+        }
+
+        { // negative testing
+            bsls::AssertFailureHandlerGuard
+                                          hG(bsls::AssertTest::failTestDriver);
+
+            int              days[1];
+            double           years[1];
+            const bdlt::Date IN[1]  = { bdlt::Date(2001, 6, 1) };
+            const bdlt::Date OUT[1] = { bdlt::Date(2003, 6, 1) };
+            const Enum       BAD    =
+                               bbldc::DayCountConvention::e_ISDA_ACTUAL_ACTUAL;
+
+            const bsl::vector<bdlt::Date>& S = SCHEDULE;
+
+            const bsl::vector<bdlt::Date> SHORT(S.begin(), S.begin() + 1);
+
+            bsl::vector<bdlt::Date> mUnsorted(S);
+            mUnsorted[1] = S[2];
+            mUnsorted[2] = S[1];
+            const bsl::vector<bdlt::Date>& UNSORTED = mUnsorted;
+
+            ASSERT_PASS(Util::daysDiff(days, IN, IN,  0, ICMA));
+            ASSERT_FAIL(Util::daysDiff(days, IN, IN, -1, ICMA));
+
+            ASSERT_OPT_PASS(Util::daysDiff(days, IN, IN, 1, ICMA));
+            ASSERT_OPT_FAIL(Util::daysDiff(days, IN, IN, 1, BAD));
+
+            ASSERT_PASS(Util::yearsDiff(years, IN, IN,  0, S, 1.0, ICMA));
+            ASSERT_FAIL(Util::yearsDiff(years, IN, IN, -1, S, 1.0, ICMA));
+
+            ASSERT_FAIL(Util::yearsDiff(years, IN,  IN,  1, SHORT, 1.0, ICMA));
+            ASSERT_FAIL(Util::yearsDiff(years, OUT, IN,  1, S,     1.0, ICMA));
+            ASSERT_FAIL(Util::yearsDiff(years, IN,  OUT, 1, S,     1.0, ICMA));
+
+            ASSERT_SAFE_FAIL(Util::yearsDiff(years,
+                                             IN,
+                                             IN,
+                                             1,
+                                             UNSORTED,
+                                             1.0,
+                                             ICMA));
+
+            ASSERT_OPT_PASS(Util::yearsDiff(years, IN, IN, 1, S, 1.0, ICMA));
+            ASSERT_OPT_FAIL(Util::yearsDiff(years, IN, IN, 1, S, 1.0, BAD));
+        }
+      } break;
       case 3: {
         // --------------------------------------------------------------------
         // TESTING 'yearsDiff'
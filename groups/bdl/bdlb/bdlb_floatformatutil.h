@@ -0,0 +1,210 @@
+// bdlb_floatformatutil.h                                             -*-C++-*-
+#ifndef INCLUDED_BDLB_FLOATFORMATUTIL
+#define INCLUDED_BDLB_FLOATFORMATUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide shortest round-trip decimal formatting of binary floats.
+//
+//@CLASSES:
+//  bdlb::FloatFormatUtil: namespace for 'float' and 'double' formatting
+//
+//@SEE_ALSO: bdlb_float
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bdlb::FloatFormatUtil', that converts 'float' and 'double' values to
+// decimal text.  The conversion is based on the *shortest* sequence of
+// significant decimal digits that identifies the binary value: parsing that
+// sequence (e.g., with 'strtod') yields the original value, and no shorter
+// sequence does.  When several sequences of that length identify the value,
+// the one closest to the exact binary value is selected.
+//
+// 'decompose' provides the digits and the decimal exponent of the shortest
+// representation of a value.  'formatGeneral' writes a value in the style of
+// the 'printf' conversion '%.*g', where the precision is the maximum number of
+// significant digits written:
+//
+//: o If the shortest representation has at most 'precision' digits, it is
+//:   written as is.
+//:
+//: o Otherwise, the value is rounded to 'precision' significant digits.
+//
+// Scientific notation is used, as for '%g', if the decimal exponent of the
+// first significant digit is less than -4 or at least 'precision', and
+// trailing zeros after the decimal point are never written.  Therefore, the
+// output of 'formatGeneral' for a normal value is identical to that of '%.*g'
+// as long as 'precision' does not exceed 'bsl::numeric_limits<TYPE>::digits10'
+// (i.e., 15 for 'double', and 6 for 'float').  For greater precisions, and
+// for subnormal values (whose precision is reduced), 'formatGeneral' omits
+// the trailing digits that '%.*g' produces beyond those needed to identify the
+// value (e.g., 0.1 is written as "0.1" with a precision of 17, rather than
+// "0.10000000000000001", and the smallest positive 'double' is written as
+// "5e-324" with a precision of 6, rather than "4.94066e-324").  Note that
+// 'formatGeneral' with the maximum precision of a type ('k_MAX_DOUBLE_DIGITS'
+// or 'k_MAX_FLOAT_DIGITS') always writes the shortest representation, and
+// hence always round-trips.
+//
+// Unlike 'printf', the functions of this component are not affected by the
+// locale of the program: the decimal separator is always '.'.
+//
+///Performance
+///-----------
+// The conversion implements the Ryu algorithm (see
+// https://dl.acm.org/citation.cfm?id=3192369), which computes the shortest
+// representation using a few multiplications by precomputed powers of 5 and
+// a short loop removing the digits that are not needed.  It is typically
+// several times faster than formatting with 'sprintf', which computes the
+// exact decimal expansion of the value.  In the rare cases where rounding to
+// 'precision' digits cannot be derived from the shortest representation (its
+// last digit is a 5 just beyond the precision, so that the direction of the
+// rounding depends on the exact value), 'formatGeneral' falls back to
+// 'sprintf'.
+//
+///Thread Safety
+///-------------
+// Any of the functions in this component may safely be called simultaneously
+// from multiple threads, even with the same arguments.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing Prices
+///- - - - - - - - - - - - -
+// Suppose that we are writing the prices of a financial instrument in a text
+// format that will be parsed by another program.  We want the text to be as
+// short as possible, and the parsed values to be exactly the ones written.
+//
+// First, we write a price that has a short decimal representation.  Note that
+// the value of the 'double' closest to 101.15 is not exactly 101.15:
+//..
+//  char buffer[bdlb::FloatFormatUtil::k_MAX_LENGTH + 1];
+//
+//  int length = bdlb::FloatFormatUtil::formatGeneral(
+//                                 buffer,
+//                                 101.15,
+//                                 bdlb::FloatFormatUtil::k_MAX_DOUBLE_DIGITS);
+//  assert(6 == length);
+//  assert(0 == bsl::strcmp("101.15", buffer));
+//..
+// Then, we write a price computed from an integral number of ticks of 1/32,
+// which is written exactly:
+//..
+//  length = bdlb::FloatFormatUtil::formatGeneral(
+//                                 buffer,
+//                                 99 + 17 / 32.0,
+//                                 bdlb::FloatFormatUtil::k_MAX_DOUBLE_DIGITS);
+//  assert(0 == bsl::strcmp("99.53125", buffer));
+//..
+// Next, we write the result of a computation whose shortest representation
+// needs 17 digits, which are all written at the maximum precision:
+//..
+//  length = bdlb::FloatFormatUtil::formatGeneral(
+//                                 buffer,
+//                                 0.1 + 0.2,
+//                                 bdlb::FloatFormatUtil::k_MAX_DOUBLE_DIGITS);
+//  assert(0 == bsl::strcmp("0.30000000000000004", buffer));
+//..
+// Then, we write the same value with a precision of 15 digits, which yields
+// the same text as 'sprintf' with the '%.15g' format:
+//..
+//  length = bdlb::FloatFormatUtil::formatGeneral(buffer, 0.1 + 0.2, 15);
+//  assert(0 == bsl::strcmp("0.3", buffer));
+//..
+// Finally, we obtain the digits and the exponent of the shortest
+// representation of a small value, as a basis for a custom format:
+//..
+//  char digits[bdlb::FloatFormatUtil::k_MAX_DOUBLE_DIGITS];
+//  int  exponent;
+//
+//  const int numDigits = bdlb::FloatFormatUtil::decompose(digits,
+//                                                         &exponent,
+//                                                         -0.000125);
+//  assert(3  == numDigits);
+//  assert(0  == bsl::memcmp("125", digits, 3));
+//  assert(-4 == exponent);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlb {
+
+                          // ======================
+                          // struct FloatFormatUtil
+                          // ======================
+
+struct FloatFormatUtil {
+    // This 'struct' provides a namespace for utility functions that convert
+    // 'float' and 'double' values to their shortest decimal representation.
+
+    // CONSTANTS
+    enum {
+        k_MAX_DOUBLE_DIGITS = 17,  // maximum number of significant digits
+                                   // of the shortest representation of a
+                                   // 'double'
+
+        k_MAX_FLOAT_DIGITS  = 9,   // maximum number of significant digits
+                                   // of the shortest representation of a
+                                   // 'float'
+
+        k_MAX_LENGTH        = 24   // maximum number of characters written
+                                   // by 'formatGeneral', not including the
+                                   // null terminator
+    };
+
+    // CLASS METHODS
+    static int decompose(char *digits, int *exponent, double value);
+    static int decompose(char *digits, int *exponent, float  value);
+        // Load into the specified 'digits' the shortest sequence of decimal
+        // digits 'd1 d2 ... dn' such that 'd1.d2...dn * 10^e', where 'e' is
+        // the value loaded into the specified 'exponent', identifies the
+        // absolute value of the specified 'value', and return 'n'.  If
+        // several sequences of that length identify the value, the one
+        // closest to it is loaded.  If 'value' is zero, load "0" and 0.  The
+        // digits are not null-terminated, and the last digit is not '0'
+        // unless 'value' is zero.  The behavior is undefined unless 'digits'
+        // has room for 'k_MAX_DOUBLE_DIGITS' (or 'k_MAX_FLOAT_DIGITS')
+        // characters, and 'value' is finite.  Note that the sign of 'value'
+        // is ignored.
+
+    static int formatGeneral(char *buffer, double value, int precision);
+    static int formatGeneral(char *buffer, float  value, int precision);
+        // Write into the specified 'buffer' the null-terminated decimal
+        // representation of the specified 'value' having at most the
+        // specified 'precision' significant digits, in the style of the
+        // 'printf' format '%.*g', and return the number of characters
+        // written, not including the null terminator.  If the shortest
+        // representation of 'value' has at most 'precision' digits, it is
+        // written; otherwise, 'value' is rounded to 'precision' digits.  See
+        // {Description} for the notation used.  The behavior is undefined
+        // unless 'buffer' has room for 'k_MAX_LENGTH + 1' characters, 'value'
+        // is finite, and '1 <= precision <= k_MAX_DOUBLE_DIGITS' (or
+        // 'k_MAX_FLOAT_DIGITS').
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1026 @@
+// bdlb_floatformatutil.t.cpp                                         -*-C++-*-
+#include <bdlb_floatformatutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cfloat.h>
+#include <bsl_cmath.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a utility converting binary floating-point
+// values to decimal text.  'decompose' is verified on tables of values whose
+// shortest representations are known, including the boundaries of each type
+// (zero, subnormals, and the largest values) and values whose shortest
+// representation is not the correctly rounded one of the same length.  It is
+// then verified, on random bit patterns and on random decimal values, against
+// an oracle that searches, with 'sprintf' and 'strtod', for the shortest
+// precision at which the value round-trips.  'formatGeneral' is verified on
+// tables of values, precisions, and expected texts, and, on random values,
+// against 'sprintf' with the '%.*g' format for the precisions where both must
+// agree, and for round-tripping at the maximum precision.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] int decompose(char *digits, int *exponent, double value);
+// [ 3] int decompose(char *digits, int *exponent, float value);
+// [ 4] int formatGeneral(char *buffer, double value, int precision);
+// [ 5] int formatGeneral(char *buffer, float value, int precision);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: 'formatGeneral' vs. 'sprintf'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBALS, TYPEDEFS, CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::FloatFormatUtil Util;
+typedef bsls::Types::Uint64   Uint64;
+
+// ============================================================================
+//                            TEST APPARATUS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 nextRandom(Uint64 *state)
+    // Return the next value of the pseudo-random sequence having the
+    // specified 'state' ("xorshift64"), and update 'state'.
+{
+    Uint64 x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+double parse(const char *text, double)
+    // Return the 'double' value of the specified 'text'.
+{
+    return bsl::strtod(text, 0);
+}
+
+float parse(const char *text, float)
+    // Return the 'float' value of the specified 'text'.
+{
+    return static_cast<float>(bsl::strtod(text, 0));
+}
+
+template <class TYPE>
+void checkDecompose(TYPE value, int line)
+    // Verify that 'Util::decompose' loads the shortest representation of the
+    // specified 'value' that round-trips, comparing it with the one found by
+    // searching, with 'sprintf', for the smallest precision at which 'value'
+    // round-trips, and report errors using the specified 'line'.  Note that
+    // the conversion of a 'float' from a 'double' text is exact here, since
+    // the texts have at most 9 digits.
+{
+    const TYPE absValue = value < 0 ? -value : value;
+    const int  maxDigits = sizeof(TYPE) == sizeof(float)
+                         ? Util::k_MAX_FLOAT_DIGITS
+                         : Util::k_MAX_DOUBLE_DIGITS;
+
+    char digits[Util::k_MAX_DOUBLE_DIGITS];
+    int  exponent  = 12345;
+    const int numDigits = Util::decompose(digits, &exponent, value);
+
+    LOOP2_ASSERT(line, numDigits, 1 <= numDigits && numDigits <= maxDigits);
+    if (numDigits < 1 || maxDigits < numDigits) {
+        return;                                                       // RETURN
+    }
+    LOOP_ASSERT(line, '0' != digits[0] || 0 == absValue);
+    LOOP_ASSERT(line, '0' != digits[numDigits - 1] || 0 == absValue);
+
+    char text[64];
+    bsl::sprintf(text,
+                 "%c.%.*se%d",
+                 digits[0],
+                 numDigits - 1,
+                 digits + 1,
+                 exponent);
+    LOOP2_ASSERT(line, text, absValue == parse(text, value));
+
+    // Search for the oracle's shortest precision.
+
+    char oracle[64];
+    int  oracleDigits = maxDigits;
+    for (int p = 1; p <= maxDigits; ++p) {
+        bsl::sprintf(oracle, "%.*e", p - 1, static_cast<double>(absValue));
+        if (absValue == parse(oracle, value)) {
+            oracleDigits = p;
+            break;
+        }
+    }
+
+    // 'decompose' may find a shorter representation that is not the
+    // correctly rounded one; if they have the same length, they must match.
+
+    LOOP3_ASSERT(line, text, oracle, numDigits <= oracleDigits);
+    if (numDigits == oracleDigits) {
+        char expected[32];
+        int  length = 0;
+        for (const char *p = oracle; 'e' != *p; ++p) {
+            if ('.' != *p) {
+                expected[length++] = *p;
+            }
+        }
+        while (1 < length && '0' == expected[length - 1]) {
+            --length;
+        }
+        const int expectedExponent = bsl::atoi(bsl::strchr(oracle, 'e') + 1);
+
+        LOOP3_ASSERT(line, text, oracle,
+                     numDigits == length
+                  && 0 == bsl::memcmp(expected, digits, numDigits)
+                  && expectedExponent == exponent);
+    }
+}
+
+template <class TYPE>
+void checkFormatGeneral(TYPE value, int line)
+    // Verify that 'Util::formatGeneral' writes the specified 'value' as
+    // 'sprintf' with the '%.*g' format does for each precision not exceeding
+    // 'digits10', if 'value' is normal, and that the text round-trips at the
+    // maximum precision, and report errors using the specified 'line'.
+{
+    const int maxDigits = sizeof(TYPE) == sizeof(float)
+                        ? Util::k_MAX_FLOAT_DIGITS
+                        : Util::k_MAX_DOUBLE_DIGITS;
+    const bool isNormal = 0 == value
+                       || bsl::numeric_limits<TYPE>::min() <= value
+                       || value <= -bsl::numeric_limits<TYPE>::min();
+
+    char buffer[Util::k_MAX_LENGTH + 8];
+    char expected[64];
+
+    for (int p = 1; p <= maxDigits; ++p) {
+        bsl::memset(buffer, '#', sizeof buffer);
+
+        const int length = Util::formatGeneral(buffer, value, p);
+
+        LOOP2_ASSERT(line, p, length <= Util::k_MAX_LENGTH);
+        LOOP2_ASSERT(line, p, length == static_cast<int>(bsl::strlen(buffer)));
+
+        if (isNormal && p <= bsl::numeric_limits<TYPE>::digits10) {
+            bsl::sprintf(expected, "%.*g", p, static_cast<double>(value));
+            LOOP4_ASSERT(line, p, buffer, expected,
+                         0 == bsl::strcmp(expected, buffer));
+        }
+        if (maxDigits == p) {
+            LOOP2_ASSERT(line, buffer, value == parse(buffer, value));
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Writing Prices
+///- - - - - - - - - - - - -
+// Suppose that we are writing the prices of a financial instrument in a text
+// format that will be parsed by another program.  We want the text to be as
+// short as possible, and the parsed values to be exactly the ones written.
+//
+// First, we write a price that has a short decimal representation.  Note that
+// the value of the 'double' closest to 101.15 is not exactly 101.15:
+//..
+    char buffer[bdlb::FloatFormatUtil::k_MAX_LENGTH + 1];
+
+    int length = bdlb::FloatFormatUtil::formatGeneral(
+                                   buffer,
+                                   101.15,
+                                   bdlb::FloatFormatUtil::k_MAX_DOUBLE_DIGITS);
+    ASSERT(6 == length);
+    ASSERT(0 == bsl::strcmp("101.15", buffer));
+//..
+// Then, we write a price computed from an integral number of ticks of 1/32,
+// which is written exactly:
+//..
+    length = bdlb::FloatFormatUtil::formatGeneral(
+                                   buffer,
+                                   99 + 17 / 32.0,
+                                   bdlb::FloatFormatUtil::k_MAX_DOUBLE_DIGITS);
+    ASSERT(0 == bsl::strcmp("99.53125", buffer));
+//..
+// Next, we write the result of a computation whose shortest representation
+// needs 17 digits, which are all written at the maximum precision:
+//..
+    length = bdlb::FloatFormatUtil::formatGeneral(
+                                   buffer,
+                                   0.1 + 0.2,
+                                   bdlb::FloatFormatUtil::k_MAX_DOUBLE_DIGITS);
+    ASSERT(0 == bsl::strcmp("0.30000000000000004", buffer));
+//..
+// Then, we write the same value with a precision of 15 digits, which yields
+// the same text as 'sprintf' with the '%.15g' format:
+//..
+    length = bdlb::FloatFormatUtil::formatGeneral(buffer, 0.1 + 0.2, 15);
+    ASSERT(0 == bsl::strcmp("0.3", buffer));
+//..
+// Finally, we obtain the digits and the exponent of the shortest
+// representation of a small value, as a basis for a custom format:
+//..
+    char digits[bdlb::FloatFormatUtil::k_MAX_DOUBLE_DIGITS];
+    int  exponent;
+
+    const int numDigits = bdlb::FloatFormatUtil::decompose(digits,
+                                                           &exponent,
+                                                           -0.000125);
+    ASSERT(3  == numDigits);
+    ASSERT(0  == bsl::memcmp("125", digits, 3));
+    ASSERT(-4 == exponent);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // 'formatGeneral' FOR 'float'
+        //
+        // Concerns:
+        //: 1 For a normal value and a precision not exceeding 6, the text is
+        //:   the one written by 'sprintf' with the '%.*g' format.
+        //:
+        //: 2 The shortest representation is written if it has at most
+        //:   'precision' digits, in the notation of '%g'.
+        //:
+        //: 3 The text written at the maximum precision round-trips.
+        //:
+        //: 4 The text is null-terminated, its length is returned, and it does
+        //:   not exceed 'k_MAX_LENGTH'.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the text written for a
+        //:   set of values and precisions.  (C-2, 4)
+        //:
+        //: 2 For random bit patterns, random decimal values, and every power
+        //:   of 2, compare the text with the one written by 'sprintf' for
+        //:   each precision up to 6, and parse the text written at the maximum
+        //:   precision.  (C-1, 3..4)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid precisions.  (C-5)
+        //
+        // Testing:
+        //   int formatGeneral(char *buffer, float value, int precision);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'formatGeneral' FOR 'float'" << endl
+                          << "===========================" << endl;
+
+        static const struct {
+            int         d_line;
+            float       d_value;
+            int         d_precision;
+            const char *d_expected;
+        } DATA[] = {
+            //LINE  VALUE              PREC  EXPECTED
+            //----  -----------------  ----  ---------------
+            { L_,   0.0f,              9,    "0"             },
+            { L_,   -0.0f,             9,    "-0"            },
+            { L_,   1.0f,              1,    "1"             },
+            { L_,   0.1f,              6,    "0.1"           },
+            { L_,   0.1f,              9,    "0.1"           },
+            { L_,   1.0f / 3,          9,    "0.33333334"    },
+            { L_,   1.0f / 3,          7,    "0.3333333"     },
+            { L_,   16777216.0f,       9,    "16777216"      },
+            { L_,   16777216.0f,       6,    "1.67772e+07"   },
+            { L_,   3.4028235e38f,     9,    "3.4028235e+38" },
+            { L_,   1.17549435e-38f,   9,    "1.1754944e-38" },
+            { L_,   1.4e-45f,          9,    "1e-45"         },
+            { L_,   -101.25f,          9,    "-101.25"       },
+            { L_,   0.0001f,           9,    "0.0001"        },
+            { L_,   0.00001f,          9,    "1e-05"         },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE      = DATA[ti].d_line;
+            const float VALUE     = DATA[ti].d_value;
+            const int   PRECISION = DATA[ti].d_precision;
+            const char *EXPECTED  = DATA[ti].d_expected;
+
+            char buffer[Util::k_MAX_LENGTH + 1];
+            const int length = Util::formatGeneral(buffer, VALUE, PRECISION);
+
+            if (veryVerbose) { P_(LINE) P_(PRECISION) P(buffer) }
+
+            LOOP3_ASSERT(LINE, buffer, EXPECTED,
+                         0 == bsl::strcmp(EXPECTED, buffer));
+            LOOP2_ASSERT(LINE, length,
+                         static_cast<int>(bsl::strlen(EXPECTED)) == length);
+        }
+
+        if (verbose) cout << "\nComparing with 'sprintf'." << endl;
+
+        Uint64 state = 0x9E3779B97F4A7C15ULL;
+        for (int i = 0; i < 20000; ++i) {
+            const unsigned int bits = static_cast<unsigned int>(
+                                                        nextRandom(&state));
+            float value;
+            bsl::memcpy(&value, &bits, sizeof value);
+            if (bsl::numeric_limits<float>::max() >= value
+             && -bsl::numeric_limits<float>::max() <= value) {
+                checkFormatGeneral(value, L_);
+            }
+
+            const float price = static_cast<float>(
+                                     nextRandom(&state) % 10000000) / 100.0f;
+            checkFormatGeneral(price, L_);
+        }
+        for (int e = -149; e < 128; ++e) {
+            checkFormatGeneral(static_cast<float>(ldexp(1.0, e)), L_);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[Util::k_MAX_LENGTH + 1];
+
+            ASSERT_SAFE_FAIL(Util::formatGeneral(buffer, 1.0f,  0));
+            ASSERT_SAFE_PASS(Util::formatGeneral(buffer, 1.0f,  1));
+            ASSERT_SAFE_PASS(Util::formatGeneral(buffer, 1.0f,  9));
+            ASSERT_SAFE_FAIL(Util::formatGeneral(buffer, 1.0f, 10));
+            ASSERT_SAFE_FAIL(Util::formatGeneral(0,      1.0f,  9));
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'formatGeneral' FOR 'double'
+        //
+        // Concerns:
+        //: 1 For a normal value and a precision not exceeding 15, the text is
+        //:   the one written by 'sprintf' with the '%.*g' format, including
+        //:   when the value is rounded, and the notation (fixed or
+        //:   scientific) changes with the exponent and the precision.
+        //:
+        //: 2 The shortest representation is written if it has at most
+        //:   'precision' digits, in the notation of '%g'.
+        //:
+        //: 3 A value whose shortest representation ends with a 5 just beyond
+        //:   the precision is rounded according to its exact value.
+        //:
+        //: 4 The text written at the maximum precision round-trips.
+        //:
+        //: 5 The text is null-terminated, its length is returned, and it does
+        //:   not exceed 'k_MAX_LENGTH'.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the text written for a
+        //:   set of values and precisions, including the boundaries of the
+        //:   notations, the longest texts, and rounding ties.  (C-2..3, 5)
+        //:
+        //: 2 For random bit patterns, random prices, random decimal values,
+        //:   and every power of 2, compare the text with the one written by
+        //:   'sprintf' for each precision up to 15, and parse the text
+        //:   written at the maximum precision.  (C-1, 4..5)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid precisions.  (C-6)
+        //
+        // Testing:
+        //   int formatGeneral(char *buffer, double value, int precision);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'formatGeneral' FOR 'double'" << endl
+                          << "============================" << endl;
+
+        static const struct {
+            int         d_line;
+            double      d_value;
+            int         d_precision;
+            const char *d_expected;
+        } DATA[] = {
+   //LINE  VALUE                     PREC  EXPECTED
+   //----  ------------------------  ----  ---------------------------
+   { L_,   0.0,                      17,   "0"                         },
+   { L_,   -0.0,                     1,    "-0"                        },
+   { L_,   1.0,                      1,    "1"                         },
+   { L_,   10.0,                     1,    "1e+01"                     },
+   { L_,   10.0,                     2,    "10"                        },
+   { L_,   123456.0,                 6,    "123456"                    },
+   { L_,   1234567.0,                6,    "1.23457e+06"               },
+   { L_,   1234567.0,                17,   "1234567"                   },
+   { L_,   0.0001,                   17,   "0.0001"                    },
+   { L_,   0.00001,                  17,   "1e-05"                     },
+   { L_,   0.000123456,              17,   "0.000123456"               },
+   { L_,   0.1,                      17,   "0.1"                       },
+   { L_,   0.1 + 0.2,                17,   "0.30000000000000004"       },
+   { L_,   0.1 + 0.2,                16,   "0.3"                       },
+   { L_,   1.0 / 3,                  17,   "0.3333333333333333"        },
+   { L_,   2.0 / 3,                  17,   "0.6666666666666666"        },
+   { L_,   2.0 / 3,                  15,   "0.666666666666667"         },
+   { L_,   0.5,                      1,    "0.5"                       },
+   { L_,   9.5,                      1,    "1e+01"                     },
+   { L_,   0.95,                     1,    "0.9"                       },
+   { L_,   0.15,                     1,    "0.1"                       },
+   { L_,   0.25,                     1,    "0.2"                       },
+   { L_,   0.35,                     1,    "0.3"                       },
+   { L_,   99999.95,                 6,    "99999.9"                   },
+   { L_,   99999.96,                 6,    "100000"                    },
+   { L_,   999999.5,                 6,    "1e+06"                     },
+   { L_,   1e15,                     17,   "1000000000000000"          },
+   { L_,   1e17,                     17,   "1e+17"                     },
+   { L_,   123456789012345678.0,     17,   "1.2345678901234568e+17"    },
+   { L_,   -1.7976931348623157e308,  17,   "-1.7976931348623157e+308"  },
+   { L_,   2.2250738585072014e-308,  17,   "2.2250738585072014e-308"   },
+   { L_,   -2.2250738585072009e-308, 17,   "-2.225073858507201e-308"   },
+   { L_,   4.9406564584124654e-324,  17,   "5e-324"                    },
+   { L_,   4.9406564584124654e-324,  6,    "5e-324"                    },
+   { L_,   -0.00012345678901234567,  17,   "-0.00012345678901234567"   },
+   { L_,   1e23,                     17,   "1e+23"                     },
+   { L_,   9007199254740993.0,       17,   "9007199254740992"          },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE      = DATA[ti].d_line;
+            const double VALUE     = DATA[ti].d_value;
+            const int    PRECISION = DATA[ti].d_precision;
+            const char  *EXPECTED  = DATA[ti].d_expected;
+
+            char buffer[Util::k_MAX_LENGTH + 1];
+            const int length = Util::formatGeneral(buffer, VALUE, PRECISION);
+
+            if (veryVerbose) { P_(LINE) P_(PRECISION) P(buffer) }
+
+            LOOP3_ASSERT(LINE, buffer, EXPECTED,
+                         0 == bsl::strcmp(EXPECTED, buffer));
+            LOOP2_ASSERT(LINE, length,
+                         static_cast<int>(bsl::strlen(EXPECTED)) == length);
+        }
+
+        if (verbose) cout << "\nComparing with 'sprintf'." << endl;
+
+        Uint64 state = 0x2545F4914F6CDD1DULL;
+        for (int i = 0; i < 20000; ++i) {
+            const Uint64 bits = nextRandom(&state);
+            double       value;
+            bsl::memcpy(&value, &bits, sizeof value);
+            if (bsl::numeric_limits<double>::max() >= value
+             && -bsl::numeric_limits<double>::max() <= value) {
+                checkFormatGeneral(value, L_);
+            }
+
+            const double price =
+                     static_cast<double>(nextRandom(&state) % 100000000) / 100;
+            checkFormatGeneral(price, L_);
+
+            const double scaled =
+                  static_cast<double>(nextRandom(&state) % 1000000)
+                * pow(10.0, static_cast<int>(nextRandom(&state) % 41) - 20);
+            checkFormatGeneral(scaled, L_);
+        }
+        for (int e = -1074; e < 1024; ++e) {
+            checkFormatGeneral(ldexp(1.0, e), L_);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char buffer[Util::k_MAX_LENGTH + 1];
+
+            ASSERT_SAFE_FAIL(Util::formatGeneral(buffer, 1.0,  0));
+            ASSERT_SAFE_PASS(Util::formatGeneral(buffer, 1.0,  1));
+            ASSERT_SAFE_PASS(Util::formatGeneral(buffer, 1.0, 17));
+            ASSERT_SAFE_FAIL(Util::formatGeneral(buffer, 1.0, 18));
+            ASSERT_SAFE_FAIL(Util::formatGeneral(0,      1.0, 17));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'decompose' FOR 'float'
+        //
+        // Concerns:
+        //: 1 The digits loaded are the shortest that round-trip, the closest
+        //:   to the value among those, and have no leading or trailing zeros.
+        //:
+        //: 2 The exponent is the decimal exponent of the first digit.
+        //:
+        //: 3 Zero is loaded as "0" with an exponent of 0, and the sign of the
+        //:   value is ignored.
+        //:
+        //: 4 Subnormal values, and the largest values, are supported.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the digits and exponent
+        //:   loaded for a set of values, including zeros, subnormals, and the
+        //:   largest value.  (C-1..4)
+        //:
+        //: 2 For random bit patterns, random decimal values, and every power
+        //:   of 2, compare the result with the one found by searching, with
+        //:   'sprintf' and 'strtod', for the smallest precision at which the
+        //:   value round-trips.  (C-1..2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for non-finite values and null pointers.  (C-5)
+        //
+        // Testing:
+        //   int decompose(char *digits, int *exponent, float value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'decompose' FOR 'float'" << endl
+                          << "=======================" << endl;
+
+        static const struct {
+            int         d_line;
+            float       d_value;
+            const char *d_digits;
+            int         d_exponent;
+        } DATA[] = {
+            //LINE  VALUE              DIGITS       EXP
+            //----  -----------------  -----------  ---
+            { L_,   0.0f,              "0",          0  },
+            { L_,   -0.0f,             "0",          0  },
+            { L_,   1.0f,              "1",          0  },
+            { L_,   -2.5f,             "25",         0  },
+            { L_,   0.1f,              "1",         -1  },
+            { L_,   0.3f,              "3",         -1  },
+            { L_,   1.0f / 3,          "33333334",  -1  },
+            { L_,   100.0f,            "1",          2  },
+            { L_,   123456.7f,         "1234567",    5  },
+            { L_,   16777216.0f,       "16777216",   7  },
+            { L_,   3.4028235e38f,     "34028235",   38 },
+            { L_,   1.17549435e-38f,   "11754944",  -38 },
+            { L_,   1.4e-45f,          "1",         -45 },
+            { L_,   2.8e-45f,          "3",         -45 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE     = DATA[ti].d_line;
+            const float VALUE    = DATA[ti].d_value;
+            const char *DIGITS   = DATA[ti].d_digits;
+            const int   EXPONENT = DATA[ti].d_exponent;
+            const int   LENGTH   = static_cast<int>(bsl::strlen(DIGITS));
+
+            char digits[Util::k_MAX_FLOAT_DIGITS];
+            int  exponent;
+            const int numDigits = Util::decompose(digits, &exponent, VALUE);
+
+            if (veryVerbose) { P_(LINE) P_(numDigits) P(exponent) }
+
+            LOOP2_ASSERT(LINE, numDigits, LENGTH == numDigits);
+            LOOP_ASSERT(LINE, 0 == bsl::memcmp(DIGITS, digits, LENGTH));
+            LOOP2_ASSERT(LINE, exponent, EXPONENT == exponent);
+        }
+
+        if (verbose) cout << "\nComparing with the oracle." << endl;
+
+        Uint64 state = 0xD1B54A32D192ED03ULL;
+        for (int i = 0; i < 20000; ++i) {
+            const unsigned int bits = static_cast<unsigned int>(
+                                                        nextRandom(&state));
+            float value;
+            bsl::memcpy(&value, &bits, sizeof value);
+            if (bsl::numeric_limits<float>::max() >= value
+             && -bsl::numeric_limits<float>::max() <= value) {
+                checkDecompose(value, L_);
+            }
+
+            const float decimal = static_cast<float>(
+                                     nextRandom(&state) % 10000000) / 1000.0f;
+            checkDecompose(decimal, L_);
+        }
+        for (int e = -149; e < 128; ++e) {
+            checkDecompose(static_cast<float>(ldexp(1.0, e)), L_);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char  digits[Util::k_MAX_FLOAT_DIGITS];
+            int   exponent;
+            float infinity = bsl::numeric_limits<float>::infinity();
+
+            ASSERT_SAFE_PASS(Util::decompose(digits, &exponent, 1.0f));
+            ASSERT_SAFE_FAIL(Util::decompose(0,      &exponent, 1.0f));
+            ASSERT_SAFE_FAIL(Util::decompose(digits, 0,         1.0f));
+            ASSERT_SAFE_FAIL(Util::decompose(digits, &exponent, infinity));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'decompose' FOR 'double'
+        //
+        // Concerns:
+        //: 1 The digits loaded are the shortest that round-trip, the closest
+        //:   to the value among those, and have no leading or trailing zeros.
+        //:
+        //: 2 The exponent is the decimal exponent of the first digit.
+        //:
+        //: 3 Zero is loaded as "0" with an exponent of 0, and the sign of the
+        //:   value is ignored.
+        //:
+        //: 4 Subnormal values, and the largest values, are supported.
+        //:
+        //: 5 Integers, including those that have more digits than needed, are
+        //:   loaded without trailing zeros.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, verify the digits and exponent
+        //:   loaded for a set of values, including zeros, subnormals, the
+        //:   largest value, and integers.  (C-1..5)
+        //:
+        //: 2 For random bit patterns, random prices, random decimal values,
+        //:   and every power of 2, compare the result with the one found by
+        //:   searching, with 'sprintf' and 'strtod', for the smallest
+        //:   precision at which the value round-trips.  (C-1..2)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for non-finite values and null pointers.  (C-6)
+        //
+        // Testing:
+        //   int decompose(char *digits, int *exponent, double value);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'decompose' FOR 'double'" << endl
+                          << "========================" << endl;
+
+        static const struct {
+            int         d_line;
+            double      d_value;
+            const char *d_digits;
+            int         d_exponent;
+        } DATA[] = {
+  //LINE  VALUE                     DIGITS                  EXP
+  //----  ------------------------  ----------------------  ----
+  { L_,   0.0,                      "0",                       0 },
+  { L_,   -0.0,                     "0",                       0 },
+  { L_,   1.0,                      "1",                       0 },
+  { L_,   -1.0,                     "1",                       0 },
+  { L_,   0.1,                      "1",                      -1 },
+  { L_,   0.1 + 0.2,                "30000000000000004",      -1 },
+  { L_,   1.0 / 3,                  "3333333333333333",       -1 },
+  { L_,   101.15,                   "10115",                   2 },
+  { L_,   1e15,                     "1",                      15 },
+  { L_,   1e22,                     "1",                      22 },
+  { L_,   1e23,                     "1",                      23 },
+  { L_,   9007199254740992.0,       "9007199254740992",       15 },
+  { L_,   123456789012345678.0,     "12345678901234568",      17 },
+  { L_,   1.7976931348623157e308,   "17976931348623157",     308 },
+  { L_,   2.2250738585072014e-308,  "22250738585072014",    -308 },
+  { L_,   2.2250738585072009e-308,  "2225073858507201",     -308 },
+  { L_,   4.9406564584124654e-324,  "5",                    -324 },
+  { L_,   9.8813129168249309e-324,  "1",                    -323 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE     = DATA[ti].d_line;
+            const double VALUE    = DATA[ti].d_value;
+            const char  *DIGITS   = DATA[ti].d_digits;
+            const int    EXPONENT = DATA[ti].d_exponent;
+            const int    LENGTH   = static_cast<int>(bsl::strlen(DIGITS));
+
+            char digits[Util::k_MAX_DOUBLE_DIGITS];
+            int  exponent;
+            const int numDigits = Util::decompose(digits, &exponent, VALUE);
+
+            if (veryVerbose) { P_(LINE) P_(numDigits) P(exponent) }
+
+            LOOP2_ASSERT(LINE, numDigits, LENGTH == numDigits);
+            LOOP_ASSERT(LINE, 0 == bsl::memcmp(DIGITS, digits, LENGTH));
+            LOOP2_ASSERT(LINE, exponent, EXPONENT == exponent);
+        }
+
+        if (verbose) cout << "\nComparing with the oracle." << endl;
+
+        Uint64 state = 0x853C49E6748FEA9BULL;
+        for (int i = 0; i < 20000; ++i) {
+            const Uint64 bits = nextRandom(&state);
+            double       value;
+            bsl::memcpy(&value, &bits, sizeof value);
+            if (bsl::numeric_limits<double>::max() >= value
+             && -bsl::numeric_limits<double>::max() <= value) {
+                checkDecompose(value, L_);
+            }
+
+            const double price =
+                     static_cast<double>(nextRandom(&state) % 100000000) / 100;
+            checkDecompose(price, L_);
+
+            const double scaled =
+                  static_cast<double>(nextRandom(&state) % 1000000)
+                * pow(10.0, static_cast<int>(nextRandom(&state) % 41) - 20);
+            checkDecompose(scaled, L_);
+        }
+        for (int e = -1074; e < 1024; ++e) {
+            checkDecompose(ldexp(1.0, e), L_);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            char   digits[Util::k_MAX_DOUBLE_DIGITS];
+            int    exponent;
+            double infinity = bsl::numeric_limits<double>::infinity();
+
+            ASSERT_SAFE_PASS(Util::decompose(digits, &exponent, 1.0));
+            ASSERT_SAFE_FAIL(Util::decompose(0,      &exponent, 1.0));
+            ASSERT_SAFE_FAIL(Util::decompose(digits, 0,         1.0));
+            ASSERT_SAFE_FAIL(Util::decompose(digits, &exponent, infinity));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Decompose and format a few 'double' and 'float' values.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        char digits[Util::k_MAX_DOUBLE_DIGITS];
+        int  exponent;
+
+        ASSERT(3 == Util::decompose(digits, &exponent, 1.25));
+        ASSERT(0 == bsl::memcmp("125", digits, 3));
+        ASSERT(0 == exponent);
+
+        ASSERT(1 == Util::decompose(digits, &exponent, 0.001f));
+        ASSERT('1' == digits[0]);
+        ASSERT(-3  == exponent);
+
+        char buffer[Util::k_MAX_LENGTH + 1];
+
+        ASSERT(5 == Util::formatGeneral(buffer, -1.25, 17));
+        ASSERT(0 == bsl::strcmp("-1.25", buffer));
+
+        ASSERT(6 == Util::formatGeneral(buffer, 1e100, 17));
+        ASSERT(0 == bsl::strcmp("1e+100", buffer));
+
+        ASSERT(3 == Util::formatGeneral(buffer, 0.5f, 9));
+        ASSERT(0 == bsl::strcmp("0.5", buffer));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'formatGeneral' vs. 'sprintf'
+        //
+        // Concerns:
+        //: 1 'formatGeneral' is substantially faster than 'sprintf' for the
+        //:   values written by encoders: arbitrary values, and prices with a
+        //:   few decimal places.
+        //
+        // Plan:
+        //: 1 For sets of random bit patterns, random prices in cents, random
+        //:   prices in 1/256ths, and random values with 6 significant digits,
+        //:   measure the time taken to format each value with
+        //:   'formatGeneral' and with 'sprintf', at the default precision of
+        //:   the JSON encoder (15) and at the maximum precision (17), and
+        //:   report the times per value.  Optionally specify the number of
+        //:   values on the command line.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'formatGeneral' vs. 'sprintf'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: 'formatGeneral' vs. 'sprintf'"
+                          << endl
+                          << "==============================================="
+                          << endl;
+
+        const int NUM_VALUES = argc > 2 ? atoi(argv[2]) : 1000000;
+        ASSERT(0 < NUM_VALUES);
+
+        enum { k_NUM_SETS = 4 };
+        const char *SET_NAMES[k_NUM_SETS] = {
+            "random bits",
+            "prices (1/100)",
+            "prices (1/256)",
+            "6 digits, any exponent"
+        };
+
+        bsl::vector<double> values(NUM_VALUES);
+        Uint64              state = 0x5851F42D4C957F2DULL;
+
+        for (int set = 0; set < k_NUM_SETS; ++set) {
+            for (int i = 0; i < NUM_VALUES; ++i) {
+                double value = 0;
+                switch (set) {
+                  case 0: {
+                    do {
+                        const Uint64 bits = nextRandom(&state);
+                        bsl::memcpy(&value, &bits, sizeof value);
+                    } while (!(value <= bsl::numeric_limits<double>::max()
+                            && value >= -bsl::numeric_limits<double>::max()));
+                  } break;
+                  case 1: {
+                    value = static_cast<double>(
+                                        nextRandom(&state) % 10000000) / 100;
+                  } break;
+                  case 2: {
+                    value = static_cast<double>(
+                                        nextRandom(&state) % 10000000) / 256;
+                  } break;
+                  default: {
+                    value = static_cast<double>(
+                                 100000 + nextRandom(&state) % 900000)
+                          * pow(10.0,
+                                static_cast<int>(nextRandom(&state) % 61)
+                                                                        - 35);
+                  } break;
+                }
+                values[i] = value;
+            }
+
+            const int PRECISIONS[] = { 15, 17 };
+            for (int pi = 0; pi < 2; ++pi) {
+                const int PRECISION = PRECISIONS[pi];
+
+                char         buffer[64];
+                unsigned int checksum = 0;
+
+                bsls::Stopwatch timer;
+                timer.start(true);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    checksum += Util::formatGeneral(buffer,
+                                                    values[i],
+                                                    PRECISION);
+                }
+                timer.stop();
+                const double utilTime = timer.accumulatedWallTime();
+
+                timer.reset();
+                timer.start(true);
+                for (int i = 0; i < NUM_VALUES; ++i) {
+                    checksum += bsl::sprintf(buffer,
+                                             "%.*g",
+                                             PRECISION,
+                                             values[i]);
+                }
+                timer.stop();
+                const double printfTime = timer.accumulatedWallTime();
+
+                cout << SET_NAMES[set] << ", precision " << PRECISION
+                     << ": formatGeneral "
+                     << utilTime * 1e9 / NUM_VALUES << " ns, sprintf "
+                     << printfTime * 1e9 / NUM_VALUES << " ns, ratio "
+                     << printfTime / utilTime
+                     << " (checksum " << checksum << ")" << endl;
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
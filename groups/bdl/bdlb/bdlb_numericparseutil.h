@@ -0,0 +1,208 @@
+// bdlb_numericparseutil.h                                            -*-C++-*-
+#ifndef INCLUDED_BDLB_NUMERICPARSEUTIL
+#define INCLUDED_BDLB_NUMERICPARSEUTIL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide locale-independent parsing of decimal numbers.
+//
+//@CLASSES:
+//  bdlb::NumericParseUtil: namespace for parsing numbers from string refs
+//
+//@SEE_ALSO: bdlb_floatformatutil
+//
+//@DESCRIPTION: This component provides a utility 'struct',
+// 'bdlb::NumericParseUtil', that parses the decimal representation of a
+// number held in a 'bslstl::StringRef' into a 'double' or an integral value.
+// Unlike 'strtod' and 'strtol', the functions of this component do not need
+// the input to be null-terminated (so the input need not be copied), do not
+// skip leading whitespace, do not use 'errno', and are not affected by the
+// locale of the program: the decimal separator is always '.'.
+//
+// Each function comes in two forms.  The form taking a 'remainder' parses the
+// longest prefix of the input that is a number, and loads the rest of the
+// input into 'remainder'.  The form without 'remainder' succeeds only if the
+// whole input is a number.
+//
+///Grammar
+///-------
+// A 'double' is parsed from text matching '<REAL>', and an integer from text
+// matching '<INTEGER>' (only '+' is allowed as '<SIGN>' for unsigned types):
+//..
+//  <REAL>     ::= [<SIGN>] <MANTISSA> [<EXPONENT>]
+//  <INTEGER>  ::= [<SIGN>] <DIGITS>
+//  <MANTISSA> ::= <DIGITS> ['.' [<DIGITS>]] | '.' <DIGITS>
+//  <EXPONENT> ::= ('e' | 'E') [<SIGN>] <DIGITS>
+//  <SIGN>     ::= '+' | '-'
+//  <DIGITS>   ::= ('0' | '1' | ... | '9')+
+//..
+// Note that, as for 'strtod', an 'e' or 'E' that is not followed by a valid
+// exponent is not part of the number, and that there is no limit on the number
+// of digits.  Infinities, NaNs, and hexadecimal notation are not recognized.
+//
+// A 'double' is the value closest to the exact value of the text, with ties
+// rounded to even, as for a correct implementation of 'strtod'.  A value too
+// small to be represented is parsed as a (signed) zero; a value too large to
+// be represented is an error.  An integer whose value is outside the range of
+// its type is an error.
+//
+///Performance
+///-----------
+// Integers, and the digits of the mantissa of a 'double', are parsed eight
+// digits at a time using arithmetic on 64-bit words.  The conversion of the
+// first 19 significant digits and the decimal exponent of a 'double' uses the
+// Eisel-Lemire algorithm (see https://arxiv.org/abs/2101.11408): a single
+// 64x128-bit multiplication by a precomputed power of 10 yields the correctly
+// rounded value, and values that are exactly representable with a small
+// exponent (e.g., "1.25", or "101.15" as '10115 / 100') use a single
+// floating-point multiplication or division instead.  Only if the input has
+// more than 19 significant digits, and the digits beyond the 19th may change
+// the result, is the conversion performed by 'strtod', on a copy of the digits
+// held on the stack.  No memory is allocated.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parsing Numbers from a Record
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive records holding a quantity and a price separated by
+// a comma, and that we want to parse them without copying the text, which is
+// not null-terminated.
+//
+// First, we define the record, which is followed by unrelated text:
+//..
+//  const char              *buffer = "250,101.15;1000,99.53125";
+//  const bslstl::StringRef  input(buffer, 10);
+//..
+// Then, we parse the quantity, which must be followed by a comma:
+//..
+//  int               quantity;
+//  bslstl::StringRef remainder;
+//
+//  int rc = bdlb::NumericParseUtil::parseInt(&quantity, &remainder, input);
+//  assert(0   == rc);
+//  assert(250 == quantity);
+//  assert(',' == remainder[0]);
+//..
+// Next, we parse the price, which must take the rest of the record:
+//..
+//  double price;
+//
+//  rc = bdlb::NumericParseUtil::parseDouble(
+//                        &price,
+//                        bslstl::StringRef(remainder.begin() + 1,
+//                                          remainder.end()));
+//  assert(0      == rc);
+//  assert(101.15 == price);
+//..
+// Finally, we observe that a quantity that does not fit in an 'int', or a
+// price that is followed by other characters, is rejected:
+//..
+//  rc = bdlb::NumericParseUtil::parseInt(&quantity, "3000000000");
+//  assert(0 != rc);
+//
+//  rc = bdlb::NumericParseUtil::parseDouble(&price, "101.15;");
+//  assert(0 != rc);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STRINGREF
+#include <bslstl_stringref.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlb {
+
+                          // =======================
+                          // struct NumericParseUtil
+                          // =======================
+
+struct NumericParseUtil {
+    // This 'struct' provides a namespace for utility functions that parse
+    // decimal numbers without copying their text.  See {Grammar} for the
+    // syntax recognized.
+
+    // CLASS METHODS
+    static int parseDouble(double                   *result,
+                           bslstl::StringRef        *remainder,
+                           const bslstl::StringRef&  inputString);
+        // Parse the longest prefix of the specified 'inputString' that is a
+        // real number, load its value into the specified 'result', and load
+        // the rest of 'inputString' into the specified 'remainder'.  Return 0
+        // on success, and a non-zero value (with no effect on 'result' and
+        // 'remainder') if 'inputString' does not begin with a real number or
+        // if its magnitude is too large to be represented.
+
+    static int parseDouble(double                   *result,
+                           const bslstl::StringRef&  inputString);
+        // Parse the specified 'inputString' as a real number and load its
+        // value into the specified 'result'.  Return 0 on success, and a
+        // non-zero value (with no effect on 'result') if 'inputString' is not
+        // a real number or if its magnitude is too large to be represented.
+
+    static int parseInt(int                      *result,
+                        bslstl::StringRef        *remainder,
+                        const bslstl::StringRef&  inputString);
+    static int parseInt64(bsls::Types::Int64       *result,
+                          bslstl::StringRef        *remainder,
+                          const bslstl::StringRef&  inputString);
+    static int parseUint(unsigned int             *result,
+                         bslstl::StringRef        *remainder,
+                         const bslstl::StringRef&  inputString);
+    static int parseUint64(bsls::Types::Uint64      *result,
+                           bslstl::StringRef        *remainder,
+                           const bslstl::StringRef&  inputString);
+        // Parse the longest prefix of the specified 'inputString' that is a
+        // decimal integer, load its value into the specified 'result', and
+        // load the rest of 'inputString' into the specified 'remainder'.
+        // Return 0 on success, and a non-zero value (with no effect on
+        // 'result' and 'remainder') if 'inputString' does not begin with an
+        // integer or if its value is out of the range of the type of
+        // 'result'.
+
+    static int parseInt(int                      *result,
+                        const bslstl::StringRef&  inputString);
+    static int parseInt64(bsls::Types::Int64       *result,
+                          const bslstl::StringRef&  inputString);
+    static int parseUint(unsigned int             *result,
+                         const bslstl::StringRef&  inputString);
+    static int parseUint64(bsls::Types::Uint64      *result,
+                           const bslstl::StringRef&  inputString);
+        // Parse the specified 'inputString' as a decimal integer and load its
+        // value into the specified 'result'.  Return 0 on success, and a
+        // non-zero value (with no effect on 'result') if 'inputString' is not
+        // an integer or if its value is out of the range of the type of
+        // 'result'.
+};
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1108 @@
+// bdlb_numericparseutil.t.cpp                                        -*-C++-*-
+#include <bdlb_numericparseutil.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cmath.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_limits.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a utility parsing decimal numbers.  The
+// functions parsing integers are verified on tables of inputs covering the
+// grammar, the boundaries of each type, and the handling of the remainder.
+// 'parseDouble' is verified on a table of inputs covering the grammar, the
+// boundaries of 'double' (subnormal values, underflow, and overflow), values
+// exactly half-way between two 'double' values, and inputs having more than 19
+// significant digits, and then on random inputs against 'strtod' (in the "C"
+// locale).  The forms without a remainder are verified to reject inputs with
+// trailing characters, and all forms are verified not to modify their outputs
+// on failure.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] int parseDouble(double *, StringRef *, const StringRef&);
+// [ 4] int parseDouble(double *, const StringRef&);
+// [ 3] int parseInt(int *, StringRef *, const StringRef&);
+// [ 3] int parseInt(int *, const StringRef&);
+// [ 3] int parseInt64(Int64 *, StringRef *, const StringRef&);
+// [ 3] int parseInt64(Int64 *, const StringRef&);
+// [ 2] int parseUint(unsigned int *, StringRef *, const StringRef&);
+// [ 2] int parseUint(unsigned int *, const StringRef&);
+// [ 2] int parseUint64(Uint64 *, StringRef *, const StringRef&);
+// [ 2] int parseUint64(Uint64 *, const StringRef&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: 'parseDouble' vs. 'strtod'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBALS, TYPEDEFS, CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlb::NumericParseUtil Util;
+typedef bsls::Types::Int64     Int64;
+typedef bsls::Types::Uint64    Uint64;
+
+// ============================================================================
+//                            TEST APPARATUS
+// ----------------------------------------------------------------------------
+
+namespace {
+
+Uint64 nextRandom(Uint64 *state)
+    // Return the next value of the pseudo-random sequence having the
+    // specified 'state' ("xorshift64"), and update 'state'.
+{
+    Uint64 x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    *state = x;
+    return x;
+}
+
+bool isSameDouble(double lhs, double rhs)
+    // Return 'true' if the specified 'lhs' and 'rhs' have the same
+    // representation (distinguishing zeros of different signs), and 'false'
+    // otherwise.
+{
+    return 0 == bsl::memcmp(&lhs, &rhs, sizeof lhs);
+}
+
+void checkWithStrtod(const char *text, int line)
+    // Verify that 'Util::parseDouble' parses the specified null-terminated
+    // 'text' as 'strtod' does, and fails if 'strtod' overflows, and report
+    // errors using the specified 'line'.
+{
+    char         *end      = 0;
+    const double  expected = bsl::strtod(text, &end);
+
+    LOOP2_ASSERT(line, text, '\0' == *end);
+
+    double    result = 0;
+    const int rc     = Util::parseDouble(&result, text);
+
+    if (expected > bsl::numeric_limits<double>::max()
+     || expected < -bsl::numeric_limits<double>::max()) {
+        LOOP3_ASSERT(line, text, rc, 0 != rc);
+    }
+    else {
+        LOOP3_ASSERT(line, text, rc, 0 == rc);
+        LOOP4_ASSERT(line, text, result, expected,
+                     isSameDouble(expected, result));
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    (void)veryVeryVerbose;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parsing Numbers from a Record
+/// - - - - - - - - - - - - - - - - - - - -
+// Suppose that we receive records holding a quantity and a price separated by
+// a comma, and that we want to parse them without copying the text, which is
+// not null-terminated.
+//
+// First, we define the record, which is followed by unrelated text:
+//..
+    const char              *buffer = "250,101.15;1000,99.53125";
+    const bslstl::StringRef  input(buffer, 10);
+//..
+// Then, we parse the quantity, which must be followed by a comma:
+//..
+    int               quantity;
+    bslstl::StringRef remainder;
+
+    int rc = bdlb::NumericParseUtil::parseInt(&quantity, &remainder, input);
+    ASSERT(0   == rc);
+    ASSERT(250 == quantity);
+    ASSERT(',' == remainder[0]);
+//..
+// Next, we parse the price, which must take the rest of the record:
+//..
+    double price;
+
+    rc = bdlb::NumericParseUtil::parseDouble(
+                          &price,
+                          bslstl::StringRef(remainder.begin() + 1,
+                                            remainder.end()));
+    ASSERT(0      == rc);
+    ASSERT(101.15 == price);
+//..
+// Finally, we observe that a quantity that does not fit in an 'int', or a
+// price that is followed by other characters, is rejected:
+//..
+    rc = bdlb::NumericParseUtil::parseInt(&quantity, "3000000000");
+    ASSERT(0 != rc);
+
+    rc = bdlb::NumericParseUtil::parseDouble(&price, "101.15;");
+    ASSERT(0 != rc);
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'parseDouble'
+        //
+        // Concerns:
+        //: 1 Every form of the grammar is accepted, including a sign, a
+        //:   missing integral or fractional part, and an exponent with or
+        //:   without a sign.
+        //:
+        //: 2 An 'e' that is not followed by a valid exponent is not part of
+        //:   the number, and is left in the remainder.
+        //:
+        //: 3 Inputs that do not begin with a number (including "inf", "nan",
+        //:   and leading whitespace) are rejected, with no effect on the
+        //:   outputs.
+        //:
+        //: 4 The value is the 'double' closest to the input, with ties
+        //:   rounded to even, including for subnormal values, values that
+        //:   round to the largest 'double', and inputs having more than 19
+        //:   significant digits.
+        //:
+        //: 5 Values too small to be represented are parsed as zero (of the
+        //:   sign of the input), and values too large are rejected.
+        //:
+        //: 6 The form without a remainder rejects trailing characters.
+        //:
+        //: 7 The input need not be null-terminated.
+        //:
+        //: 8 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a set of inputs with
+        //:   both forms, and verify the status, the value, and the remainder.
+        //:   (C-1..3, 5..6)
+        //:
+        //: 2 For a set of inputs including values half-way between two
+        //:   'double' values (written with all their digits), long inputs,
+        //:   and boundaries, and for random inputs (random bit patterns
+        //:   written with 1 to 17 digits, random digit strings with random
+        //:   exponents), compare the value with the one returned by 'strtod'.
+        //:   (C-4..5)
+        //:
+        //: 3 Parse numbers followed by a digit that is not part of the
+        //:   'StringRef'.  (C-7)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointers.  (C-8)
+        //
+        // Testing:
+        //   int parseDouble(double *, StringRef *, const StringRef&);
+        //   int parseDouble(double *, const StringRef&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'parseDouble'" << endl
+                          << "=============" << endl;
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            int         d_isValid;    // parsed by the form with remainder
+            double      d_expected;
+            int         d_remainder;  // length of the remainder
+        } DATA[] = {
+            //LINE  INPUT                   VALID  EXPECTED        REMAINDER
+            //----  ----------------------  -----  --------------  ---------
+            { L_,   "0",                    1,      0.0,           0         },
+            { L_,   "-0",                   1,     -0.0,           0         },
+            { L_,   "+0.000",               1,      0.0,           0         },
+            { L_,   "1",                    1,      1.0,           0         },
+            { L_,   "+1",                   1,      1.0,           0         },
+            { L_,   "-1",                   1,     -1.0,           0         },
+            { L_,   "1.",                   1,      1.0,           0         },
+            { L_,   ".5",                   1,      0.5,           0         },
+            { L_,   "-.5",                  1,     -0.5,           0         },
+            { L_,   "101.15",               1,      101.15,        0         },
+            { L_,   "0.1",                  1,      0.1,           0         },
+            { L_,   "00000.1000000000",     1,      0.1,           0         },
+            { L_,   "1e2",                  1,      100.0,         0         },
+            { L_,   "1E2",                  1,      100.0,         0         },
+            { L_,   "1e+2",                 1,      100.0,         0         },
+            { L_,   "1e-2",                 1,      0.01,          0         },
+            { L_,   "1.5e0003",             1,      1500.0,        0         },
+            { L_,   "12345678901234567890", 1,      1.2345678901234567e19,
+                                                                   0         },
+            { L_,   "1e",                   1,      1.0,           1         },
+            { L_,   "1e+",                  1,      1.0,           2         },
+            { L_,   "1e-x",                 1,      1.0,           3         },
+            { L_,   "2.5,3",                1,      2.5,           2         },
+            { L_,   "3.25 ",                1,      3.25,          1         },
+            { L_,   "7..",                  1,      7.0,           1         },
+            { L_,   "1.5.5",                1,      1.5,           2         },
+            { L_,   "1e5e5",                1,      1e5,           2         },
+            { L_,   "1e400",                0,      0.0,           0         },
+            { L_,   "-1e400",               0,      0.0,           0         },
+            { L_,   "1e99999999999999",     0,      0.0,           0         },
+            { L_,   "1e-400",               1,      0.0,           0         },
+            { L_,   "-1e-400",              1,     -0.0,           0         },
+            { L_,   "0e99999999999999",     1,      0.0,           0         },
+            { L_,   "1e-99999999999999",    1,      0.0,           0         },
+            { L_,   "",                     0,      0.0,           0         },
+            { L_,   "+",                    0,      0.0,           0         },
+            { L_,   "-",                    0,      0.0,           0         },
+            { L_,   ".",                    0,      0.0,           0         },
+            { L_,   "-.",                   0,      0.0,           0         },
+            { L_,   ".e1",                  0,      0.0,           0         },
+            { L_,   "e1",                   0,      0.0,           0         },
+            { L_,   "+-1",                  0,      0.0,           0         },
+            { L_,   " 1",                   0,      0.0,           0         },
+            { L_,   "inf",                  0,      0.0,           0         },
+            { L_,   "nan",                  0,      0.0,           0         },
+            { L_,   "0x10",                 1,      0.0,           3         },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int     LINE      = DATA[ti].d_line;
+            const char   *INPUT     = DATA[ti].d_input;
+            const bool    IS_VALID  = DATA[ti].d_isValid;
+            const double  EXPECTED  = DATA[ti].d_expected;
+            const int     REMAINDER = DATA[ti].d_remainder;
+            const int     LENGTH    = static_cast<int>(bsl::strlen(INPUT));
+
+            if (veryVerbose) { P_(LINE) P(INPUT) }
+
+            double            result = 42.0;
+            bslstl::StringRef remainder("unchanged");
+
+            int rc = Util::parseDouble(&result, &remainder, INPUT);
+            if (IS_VALID) {
+                LOOP2_ASSERT(LINE, rc, 0 == rc);
+                LOOP2_ASSERT(LINE, result, isSameDouble(EXPECTED, result));
+                LOOP2_ASSERT(LINE, remainder,
+                             static_cast<int>(remainder.length())
+                                                               == REMAINDER);
+                LOOP_ASSERT(LINE,
+                            INPUT + LENGTH - REMAINDER == remainder.begin());
+            }
+            else {
+                LOOP2_ASSERT(LINE, rc, 0 != rc);
+                LOOP2_ASSERT(LINE, result, 42.0 == result);
+                LOOP2_ASSERT(LINE, remainder, "unchanged" == remainder);
+            }
+
+            result = 42.0;
+            rc     = Util::parseDouble(&result, INPUT);
+            if (IS_VALID && 0 == REMAINDER) {
+                LOOP2_ASSERT(LINE, rc, 0 == rc);
+                LOOP2_ASSERT(LINE, result, isSameDouble(EXPECTED, result));
+            }
+            else {
+                LOOP2_ASSERT(LINE, rc, 0 != rc);
+                LOOP2_ASSERT(LINE, result, 42.0 == result);
+            }
+        }
+
+        if (verbose) cout << "\nComparing with 'strtod'." << endl;
+        {
+            static const char *INPUTS[] = {
+                // boundaries
+
+                "2.2250738585072014e-308",    // smallest normal
+                "2.2250738585072011e-308",
+                "2.2250738585072012e-308",
+                "4.9406564584124654e-324",    // smallest subnormal
+                "2.4703282292062327e-324",    // rounds to 0
+                "2.4703282292062328e-324",    // rounds to smallest subnormal
+                "1.7976931348623157e308",     // largest
+                "1.7976931348623158e308",     // rounds to largest
+                "1.7976931348623159e308",     // overflows
+                "7.2057594037927933e16",      // rounds up to a power of 2
+
+                // exactly half-way between two values
+
+                "9007199254740993",           // 2^53 + 1: rounds to even
+                "9007199254740995",           // 2^53 + 3: rounds to even
+                "9007199254740993.0000000000000000000000000001",
+                "1.00000000000000011102230246251565404236316680908203125",
+                "1.00000000000000033306690738754696212708950042724609375",
+
+                // more than 19 digits
+
+                "123456789012345678901234567890",
+                "0.1000000000000000055511151231257827021181583404541015625",
+                "0.1000000000000000055511151231257827021181583404541015624",
+                "3.141592653589793238462643383279502884197169399375105820974",
+                "0.00000000000000000000000000000000000000000000000000000001",
+            };
+            const int NUM_INPUTS = static_cast<int>(sizeof INPUTS
+                                                    / sizeof *INPUTS);
+
+            for (int i = 0; i < NUM_INPUTS; ++i) {
+                checkWithStrtod(INPUTS[i], L_);
+            }
+
+            // A half-way value between 1 and the next 'double' written with
+            // more than 768 significant digits.
+
+            bsl::string text("1.00000000000000011102230246251565404236316680"
+                             "908203125");
+            text.append(800, '0');
+            checkWithStrtod(text.c_str(), L_);
+            text.append("1");
+            checkWithStrtod(text.c_str(), L_);
+
+            Uint64 state = 0x9E3779B97F4A7C15ULL;
+            for (int i = 0; i < 20000; ++i) {
+                char buffer[128];
+
+                const Uint64 bits = nextRandom(&state);
+                double       value;
+                bsl::memcpy(&value, &bits, sizeof value);
+                if (value <= bsl::numeric_limits<double>::max()
+                 && value >= -bsl::numeric_limits<double>::max()) {
+                    for (int p = 1; p <= 17; p += 4) {
+                        bsl::sprintf(buffer, "%.*g", p, value);
+                        checkWithStrtod(buffer, L_);
+                    }
+                }
+
+                const int numDigits =
+                               1 + static_cast<int>(nextRandom(&state) % 40);
+                const int dot = static_cast<int>(nextRandom(&state)
+                                                 % (numDigits + 1));
+                int length = 0;
+                for (int j = 0; j < numDigits; ++j) {
+                    if (j == dot) {
+                        buffer[length++] = '.';
+                    }
+                    buffer[length++] =
+                         static_cast<char>('0' + nextRandom(&state) % 10);
+                }
+                bsl::sprintf(buffer + length,
+                             "e%d",
+                             static_cast<int>(nextRandom(&state) % 700) - 350);
+                checkWithStrtod(buffer, L_);
+            }
+        }
+
+        if (verbose) cout << "\nTesting non-terminated input." << endl;
+        {
+            double result;
+
+            ASSERT(0 == Util::parseDouble(&result,
+                                          bslstl::StringRef("1.2345", 4)));
+            ASSERT(1.23 == result);
+
+            ASSERT(0 == Util::parseDouble(&result,
+                                          bslstl::StringRef("123456789", 8)));
+            ASSERT(12345678.0 == result);
+
+            ASSERT(0 == Util::parseDouble(&result,
+                                          bslstl::StringRef("1e123", 4)));
+            ASSERT(1e12 == result);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            double            result;
+            bslstl::StringRef remainder;
+
+            ASSERT_SAFE_PASS(Util::parseDouble(&result, &remainder, "1"));
+            ASSERT_SAFE_FAIL(Util::parseDouble(0,       &remainder, "1"));
+            ASSERT_SAFE_FAIL(Util::parseDouble(&result, 0,          "1"));
+            ASSERT_SAFE_PASS(Util::parseDouble(&result, "1"));
+            ASSERT_SAFE_FAIL(Util::parseDouble(0,       "1"));
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'parseInt' AND 'parseInt64'
+        //
+        // Concerns:
+        //: 1 Integers with an optional sign are accepted, including the
+        //:   smallest and largest values of each type, and leading zeros.
+        //:
+        //: 2 Integers out of range, and inputs that do not begin with an
+        //:   integer, are rejected with no effect on the outputs.
+        //:
+        //: 3 The form with a remainder loads the characters after the
+        //:   integer, and the form without a remainder rejects them.
+        //:
+        //: 4 The input need not be null-terminated.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a set of inputs with
+        //:   both forms for both types, and verify the status, the value, and
+        //:   the remainder.  (C-1..3)
+        //:
+        //: 2 Parse random values written with 'sprintf'.  (C-1)
+        //:
+        //: 3 Parse a number followed by a digit that is not part of the
+        //:   'StringRef'.  (C-4)
+        //:
+        //: 4 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointers.  (C-5)
+        //
+        // Testing:
+        //   int parseInt(int *, StringRef *, const StringRef&);
+        //   int parseInt(int *, const StringRef&);
+        //   int parseInt64(Int64 *, StringRef *, const StringRef&);
+        //   int parseInt64(Int64 *, const StringRef&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'parseInt' AND 'parseInt64'" << endl
+                          << "===========================" << endl;
+
+        const Int64 MAX_INT   = bsl::numeric_limits<int>::max();
+        const Int64 MIN_INT   = bsl::numeric_limits<int>::min();
+        const Int64 MAX_INT64 = bsl::numeric_limits<Int64>::max();
+        const Int64 MIN_INT64 = bsl::numeric_limits<Int64>::min();
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            int         d_isValidInt;    // valid for 'parseInt'
+            int         d_isValidInt64;  // valid for 'parseInt64'
+            Int64       d_expected;
+            int         d_remainder;     // length of the remainder
+        } DATA[] = {
+  //LINE  INPUT                             INT  INT64  EXPECTED   REMAINDER
+  //----  --------------------------------  ---  -----  ---------  ---------
+  { L_,   "0",                              1,   1,     0,         0       },
+  { L_,   "-0",                             1,   1,     0,         0       },
+  { L_,   "+0",                             1,   1,     0,         0       },
+  { L_,   "7",                              1,   1,     7,         0       },
+  { L_,   "-7",                             1,   1,     -7,        0       },
+  { L_,   "+7",                             1,   1,     7,         0       },
+  { L_,   "000000000000000000000000012",    1,   1,     12,        0       },
+  { L_,   "12345678",                       1,   1,     12345678,  0       },
+  { L_,   "123456789",                      1,   1,     123456789, 0       },
+  { L_,   "2147483647",                     1,   1,     MAX_INT,   0       },
+  { L_,   "-2147483648",                    1,   1,     MIN_INT,   0       },
+  { L_,   "2147483648",                     0,   1,     MAX_INT + 1,
+                                                                   0       },
+  { L_,   "-2147483649",                    0,   1,     MIN_INT - 1,
+                                                                   0       },
+  { L_,   "9223372036854775807",            0,   1,     MAX_INT64, 0       },
+  { L_,   "-9223372036854775808",           0,   1,     MIN_INT64, 0       },
+  { L_,   "9223372036854775808",            0,   0,     0,         0       },
+  { L_,   "-9223372036854775809",           0,   0,     0,         0       },
+  { L_,   "99999999999999999999999",        0,   0,     0,         0       },
+  { L_,   "12,",                            1,   1,     12,        1       },
+  { L_,   "12.5",                           1,   1,     12,        2       },
+  { L_,   "1e3",                            1,   1,     1,         2       },
+  { L_,   "12345678x",                      1,   1,     12345678,  1       },
+  { L_,   "1234567890123456x",              0,   1,     1234567890123456LL,
+                                                                   1       },
+  { L_,   "",                               0,   0,     0,         0       },
+  { L_,   "-",                              0,   0,     0,         0       },
+  { L_,   "+-1",                            0,   0,     0,         0       },
+  { L_,   " 1",                             0,   0,     0,         0       },
+  { L_,   "x1",                             0,   0,     0,         0       },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int   LINE         = DATA[ti].d_line;
+            const char *INPUT        = DATA[ti].d_input;
+            const bool  IS_VALID_INT = DATA[ti].d_isValidInt;
+            const bool  IS_VALID_I64 = DATA[ti].d_isValidInt64;
+            const Int64 EXPECTED     = DATA[ti].d_expected;
+            const int   REMAINDER    = DATA[ti].d_remainder;
+            const int   LENGTH       = static_cast<int>(bsl::strlen(INPUT));
+
+            if (veryVerbose) { P_(LINE) P(INPUT) }
+
+            {
+                int               result = 42;
+                bslstl::StringRef remainder("unchanged");
+
+                int rc = Util::parseInt(&result, &remainder, INPUT);
+                if (IS_VALID_INT) {
+                    LOOP2_ASSERT(LINE, rc, 0 == rc);
+                    LOOP2_ASSERT(LINE, result, EXPECTED == result);
+                    LOOP_ASSERT(LINE, INPUT + LENGTH - REMAINDER
+                                                        == remainder.begin());
+                    LOOP_ASSERT(LINE, INPUT + LENGTH == remainder.end());
+                }
+                else {
+                    LOOP2_ASSERT(LINE, rc, 0 != rc);
+                    LOOP2_ASSERT(LINE, result, 42 == result);
+                    LOOP2_ASSERT(LINE, remainder, "unchanged" == remainder);
+                }
+
+                result = 42;
+                rc     = Util::parseInt(&result, INPUT);
+                if (IS_VALID_INT && 0 == REMAINDER) {
+                    LOOP2_ASSERT(LINE, rc, 0 == rc);
+                    LOOP2_ASSERT(LINE, result, EXPECTED == result);
+                }
+                else {
+                    LOOP2_ASSERT(LINE, rc, 0 != rc);
+                    LOOP2_ASSERT(LINE, result, 42 == result);
+                }
+            }
+            {
+                Int64             result = 42;
+                bslstl::StringRef remainder("unchanged");
+
+                int rc = Util::parseInt64(&result, &remainder, INPUT);
+                if (IS_VALID_I64) {
+                    LOOP2_ASSERT(LINE, rc, 0 == rc);
+                    LOOP2_ASSERT(LINE, result, EXPECTED == result);
+                    LOOP_ASSERT(LINE, INPUT + LENGTH - REMAINDER
+                                                        == remainder.begin());
+                }
+                else {
+                    LOOP2_ASSERT(LINE, rc, 0 != rc);
+                    LOOP2_ASSERT(LINE, result, 42 == result);
+                    LOOP2_ASSERT(LINE, remainder, "unchanged" == remainder);
+                }
+
+                result = 42;
+                rc     = Util::parseInt64(&result, INPUT);
+                if (IS_VALID_I64 && 0 == REMAINDER) {
+                    LOOP2_ASSERT(LINE, rc, 0 == rc);
+                    LOOP2_ASSERT(LINE, result, EXPECTED == result);
+                }
+                else {
+                    LOOP2_ASSERT(LINE, rc, 0 != rc);
+                    LOOP2_ASSERT(LINE, result, 42 == result);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting random values." << endl;
+        {
+            Uint64 state = 0x2545F4914F6CDD1DULL;
+            for (int i = 0; i < 100000; ++i) {
+                const Uint64 bits  = nextRandom(&state);
+                const int    shift = static_cast<int>(nextRandom(&state) % 64);
+                const Int64  VALUE = static_cast<Int64>(bits) >> shift;
+
+                char buffer[32];
+                bsl::sprintf(buffer, "%lld", VALUE);
+
+                Int64 result;
+                LOOP_ASSERT(buffer, 0 == Util::parseInt64(&result, buffer));
+                LOOP_ASSERT(buffer, VALUE == result);
+
+                int       intResult;
+                const int rc = Util::parseInt(&intResult, buffer);
+                if (MIN_INT <= VALUE && VALUE <= MAX_INT) {
+                    LOOP_ASSERT(buffer, 0 == rc);
+                    LOOP_ASSERT(buffer, VALUE == intResult);
+                }
+                else {
+                    LOOP_ASSERT(buffer, 0 != rc);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting non-terminated input." << endl;
+        {
+            int   result;
+            Int64 result64;
+
+            ASSERT(0 == Util::parseInt(&result,
+                                       bslstl::StringRef("-123456789", 9)));
+            ASSERT(-12345678 == result);
+
+            ASSERT(0 == Util::parseInt64(&result64,
+                                         bslstl::StringRef("1234567890123",
+                                                           12)));
+            ASSERT(123456789012LL == result64);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            int               result;
+            Int64             result64;
+            bslstl::StringRef remainder;
+
+            ASSERT_SAFE_PASS(Util::parseInt(&result, &remainder, "1"));
+            ASSERT_SAFE_FAIL(Util::parseInt(0,       &remainder, "1"));
+            ASSERT_SAFE_FAIL(Util::parseInt(&result, 0,          "1"));
+            ASSERT_SAFE_PASS(Util::parseInt(&result, "1"));
+            ASSERT_SAFE_FAIL(Util::parseInt(0,       "1"));
+
+            ASSERT_SAFE_PASS(Util::parseInt64(&result64, &remainder, "1"));
+            ASSERT_SAFE_FAIL(Util::parseInt64(0,         &remainder, "1"));
+            ASSERT_SAFE_FAIL(Util::parseInt64(&result64, 0,          "1"));
+            ASSERT_SAFE_PASS(Util::parseInt64(&result64, "1"));
+            ASSERT_SAFE_FAIL(Util::parseInt64(0,         "1"));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // 'parseUint' AND 'parseUint64'
+        //
+        // Concerns:
+        //: 1 Integers with an optional '+' sign are accepted, including the
+        //:   largest values of each type, and leading zeros.
+        //:
+        //: 2 Integers out of range, negative integers, and inputs that do not
+        //:   begin with an integer are rejected with no effect on the
+        //:   outputs.
+        //:
+        //: 3 The form with a remainder loads the characters after the
+        //:   integer, and the form without a remainder rejects them.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, parse a set of inputs with
+        //:   both forms for both types, and verify the status, the value, and
+        //:   the remainder.  (C-1..3)
+        //:
+        //: 2 Parse random values written with 'sprintf'.  (C-1)
+        //:
+        //: 3 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for null pointers.  (C-4)
+        //
+        // Testing:
+        //   int parseUint(unsigned int *, StringRef *, const StringRef&);
+        //   int parseUint(unsigned int *, const StringRef&);
+        //   int parseUint64(Uint64 *, StringRef *, const StringRef&);
+        //   int parseUint64(Uint64 *, const StringRef&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'parseUint' AND 'parseUint64'" << endl
+                          << "=============================" << endl;
+
+        const Uint64 MAX_UINT   = bsl::numeric_limits<unsigned int>::max();
+        const Uint64 MAX_UINT64 = bsl::numeric_limits<Uint64>::max();
+
+        static const struct {
+            int         d_line;
+            const char *d_input;
+            int         d_isValidUint;    // valid for 'parseUint'
+            int         d_isValidUint64;  // valid for 'parseUint64'
+            Uint64      d_expected;
+            int         d_remainder;      // length of the remainder
+        } DATA[] = {
+  //LINE  INPUT                             UINT  UINT64  EXPECTED  REMAINDER
+  //----  --------------------------------  ----  ------  --------  ---------
+  { L_,   "0",                              1,    1,      0,        0       },
+  { L_,   "+0",                             1,    1,      0,        0       },
+  { L_,   "7",                              1,    1,      7,        0       },
+  { L_,   "+7",                             1,    1,      7,        0       },
+  { L_,   "0000000000000000000000000001",   1,    1,      1,        0       },
+  { L_,   "4294967295",                     1,    1,      MAX_UINT, 0       },
+  { L_,   "4294967296",                     0,    1,      MAX_UINT + 1,
+                                                                    0       },
+  { L_,   "18446744073709551615",           0,    1,      MAX_UINT64,
+                                                                    0       },
+  { L_,   "18446744073709551616",           0,    0,      0,        0       },
+  { L_,   "99999999999999999999",           0,    0,      0,        0       },
+  { L_,   "1234567812345678;",              0,    1,      1234567812345678ULL,
+                                                                    1       },
+  { L_,   "42 ",                            1,    1,      42,       1       },
+  { L_,   "",                               0,    0,      0,        0       },
+  { L_,   "-0",                             0,    0,      0,        0       },
+  { L_,   "-1",                             0,    0,      0,        0       },
+  { L_,   "+",                              0,    0,      0,        0       },
+  { L_,   "a",                              0,    0,      0,        0       },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int    LINE          = DATA[ti].d_line;
+            const char  *INPUT         = DATA[ti].d_input;
+            const bool   IS_VALID_UINT = DATA[ti].d_isValidUint;
+            const bool   IS_VALID_U64  = DATA[ti].d_isValidUint64;
+            const Uint64 EXPECTED      = DATA[ti].d_expected;
+            const int    REMAINDER     = DATA[ti].d_remainder;
+            const int    LENGTH        = static_cast<int>(bsl::strlen(INPUT));
+
+            if (veryVerbose) { P_(LINE) P(INPUT) }
+
+            {
+                unsigned int      result = 42;
+                bslstl::StringRef remainder("unchanged");
+
+                int rc = Util::parseUint(&result, &remainder, INPUT);
+                if (IS_VALID_UINT) {
+                    LOOP2_ASSERT(LINE, rc, 0 == rc);
+                    LOOP2_ASSERT(LINE, result, EXPECTED == result);
+                    LOOP_ASSERT(LINE, INPUT + LENGTH - REMAINDER
+                                                        == remainder.begin());
+                }
+                else {
+                    LOOP2_ASSERT(LINE, rc, 0 != rc);
+                    LOOP2_ASSERT(LINE, result, 42 == result);
+                    LOOP2_ASSERT(LINE, remainder, "unchanged" == remainder);
+                }
+
+                result = 42;
+                rc     = Util::parseUint(&result, INPUT);
+                if (IS_VALID_UINT && 0 == REMAINDER) {
+                    LOOP2_ASSERT(LINE, rc, 0 == rc);
+                    LOOP2_ASSERT(LINE, result, EXPECTED == result);
+                }
+                else {
+                    LOOP2_ASSERT(LINE, rc, 0 != rc);
+                    LOOP2_ASSERT(LINE, result, 42 == result);
+                }
+            }
+            {
+                Uint64            result = 42;
+                bslstl::StringRef remainder("unchanged");
+
+                int rc = Util::parseUint64(&result, &remainder, INPUT);
+                if (IS_VALID_U64) {
+                    LOOP2_ASSERT(LINE, rc, 0 == rc);
+                    LOOP2_ASSERT(LINE, result, EXPECTED == result);
+                    LOOP_ASSERT(LINE, INPUT + LENGTH - REMAINDER
+                                                        == remainder.begin());
+                }
+                else {
+                    LOOP2_ASSERT(LINE, rc, 0 != rc);
+                    LOOP2_ASSERT(LINE, result, 42 == result);
+                    LOOP2_ASSERT(LINE, remainder, "unchanged" == remainder);
+                }
+
+                result = 42;
+                rc     = Util::parseUint64(&result, INPUT);
+                if (IS_VALID_U64 && 0 == REMAINDER) {
+                    LOOP2_ASSERT(LINE, rc, 0 == rc);
+                    LOOP2_ASSERT(LINE, result, EXPECTED == result);
+                }
+                else {
+                    LOOP2_ASSERT(LINE, rc, 0 != rc);
+                    LOOP2_ASSERT(LINE, result, 42 == result);
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting random values." << endl;
+        {
+            Uint64 state = 0xD1B54A32D192ED03ULL;
+            for (int i = 0; i < 100000; ++i) {
+                const Uint64 VALUE = nextRandom(&state)
+                                  >> (nextRandom(&state) % 64);
+
+                char buffer[32];
+                bsl::sprintf(buffer, "%llu", VALUE);
+
+                Uint64 result;
+                LOOP_ASSERT(buffer, 0 == Util::parseUint64(&result, buffer));
+                LOOP_ASSERT(buffer, VALUE == result);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            unsigned int      result;
+            Uint64            result64;
+            bslstl::StringRef remainder;
+
+            ASSERT_SAFE_PASS(Util::parseUint(&result, &remainder, "1"));
+            ASSERT_SAFE_FAIL(Util::parseUint(0,       &remainder, "1"));
+            ASSERT_SAFE_FAIL(Util::parseUint(&result, 0,          "1"));
+            ASSERT_SAFE_PASS(Util::parseUint(&result, "1"));
+            ASSERT_SAFE_FAIL(Util::parseUint(0,       "1"));
+
+            ASSERT_SAFE_PASS(Util::parseUint64(&result64, &remainder, "1"));
+            ASSERT_SAFE_FAIL(Util::parseUint64(0,         &remainder, "1"));
+            ASSERT_SAFE_FAIL(Util::parseUint64(&result64, 0,          "1"));
+            ASSERT_SAFE_PASS(Util::parseUint64(&result64, "1"));
+            ASSERT_SAFE_FAIL(Util::parseUint64(0,         "1"));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Parse a few integers and real numbers.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        int               i;
+        Uint64            u;
+        double            d;
+        bslstl::StringRef remainder;
+
+        ASSERT(0 == Util::parseInt(&i, "-42"));
+        ASSERT(-42 == i);
+
+        ASSERT(0 == Util::parseUint64(&u, &remainder, "123456789012,x"));
+        ASSERT(123456789012ULL == u);
+        ASSERT(",x" == remainder);
+
+        ASSERT(0 == Util::parseDouble(&d, "-1.25e2"));
+        ASSERT(-125.0 == d);
+
+        ASSERT(0 != Util::parseDouble(&d, "1.25e2x"));
+        ASSERT(-125.0 == d);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'parseDouble' vs. 'strtod'
+        //
+        // Concerns:
+        //: 1 'parseDouble' and 'parseInt' are substantially faster than
+        //:   copying the input to a null-terminated buffer and calling
+        //:   'strtod' and 'strtol', as the decoders of 'baljsn' and 'balxml'
+        //:   did.
+        //
+        // Plan:
+        //: 1 For sets of random 'double' values written with 17 digits, random
+        //:   prices written with 2 decimal places, and random integers,
+        //:   measure the time taken to parse each input with this component
+        //:   and with the C library, and report the times per input.
+        //:   Optionally specify the number of inputs on the command line.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'parseDouble' vs. 'strtod'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST: 'parseDouble' vs. 'strtod'"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        const int NUM_INPUTS = argc > 2 ? atoi(argv[2]) : 1000000;
+        ASSERT(0 < NUM_INPUTS);
+
+        enum { k_NUM_SETS = 3 };
+        const char *SET_NAMES[k_NUM_SETS] = {
+            "random doubles (%.17g)",
+            "prices (%.2f)",
+            "integers"
+        };
+
+        Uint64 state = 0x5851F42D4C957F2DULL;
+
+        for (int set = 0; set < k_NUM_SETS; ++set) {
+            bsl::vector<bsl::string> inputs(NUM_INPUTS);
+
+            for (int i = 0; i < NUM_INPUTS; ++i) {
+                char buffer[64];
+                switch (set) {
+                  case 0: {
+                    double value;
+                    do {
+                        const Uint64 bits = nextRandom(&state);
+                        bsl::memcpy(&value, &bits, sizeof value);
+                    } while (!(value <= bsl::numeric_limits<double>::max()
+                            && value >= -bsl::numeric_limits<double>::max()));
+                    bsl::sprintf(buffer, "%.17g", value);
+                  } break;
+                  case 1: {
+                    bsl::sprintf(buffer,
+                                 "%.2f",
+                                 static_cast<double>(
+                                        nextRandom(&state) % 10000000) / 100);
+                  } break;
+                  default: {
+                    bsl::sprintf(buffer,
+                                 "%d",
+                                 static_cast<int>(
+                                       static_cast<Int64>(nextRandom(&state))
+                                          >> (32 + nextRandom(&state) % 32)));
+                  } break;
+                }
+                inputs[i] = buffer;
+            }
+
+            double checksum = 0;
+
+            bsls::Stopwatch timer;
+            timer.start(true);
+            for (int i = 0; i < NUM_INPUTS; ++i) {
+                const bslstl::StringRef input(inputs[i]);
+                if (2 == set) {
+                    int value = 0;
+                    Util::parseInt(&value, input);
+                    checksum += static_cast<double>(value);
+                }
+                else {
+                    double value = 0;
+                    Util::parseDouble(&value, input);
+                    checksum += value;
+                }
+            }
+            timer.stop();
+            const double utilTime = timer.accumulatedWallTime();
+
+            timer.reset();
+            timer.start(true);
+            for (int i = 0; i < NUM_INPUTS; ++i) {
+                const bslstl::StringRef input(inputs[i]);
+
+                char buffer[80];
+                bsl::memcpy(buffer, input.data(), input.length());
+                buffer[input.length()] = '\0';
+
+                char *end = 0;
+                if (2 == set) {
+                    checksum += static_cast<double>(
+                                              bsl::strtol(buffer, &end, 10));
+                }
+                else {
+                    checksum += bsl::strtod(buffer, &end);
+                }
+            }
+            timer.stop();
+            const double libcTime = timer.accumulatedWallTime();
+
+            cout << SET_NAMES[set]
+                 << ": NumericParseUtil "
+                 << utilTime * 1e9 / NUM_INPUTS << " ns, C library "
+                 << libcTime * 1e9 / NUM_INPUTS << " ns, ratio "
+                 << libcTime / utilTime
+                 << " (checksum " << checksum << ")" << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
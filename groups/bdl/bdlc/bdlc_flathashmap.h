@@ -0,0 +1,886 @@
+// bdlc_flathashmap.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHMAP
+#define INCLUDED_BDLC_FLATHASHMAP
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered map container.
+//
+//@CLASSES:
+//  bdlc::FlatHashMap: open-addressed unordered map container
+//
+//@SEE_ALSO: bdlc_flathashset, bdlc_flathashtable, bslstl_unorderedmap
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashMap', implementing an unordered associative container of
+// unique keys and their mapped values, with an interface modeled on (a subset
+// of) that of 'bsl::unordered_map'.
+//
+// Unlike 'bsl::unordered_map', which allocates a node for each element and
+// links the nodes into buckets, 'bdlc::FlatHashMap' stores its elements
+// directly in a single array of slots (see 'bdlc_flathashtable'), probing
+// groups of slots with SIMD instructions where available.  Inserting an
+// element therefore does not (except when the map grows) allocate memory,
+// and a lookup typically touches a single cache line of control values and a
+// single element.  The trade-offs are:
+//
+//: o Inserting an element may relocate every element of the map, which
+//:   invalidates all iterators, pointers, and references to elements.
+//:
+//: o Elements are relocated by copying when they are not bitwise movable.
+//:
+//: o The interface does not include the bucket interface of
+//:   'bsl::unordered_map', and the maximum load factor is fixed (at 0.875).
+//
+// The hash functor defaults to 'bslh::Hash<>', and the map uses a
+// 'bslma::Allocator' to supply memory for its slots and its elements.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the occurrences of each word in a sequence of
+// words.  First, we create a 'bdlc::FlatHashMap' from a word to its count:
+//..
+//  const char *WORDS[] = { "the", "quick", "brown", "fox", "jumps", "over",
+//                          "the", "lazy", "dog", "and", "the", "fox" };
+//  const int   NUM_WORDS = static_cast<int>(sizeof WORDS / sizeof *WORDS);
+//
+//  bdlc::FlatHashMap<bsl::string, int> counts;
+//..
+// Then, we count the words, relying on 'operator[]' to insert a count of 0
+// the first time a word is seen:
+//..
+//  for (int i = 0; i < NUM_WORDS; ++i) {
+//      ++counts[WORDS[i]];
+//  }
+//..
+// Finally, we verify the counts:
+//..
+//  assert(9 == counts.size());
+//  assert(3 == counts["the"]);
+//  assert(2 == counts["fox"]);
+//  assert(1 == counts["dog"]);
+//
+//  assert(counts.contains("lazy"));
+//  assert(!counts.contains("cat"));
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#include <bdlc_flathashtable.h>
+#endif
+
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_CONSTRUCTIONUTIL
+#include <bslma_constructionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_STDEXCEPTUTIL
+#include <bslstl_stdexceptutil.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                       // ============================
+                       // struct FlatHashMap_EntryUtil
+                       // ============================
+
+template <class KEY, class VALUE, class ENTRY>
+struct FlatHashMap_EntryUtil {
+    // This templated utility provides methods to construct an 'ENTRY' and a
+    // method to extract the key from an 'ENTRY', as required by
+    // 'FlatHashTable'.
+
+    // CLASS METHODS
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const KEY&        key);
+        // Create, at the specified 'entry' address, an entry having the
+        // specified 'key' and a default-constructed value, using the
+        // specified 'allocator' to supply memory.
+
+    static const KEY& key(const ENTRY& entry);
+        // Return a reference providing non-modifiable access to the key of
+        // the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashMap
+                            // =================
+
+template <class KEY,
+          class VALUE,
+          class HASH  = bslh::Hash<>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashMap {
+    // This class template implements a value-semantic container type holding
+    // an unordered set of unique keys of the (template parameter) type 'KEY',
+    // each mapped to a value of the (template parameter) type 'VALUE', in an
+    // open-addressed hash table using the (template parameter) type 'HASH' to
+    // hash keys and the (template parameter) type 'EQUAL' to compare keys.
+
+  public:
+    // TYPES
+    typedef KEY                                            key_type;
+    typedef VALUE                                          mapped_type;
+    typedef bsl::pair<const KEY, VALUE>                    value_type;
+    typedef bsl::size_t                                    size_type;
+    typedef HASH                                           hasher;
+    typedef EQUAL                                          key_equal;
+    typedef value_type&                                    reference;
+    typedef const value_type&                              const_reference;
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          value_type,
+                          FlatHashMap_EntryUtil<KEY, VALUE, value_type>,
+                          HASH,
+                          EQUAL> ImplType;
+
+  public:
+    typedef typename ImplType::iterator                    iterator;
+    typedef typename ImplType::const_iterator              const_iterator;
+
+  private:
+    // DATA
+    ImplType d_impl;  // underlying flat hash table
+
+    // FRIENDS
+    template <class K, class V, class H, class E>
+    friend bool operator==(const FlatHashMap<K, V, H, E>&,
+                           const FlatHashMap<K, V, H, E>&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashMap, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashMap();
+    explicit FlatHashMap(bslma::Allocator *basicAllocator);
+    explicit FlatHashMap(bsl::size_t capacity);
+    FlatHashMap(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashMap(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'FlatHashMap' object.  Optionally specify a
+        // 'capacity' indicating the minimum number of elements the map can
+        // hold without rehashing; if 'capacity' is not supplied, the map
+        // initially has no slots.  Optionally specify a 'hash' used to
+        // generate the hash values for the keys of the elements; if 'hash' is
+        // not supplied, a default-constructed object of the (template
+        // parameter) type 'HASH' is used.  Optionally specify an 'equal' used
+        // to determine whether two keys are equivalent; if 'equal' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'EQUAL' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied or is 0, the
+        // currently installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashMap(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a 'FlatHashMap' object initialized with the elements in the
+        // range '[first, last)' (ignoring those whose keys duplicate the key
+        // of an earlier element).  Optionally specify a 'basicAllocator' used
+        // to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless 'first' and 'last' refer to a sequence of valid values where
+        // 'first' is at a position at or before 'last'.
+
+    FlatHashMap(const FlatHashMap&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a 'FlatHashMap' object having the same value, hasher, and
+        // key-equality comparator as the specified 'original' object.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~FlatHashMap();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    FlatHashMap& operator=(const FlatHashMap& rhs);
+        // Assign to this object the value, hasher, and key-equality functor
+        // of the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.
+
+    VALUE& operator[](const KEY& key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map.  If this map does
+        // not already contain an element having 'key', insert an element
+        // having 'key' and a default-constructed 'VALUE' first.  Note that
+        // this method requires that the (template parameter) type 'VALUE' be
+        // default constructible.
+
+    VALUE& at(const KEY& key);
+        // Return a reference providing modifiable access to the mapped value
+        // associated with the specified 'key' in this map, if such an element
+        // exists; otherwise throw a 'std::out_of_range' exception.
+
+    void clear();
+        // Erase all elements from this map, retaining its capacity.
+
+    bsl::pair<iterator, iterator> equal_range(const KEY& key);
+        // Return a pair of iterators defining the sequence of modifiable
+        // elements in this map having the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // is positioned one past the end of the sequence.  If this map
+        // contains no element having 'key', then the two returned iterators
+        // will have the same value.
+
+    bsl::size_t erase(const KEY& key);
+        // Erase the element having the specified 'key' from this map, if
+        // any, and return the number of elements erased (0 or 1).
+
+    iterator erase(const_iterator position);
+    iterator erase(iterator position);
+        // Erase the element at the specified 'position' from this map, and
+        // return an iterator referring to the element following it (or the
+        // past-the-end iterator).  The behavior is undefined unless
+        // 'position' refers to an element of this map.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Erase the elements in the range '[first, last)' from this map, and
+        // return 'last'.  The behavior is undefined unless 'first' and 'last'
+        // are a valid range of iterators into this map.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the modifiable element in this map
+        // having the specified 'key', or 'end()' if there is no such element.
+
+    bsl::pair<iterator, bool> insert(const value_type& value);
+        // Insert a copy of the specified 'value' into this map if the key of
+        // 'value' does not already exist in this map.  Return a pair whose
+        // 'first' member is an iterator referring to the element in this map
+        // having the key of 'value', and whose 'second' member is 'true' if
+        // 'value' was inserted and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this map a copy of each element in the range
+        // '[first, last)' whose key does not already exist in this map.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last'.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this map to at least the specified
+        // 'minimumCapacity' (rounded to a valid capacity able to hold
+        // 'size()' elements), and redistribute all contained elements into
+        // the new slots.
+
+    void reserve(bsl::size_t numEntries);
+        // Ensure that this map can hold at least the specified 'numEntries'
+        // elements without rehashing.
+
+    void swap(FlatHashMap& other);
+        // Exchange the value, hasher, and key-equality functor of this object
+        // with those of the specified 'other' object.  The behavior is
+        // undefined unless this object was created with the same allocator
+        // as 'other'.
+
+                             // Iterators
+
+    iterator begin();
+        // Return an iterator referring to the first element of this map, or
+        // 'end()' if this map is empty.
+
+    iterator end();
+        // Return the past-the-end iterator for this map.
+
+    // ACCESSORS
+    const VALUE& at(const KEY& key) const;
+        // Return a reference providing non-modifiable access to the mapped
+        // value associated with the specified 'key' in this map, if such an
+        // element exists; otherwise throw a 'std::out_of_range' exception.
+
+    bsl::size_t capacity() const;
+        // Return the number of slots in this map.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this map contains an element having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this map having the specified
+        // 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this map contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(const KEY& key)
+                                                                         const;
+        // Return a pair of iterators defining the sequence of non-modifiable
+        // elements in this map having the specified 'key', where the first
+        // iterator is positioned at the start of the sequence and the second
+        // is positioned one past the end of the sequence.  If this map
+        // contains no element having 'key', then the two returned iterators
+        // will have the same value.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the non-modifiable element in this
+        // map having the specified 'key', or 'end()' if there is no such
+        // element.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hasher of this map.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality functor of this map.
+
+    float load_factor() const;
+        // Return the current ratio between the number of elements in this
+        // map and its capacity, or 0 if this map has no slots.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this map, at which it is
+        // rehashed.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this map.
+
+                             // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this map, or
+        // 'end()' if this map is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator for this map.
+
+                               // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this map to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatHashMap' objects have the same
+    // value if their sizes are the same and each element of 'lhs' has an
+    // element in 'rhs' with the same key and mapped value.  Note that the
+    // hashers and key-equality functors are not compared.
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+bool operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+void swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+          FlatHashMap<KEY, VALUE, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  The behavior
+    // is undefined unless 'a' and 'b' were created with the same allocator.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // struct FlatHashMap_EntryUtil
+                       // ----------------------------
+
+// CLASS METHODS
+template <class KEY, class VALUE, class ENTRY>
+inline
+void FlatHashMap_EntryUtil<KEY, VALUE, ENTRY>::constructFromKey(
+                                                 ENTRY            *entry,
+                                                 bslma::Allocator *allocator,
+                                                 const KEY&        key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bslma::ConstructionUtil::construct(entry, allocator, key, VALUE());
+}
+
+template <class KEY, class VALUE, class ENTRY>
+inline
+const KEY& FlatHashMap_EntryUtil<KEY, VALUE, ENTRY>::key(const ENTRY& entry)
+{
+    return entry.first;
+}
+
+                            // -----------------
+                            // class FlatHashMap
+                            // -----------------
+
+// CREATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              bsl::size_t       capacity,
+                                              const HASH&       hash,
+                                              const EQUAL&      equal,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                              INPUT_ITERATOR    first,
+                                              INPUT_ITERATOR    last,
+                                              bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::FlatHashMap(
+                                          const FlatHashMap&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::~FlatHashMap()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+FlatHashMap<KEY, VALUE, HASH, EQUAL>&
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator=(const FlatHashMap& rhs)
+{
+    d_impl = rhs.d_impl;
+
+    return *this;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::operator[](const KEY& key)
+{
+    return d_impl.insertKey(key).first->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key)
+{
+    iterator it = d_impl.find(key);
+
+    if (it == d_impl.end()) {
+        bslstl::StdExceptUtil::throwOutOfRange(
+                               "FlatHashMap<...>::at(key_type): invalid key");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator,
+          typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key)
+{
+    iterator it1 = d_impl.find(key);
+    iterator it2 = it1;
+
+    if (it1 != d_impl.end()) {
+        ++it2;
+    }
+    return bsl::pair<iterator, iterator>(it1, it2);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(const_iterator(position));
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::erase(const_iterator first,
+                                            const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key)
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator, bool>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(const value_type& value)
+{
+    return d_impl.insert(value);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                                  INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insert(*first);
+    }
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::reserve(bsl::size_t numEntries)
+{
+    d_impl.reserve(numEntries);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void FlatHashMap<KEY, VALUE, HASH, EQUAL>::swap(FlatHashMap& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+                             // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin()
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end()
+{
+    return d_impl.end();
+}
+
+// ACCESSORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+const VALUE& FlatHashMap<KEY, VALUE, HASH, EQUAL>::at(const KEY& key) const
+{
+    const_iterator it = d_impl.find(key);
+
+    if (it == d_impl.end()) {
+        bslstl::StdExceptUtil::throwOutOfRange(
+                               "FlatHashMap<...>::at(key_type): invalid key");
+    }
+    return it->second;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool FlatHashMap<KEY, VALUE, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator,
+          typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator>
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::equal_range(const KEY& key) const
+{
+    const_iterator it1 = d_impl.find(key);
+    const_iterator it2 = it1;
+
+    if (it1 != d_impl.end()) {
+        ++it2;
+    }
+    return bsl::pair<const_iterator, const_iterator>(it1, it2);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+HASH FlatHashMap<KEY, VALUE, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+EQUAL FlatHashMap<KEY, VALUE, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+float FlatHashMap<KEY, VALUE, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashMap<KEY, VALUE, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                             // Iterators
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+typename FlatHashMap<KEY, VALUE, HASH, EQUAL>::const_iterator
+FlatHashMap<KEY, VALUE, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+                               // Aspects
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashMap<KEY, VALUE, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashMap<KEY, VALUE, HASH, EQUAL>& lhs,
+                      const FlatHashMap<KEY, VALUE, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class VALUE, class HASH, class EQUAL>
+inline
+void bdlc::swap(FlatHashMap<KEY, VALUE, HASH, EQUAL>& a,
+                FlatHashMap<KEY, VALUE, HASH, EQUAL>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1013 @@
+// bdlc_flathashmap.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashmap.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_map.h>
+#include <bsl_stdexcept.h>
+#include <bsl_string.h>
+#include <bsl_unordered_map.h>
+#include <bsl_utility.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlc::FlatHashMap' is a thin wrapper around 'bdlc::FlatHashTable', which is
+// tested thoroughly in its own test driver.  This test driver therefore
+// verifies that each method is forwarded correctly, that the map-specific
+// methods ('operator[]', 'at', 'equal_range') behave as specified, and that
+// the map uses the allocator supplied at construction for its elements.
+// Negative test cases compare the performance of 'bdlc::FlatHashMap' with
+// that of 'bsl::unordered_map'.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashMap();
+// [ 2] explicit FlatHashMap(bslma::Allocator *basicAllocator);
+// [ 2] explicit FlatHashMap(size_t capacity);
+// [ 2] FlatHashMap(size_t capacity, bslma::Allocator *basicAllocator);
+// [ 2] FlatHashMap(size_t capacity, const HASH& hash, Allocator *ba = 0);
+// [ 2] FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator *ba = 0);
+// [ 2] FlatHashMap(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+// [ 4] FlatHashMap(const FlatHashMap& original, Allocator *ba = 0);
+// [ 2] ~FlatHashMap();
+//
+// MANIPULATORS
+// [ 4] FlatHashMap& operator=(const FlatHashMap& rhs);
+// [ 3] VALUE& operator[](const KEY& key);
+// [ 3] VALUE& at(const KEY& key);
+// [ 3] void clear();
+// [ 3] pair<iterator, iterator> equal_range(const KEY& key);
+// [ 3] size_t erase(const KEY& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 3] iterator find(const KEY& key);
+// [ 3] pair<iterator, bool> insert(const value_type& value);
+// [ 3] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] void rehash(size_t minimumCapacity);
+// [ 3] void reserve(size_t numEntries);
+// [ 4] void swap(FlatHashMap& other);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+//
+// ACCESSORS
+// [ 3] const VALUE& at(const KEY& key) const;
+// [ 2] size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(key) const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+// [ 4] bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(FlatHashMap& a, FlatHashMap& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+// [-2] PERFORMANCE TEST: LARGE MAPS
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashMap<int, int>                 Obj;
+typedef bdlc::FlatHashMap<bsl::string, bsl::string> StringObj;
+typedef bsl::pair<const int, int>                   Value;
+
+// ============================================================================
+//                      GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                               // ==============
+                               // struct ModHash
+                               // ==============
+
+struct ModHash {
+    // This hasher returns its argument modulo a modulus supplied at
+    // construction, so that distinct keys may collide.
+
+    int d_modulus;
+
+    explicit ModHash(int modulus = 1000)
+    : d_modulus(modulus)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key % d_modulus);
+    }
+};
+
+                            // ====================
+                            // struct AbsoluteEqual
+                            // ====================
+
+struct AbsoluteEqual {
+    // This comparator considers two keys equal if their absolute values are
+    // equal.
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return (lhs < 0 ? -lhs : lhs) == (rhs < 0 ? -rhs : rhs);
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       PERFORMANCE TEST SUPPORT
+// ----------------------------------------------------------------------------
+
+namespace {
+
+bsl::uint64_t presentKey(bsl::uint64_t index)
+    // Return the key having the specified 'index' among the keys inserted by
+    // the performance test.  Keys are distinct, even, and scattered.
+{
+    return index * 0x9E3779B97F4A7C16ULL;
+}
+
+bsl::uint64_t missingKey(bsl::uint64_t index)
+    // Return the key having the specified 'index' among the keys sought, but
+    // not inserted, by the performance test.
+{
+    return presentKey(index) + 1;
+}
+
+template <class MAP>
+void timeMap(const char *name, bsl::size_t numElements)
+    // Report to 'cout' the time per operation of inserting the specified
+    // 'numElements' elements into an object of the (template parameter) type
+    // 'MAP', finding each element, failing to find as many missing keys, and
+    // erasing each element.  Use the specified 'name' to identify the map.
+{
+    bslma::Allocator *allocator = &bslma::NewDeleteAllocator::singleton();
+
+    MAP                    map(allocator);
+    bsls::Stopwatch        timer;
+    bsls::Types::Uint64    total = 0;
+    const double           N     = static_cast<double>(numElements);
+
+    timer.start();
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        map[presentKey(i)] = i;
+    }
+    timer.stop();
+    const double insertTime = timer.elapsedTime();
+
+    timer.reset();
+    timer.start();
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        total += map.find(presentKey(i))->second;
+    }
+    timer.stop();
+    const double findHitTime = timer.elapsedTime();
+
+    timer.reset();
+    timer.start();
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        total += map.find(missingKey(i)) == map.end();
+    }
+    timer.stop();
+    const double findMissTime = timer.elapsedTime();
+
+    timer.reset();
+    timer.start();
+    for (bsl::size_t i = 0; i < numElements; ++i) {
+        total += map.erase(presentKey(i));
+    }
+    timer.stop();
+    const double eraseTime = timer.elapsedTime();
+
+    ASSERT(map.empty());
+    ASSERT(numElements * (numElements - 1) / 2 + 2 * numElements == total);
+
+    cout << name << ":\tN = " << numElements
+         << "\tinsert: "    << insertTime   * 1.0e9 / N << "ns"
+         << "\tfind-hit: "  << findHitTime  * 1.0e9 / N << "ns"
+         << "\tfind-miss: " << findMissTime * 1.0e9 / N << "ns"
+         << "\terase: "     << eraseTime    * 1.0e9 / N << "ns"
+         << endl;
+}
+
+void timeMaps(bsl::size_t numElements)
+    // Report the performance of 'bdlc::FlatHashMap' and 'bsl::unordered_map'
+    // for maps having the specified 'numElements' elements, using both
+    // 'bslh::Hash<>' and 'bsl::hash' to hash keys.  Note that the cost of
+    // computing 'bslh::Hash<>' (which uses 'bslh::SpookyHashAlgorithm')
+    // dominates the cost of an operation on a small 'bdlc::FlatHashMap'.
+{
+    typedef bsl::uint64_t                               Key;
+    typedef bdlc::FlatHashMap<Key, Key, bslh::Hash<> >   FlatBslhMap;
+    typedef bsl::unordered_map<Key, Key, bslh::Hash<> >  UnorderedBslhMap;
+    typedef bdlc::FlatHashMap<Key, Key, bsl::hash<Key> > FlatStdMap;
+    typedef bsl::unordered_map<Key, Key, bsl::hash<Key> >
+                                                         UnorderedStdMap;
+
+    timeMap<FlatBslhMap>     ("bdlc::FlatHashMap,  bslh::Hash", numElements);
+    timeMap<UnorderedBslhMap>("bsl::unordered_map, bslh::Hash", numElements);
+    timeMap<FlatStdMap>      ("bdlc::FlatHashMap,  bsl::hash ", numElements);
+    timeMap<UnorderedStdMap> ("bsl::unordered_map, bsl::hash ", numElements);
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose     = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Counting Words
+///- - - - - - - - - - - - -
+// Suppose we want to count the occurrences of each word in a sequence of
+// words.  First, we create a 'bdlc::FlatHashMap' from a word to its count:
+//..
+    const char *WORDS[] = { "the", "quick", "brown", "fox", "jumps", "over",
+                            "the", "lazy", "dog", "and", "the", "fox" };
+    const int   NUM_WORDS = static_cast<int>(sizeof WORDS / sizeof *WORDS);
+
+    bdlc::FlatHashMap<bsl::string, int> counts;
+//..
+// Then, we count the words, relying on 'operator[]' to insert a count of 0
+// the first time a word is seen:
+//..
+    for (int i = 0; i < NUM_WORDS; ++i) {
+        ++counts[WORDS[i]];
+    }
+//..
+// Finally, we verify the counts:
+//..
+    ASSERT(9 == counts.size());
+    ASSERT(3 == counts["the"]);
+    ASSERT(2 == counts["fox"]);
+    ASSERT(1 == counts["dog"]);
+
+    ASSERT(counts.contains("lazy"));
+    ASSERT(!counts.contains("cat"));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original and uses the allocator
+        //:   supplied at construction (or the default allocator) for the
+        //:   map and for its elements.
+        //:
+        //: 2 Assignment gives the target the value of the source, and retains
+        //:   the allocator of the target.
+        //:
+        //: 3 The member and free 'swap' exchange the values of two maps.
+        //:
+        //: 4 Two maps are equal if and only if they have the same keys, each
+        //:   mapped to the same value.
+        //
+        // Plan:
+        //: 1 Create maps of strings (which allocate), copy and assign them,
+        //:   and verify their values and the allocators of their elements.
+        //:   (C-1..2)
+        //:
+        //: 2 Swap two maps with the member and free 'swap' and verify their
+        //:   values.  (C-3)
+        //:
+        //: 3 Compare maps differing in a key, in a mapped value, and in
+        //:   size.  (C-4)
+        //
+        // Testing:
+        //   FlatHashMap(const FlatHashMap& original, Allocator *ba = 0);
+        //   FlatHashMap& operator=(const FlatHashMap& rhs);
+        //   void swap(FlatHashMap& other);
+        //   bool operator==(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   bool operator!=(const FlatHashMap& lhs, const FlatHashMap& rhs);
+        //   void swap(FlatHashMap& a, FlatHashMap& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+        bslma::TestAllocator tb("other", veryVerbose);
+
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+
+            for (int i = 0; i < 50; ++i) {
+                const bsl::string KEY(i, 'k');
+                mX[KEY] = bsl::string(100 + i, 'v');
+            }
+
+            if (verbose) cout << "\nTesting copy constructor." << endl;
+            {
+                const StringObj Y(X, &tb);
+
+                ASSERT(X == Y);
+                ASSERT(&tb == Y.allocator());
+                for (StringObj::const_iterator it = Y.begin();
+                     it != Y.end();
+                     ++it) {
+                    ASSERT(&tb == it->first.get_allocator().mechanism());
+                    ASSERT(&tb == it->second.get_allocator().mechanism());
+                }
+
+                const StringObj Z(X);
+
+                ASSERT(X == Z);
+                ASSERT(&defaultAllocator == Z.allocator());
+            }
+            ASSERT(0 == tb.numBlocksInUse());
+
+            if (verbose) cout << "\nTesting assignment." << endl;
+            {
+                StringObj mY(&tb);  const StringObj& Y = mY;
+                mY["other"] = "value";
+
+                mY = X;
+
+                ASSERT(X == Y);
+                ASSERT(&tb == Y.allocator());
+                ASSERT(!Y.contains("other"));
+                for (StringObj::const_iterator it = Y.begin();
+                     it != Y.end();
+                     ++it) {
+                    ASSERT(&tb == it->second.get_allocator().mechanism());
+                }
+            }
+            ASSERT(0 == tb.numBlocksInUse());
+
+            if (verbose) cout << "\nTesting 'swap'." << endl;
+            {
+                StringObj mY(&ta);  const StringObj& Y = mY;
+                mY["other"] = "value";
+
+                const StringObj XX(X, &tb);
+                const StringObj YY(Y, &tb);
+
+                mY.swap(mX);
+
+                ASSERT(XX == Y);
+                ASSERT(YY == X);
+
+                swap(mX, mY);
+
+                ASSERT(XX == X);
+                ASSERT(YY == Y);
+            }
+        }
+
+        if (verbose) cout << "\nTesting equality." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            Obj mY(&ta);  const Obj& Y = mY;
+
+            ASSERT(  X == Y);
+            ASSERT(!(X != Y));
+
+            for (int i = 0; i < 20; ++i) {
+                mX[i]      = i * i;
+                mY[19 - i] = (19 - i) * (19 - i);
+            }
+
+            ASSERT(  X == Y);
+            ASSERT(!(X != Y));
+
+            mY[5] = 0;
+
+            ASSERT(!(X == Y));
+            ASSERT(  X != Y);
+
+            mY[5] = 25;
+
+            ASSERT(  X == Y);
+
+            mY[20] = 400;
+
+            ASSERT(!(X == Y));
+            ASSERT(  X != Y);
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'operator[]' inserts a default-constructed value for a new key,
+        //:   and returns a reference to the mapped value.
+        //:
+        //: 2 'at' returns the mapped value of an existing key, and throws
+        //:   'std::out_of_range' for a missing key.
+        //:
+        //: 3 'insert' inserts a value only if its key is new.
+        //:
+        //: 4 'find', 'contains', 'count', and 'equal_range' locate exactly the
+        //:   keys in the map.
+        //:
+        //: 5 Each 'erase' overload erases the expected elements.
+        //:
+        //: 6 'clear', 'rehash', and 'reserve' are forwarded correctly.
+        //:
+        //: 7 Iteration visits every element exactly once.
+        //
+        // Plan:
+        //: 1 Perform a pseudo-random sequence of operations on a map, and
+        //:   verify the map against a 'bsl::map' oracle.  (C-1, 3..5, 7)
+        //:
+        //: 2 Exercise 'at' for existing and missing keys.  (C-2)
+        //:
+        //: 3 Exercise 'clear', 'rehash', and 'reserve' and verify the capacity
+        //:   and value of the map.  (C-6)
+        //
+        // Testing:
+        //   VALUE& operator[](const KEY& key);
+        //   VALUE& at(const KEY& key);
+        //   void clear();
+        //   pair<iterator, iterator> equal_range(const KEY& key);
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   iterator find(const KEY& key);
+        //   pair<iterator, bool> insert(const value_type& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numEntries);
+        //   iterator begin();
+        //   iterator end();
+        //   const VALUE& at(const KEY& key) const;
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(key) const;
+        //   const_iterator find(const KEY& key) const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING MANIPULATORS AND ACCESSORS" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+
+        if (verbose) cout << "\nTesting against an oracle." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            bsl::map<int, int> exp;
+
+            unsigned int seed = 12345;
+            for (int i = 0; i < 20000; ++i) {
+                seed = seed * 1103515245u + 12345u;
+                const unsigned int r   = seed >> 8;
+                const int          key = static_cast<int>(r % 2000);
+
+                switch ((r >> 12) % 5) {
+                  case 0: {
+                    ASSERTV(i, exp.erase(key) == mX.erase(key));
+                  } break;
+                  case 1: {
+                    Obj::iterator it = mX.find(key);
+                    if (it != mX.end()) {
+                        mX.erase(it);
+                        exp.erase(key);
+                    }
+                  } break;
+                  case 2: {
+                    const bool isNew = 0 == exp.count(key);
+                    if (isNew) {
+                        exp[key] = i;
+                    }
+                    bsl::pair<Obj::iterator, bool> result =
+                                                     mX.insert(Value(key, i));
+                    ASSERTV(i, isNew == result.second);
+                    ASSERTV(i, key == result.first->first);
+                    ASSERTV(i, exp[key] == result.first->second);
+                  } break;
+                  default: {
+                    exp[key] += i;
+                    mX[key]  += i;
+                  }
+                }
+            }
+
+            ASSERTV(exp.size(), X.size(), exp.size() == X.size());
+
+            bsl::size_t count = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(it->first, exp.count(it->first));
+                ASSERTV(it->first, exp[it->first] == it->second);
+                ++count;
+            }
+            ASSERT(exp.size() == count);
+
+            for (int key = -10; key < 2010; ++key) {
+                const bool HAS = 0 != exp.count(key);
+
+                ASSERTV(key, HAS == X.contains(key));
+                ASSERTV(key, HAS == (1 == X.count(key)));
+                ASSERTV(key, HAS == (X.find(key) != X.end()));
+                ASSERTV(key, HAS == (mX.find(key) != mX.end()));
+
+                bsl::pair<Obj::const_iterator, Obj::const_iterator> cr =
+                                                           X.equal_range(key);
+                bsl::pair<Obj::iterator, Obj::iterator> mr =
+                                                          mX.equal_range(key);
+
+                ASSERTV(key, HAS == (cr.first != cr.second));
+                ASSERTV(key, HAS == (mr.first != mr.second));
+                if (HAS) {
+                    ASSERTV(key, key == cr.first->first);
+                    ASSERTV(key, exp[key] == mr.first->second);
+                    ++cr.first;
+                    ASSERTV(key, cr.first == cr.second);
+                }
+            }
+
+            // Erase the elements in a range.
+
+            Obj::const_iterator first = X.begin();
+            for (int i = 0; i < 10; ++i) {
+                exp.erase(first->first);
+                ++first;
+            }
+            Obj::const_iterator last = first;
+            for (int i = 0; i < 10; ++i) {
+                exp.erase(last->first);
+                ++last;
+            }
+            mX.erase(X.begin(), last);
+
+            ASSERTV(exp.size(), X.size(), exp.size() == X.size());
+            for (bsl::map<int, int>::const_iterator it = exp.begin();
+                 it != exp.end();
+                 ++it) {
+                ASSERTV(it->first, it->second == X.at(it->first));
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'insert' of a range." << endl;
+        {
+            bsl::vector<Value> values;
+            for (int i = 0; i < 100; ++i) {
+                values.push_back(Value(i % 50, i));
+            }
+
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.insert(values.begin(), values.end());
+
+            ASSERT(50 == X.size());
+            for (int i = 0; i < 50; ++i) {
+                ASSERTV(i, i == X.at(i));
+            }
+
+            const Obj Y(values.begin(), values.end(), &ta);
+
+            ASSERT(X == Y);
+        }
+
+        if (verbose) cout << "\nTesting 'at'." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX[1] = 10;
+
+            ASSERT(10 == mX.at(1));
+            ASSERT(10 == X.at(1));
+
+            mX.at(1) = 11;
+            ASSERT(11 == X.at(1));
+
+#ifdef BDE_BUILD_TARGET_EXC
+            bool caught = false;
+            try {
+                mX.at(2);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            caught = false;
+            try {
+                X.at(2);
+            }
+            catch (const bsl::out_of_range&) {
+                caught = true;
+            }
+            ASSERT(caught);
+#endif
+            ASSERT(1 == X.size());
+        }
+
+        if (verbose) cout << "\nTesting 'clear', 'rehash', and 'reserve'."
+                          << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.reserve(100);
+            const bsl::size_t CAPACITY = X.capacity();
+            ASSERTV(CAPACITY, 100 <= CAPACITY * 7 / 8);
+
+            for (int i = 0; i < 100; ++i) {
+                mX[i] = i;
+            }
+            ASSERT(CAPACITY == X.capacity());
+
+            mX.rehash(4 * CAPACITY);
+            ASSERT(4 * CAPACITY == X.capacity());
+            ASSERT(100 == X.size());
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, i == X.at(i));
+            }
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(4 * CAPACITY == X.capacity());
+
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an empty map having the requested
+        //:   capacity, hasher, key-equality functor, and allocator.
+        //:
+        //: 2 The default allocator is used if no allocator is supplied.
+        //:
+        //: 3 The map uses the supplied hasher and key-equality functor.
+        //
+        // Plan:
+        //: 1 Create maps with each constructor and verify the basic accessors.
+        //:   (C-1..2)
+        //:
+        //: 2 Create a map with a key-equality functor considering keys having
+        //:   the same absolute value to be equal, and a hasher that is
+        //:   consistent with it, and verify that keys are considered
+        //:   equivalent accordingly.  (C-3)
+        //
+        // Testing:
+        //   FlatHashMap();
+        //   explicit FlatHashMap(bslma::Allocator *basicAllocator);
+        //   explicit FlatHashMap(size_t capacity);
+        //   FlatHashMap(size_t capacity, bslma::Allocator *basicAllocator);
+        //   FlatHashMap(size_t capacity, const HASH& hash, Allocator *ba = 0);
+        //   FlatHashMap(size_t, const HASH&, const EQUAL&, Allocator *ba = 0);
+        //   FlatHashMap(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+        //   ~FlatHashMap();
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONSTRUCTORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+
+        {
+            const Obj X;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0.0f == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(X.begin() == X.end());
+        }
+        {
+            const Obj X(&ta);
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        {
+            const Obj X(100);
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(128 == X.capacity());
+            ASSERT(X.empty());
+        }
+        {
+            const Obj X(100, &ta);
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(128 == X.capacity());
+            ASSERT(0 != ta.numBlocksInUse());
+        }
+        {
+            typedef bdlc::FlatHashMap<int, int, ModHash> ModObj;
+
+            const ModObj X(10, ModHash(7), &ta);
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(16 == X.capacity());
+            ASSERT(3 == X.hash_function()(10));
+        }
+        {
+            typedef bdlc::FlatHashMap<int, int, ModHash, AbsoluteEqual>
+                                                                ModAbsObj;
+
+            ModAbsObj mX(0, ModHash(1), AbsoluteEqual(), &ta);
+            const ModAbsObj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(X.key_eq()(-3, 3));
+            ASSERT(0 == X.hash_function()(17));
+
+            mX[3]  = 1;
+            mX[-3] = 2;
+
+            ASSERT(1 == X.size());
+            ASSERT(2 == X.at(3));
+            ASSERT(X.contains(-3));
+        }
+        {
+            const Value VALUES[] = { Value(1, 10),
+                                     Value(2, 20),
+                                     Value(1, 30) };
+
+            const Obj X(VALUES, VALUES + 3, &ta);
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(2 == X.size());
+            ASSERT(10 == X.at(1));
+            ASSERT(20 == X.at(2));
+            ASSERTV(X.load_factor(),
+                    static_cast<float>(2) /
+                          static_cast<float>(X.capacity()) == X.load_factor());
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a map, insert, find, and erase some elements, and verify
+        //:   the value of the map.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+
+            mX["one"]   = "1";
+            mX["two"]   = "2";
+            mX["three"] = "3";
+
+            ASSERT(3 == X.size());
+            ASSERT("2" == X.at("two"));
+            ASSERT(X.find("four") == X.end());
+
+            ASSERT(1 == mX.erase("two"));
+            ASSERT(2 == X.size());
+            ASSERT(!X.contains("two"));
+
+            ASSERT(!mX.insert(StringObj::value_type("one", "uno")).second);
+            ASSERT("1" == X.at("one"));
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 'bdlc::FlatHashMap' is faster than 'bsl::unordered_map' for
+        //:   insertion, successful and unsuccessful lookup, and erasure.
+        //
+        // Plan:
+        //: 1 For maps of 10^3 to 10^6 elements having 64-bit keys and values,
+        //:   time each operation on 'bdlc::FlatHashMap' and on
+        //:   'bsl::unordered_map', and report the time per operation.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        for (bsl::size_t n = 1000; n <= 1000000; n *= 10) {
+            timeMaps(n);
+        }
+      } break;
+      case -2: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: LARGE MAPS
+        //
+        // Concerns:
+        //: 1 The relative performance of 'bdlc::FlatHashMap' holds for maps
+        //:   that are much larger than the processor caches.
+        //
+        // Plan:
+        //: 1 As in case -1, for maps of 10^7 and 10^8 elements.  Note that
+        //:   this case requires several gigabytes of memory.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST: LARGE MAPS
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST: LARGE MAPS" << endl
+             << "============================" << endl;
+
+        for (bsl::size_t n = 10000000; n <= 100000000; n *= 10) {
+            timeMaps(n);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,740 @@
+// bdlc_flathashset.h                                                 -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHSET
+#define INCLUDED_BDLC_FLATHASHSET
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed unordered set container.
+//
+//@CLASSES:
+//  bdlc::FlatHashSet: open-addressed unordered set container
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashtable, bslstl_unorderedset
+//
+//@DESCRIPTION: This component defines a single class template,
+// 'bdlc::FlatHashSet', implementing an unordered associative container of
+// unique keys, with an interface modeled on (a subset of) that of
+// 'bsl::unordered_set'.
+//
+// Like 'bdlc::FlatHashMap', and unlike 'bsl::unordered_set', a
+// 'bdlc::FlatHashSet' stores its elements directly in a single array of slots
+// (see 'bdlc_flathashtable'), so that inserting an element does not (except
+// when the set grows) allocate memory.  Inserting an element may relocate
+// every element of the set, which invalidates all iterators, pointers, and
+// references to elements; and the maximum load factor is fixed (at 0.875).
+//
+// The hash functor defaults to 'bslh::Hash<>', and the set uses a
+// 'bslma::Allocator' to supply memory for its slots and its elements.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates
+/// - - - - - - - - - - - - - - -
+// Suppose we want to identify the distinct values in a sequence of integers.
+// First, we create a 'bdlc::FlatHashSet', reserving room for the worst case
+// in which every value is distinct:
+//..
+//  const int DATA[]   = { 5, 3, 5, 1, 9, 3, 3, 7, 1, 5 };
+//  const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+//
+//  bdlc::FlatHashSet<int> distinct;
+//  distinct.reserve(NUM_DATA);
+//..
+// Then, we insert each value, noting those that were seen before:
+//..
+//  int numDuplicates = 0;
+//  for (int i = 0; i < NUM_DATA; ++i) {
+//      if (!distinct.insert(DATA[i]).second) {
+//          ++numDuplicates;
+//      }
+//  }
+//..
+// Finally, we verify the result:
+//..
+//  assert(5 == distinct.size());
+//  assert(5 == numDuplicates);
+//  assert(1 == distinct.count(7));
+//  assert(0 == distinct.count(2));
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#include <bdlc_flathashtable.h>
+#endif
+
+#ifndef INCLUDED_BSLH_HASH
+#include <bslh_hash.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_CONSTRUCTIONUTIL
+#include <bslma_constructionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                       // ============================
+                       // struct FlatHashSet_EntryUtil
+                       // ============================
+
+template <class ENTRY>
+struct FlatHashSet_EntryUtil {
+    // This templated utility provides methods to construct an 'ENTRY' and a
+    // method to extract the key from an 'ENTRY' (which is the 'ENTRY'), as
+    // required by 'FlatHashTable'.
+
+    // CLASS METHODS
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const ENTRY&      key);
+        // Create, at the specified 'entry' address, a copy of the specified
+        // 'key', using the specified 'allocator' to supply memory.
+
+    static const ENTRY& key(const ENTRY& entry);
+        // Return the specified 'entry'.
+};
+
+                            // =================
+                            // class FlatHashSet
+                            // =================
+
+template <class KEY,
+          class HASH  = bslh::Hash<>,
+          class EQUAL = bsl::equal_to<KEY> >
+class FlatHashSet {
+    // This class template implements a value-semantic container type holding
+    // an unordered set of unique values of the (template parameter) type
+    // 'KEY', in an open-addressed hash table using the (template parameter)
+    // type 'HASH' to hash values and the (template parameter) type 'EQUAL' to
+    // compare values.
+
+  public:
+    // TYPES
+    typedef KEY                                            key_type;
+    typedef KEY                                            value_type;
+    typedef bsl::size_t                                    size_type;
+    typedef HASH                                           hasher;
+    typedef EQUAL                                          key_equal;
+    typedef const value_type&                              reference;
+    typedef const value_type&                              const_reference;
+
+  private:
+    // PRIVATE TYPES
+    typedef FlatHashTable<KEY,
+                          KEY,
+                          FlatHashSet_EntryUtil<KEY>,
+                          HASH,
+                          EQUAL> ImplType;
+
+  public:
+    typedef typename ImplType::const_iterator              iterator;
+    typedef typename ImplType::const_iterator              const_iterator;
+
+  private:
+    // DATA
+    ImplType d_impl;  // underlying flat hash table
+
+    // FRIENDS
+    template <class K, class H, class E>
+    friend bool operator==(const FlatHashSet<K, H, E>&,
+                           const FlatHashSet<K, H, E>&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashSet, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashSet();
+    explicit FlatHashSet(bslma::Allocator *basicAllocator);
+    explicit FlatHashSet(bsl::size_t capacity);
+    FlatHashSet(bsl::size_t capacity, bslma::Allocator *basicAllocator);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                bslma::Allocator *basicAllocator = 0);
+    FlatHashSet(bsl::size_t       capacity,
+                const HASH&       hash,
+                const EQUAL&      equal,
+                bslma::Allocator *basicAllocator = 0);
+        // Create an empty 'FlatHashSet' object.  Optionally specify a
+        // 'capacity' indicating the minimum number of elements the set can
+        // hold without rehashing; if 'capacity' is not supplied, the set
+        // initially has no slots.  Optionally specify a 'hash' used to
+        // generate the hash values of the elements; if 'hash' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'HASH' is used.  Optionally specify an 'equal' used to
+        // determine whether two elements are equivalent; if 'equal' is not
+        // supplied, a default-constructed object of the (template parameter)
+        // type 'EQUAL' is used.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is not supplied or is 0, the
+        // currently installed default allocator is used.
+
+    template <class INPUT_ITERATOR>
+    FlatHashSet(INPUT_ITERATOR    first,
+                INPUT_ITERATOR    last,
+                bslma::Allocator *basicAllocator = 0);
+        // Create a 'FlatHashSet' object initialized with the elements in the
+        // range '[first, last)' (ignoring duplicates).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'first' and 'last' refer to a sequence of valid
+        // values where 'first' is at a position at or before 'last'.
+
+    FlatHashSet(const FlatHashSet&  original,
+                bslma::Allocator   *basicAllocator = 0);
+        // Create a 'FlatHashSet' object having the same value, hasher, and
+        // key-equality comparator as the specified 'original' object.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    ~FlatHashSet();
+        // Destroy this object and each of its elements.
+
+    // MANIPULATORS
+    FlatHashSet& operator=(const FlatHashSet& rhs);
+        // Assign to this object the value, hasher, and key-equality functor
+        // of the specified 'rhs' object, and return a reference providing
+        // modifiable access to this object.
+
+    void clear();
+        // Erase all elements from this set, retaining its capacity.
+
+    bsl::size_t erase(const KEY& key);
+        // Erase the specified 'key' from this set, if it is present, and
+        // return the number of elements erased (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Erase the element at the specified 'position' from this set, and
+        // return an iterator referring to the element following it (or the
+        // past-the-end iterator).  The behavior is undefined unless
+        // 'position' refers to an element of this set.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Erase the elements in the range '[first, last)' from this set, and
+        // return 'last'.  The behavior is undefined unless 'first' and 'last'
+        // are a valid range of iterators into this set.
+
+    bsl::pair<iterator, bool> insert(const KEY& value);
+        // Insert a copy of the specified 'value' into this set if 'value'
+        // does not already exist in this set.  Return a pair whose 'first'
+        // member is an iterator referring to the element in this set equal
+        // to 'value', and whose 'second' member is 'true' if 'value' was
+        // inserted and 'false' otherwise.
+
+    template <class INPUT_ITERATOR>
+    void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        // Insert into this set a copy of each element in the range
+        // '[first, last)' that does not already exist in this set.  The
+        // behavior is undefined unless 'first' and 'last' refer to a sequence
+        // of valid values where 'first' is at a position at or before 'last'.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this set to at least the specified
+        // 'minimumCapacity' (rounded to a valid capacity able to hold
+        // 'size()' elements), and redistribute all contained elements into
+        // the new slots.
+
+    void reserve(bsl::size_t numEntries);
+        // Ensure that this set can hold at least the specified 'numEntries'
+        // elements without rehashing.
+
+    void swap(FlatHashSet& other);
+        // Exchange the value, hasher, and key-equality functor of this object
+        // with those of the specified 'other' object.  The behavior is
+        // undefined unless this object was created with the same allocator
+        // as 'other'.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of slots in this set.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this set contains the specified 'key', and 'false'
+        // otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of elements in this set equal to the specified
+        // 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this set contains no elements, and 'false'
+        // otherwise.
+
+    bsl::pair<const_iterator, const_iterator> equal_range(const KEY& key)
+                                                                         const;
+        // Return a pair of iterators defining the sequence of elements in
+        // this set equal to the specified 'key', where the first iterator is
+        // positioned at the start of the sequence and the second is
+        // positioned one past the end of the sequence.  If this set contains
+        // no element equal to 'key', then the two returned iterators will
+        // have the same value.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the element in this set equal to
+        // the specified 'key', or 'end()' if there is no such element.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hasher of this set.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key-equality functor of this set.
+
+    float load_factor() const;
+        // Return the current ratio between the number of elements in this
+        // set and its capacity, or 0 if this set has no slots.
+
+    float max_load_factor() const;
+        // Return the maximum load factor of this set, at which it is
+        // rehashed.
+
+    bsl::size_t size() const;
+        // Return the number of elements in this set.
+
+                             // Iterators
+
+    const_iterator begin() const;
+    const_iterator cbegin() const;
+        // Return an iterator referring to the first element of this set, or
+        // 'end()' if this set is empty.
+
+    const_iterator end() const;
+    const_iterator cend() const;
+        // Return the past-the-end iterator for this set.
+
+                               // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this set to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+bool operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'FlatHashSet' objects have the same
+    // value if their sizes are the same and each element of 'lhs' is also an
+    // element of 'rhs'.  Note that the hashers and key-equality functors are
+    // not compared.
+
+template <class KEY, class HASH, class EQUAL>
+bool operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                const FlatHashSet<KEY, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+void swap(FlatHashSet<KEY, HASH, EQUAL>& a, FlatHashSet<KEY, HASH, EQUAL>& b);
+    // Exchange the values of the specified 'a' and 'b' objects.  The behavior
+    // is undefined unless 'a' and 'b' were created with the same allocator.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                       // ----------------------------
+                       // struct FlatHashSet_EntryUtil
+                       // ----------------------------
+
+// CLASS METHODS
+template <class ENTRY>
+inline
+void FlatHashSet_EntryUtil<ENTRY>::constructFromKey(
+                                                 ENTRY            *entry,
+                                                 bslma::Allocator *allocator,
+                                                 const ENTRY&      key)
+{
+    BSLS_ASSERT_SAFE(entry);
+
+    bslma::ConstructionUtil::construct(entry, allocator, key);
+}
+
+template <class ENTRY>
+inline
+const ENTRY& FlatHashSet_EntryUtil<ENTRY>::key(const ENTRY& entry)
+{
+    return entry;
+}
+
+                            // -----------------
+                            // class FlatHashSet
+                            // -----------------
+
+// CREATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet()
+: d_impl(0, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t capacity)
+: d_impl(capacity, HASH(), EQUAL())
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, HASH(), EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, EQUAL(), basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(bsl::size_t       capacity,
+                                           const HASH&       hash,
+                                           const EQUAL&      equal,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(capacity, hash, equal, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(INPUT_ITERATOR    first,
+                                           INPUT_ITERATOR    last,
+                                           bslma::Allocator *basicAllocator)
+: d_impl(0, HASH(), EQUAL(), basicAllocator)
+{
+    insert(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::FlatHashSet(
+                                          const FlatHashSet&  original,
+                                          bslma::Allocator   *basicAllocator)
+: d_impl(original.d_impl, basicAllocator)
+{
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>::~FlatHashSet()
+{
+}
+
+// MANIPULATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+FlatHashSet<KEY, HASH, EQUAL>&
+FlatHashSet<KEY, HASH, EQUAL>::operator=(const FlatHashSet& rhs)
+{
+    d_impl = rhs.d_impl;
+
+    return *this;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::clear()
+{
+    d_impl.clear();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::erase(const KEY& key)
+{
+    return d_impl.erase(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    return d_impl.erase(position);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::iterator
+FlatHashSet<KEY, HASH, EQUAL>::erase(const_iterator first,
+                                     const_iterator last)
+{
+    return d_impl.erase(first, last);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::iterator, bool>
+FlatHashSet<KEY, HASH, EQUAL>::insert(const KEY& value)
+{
+    bsl::pair<typename ImplType::iterator, bool> result =
+                                                         d_impl.insert(value);
+
+    return bsl::pair<iterator, bool>(result.first, result.second);
+}
+
+template <class KEY, class HASH, class EQUAL>
+template <class INPUT_ITERATOR>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::insert(INPUT_ITERATOR first,
+                                           INPUT_ITERATOR last)
+{
+    for (; first != last; ++first) {
+        d_impl.insert(*first);
+    }
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::rehash(bsl::size_t minimumCapacity)
+{
+    d_impl.rehash(minimumCapacity);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::reserve(bsl::size_t numEntries)
+{
+    d_impl.reserve(numEntries);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+void FlatHashSet<KEY, HASH, EQUAL>::swap(FlatHashSet& other)
+{
+    BSLS_ASSERT_SAFE(allocator() == other.allocator());
+
+    d_impl.swap(other.d_impl);
+}
+
+// ACCESSORS
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::capacity() const
+{
+    return d_impl.capacity();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::contains(const KEY& key) const
+{
+    return d_impl.contains(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::count(const KEY& key) const
+{
+    return d_impl.count(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool FlatHashSet<KEY, HASH, EQUAL>::empty() const
+{
+    return d_impl.empty();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::pair<typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator,
+          typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator>
+FlatHashSet<KEY, HASH, EQUAL>::equal_range(const KEY& key) const
+{
+    const_iterator it1 = d_impl.find(key);
+    const_iterator it2 = it1;
+
+    if (it1 != d_impl.end()) {
+        ++it2;
+    }
+    return bsl::pair<const_iterator, const_iterator>(it1, it2);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::find(const KEY& key) const
+{
+    return d_impl.find(key);
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+HASH FlatHashSet<KEY, HASH, EQUAL>::hash_function() const
+{
+    return d_impl.hash_function();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+EQUAL FlatHashSet<KEY, HASH, EQUAL>::key_eq() const
+{
+    return d_impl.key_eq();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::load_factor() const
+{
+    return d_impl.load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+float FlatHashSet<KEY, HASH, EQUAL>::max_load_factor() const
+{
+    return d_impl.max_load_factor();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashSet<KEY, HASH, EQUAL>::size() const
+{
+    return d_impl.size();
+}
+
+                             // Iterators
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::begin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cbegin() const
+{
+    return d_impl.begin();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::end() const
+{
+    return d_impl.end();
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+typename FlatHashSet<KEY, HASH, EQUAL>::const_iterator
+FlatHashSet<KEY, HASH, EQUAL>::cend() const
+{
+    return d_impl.end();
+}
+
+                               // Aspects
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bslma::Allocator *FlatHashSet<KEY, HASH, EQUAL>::allocator() const
+{
+    return d_impl.allocator();
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator==(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return lhs.d_impl == rhs.d_impl;
+}
+
+template <class KEY, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(const FlatHashSet<KEY, HASH, EQUAL>& lhs,
+                      const FlatHashSet<KEY, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+// FREE FUNCTIONS
+template <class KEY, class HASH, class EQUAL>
+inline
+void bdlc::swap(FlatHashSet<KEY, HASH, EQUAL>& a,
+                FlatHashSet<KEY, HASH, EQUAL>& b)
+{
+    a.swap(b);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,747 @@
+// bdlc_flathashset.t.cpp                                             -*-C++-*-
+#include <bdlc_flathashset.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_utility.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlc::FlatHashSet' is a thin wrapper around 'bdlc::FlatHashTable', which is
+// tested thoroughly in its own test driver.  This test driver therefore
+// verifies that each method is forwarded correctly, and that the set uses the
+// allocator supplied at construction for its elements.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashSet();
+// [ 2] explicit FlatHashSet(bslma::Allocator *basicAllocator);
+// [ 2] explicit FlatHashSet(size_t capacity);
+// [ 2] FlatHashSet(size_t capacity, bslma::Allocator *basicAllocator);
+// [ 2] FlatHashSet(size_t capacity, const HASH& hash, Allocator *ba = 0);
+// [ 2] FlatHashSet(size_t, const HASH&, const EQUAL&, Allocator *ba = 0);
+// [ 2] FlatHashSet(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+// [ 4] FlatHashSet(const FlatHashSet& original, Allocator *ba = 0);
+// [ 2] ~FlatHashSet();
+//
+// MANIPULATORS
+// [ 4] FlatHashSet& operator=(const FlatHashSet& rhs);
+// [ 3] void clear();
+// [ 3] size_t erase(const KEY& key);
+// [ 3] iterator erase(const_iterator position);
+// [ 3] iterator erase(const_iterator first, const_iterator last);
+// [ 3] pair<iterator, bool> insert(const KEY& value);
+// [ 3] void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+// [ 3] void rehash(size_t minimumCapacity);
+// [ 3] void reserve(size_t numEntries);
+// [ 4] void swap(FlatHashSet& other);
+//
+// ACCESSORS
+// [ 2] size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 3] pair<const_iterator, const_iterator> equal_range(key) const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator cbegin() const;
+// [ 3] const_iterator end() const;
+// [ 3] const_iterator cend() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 4] bool operator==(const FlatHashSet& lhs, const FlatHashSet& rhs);
+// [ 4] bool operator!=(const FlatHashSet& lhs, const FlatHashSet& rhs);
+//
+// FREE FUNCTIONS
+// [ 4] void swap(FlatHashSet& a, FlatHashSet& b);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashSet<int>         Obj;
+typedef bdlc::FlatHashSet<bsl::string> StringObj;
+
+// ============================================================================
+//                      GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                               // ==============
+                               // struct ModHash
+                               // ==============
+
+struct ModHash {
+    // This hasher returns its argument modulo a modulus supplied at
+    // construction, so that distinct keys may collide.
+
+    int d_modulus;
+
+    explicit ModHash(int modulus = 1000)
+    : d_modulus(modulus)
+    {
+    }
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key % d_modulus);
+    }
+};
+
+                            // ====================
+                            // struct AbsoluteEqual
+                            // ====================
+
+struct AbsoluteEqual {
+    // This comparator considers two keys equal if their absolute values are
+    // equal.
+
+    bool operator()(int lhs, int rhs) const
+    {
+        return (lhs < 0 ? -lhs : lhs) == (rhs < 0 ? -rhs : rhs);
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test        = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose     = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Removing Duplicates
+/// - - - - - - - - - - - - - - -
+// Suppose we want to identify the distinct values in a sequence of integers.
+// First, we create a 'bdlc::FlatHashSet', reserving room for the worst case
+// in which every value is distinct:
+//..
+    const int DATA[]   = { 5, 3, 5, 1, 9, 3, 3, 7, 1, 5 };
+    const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+    bdlc::FlatHashSet<int> distinct;
+    distinct.reserve(NUM_DATA);
+//..
+// Then, we insert each value, noting those that were seen before:
+//..
+    int numDuplicates = 0;
+    for (int i = 0; i < NUM_DATA; ++i) {
+        if (!distinct.insert(DATA[i]).second) {
+            ++numDuplicates;
+        }
+    }
+//..
+// Finally, we verify the result:
+//..
+    ASSERT(5 == distinct.size());
+    ASSERT(5 == numDuplicates);
+    ASSERT(1 == distinct.count(7));
+    ASSERT(0 == distinct.count(2));
+//..
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value as the original and uses the allocator
+        //:   supplied at construction (or the default allocator) for the set
+        //:   and for its elements.
+        //:
+        //: 2 Assignment gives the target the value of the source, and retains
+        //:   the allocator of the target.
+        //:
+        //: 3 The member and free 'swap' exchange the values of two sets.
+        //:
+        //: 4 Two sets are equal if and only if they have the same elements.
+        //
+        // Plan:
+        //: 1 Create sets of strings (which allocate), copy and assign them,
+        //:   and verify their values and the allocators of their elements.
+        //:   (C-1..2)
+        //:
+        //: 2 Swap two sets with the member and free 'swap' and verify their
+        //:   values.  (C-3)
+        //:
+        //: 3 Compare sets differing in an element, and in size.  (C-4)
+        //
+        // Testing:
+        //   FlatHashSet(const FlatHashSet& original, Allocator *ba = 0);
+        //   FlatHashSet& operator=(const FlatHashSet& rhs);
+        //   void swap(FlatHashSet& other);
+        //   bool operator==(const FlatHashSet& lhs, const FlatHashSet& rhs);
+        //   bool operator!=(const FlatHashSet& lhs, const FlatHashSet& rhs);
+        //   void swap(FlatHashSet& a, FlatHashSet& b);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+        bslma::TestAllocator tb("other", veryVerbose);
+
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+
+            for (int i = 0; i < 50; ++i) {
+                mX.insert(bsl::string(100 + i, 'k'));
+            }
+
+            if (verbose) cout << "\nTesting copy constructor." << endl;
+            {
+                const StringObj Y(X, &tb);
+
+                ASSERT(X == Y);
+                ASSERT(&tb == Y.allocator());
+                for (StringObj::const_iterator it = Y.begin();
+                     it != Y.end();
+                     ++it) {
+                    ASSERT(&tb == it->get_allocator().mechanism());
+                }
+
+                const StringObj Z(X);
+
+                ASSERT(X == Z);
+                ASSERT(&defaultAllocator == Z.allocator());
+            }
+            ASSERT(0 == tb.numBlocksInUse());
+
+            if (verbose) cout << "\nTesting assignment." << endl;
+            {
+                StringObj mY(&tb);  const StringObj& Y = mY;
+                mY.insert("other");
+
+                mY = X;
+
+                ASSERT(X == Y);
+                ASSERT(&tb == Y.allocator());
+                ASSERT(!Y.contains("other"));
+            }
+            ASSERT(0 == tb.numBlocksInUse());
+
+            if (verbose) cout << "\nTesting 'swap'." << endl;
+            {
+                StringObj mY(&ta);  const StringObj& Y = mY;
+                mY.insert("other");
+
+                const StringObj XX(X, &tb);
+                const StringObj YY(Y, &tb);
+
+                mY.swap(mX);
+
+                ASSERT(XX == Y);
+                ASSERT(YY == X);
+
+                swap(mX, mY);
+
+                ASSERT(XX == X);
+                ASSERT(YY == Y);
+            }
+        }
+
+        if (verbose) cout << "\nTesting equality." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            Obj mY(&ta);  const Obj& Y = mY;
+
+            ASSERT(  X == Y);
+            ASSERT(!(X != Y));
+
+            for (int i = 0; i < 20; ++i) {
+                mX.insert(i);
+                mY.insert(19 - i);
+            }
+
+            ASSERT(  X == Y);
+            ASSERT(!(X != Y));
+
+            mY.erase(5);
+            mY.insert(20);
+
+            ASSERT(!(X == Y));
+            ASSERT(  X != Y);
+
+            mY.insert(5);
+
+            ASSERT(!(X == Y));
+            ASSERT(  X != Y);
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING MANIPULATORS AND ACCESSORS
+        //
+        // Concerns:
+        //: 1 'insert' inserts a value only if it is not already present.
+        //:
+        //: 2 'find', 'contains', 'count', and 'equal_range' locate exactly the
+        //:   elements of the set.
+        //:
+        //: 3 Each 'erase' overload erases the expected elements.
+        //:
+        //: 4 'clear', 'rehash', and 'reserve' are forwarded correctly.
+        //:
+        //: 5 Iteration visits every element exactly once.
+        //
+        // Plan:
+        //: 1 Perform a pseudo-random sequence of operations on a set, and
+        //:   verify the set against a 'bsl::set' oracle.  (C-1..3, 5)
+        //:
+        //: 2 Exercise 'clear', 'rehash', and 'reserve' and verify the capacity
+        //:   and value of the set.  (C-4)
+        //
+        // Testing:
+        //   void clear();
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   pair<iterator, bool> insert(const KEY& value);
+        //   void insert(INPUT_ITERATOR first, INPUT_ITERATOR last);
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numEntries);
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   pair<const_iterator, const_iterator> equal_range(key) const;
+        //   const_iterator find(const KEY& key) const;
+        //   const_iterator begin() const;
+        //   const_iterator cbegin() const;
+        //   const_iterator end() const;
+        //   const_iterator cend() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING MANIPULATORS AND ACCESSORS" << endl
+                          << "==================================" << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+
+        if (verbose) cout << "\nTesting against an oracle." << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+            bsl::set<int> exp;
+
+            unsigned int seed = 54321;
+            for (int i = 0; i < 20000; ++i) {
+                seed = seed * 1103515245u + 12345u;
+                const unsigned int r   = seed >> 8;
+                const int          key = static_cast<int>(r % 2000);
+
+                switch ((r >> 12) % 4) {
+                  case 0: {
+                    ASSERTV(i, exp.erase(key) == mX.erase(key));
+                  } break;
+                  case 1: {
+                    Obj::const_iterator it = X.find(key);
+                    if (it != X.end()) {
+                        mX.erase(it);
+                        exp.erase(key);
+                    }
+                  } break;
+                  default: {
+                    const bool isNew = exp.insert(key).second;
+
+                    bsl::pair<Obj::iterator, bool> result = mX.insert(key);
+                    ASSERTV(i, isNew == result.second);
+                    ASSERTV(i, key == *result.first);
+                  }
+                }
+            }
+
+            ASSERTV(exp.size(), X.size(), exp.size() == X.size());
+
+            bsl::size_t count = 0;
+            for (Obj::const_iterator it = X.cbegin(); it != X.cend(); ++it) {
+                ASSERTV(*it, exp.count(*it));
+                ++count;
+            }
+            ASSERT(exp.size() == count);
+
+            for (int key = -10; key < 2010; ++key) {
+                const bool HAS = 0 != exp.count(key);
+
+                ASSERTV(key, HAS == X.contains(key));
+                ASSERTV(key, HAS == (1 == X.count(key)));
+                ASSERTV(key, HAS == (X.find(key) != X.end()));
+
+                bsl::pair<Obj::const_iterator, Obj::const_iterator> r =
+                                                           X.equal_range(key);
+
+                ASSERTV(key, HAS == (r.first != r.second));
+                if (HAS) {
+                    ASSERTV(key, key == *r.first);
+                    ++r.first;
+                    ASSERTV(key, r.first == r.second);
+                }
+            }
+
+            // Erase the elements in a range.
+
+            Obj::const_iterator last = X.begin();
+            for (int i = 0; i < 20; ++i) {
+                exp.erase(*last);
+                ++last;
+            }
+            mX.erase(X.begin(), last);
+
+            ASSERTV(exp.size(), X.size(), exp.size() == X.size());
+            for (bsl::set<int>::const_iterator it = exp.begin();
+                 it != exp.end();
+                 ++it) {
+                ASSERTV(*it, X.contains(*it));
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'insert' of a range." << endl;
+        {
+            int values[100];
+            for (int i = 0; i < 100; ++i) {
+                values[i] = i % 50;
+            }
+
+            Obj mX(&ta);  const Obj& X = mX;
+            mX.insert(values, values + 100);
+
+            ASSERT(50 == X.size());
+            for (int i = 0; i < 50; ++i) {
+                ASSERTV(i, X.contains(i));
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'clear', 'rehash', and 'reserve'."
+                          << endl;
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            mX.reserve(100);
+            const bsl::size_t CAPACITY = X.capacity();
+            ASSERTV(CAPACITY, 100 <= CAPACITY * 7 / 8);
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+            }
+            ASSERT(CAPACITY == X.capacity());
+
+            mX.rehash(4 * CAPACITY);
+            ASSERT(4 * CAPACITY == X.capacity());
+            ASSERT(100 == X.size());
+            for (int i = 0; i < 100; ++i) {
+                ASSERTV(i, X.contains(i));
+            }
+
+            mX.clear();
+            ASSERT(X.empty());
+            ASSERT(4 * CAPACITY == X.capacity());
+
+            mX.rehash(0);
+            ASSERT(0 == X.capacity());
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 Each constructor creates an empty set having the requested
+        //:   capacity, hasher, key-equality functor, and allocator.
+        //:
+        //: 2 The default allocator is used if no allocator is supplied.
+        //:
+        //: 3 The set uses the supplied hasher and key-equality functor.
+        //
+        // Plan:
+        //: 1 Create sets with each constructor and verify the basic accessors.
+        //:   (C-1..2)
+        //:
+        //: 2 Create a set with a key-equality functor considering values
+        //:   having the same absolute value to be equal, and a hasher that is
+        //:   consistent with it, and verify that values are considered
+        //:   equivalent accordingly.  (C-3)
+        //
+        // Testing:
+        //   FlatHashSet();
+        //   explicit FlatHashSet(bslma::Allocator *basicAllocator);
+        //   explicit FlatHashSet(size_t capacity);
+        //   FlatHashSet(size_t capacity, bslma::Allocator *basicAllocator);
+        //   FlatHashSet(size_t capacity, const HASH& hash, Allocator *ba = 0);
+        //   FlatHashSet(size_t, const HASH&, const EQUAL&, Allocator *ba = 0);
+        //   FlatHashSet(INPUT_ITERATOR first, INPUT_ITERATOR last, ba = 0);
+        //   ~FlatHashSet();
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONSTRUCTORS AND BASIC ACCESSORS"
+                          << endl
+                          << "========================================"
+                          << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+
+        {
+            const Obj X;
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(X.empty());
+            ASSERT(0 == X.size());
+            ASSERT(0.0f == X.load_factor());
+            ASSERT(0.875f == X.max_load_factor());
+            ASSERT(X.begin() == X.end());
+        }
+        {
+            const Obj X(&ta);
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(0 == X.capacity());
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        {
+            const Obj X(100);
+
+            ASSERT(&defaultAllocator == X.allocator());
+            ASSERT(128 == X.capacity());
+        }
+        {
+            const Obj X(100, &ta);
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(128 == X.capacity());
+            ASSERT(0 != ta.numBlocksInUse());
+        }
+        {
+            typedef bdlc::FlatHashSet<int, ModHash> ModObj;
+
+            const ModObj X(10, ModHash(7), &ta);
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(16 == X.capacity());
+            ASSERT(3 == X.hash_function()(10));
+        }
+        {
+            typedef bdlc::FlatHashSet<int, ModHash, AbsoluteEqual> ModAbsObj;
+
+            ModAbsObj mX(0, ModHash(1), AbsoluteEqual(), &ta);
+            const ModAbsObj& X = mX;
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(X.key_eq()(-3, 3));
+
+            ASSERT( mX.insert(3).second);
+            ASSERT(!mX.insert(-3).second);
+
+            ASSERT(1 == X.size());
+            ASSERT(X.contains(-3));
+        }
+        {
+            const int VALUES[] = { 1, 2, 1, 3 };
+
+            const Obj X(VALUES, VALUES + 4, &ta);
+
+            ASSERT(&ta == X.allocator());
+            ASSERT(3 == X.size());
+            ASSERTV(X.load_factor(),
+                    static_cast<float>(3) /
+                          static_cast<float>(X.capacity()) == X.load_factor());
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a set, insert, find, and erase some elements, and verify
+        //:   the value of the set.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+
+        {
+            StringObj mX(&ta);  const StringObj& X = mX;
+
+            ASSERT( mX.insert("one").second);
+            ASSERT( mX.insert("two").second);
+            ASSERT(!mX.insert("one").second);
+
+            ASSERT(2 == X.size());
+            ASSERT(X.contains("two"));
+            ASSERT(X.find("three") == X.end());
+
+            ASSERT(1 == mX.erase("two"));
+            ASSERT(1 == X.size());
+            ASSERT(!X.contains("two"));
+        }
+
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1367 @@
+// bdlc_flathashtable.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE
+#define INCLUDED_BDLC_FLATHASHTABLE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an open-addressed hash table with SIMD group probing.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable: open-addressed hash table implementation
+//  bdlc::FlatHashTable_IteratorImp: iterator implementation
+//
+//@SEE_ALSO: bdlc_flathashmap, bdlc_flathashset
+//
+//@DESCRIPTION: This component provides a class template,
+// 'bdlc::FlatHashTable', implementing an open-addressed hash table that stores
+// its entries directly in a single array (i.e., "flat"), rather than in
+// individually allocated nodes linked into buckets as does
+// 'bslstl::HashTable'.  'bdlc::FlatHashTable' is the implementation of
+// 'bdlc::FlatHashMap' and 'bdlc::FlatHashSet', and is not meant to be used
+// directly.
+//
+// The table is parameterized by the type of its keys ('KEY'), the type of
+// its entries ('ENTRY'), a utility ('ENTRY_UTIL') that extracts the key from
+// an entry and creates an entry from a key, a hash functor ('HASH'), and an
+// equality functor ('EQUAL').  'ENTRY_UTIL' must provide the following
+// 'static' member functions:
+//..
+//  static const KEY& key(const ENTRY& entry);
+//      // Return a reference providing non-modifiable access to the key of
+//      // the specified 'entry'.
+//
+//  static void constructFromKey(ENTRY            *entry,
+//                               bslma::Allocator *allocator,
+//                               const KEY&        key);
+//      // Create, at the specified 'entry' address, an entry having the
+//      // specified 'key' (and a default value for any other part of the
+//      // entry), using the specified 'allocator' to supply memory.
+//..
+//
+///Structure
+///---------
+// The slots of the table are partitioned into groups of
+// 'bdlc::FlatHashTable_GroupControl::k_SIZE' consecutive slots.  In addition
+// to the array of entries, the table maintains a parallel array of one-byte
+// control values, one per slot, recording whether the slot is empty, holds an
+// entry that has been erased, or is in use, in which case the control value
+// holds seven bits of the hash value of the key of the entry in the slot.
+//
+// A hash value is split into two parts: the bits used to select the first
+// group to probe (after mixing, so that hash functors having poor
+// distribution in their high-order bits, such as the identity function, are
+// handled well), and the seven low-order bits stored in the control value.
+// A lookup examines the control values of an entire group at once (using SIMD
+// instructions where available, see 'bdlc_flathashtable_groupcontrol'), and
+// compares keys only for slots whose control value matches the seven stored
+// bits of the hash value of the key sought; a key is therefore rarely
+// compared with more than one non-matching key.  The probe continues to
+// subsequent groups (in a triangular sequence that visits every group) until
+// a group containing an empty slot is found.
+//
+// The number of slots (the capacity) is always either 0 or a power of two
+// not less than the group size, and the table is rehashed to a larger
+// capacity before the number of slots that are in use or erased would exceed
+// seven eighths of the capacity; hence, every probe sequence terminates.
+// Rehashing also discards erased slots.
+//
+///Iterator, Pointer, and Reference Invalidation
+///---------------------------------------------
+// Any operation that inserts an entry (and so may rehash the table)
+// invalidates all iterators, pointers, and references to entries of the
+// table.  Erasing an entry invalidates iterators, pointers, and references to
+// that entry only.
+//
+///Exception Safety
+///----------------
+// If an exception is thrown while inserting an entry, the table is unchanged.
+// If an exception is thrown while rehashing a table whose entries are not
+// bitwise movable, the table is unchanged; the entries of a table whose
+// entries are bitwise movable are relocated without the possibility of an
+// exception being thrown.
+//
+///Usage
+///-----
+// There is no usage example for this component since it is not meant for
+// direct client use; see 'bdlc_flathashmap' and 'bdlc_flathashset'.
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLB_BITUTIL
+#include <bdlb_bitutil.h>
+#endif
+
+#ifndef INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+#include <bdlc_flathashtable_groupcontrol.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SWAPUTIL
+#include <bslalg_swaputil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_CONSTRUCTIONUTIL
+#include <bslma_constructionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_EXCEPTIONUTIL
+#include <bsls_exceptionutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLSTL_FORWARDITERATOR
+#include <bslstl_forwarditerator.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDINT
+#include <bsl_cstdint.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                     // ===============================
+                     // class FlatHashTable_IteratorImp
+                     // ===============================
+
+template <class ENTRY>
+class FlatHashTable_IteratorImp {
+    // This class implements the requirements of 'bslstl::ForwardIterator'
+    // over the slots of a 'FlatHashTable' that are in use.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl::ControlByte ControlByte;
+
+    // DATA
+    ENTRY             *d_entry_p;           // current entry, or 0 at end
+
+    const ControlByte *d_control_p;         // control value of the current
+                                            // entry, or 0 at end
+
+    bsl::size_t        d_additionalLength;  // number of slots following the
+                                            // current slot
+
+  public:
+    // CREATORS
+    FlatHashTable_IteratorImp();
+        // Create an iterator implementation having the past-the-end value.
+
+    FlatHashTable_IteratorImp(ENTRY             *entry,
+                              const ControlByte *control,
+                              bsl::size_t        additionalLength);
+        // Create an iterator implementation referring to the specified
+        // 'entry', whose control value is at the specified 'control' address,
+        // and which is followed by the specified 'additionalLength' slots.
+        // The behavior is undefined unless '*control' describes a slot in
+        // use.
+
+    //! FlatHashTable_IteratorImp(
+    //!                   const FlatHashTable_IteratorImp& original) = default;
+    //! ~FlatHashTable_IteratorImp() = default;
+
+    // MANIPULATORS
+    //! FlatHashTable_IteratorImp& operator=(
+    //!                        const FlatHashTable_IteratorImp& rhs) = default;
+
+    void operator++();
+        // Advance this iterator implementation to the next slot in use, or
+        // to the past-the-end value if there is none.  The behavior is
+        // undefined if this iterator implementation has the past-the-end
+        // value.
+
+    // ACCESSORS
+    ENTRY& operator*() const;
+        // Return a reference to the entry referred to by this iterator
+        // implementation.  The behavior is undefined if this iterator
+        // implementation has the past-the-end value.
+
+    ENTRY *entry() const;
+        // Return the address of the entry referred to by this iterator
+        // implementation, or 0 if it has the past-the-end value.
+};
+
+// FREE OPERATORS
+template <class ENTRY>
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' iterator implementations
+    // refer to the same entry, or both have the past-the-end value, and
+    // 'false' otherwise.
+
+                            // ===================
+                            // class FlatHashTable
+                            // ===================
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+class FlatHashTable {
+    // This class template implements an open-addressed hash table of
+    // entries of the (template parameter) type 'ENTRY', with unique keys of
+    // the (template parameter) type 'KEY' obtained using the (template
+    // parameter) type 'ENTRY_UTIL', hashed using the (template parameter)
+    // type 'HASH', and compared using the (template parameter) type 'EQUAL'.
+    // See the component-level documentation for details.
+
+    // PRIVATE TYPES
+    typedef FlatHashTable_GroupControl              GroupControl;
+    typedef FlatHashTable_GroupControl::ControlByte ControlByte;
+
+    enum {
+        k_GROUP_SIZE = GroupControl::k_SIZE,
+
+        k_HASH_BITS  = 7,                       // bits of the hash value in a
+                                                // control value
+
+        k_HASH_MASK  = (1 << k_HASH_BITS) - 1
+    };
+
+  public:
+    // TYPES
+    typedef KEY                                               key_type;
+    typedef ENTRY                                             value_type;
+    typedef bsl::size_t                                       size_type;
+    typedef HASH                                              hasher;
+    typedef EQUAL                                             key_equal;
+
+    typedef FlatHashTable_IteratorImp<ENTRY>                  IteratorImp;
+    typedef bslstl::ForwardIterator<ENTRY, IteratorImp>       iterator;
+    typedef bslstl::ForwardIterator<const ENTRY, IteratorImp> const_iterator;
+
+  private:
+    // DATA
+    ENTRY            *d_entries_p;    // array of 'd_capacity' slots
+
+    ControlByte      *d_controls_p;   // array of 'd_capacity' control values
+
+    bsl::size_t       d_size;         // number of slots in use
+
+    bsl::size_t       d_capacity;     // number of slots (0 or a power of two
+                                      // at least 'k_GROUP_SIZE')
+
+    bsl::size_t       d_growthLeft;   // number of empty slots that may be
+                                      // used before the table is rehashed
+
+    int               d_groupShift;   // right shift applied to a mixed hash
+                                      // value to select the first group
+
+    HASH              d_hasher;       // hash functor
+
+    EQUAL             d_equal;        // key equality functor
+
+    bslma::Allocator *d_allocator_p;  // memory allocator (held, not owned)
+
+    // PRIVATE CLASS METHODS
+    static bsl::size_t capacityForSize(bsl::size_t numEntries);
+        // Return the minimum capacity of a table that can hold the specified
+        // 'numEntries' without exceeding its maximum load factor.
+
+    static bsl::size_t maxSizeForCapacity(bsl::size_t capacity);
+        // Return the maximum number of slots of a table having the specified
+        // 'capacity' that may be in use or erased.
+
+    static bsl::size_t mix(bsl::size_t hashValue);
+        // Return the specified 'hashValue' with its bits mixed such that each
+        // bit of 'hashValue' influences the high-order bits of the result.
+
+    // PRIVATE MANIPULATORS
+    void allocateSlots(bsl::size_t capacity);
+        // Allocate the slots and control values for a table having the
+        // specified 'capacity', marking every slot empty, and set the
+        // capacity-related attributes of this table accordingly.  The
+        // behavior is undefined unless this table has no slots and
+        // 'capacity' is 0 or a power of two at least 'k_GROUP_SIZE'.
+
+    void destroyEntriesAndDeallocate();
+        // Destroy the entries in use and deallocate the slots and control
+        // values of this table.
+
+    void eraseSlot(bsl::size_t index);
+        // Destroy the entry at the specified 'index', and mark its slot
+        // available.  The behavior is undefined unless the slot at 'index' is
+        // in use.
+
+    bsl::size_t prepareInsert(bsl::size_t hashValue);
+        // Return the index of an available slot in the probe sequence of the
+        // specified 'hashValue', rehashing this table first if no more empty
+        // slots may be used.  The slot is not marked in use.
+
+    void rehashRaw(bsl::size_t newCapacity);
+        // Relocate the entries of this table into newly allocated slots of
+        // the specified 'newCapacity'.  The behavior is undefined unless
+        // 'newCapacity' is a power of two at least 'k_GROUP_SIZE' and
+        // 'size() <= maxSizeForCapacity(newCapacity)'.
+
+    void setSlotInUse(bsl::size_t index, bsl::size_t hashValue);
+        // Mark the available slot at the specified 'index' in use by an entry
+        // whose key has the specified 'hashValue'.
+
+    // PRIVATE ACCESSORS
+    bsl::size_t findAvailable(bsl::size_t hashValue) const;
+        // Return the index of the first available slot in the probe sequence
+        // of the specified 'hashValue'.  The behavior is undefined unless
+        // this table has an available slot.
+
+    bsl::size_t findKey(const KEY& key, bsl::size_t hashValue) const;
+        // Return the index of the slot holding the entry having the specified
+        // 'key', whose hash value is the specified 'hashValue', or
+        // 'd_capacity' if there is no such entry.
+
+    iterator iteratorAt(bsl::size_t index) const;
+        // Return an iterator referring to the slot at the specified 'index',
+        // or the past-the-end iterator if 'index == d_capacity'.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(FlatHashTable, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    FlatHashTable(bsl::size_t       capacity,
+                  const HASH&       hash,
+                  const EQUAL&      equal,
+                  bslma::Allocator *basicAllocator = 0);
+        // Create an empty table able to hold at least the specified
+        // 'capacity' entries without rehashing, using the specified 'hash'
+        // and 'equal' functors.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.
+
+    FlatHashTable(const FlatHashTable&  original,
+                  bslma::Allocator     *basicAllocator = 0);
+        // Create a table having the same value, capacity, and functors as the
+        // specified 'original' table.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.
+
+    ~FlatHashTable();
+        // Destroy this object and each of its entries.
+
+    // MANIPULATORS
+    FlatHashTable& operator=(const FlatHashTable& rhs);
+        // Assign to this table the value and functors of the specified 'rhs'
+        // table, and return a reference providing modifiable access to this
+        // table.
+
+    void clear();
+        // Erase all entries from this table, retaining its capacity.
+
+    bsl::size_t erase(const KEY& key);
+        // Erase the entry having the specified 'key', if any, and return the
+        // number of entries erased (0 or 1).
+
+    iterator erase(const_iterator position);
+        // Erase the entry at the specified 'position', and return an iterator
+        // referring to the entry following it (or the past-the-end iterator).
+        // The behavior is undefined unless 'position' refers to an entry of
+        // this table.
+
+    iterator erase(const_iterator first, const_iterator last);
+        // Erase the entries in the range '[first, last)', and return 'last'.
+        // The behavior is undefined unless 'first' and 'last' are a valid
+        // range of iterators into this table.
+
+    iterator find(const KEY& key);
+        // Return an iterator referring to the entry having the specified
+        // 'key', or the past-the-end iterator if there is no such entry.
+
+    bsl::pair<iterator, bool> insert(const ENTRY& entry);
+        // Insert a copy of the specified 'entry' if this table has no entry
+        // with the same key.  Return a pair whose 'first' member refers to
+        // the entry in this table having that key, and whose 'second' member
+        // is 'true' if 'entry' was inserted and 'false' otherwise.
+
+    bsl::pair<iterator, bool> insertKey(const KEY& key);
+        // Insert an entry created from the specified 'key' using
+        // 'ENTRY_UTIL::constructFromKey' if this table has no entry with
+        // 'key'.  Return a pair whose 'first' member refers to the entry in
+        // this table having 'key', and whose 'second' member is 'true' if an
+        // entry was inserted and 'false' otherwise.
+
+    void rehash(bsl::size_t minimumCapacity);
+        // Change the capacity of this table to the smallest valid capacity
+        // that is at least the specified 'minimumCapacity' and able to hold
+        // 'size()' entries without exceeding the maximum load factor, and
+        // relocate the entries of this table accordingly.  If that capacity
+        // is 0, the slots of this table are deallocated.
+
+    void reserve(bsl::size_t numEntries);
+        // Ensure that this table can hold at least the specified
+        // 'numEntries' entries without rehashing.
+
+    iterator begin();
+        // Return an iterator referring to the first entry of this table, or
+        // the past-the-end iterator if this table is empty.
+
+    iterator end();
+        // Return the past-the-end iterator for this table.
+
+    void swap(FlatHashTable& other);
+        // Exchange the value and functors of this table with those of the
+        // specified 'other' table.  The behavior is undefined unless this
+        // table and 'other' use the same allocator.
+
+    // ACCESSORS
+    bsl::size_t capacity() const;
+        // Return the number of slots of this table.
+
+    bool contains(const KEY& key) const;
+        // Return 'true' if this table has an entry having the specified
+        // 'key', and 'false' otherwise.
+
+    bsl::size_t count(const KEY& key) const;
+        // Return the number of entries having the specified 'key' (0 or 1).
+
+    bool empty() const;
+        // Return 'true' if this table has no entries, and 'false' otherwise.
+
+    const_iterator find(const KEY& key) const;
+        // Return an iterator referring to the entry having the specified
+        // 'key', or the past-the-end iterator if there is no such entry.
+
+    HASH hash_function() const;
+        // Return (a copy of) the hash functor of this table.
+
+    EQUAL key_eq() const;
+        // Return (a copy of) the key equality functor of this table.
+
+    float load_factor() const;
+        // Return the ratio of 'size()' to 'capacity()', or 0 if this table
+        // has no slots.
+
+    float max_load_factor() const;
+        // Return the maximum ratio of used (or erased) slots to 'capacity()'
+        // before this table is rehashed.
+
+    bsl::size_t size() const;
+        // Return the number of entries of this table.
+
+    const_iterator begin() const;
+        // Return an iterator referring to the first entry of this table, or
+        // the past-the-end iterator if this table is empty.
+
+    const_iterator end() const;
+        // Return the past-the-end iterator for this table.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this table to supply memory.
+};
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator==(
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables have the same
+    // value, and 'false' otherwise.  Two tables have the same value if they
+    // have the same number of entries, and for each entry of 'lhs' there is
+    // an entry of 'rhs' having the same key that compares equal to it.
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool operator!=(
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+              const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' tables do not have the
+    // same value, and 'false' otherwise.
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                     // -------------------------------
+                     // class FlatHashTable_IteratorImp
+                     // -------------------------------
+
+// CREATORS
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp()
+: d_entry_p(0)
+, d_control_p(0)
+, d_additionalLength(0)
+{
+}
+
+template <class ENTRY>
+inline
+FlatHashTable_IteratorImp<ENTRY>::FlatHashTable_IteratorImp(
+                                          ENTRY             *entry,
+                                          const ControlByte *control,
+                                          bsl::size_t        additionalLength)
+: d_entry_p(entry)
+, d_control_p(control)
+, d_additionalLength(additionalLength)
+{
+    BSLS_ASSERT_SAFE(entry);
+    BSLS_ASSERT_SAFE(control);
+    BSLS_ASSERT_SAFE(0 == (*control & FlatHashTable_GroupControl::k_EMPTY));
+}
+
+// MANIPULATORS
+template <class ENTRY>
+inline
+void FlatHashTable_IteratorImp<ENTRY>::operator++()
+{
+    BSLS_ASSERT_SAFE(d_entry_p);
+
+    while (d_additionalLength) {
+        --d_additionalLength;
+        ++d_entry_p;
+        ++d_control_p;
+
+        // The high-order bit of the control value is set for both empty and
+        // erased slots.
+
+        if (0 == (*d_control_p & FlatHashTable_GroupControl::k_EMPTY)) {
+            return;                                                   // RETURN
+        }
+    }
+
+    d_entry_p   = 0;
+    d_control_p = 0;
+}
+
+// ACCESSORS
+template <class ENTRY>
+inline
+ENTRY& FlatHashTable_IteratorImp<ENTRY>::operator*() const
+{
+    BSLS_ASSERT_SAFE(d_entry_p);
+
+    return *d_entry_p;
+}
+
+template <class ENTRY>
+inline
+ENTRY *FlatHashTable_IteratorImp<ENTRY>::entry() const
+{
+    return d_entry_p;
+}
+
+// FREE OPERATORS
+template <class ENTRY>
+inline
+bool operator==(const FlatHashTable_IteratorImp<ENTRY>& lhs,
+                const FlatHashTable_IteratorImp<ENTRY>& rhs)
+{
+    return lhs.entry() == rhs.entry();
+}
+
+                            // -------------------
+                            // class FlatHashTable
+                            // -------------------
+
+// PRIVATE CLASS METHODS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacityForSize(
+                                                        bsl::size_t numEntries)
+{
+    if (0 == numEntries) {
+        return 0;                                                     // RETURN
+    }
+
+    bsl::size_t capacity = k_GROUP_SIZE;
+    while (maxSizeForCapacity(capacity) < numEntries) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::maxSizeForCapacity(
+                                                          bsl::size_t capacity)
+{
+    return capacity - capacity / 8;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::mix(
+                                                         bsl::size_t hashValue)
+{
+    // Multiplication by (the odd integer closest to) 2^N divided by the
+    // golden ratio ("Fibonacci hashing") propagates every bit of 'hashValue'
+    // into the high-order bits of the product.
+
+#ifdef BSLS_PLATFORM_CPU_64_BIT
+    return hashValue * 0x9E3779B97F4A7C15ULL;
+#else
+    return hashValue * 0x9E3779B9U;
+#endif
+}
+
+// PRIVATE MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocateSlots(
+                                                          bsl::size_t capacity)
+{
+    BSLS_ASSERT(!d_entries_p);
+    BSLS_ASSERT(!d_controls_p);
+    BSLS_ASSERT(0 == capacity
+             || (k_GROUP_SIZE <= capacity
+              && 0 == (capacity & (capacity - 1))));
+
+    if (capacity) {
+        ControlByte *controls = static_cast<ControlByte *>(
+                                         d_allocator_p->allocate(capacity));
+
+        bslma::DeallocatorProctor<bslma::Allocator> proctor(controls,
+                                                            d_allocator_p);
+
+        d_entries_p  = static_cast<ENTRY *>(
+                            d_allocator_p->allocate(capacity * sizeof(ENTRY)));
+        d_controls_p = controls;
+        proctor.release();
+
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, capacity);
+    }
+
+    const int numBits = static_cast<int>(sizeof(bsl::size_t)) * 8;
+    const int log2NumGroups = capacity
+                            ? bdlb::BitUtil::log2(
+                                    static_cast<bsl::uint64_t>(capacity
+                                                             / k_GROUP_SIZE))
+                            : 0;
+
+    d_capacity   = capacity;
+    d_growthLeft = maxSizeForCapacity(capacity) - d_size;
+
+    // A shift by the full width of 'bsl::size_t' is undefined; the group
+    // index is also masked, so a shift by one bit fewer is equivalent for a
+    // table having a single group.
+
+    d_groupShift = log2NumGroups ? numBits - log2NumGroups : numBits - 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                 destroyEntriesAndDeallocate()
+{
+    if (!d_controls_p) {
+        return;                                                       // RETURN
+    }
+
+    for (bsl::size_t i = 0; d_size && i < d_capacity; ++i) {
+        if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+            bslalg::ScalarDestructionPrimitives::destroy(d_entries_p + i);
+        }
+    }
+
+    d_allocator_p->deallocate(d_entries_p);
+    d_allocator_p->deallocate(d_controls_p);
+
+    d_entries_p  = 0;
+    d_controls_p = 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::eraseSlot(
+                                                             bsl::size_t index)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(0 == (d_controls_p[index] & GroupControl::k_EMPTY));
+
+    bslalg::ScalarDestructionPrimitives::destroy(d_entries_p + index);
+
+    // Probing for any key stops at the first group containing an empty slot,
+    // so if the group of 'index' contains an empty slot, no probe sequence
+    // continues past this group, and the slot can be marked empty (and so
+    // reused without rehashing); otherwise, it must be marked erased.
+
+    const bsl::size_t groupIndex = index & ~bsl::size_t(k_GROUP_SIZE - 1);
+
+    if (GroupControl(d_controls_p + groupIndex).containsEmpty()) {
+        d_controls_p[index] = GroupControl::k_EMPTY;
+        ++d_growthLeft;
+    }
+    else {
+        d_controls_p[index] = GroupControl::k_ERASED;
+    }
+    --d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::prepareInsert(
+                                                         bsl::size_t hashValue)
+{
+    bsl::size_t index = d_capacity ? findAvailable(hashValue) : 0;
+
+    // An erased slot may be reused without consuming growth.
+
+    if (0 == d_capacity
+     || (0 == d_growthLeft
+      && GroupControl::k_ERASED != d_controls_p[index])) {
+        // If at least half of the slots that may be used are erased,
+        // rehashing to the same capacity (which discards the erased slots)
+        // suffices; otherwise, the capacity is doubled.
+
+        if (0 == d_capacity) {
+            rehashRaw(k_GROUP_SIZE);
+        }
+        else if (d_size * 2 <= maxSizeForCapacity(d_capacity)) {
+            rehashRaw(d_capacity);
+        }
+        else {
+            rehashRaw(d_capacity * 2);
+        }
+        index = findAvailable(hashValue);
+    }
+
+    return index;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehashRaw(
+                                                       bsl::size_t newCapacity)
+{
+    BSLS_ASSERT(k_GROUP_SIZE <= newCapacity);
+    BSLS_ASSERT(0 == (newCapacity & (newCapacity - 1)));
+    BSLS_ASSERT(d_size <= maxSizeForCapacity(newCapacity));
+
+    FlatHashTable other(0, d_hasher, d_equal, d_allocator_p);
+    other.allocateSlots(newCapacity);
+
+    if (bslmf::IsBitwiseMoveable<ENTRY>::value) {
+        // Relocate the entries without the possibility of an exception.  Note
+        // that hashing a key does not modify this table.
+
+        for (bsl::size_t i = 0; i < d_capacity; ++i) {
+            if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+                const bsl::size_t hashValue =
+                                    d_hasher(ENTRY_UTIL::key(d_entries_p[i]));
+                const bsl::size_t index = other.findAvailable(hashValue);
+
+                bsl::memcpy(static_cast<void *>(other.d_entries_p + index),
+                            static_cast<const void *>(d_entries_p + i),
+                            sizeof(ENTRY));
+                other.setSlotInUse(index, hashValue);
+                d_controls_p[i] = GroupControl::k_EMPTY;
+            }
+        }
+        d_size = 0;
+    }
+    else {
+        // Copy the entries into 'other', which destroys them should an
+        // exception be thrown, leaving this table unchanged.
+
+        for (bsl::size_t i = 0; i < d_capacity; ++i) {
+            if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+                const bsl::size_t hashValue =
+                                    d_hasher(ENTRY_UTIL::key(d_entries_p[i]));
+                const bsl::size_t index = other.findAvailable(hashValue);
+
+                bslma::ConstructionUtil::construct(other.d_entries_p + index,
+                                                   d_allocator_p,
+                                                   d_entries_p[i]);
+                other.setSlotInUse(index, hashValue);
+            }
+        }
+    }
+
+    // Exchange the slots, leaving this table's former slots (and any entries
+    // remaining in them) to be destroyed by 'other'.
+
+    bslalg::SwapUtil::swap(&d_entries_p,  &other.d_entries_p);
+    bslalg::SwapUtil::swap(&d_controls_p, &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_size,       &other.d_size);
+    bslalg::SwapUtil::swap(&d_capacity,   &other.d_capacity);
+    bslalg::SwapUtil::swap(&d_growthLeft, &other.d_growthLeft);
+    bslalg::SwapUtil::swap(&d_groupShift, &other.d_groupShift);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::setSlotInUse(
+                                                     bsl::size_t index,
+                                                     bsl::size_t hashValue)
+{
+    BSLS_ASSERT_SAFE(index < d_capacity);
+    BSLS_ASSERT_SAFE(d_controls_p[index] & GroupControl::k_EMPTY);
+
+    if (GroupControl::k_EMPTY == d_controls_p[index]) {
+        BSLS_ASSERT_SAFE(d_growthLeft);
+
+        --d_growthLeft;
+    }
+    d_controls_p[index] = static_cast<ControlByte>(hashValue & k_HASH_MASK);
+    ++d_size;
+}
+
+// PRIVATE ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findAvailable(
+                                                   bsl::size_t hashValue) const
+{
+    BSLS_ASSERT_SAFE(d_capacity);
+
+    const bsl::size_t groupMask = d_capacity / k_GROUP_SIZE - 1;
+    bsl::size_t       group     = (mix(hashValue) >> d_groupShift) & groupMask;
+
+    for (bsl::size_t step = 1; ; ++step) {
+        const bsl::size_t   base      = group * k_GROUP_SIZE;
+        const bsl::uint32_t available =
+                               GroupControl(d_controls_p + base).available();
+
+        if (available) {
+            return base + bdlb::BitUtil::numTrailingUnsetBits(available);
+                                                                      // RETURN
+        }
+
+        BSLS_ASSERT_SAFE(step <= groupMask);
+
+        group = (group + step) & groupMask;
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::findKey(
+                                                  const KEY&  key,
+                                                  bsl::size_t hashValue) const
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == d_capacity)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    const ControlByte hashBits  =
+                          static_cast<ControlByte>(hashValue & k_HASH_MASK);
+    const bsl::size_t groupMask = d_capacity / k_GROUP_SIZE - 1;
+    bsl::size_t       group     = (mix(hashValue) >> d_groupShift) & groupMask;
+
+    for (bsl::size_t step = 1; step <= groupMask + 1; ++step) {
+        const bsl::size_t base = group * k_GROUP_SIZE;
+        const GroupControl groupControl(d_controls_p + base);
+
+        bsl::uint32_t candidates = groupControl.match(hashBits);
+        while (candidates) {
+            const bsl::size_t index =
+                        base + bdlb::BitUtil::numTrailingUnsetBits(candidates);
+
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                            d_equal(ENTRY_UTIL::key(d_entries_p[index]),
+                                    key))) {
+                return index;                                         // RETURN
+            }
+            candidates &= candidates - 1;
+        }
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                              groupControl.containsEmpty())) {
+            return d_capacity;                                        // RETURN
+        }
+
+        group = (group + step) & groupMask;
+    }
+
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iteratorAt(
+                                                       bsl::size_t index) const
+{
+    if (index == d_capacity) {
+        return iterator();                                            // RETURN
+    }
+    return iterator(IteratorImp(d_entries_p + index,
+                                d_controls_p + index,
+                                d_capacity - index - 1));
+}
+
+// CREATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                            bsl::size_t       capacity,
+                                            const HASH&       hash,
+                                            const EQUAL&      equal,
+                                            bslma::Allocator *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_growthLeft(0)
+, d_groupShift(0)
+, d_hasher(hash)
+, d_equal(equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    allocateSlots(capacityForSize(capacity));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::FlatHashTable(
+                                        const FlatHashTable&  original,
+                                        bslma::Allocator     *basicAllocator)
+: d_entries_p(0)
+, d_controls_p(0)
+, d_size(0)
+, d_capacity(0)
+, d_growthLeft(0)
+, d_groupShift(0)
+, d_hasher(original.d_hasher)
+, d_equal(original.d_equal)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    allocateSlots(original.d_capacity);
+
+    // Copy each entry into the same slot as in 'original'; should an
+    // exception be thrown, the destructor of this object (which has been
+    // constructed) is not invoked, so this object cleans up explicitly.
+
+    BSLS_TRY {
+        for (bsl::size_t i = 0; i < d_capacity; ++i) {
+            const ControlByte control = original.d_controls_p[i];
+
+            if (0 == (control & GroupControl::k_EMPTY)) {
+                bslma::ConstructionUtil::construct(d_entries_p + i,
+                                                   d_allocator_p,
+                                                   original.d_entries_p[i]);
+                ++d_size;
+            }
+            d_controls_p[i] = control;
+        }
+    }
+    BSLS_CATCH(...) {
+        destroyEntriesAndDeallocate();
+        BSLS_RETHROW;
+    }
+
+    d_growthLeft = original.d_growthLeft;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::~FlatHashTable()
+{
+    destroyEntriesAndDeallocate();
+}
+
+// MANIPULATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>&
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::operator=(
+                                                      const FlatHashTable& rhs)
+{
+    if (this != &rhs) {
+        FlatHashTable other(rhs, d_allocator_p);
+        swap(other);
+    }
+    return *this;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::clear()
+{
+    if (d_size) {
+        for (bsl::size_t i = 0; i < d_capacity; ++i) {
+            if (0 == (d_controls_p[i] & GroupControl::k_EMPTY)) {
+                bslalg::ScalarDestructionPrimitives::destroy(d_entries_p + i);
+            }
+        }
+    }
+
+    if (d_capacity) {
+        bsl::memset(d_controls_p, GroupControl::k_EMPTY, d_capacity);
+    }
+    d_size       = 0;
+    d_growthLeft = maxSizeForCapacity(d_capacity);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                                const KEY& key)
+{
+    const bsl::size_t index = findKey(key, d_hasher(key));
+
+    if (index == d_capacity) {
+        return 0;                                                     // RETURN
+    }
+
+    eraseSlot(index);
+    return 1;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                       const_iterator position)
+{
+    BSLS_ASSERT_SAFE(position != end());
+
+    IteratorImp imp = position.imp();
+    ++imp;
+
+    eraseSlot(position.imp().entry() - d_entries_p);
+
+    return iterator(imp);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::erase(
+                                                          const_iterator first,
+                                                          const_iterator last)
+{
+    while (first != last) {
+        first = erase(first);
+    }
+    return iterator(last.imp());
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key)
+{
+    return iteratorAt(findKey(key, d_hasher(key)));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+       typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+       bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insert(const ENTRY& entry)
+{
+    const KEY&        key       = ENTRY_UTIL::key(entry);
+    const bsl::size_t hashValue = d_hasher(key);
+    bsl::size_t       index     = findKey(key, hashValue);
+
+    if (index != d_capacity) {
+        return bsl::pair<iterator, bool>(iteratorAt(index), false);   // RETURN
+    }
+
+    // Note that 'entry' may refer to an entry of this table only if it was
+    // found above.
+
+    index = prepareInsert(hashValue);
+
+    bslma::ConstructionUtil::construct(d_entries_p + index,
+                                       d_allocator_p,
+                                       entry);
+    setSlotInUse(index, hashValue);
+
+    return bsl::pair<iterator, bool>(iteratorAt(index), true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bsl::pair<
+       typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator,
+       bool>
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::insertKey(const KEY& key)
+{
+    const bsl::size_t hashValue = d_hasher(key);
+    bsl::size_t       index     = findKey(key, hashValue);
+
+    if (index != d_capacity) {
+        return bsl::pair<iterator, bool>(iteratorAt(index), false);   // RETURN
+    }
+
+    index = prepareInsert(hashValue);
+
+    ENTRY_UTIL::constructFromKey(d_entries_p + index, d_allocator_p, key);
+    setSlotInUse(index, hashValue);
+
+    return bsl::pair<iterator, bool>(iteratorAt(index), true);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::rehash(
+                                                   bsl::size_t minimumCapacity)
+{
+    bsl::size_t newCapacity = capacityForSize(d_size);
+
+    if (minimumCapacity > newCapacity) {
+        newCapacity = bdlb::BitUtil::roundUpToBinaryPower(
+                                 static_cast<bsl::uint64_t>(minimumCapacity));
+        if (newCapacity < k_GROUP_SIZE) {
+            newCapacity = k_GROUP_SIZE;
+        }
+    }
+
+    if (newCapacity) {
+        rehashRaw(newCapacity);
+    }
+    else {
+        destroyEntriesAndDeallocate();
+        allocateSlots(0);
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::reserve(
+                                                        bsl::size_t numEntries)
+{
+    // Erased slots count against growth, so compare against the slots that
+    // may still be used.
+
+    if (numEntries > d_size + d_growthLeft) {
+        rehashRaw(capacityForSize(numEntries));
+    }
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin()
+{
+    if (0 == d_size) {
+        return iterator();                                            // RETURN
+    }
+
+    bsl::size_t index = 0;
+    while (d_controls_p[index] & GroupControl::k_EMPTY) {
+        ++index;
+    }
+    return iteratorAt(index);
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end()
+{
+    return iterator();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+void FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::swap(
+                                                          FlatHashTable& other)
+{
+    BSLS_ASSERT(d_allocator_p == other.d_allocator_p);
+
+    bslalg::SwapUtil::swap(&d_entries_p,  &other.d_entries_p);
+    bslalg::SwapUtil::swap(&d_controls_p, &other.d_controls_p);
+    bslalg::SwapUtil::swap(&d_size,       &other.d_size);
+    bslalg::SwapUtil::swap(&d_capacity,   &other.d_capacity);
+    bslalg::SwapUtil::swap(&d_growthLeft, &other.d_growthLeft);
+    bslalg::SwapUtil::swap(&d_groupShift, &other.d_groupShift);
+    bslalg::SwapUtil::swap(&d_hasher,     &other.d_hasher);
+    bslalg::SwapUtil::swap(&d_equal,      &other.d_equal);
+}
+
+// ACCESSORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::capacity()
+                                                                          const
+{
+    return d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::contains(
+                                                          const KEY& key) const
+{
+    return findKey(key, d_hasher(key)) != d_capacity;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::count(
+                                                          const KEY& key) const
+{
+    return contains(key) ? 1 : 0;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::empty() const
+{
+    return 0 == d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::find(const KEY& key) const
+{
+    return iteratorAt(findKey(key, d_hasher(key)));
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+HASH FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::hash_function() const
+{
+    return d_hasher;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+EQUAL FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::key_eq() const
+{
+    return d_equal;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::load_factor() const
+{
+    return d_capacity
+           ? static_cast<float>(d_size) / static_cast<float>(d_capacity)
+           : 0.0f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+float FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::max_load_factor()
+                                                                          const
+{
+    return 0.875f;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bsl::size_t FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::size() const
+{
+    return d_size;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::begin() const
+{
+    return const_cast<FlatHashTable *>(this)->begin();
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::const_iterator
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::end() const
+{
+    return const_iterator();
+}
+
+                                  // Aspects
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bslma::Allocator *
+FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::allocator() const
+{
+    return d_allocator_p;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+bool bdlc::operator==(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    typedef typename FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>::
+                                                  const_iterator ConstIterator;
+
+    if (lhs.size() != rhs.size()) {
+        return false;                                                 // RETURN
+    }
+
+    for (ConstIterator it = lhs.begin(); it != lhs.end(); ++it) {
+        ConstIterator match = rhs.find(ENTRY_UTIL::key(*it));
+
+        if (match == rhs.end() || !(*match == *it)) {
+            return false;                                             // RETURN
+        }
+    }
+    return true;
+}
+
+template <class KEY, class ENTRY, class ENTRY_UTIL, class HASH, class EQUAL>
+inline
+bool bdlc::operator!=(
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& lhs,
+               const FlatHashTable<KEY, ENTRY, ENTRY_UTIL, HASH, EQUAL>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
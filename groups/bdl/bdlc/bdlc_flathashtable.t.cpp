@@ -0,0 +1,1292 @@
+// bdlc_flathashtable.t.cpp                                           -*-C++-*-
+#include <bdlc_flathashtable.h>
+
+#include <bslim_testutil.h>
+
+#include <bslh_hash.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_testallocatormonitor.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstddef.h>
+#include <bsl_cstdlib.h>
+#include <bsl_functional.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// The component under test is an open-addressed hash table whose behavior
+// (aside from capacity management) is observable only through its container
+// interface.  The primary manipulators are 'insert' and 'erase', and the
+// basic accessors are 'find', 'size', and iteration.  Since the probing logic
+// is sensitive to the distribution of hash values, the manipulators are
+// tested with a well-distributed hasher ('bslh::Hash<>'), with the identity
+// function, and with a hasher returning a constant (so that every key
+// collides, and every probe sequence visits every group), against a
+// 'bsl::set' oracle over long sequences of generated operations.  Relocation
+// of entries is tested both for bitwise movable entries ('int') and for an
+// allocating entry type that is not bitwise movable ('AllocInt').
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashTable(size_t capacity, hash, equal, Allocator *ba = 0);
+// [ 6] FlatHashTable(const FlatHashTable& original, Allocator *ba = 0);
+// [ 2] ~FlatHashTable();
+//
+// MANIPULATORS
+// [ 6] FlatHashTable& operator=(const FlatHashTable& rhs);
+// [ 4] void clear();
+// [ 4] size_t erase(const KEY& key);
+// [ 4] iterator erase(const_iterator position);
+// [ 4] iterator erase(const_iterator first, const_iterator last);
+// [ 3] iterator find(const KEY& key);
+// [ 3] pair<iterator, bool> insert(const ENTRY& entry);
+// [ 3] pair<iterator, bool> insertKey(const KEY& key);
+// [ 5] void rehash(size_t minimumCapacity);
+// [ 5] void reserve(size_t numEntries);
+// [ 3] iterator begin();
+// [ 3] iterator end();
+// [ 6] void swap(FlatHashTable& other);
+//
+// ACCESSORS
+// [ 2] size_t capacity() const;
+// [ 3] bool contains(const KEY& key) const;
+// [ 3] size_t count(const KEY& key) const;
+// [ 2] bool empty() const;
+// [ 3] const_iterator find(const KEY& key) const;
+// [ 2] HASH hash_function() const;
+// [ 2] EQUAL key_eq() const;
+// [ 2] float load_factor() const;
+// [ 2] float max_load_factor() const;
+// [ 2] size_t size() const;
+// [ 3] const_iterator begin() const;
+// [ 3] const_iterator end() const;
+// [ 2] bslma::Allocator *allocator() const;
+//
+// FREE OPERATORS
+// [ 6] bool operator==(const FlatHashTable& lhs, const FlatHashTable& rhs);
+// [ 6] bool operator!=(const FlatHashTable& lhs, const FlatHashTable& rhs);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] EXCEPTION SAFETY
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                      GLOBAL HELPER CLASSES FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                            // ===================
+                            // struct IdentityUtil
+                            // ===================
+
+template <class ENTRY>
+struct IdentityUtil {
+    // This 'struct' provides the 'ENTRY_UTIL' requirements for an entry that
+    // is its own key.
+
+    static void constructFromKey(ENTRY            *entry,
+                                 bslma::Allocator *allocator,
+                                 const ENTRY&      key)
+    {
+        bslma::ConstructionUtil::construct(entry, allocator, key);
+    }
+
+    static const ENTRY& key(const ENTRY& entry)
+    {
+        return entry;
+    }
+};
+
+                              // ==============
+                              // class AllocInt
+                              // ==============
+
+class AllocInt {
+    // This class holds an 'int' key and a copy of that key in memory supplied
+    // by an allocator, and is not bitwise movable.
+
+    // DATA
+    int               d_key;
+    int              *d_copy_p;
+    AllocInt         *d_self_p;       // address of this object, verified on
+                                      // each access
+    bslma::Allocator *d_allocator_p;
+
+  private:
+    // NOT IMPLEMENTED
+    AllocInt& operator=(const AllocInt&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(AllocInt, bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit AllocInt(int key, bslma::Allocator *basicAllocator = 0)
+    : d_key(key)
+    , d_copy_p(0)
+    , d_self_p(this)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        d_copy_p  = static_cast<int *>(d_allocator_p->allocate(sizeof(int)));
+        *d_copy_p = key;
+    }
+
+    AllocInt(const AllocInt& original, bslma::Allocator *basicAllocator = 0)
+    : d_key(original.key())
+    , d_copy_p(0)
+    , d_self_p(this)
+    , d_allocator_p(bslma::Default::allocator(basicAllocator))
+    {
+        d_copy_p  = static_cast<int *>(d_allocator_p->allocate(sizeof(int)));
+        *d_copy_p = d_key;
+    }
+
+    ~AllocInt()
+    {
+        ASSERT(this == d_self_p);
+        d_allocator_p->deallocate(d_copy_p);
+    }
+
+    // ACCESSORS
+    const int& key() const
+    {
+        ASSERT(this == d_self_p);
+        ASSERT(*d_copy_p == d_key);
+        return d_key;
+    }
+};
+
+bool operator==(const AllocInt& lhs, const AllocInt& rhs)
+{
+    return lhs.key() == rhs.key();
+}
+
+                            // ===================
+                            // struct AllocIntUtil
+                            // ===================
+
+struct AllocIntUtil {
+    // This 'struct' provides the 'ENTRY_UTIL' requirements for 'AllocInt'.
+
+    static void constructFromKey(AllocInt         *entry,
+                                 bslma::Allocator *allocator,
+                                 const int&        key)
+    {
+        new (entry) AllocInt(key, allocator);
+    }
+
+    static const int& key(const AllocInt& entry)
+    {
+        return entry.key();
+    }
+};
+
+                             // ==================
+                             // struct ConstantHash
+                             // ==================
+
+struct ConstantHash {
+    // This hasher returns the same value for every key.
+
+    bsl::size_t operator()(int) const
+    {
+        return 0x2A;
+    }
+};
+
+                             // ==================
+                             // struct IdentityHash
+                             // ==================
+
+struct IdentityHash {
+    // This hasher returns its argument.
+
+    bsl::size_t operator()(int key) const
+    {
+        return static_cast<bsl::size_t>(key);
+    }
+};
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IdentityUtil<int>,
+                            bslh::Hash<>,
+                            bsl::equal_to<int> > Obj;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IdentityUtil<int>,
+                            IdentityHash,
+                            bsl::equal_to<int> > IdentityObj;
+
+typedef bdlc::FlatHashTable<int,
+                            int,
+                            IdentityUtil<int>,
+                            ConstantHash,
+                            bsl::equal_to<int> > ConstantObj;
+
+typedef bdlc::FlatHashTable<int,
+                            AllocInt,
+                            AllocIntUtil,
+                            bslh::Hash<>,
+                            bsl::equal_to<int> > AllocObj;
+
+typedef bdlc::FlatHashTable<int,
+                            AllocInt,
+                            AllocIntUtil,
+                            ConstantHash,
+                            bsl::equal_to<int> > ConstantAllocObj;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static unsigned int nextRandom(unsigned int *seed)
+    // Return the next pseudo-random value of the sequence specified by
+    // 'seed', and update 'seed'.
+{
+    *seed = *seed * 1103515245u + 12345u;
+    return (*seed >> 8) & 0xFFFFFF;
+}
+
+template <class TABLE>
+static void verifyTable(int line, const TABLE& table, const bsl::set<int>& exp)
+    // Verify, reporting failures as occurring on the specified 'line', that
+    // the specified 'table' contains exactly the keys in the specified 'exp',
+    // and that iteration visits each entry exactly once.
+{
+    typedef typename TABLE::const_iterator Iterator;
+
+    ASSERTV(line, exp.size(), table.size(), exp.size() == table.size());
+    ASSERTV(line, exp.empty() == table.empty());
+
+    bsl::size_t count = 0;
+    bsl::set<int> seen;
+    for (Iterator it = table.begin(); it != table.end(); ++it) {
+        const int key = IdentityUtil<int>::key(*it);
+
+        ASSERTV(line, key, seen.insert(key).second);
+        ASSERTV(line, key, exp.count(key));
+        ++count;
+    }
+    ASSERTV(line, count, exp.size() == count);
+
+    for (bsl::set<int>::const_iterator it = exp.begin();
+         it != exp.end();
+         ++it) {
+        ASSERTV(line, *it, table.contains(*it));
+        ASSERTV(line, *it, 1 == table.count(*it));
+
+        Iterator found = table.find(*it);
+        ASSERTV(line, *it, found != table.end() && *found == *it);
+    }
+
+    ASSERTV(line, table.capacity(), table.size() <= table.capacity());
+}
+
+template <class TABLE>
+static void testRandomOperations(int          line,
+                                 int          keyRange,
+                                 int          numOperations,
+                                 unsigned int seed,
+                                 bool         veryVerbose)
+    // Perform the specified 'numOperations' inserts and erases, chosen
+    // pseudo-randomly from the specified 'seed', of keys in the range
+    // '[0 .. keyRange)' on a table of the (template parameter) type 'TABLE',
+    // verifying the table against a 'bsl::set' oracle, and reporting failures
+    // as occurring on the specified 'line'.
+{
+    bslma::TestAllocator ta("table", veryVerbose);
+
+    {
+        TABLE         mX(0,
+                         typename TABLE::hasher(),
+                         typename TABLE::key_equal(),
+                         &ta);
+        const TABLE&  X = mX;
+        bsl::set<int> exp;
+
+        for (int i = 0; i < numOperations; ++i) {
+            const unsigned int r   = nextRandom(&seed);
+            const int          key = static_cast<int>(r % keyRange);
+
+            switch ((r >> 16) % 4) {
+              case 0: {
+                // Erase by key.
+
+                ASSERTV(line, i, exp.erase(key) == mX.erase(key));
+              } break;
+              case 1: {
+                // Erase by iterator.
+
+                typename TABLE::iterator it = mX.find(key);
+                if (it != mX.end()) {
+                    mX.erase(it);
+                    exp.erase(key);
+                }
+              } break;
+              default: {
+                const bool isNew = exp.insert(key).second;
+
+                bsl::pair<typename TABLE::iterator, bool> result =
+                                                          (r & 1)
+                                                          ? mX.insert(key)
+                                                          : mX.insertKey(key);
+
+                ASSERTV(line, i, key, isNew == result.second);
+                ASSERTV(line, i, key, key == *result.first);
+              }
+            }
+
+            if (0 == i % 97) {
+                verifyTable(line, X, exp);
+            }
+        }
+
+        verifyTable(line, X, exp);
+
+        // Erase everything and verify that the table is reusable.
+
+        mX.erase(X.begin(), X.end());
+        exp.clear();
+        verifyTable(line, X, exp);
+
+        for (int i = 0; i < keyRange; ++i) {
+            mX.insert(i);
+            exp.insert(i);
+        }
+        verifyTable(line, X, exp);
+    }
+
+    ASSERTV(line, 0 == ta.numBlocksInUse());
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test            = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose         = argc > 2;
+    bool veryVerbose     = argc > 3;
+    bool veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 7: {
+        // --------------------------------------------------------------------
+        // EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 If an allocation fails while inserting an entry (whether
+        //:   allocating the slots or copying the entry), the table is
+        //:   unchanged, and no memory is leaked.
+        //:
+        //: 2 If an allocation fails while copying a table, no memory is
+        //:   leaked.
+        //
+        // Plan:
+        //: 1 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, insert
+        //:   entries of the allocating type 'AllocInt' into tables of
+        //:   varying sizes (including sizes at which the table is rehashed),
+        //:   and verify the value of the table after each attempt.  (C-1)
+        //:
+        //: 2 Using the 'BSLMA_TESTALLOCATOR_EXCEPTION_TEST_*' macros, copy
+        //:   tables of varying sizes, and verify that no memory is in use
+        //:   after each attempt.  (C-2)
+        //
+        // Testing:
+        //   EXCEPTION SAFETY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "EXCEPTION SAFETY" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+
+        for (int n = 0; n <= 60; ++n) {
+            AllocObj        mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            const AllocObj& X = mX;
+            bsl::set<int>   exp;
+
+            for (int i = 0; i < n; ++i) {
+                mX.insertKey(i);
+                exp.insert(i);
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                ASSERTV(n, n == static_cast<int>(X.size()));
+                for (int i = 0; i < n; ++i) {
+                    ASSERTV(n, i, X.contains(i));
+                }
+
+                const AllocInt ENTRY(n);
+                mX.insert(ENTRY);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+
+            exp.insert(n);
+
+            ASSERTV(n, X.size(), n + 1 == static_cast<int>(X.size()));
+            for (int i = 0; i <= n; ++i) {
+                ASSERTV(n, i, X.contains(i));
+            }
+
+            BSLMA_TESTALLOCATOR_EXCEPTION_TEST_BEGIN(ta) {
+                const AllocObj Y(X, &ta);
+
+                ASSERTV(n, X == Y);
+            } BSLMA_TESTALLOCATOR_EXCEPTION_TEST_END
+        }
+
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // TESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY
+        //
+        // Concerns:
+        //: 1 A copy has the same value and capacity as the original, and uses
+        //:   the allocator supplied at construction.
+        //:
+        //: 2 Assignment gives the target the value of the source, retaining
+        //:   the allocator of the target; self-assignment has no effect.
+        //:
+        //: 3 'swap' exchanges the values of two tables without allocating.
+        //:
+        //: 4 Two tables compare equal if and only if they contain the same
+        //:   entries, independent of capacity and insertion order.
+        //
+        // Plan:
+        //: 1 For tables of several sizes, containing erased slots, create
+        //:   copies and assign, and verify their values, their capacities,
+        //:   and their allocators.  (C-1..2)
+        //:
+        //: 2 Swap two tables and verify their values, and that no memory was
+        //:   allocated.  (C-3)
+        //:
+        //: 3 Compare tables holding the same keys inserted in different orders
+        //:   and having different capacities, and tables holding different
+        //:   keys.  (C-4)
+        //
+        // Testing:
+        //   FlatHashTable(const FlatHashTable& original, Allocator *ba = 0);
+        //   FlatHashTable& operator=(const FlatHashTable& rhs);
+        //   void swap(FlatHashTable& other);
+        //   bool operator==(const FlatHashTable& lhs, const FlatHashTable& r);
+        //   bool operator!=(const FlatHashTable& lhs, const FlatHashTable& r);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING COPY, ASSIGNMENT, SWAP, AND EQUALITY"
+                          << endl
+                          << "============================================"
+                          << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+        bslma::TestAllocator tb("other", veryVerbose);
+
+        static const int SIZES[] = { 0, 1, 13, 14, 15, 16, 100, 1000 };
+        const int NUM_SIZES = static_cast<int>(sizeof SIZES / sizeof *SIZES);
+
+        if (verbose) cout << "\nTesting copy and assignment." << endl;
+
+        for (int ti = 0; ti < NUM_SIZES; ++ti) {
+            const int N = SIZES[ti];
+
+            ConstantAllocObj mX(0, ConstantHash(), bsl::equal_to<int>(), &ta);
+            const ConstantAllocObj& X = mX;
+
+            for (int i = 0; i < 2 * N; ++i) {
+                mX.insertKey(i);
+            }
+            for (int i = 0; i < 2 * N; i += 2) {
+                mX.erase(i);
+            }
+
+            {
+                const ConstantAllocObj Y(X, &tb);
+
+                ASSERTV(N, X == Y);
+                ASSERTV(N, X.capacity() == Y.capacity());
+                ASSERTV(N, &tb == Y.allocator());
+                ASSERTV(N, N == static_cast<int>(Y.size()));
+            }
+            {
+                ConstantAllocObj mY(0, ConstantHash(), bsl::equal_to<int>(),
+                                    &tb);
+                mY.insertKey(-1);
+
+                mY = X;
+
+                ASSERTV(N, X == mY);
+                ASSERTV(N, &tb == mY.allocator());
+
+                mY = mY;
+
+                ASSERTV(N, X == mY);
+            }
+            ASSERTV(N, 0 == tb.numBlocksInUse());
+        }
+
+        if (verbose) cout << "\nTesting 'swap'." << endl;
+        {
+            Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            const Obj& X = mX;
+            Obj mY(100, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            const Obj& Y = mY;
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i);
+            }
+            for (int i = 0; i < 50; ++i) {
+                mY.insert(-i);
+            }
+
+            const Obj XX(X, &tb);
+            const Obj YY(Y, &tb);
+
+            const bsls::Types::Int64 NUM_ALLOCS = ta.numAllocations();
+
+            mX.swap(mY);
+
+            ASSERT(NUM_ALLOCS == ta.numAllocations());
+            ASSERT(YY == X);
+            ASSERT(XX == Y);
+
+            verifyTable(L_, X, bsl::set<int>(YY.begin(), YY.end()));
+            verifyTable(L_, Y, bsl::set<int>(XX.begin(), XX.end()));
+        }
+
+        if (verbose) cout << "\nTesting equality." << endl;
+        {
+            Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            const Obj& X = mX;
+            Obj mY(1000, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            const Obj& Y = mY;
+
+            ASSERT(  X == Y);
+            ASSERT(!(X != Y));
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+                mY.insert(99 - i);
+            }
+
+            ASSERT(  X == Y);
+            ASSERT(!(X != Y));
+            ASSERT(X.capacity() != Y.capacity());
+
+            mY.erase(50);
+
+            ASSERT(!(X == Y));
+            ASSERT(  X != Y);
+
+            mY.insert(100);
+
+            ASSERT(!(X == Y));
+            ASSERT(  X != Y);
+        }
+
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'rehash' AND 'reserve'
+        //
+        // Concerns:
+        //: 1 'rehash' sets the capacity to the smallest valid capacity that
+        //:   is at least the requested capacity and can hold the entries, and
+        //:   retains every entry.
+        //:
+        //: 2 'rehash(0)' on an empty table releases its slots.
+        //:
+        //: 3 'reserve' ensures that the requested number of entries can be
+        //:   inserted without allocating, and does not reduce the capacity.
+        //:
+        //: 4 Relocation preserves entries that are not bitwise movable.
+        //
+        // Plan:
+        //: 1 For a table of 'AllocInt' holding a varying number of entries,
+        //:   rehash to a set of capacities, and verify the resulting capacity
+        //:   and the value of the table.  (C-1..2, 4)
+        //:
+        //: 2 Reserve room for a varying number of entries, then insert that
+        //:   many entries and verify that the number of allocations from the
+        //:   slots' allocator is unchanged.  (C-3)
+        //
+        // Testing:
+        //   void rehash(size_t minimumCapacity);
+        //   void reserve(size_t numEntries);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'rehash' AND 'reserve'" << endl
+                          << "==============================" << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+
+        if (verbose) cout << "\nTesting 'rehash'." << endl;
+
+        static const struct {
+            int         d_line;
+            int         d_numEntries;
+            bsl::size_t d_request;
+            bsl::size_t d_expCapacity;
+        } DATA[] = {
+            //LN  #entries  request  capacity
+            //--  --------  -------  --------
+            { L_,        0,       0,        0 },
+            { L_,        0,       1,       16 },
+            { L_,        0,      16,       16 },
+            { L_,        0,      17,       32 },
+            { L_,        1,       0,       16 },
+            { L_,       14,       0,       16 },
+            { L_,       15,       0,       32 },
+            { L_,       15,      16,       32 },
+            { L_,       15,      64,       64 },
+            { L_,      100,       0,      128 },
+            { L_,      100,     100,      128 },
+            { L_,      113,       0,      256 },
+            { L_,      113,    1000,     1024 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE    = DATA[ti].d_line;
+            const int         N       = DATA[ti].d_numEntries;
+            const bsl::size_t REQUEST = DATA[ti].d_request;
+            const bsl::size_t EXP     = DATA[ti].d_expCapacity;
+
+            AllocObj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            const AllocObj& X = mX;
+            bsl::set<int> exp;
+
+            for (int i = 0; i < N; ++i) {
+                mX.insertKey(i * 7);
+                exp.insert(i * 7);
+            }
+
+            mX.rehash(REQUEST);
+
+            ASSERTV(LINE, X.capacity(), EXP == X.capacity());
+            ASSERTV(LINE, N == static_cast<int>(X.size()));
+            for (int i = 0; i < N; ++i) {
+                ASSERTV(LINE, i, X.contains(i * 7));
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'reserve'." << endl;
+
+        for (int n = 0; n < 300; n += 7) {
+            Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            const Obj& X = mX;
+
+            mX.insert(-1);
+            mX.reserve(n);
+
+            const bsl::size_t        CAPACITY   = X.capacity();
+            const bsls::Types::Int64 NUM_ALLOCS = ta.numAllocations();
+
+            for (int i = 1; i < n; ++i) {
+                mX.insert(i);
+            }
+
+            ASSERTV(n, NUM_ALLOCS == ta.numAllocations());
+
+            mX.reserve(0);
+            ASSERTV(n, CAPACITY == X.capacity());
+        }
+
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING ERASE AND CLEAR
+        //
+        // Concerns:
+        //: 1 'erase(key)' erases the entry having the key, if any, and returns
+        //:   the number of entries erased.
+        //:
+        //: 2 'erase(position)' returns an iterator to the next entry.
+        //:
+        //: 3 'erase(first, last)' erases exactly the entries in the range.
+        //:
+        //: 4 Erased slots do not prevent finding keys whose probe sequences
+        //:   pass through them.
+        //:
+        //: 5 Repeatedly inserting and erasing keys, without the number of
+        //:   entries growing, does not grow the capacity without bound.
+        //:
+        //: 6 'clear' erases every entry and retains the capacity.
+        //
+        // Plan:
+        //: 1 Using a hasher mapping every key to the same value, so that every
+        //:   probe sequence passes through every group, fill a table, erase
+        //:   entries by key, by position, and by range, and verify the value
+        //:   of the table after each erase.  (C-1..4)
+        //:
+        //: 2 Repeatedly insert and erase distinct keys, keeping the number of
+        //:   entries constant, and verify that the capacity remains bounded.
+        //:   (C-5)
+        //:
+        //: 3 Clear tables of various sizes and verify the value and capacity.
+        //:   (C-6)
+        //
+        // Testing:
+        //   size_t erase(const KEY& key);
+        //   iterator erase(const_iterator position);
+        //   iterator erase(const_iterator first, const_iterator last);
+        //   void clear();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ERASE AND CLEAR" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+
+        if (verbose) cout << "\nTesting 'erase(key)'." << endl;
+        {
+            ConstantObj mX(0, ConstantHash(), bsl::equal_to<int>(), &ta);
+            const ConstantObj& X = mX;
+            bsl::set<int> exp;
+
+            for (int i = 0; i < 200; ++i) {
+                mX.insert(i);
+                exp.insert(i);
+            }
+            verifyTable(L_, X, exp);
+
+            for (int i = 0; i < 200; i += 3) {
+                ASSERTV(i, 1 == mX.erase(i));
+                ASSERTV(i, 0 == mX.erase(i));
+                exp.erase(i);
+            }
+            verifyTable(L_, X, exp);
+
+            ASSERT(0 == mX.erase(1000));
+        }
+
+        if (verbose) cout << "\nTesting 'erase(position)'." << endl;
+        {
+            ConstantObj mX(0, ConstantHash(), bsl::equal_to<int>(), &ta);
+            const ConstantObj& X = mX;
+            bsl::set<int> exp;
+
+            for (int i = 0; i < 100; ++i) {
+                mX.insert(i);
+                exp.insert(i);
+            }
+
+            ConstantObj::iterator it = mX.begin();
+            int                   n  = 0;
+            while (it != mX.end()) {
+                ConstantObj::iterator next = it;
+                ++next;
+
+                if (n++ % 2) {
+                    exp.erase(*it);
+                    ConstantObj::iterator result = mX.erase(it);
+                    ASSERT(next == result);
+                    it = result;
+                }
+                else {
+                    it = next;
+                }
+            }
+            verifyTable(L_, X, exp);
+        }
+
+        if (verbose) cout << "\nTesting 'erase(first, last)'." << endl;
+
+        for (int first = 0; first < 40; first += 3) {
+            for (int last = first; last <= 40; last += 5) {
+                Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+                const Obj& X = mX;
+
+                for (int i = 0; i < 40; ++i) {
+                    mX.insert(i);
+                }
+
+                Obj::const_iterator itFirst = X.begin();
+                for (int i = 0; i < first; ++i) {
+                    ++itFirst;
+                }
+                Obj::const_iterator itLast = itFirst;
+                for (int i = first; i < last; ++i) {
+                    ++itLast;
+                }
+
+                bsl::set<int> exp;
+                int           position = 0;
+                for (Obj::const_iterator it = X.begin(); it != X.end(); ++it) {
+                    if (position < first || last <= position) {
+                        exp.insert(*it);
+                    }
+                    ++position;
+                }
+
+                Obj::iterator result = mX.erase(itFirst, itLast);
+
+                ASSERTV(first, last, result == itLast);
+                verifyTable(L_, X, exp);
+            }
+        }
+
+        if (verbose) cout << "\nTesting bounded capacity." << endl;
+        {
+            ConstantObj mX(0, ConstantHash(), bsl::equal_to<int>(), &ta);
+            const ConstantObj& X = mX;
+
+            for (int i = 0; i < 50; ++i) {
+                mX.insert(i);
+            }
+            const bsl::size_t CAPACITY = X.capacity();
+
+            for (int i = 50; i < 5000; ++i) {
+                mX.insert(i);
+                ASSERTV(i, 1 == mX.erase(i - 50));
+                ASSERTV(i, 50 == X.size());
+            }
+            ASSERTV(CAPACITY, X.capacity(), CAPACITY == X.capacity());
+
+            bsl::set<int> exp;
+            for (int i = 4950; i < 5000; ++i) {
+                exp.insert(i);
+            }
+            verifyTable(L_, X, exp);
+        }
+
+        if (verbose) cout << "\nTesting 'clear'." << endl;
+
+        for (int n = 0; n < 100; n += 9) {
+            AllocObj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+            const AllocObj& X = mX;
+
+            for (int i = 0; i < n; ++i) {
+                mX.insertKey(i);
+            }
+            const bsl::size_t CAPACITY = X.capacity();
+
+            mX.clear();
+
+            ASSERTV(n, X.empty());
+            ASSERTV(n, 0 == X.size());
+            ASSERTV(n, CAPACITY == X.capacity());
+            ASSERTV(n, X.begin() == X.end());
+            ASSERTV(n, !X.contains(0));
+
+            mX.insertKey(n);
+            ASSERTV(n, X.contains(n));
+        }
+
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING INSERT, FIND, AND ITERATION
+        //
+        // Concerns:
+        //: 1 'insert' and 'insertKey' insert an entry if and only if its key
+        //:   is not already in the table, and return an iterator to the entry
+        //:   having the key.
+        //:
+        //: 2 'find', 'contains', and 'count' locate exactly the keys in the
+        //:   table.
+        //:
+        //: 3 Iteration visits every entry exactly once.
+        //:
+        //: 4 The above hold for well-distributed hashers, for hashers whose
+        //:   values differ only in their low-order bits, and for hashers
+        //:   returning the same value for every key.
+        //:
+        //: 5 The above hold for entries that are not bitwise movable.
+        //:
+        //: 6 No memory is leaked.
+        //
+        // Plan:
+        //: 1 For each of the hashers 'bslh::Hash<>', 'IdentityHash', and
+        //:   'ConstantHash', and for both 'int' and 'AllocInt' entries,
+        //:   perform long sequences of pseudo-random inserts and erases,
+        //:   verifying the table against a 'bsl::set' oracle.  (C-1..6)
+        //
+        // Testing:
+        //   pair<iterator, bool> insert(const ENTRY& entry);
+        //   pair<iterator, bool> insertKey(const KEY& key);
+        //   iterator find(const KEY& key);
+        //   iterator begin();
+        //   iterator end();
+        //   bool contains(const KEY& key) const;
+        //   size_t count(const KEY& key) const;
+        //   const_iterator find(const KEY& key) const;
+        //   const_iterator begin() const;
+        //   const_iterator end() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING INSERT, FIND, AND ITERATION" << endl
+                          << "===================================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_keyRange;
+            int d_numOperations;
+        } DATA[] = {
+            //LN  range  #ops
+            //--  -----  -----
+            { L_,     1,   100 },
+            { L_,    16,  1000 },
+            { L_,   100,  5000 },
+            { L_,  1000, 20000 },
+            { L_, 20000, 50000 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE  = DATA[ti].d_line;
+            const int RANGE = DATA[ti].d_keyRange;
+            const int OPS   = DATA[ti].d_numOperations;
+
+            if (veryVerbose) { T_ P_(LINE) P_(RANGE) P(OPS) }
+
+            testRandomOperations<Obj>(LINE, RANGE, OPS, ti, veryVerbose);
+            testRandomOperations<IdentityObj>(LINE,
+                                              RANGE,
+                                              OPS,
+                                              ti,
+                                              veryVerbose);
+
+            // A constant hash makes every operation linear in the size of the
+            // table, so limit the key range.
+
+            if (RANGE <= 1000) {
+                testRandomOperations<ConstantObj>(LINE,
+                                                  RANGE,
+                                                  OPS,
+                                                  ti,
+                                                  veryVerbose);
+            }
+        }
+
+        if (verbose) cout << "\nTesting non-bitwise-movable entries." << endl;
+        {
+            bslma::TestAllocator ta("table", veryVerbose);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE  = DATA[ti].d_line;
+                const int RANGE = DATA[ti].d_keyRange;
+
+                AllocObj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+                const AllocObj& X = mX;
+
+                for (int i = 0; i < RANGE; ++i) {
+                    const AllocInt ENTRY(i);
+
+                    ASSERTV(LINE, i, mX.insert(ENTRY).second);
+                    ASSERTV(LINE, i, !mX.insertKey(i).second);
+                }
+                for (int i = 0; i < RANGE; ++i) {
+                    ASSERTV(LINE, i, X.contains(i));
+                    ASSERTV(LINE, i, i == X.find(i)->key());
+                }
+                ASSERTV(LINE, !X.contains(-1));
+
+                int count = 0;
+                for (AllocObj::const_iterator it = X.begin();
+                     it != X.end();
+                     ++it) {
+                    ++count;
+                }
+                ASSERTV(LINE, RANGE == count);
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING CONSTRUCTOR AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The constructor creates an empty table whose capacity is the
+        //:   smallest valid capacity able to hold the requested number of
+        //:   entries (0, or a power of two at least 16 whose seven eighths is
+        //:   at least the request).
+        //:
+        //: 2 The constructor uses the supplied allocator, or the default
+        //:   allocator if none is supplied, and allocates only if the
+        //:   requested capacity is not 0.
+        //:
+        //: 3 The functors supplied to the constructor are used and returned
+        //:   by 'hash_function' and 'key_eq'.
+        //:
+        //: 4 'load_factor' is the ratio of the size to the capacity, and
+        //:   'max_load_factor' is 0.875.
+        //:
+        //: 5 The destructor releases all memory.
+        //
+        // Plan:
+        //: 1 Using a table of requested capacities and expected capacities,
+        //:   create tables with and without an allocator, and verify the
+        //:   basic accessors and the memory allocated.  (C-1..5)
+        //
+        // Testing:
+        //   FlatHashTable(size_t capacity, hash, equal, Allocator *ba = 0);
+        //   ~FlatHashTable();
+        //   size_t capacity() const;
+        //   bool empty() const;
+        //   HASH hash_function() const;
+        //   EQUAL key_eq() const;
+        //   float load_factor() const;
+        //   float max_load_factor() const;
+        //   size_t size() const;
+        //   bslma::Allocator *allocator() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING CONSTRUCTOR AND BASIC ACCESSORS" << endl
+                          << "=======================================" << endl;
+
+        static const struct {
+            int         d_line;
+            bsl::size_t d_request;
+            bsl::size_t d_expCapacity;
+        } DATA[] = {
+            //LN  request  capacity
+            //--  -------  --------
+            { L_,       0,        0 },
+            { L_,       1,       16 },
+            { L_,      14,       16 },
+            { L_,      15,       32 },
+            { L_,      28,       32 },
+            { L_,      29,       64 },
+            { L_,     112,      128 },
+            { L_,     113,      256 },
+            { L_,    1000,     2048 },
+            { L_,   57344,    65536 },
+            { L_,   57345,   131072 },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int         LINE     = DATA[ti].d_line;
+            const bsl::size_t REQUEST  = DATA[ti].d_request;
+            const bsl::size_t CAPACITY = DATA[ti].d_expCapacity;
+
+            for (char cfg = 'a'; cfg <= 'b'; ++cfg) {
+                bslma::TestAllocator  fa("footprint", veryVerbose);
+                bslma::TestAllocator  sa("supplied",  veryVerbose);
+                bslma::TestAllocator& oa = 'a' == cfg ? defaultAllocator : sa;
+
+                {
+                    Obj *objPtr = 'a' == cfg
+                                  ? new (fa) Obj(REQUEST,
+                                                 bslh::Hash<>(),
+                                                 bsl::equal_to<int>())
+                                  : new (fa) Obj(REQUEST,
+                                                 bslh::Hash<>(),
+                                                 bsl::equal_to<int>(),
+                                                 &sa);
+                    const Obj& X = *objPtr;
+
+                    ASSERTV(LINE, cfg, &oa == X.allocator());
+                    ASSERTV(LINE, cfg, X.capacity(), CAPACITY == X.capacity());
+                    ASSERTV(LINE, cfg, X.empty());
+                    ASSERTV(LINE, cfg, 0 == X.size());
+                    ASSERTV(LINE, cfg, 0.0f == X.load_factor());
+                    ASSERTV(LINE, cfg, 0.875f == X.max_load_factor());
+                    ASSERTV(LINE, cfg, X.begin() == X.end());
+                    ASSERTV(LINE, cfg, !X.contains(0));
+
+                    ASSERTV(LINE, cfg, (0 == CAPACITY) ==
+                                                   (0 == oa.numBlocksInUse()));
+
+                    fa.deleteObject(objPtr);
+                }
+                ASSERTV(LINE, cfg, 0 == oa.numBlocksInUse());
+            }
+        }
+
+        if (verbose) cout << "\nTesting functors and 'load_factor'." << endl;
+        {
+            bslma::TestAllocator ta("table", veryVerbose);
+
+            IdentityObj mX(16, IdentityHash(), bsl::equal_to<int>(), &ta);
+            const IdentityObj& X = mX;
+
+            ASSERT(17 == X.hash_function()(17));
+            ASSERT(X.key_eq()(3, 3));
+            ASSERT(!X.key_eq()(3, 4));
+
+            const bsl::size_t CAPACITY = X.capacity();
+
+            for (int i = 0; i < 10; ++i) {
+                mX.insert(i);
+            }
+            ASSERTV(X.load_factor(),
+                    static_cast<float>(10) / static_cast<float>(CAPACITY) ==
+                                                              X.load_factor());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create a table, insert, find, and erase some keys, and verify
+        //:   the size of the table.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("table", veryVerbose);
+
+        Obj mX(0, bslh::Hash<>(), bsl::equal_to<int>(), &ta);
+        const Obj& X = mX;
+
+        ASSERT(X.empty());
+        ASSERT(0 == X.capacity());
+
+        ASSERT( mX.insert(1).second);
+        ASSERT( mX.insert(2).second);
+        ASSERT(!mX.insert(1).second);
+
+        ASSERT(2 == X.size());
+        ASSERT(16 == X.capacity());
+        ASSERT(X.contains(1));
+        ASSERT(X.contains(2));
+        ASSERT(!X.contains(3));
+
+        for (int i = 3; i <= 100; ++i) {
+            mX.insert(i);
+        }
+        ASSERT(100 == X.size());
+        ASSERT(128 == X.capacity());
+
+        ASSERT(1 == mX.erase(50));
+        ASSERT(0 == mX.erase(50));
+        ASSERT(99 == X.size());
+        ASSERT(!X.contains(50));
+        ASSERT(X.find(50) == X.end());
+        ASSERT(51 == *X.find(51));
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    ASSERTV(defaultAllocator.numBlocksInUse(),
+            0 == defaultAllocator.numBlocksInUse());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
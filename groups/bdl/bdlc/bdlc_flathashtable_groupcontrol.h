@@ -0,0 +1,235 @@
+// bdlc_flathashtable_groupcontrol.h                                  -*-C++-*-
+#ifndef INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+#define INCLUDED_BDLC_FLATHASHTABLE_GROUPCONTROL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide inquiries to a flat hash table group of control values.
+//
+//@CLASSES:
+//  bdlc::FlatHashTable_GroupControl: flat hash table group control inquiries
+//
+//@SEE_ALSO: bdlc_flathashtable
+//
+//@DESCRIPTION: This component provides an implementation of a value-semantic
+// type, 'bdlc::FlatHashTable_GroupControl', that is used to query a group of
+// 'k_SIZE' consecutive control values (bytes) of a 'bdlc::FlatHashTable'.
+// Each control value describes one slot of the table, and is either
+// 'k_EMPTY' (the slot has never held an element since the table was last
+// rehashed), 'k_ERASED' (the slot held an element that has since been
+// erased), or, for a slot holding an element, the low-order seven bits of the
+// hash value of that element's key (a value in the range '[0 .. 127]').
+//
+// The inquiries return bit masks in which bit 'i' corresponds to the control
+// value at offset 'i' within the group.  On platforms providing SSE2
+// instructions, each inquiry on a group is implemented with a small number of
+// SIMD instructions operating on all 'k_SIZE' control values at once;
+// otherwise, a portable implementation is used.
+//
+// This class is an implementation detail of 'bdlc_flathashtable' and must not
+// be used directly.
+//
+///Usage
+///-----
+// There is no usage example for this component since it is not meant for
+// direct client use.
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDINT
+#include <bsl_cstdint.h>
+#endif
+
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ || (defined(BSLS_PLATFORM_CPU_X86) && defined(__SSE2__))
+#define BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2 1
+#endif
+
+#ifdef BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlc {
+
+                     // ================================
+                     // class FlatHashTable_GroupControl
+                     // ================================
+
+class FlatHashTable_GroupControl {
+    // This class provides bit-mask inquiries to a group of 'k_SIZE' control
+    // values of a flat hash table.
+
+  public:
+    // TYPES
+    typedef bsl::uint8_t ControlByte;
+
+    // CONSTANTS
+    static const ControlByte k_EMPTY  = 0x80;  // control value of an empty
+                                               // slot
+
+    static const ControlByte k_ERASED = 0xFE;  // control value of an erased
+                                               // slot
+
+    enum { k_SIZE = 16 };                      // number of control values in
+                                               // a group
+
+  private:
+    // DATA
+#ifdef BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2
+    __m128i            d_value;    // the control values of the group
+#else
+    const ControlByte *d_value_p;  // the control values of the group
+#endif
+
+  public:
+    // CREATORS
+    explicit FlatHashTable_GroupControl(const ControlByte *group);
+        // Create a group control object for the 'k_SIZE' control values
+        // starting at the specified 'group'.  The behavior is undefined
+        // unless 'group' refers to 'k_SIZE' contiguous control values, which
+        // are not modified during the lifetime of this object.
+
+    //! FlatHashTable_GroupControl(
+    //!                      const FlatHashTable_GroupControl& original) =
+    //!                                                                default;
+    //! ~FlatHashTable_GroupControl() = default;
+
+    // MANIPULATORS
+    //! FlatHashTable_GroupControl& operator=(
+    //!                           const FlatHashTable_GroupControl& rhs) =
+    //!                                                                default;
+
+    // ACCESSORS
+    bsl::uint32_t available() const;
+        // Return a bit mask of the control values in this group that are
+        // either 'k_EMPTY' or 'k_ERASED'.
+
+    bool containsEmpty() const;
+        // Return 'true' if any control value in this group is 'k_EMPTY', and
+        // 'false' otherwise.
+
+    bsl::uint32_t inUse() const;
+        // Return a bit mask of the control values in this group that
+        // describe a slot holding an element.
+
+    bsl::uint32_t match(ControlByte value) const;
+        // Return a bit mask of the control values in this group equal to the
+        // specified 'value'.  The behavior is undefined unless
+        // '0 <= value < 128'.
+};
+
+// ============================================================================
+//                           INLINE DEFINITIONS
+// ============================================================================
+
+                     // --------------------------------
+                     // class FlatHashTable_GroupControl
+                     // --------------------------------
+
+// CREATORS
+inline
+FlatHashTable_GroupControl::FlatHashTable_GroupControl(
+                                                      const ControlByte *group)
+#ifdef BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2
+: d_value(_mm_loadu_si128(reinterpret_cast<const __m128i *>(group)))
+#else
+: d_value_p(group)
+#endif
+{
+    BSLS_ASSERT_SAFE(group);
+}
+
+// ACCESSORS
+inline
+bsl::uint32_t FlatHashTable_GroupControl::available() const
+{
+#ifdef BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2
+    // Both 'k_EMPTY' and 'k_ERASED' have the high-order bit set; the control
+    // value of a slot holding an element does not.
+
+    return static_cast<bsl::uint32_t>(_mm_movemask_epi8(d_value));
+#else
+    bsl::uint32_t mask = 0;
+    for (int i = 0; i < k_SIZE; ++i) {
+        mask |= static_cast<bsl::uint32_t>(d_value_p[i] >> 7) << i;
+    }
+    return mask;
+#endif
+}
+
+inline
+bool FlatHashTable_GroupControl::containsEmpty() const
+{
+#ifdef BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(k_EMPTY));
+
+    return 0 != _mm_movemask_epi8(_mm_cmpeq_epi8(pattern, d_value));
+#else
+    for (int i = 0; i < k_SIZE; ++i) {
+        if (k_EMPTY == d_value_p[i]) {
+            return true;                                              // RETURN
+        }
+    }
+    return false;
+#endif
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::inUse() const
+{
+    return ~available() & ((1u << k_SIZE) - 1);
+}
+
+inline
+bsl::uint32_t FlatHashTable_GroupControl::match(ControlByte value) const
+{
+    BSLS_ASSERT_SAFE(value < 128);
+
+#ifdef BDLC_FLATHASHTABLE_GROUPCONTROL_SSE2
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(value));
+
+    return static_cast<bsl::uint32_t>(
+                          _mm_movemask_epi8(_mm_cmpeq_epi8(pattern, d_value)));
+#else
+    bsl::uint32_t mask = 0;
+    for (int i = 0; i < k_SIZE; ++i) {
+        mask |= static_cast<bsl::uint32_t>(value == d_value_p[i]) << i;
+    }
+    return mask;
+#endif
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
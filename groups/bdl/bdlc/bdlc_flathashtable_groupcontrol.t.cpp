@@ -0,0 +1,405 @@
+// bdlc_flathashtable_groupcontrol.t.cpp                              -*-C++-*-
+#include <bdlc_flathashtable_groupcontrol.h>
+
+#include <bslim_testutil.h>
+
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdint.h>
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                              TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// 'bdlc::FlatHashTable_GroupControl' provides bit-mask inquiries on a group of
+// control values.  Since the SIMD and portable implementations must agree, the
+// accessors are tested against a simple oracle over a large number of
+// generated groups, in which each control value is chosen among 'k_EMPTY',
+// 'k_ERASED', and a small set of hash values.
+//-----------------------------------------------------------------------------
+// CREATORS
+// [ 2] FlatHashTable_GroupControl(const ControlByte *group);
+//
+// ACCESSORS
+// [ 2] bsl::uint32_t available() const;
+// [ 2] bool containsEmpty() const;
+// [ 2] bsl::uint32_t inUse() const;
+// [ 2] bsl::uint32_t match(ControlByte value) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 3] TESTING UNALIGNED GROUPS
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlc::FlatHashTable_GroupControl Obj;
+typedef Obj::ControlByte                 ControlByte;
+
+const int k_SIZE = Obj::k_SIZE;
+
+// ============================================================================
+//                       HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static void generateGroup(ControlByte *group, bsl::uint64_t seed)
+    // Load into the specified 'group' 'k_SIZE' control values derived from
+    // the specified 'seed', each being one of 'k_EMPTY', 'k_ERASED', 0, 1,
+    // 0x55, and 0x7F.
+{
+    static const ControlByte VALUES[] = { Obj::k_EMPTY,
+                                          Obj::k_ERASED,
+                                          0,
+                                          1,
+                                          0x55,
+                                          0x7F };
+
+    for (int i = 0; i < k_SIZE; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        group[i] = VALUES[(seed >> 33) % 6];
+    }
+}
+
+static bsl::uint32_t oracleMatch(const ControlByte *group, ControlByte value)
+    // Return the mask of control values in the specified 'group' equal to the
+    // specified 'value'.
+{
+    bsl::uint32_t mask = 0;
+    for (int i = 0; i < k_SIZE; ++i) {
+        if (value == group[i]) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+static void verifyGroup(int line, const ControlByte *group)
+    // Verify, reporting failures as occurring on the specified 'line', each
+    // inquiry of a group control object created from the specified 'group'
+    // against the oracle.
+{
+    const Obj X(group);
+
+    const bsl::uint32_t EXP_EMPTY  = oracleMatch(group, Obj::k_EMPTY);
+    const bsl::uint32_t EXP_ERASED = oracleMatch(group, Obj::k_ERASED);
+    const bsl::uint32_t EXP_AVAIL  = EXP_EMPTY | EXP_ERASED;
+
+    ASSERTV(line, EXP_AVAIL == X.available());
+    ASSERTV(line, (~EXP_AVAIL & 0xFFFF) == X.inUse());
+    ASSERTV(line, (0 != EXP_EMPTY) == X.containsEmpty());
+
+    for (int v = 0; v < 128; ++v) {
+        const ControlByte VALUE = static_cast<ControlByte>(v);
+
+        ASSERTV(line, v, oracleMatch(group, VALUE) == X.match(VALUE));
+    }
+}
+
+// ============================================================================
+//                                 MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int  test    = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING UNALIGNED GROUPS
+        //
+        // Concerns:
+        //: 1 A group need not be aligned on a 'k_SIZE' boundary.
+        //
+        // Plan:
+        //: 1 Create a buffer of control values, and verify the inquiries on
+        //:   groups starting at every offset within the first two groups
+        //:   of the buffer against the oracle.  (C-1)
+        //
+        // Testing:
+        //   TESTING UNALIGNED GROUPS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING UNALIGNED GROUPS" << endl
+                          << "========================" << endl;
+
+        ControlByte buffer[3 * k_SIZE];
+
+        for (int seed = 0; seed < 64; ++seed) {
+            generateGroup(buffer,              seed);
+            generateGroup(buffer + k_SIZE,     seed + 1000);
+            generateGroup(buffer + 2 * k_SIZE, seed + 2000);
+
+            for (int offset = 0; offset < 2 * k_SIZE; ++offset) {
+                if (veryVerbose) { T_ P_(seed) P(offset) }
+
+                verifyGroup(L_, buffer + offset);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // TESTING ACCESSORS
+        //
+        // Concerns:
+        //: 1 'available' returns the mask of control values that are
+        //:   'k_EMPTY' or 'k_ERASED'.
+        //:
+        //: 2 'inUse' returns the complement (within 'k_SIZE' bits) of
+        //:   'available'.
+        //:
+        //: 3 'containsEmpty' returns 'true' if and only if a control value is
+        //:   'k_EMPTY'.
+        //:
+        //: 4 'match' returns the mask of control values equal to its
+        //:   argument, for every valid argument.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using a table of hand-crafted groups, and then a large number of
+        //:   generated groups, verify each accessor against an oracle.
+        //:   (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid argument values (using the
+        //:   'BSLS_ASSERTTEST_*' macros).  (C-5)
+        //
+        // Testing:
+        //   FlatHashTable_GroupControl(const ControlByte *group);
+        //   bsl::uint32_t available() const;
+        //   bool containsEmpty() const;
+        //   bsl::uint32_t inUse() const;
+        //   bsl::uint32_t match(ControlByte value) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING ACCESSORS" << endl
+                          << "=================" << endl;
+
+        const ControlByte E = Obj::k_EMPTY;
+        const ControlByte D = Obj::k_ERASED;
+
+        static const struct {
+            int         d_line;
+            ControlByte d_group[16];
+        } DATA[] = {
+            //LN  group
+            //--  ----------------------------------------------------------
+            { L_, { E, E, E, E, E, E, E, E, E, E, E, E, E, E, E, E } },
+            { L_, { D, D, D, D, D, D, D, D, D, D, D, D, D, D, D, D } },
+            { L_, { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 } },
+            { L_, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,10,11,12,13,14,15 } },
+            { L_, { E, 1, D, 3, E, 5, D, 7, E, 9, D,11, E,13, D,15 } },
+            { L_, {127,127,127,127,127,127,127,127,
+                   127,127,127,127,127,127,127, E } },
+            { L_, { D,127,127,127,127,127,127,127,
+                   127,127,127,127,127,127,127,127 } },
+        };
+        const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+        if (verbose) cout << "\nTesting tabulated groups." << endl;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            verifyGroup(DATA[ti].d_line, DATA[ti].d_group);
+        }
+
+        if (verbose) cout << "\nTesting generated groups." << endl;
+
+        for (int seed = 0; seed < 1000; ++seed) {
+            ControlByte group[k_SIZE];
+
+            generateGroup(group, seed);
+            verifyGroup(seed, group);
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            ControlByte group[k_SIZE];
+            bsl::memset(group, E, sizeof group);
+
+            const Obj X(group);
+
+            ASSERT_SAFE_PASS(X.match(0));
+            ASSERT_SAFE_PASS(X.match(127));
+            ASSERT_SAFE_FAIL(X.match(128));
+            ASSERT_SAFE_FAIL(X.match(E));
+
+            ASSERT_SAFE_FAIL(Obj(0));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Verify the values of the constants, and exercise the accessors on
+        //:   a simple group.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        ASSERT(16   == Obj::k_SIZE);
+        ASSERT(0x80 == Obj::k_EMPTY);
+        ASSERT(0xFE == Obj::k_ERASED);
+
+        ControlByte group[k_SIZE];
+        bsl::memset(group, Obj::k_EMPTY, sizeof group);
+
+        group[3] = 5;
+        group[9] = Obj::k_ERASED;
+        group[15] = 5;
+
+        const Obj X(group);
+
+        ASSERTV(X.available(), 0x7FF7 == X.available());
+        ASSERTV(X.inUse(),     0x8008 == X.inUse());
+        ASSERTV(X.match(5),    0x8008 == X.match(5));
+        ASSERTV(X.match(6),    0      == X.match(6));
+        ASSERT(X.containsEmpty());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 The inquiries are inexpensive.
+        //
+        // Plan:
+        //: 1 Time a large number of 'match' inquiries over a buffer of
+        //:   generated control values.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        enum { k_NUM_GROUPS = 1024, k_NUM_ITERATIONS = 10000 };
+
+        static ControlByte buffer[k_NUM_GROUPS * k_SIZE];
+        for (int i = 0; i < k_NUM_GROUPS; ++i) {
+            generateGroup(buffer + i * k_SIZE, i);
+        }
+
+        bsl::uint32_t total = 0;
+        for (int j = 0; j < k_NUM_ITERATIONS; ++j) {
+            for (int i = 0; i < k_NUM_GROUPS; ++i) {
+                const Obj X(buffer + i * k_SIZE);
+
+                total += X.match(static_cast<ControlByte>(j & 0x7F));
+                total += X.containsEmpty();
+            }
+        }
+
+        cout << "Checksum: " << total << endl;
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,80 @@
+// bdlcc_boundedqueue.cpp                                             -*-C++-*-
+#include <bdlcc_boundedqueue.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_boundedqueue_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+
+///Implementation Note
+///===================
+// This component is implemented as a ring buffer of 'capacity' cells, each
+// holding an atomic sequence number in addition to the storage for an element
+// (see the bounded MPMC queue described by D. Vyukov).  Two monotonically
+// increasing 64-bit positions, 'd_pushPosition' and 'd_popPosition', identify
+// the next position to be reserved for pushing and popping respectively; the
+// cell for position 'p' is at index 'p & (capacity - 1)'.  For a position
+// 'p', the sequence number of its cell is:
+//..
+//  p                 the cell is free, and may be reserved for the push at 'p'
+//  p + 1             the cell holds the element pushed at 'p'
+//  p + capacity      the element pushed at 'p' has been popped; the cell is
+//                    free for the push at 'p + capacity'
+//..
+// A push (resp. pop) of 'N' elements scans the 'N' cells following the current
+// push (resp. pop) position, counting the leading cells in the required state,
+// and then reserves all of them with a *single* compare-and-swap of the
+// position.  Because the state of a cell can only be advanced by the thread
+// that reserved it, cells found in the required state remain in that state
+// until the compare-and-swap either succeeds (and the cells belong to the
+// calling thread) or fails (and the scan is repeated from the new position).
+// Reserved cells are then individually committed (by storing the next
+// sequence number) as soon as the element is constructed (resp. destroyed),
+// so that a concurrent popper (resp. pusher) never waits for a whole batch.
+//
+// If the copy constructor of an element throws, the remaining cells of the
+// reservation are committed with 'd_hasValue == false'; poppers skip such
+// cells (releasing them for subsequent pushes) without returning a value.
+//
+///Synchronization
+///---------------
+// Blocking follows the protocol used by 'bdlcc::FixedQueue'.  A thread that
+// exhausted its spin budget increments the corresponding waiter count, then
+// checks (with a sequentially consistent load) whether the operation could
+// now proceed, and only then waits on the semaphore.  The opposing operation
+// commits its cell with a sequentially consistent store and then reads the
+// waiter count.  Since both sides perform a sequentially consistent write
+// followed by a sequentially consistent read of the location written by the
+// other side, at least one of them observes the other: either the waiting
+// thread sees the committed cell and does not block, or the committing thread
+// sees the waiter and posts the semaphore.
+//
+// Unlike 'bdlcc::FixedQueue', a thread waking up waiters *claims* their
+// registrations (by decrementing the waiter count) before posting the
+// semaphore, and a thread that decides not to wait withdraws its own
+// registration only if it has not been claimed yet (otherwise it consumes
+// the post issued for it).  The semaphore is therefore posted exactly once
+// per claimed registration, and never accumulates surplus posts that would
+// turn subsequent waits into busy loops.  In addition, waiters are only
+// woken up when the cell they are waiting for (i.e., the front cell for
+// poppers and the back cell for pushers) is available; a thread that completes
+// an operation passes the wake-up on to another waiter of the same kind if
+// the next cell is also available.
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
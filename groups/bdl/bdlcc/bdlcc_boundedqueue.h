@@ -0,0 +1,1390 @@
+// bdlcc_boundedqueue.h                                               -*-C++-*-
+#ifndef INCLUDED_BDLCC_BOUNDEDQUEUE
+#define INCLUDED_BDLCC_BOUNDEDQUEUE
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a lock-free bounded MPMC queue supporting batch transfers.
+//
+//@CLASSES:
+//  bdlcc::BoundedQueue: lock-free, fixed-capacity queue with batch push/pop
+//
+//@SEE_ALSO: bdlcc_fixedqueue, bdlcc_queue
+//
+//@DESCRIPTION: This component defines a class template, 'bdlcc::BoundedQueue',
+// that provides a lock-free, thread-enabled, fixed-capacity, multi-producer
+// multi-consumer (MPMC) queue of values.  'bdlcc::BoundedQueue' is intended
+// for the same producer-consumer hand-off scenarios as 'bdlcc::FixedQueue',
+// and offers the same basic interface ('pushBack', 'tryPushBack', 'popFront',
+// 'tryPopFront', 'disable', 'enable'), but adds:
+//
+//: o Batch operations ('pushBackBatch', 'tryPushBackBatch', 'popFrontBatch',
+//:   'tryPopFrontBatch') that transfer up to 'N' elements with a *single*
+//:   atomic reservation of 'N' consecutive cells, amortizing the cost of the
+//:   contended atomic operation (and of waking up blocked threads) over the
+//:   whole batch.
+//:
+//: o A configurable spin budget: a blocking operation that cannot proceed
+//:   immediately retries up to 'spinCount' times before it blocks on a
+//:   semaphore, which avoids the cost of a kernel wake-up when the queue is
+//:   drained and refilled at a high rate.
+//:
+//: o Cache-line-padded cells: each cell (holding the cell's sequence number
+//:   and the element) occupies a whole number of cache lines, so that threads
+//:   operating on adjacent cells do not contend on the same cache line.
+//
+// The capacity supplied at construction is rounded up to the next power of
+// two (so that the cell for a position can be computed with a mask), with a
+// minimum of 2 (so that the sequence number of a full cell is distinct from
+// that of the same cell free for the next lap); the 'capacity' accessor
+// returns the rounded value.
+//
+///Batch Operations
+///----------------
+// 'tryPushBackBatch' pushes the longest prefix of the supplied values for
+// which there are free cells at the back of the queue, and 'tryPopFrontBatch'
+// pops up to the requested number of elements that are available at the front
+// of the queue; both reserve all the cells they operate on with a single
+// atomic operation, so the elements of a batch are contiguous in the queue
+// (i.e., no element pushed by another thread is interleaved within a batch).
+// 'pushBackBatch' blocks until *all* values have been pushed (or the queue is
+// disabled), and may therefore need several reservations for a batch that
+// exceeds the free space of the queue; elements of separate reservations may
+// be interleaved with elements pushed by other threads, but the relative order
+// of the values supplied to a single call is always preserved.
+// 'popFrontBatch' blocks until *at* *least* one element is available.
+//
+///Template Requirements
+///---------------------
+// 'bdlcc::BoundedQueue' is a template that is parameterized on the type of
+// element contained within the queue.  The supplied template argument, 'TYPE',
+// must provide a copy constructor and an assignment operator.  If 'TYPE'
+// declares the 'bslma::UsesBslmaAllocator' trait, the allocator of the queue
+// is propagated to the elements contained in the queue.
+//
+///Exception Safety
+///----------------
+// A 'bdlcc::BoundedQueue' is exception neutral.  If the copy constructor of
+// 'TYPE' throws while pushing, the cells that were reserved for the values
+// not yet copied are released (and skipped by poppers), so the queue remains
+// in a valid state, and contains the values copied before the exception.  If
+// the assignment operator of 'TYPE' throws while popping, the elements that
+// were reserved by the pop are destroyed and removed from the queue.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Handing Off Messages in Batches
+///- - - - - - - - - - - - - - - - - - - - -
+// In the following example a 'bdlcc::BoundedQueue' is used to hand off
+// messages from a "network" thread that reads messages in bursts to several
+// "worker" threads.  Both sides transfer messages in batches so that the cost
+// of synchronization is shared by all the messages of a batch.
+//
+// First, we define the type of the messages, and a function that processes a
+// message.  The details are unimportant for this example:
+//..
+//  struct my_Message {
+//      int d_sessionId;  // session the message was received on, or -1 to
+//                        // request that the worker stop
+//      int d_payload;    // message data
+//  };
+//
+//  void myProcess(const my_Message& message, bsls::AtomicInt *total)
+//  {
+//      total->addRelaxed(message.d_payload);
+//  }
+//..
+// Then, we define the function executed by each worker thread.  A worker pops
+// as many messages as are available (up to the size of its local buffer) and
+// processes them, until it receives a stop request:
+//..
+//  void myWorker(bdlcc::BoundedQueue<my_Message> *queue,
+//                bsls::AtomicInt                 *total)
+//  {
+//      enum { k_BATCH_SIZE = 16 };
+//
+//      my_Message buffer[k_BATCH_SIZE];
+//
+//      while (true) {
+//          bsl::size_t numPopped = queue->popFrontBatch(buffer,
+//                                                       k_BATCH_SIZE);
+//          for (bsl::size_t i = 0; i < numPopped; ++i) {
+//              if (-1 == buffer[i].d_sessionId) {
+//                  // Put the stop request back for the other workers.
+//
+//                  queue->pushBack(buffer[i]);
+//                  return;                                           // RETURN
+//              }
+//              myProcess(buffer[i], total);
+//          }
+//      }
+//  }
+//..
+// Note that a single batch may contain several elements, so a stop request
+// cannot be addressed to a particular worker.  Instead, the producer pushes a
+// single stop request after all the messages; the worker that pops it has
+// therefore processed every message preceding it, and pushes it back so that
+// it is eventually popped by every worker.
+//
+// Finally, we define the "network" thread function, which creates the queue
+// and the workers, pushes bursts of messages, and then pushes the stop
+// request:
+//..
+//  void myNetworkThread(int numWorkers)
+//  {
+//      enum {
+//          k_QUEUE_CAPACITY = 256,
+//          k_BURST_SIZE     = 32,
+//          k_NUM_BURSTS     = 100
+//      };
+//
+//      bdlcc::BoundedQueue<my_Message> queue(k_QUEUE_CAPACITY);
+//      bsls::AtomicInt                 total(0);
+//
+//      bslmt::ThreadGroup workers;
+//      workers.addThreads(bdlf::BindUtil::bind(&myWorker, &queue, &total),
+//                         numWorkers);
+//
+//      my_Message burst[k_BURST_SIZE];
+//      for (int i = 0; i < k_NUM_BURSTS; ++i) {
+//          for (int j = 0; j < k_BURST_SIZE; ++j) {
+//              burst[j].d_sessionId = j;
+//              burst[j].d_payload   = 1;
+//          }
+//          queue.pushBackBatch(burst, k_BURST_SIZE);
+//      }
+//
+//      my_Message stop = { -1, 0 };
+//      queue.pushBack(stop);
+//
+//      workers.joinAll();
+//      assert(k_BURST_SIZE * k_NUM_BURSTS == total);
+//  }
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLB_BITUTIL
+#include <bdlb_bitutil.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_SEMAPHORE
+#include <bslmt_semaphore.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARDESTRUCTIONPRIMITIVES
+#include <bslalg_scalardestructionprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PERFORMANCEHINT
+#include <bsls_performancehint.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_ALGORITHM
+#include <bsl_algorithm.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_NEW
+#include <bsl_new.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                         // ========================
+                         // struct BoundedQueue_Node
+                         // ========================
+
+template <class TYPE>
+struct BoundedQueue_Node {
+    // This 'struct' provides the (unpadded) layout of a cell of a
+    // 'BoundedQueue'.  For any position 'p' in the sequence of positions of
+    // the queue, the cell at index 'p % capacity' is free for the push at 'p'
+    // when 'd_sequence == p', and holds the value pushed at 'p' when
+    // 'd_sequence == p + 1'.
+
+    // PUBLIC DATA
+    bsls::AtomicInt64        d_sequence;  // sequence number (see above)
+
+    bool                     d_hasValue;  // 'false' if the push that reserved
+                                          // this cell was abandoned (due to
+                                          // an exception), and 'd_value' is
+                                          // not constructed
+
+    bsls::ObjectBuffer<TYPE> d_value;     // element held by this cell
+};
+
+                            // ==================
+                            // class BoundedQueue
+                            // ==================
+
+template <class TYPE>
+class BoundedQueue {
+    // This class provides a thread-enabled, lock-free, fixed-capacity queue of
+    // values supporting batch operations.
+
+    // PRIVATE TYPES
+    typedef BoundedQueue_Node<TYPE> Node;
+    typedef bsls::Types::Int64      Int64;
+
+    class PopGuard;
+    class PushProctor;
+
+    friend class PopGuard;
+    friend class PushProctor;
+
+    // PRIVATE CONSTANTS
+    enum {
+        k_CACHE_LINE_SIZE = bslmt::Platform::e_CACHE_LINE_SIZE,
+        k_NODE_SIZE       = (sizeof(Node) + k_CACHE_LINE_SIZE - 1)
+                                    / k_CACHE_LINE_SIZE * k_CACHE_LINE_SIZE,
+        k_INDEX_PADDING   = k_CACHE_LINE_SIZE - sizeof(bsls::AtomicInt64),
+        k_SEMA_PADDING    = k_CACHE_LINE_SIZE
+                                            - sizeof(bslmt::Semaphore)
+                                            - sizeof(bsls::AtomicInt)
+    };
+
+    // DATA
+    bsls::AtomicInt64  d_pushPosition;      // position of the next cell to
+                                            // be reserved for a push
+
+    const char         d_pushPositionPad[k_INDEX_PADDING];
+                                            // padding to prevent false
+                                            // sharing
+
+    bsls::AtomicInt64  d_popPosition;       // position of the next cell to
+                                            // be reserved for a pop
+
+    const char         d_popPositionPad[k_INDEX_PADDING];
+                                            // padding to prevent false
+                                            // sharing
+
+    bsls::AtomicInt    d_numWaitingPoppers; // number of threads waiting on
+                                            // 'd_popControlSema' to pop an
+                                            // element
+
+    bslmt::Semaphore   d_popControlSema;    // semaphore on which threads
+                                            // waiting to pop 'wait'
+
+    const char         d_popControlSemaPad[k_SEMA_PADDING];
+                                            // padding to prevent false
+                                            // sharing
+
+    bsls::AtomicInt    d_numWaitingPushers; // number of threads waiting on
+                                            // 'd_pushControlSema' to push an
+                                            // element
+
+    bslmt::Semaphore   d_pushControlSema;   // semaphore on which threads
+                                            // waiting to push 'wait'
+
+    const char         d_pushControlSemaPad[k_SEMA_PADDING];
+                                            // padding to prevent false
+                                            // sharing
+
+    bsls::AtomicInt    d_disabledFlag;      // non-zero if this queue is
+                                            // disabled
+
+    const Int64        d_capacity;          // number of cells (a power of
+                                            // two)
+
+    const Int64        d_mask;              // 'd_capacity - 1'
+
+    const int          d_spinCount;         // number of retries of a
+                                            // blocking operation before it
+                                            // blocks
+
+    void              *d_buffer_p;          // memory holding the cells (owned)
+
+    char              *d_nodes_p;           // cache-line-aligned address of
+                                            // the first cell in 'd_buffer_p'
+
+    bslma::Allocator  *d_allocator_p;       // allocator (held, not owned)
+
+  private:
+    // NOT IMPLEMENTED
+    BoundedQueue(const BoundedQueue&);
+    BoundedQueue& operator=(const BoundedQueue&);
+
+    // PRIVATE CLASS METHODS
+    static int claimWaiters(bsls::AtomicInt *numWaiters, Int64 maxCount);
+        // Atomically decrement the specified 'numWaiters' by up to the
+        // specified 'maxCount' without making it negative, and return the
+        // amount by which it was decremented.
+
+    // PRIVATE MANIPULATORS
+    void commitPop(Int64 position);
+        // Destroy the element (if any) held in the cell at the specified
+        // 'position', and mark that cell free for the push that will reuse it.
+        // The behavior is undefined unless the cell at 'position' was reserved
+        // by the calling thread with 'reservePop'.
+
+    void commitPush(Int64 position, bool hasValue);
+        // Mark the cell at the specified 'position' as holding a value, and
+        // record whether the cell actually contains a constructed element per
+        // the specified 'hasValue' flag.  The behavior is undefined unless the
+        // cell at 'position' was reserved by the calling thread with
+        // 'reservePush'.
+
+    Node& nodeAt(Int64 position) const;
+        // Return a reference providing modifiable access to the cell that
+        // corresponds to the specified 'position'.
+
+    Int64 reservePop(Int64 *position, Int64 maxCount);
+        // Reserve up to the specified 'maxCount' consecutive cells holding
+        // values at the front of this queue with a single atomic operation,
+        // load the position of the first reserved cell into the specified
+        // 'position', and return the number of reserved cells (0 if this queue
+        // is empty).  The behavior is undefined unless '0 < maxCount'.
+
+    Int64 reservePush(Int64 *position, Int64 maxCount);
+        // Reserve up to the specified 'maxCount' consecutive free cells at the
+        // back of this queue with a single atomic operation, load the position
+        // of the first reserved cell into the specified 'position', and return
+        // the number of reserved cells (0 if this queue is full).  The
+        // behavior is undefined unless '0 < maxCount'.
+
+    void waitToPop();
+        // Block the calling thread until it is woken up by a push, unless the
+        // front cell of this queue is ready to be popped.
+
+    void waitToPush();
+        // Block the calling thread until it is woken up by a pop or by
+        // 'disable', unless the back cell of this queue is free or this queue
+        // is disabled.
+
+    void wakePoppers(Int64 numPushed);
+        // Release up to the specified 'numPushed' threads blocked waiting to
+        // pop an element if the front cell of this queue is ready to be
+        // popped.
+
+    void wakePushers(Int64 numPopped);
+        // Release up to the specified 'numPopped' threads blocked waiting to
+        // push an element if the back cell of this queue is free.
+
+    // PRIVATE ACCESSORS
+    bool isFrontReady() const;
+        // Return 'true' if the cell at the front of this queue holds a value
+        // (i.e., a pop could be reserved), and 'false' otherwise.  Note that
+        // this method loads the state of the cell with full sequential
+        // consistency.
+
+    bool isBackFree() const;
+        // Return 'true' if the cell at the back of this queue is free (i.e., a
+        // push could be reserved), and 'false' otherwise.  Note that this
+        // method loads the state of the cell with full sequential consistency.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(BoundedQueue, bslma::UsesBslmaAllocator);
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_MAX_CAPACITY       = 1 << 30,  // maximum (rounded) capacity
+
+        k_DEFAULT_SPIN_COUNT = 128       // default number of retries of a
+                                         // blocking operation before it
+                                         // blocks
+    };
+
+    // CREATORS
+    explicit
+    BoundedQueue(bsl::size_t capacity, bslma::Allocator *basicAllocator = 0);
+    BoundedQueue(bsl::size_t       capacity,
+                 int               spinCount,
+                 bslma::Allocator *basicAllocator = 0);
+        // Create a thread-enabled lock-free queue having at least the
+        // specified 'capacity' (rounded up to the next power of two, and at
+        // least 2).
+        // Optionally specify a 'spinCount' indicating the number of times a
+        // blocking operation retries before blocking the calling thread; if
+        // 'spinCount' is not specified, 'k_DEFAULT_SPIN_COUNT' is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '0 < capacity',
+        // 'capacity <= k_MAX_CAPACITY', and '0 <= spinCount'.
+
+    ~BoundedQueue();
+        // Destroy this object.
+
+    // MANIPULATORS
+    int pushBack(const TYPE& value);
+        // Append the specified 'value' to the back of this queue, blocking
+        // until either space is available - if necessary - or the queue is
+        // disabled.  Return 0 on success, and a nonzero value if the queue is
+        // disabled.
+
+    int tryPushBack(const TYPE& value);
+        // Attempt to append the specified 'value' to the back of this queue
+        // without blocking.  Return 0 on success, a negative value if the
+        // queue is disabled, and a positive value if the queue is full.
+
+    bsl::size_t pushBackBatch(const TYPE *values, bsl::size_t numValues);
+        // Append the specified 'numValues' elements of the specified 'values'
+        // array to the back of this queue (in order), blocking as necessary
+        // until space is available or the queue is disabled.  Return the
+        // number of values pushed, which is 'numValues' unless the queue is
+        // (or becomes) disabled.  See {Batch Operations}.
+
+    bsl::size_t tryPushBackBatch(const TYPE *values, bsl::size_t numValues);
+        // Attempt to append, without blocking, the longest prefix of the
+        // specified 'numValues' elements of the specified 'values' array for
+        // which there is space at the back of this queue, using a single
+        // reservation.  Return the number of values pushed, which is 0 if the
+        // queue is full or disabled.  See {Batch Operations}.
+
+    void popFront(TYPE *value);
+        // Remove the element from the front of this queue and load that
+        // element into the specified 'value'.  If the queue is empty, block
+        // until it is not empty.
+
+    TYPE popFront();
+        // Remove the element from the front of this queue and return its
+        // value.  If the queue is empty, block until it is not empty.
+
+    int tryPopFront(TYPE *value);
+        // Attempt to remove the element from the front of this queue without
+        // blocking, and, if successful, load the specified 'value' with the
+        // removed element.  Return 0 on success, and a non-zero value if the
+        // queue was empty.  On failure, 'value' is not changed.
+
+    bsl::size_t popFrontBatch(TYPE *buffer, bsl::size_t maxValues);
+        // Remove up to the specified 'maxValues' elements from the front of
+        // this queue, and load them (in order) into the leading elements of
+        // the specified 'buffer' array.  If the queue is empty, block until it
+        // is not empty.  Return the number of elements removed, which is
+        // always positive.  The behavior is undefined unless '0 < maxValues'
+        // and 'buffer' has at least 'maxValues' elements.  See
+        // {Batch Operations}.
+
+    bsl::size_t tryPopFrontBatch(TYPE *buffer, bsl::size_t maxValues);
+        // Attempt to remove, without blocking, up to the specified 'maxValues'
+        // elements from the front of this queue using a single reservation,
+        // and load them (in order) into the leading elements of the specified
+        // 'buffer' array.  Return the number of elements removed, which is 0
+        // if the queue was empty.  The behavior is undefined unless 'buffer'
+        // has at least 'maxValues' elements.  See {Batch Operations}.
+
+    void removeAll();
+        // Remove all items from this queue.  Note that this operation is not
+        // atomic; if other threads are concurrently pushing items into the
+        // queue the result of 'numElements' after this function returns is
+        // not guaranteed to be 0.
+
+    void disable();
+        // Disable this queue.  All subsequent invocations of 'pushBack',
+        // 'tryPushBack', 'pushBackBatch', and 'tryPushBackBatch' will fail
+        // immediately.  All blocked invocations of 'pushBack' and
+        // 'pushBackBatch' will fail immediately.  If the queue is already
+        // disabled, this method has no effect.
+
+    void enable();
+        // Enable queuing.  If the queue is not disabled, this call has no
+        // effect.
+
+    // ACCESSORS
+    int capacity() const;
+        // Return the maximum number of elements that may be stored in this
+        // queue.  Note that this value is the capacity supplied at
+        // construction rounded up to the next power of two (and at least 2).
+
+    bool isEmpty() const;
+        // Return 'true' if this queue is empty (has no elements), or 'false'
+        // otherwise.
+
+    bool isEnabled() const;
+        // Return 'true' if this queue is enabled, and 'false' otherwise.  Note
+        // that the queue is created in the "enabled" state.
+
+    bool isFull() const;
+        // Return 'true' if this queue is full (when the number of elements
+        // currently in this queue equals its capacity), or 'false' otherwise.
+
+    int numElements() const;
+        // Return a snapshot of the number of elements currently in this queue.
+        // Note that cells reserved by a push that has not yet completed are
+        // counted as elements.
+
+    int spinCount() const;
+        // Return the number of times a blocking operation on this queue
+        // retries before blocking the calling thread.
+};
+
+                     // ==================================
+                     // class BoundedQueue<TYPE>::PopGuard
+                     // ==================================
+
+template <class TYPE>
+class BoundedQueue<TYPE>::PopGuard {
+    // This class provides a guard that, upon its destruction, removes from
+    // the 'BoundedQueue' supplied at construction the cells in a range of
+    // positions that were reserved for popping, and destroys the elements they
+    // hold.  Note that this guard provides exception safety when the
+    // assignment operator of 'TYPE' throws while popping.
+
+    // DATA
+    BoundedQueue *d_queue_p;   // queue being popped from
+    Int64         d_position;  // position of next cell to commit
+    Int64         d_end;       // position past the last reserved cell
+    Int64         d_count;     // number of reserved cells
+
+  private:
+    // NOT IMPLEMENTED
+    PopGuard(const PopGuard&);
+    PopGuard& operator=(const PopGuard&);
+
+  public:
+    // CREATORS
+    PopGuard(BoundedQueue *queue, Int64 position, Int64 count);
+        // Create a guard managing the specified 'count' cells of the specified
+        // 'queue' starting at the specified 'position'.
+
+    ~PopGuard();
+        // Commit the pop of every managed cell not yet committed, and wake up
+        // a corresponding number of blocked pushers.
+
+    // MANIPULATORS
+    void commitNext();
+        // Commit the pop of the next managed cell.
+};
+
+                   // =====================================
+                   // class BoundedQueue<TYPE>::PushProctor
+                   // =====================================
+
+template <class TYPE>
+class BoundedQueue<TYPE>::PushProctor {
+    // This class provides a proctor that, upon its destruction, commits the
+    // cells in a range of positions of the 'BoundedQueue' supplied at
+    // construction, which were reserved for pushing, as *not* holding a value.
+    // Note that this proctor provides exception safety when the copy
+    // constructor of 'TYPE' throws while pushing.
+
+    // DATA
+    BoundedQueue *d_queue_p;   // queue being pushed to
+    Int64         d_position;  // position of next cell to commit
+    Int64         d_end;       // position past the last reserved cell
+
+  private:
+    // NOT IMPLEMENTED
+    PushProctor(const PushProctor&);
+    PushProctor& operator=(const PushProctor&);
+
+  public:
+    // CREATORS
+    PushProctor(BoundedQueue *queue, Int64 position, Int64 count);
+        // Create a proctor managing the specified 'count' cells of the
+        // specified 'queue' starting at the specified 'position'.
+
+    ~PushProctor();
+        // Commit every managed cell not yet committed as not holding a value.
+
+    // MANIPULATORS
+    void commitNext();
+        // Commit the next managed cell as holding a value.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+// See the .cpp for an implementation note.
+
+                            // ------------------
+                            // class BoundedQueue
+                            // ------------------
+
+// PRIVATE CLASS METHODS
+template <class TYPE>
+int BoundedQueue<TYPE>::claimWaiters(bsls::AtomicInt *numWaiters,
+                                     Int64            maxCount)
+{
+    int numWaiting = *numWaiters;
+    while (0 < numWaiting) {
+        const int count   = static_cast<int>(
+                                 bsl::min(static_cast<Int64>(numWaiting),
+                                          maxCount));
+        const int current = numWaiters->testAndSwap(numWaiting,
+                                                    numWaiting - count);
+        if (current == numWaiting) {
+            return count;                                             // RETURN
+        }
+        numWaiting = current;
+    }
+    return 0;
+}
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue<TYPE>::commitPop(Int64 position)
+{
+    Node& node = nodeAt(position);
+
+    if (node.d_hasValue) {
+        bslalg::ScalarDestructionPrimitives::destroy(&node.d_value.object());
+    }
+
+    // Note that this store must be sequentially consistent; see
+    // {Synchronization} in the implementation note.
+
+    node.d_sequence = position + d_capacity;
+}
+
+template <class TYPE>
+inline
+void BoundedQueue<TYPE>::commitPush(Int64 position, bool hasValue)
+{
+    Node& node = nodeAt(position);
+
+    node.d_hasValue = hasValue;
+
+    // Note that this store must be sequentially consistent; see
+    // {Synchronization} in the implementation note.
+
+    node.d_sequence = position + 1;
+}
+
+template <class TYPE>
+inline
+typename BoundedQueue<TYPE>::Node&
+BoundedQueue<TYPE>::nodeAt(Int64 position) const
+{
+    return *reinterpret_cast<Node *>(
+                                d_nodes_p + (position & d_mask) * k_NODE_SIZE);
+}
+
+template <class TYPE>
+typename BoundedQueue<TYPE>::Int64
+BoundedQueue<TYPE>::reservePop(Int64 *position, Int64 maxCount)
+{
+    BSLS_ASSERT(position);
+    BSLS_ASSERT(0 < maxCount);
+
+    maxCount = bsl::min(maxCount, d_capacity);
+
+    Int64 pos = d_popPosition.loadRelaxed();
+
+    while (true) {
+        Int64 count = 0;
+        while (count < maxCount
+            && nodeAt(pos + count).d_sequence.loadAcquire() ==
+                                                             pos + count + 1) {
+            ++count;
+        }
+
+        if (0 == count) {
+            const Int64 sequence = nodeAt(pos).d_sequence.loadAcquire();
+            if (sequence < pos + 1) {
+                // The front cell has not been pushed: the queue is empty.
+
+                return 0;                                             // RETURN
+            }
+
+            // 'pos' is stale.
+
+            pos = d_popPosition.loadRelaxed();
+            continue;
+        }
+
+        const Int64 current = d_popPosition.testAndSwap(pos, pos + count);
+        if (current == pos) {
+            *position = pos;
+            return count;                                             // RETURN
+        }
+        pos = current;
+    }
+}
+
+template <class TYPE>
+typename BoundedQueue<TYPE>::Int64
+BoundedQueue<TYPE>::reservePush(Int64 *position, Int64 maxCount)
+{
+    BSLS_ASSERT(position);
+    BSLS_ASSERT(0 < maxCount);
+
+    maxCount = bsl::min(maxCount, d_capacity);
+
+    Int64 pos = d_pushPosition.loadRelaxed();
+
+    while (true) {
+        Int64 count = 0;
+        while (count < maxCount
+            && nodeAt(pos + count).d_sequence.loadAcquire() == pos + count) {
+            ++count;
+        }
+
+        if (0 == count) {
+            const Int64 sequence = nodeAt(pos).d_sequence.loadAcquire();
+            if (sequence < pos) {
+                // The back cell has not been popped: the queue is full.
+
+                return 0;                                             // RETURN
+            }
+
+            // 'pos' is stale.
+
+            pos = d_pushPosition.loadRelaxed();
+            continue;
+        }
+
+        const Int64 current = d_pushPosition.testAndSwap(pos, pos + count);
+        if (current == pos) {
+            *position = pos;
+            return count;                                             // RETURN
+        }
+        pos = current;
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::waitToPop()
+{
+    d_numWaitingPoppers.add(1);
+
+    // Note that 'isFrontReady' loads the front cell with full sequential
+    // consistency, which is required to ensure the visibility of the
+    // preceding change to 'd_numWaitingPoppers' to a concurrent push.
+
+    if (!isFrontReady()) {
+        d_popControlSema.wait();
+        return;                                                       // RETURN
+    }
+
+    // Withdraw the registration.  If every registration has already been
+    // claimed by a pusher, a post is (or will be) pending for this thread.
+
+    if (0 == claimWaiters(&d_numWaitingPoppers, 1)) {
+        d_popControlSema.wait();
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::waitToPush()
+{
+    d_numWaitingPushers.add(1);
+
+    // Note that 'isBackFree' loads the back cell with full sequential
+    // consistency, which is required to ensure the visibility of the
+    // preceding change to 'd_numWaitingPushers' to a concurrent pop.
+
+    if (!isBackFree() && isEnabled()) {
+        d_pushControlSema.wait();
+        return;                                                       // RETURN
+    }
+
+    // Withdraw the registration.  If every registration has already been
+    // claimed by a popper, a post is (or will be) pending for this thread.
+
+    if (0 == claimWaiters(&d_numWaitingPushers, 1)) {
+        d_pushControlSema.wait();
+    }
+}
+
+template <class TYPE>
+inline
+void BoundedQueue<TYPE>::wakePoppers(Int64 numPushed)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numWaitingPoppers)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // A waiting popper can only make progress once the front cell is
+        // ready; the pusher committing that cell will wake it up otherwise.
+
+        if (!isFrontReady()) {
+            return;                                                   // RETURN
+        }
+
+        int numWakeUps = claimWaiters(&d_numWaitingPoppers, numPushed);
+        while (numWakeUps--) {
+            d_popControlSema.post();
+        }
+    }
+}
+
+template <class TYPE>
+inline
+void BoundedQueue<TYPE>::wakePushers(Int64 numPopped)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_numWaitingPushers)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // A waiting pusher can only make progress once the back cell is free;
+        // the popper committing that cell will wake it up otherwise.
+
+        if (!isBackFree()) {
+            return;                                                   // RETURN
+        }
+
+        int numWakeUps = claimWaiters(&d_numWaitingPushers, numPopped);
+        while (numWakeUps--) {
+            d_pushControlSema.post();
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline
+bool BoundedQueue<TYPE>::isFrontReady() const
+{
+    const Int64 pos = d_popPosition;
+    return nodeAt(pos).d_sequence >= pos + 1;
+}
+
+template <class TYPE>
+inline
+bool BoundedQueue<TYPE>::isBackFree() const
+{
+    const Int64 pos = d_pushPosition;
+    return nodeAt(pos).d_sequence >= pos;
+}
+
+// CREATORS
+template <class TYPE>
+BoundedQueue<TYPE>::BoundedQueue(bsl::size_t       capacity,
+                                 bslma::Allocator *basicAllocator)
+: d_pushPosition(0)
+, d_pushPositionPad()
+, d_popPosition(0)
+, d_popPositionPad()
+, d_numWaitingPoppers(0)
+, d_popControlSema(0)
+, d_popControlSemaPad()
+, d_numWaitingPushers(0)
+, d_pushControlSema(0)
+, d_pushControlSemaPad()
+, d_disabledFlag(0)
+, d_capacity(static_cast<Int64>(bdlb::BitUtil::roundUpToBinaryPower(
+                       static_cast<bsl::uint64_t>(bsl::max(capacity,
+                                                           bsl::size_t(2))))))
+, d_mask(d_capacity - 1)
+, d_spinCount(k_DEFAULT_SPIN_COUNT)
+, d_buffer_p(0)
+, d_nodes_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(capacity <= k_MAX_CAPACITY);
+
+    d_buffer_p = d_allocator_p->allocate(
+                    static_cast<bsl::size_t>(d_capacity) * k_NODE_SIZE
+                                                         + k_CACHE_LINE_SIZE);
+    d_nodes_p  = static_cast<char *>(d_buffer_p)
+               + (k_CACHE_LINE_SIZE
+                  - reinterpret_cast<bsls::Types::UintPtr>(d_buffer_p)
+                                                    % k_CACHE_LINE_SIZE);
+
+    for (Int64 i = 0; i < d_capacity; ++i) {
+        new (d_nodes_p + i * k_NODE_SIZE) Node();
+        nodeAt(i).d_sequence.storeRelaxed(i);
+    }
+}
+
+template <class TYPE>
+BoundedQueue<TYPE>::BoundedQueue(bsl::size_t       capacity,
+                                 int               spinCount,
+                                 bslma::Allocator *basicAllocator)
+: d_pushPosition(0)
+, d_pushPositionPad()
+, d_popPosition(0)
+, d_popPositionPad()
+, d_numWaitingPoppers(0)
+, d_popControlSema(0)
+, d_popControlSemaPad()
+, d_numWaitingPushers(0)
+, d_pushControlSema(0)
+, d_pushControlSemaPad()
+, d_disabledFlag(0)
+, d_capacity(static_cast<Int64>(bdlb::BitUtil::roundUpToBinaryPower(
+                       static_cast<bsl::uint64_t>(bsl::max(capacity,
+                                                           bsl::size_t(2))))))
+, d_mask(d_capacity - 1)
+, d_spinCount(spinCount)
+, d_buffer_p(0)
+, d_nodes_p(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(0 < capacity);
+    BSLS_ASSERT(capacity <= k_MAX_CAPACITY);
+    BSLS_ASSERT(0 <= spinCount);
+
+    d_buffer_p = d_allocator_p->allocate(
+                    static_cast<bsl::size_t>(d_capacity) * k_NODE_SIZE
+                                                         + k_CACHE_LINE_SIZE);
+    d_nodes_p  = static_cast<char *>(d_buffer_p)
+               + (k_CACHE_LINE_SIZE
+                  - reinterpret_cast<bsls::Types::UintPtr>(d_buffer_p)
+                                                    % k_CACHE_LINE_SIZE);
+
+    for (Int64 i = 0; i < d_capacity; ++i) {
+        new (d_nodes_p + i * k_NODE_SIZE) Node();
+        nodeAt(i).d_sequence.storeRelaxed(i);
+    }
+}
+
+template <class TYPE>
+BoundedQueue<TYPE>::~BoundedQueue()
+{
+    removeAll();
+    d_allocator_p->deallocate(d_buffer_p);
+}
+
+// MANIPULATORS
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPushBack(const TYPE& value)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_disabledFlag.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -1;                                                    // RETURN
+    }
+
+    Int64 position;
+    if (0 == reservePush(&position, 1)) {
+        return 1;                                                     // RETURN
+    }
+
+    PushProctor proctor(this, position, 1);
+    bslalg::ScalarPrimitives::copyConstruct(&nodeAt(position).d_value.object(),
+                                            value,
+                                            d_allocator_p);
+    proctor.commitNext();
+
+    wakePoppers(1);
+    wakePushers(1);
+    return 0;
+}
+
+template <class TYPE>
+bsl::size_t BoundedQueue<TYPE>::tryPushBackBatch(const TYPE  *values,
+                                                 bsl::size_t  numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    if (0 == numValues
+     || BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_disabledFlag.loadRelaxed())) {
+        return 0;                                                     // RETURN
+    }
+
+    Int64       position;
+    const Int64 count = reservePush(&position, static_cast<Int64>(numValues));
+
+    if (0 == count) {
+        return 0;                                                     // RETURN
+    }
+
+    {
+        PushProctor proctor(this, position, count);
+        for (Int64 i = 0; i < count; ++i) {
+            bslalg::ScalarPrimitives::copyConstruct(
+                                       &nodeAt(position + i).d_value.object(),
+                                       values[i],
+                                       d_allocator_p);
+            proctor.commitNext();
+        }
+    }
+
+    wakePoppers(count);
+    wakePushers(1);
+    return static_cast<bsl::size_t>(count);
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::pushBack(const TYPE& value)
+{
+    int retval;
+    int spin = d_spinCount;
+    while (0 != (retval = tryPushBack(value))) {
+        if (retval < 0) {
+            // The queue is disabled.
+
+            return retval;                                            // RETURN
+        }
+
+        if (spin > 0) {
+            --spin;
+            continue;
+        }
+
+        waitToPush();
+    }
+
+    return 0;
+}
+
+template <class TYPE>
+bsl::size_t BoundedQueue<TYPE>::pushBackBatch(const TYPE  *values,
+                                              bsl::size_t  numValues)
+{
+    BSLS_ASSERT(values || 0 == numValues);
+
+    bsl::size_t numPushed = 0;
+    int         spin      = d_spinCount;
+
+    while (numPushed < numValues) {
+        const bsl::size_t count = tryPushBackBatch(values + numPushed,
+                                                   numValues - numPushed);
+        if (count) {
+            numPushed += count;
+            continue;
+        }
+
+        if (!isEnabled()) {
+            break;
+        }
+
+        if (spin > 0) {
+            --spin;
+            continue;
+        }
+
+        waitToPush();
+    }
+
+    return numPushed;
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::tryPopFront(TYPE *value)
+{
+    BSLS_ASSERT(value);
+
+    Int64 position;
+    while (0 != reservePop(&position, 1)) {
+        PopGuard guard(this, position, 1);
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(nodeAt(position).d_hasValue)) {
+            *value = nodeAt(position).d_value.object();
+            return 0;                                                 // RETURN
+        }
+
+        // The push of this cell was abandoned; skip it.
+    }
+    return 1;
+}
+
+template <class TYPE>
+bsl::size_t BoundedQueue<TYPE>::tryPopFrontBatch(TYPE        *buffer,
+                                                 bsl::size_t  maxValues)
+{
+    BSLS_ASSERT(buffer || 0 == maxValues);
+
+    bsl::size_t numPopped = 0;
+
+    while (0 < maxValues) {
+        Int64       position;
+        const Int64 count = reservePop(&position,
+                                       static_cast<Int64>(maxValues));
+        if (0 == count) {
+            break;
+        }
+
+        PopGuard guard(this, position, count);
+        for (Int64 i = 0; i < count; ++i) {
+            Node& node = nodeAt(position + i);
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(node.d_hasValue)) {
+                buffer[numPopped++] = node.d_value.object();
+                --maxValues;
+            }
+            guard.commitNext();
+        }
+
+        if (numPopped) {
+            // Only retry if every reserved cell was abandoned.
+
+            break;
+        }
+    }
+    return numPopped;
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::popFront(TYPE *value)
+{
+    int spin = d_spinCount;
+    while (0 != tryPopFront(value)) {
+        if (spin > 0) {
+            --spin;
+            continue;
+        }
+
+        waitToPop();
+    }
+}
+
+template <class TYPE>
+TYPE BoundedQueue<TYPE>::popFront()
+{
+    Int64 position;
+    int   spin = d_spinCount;
+
+    while (true) {
+        if (0 != reservePop(&position, 1)) {
+            if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(
+                                              nodeAt(position).d_hasValue)) {
+                break;
+            }
+
+            // The push of this cell was abandoned; skip it.
+
+            commitPop(position);
+            wakePushers(1);
+            wakePoppers(1);
+            continue;
+        }
+
+        if (spin > 0) {
+            --spin;
+            continue;
+        }
+
+        waitToPop();
+    }
+
+    PopGuard guard(this, position, 1);
+    return TYPE(nodeAt(position).d_value.object());
+}
+
+template <class TYPE>
+bsl::size_t BoundedQueue<TYPE>::popFrontBatch(TYPE        *buffer,
+                                              bsl::size_t  maxValues)
+{
+    BSLS_ASSERT(buffer);
+    BSLS_ASSERT(0 < maxValues);
+
+    bsl::size_t numPopped;
+    int         spin = d_spinCount;
+
+    while (0 == (numPopped = tryPopFrontBatch(buffer, maxValues))) {
+        if (spin > 0) {
+            --spin;
+            continue;
+        }
+
+        waitToPop();
+    }
+    return numPopped;
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::removeAll()
+{
+    Int64 position;
+    Int64 count;
+    while (0 != (count = reservePop(&position, d_capacity))) {
+        PopGuard guard(this, position, count);
+    }
+}
+
+template <class TYPE>
+void BoundedQueue<TYPE>::disable()
+{
+    d_disabledFlag = 1;
+
+    // Claim every registered pusher.
+
+    const int numWaitingPushers = d_numWaitingPushers.swap(0);
+
+    for (int i = 0; i < numWaitingPushers; ++i) {
+        d_pushControlSema.post();
+    }
+}
+
+template <class TYPE>
+inline
+void BoundedQueue<TYPE>::enable()
+{
+    d_disabledFlag = 0;
+}
+
+// ACCESSORS
+template <class TYPE>
+inline
+int BoundedQueue<TYPE>::capacity() const
+{
+    return static_cast<int>(d_capacity);
+}
+
+template <class TYPE>
+inline
+bool BoundedQueue<TYPE>::isEmpty() const
+{
+    return 0 >= numElements();
+}
+
+template <class TYPE>
+inline
+bool BoundedQueue<TYPE>::isEnabled() const
+{
+    return 0 == d_disabledFlag;
+}
+
+template <class TYPE>
+inline
+bool BoundedQueue<TYPE>::isFull() const
+{
+    return capacity() <= numElements();
+}
+
+template <class TYPE>
+int BoundedQueue<TYPE>::numElements() const
+{
+    const Int64 popPosition  = d_popPosition;
+    const Int64 pushPosition = d_pushPosition;
+
+    // The two positions are not loaded atomically, so the difference may be
+    // temporarily outside of '[0 .. d_capacity]'.
+
+    const Int64 length = pushPosition - popPosition;
+    return static_cast<int>(bsl::max(Int64(0), bsl::min(length, d_capacity)));
+}
+
+template <class TYPE>
+inline
+int BoundedQueue<TYPE>::spinCount() const
+{
+    return d_spinCount;
+}
+
+                     // ----------------------------------
+                     // class BoundedQueue<TYPE>::PopGuard
+                     // ----------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue<TYPE>::PopGuard::PopGuard(BoundedQueue *queue,
+                                       Int64         position,
+                                       Int64         count)
+: d_queue_p(queue)
+, d_position(position)
+, d_end(position + count)
+, d_count(count)
+{
+}
+
+template <class TYPE>
+BoundedQueue<TYPE>::PopGuard::~PopGuard()
+{
+    while (d_position < d_end) {
+        commitNext();
+    }
+
+    // Wake up pushers once for the whole reservation, and pass the wake-up on
+    // to another popper if more elements are ready.
+
+    d_queue_p->wakePushers(d_count);
+    d_queue_p->wakePoppers(1);
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue<TYPE>::PopGuard::commitNext()
+{
+    d_queue_p->commitPop(d_position++);
+}
+
+                   // -------------------------------------
+                   // class BoundedQueue<TYPE>::PushProctor
+                   // -------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+BoundedQueue<TYPE>::PushProctor::PushProctor(BoundedQueue *queue,
+                                             Int64         position,
+                                             Int64         count)
+: d_queue_p(queue)
+, d_position(position)
+, d_end(position + count)
+{
+}
+
+template <class TYPE>
+inline
+BoundedQueue<TYPE>::PushProctor::~PushProctor()
+{
+    while (d_position < d_end) {
+        d_queue_p->commitPush(d_position++, false);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void BoundedQueue<TYPE>::PushProctor::commitNext()
+{
+    d_queue_p->commitPush(d_position++, true);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
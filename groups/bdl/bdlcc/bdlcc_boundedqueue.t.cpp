@@ -0,0 +1,1383 @@
+// bdlcc_boundedqueue.t.cpp                                           -*-C++-*-
+#include <bdlcc_boundedqueue.h>
+
+#include <bdlcc_fixedqueue.h>
+#include <bdlcc_queue.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_configuration.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'bdlcc::BoundedQueue' is a lock-free queue whose state is managed by the
+// sequence numbers of its cells and by two positions.  We first verify the
+// single-threaded behavior of the primary manipulators ('tryPushBack',
+// 'tryPopFront') and basic accessors, including wrap-around of the positions
+// over many laps of the ring buffer.  We then verify the batch operations,
+// which must reserve as many cells as are available (up to the requested
+// number) and preserve the order of the elements.  Allocator propagation,
+// 'removeAll', and exception safety are verified with 'bslma::TestAllocator'
+// and with an element type whose copy constructor throws on demand.  The
+// blocking behavior (and its interaction with 'disable') is verified with
+// helper threads.  Finally, a concurrency test with several producers and
+// consumers, using both single-element and batch operations, verifies that
+// every element is popped exactly once, and that the elements pushed by each
+// producer are popped in order.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] BoundedQueue(bsl::size_t capacity, bslma::Allocator *ba = 0);
+// [ 2] BoundedQueue(bsl::size_t capacity, int spinCount, Allocator *ba = 0);
+// [ 5] ~BoundedQueue();
+//
+// MANIPULATORS
+// [ 6] int pushBack(const TYPE& value);
+// [ 2] int tryPushBack(const TYPE& value);
+// [ 3] bsl::size_t pushBackBatch(const TYPE *values, bsl::size_t numValues);
+// [ 3] bsl::size_t tryPushBackBatch(const TYPE *values, bsl::size_t n);
+// [ 6] void popFront(TYPE *value);
+// [ 6] TYPE popFront();
+// [ 2] int tryPopFront(TYPE *value);
+// [ 6] bsl::size_t popFrontBatch(TYPE *buffer, bsl::size_t maxValues);
+// [ 3] bsl::size_t tryPopFrontBatch(TYPE *buffer, bsl::size_t maxValues);
+// [ 5] void removeAll();
+// [ 4] void disable();
+// [ 4] void enable();
+//
+// ACCESSORS
+// [ 2] int capacity() const;
+// [ 2] bool isEmpty() const;
+// [ 4] bool isEnabled() const;
+// [ 2] bool isFull() const;
+// [ 2] int numElements() const;
+// [ 2] int spinCount() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] CONCURRENCY TEST
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: 'BoundedQueue' vs. 'FixedQueue' vs. 'Queue'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   THREAD-SAFE OUTPUT AND ASSERT MACROS
+// ----------------------------------------------------------------------------
+
+static bslmt::Mutex coutMutex;
+
+#define ASSERTT(X) {                                                          \
+   if (!(X)) {                                                                \
+       bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);                      \
+       aSsErT(1, #X, __LINE__); } }
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::BoundedQueue<int> Obj;
+typedef bsls::Types::Int64       Int64;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                              // ==============
+                              // class Throwing
+                              // ==============
+
+class Throwing {
+    // This class provides a value-semantic type whose copy constructor throws
+    // an 'int' exception if the value being copied is negative.
+
+    // DATA
+    int d_value;
+
+  public:
+    // CREATORS
+    Throwing()
+    : d_value(0)
+    {
+    }
+
+    explicit Throwing(int value)
+    : d_value(value)
+    {
+    }
+
+    Throwing(const Throwing& original)
+    : d_value(original.d_value)
+    {
+        if (d_value < 0) {
+            throw d_value;
+        }
+    }
+
+    // MANIPULATORS
+    Throwing& operator=(const Throwing& rhs)
+    {
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+void pushOneThread(Obj *queue, int value, bsls::AtomicInt *result)
+    // Push the specified 'value' onto the specified 'queue', and load the
+    // status of the push into the specified 'result'.
+{
+    *result = queue->pushBack(value);
+}
+
+void pushBatchThread(Obj             *queue,
+                     const int       *values,
+                     int              numValues,
+                     bsls::AtomicInt *result)
+    // Push the specified 'numValues' elements of the specified 'values' onto
+    // the specified 'queue', and load the number of values pushed into the
+    // specified 'result'.
+{
+    *result = static_cast<int>(queue->pushBackBatch(values, numValues));
+}
+
+void popOneThread(Obj *queue, bsls::AtomicInt *result)
+    // Pop an element from the specified 'queue', and load it into the
+    // specified 'result'.
+{
+    *result = queue->popFront();
+}
+
+                              // ================
+                              // struct TestValue
+                              // ================
+
+struct TestValue {
+    // This 'struct' describes a value pushed in the concurrency test.
+
+    int d_producer;  // index of the producer thread
+    int d_sequence;  // sequence number within the producer
+};
+
+typedef bdlcc::BoundedQueue<TestValue> TestQueue;
+
+void concurrentProducer(TestQueue       *queue,
+                        bslmt::Barrier  *barrier,
+                        int              producer,
+                        int              numValues,
+                        int              batchSize)
+    // Wait on the specified 'barrier', then push the specified 'numValues'
+    // values, tagged with the specified 'producer' index, onto the specified
+    // 'queue', in batches of the specified 'batchSize' (using single-element
+    // operations if 'batchSize' is 1).
+{
+    barrier->wait();
+
+    bsl::vector<TestValue> batch(batchSize);
+    int sequence = 0;
+    while (sequence < numValues) {
+        if (1 == batchSize) {
+            TestValue value = { producer, sequence++ };
+            ASSERTT(0 == queue->pushBack(value));
+            continue;
+        }
+        int n = 0;
+        for (; n < batchSize && sequence < numValues; ++n) {
+            batch[n].d_producer = producer;
+            batch[n].d_sequence = sequence++;
+        }
+        ASSERTT(static_cast<bsl::size_t>(n) ==
+                                        queue->pushBackBatch(&batch[0], n));
+    }
+}
+
+void concurrentConsumer(TestQueue                    *queue,
+                        bslmt::Barrier               *barrier,
+                        int                           batchSize,
+                        bsl::vector<bsl::vector<int> > *received)
+    // Wait on the specified 'barrier', then pop values from the specified
+    // 'queue' in batches of up to the specified 'batchSize', and append the
+    // sequence number of each value to the element of the specified
+    // 'received' vector indexed by its producer, until a sentinel value
+    // (having a negative producer index) is popped; push the sentinel back
+    // onto 'queue' before returning.
+{
+    barrier->wait();
+
+    bsl::vector<TestValue> batch(batchSize);
+    while (true) {
+        bsl::size_t n = 1;
+        if (1 == batchSize) {
+            queue->popFront(&batch[0]);
+        }
+        else {
+            n = queue->popFrontBatch(&batch[0], batchSize);
+        }
+        for (bsl::size_t i = 0; i < n; ++i) {
+            if (batch[i].d_producer < 0) {
+                // Put the sentinel back for the other consumers.
+
+                ASSERTT(0 == queue->pushBack(batch[i]));
+                return;                                               // RETURN
+            }
+            (*received)[batch[i].d_producer].push_back(batch[i].d_sequence);
+        }
+    }
+}
+
+                           // ===================
+                           // Performance Helpers
+                           // ===================
+
+template <class QUEUE>
+struct QueueAdapter {
+    // This 'struct' provides a uniform interface for pushing and popping
+    // single elements on the queue types compared in the performance test.
+
+    static void push(QUEUE *queue, int value)
+    {
+        queue->pushBack(value);
+    }
+
+    static int pop(QUEUE *queue)
+    {
+        return queue->popFront();
+    }
+};
+
+template <class QUEUE>
+void benchmarkProducer(QUEUE *queue, bslmt::Barrier *barrier, int numValues)
+{
+    barrier->wait();
+    for (int i = 0; i < numValues; ++i) {
+        QueueAdapter<QUEUE>::push(queue, i);
+    }
+}
+
+template <class QUEUE>
+void benchmarkConsumer(QUEUE *queue, bslmt::Barrier *barrier, int numValues)
+{
+    barrier->wait();
+    for (int i = 0; i < numValues; ++i) {
+        QueueAdapter<QUEUE>::pop(queue);
+    }
+}
+
+void benchmarkBatchProducer(Obj            *queue,
+                            bslmt::Barrier *barrier,
+                            int             numValues,
+                            int             batchSize)
+{
+    bsl::vector<int> batch(batchSize, 1);
+    barrier->wait();
+    for (int i = 0; i < numValues; i += batchSize) {
+        queue->pushBackBatch(&batch[0], bsl::min(batchSize, numValues - i));
+    }
+}
+
+void benchmarkBatchConsumer(Obj            *queue,
+                            bslmt::Barrier *barrier,
+                            int             numValues,
+                            int             batchSize)
+{
+    bsl::vector<int> batch(batchSize);
+    barrier->wait();
+    int numPopped = 0;
+    while (numPopped < numValues) {
+        numPopped += static_cast<int>(queue->popFrontBatch(
+                                     &batch[0],
+                                     bsl::min(batchSize,
+                                              numValues - numPopped)));
+    }
+}
+
+template <class QUEUE>
+double runBenchmark(QUEUE *queue, int numThreads, int numValues)
+    // Run 'numThreads' producers and 'numThreads' consumers, each
+    // transferring the specified 'numValues' values through the specified
+    // 'queue', and return the elapsed wall time in seconds.
+{
+    bslmt::Barrier     barrier(2 * numThreads + 1);
+    bslmt::ThreadGroup threads;
+
+    threads.addThreads(bdlf::BindUtil::bind(&benchmarkProducer<QUEUE>,
+                                            queue,
+                                            &barrier,
+                                            numValues),
+                       numThreads);
+    threads.addThreads(bdlf::BindUtil::bind(&benchmarkConsumer<QUEUE>,
+                                            queue,
+                                            &barrier,
+                                            numValues),
+                       numThreads);
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+    barrier.wait();
+    threads.joinAll();
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+double runBatchBenchmark(Obj *queue,
+                         int  numThreads,
+                         int  numValues,
+                         int  batchSize)
+    // Run 'numThreads' producers and 'numThreads' consumers, each
+    // transferring the specified 'numValues' values through the specified
+    // 'queue' in batches of the specified 'batchSize', and return the elapsed
+    // wall time in seconds.
+{
+    bslmt::Barrier     barrier(2 * numThreads + 1);
+    bslmt::ThreadGroup threads;
+
+    threads.addThreads(bdlf::BindUtil::bind(&benchmarkBatchProducer,
+                                            queue,
+                                            &barrier,
+                                            numValues,
+                                            batchSize),
+                       numThreads);
+    threads.addThreads(bdlf::BindUtil::bind(&benchmarkBatchConsumer,
+                                            queue,
+                                            &barrier,
+                                            numValues,
+                                            batchSize),
+                       numThreads);
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+    barrier.wait();
+    threads.joinAll();
+    timer.stop();
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE_1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Handing Off Messages in Batches
+///- - - - - - - - - - - - - - - - - - - - -
+// In the following example a 'bdlcc::BoundedQueue' is used to hand off
+// messages from a "network" thread that reads messages in bursts to several
+// "worker" threads.  Both sides transfer messages in batches so that the cost
+// of synchronization is shared by all the messages of a batch.
+//
+// First, we define the type of the messages, and a function that processes a
+// message.  The details are unimportant for this example:
+//..
+    struct my_Message {
+        int d_sessionId;  // session the message was received on, or -1 to
+                          // request that the worker stop
+        int d_payload;    // message data
+    };
+
+    void myProcess(const my_Message& message, bsls::AtomicInt *total)
+    {
+        total->addRelaxed(message.d_payload);
+    }
+//..
+// Then, we define the function executed by each worker thread.  A worker pops
+// as many messages as are available (up to the size of its local buffer) and
+// processes them, until it receives a stop request:
+//..
+    void myWorker(bdlcc::BoundedQueue<my_Message> *queue,
+                  bsls::AtomicInt                 *total)
+    {
+        enum { k_BATCH_SIZE = 16 };
+
+        my_Message buffer[k_BATCH_SIZE];
+
+        while (true) {
+            bsl::size_t numPopped = queue->popFrontBatch(buffer,
+                                                         k_BATCH_SIZE);
+            for (bsl::size_t i = 0; i < numPopped; ++i) {
+                if (-1 == buffer[i].d_sessionId) {
+                    // Put the stop request back for the other workers.
+
+                    queue->pushBack(buffer[i]);
+                    return;                                           // RETURN
+                }
+                myProcess(buffer[i], total);
+            }
+        }
+    }
+//..
+// Note that a single batch may contain several elements, so a stop request
+// cannot be addressed to a particular worker.  Instead, the producer pushes a
+// single stop request after all the messages; the worker that pops it has
+// therefore processed every message preceding it, and pushes it back so that
+// it is eventually popped by every worker.
+//
+// Finally, we define the "network" thread function, which creates the queue
+// and the workers, pushes bursts of messages, and then pushes the stop
+// request:
+//..
+    void myNetworkThread(int numWorkers)
+    {
+        enum {
+            k_QUEUE_CAPACITY = 256,
+            k_BURST_SIZE     = 32,
+            k_NUM_BURSTS     = 100
+        };
+
+        bdlcc::BoundedQueue<my_Message> queue(k_QUEUE_CAPACITY);
+        bsls::AtomicInt                 total(0);
+
+        bslmt::ThreadGroup workers;
+        workers.addThreads(bdlf::BindUtil::bind(&myWorker, &queue, &total),
+                           numWorkers);
+
+        my_Message burst[k_BURST_SIZE];
+        for (int i = 0; i < k_NUM_BURSTS; ++i) {
+            for (int j = 0; j < k_BURST_SIZE; ++j) {
+                burst[j].d_sessionId = j;
+                burst[j].d_payload   = 1;
+            }
+            queue.pushBackBatch(burst, k_BURST_SIZE);
+        }
+
+        my_Message stop = { -1, 0 };
+        queue.pushBack(stop);
+
+        workers.joinAll();
+        ASSERT(k_BURST_SIZE * k_NUM_BURSTS == total);
+    }
+//..
+
+}  // close namespace USAGE_EXAMPLE_1
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        USAGE_EXAMPLE_1::myNetworkThread(4);
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 With several concurrent producers and consumers, every pushed
+        //:   value is popped exactly once.
+        //:
+        //: 2 The values pushed by a producer are popped in the order they were
+        //:   pushed (as observed by any single consumer).
+        //:
+        //: 3 Concerns 1 and 2 hold for single-element and batch operations,
+        //:   and for queues whose capacity is smaller than a batch.
+        //
+        // Plan:
+        //: 1 For a set of (capacity, number of threads, batch size) triples,
+        //:   run producer threads pushing sequentially numbered values
+        //:   (tagged with the producer index), and consumer threads recording
+        //:   the sequence numbers received from each producer.  Stop the
+        //:   consumers by pushing a sentinel value (which each consumer pushes
+        //:   back) after the producers are joined.  Verify that the sequence
+        //:   numbers received by each consumer from a given producer are
+        //:   increasing, and that the total number received from each
+        //:   producer is as expected.  (C-1..3)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        static const struct {
+            int d_line;
+            int d_capacity;
+            int d_numThreads;
+            int d_batchSize;
+        } DATA[] = {
+            //LINE  CAP  THREADS  BATCH
+            //----  ---  -------  -----
+            { L_,     2,       1,     1 },
+            { L_,     4,       2,     1 },
+            { L_,     4,       2,     8 },
+            { L_,    16,       4,     1 },
+            { L_,    16,       4,     5 },
+            { L_,   256,       4,    32 },
+            { L_,  1024,       8,    16 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        enum { k_NUM_VALUES = 20000 };
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE       = DATA[ti].d_line;
+            const int CAPACITY   = DATA[ti].d_capacity;
+            const int NUM_THREADS = DATA[ti].d_numThreads;
+            const int BATCH_SIZE = DATA[ti].d_batchSize;
+
+            if (veryVerbose) {
+                T_ P_(LINE) P_(CAPACITY) P_(NUM_THREADS) P(BATCH_SIZE)
+            }
+
+            bslma::TestAllocator ta("test", veryVeryVerbose);
+            TestQueue            mX(CAPACITY, &ta);
+
+            bsl::vector<bsl::vector<bsl::vector<int> > > received(
+                                                                 NUM_THREADS);
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                received[i].resize(NUM_THREADS);
+            }
+
+            bslmt::Barrier     barrier(2 * NUM_THREADS);
+            bslmt::ThreadGroup producers;
+            bslmt::ThreadGroup consumers;
+
+            for (int i = 0; i < NUM_THREADS; ++i) {
+                producers.addThread(bdlf::BindUtil::bind(&concurrentProducer,
+                                                         &mX,
+                                                         &barrier,
+                                                         i,
+                                                         (int)k_NUM_VALUES,
+                                                         BATCH_SIZE));
+                consumers.addThread(bdlf::BindUtil::bind(&concurrentConsumer,
+                                                         &mX,
+                                                         &barrier,
+                                                         BATCH_SIZE,
+                                                         &received[i]));
+            }
+
+            producers.joinAll();
+
+            TestValue sentinel = { -1, 0 };
+            ASSERTV(LINE, 0 == mX.pushBack(sentinel));
+
+            consumers.joinAll();
+
+            ASSERTV(LINE, 1 == mX.numElements());
+            ASSERTV(LINE, 0 > mX.popFront().d_producer);
+
+            for (int p = 0; p < NUM_THREADS; ++p) {
+                bsl::size_t total = 0;
+                for (int c = 0; c < NUM_THREADS; ++c) {
+                    const bsl::vector<int>& seq = received[c][p];
+                    total += seq.size();
+                    for (bsl::size_t i = 1; i < seq.size(); ++i) {
+                        ASSERTV(LINE, p, c, i, seq[i - 1] < seq[i]);
+                    }
+                }
+                ASSERTV(LINE, p, total, k_NUM_VALUES == total);
+            }
+            ASSERTV(LINE, mX.isEmpty());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // BLOCKING OPERATIONS
+        //
+        // Concerns:
+        //: 1 'popFront' and 'popFrontBatch' block while the queue is empty,
+        //:   and return once an element is pushed.
+        //:
+        //: 2 'pushBack' and 'pushBackBatch' block while the queue is full,
+        //:   and return once the required space is available.
+        //:
+        //: 3 Concerns 1 and 2 hold when the spin count is 0.
+        //
+        // Plan:
+        //: 1 Start a thread blocking in 'popFront' on an empty queue, wait,
+        //:   verify the thread has not completed, push a value, join the
+        //:   thread, and verify it received the value.  (C-1, 3)
+        //:
+        //: 2 Fill a queue, start a thread blocking in 'pushBack' (or
+        //:   'pushBackBatch' with more values than the capacity), pop values
+        //:   from the main thread with 'popFrontBatch', join the thread, and
+        //:   verify the expected values were popped in order.  (C-1..3)
+        //
+        // Testing:
+        //   int pushBack(const TYPE& value);
+        //   bsl::size_t pushBackBatch(const TYPE *values, bsl::size_t n);
+        //   void popFront(TYPE *value);
+        //   TYPE popFront();
+        //   bsl::size_t popFrontBatch(TYPE *buffer, bsl::size_t maxValues);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BLOCKING OPERATIONS" << endl
+                          << "===================" << endl;
+
+        for (int spinCount = 0; spinCount <= 1000; spinCount += 1000) {
+            if (veryVerbose) { T_ P(spinCount) }
+
+            {
+                Obj             mX(4, spinCount);
+                bsls::AtomicInt result(-1);
+
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                    &handle,
+                                    bdlf::BindUtil::bind(&popOneThread,
+                                                         &mX,
+                                                         &result)));
+                bslmt::ThreadUtil::microSleep(50 * 1000);
+                ASSERT(-1 == result);
+
+                ASSERT(0 == mX.pushBack(42));
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                ASSERT(42 == result);
+                ASSERT(mX.isEmpty());
+            }
+            {
+                Obj mX(4, spinCount);
+                for (int i = 0; i < 4; ++i) {
+                    ASSERT(0 == mX.pushBack(i));
+                }
+                ASSERT(mX.isFull());
+
+                bsls::AtomicInt           result(-1);
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                    &handle,
+                                    bdlf::BindUtil::bind(&pushOneThread,
+                                                         &mX,
+                                                         4,
+                                                         &result)));
+                bslmt::ThreadUtil::microSleep(50 * 1000);
+                ASSERT(-1 == result);
+
+                int value;
+                mX.popFront(&value);
+                ASSERT(0 == value);
+
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                ASSERT(0 == result);
+
+                for (int i = 1; i <= 4; ++i) {
+                    ASSERTV(i, i == mX.popFront());
+                }
+            }
+            {
+                enum { k_NUM_VALUES = 37 };
+
+                Obj mX(8, spinCount);
+                int values[k_NUM_VALUES];
+                for (int i = 0; i < k_NUM_VALUES; ++i) {
+                    values[i] = i;
+                }
+
+                bsls::AtomicInt           result(-1);
+                bslmt::ThreadUtil::Handle handle;
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                    &handle,
+                                    bdlf::BindUtil::bind(&pushBatchThread,
+                                                         &mX,
+                                                         values,
+                                                         (int)k_NUM_VALUES,
+                                                         &result)));
+
+                int expected = 0;
+                int buffer[5];
+                while (expected < k_NUM_VALUES) {
+                    bsl::size_t n = mX.popFrontBatch(buffer, 5);
+                    ASSERT(0 < n && n <= 5);
+                    for (bsl::size_t i = 0; i < n; ++i) {
+                        ASSERTV(expected, buffer[i], expected == buffer[i]);
+                        ++expected;
+                    }
+                }
+
+                ASSERT(0 == bslmt::ThreadUtil::join(handle));
+                ASSERT(k_NUM_VALUES == result);
+                ASSERT(mX.isEmpty());
+            }
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // MEMORY, 'removeAll', AND EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 The queue allocates from the supplied allocator (or the default
+        //:   allocator if none is supplied), and propagates its allocator to
+        //:   elements that use 'bslma' allocators.
+        //:
+        //: 2 'removeAll' and the destructor destroy every element, and the
+        //:   destructor releases all memory.
+        //:
+        //: 3 If the copy constructor throws during a push, the queue contains
+        //:   exactly the values copied before the exception, in order, and
+        //:   remains usable.
+        //
+        // Plan:
+        //: 1 Create queues of 'bsl::string' with and without a test allocator
+        //:   and verify allocations and element allocators.  Push long
+        //:   strings, call 'removeAll', and verify the memory in use by
+        //:   elements was released.  (C-1..2)
+        //:
+        //: 2 Push batches of 'Throwing' values in which one value throws, and
+        //:   verify the contents of the queue afterwards.  (C-3)
+        //
+        // Testing:
+        //   ~BoundedQueue();
+        //   void removeAll();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "MEMORY, 'removeAll', AND EXCEPTION SAFETY"
+                          << endl
+                          << "========================================="
+                          << endl;
+
+        const char *LONG = "a string long enough to require an allocation";
+
+        {
+            bslma::TestAllocator ta("test", veryVeryVerbose);
+            {
+                bdlcc::BoundedQueue<bsl::string> mX(8, &ta);
+                ASSERT(0 <  ta.numBlocksInUse());
+                ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+                const Int64 BASE = ta.numBlocksInUse();
+
+                for (int i = 0; i < 6; ++i) {
+                    ASSERT(0 == mX.tryPushBack(bsl::string(LONG, &ta)));
+                }
+                ASSERT(BASE + 6 == ta.numBlocksInUse());
+
+                bsl::string value(&ta);
+                ASSERT(0 == mX.tryPopFront(&value));
+                ASSERT(LONG == value);
+                ASSERT(&ta == value.get_allocator().mechanism());
+
+                mX.removeAll();
+                ASSERT(mX.isEmpty());
+                ASSERT(BASE + 1 == ta.numBlocksInUse());
+
+                for (int i = 0; i < 3; ++i) {
+                    ASSERT(0 == mX.tryPushBack(bsl::string(LONG, &ta)));
+                }
+            }
+            ASSERT(0 == ta.numBlocksInUse());
+        }
+        {
+            bdlcc::BoundedQueue<int> mX(8);
+            ASSERT(0 < defaultAllocator.numBlocksInUse());
+        }
+        ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+        if (verbose) cout << "\tException safety." << endl;
+#ifdef BDE_BUILD_TARGET_EXC
+        {
+            bdlcc::BoundedQueue<Throwing> mX(8);
+
+            Throwing values[5] = {
+                Throwing(1), Throwing(2), Throwing(-3), Throwing(4),
+                Throwing(5)
+            };
+
+            bool caught = false;
+            try {
+                mX.tryPushBackBatch(values, 5);
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            // The abandoned cells are counted until they are popped.
+
+            ASSERT(5 == mX.numElements());
+
+            Throwing buffer[8];
+            ASSERT(2 == mX.tryPopFrontBatch(buffer, 8));
+            ASSERT(1 == buffer[0].value());
+            ASSERT(2 == buffer[1].value());
+            ASSERT(mX.isEmpty());
+
+            caught = false;
+            try {
+                mX.pushBack(Throwing(-1));
+            }
+            catch (int) {
+                caught = true;
+            }
+            ASSERT(caught);
+
+            ASSERT(0 == mX.pushBack(Throwing(7)));
+
+            Throwing value;
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(7 == value.value());
+            ASSERT(0 != mX.tryPopFront(&value));
+
+            ASSERT(0 == mX.pushBack(Throwing(8)));
+            ASSERT(8 == mX.popFront().value());
+        }
+#endif
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // 'disable' AND 'enable'
+        //
+        // Concerns:
+        //: 1 A queue is created enabled.
+        //:
+        //: 2 When disabled, all push operations fail without modifying the
+        //:   queue, and pop operations are unaffected.
+        //:
+        //: 3 'disable' releases threads blocked in 'pushBack' and
+        //:   'pushBackBatch'.
+        //:
+        //: 4 'enable' restores normal operation.
+        //
+        // Plan:
+        //: 1 Exercise each push operation on an enabled and a disabled queue.
+        //:   (C-1..2, 4)
+        //:
+        //: 2 Start threads blocked pushing onto a full queue, disable the
+        //:   queue, and verify that the threads return a failure status.
+        //:   (C-3)
+        //
+        // Testing:
+        //   void disable();
+        //   void enable();
+        //   bool isEnabled() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'disable' AND 'enable'" << endl
+                          << "======================" << endl;
+
+        {
+            Obj mX(4);  const Obj& X = mX;
+            ASSERT(X.isEnabled());
+
+            ASSERT(0 == mX.pushBack(1));
+
+            mX.disable();
+            ASSERT(!X.isEnabled());
+
+            const int values[] = { 2, 3 };
+            ASSERT(0 >  mX.tryPushBack(2));
+            ASSERT(0 != mX.pushBack(2));
+            ASSERT(0 == mX.tryPushBackBatch(values, 2));
+            ASSERT(0 == mX.pushBackBatch(values, 2));
+            ASSERT(1 == X.numElements());
+
+            int value;
+            ASSERT(0 == mX.tryPopFront(&value));
+            ASSERT(1 == value);
+
+            mX.enable();
+            ASSERT(X.isEnabled());
+
+            ASSERT(2 == mX.tryPushBackBatch(values, 2));
+            ASSERT(2 == X.numElements());
+        }
+        {
+            Obj mX(2, 0);
+            ASSERT(0 == mX.pushBack(0));
+            ASSERT(0 == mX.pushBack(1));
+
+            const int       values[] = { 2, 3, 4 };
+            bsls::AtomicInt pushResult(-2);
+            bsls::AtomicInt batchResult(-2);
+
+            bslmt::ThreadGroup threads;
+            threads.addThread(bdlf::BindUtil::bind(&pushOneThread,
+                                                   &mX,
+                                                   5,
+                                                   &pushResult));
+            threads.addThread(bdlf::BindUtil::bind(&pushBatchThread,
+                                                   &mX,
+                                                   values,
+                                                   3,
+                                                   &batchResult));
+
+            bslmt::ThreadUtil::microSleep(50 * 1000);
+            ASSERT(-2 == pushResult);
+            ASSERT(-2 == batchResult);
+
+            mX.disable();
+            threads.joinAll();
+
+            ASSERT(0 != pushResult);
+            ASSERT(0 == batchResult);
+            ASSERT(2 == mX.numElements());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // BATCH OPERATIONS
+        //
+        // Concerns:
+        //: 1 'tryPushBackBatch' pushes the longest prefix of the values that
+        //:   fits in the queue, and returns the number of values pushed.
+        //:
+        //: 2 'tryPopFrontBatch' pops up to the requested number of values, and
+        //:   returns the number of values popped.
+        //:
+        //: 3 Batches preserve the order of the values, including when a batch
+        //:   wraps around the end of the ring buffer.
+        //:
+        //: 4 Empty batches have no effect.
+        //:
+        //: 5 'pushBackBatch' pushes every value when there is enough space.
+        //
+        // Plan:
+        //: 1 For a set of capacities and batch sizes, repeatedly push and pop
+        //:   batches, comparing the results with an oracle, over several laps
+        //:   of the ring buffer.  (C-1..5)
+        //
+        // Testing:
+        //   bsl::size_t pushBackBatch(const TYPE *values, bsl::size_t n);
+        //   bsl::size_t tryPushBackBatch(const TYPE *values, bsl::size_t n);
+        //   bsl::size_t tryPopFrontBatch(TYPE *buffer, bsl::size_t max);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCH OPERATIONS" << endl
+                          << "================" << endl;
+
+        for (int capacity = 2; capacity <= 16; capacity *= 2) {
+            for (int pushSize = 0; pushSize <= 20; ++pushSize) {
+                for (int popSize = 1; popSize <= 20; popSize += 3) {
+                    if (veryVerbose) {
+                        T_ P_(capacity) P_(pushSize) P(popSize)
+                    }
+
+                    Obj mX(capacity);  const Obj& X = mX;
+
+                    bsl::vector<int> values(pushSize + 1);
+                    bsl::vector<int> buffer(popSize);
+                    int              nextPush = 0;
+                    int              nextPop  = 0;
+
+                    for (int iter = 0; iter < 5 * capacity + 5; ++iter) {
+                        for (int i = 0; i < pushSize; ++i) {
+                            values[i] = nextPush + i;
+                        }
+
+                        const int  length   = X.numElements();
+                        const int  expPush  = bsl::min(pushSize,
+                                                       capacity - length);
+                        const int  numPushed = static_cast<int>(
+                                                mX.tryPushBackBatch(&values[0],
+                                                                    pushSize));
+                        ASSERTV(capacity, pushSize, iter,
+                                expPush == numPushed);
+                        nextPush += numPushed;
+                        ASSERT(length + numPushed == X.numElements());
+
+                        const int expPop = bsl::min(popSize,
+                                                    X.numElements());
+                        const int numPopped = static_cast<int>(
+                                                mX.tryPopFrontBatch(&buffer[0],
+                                                                    popSize));
+                        ASSERTV(capacity, pushSize, popSize, iter,
+                                expPop == numPopped);
+                        for (int i = 0; i < numPopped; ++i) {
+                            ASSERTV(nextPop, buffer[i], nextPop == buffer[i]);
+                            ++nextPop;
+                        }
+                    }
+                    ASSERT(nextPush - nextPop == X.numElements());
+                }
+            }
+        }
+
+        if (verbose) cout << "\tTesting 'pushBackBatch'." << endl;
+        {
+            Obj mX(16);  const Obj& X = mX;
+
+            const int values[] = { 1, 2, 3, 4, 5, 6, 7 };
+            ASSERT(7 == mX.pushBackBatch(values, 7));
+            ASSERT(7 == mX.pushBackBatch(values, 7));
+            ASSERT(0 == mX.pushBackBatch(values, 0));
+            ASSERT(14 == X.numElements());
+
+            int buffer[16];
+            ASSERT(14 == mX.popFrontBatch(buffer, 16));
+            for (int i = 0; i < 14; ++i) {
+                ASSERTV(i, values[i % 7] == buffer[i]);
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The capacity is rounded up to a power of two (and at least 2),
+        //:   and the spin count is as supplied (or the default).
+        //:
+        //: 2 'tryPushBack' succeeds until the queue is full, and then fails
+        //:   with a positive value without modifying the queue.
+        //:
+        //: 3 'tryPopFront' pops values in FIFO order, and fails when the queue
+        //:   is empty without modifying 'value'.
+        //:
+        //: 4 'numElements', 'isEmpty', and 'isFull' reflect the state of the
+        //:   queue, including after many laps of the ring buffer.
+        //
+        // Plan:
+        //: 1 Create queues of various capacities, and verify the accessors.
+        //:   (C-1)
+        //:
+        //: 2 Repeatedly fill and drain the queues, verifying the return values
+        //:   and accessors at each step.  (C-2..4)
+        //
+        // Testing:
+        //   BoundedQueue(bsl::size_t capacity, bslma::Allocator *ba = 0);
+        //   BoundedQueue(bsl::size_t capacity, int spinCount, Alloc *ba = 0);
+        //   int tryPushBack(const TYPE& value);
+        //   int tryPopFront(TYPE *value);
+        //   int capacity() const;
+        //   bool isEmpty() const;
+        //   bool isFull() const;
+        //   int numElements() const;
+        //   int spinCount() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                          << "========================================"
+                          << endl;
+
+        static const struct {
+            int d_line;
+            int d_capacity;
+            int d_expCapacity;
+        } DATA[] = {
+            //LINE  CAP  EXP
+            //----  ---  ---
+            { L_,     1,   2 },
+            { L_,     2,   2 },
+            { L_,     3,   4 },
+            { L_,     5,   8 },
+            { L_,    16,  16 },
+            { L_,    17,  32 },
+            { L_,  1000, 1024 },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int LINE    = DATA[ti].d_line;
+            const int CAP     = DATA[ti].d_capacity;
+            const int EXP_CAP = DATA[ti].d_expCapacity;
+
+            bslma::TestAllocator ta("test", veryVeryVerbose);
+
+            {
+                Obj mX(CAP, &ta);  const Obj& X = mX;
+                ASSERTV(LINE, EXP_CAP == X.capacity());
+                ASSERTV(LINE, Obj::k_DEFAULT_SPIN_COUNT == X.spinCount());
+            }
+            {
+                Obj mX(CAP, 17, &ta);  const Obj& X = mX;
+                ASSERTV(LINE, EXP_CAP == X.capacity());
+                ASSERTV(LINE, 17 == X.spinCount());
+                ASSERTV(LINE, X.isEmpty());
+                ASSERTV(LINE, !X.isFull());
+                ASSERTV(LINE, 0 == X.numElements());
+
+                int next = 0;
+                for (int lap = 0; lap < 3; ++lap) {
+                    for (int i = 0; i < EXP_CAP; ++i) {
+                        ASSERTV(LINE, lap, i, 0 == mX.tryPushBack(next + i));
+                        ASSERTV(LINE, lap, i, i + 1 == X.numElements());
+                        ASSERTV(LINE, lap, i, !X.isEmpty());
+                    }
+                    ASSERTV(LINE, X.isFull());
+                    ASSERTV(LINE, 0 < mX.tryPushBack(-1));
+                    ASSERTV(LINE, EXP_CAP == X.numElements());
+
+                    for (int i = 0; i < EXP_CAP; ++i) {
+                        int value = -1;
+                        ASSERTV(LINE, lap, i, 0 == mX.tryPopFront(&value));
+                        ASSERTV(LINE, lap, i, next + i == value);
+                        ASSERTV(LINE, lap, i,
+                                EXP_CAP - i - 1 == X.numElements());
+                        ASSERTV(LINE, lap, i, !X.isFull());
+                    }
+                    ASSERTV(LINE, X.isEmpty());
+
+                    int value = -7;
+                    ASSERTV(LINE, 0 != mX.tryPopFront(&value));
+                    ASSERTV(LINE, -7 == value);
+
+                    next += EXP_CAP;
+                }
+
+                // Interleave pushes and pops so that the positions wrap
+                // around the ring buffer at every offset.
+
+                for (int i = 0; i < 3 * EXP_CAP + 1; ++i) {
+                    int value = -1;
+                    ASSERTV(LINE, i, 0 == mX.tryPushBack(i));
+                    ASSERTV(LINE, i, 0 == mX.tryPopFront(&value));
+                    ASSERTV(LINE, i, i == value);
+                }
+            }
+            ASSERTV(LINE, 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Push and pop a few values, individually and in batches.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(4);  const Obj& X = mX;
+
+        ASSERT(4 == X.capacity());
+        ASSERT(X.isEmpty());
+
+        ASSERT(0 == mX.pushBack(1));
+        ASSERT(0 == mX.tryPushBack(2));
+        ASSERT(2 == X.numElements());
+
+        const int values[] = { 3, 4, 5 };
+        ASSERT(2 == mX.tryPushBackBatch(values, 3));
+        ASSERT(X.isFull());
+
+        int buffer[4];
+        ASSERT(3 == mX.tryPopFrontBatch(buffer, 3));
+        ASSERT(1 == buffer[0]);
+        ASSERT(2 == buffer[1]);
+        ASSERT(3 == buffer[2]);
+
+        ASSERT(4 == mX.popFront());
+        ASSERT(X.isEmpty());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Compare the throughput of 'bdlcc::BoundedQueue' (single-element
+        //:   and batch operations) with 'bdlcc::FixedQueue' and 'bdlcc::Queue'
+        //:   for 1 to 64 producer/consumer pairs.
+        //
+        // Plan:
+        //: 1 For each number of threads 'N' in '{ 1, 2, 4, 8, 16, 32, 64 }',
+        //:   run 'N' producers and 'N' consumers each transferring a fixed
+        //:   number of 'int' values through a queue of each type, and report
+        //:   the throughput.  Optional second and third arguments specify the
+        //:   number of values per thread and the spin count of the
+        //:   'BoundedQueue' objects.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'BoundedQueue' vs. 'FixedQueue' vs. 'Queue'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        const int NUM_VALUES = argc > 2 ? atoi(argv[2]) : 100000;
+        const int SPIN_COUNT = argc > 3 ? atoi(argv[3])
+                                        : (int)Obj::k_DEFAULT_SPIN_COUNT;
+
+        enum { k_CAPACITY = 1024, k_BATCH_SIZE = 32 };
+
+        cout << "values per thread: " << NUM_VALUES
+             << ", capacity: "       << k_CAPACITY
+             << ", batch size: "     << k_BATCH_SIZE
+             << ", spin count: "     << SPIN_COUNT << endl
+             << "threads\tFixedQueue\tQueue\tBoundedQueue\tBoundedQueue(batch)"
+             << "\t(M values/s)" << endl;
+
+        for (int numThreads = 1; numThreads <= 64; numThreads *= 2) {
+            const double total = static_cast<double>(numThreads) * NUM_VALUES
+                                                                       / 1e6;
+
+            bdlcc::FixedQueue<int> fixedQueue(k_CAPACITY);
+            const double fixedTime = runBenchmark(&fixedQueue,
+                                                  numThreads,
+                                                  NUM_VALUES);
+
+            bdlcc::Queue<int> queue(k_CAPACITY);
+            const double queueTime = runBenchmark(&queue,
+                                                  numThreads,
+                                                  NUM_VALUES);
+
+            Obj boundedQueue(k_CAPACITY, SPIN_COUNT);
+            const double boundedTime = runBenchmark(&boundedQueue,
+                                                    numThreads,
+                                                    NUM_VALUES);
+
+            Obj batchQueue(k_CAPACITY, SPIN_COUNT);
+            const double batchTime = runBatchBenchmark(&batchQueue,
+                                                       numThreads,
+                                                       NUM_VALUES,
+                                                       k_BATCH_SIZE);
+
+            cout << numThreads
+                 << "\t" << total / fixedTime
+                 << "\t\t" << total / queueTime
+                 << "\t" << total / boundedTime
+                 << "\t\t" << total / batchTime << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,74 @@
+// bdlcc_shardedobjectcatalog.cpp                                     -*-C++-*-
+#include <bdlcc_shardedobjectcatalog.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_shardedobjectcatalog_cpp,"$Id$ $CSID$")
+
+namespace BloombergLP {
+
+///Implementation Note
+///===================
+// The low-order bits of the index encoded in a handle identify a shard, and
+// the remaining bits identify the position of a slot in that shard.  The
+// slots of a shard are held in chunks of geometrically increasing sizes that
+// are never reallocated or deallocated before the catalog is destroyed, so
+// that 'find' can locate the slot of a handle without synchronization, and
+// reject the handle unless it is equal to the handle stored in the slot.
+//
+// A slot refers to the object it holds through an atomic pointer to a
+// separately allocated 'Value'.  'add' stores this pointer before publishing
+// the (busy) handle of the slot, and 'remove' stores the next (free) handle of
+// the slot before detaching the pointer.  'find' loads the pointer, and then
+// checks that the handle of the slot is still equal to the supplied handle.
+// Since generations only increase (modulo 256), this check succeeds only if
+// the object was not removed before the pointer was loaded, in which case the
+// pointer refers to the object (or to an object that replaced it).
+//
+///Reclamation
+///-----------
+// Objects are reclaimed using a simplified form of epoch-based reclamation in
+// which, instead of a per-thread record, each shard holds two counts of the
+// 'find' operations in progress, indexed by the parity of the (global) epoch
+// at which they started.  'find' reads the epoch, and increments the
+// corresponding count of the shard of the handle before loading the pointer
+// to the object; it decrements the same count when it completes.
+//
+// A removed (or replaced) object is *retired*: it is added to the list of
+// objects retired during the current epoch.  The epoch is advanced from 'e'
+// to 'e + 1' (by a thread retiring an object) only if the count having the
+// parity of 'e + 1' (i.e., that of 'e - 1') is 0 in every shard, at which
+// point the objects retired during 'e - 1' are destroyed.  Consider a 'find'
+// operation that accessed an object retired during 'e - 1': it incremented
+// its count before the object was detached, having read an epoch not greater
+// than 'e - 1'; of the two advancements (to 'e' and to 'e + 1') that occur
+// after the object was retired, one checks the parity of this 'find'
+// operation, and therefore the 'find' operation had completed when the object
+// is destroyed.  A 'find' operation that read an older epoch, but incremented
+// its count after the check, cannot access the object, which was already
+// detached.  All the operations on the epoch and on the counts are
+// sequentially consistent.
+//
+// As the counts only track 'find' operations that started during the last
+// two epochs, an advancement is only delayed by operations that started
+// before the previous advancement, so that a continuous stream of 'find'
+// operations does not prevent reclamation.  A thread retiring an object
+// attempts to advance the epoch twice, so that, in the absence of concurrent
+// 'find' operations, the objects it retired are destroyed immediately.
+
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1304 @@
+// bdlcc_shardedobjectcatalog.h                                       -*-C++-*-
+#ifndef INCLUDED_BDLCC_SHARDEDOBJECTCATALOG
+#define INCLUDED_BDLCC_SHARDEDOBJECTCATALOG
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a sharded, indexed object container with wait-free lookup.
+//
+//@CLASSES:
+//  bdlcc::ShardedObjectCatalog: indexed object container with wait-free 'find'
+//
+//@SEE_ALSO: bdlcc_objectcatalog
+//
+//@DESCRIPTION: This component defines a class template,
+// 'bdlcc::ShardedObjectCatalog', that provides a thread-safe catalog of
+// objects having the same interface as 'bdlcc::ObjectCatalog': 'add' stores a
+// copy of an object and returns an integer handle, which can later be passed
+// to 'find', 'replace', and 'remove'; once an object is removed, its handle
+// is no longer valid, and subsequent calls to 'find', 'replace', or 'remove'
+// with this handle return a non-zero value.
+//
+// 'bdlcc::ObjectCatalog' protects all of its operations with a single
+// reader-writer lock, so that every 'find' (typically the most frequent
+// operation by far) performs two atomic read-modify-write operations on the
+// *same* lock word, and readers are blocked while any thread modifies the
+// catalog.  'bdlcc::ShardedObjectCatalog' is intended for such read-mostly
+// scenarios, and differs in the following respects:
+//
+//: o 'find' is *wait-free*: it never acquires a lock, and completes in a
+//:   bounded number of steps regardless of the activity of other threads.  A
+//:   handle is tagged with the generation of the slot it refers to, and 'find'
+//:   validates the handle against the slot with atomic loads.  An object that
+//:   is removed (or replaced) while a 'find' may still be copying it is not
+//:   destroyed immediately, but retired, and destroyed once no 'find' that
+//:   started before its removal can still be in progress (see
+//:   {Deferred Destruction}).
+//:
+//: o The slots of the catalog are partitioned into a number of independent
+//:   *shards* (specified at construction), each having its own lock, its own
+//:   free list of slots, and its own count of in-progress 'find' operations.
+//:   'add' selects a shard based on the identity of the calling thread, and
+//:   'remove' and 'replace' operate on the shard encoded in the handle, so
+//:   that threads modifying the catalog concurrently rarely contend on the
+//:   same lock or cache line.
+//
+// The handles returned by 'bdlcc::ShardedObjectCatalog' use the same encoding
+// (a 23-bit index, a "busy" bit, and an 8-bit generation) as those returned by
+// 'bdlcc::ObjectCatalog', and are never 0.  Consequently, as for
+// 'bdlcc::ObjectCatalog', a stale handle is only guaranteed to be rejected if
+// its slot has been reused fewer than 256 times since the handle was issued.
+// The number of objects that can be held by a shard is '2^23 / numShards()'.
+//
+// Note that 'bdlcc::ShardedObjectCatalog' does not provide an iterator: an
+// iterator that locks the catalog would defeat the purpose of this component.
+//
+///Deferred Destruction
+///--------------------
+// When an object is removed from (or replaced in) a
+// 'bdlcc::ShardedObjectCatalog', it becomes immediately unreachable through
+// its handle, but its destruction may be deferred until every 'find' operation
+// that was in progress at the time of the removal has completed, and the
+// catalog has been modified again (by a subsequent 'remove', 'replace', or
+// 'removeAll').  In the absence of concurrent 'find' operations, objects are
+// destroyed before 'remove' returns.  All objects are destroyed by 'removeAll'
+// (provided that no 'find' operation is in progress) and by the destructor.
+// Users storing objects that hold a resource whose release must not be
+// deferred (e.g., a shared pointer to an object that must be destroyed
+// promptly) should use 'bdlcc::ObjectCatalog' instead, or release the resource
+// explicitly after removing the object.
+//
+///Template Requirements
+///---------------------
+// 'bdlcc::ShardedObjectCatalog' is a template that is parameterized on the
+// type of the objects contained within the catalog.  The supplied template
+// argument, 'TYPE', must provide a copy constructor and an assignment
+// operator.  If 'TYPE' declares the 'bslma::UsesBslmaAllocator' trait, the
+// allocator of the catalog is propagated to the objects contained in the
+// catalog.
+//
+///Exception Safety
+///----------------
+// A 'bdlcc::ShardedObjectCatalog' is exception neutral: if the copy
+// constructor of 'TYPE' (or an allocation) throws during 'add' or 'replace',
+// the catalog is left unchanged.  If the assignment operator of 'TYPE' throws
+// while loading a value into a buffer supplied to 'find' or 'remove', the
+// state of the catalog is as if the operation had completed.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Registry of Sessions
+///- - - - - - - - - - - - - - - - -
+// In the following example a 'bdlcc::ShardedObjectCatalog' is used to map
+// integer identifiers, carried in every message received by a server, to the
+// sessions those messages belong to.  Messages are received by several I/O
+// threads, each of which looks up the session of every message; sessions are
+// opened and closed comparatively rarely.
+//
+// First, we define the information held for each session:
+//..
+//  struct my_Session {
+//      int d_userId;     // identifier of the user who opened the session
+//      int d_priority;   // priority of the messages of the session
+//  };
+//..
+// Then, we define the function used by an I/O thread to process a message
+// addressed to the session identified by 'sessionHandle'.  Looking up the
+// session does not block, even while other threads are opening or closing
+// sessions:
+//..
+//  typedef bdlcc::ShardedObjectCatalog<my_Session> my_SessionCatalog;
+//
+//  int myProcessMessage(const my_SessionCatalog& sessions, int sessionHandle)
+//      // Return the priority of a message addressed to the session having the
+//      // specified 'sessionHandle' in the specified 'sessions', or -1 if the
+//      // session has been closed.
+//  {
+//      my_Session session;
+//      if (0 != sessions.find(sessionHandle, &session)) {
+//          return -1;                                                // RETURN
+//      }
+//      return session.d_priority;
+//  }
+//..
+// Finally, we open two sessions, process messages addressed to both of them,
+// and close one; messages addressed to the closed session are then rejected:
+//..
+//  bdlcc::ShardedObjectCatalog<my_Session> sessions;
+//
+//  my_Session alice = { 1, 10 };
+//  my_Session bob   = { 2, 20 };
+//
+//  int aliceHandle = sessions.add(alice);
+//  int bobHandle   = sessions.add(bob);
+//  assert(2 == sessions.length());
+//
+//  assert(10 == myProcessMessage(sessions, aliceHandle));
+//  assert(20 == myProcessMessage(sessions, bobHandle));
+//
+//  my_Session closed;
+//  assert(0 == sessions.remove(bobHandle, &closed));
+//  assert(2  == closed.d_userId);
+//  assert(1  == sessions.length());
+//
+//  assert(10 == myProcessMessage(sessions, aliceHandle));
+//  assert(-1 == myProcessMessage(sessions, bobHandle));
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLB_BITUTIL
+#include <bdlb_bitutil.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_CONCURRENTPOOL
+#include <bdlma_concurrentpool.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_LOCKGUARD
+#include <bslmt_lockguard.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_PLATFORM
+#include <bslmt_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEALLOCATORPROCTOR
+#include <bslma_deallocatorproctor.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_NEW
+#include <bsl_new.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                     // ================================
+                     // struct ShardedObjectCatalog_Value
+                     // ================================
+
+template <class TYPE>
+struct ShardedObjectCatalog_Value {
+    // This 'struct' holds an object contained in a 'ShardedObjectCatalog'.
+    // An object is allocated separately from the slot referring to it, so that
+    // it can outlive its removal from the slot until it is no longer accessed
+    // by any 'find' operation.
+
+    // PUBLIC DATA
+    bsls::ObjectBuffer<TYPE>    d_object;  // contained object
+
+    ShardedObjectCatalog_Value *d_next_p;  // next retired value, if retired
+};
+
+                     // ===============================
+                     // struct ShardedObjectCatalog_Node
+                     // ===============================
+
+template <class TYPE>
+struct ShardedObjectCatalog_Node {
+    // This 'struct' provides the layout of a slot of a 'ShardedObjectCatalog'.
+    // A slot is never deallocated before the catalog is destroyed, so that
+    // 'find' may access it without synchronization.
+
+    // PUBLIC DATA
+    bsls::AtomicInt                                d_handle;
+                                   // handle of the object held in this slot,
+                                   // or handle of the next object to be held
+                                   // (with the "busy" bit unset) if free
+
+    bsls::AtomicPointer<ShardedObjectCatalog_Value<TYPE> >
+                                                   d_value_p;
+                                   // object held in this slot, or 0 if free
+
+    ShardedObjectCatalog_Node                     *d_next_p;
+                                   // next free slot of the shard, if free
+                                   // (guarded by the mutex of the shard)
+};
+
+                     // ================================
+                     // struct ShardedObjectCatalog_Shard
+                     // ================================
+
+template <class TYPE>
+struct ShardedObjectCatalog_Shard {
+    // This 'struct' provides the layout of a shard of a
+    // 'ShardedObjectCatalog'.  The slots of a shard are allocated in chunks
+    // of geometrically increasing sizes: chunk 'c' holds
+    // 'k_FIRST_CHUNK_SIZE << c' slots, so that the chunk of a slot can be
+    // computed from its position in the shard, and chunks never need to be
+    // reallocated.
+
+    // PUBLIC TYPES
+    typedef ShardedObjectCatalog_Node<TYPE> Node;
+
+    enum {
+        k_FIRST_CHUNK_SHIFT = 5,
+        k_FIRST_CHUNK_SIZE  = 1 << k_FIRST_CHUNK_SHIFT,
+        k_MAX_NUM_CHUNKS    = 23 - k_FIRST_CHUNK_SHIFT + 1,
+        k_CACHE_LINE_SIZE   = bslmt::Platform::e_CACHE_LINE_SIZE,
+        k_READERS_PADDING   = k_CACHE_LINE_SIZE - 2 * sizeof(bsls::AtomicInt)
+    };
+
+    // PUBLIC DATA
+    bsls::AtomicInt            d_numReaders[2];
+                                        // number of 'find' operations in
+                                        // progress on this shard, indexed by
+                                        // the parity of the epoch at which
+                                        // they started
+
+    const char                 d_numReadersPad[k_READERS_PADDING];
+                                        // padding to prevent false sharing
+
+    bsls::AtomicPointer<Node>  d_chunks[k_MAX_NUM_CHUNKS];
+                                        // chunks of slots, or 0 if not yet
+                                        // allocated
+
+    bslmt::Mutex               d_mutex; // guards modifications of the slots
+
+    Node                      *d_nextFreeNode_p;
+                                        // head of the free list of slots
+
+    int                        d_numNodes;
+                                        // number of slots handed out so far
+
+    bsls::AtomicInt            d_length;
+                                        // number of objects held
+
+    const char                 d_pad[k_CACHE_LINE_SIZE];
+                                        // padding to prevent false sharing
+
+    // CREATORS
+    ShardedObjectCatalog_Shard();
+        // Create an empty shard.
+
+    // CLASS METHODS
+    static int chunkIndex(int position);
+        // Return the index of the chunk holding the slot at the specified
+        // 'position' in a shard.  The behavior is undefined unless
+        // '0 <= position'.
+
+    static int chunkStart(int chunkIndex);
+        // Return the position of the first slot held by the chunk having the
+        // specified 'chunkIndex'.
+};
+
+                        // ==========================
+                        // class ShardedObjectCatalog
+                        // ==========================
+
+template <class TYPE>
+class ShardedObjectCatalog {
+    // This class defines an indexed, thread-safe catalog of 'TYPE' objects,
+    // whose 'find' operation is wait-free.  This container is *exception*
+    // *neutral* (see {Exception Safety}).
+
+    // PRIVATE TYPES
+    typedef ShardedObjectCatalog_Value<TYPE> Value;
+    typedef ShardedObjectCatalog_Node<TYPE>  Node;
+    typedef ShardedObjectCatalog_Shard<TYPE> Shard;
+
+    enum {
+        // Masks used for breaking up a handle (identical to those used by
+        // 'ObjectCatalog').  The low-order 'd_shardShift' bits of the index
+        // identify the shard, and the remaining bits of the index identify
+        // the position of the slot in the shard.
+
+        k_INDEX_MASK      = 0x007fffff,
+        k_BUSY_INDICATOR  = 0x00800000,
+        k_GENERATION_INC  = 0x01000000,
+        k_GENERATION_MASK = 0xff000000
+    };
+
+    enum {
+        k_CACHE_LINE_SIZE = bslmt::Platform::e_CACHE_LINE_SIZE,
+        k_EPOCH_PADDING   = k_CACHE_LINE_SIZE - sizeof(bsls::AtomicInt)
+    };
+
+    class ReaderGuard;
+    class RetireGuard;
+    class ValueProctor;
+
+    friend class RetireGuard;
+    friend class ValueProctor;
+
+    // DATA
+    bsls::AtomicInt         d_epoch;          // current epoch; only its
+                                              // parity is meaningful to
+                                              // 'find'
+
+    const char              d_epochPad[k_EPOCH_PADDING];
+                                              // padding to prevent false
+                                              // sharing
+
+    bsl::vector<Shard *>    d_shards;         // shards (immutable after
+                                              // construction)
+
+    int                     d_shardMask;      // 'numShards() - 1'
+
+    int                     d_shardShift;     // 'log2(numShards())'
+
+    bdlma::ConcurrentPool   d_valuePool;      // pool of 'Value' objects
+
+    bslmt::Mutex            d_retireMutex;    // guards 'd_retired',
+                                              // 'd_retiredIndex', and the
+                                              // advancement of 'd_epoch'
+
+    Value                  *d_retired[3];     // values retired during the
+                                              // last three epochs
+
+    int                     d_retiredIndex;   // index in 'd_retired' of the
+                                              // values retired during the
+                                              // current epoch
+
+    bslma::Allocator       *d_allocator_p;    // memory allocator (held, not
+                                              // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    ShardedObjectCatalog(const ShardedObjectCatalog&);
+    ShardedObjectCatalog& operator=(const ShardedObjectCatalog&);
+
+    // PRIVATE MANIPULATORS
+    Node *acquireNode(Shard *shard, int shardIndex);
+        // Remove a free slot from the specified 'shard' having the specified
+        // 'shardIndex', allocating a new chunk of slots if needed, and return
+        // its address.  The behavior is undefined unless the mutex of 'shard'
+        // is held by the calling thread.
+
+    int advanceEpoch(Value **reclaimed);
+        // Advance the current epoch, if no 'find' operation that started two
+        // epochs ago is still in progress, and load into the specified
+        // 'reclaimed' the list of values that can now be destroyed (or 0 if
+        // none).  Return 0 if the epoch was advanced, and a non-zero value
+        // (leaving 'reclaimed' unchanged) otherwise.  The behavior is
+        // undefined unless 'd_retireMutex' is held by the calling thread.
+
+    Value *createValue(const TYPE& object);
+        // Return the address of a new 'Value' holding a copy of the specified
+        // 'object'.
+
+    void destroyValues(Value *list);
+        // Destroy and deallocate all the values in the specified 'list'.
+
+    void releaseNode(Shard *shard, Node *node);
+        // Mark the specified 'node' as free, generating the next handle for
+        // this slot, and return it to the free list of the specified 'shard'.
+        // The behavior is undefined unless the mutex of 'shard' is held by
+        // the calling thread.
+
+    void retire(Value *head, Value *tail);
+        // Retire the list of values starting at the specified 'head' and
+        // ending at the specified 'tail' (both of which have been made
+        // unreachable by 'find'), and destroy the values, if any, that are no
+        // longer accessed by any 'find' operation.
+
+    // PRIVATE ACCESSORS
+    Node *findNode(int handle) const;
+        // Return the address of the slot holding the object having the
+        // specified 'handle', or 0 if there is no such slot.
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(ShardedObjectCatalog,
+                                   bslma::UsesBslmaAllocator);
+
+    // PUBLIC CONSTANTS
+    enum {
+        k_DEFAULT_NUM_SHARDS = 8,   // number of shards of a catalog created
+                                    // without specifying it
+
+        k_MAX_NUM_SHARDS     = 64   // maximum number of shards of a catalog
+    };
+
+    // CREATORS
+    explicit
+    ShardedObjectCatalog(bslma::Allocator *basicAllocator = 0);
+        // Create an empty object catalog having 'k_DEFAULT_NUM_SHARDS' shards.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.
+
+    explicit
+    ShardedObjectCatalog(int               numShards,
+                         bslma::Allocator *basicAllocator = 0);
+        // Create an empty object catalog having the specified 'numShards'
+        // shards.  Optionally specify a 'basicAllocator' used to supply
+        // memory.  If 'basicAllocator' is 0, the currently installed default
+        // allocator is used.  The behavior is undefined unless
+        // '1 <= numShards <= k_MAX_NUM_SHARDS' and 'numShards' is a power of
+        // two.
+
+    ~ShardedObjectCatalog();
+        // Destroy this object catalog, and all the objects it holds.  The
+        // behavior is undefined if any other method of this catalog is in
+        // progress.
+
+    // MANIPULATORS
+    int add(const TYPE& object);
+        // Add the value of the specified 'object' to this catalog and return a
+        // non-zero integer handle that may be used to refer to the object in
+        // future calls to this catalog.  The behavior is undefined if the
+        // shard selected for the calling thread already holds
+        // '2^23 / numShards()' objects.
+
+    int remove(int handle, TYPE *valueBuffer = 0);
+        // Optionally load into the optionally specified 'valueBuffer' the
+        // value of the object having the specified 'handle' and remove it from
+        // this catalog.  Return zero on success, and a non-zero value if the
+        // 'handle' is not contained in this catalog.  Note that 'valueBuffer'
+        // is assigned into, and thus must point to a valid 'TYPE' instance.
+        // Also note that the destruction of the removed object may be
+        // deferred (see {Deferred Destruction}).
+
+    void removeAll(bsl::vector<TYPE> *buffer = 0);
+        // Remove all objects that are currently held in this catalog and
+        // optionally load into the optionally specified 'buffer' the removed
+        // objects.
+
+    int replace(int handle, const TYPE& newObject);
+        // Replace the object having the specified 'handle' with the specified
+        // 'newObject'.  Return 0 on success, and a non-zero value if the
+        // handle is not contained in this catalog.  Note that a concurrent
+        // 'find' operation loads either the previous or the new value of the
+        // object, and that the destruction of the previous object may be
+        // deferred (see {Deferred Destruction}).
+
+    // ACCESSORS
+    int find(int handle, TYPE *valueBuffer = 0) const;
+        // Locate the object having the specified 'handle' and optionally load
+        // its value into the optionally specified 'valueBuffer'.  Return zero
+        // on success, and a non-zero value if the 'handle' is not contained in
+        // this catalog.  Note that 'valueBuffer' is assigned into, and thus
+        // must point to a valid 'TYPE' instance.  Also note that this method
+        // is wait-free, provided the assignment operator of 'TYPE' is.
+
+    int length() const;
+        // Return a "snapshot" of the number of items currently contained in
+        // this catalog.
+
+    int numShards() const;
+        // Return the number of shards of this catalog.
+
+                                  // Aspects
+
+    bslma::Allocator *allocator() const;
+        // Return the allocator used by this catalog to supply memory.
+
+    // FOR TESTING PURPOSES ONLY
+    void verifyState() const;
+        // Verify that this catalog is in a consistent state.  This function is
+        // introduced for testing purposes only.
+};
+
+                  // =======================================
+                  // class ShardedObjectCatalog::ReaderGuard
+                  // =======================================
+
+template <class TYPE>
+class ShardedObjectCatalog<TYPE>::ReaderGuard {
+    // This class implements a guard that registers a 'find' operation in a
+    // count of readers for the lifetime of the guard.
+
+    // DATA
+    bsls::AtomicInt *d_numReaders_p;  // count of readers
+
+    // NOT IMPLEMENTED
+    ReaderGuard(const ReaderGuard&);
+    ReaderGuard& operator=(const ReaderGuard&);
+
+  public:
+    // CREATORS
+    explicit ReaderGuard(bsls::AtomicInt *numReaders);
+        // Create a guard incrementing the specified 'numReaders'.
+
+    ~ReaderGuard();
+        // Decrement the count of readers supplied at construction, and
+        // destroy this guard.
+};
+
+                  // =======================================
+                  // class ShardedObjectCatalog::RetireGuard
+                  // =======================================
+
+template <class TYPE>
+class ShardedObjectCatalog<TYPE>::RetireGuard {
+    // This class implements a guard that retires an unreachable 'Value' on
+    // destruction.
+
+    // DATA
+    ShardedObjectCatalog<TYPE> *d_catalog_p;  // catalog owning the value
+    Value                      *d_value_p;    // guarded value
+
+    // NOT IMPLEMENTED
+    RetireGuard(const RetireGuard&);
+    RetireGuard& operator=(const RetireGuard&);
+
+  public:
+    // CREATORS
+    RetireGuard(ShardedObjectCatalog<TYPE> *catalog, Value *value);
+        // Create a guard for the specified 'value' of the specified
+        // 'catalog'.
+
+    ~RetireGuard();
+        // Retire the guarded value, and destroy this guard.
+};
+
+                  // ========================================
+                  // class ShardedObjectCatalog::ValueProctor
+                  // ========================================
+
+template <class TYPE>
+class ShardedObjectCatalog<TYPE>::ValueProctor {
+    // This class implements a proctor that, unless its 'release' method is
+    // called, destroys and deallocates a managed 'Value' on destruction.
+
+    // DATA
+    ShardedObjectCatalog<TYPE> *d_catalog_p;  // catalog owning the value
+    Value                      *d_value_p;    // managed value, or 0
+
+    // NOT IMPLEMENTED
+    ValueProctor(const ValueProctor&);
+    ValueProctor& operator=(const ValueProctor&);
+
+  public:
+    // CREATORS
+    ValueProctor(ShardedObjectCatalog<TYPE> *catalog, Value *value);
+        // Create a proctor managing the specified 'value' of the specified
+        // 'catalog'.
+
+    ~ValueProctor();
+        // Destroy the managed value, if any, and destroy this proctor.
+
+    // MANIPULATORS
+    void release();
+        // Release from management the value managed by this proctor.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                     // --------------------------------
+                     // struct ShardedObjectCatalog_Shard
+                     // --------------------------------
+
+// CREATORS
+template <class TYPE>
+ShardedObjectCatalog_Shard<TYPE>::ShardedObjectCatalog_Shard()
+: d_numReadersPad()
+, d_nextFreeNode_p(0)
+, d_numNodes(0)
+, d_length(0)
+, d_pad()
+{
+}
+
+// CLASS METHODS
+template <class TYPE>
+inline
+int ShardedObjectCatalog_Shard<TYPE>::chunkIndex(int position)
+{
+    BSLS_ASSERT_SAFE(0 <= position);
+
+    // Chunk 'c' holds the positions in
+    // '[k_FIRST_CHUNK_SIZE * (2^c - 1), k_FIRST_CHUNK_SIZE * (2^(c+1) - 1))'.
+
+    const unsigned int value = (static_cast<unsigned int>(position)
+                                               >> k_FIRST_CHUNK_SHIFT) + 1;
+
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(
+                                              static_cast<uint32_t>(value));
+}
+
+template <class TYPE>
+inline
+int ShardedObjectCatalog_Shard<TYPE>::chunkStart(int chunkIndex)
+{
+    return k_FIRST_CHUNK_SIZE * ((1 << chunkIndex) - 1);
+}
+
+                        // --------------------------
+                        // class ShardedObjectCatalog
+                        // --------------------------
+
+// PRIVATE MANIPULATORS
+template <class TYPE>
+typename ShardedObjectCatalog<TYPE>::Node *
+ShardedObjectCatalog<TYPE>::acquireNode(Shard *shard, int shardIndex)
+{
+    Node *node = shard->d_nextFreeNode_p;
+
+    if (node) {
+        shard->d_nextFreeNode_p = node->d_next_p;
+        return node;                                                  // RETURN
+    }
+
+    // If a shard grows as big as the flags used to indicate BUSY and
+    // generations, then the handle will be all mixed up!
+
+    const int position = shard->d_numNodes;
+
+    BSLS_ASSERT(position < (static_cast<int>(k_BUSY_INDICATOR)
+                                                             >> d_shardShift));
+
+    const int chunkIndex = Shard::chunkIndex(position);
+    const int chunkStart = Shard::chunkStart(chunkIndex);
+
+    Node *chunk = shard->d_chunks[chunkIndex].loadRelaxed();
+
+    if (!chunk) {
+        const int chunkSize = Shard::k_FIRST_CHUNK_SIZE << chunkIndex;
+
+        chunk = static_cast<Node *>(d_allocator_p->allocate(
+                                                   chunkSize * sizeof(Node)));
+
+        for (int i = 0; i < chunkSize; ++i) {
+            Node *slot = new (chunk + i) Node();
+
+            slot->d_handle.storeRelaxed(
+                              ((chunkStart + i) << d_shardShift) | shardIndex);
+            slot->d_next_p = 0;
+        }
+
+        // Publish the chunk only once its slots are initialized, so that a
+        // 'find' with an invalid handle that refers to a slot of this chunk
+        // observes a free slot.
+
+        shard->d_chunks[chunkIndex].storeRelease(chunk);
+    }
+
+    ++shard->d_numNodes;
+
+    return chunk + (position - chunkStart);
+}
+
+template <class TYPE>
+int ShardedObjectCatalog<TYPE>::advanceEpoch(Value **reclaimed)
+{
+    const int epoch      = d_epoch.loadRelaxed();
+    const int nextParity = (epoch + 1) & 1;
+
+    // 'find' operations that started two epochs ago (i.e., at an epoch having
+    // the parity of the next epoch) may still access the values retired
+    // during the previous epoch.
+
+    for (int i = 0; i < static_cast<int>(d_shards.size()); ++i) {
+        if (0 != d_shards[i]->d_numReaders[nextParity].load()) {
+            return -1;                                                // RETURN
+        }
+    }
+
+    d_epoch = epoch + 1;
+
+    d_retiredIndex = (d_retiredIndex + 1) % 3;
+
+    // The values retired two epochs ago are no longer accessed by any 'find'
+    // operation.
+
+    const int reclaimIndex = (d_retiredIndex + 1) % 3;
+
+    *reclaimed = d_retired[reclaimIndex];
+    d_retired[reclaimIndex] = 0;
+
+    return 0;
+}
+
+template <class TYPE>
+typename ShardedObjectCatalog<TYPE>::Value *
+ShardedObjectCatalog<TYPE>::createValue(const TYPE& object)
+{
+    Value *value = static_cast<Value *>(d_valuePool.allocate());
+
+    bslma::DeallocatorProctor<bdlma::ConcurrentPool> proctor(value,
+                                                             &d_valuePool);
+
+    bslalg::ScalarPrimitives::copyConstruct(value->d_object.address(),
+                                            object,
+                                            d_allocator_p);
+    proctor.release();
+
+    value->d_next_p = 0;
+    return value;
+}
+
+template <class TYPE>
+void ShardedObjectCatalog<TYPE>::destroyValues(Value *list)
+{
+    while (list) {
+        Value *next = list->d_next_p;
+
+        list->d_object.object().~TYPE();
+        d_valuePool.deallocate(list);
+
+        list = next;
+    }
+}
+
+template <class TYPE>
+inline
+void ShardedObjectCatalog<TYPE>::releaseNode(Shard *shard, Node *node)
+{
+    // Compute the next generation without signed overflow.
+
+    const unsigned int handle = static_cast<unsigned int>(
+                                                 node->d_handle.loadRelaxed());
+
+    node->d_handle = static_cast<int>((handle + k_GENERATION_INC)
+                                                        & ~k_BUSY_INDICATOR);
+
+    node->d_next_p          = shard->d_nextFreeNode_p;
+    shard->d_nextFreeNode_p = node;
+}
+
+template <class TYPE>
+void ShardedObjectCatalog<TYPE>::retire(Value *head, Value *tail)
+{
+    Value *reclaimed[2] = { 0, 0 };
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_retireMutex);
+
+        tail->d_next_p = d_retired[d_retiredIndex];
+        d_retired[d_retiredIndex] = head;
+
+        // Advancing the epoch twice reclaims the values just retired if no
+        // 'find' operation is in progress.
+
+        if (0 == advanceEpoch(&reclaimed[0])) {
+            advanceEpoch(&reclaimed[1]);
+        }
+    }
+
+    destroyValues(reclaimed[0]);
+    destroyValues(reclaimed[1]);
+}
+
+// PRIVATE ACCESSORS
+template <class TYPE>
+inline
+typename ShardedObjectCatalog<TYPE>::Node *
+ShardedObjectCatalog<TYPE>::findNode(int handle) const
+{
+    if (!(handle & k_BUSY_INDICATOR)) {
+        return 0;                                                     // RETURN
+    }
+
+    const int    index    = handle & k_INDEX_MASK;
+    const Shard *shard    = d_shards[index & d_shardMask];
+    const int    position = index >> d_shardShift;
+    const int    chunkIdx = Shard::chunkIndex(position);
+
+    Node *chunk = shard->d_chunks[chunkIdx].loadAcquire();
+
+    if (!chunk) {
+        return 0;                                                     // RETURN
+    }
+
+    Node *node = chunk + (position - Shard::chunkStart(chunkIdx));
+
+    return handle == node->d_handle.loadAcquire() ? node : 0;
+}
+
+// CREATORS
+template <class TYPE>
+ShardedObjectCatalog<TYPE>::ShardedObjectCatalog(
+                                              bslma::Allocator *basicAllocator)
+: d_epoch(0)
+, d_epochPad()
+, d_shards(basicAllocator)
+, d_shardMask(k_DEFAULT_NUM_SHARDS - 1)
+, d_shardShift(bdlb::BitUtil::log2(
+                               static_cast<uint32_t>(k_DEFAULT_NUM_SHARDS)))
+, d_valuePool(sizeof(Value), basicAllocator)
+, d_retiredIndex(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    d_retired[0] = d_retired[1] = d_retired[2] = 0;
+
+    d_shards.reserve(k_DEFAULT_NUM_SHARDS);
+    for (int i = 0; i < k_DEFAULT_NUM_SHARDS; ++i) {
+        d_shards.push_back(new (*d_allocator_p) Shard());
+    }
+}
+
+template <class TYPE>
+ShardedObjectCatalog<TYPE>::ShardedObjectCatalog(
+                                              int               numShards,
+                                              bslma::Allocator *basicAllocator)
+: d_epoch(0)
+, d_epochPad()
+, d_shards(basicAllocator)
+, d_shardMask(numShards - 1)
+, d_shardShift(bdlb::BitUtil::log2(static_cast<uint32_t>(numShards)))
+, d_valuePool(sizeof(Value), basicAllocator)
+, d_retiredIndex(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(1 <= numShards);
+    BSLS_ASSERT(numShards <= k_MAX_NUM_SHARDS);
+    BSLS_ASSERT(0 == (numShards & (numShards - 1)));
+
+    d_retired[0] = d_retired[1] = d_retired[2] = 0;
+
+    d_shards.reserve(numShards);
+    for (int i = 0; i < numShards; ++i) {
+        d_shards.push_back(new (*d_allocator_p) Shard());
+    }
+}
+
+template <class TYPE>
+ShardedObjectCatalog<TYPE>::~ShardedObjectCatalog()
+{
+    for (int i = 0; i < static_cast<int>(d_shards.size()); ++i) {
+        Shard *shard = d_shards[i];
+
+        for (int c = 0; c < Shard::k_MAX_NUM_CHUNKS; ++c) {
+            Node *chunk = shard->d_chunks[c].loadRelaxed();
+
+            if (!chunk) {
+                break;
+            }
+
+            const int chunkSize = Shard::k_FIRST_CHUNK_SIZE << c;
+
+            for (int j = 0; j < chunkSize; ++j) {
+                Value *value = chunk[j].d_value_p.loadRelaxed();
+
+                if (value) {
+                    value->d_next_p = 0;
+                    destroyValues(value);
+                }
+                chunk[j].~Node();
+            }
+            d_allocator_p->deallocate(chunk);
+        }
+        d_allocator_p->deleteObject(shard);
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        destroyValues(d_retired[i]);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+int ShardedObjectCatalog<TYPE>::add(const TYPE& object)
+{
+    Value        *value = createValue(object);
+    ValueProctor  proctor(this, value);
+
+    // Threads are spread over the shards using the Fibonacci hash of their
+    // identifier.
+
+    const bsls::Types::Uint64 hash = bslmt::ThreadUtil::selfIdAsUint64()
+                                                    * 0x9E3779B97F4A7C15ULL;
+
+    const int shardIndex = static_cast<int>(hash >> 32) & d_shardMask;
+    Shard *shard = d_shards[shardIndex];
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&shard->d_mutex);
+
+    Node *node = acquireNode(shard, shardIndex);
+    proctor.release();
+
+    const int handle = node->d_handle.loadRelaxed() | k_BUSY_INDICATOR;
+
+    // Store the value before publishing the handle (see 'find').
+
+    node->d_value_p = value;
+    node->d_handle  = handle;
+
+    shard->d_length.addRelaxed(1);
+
+    return handle;
+}
+
+template <class TYPE>
+int ShardedObjectCatalog<TYPE>::remove(int handle, TYPE *valueBuffer)
+{
+    Shard *shard = d_shards[handle & d_shardMask];
+    Value *value;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&shard->d_mutex);
+
+        Node *node = findNode(handle);
+
+        if (!node) {
+            return -1;                                                // RETURN
+        }
+
+        // Invalidate the handle before detaching the value (see 'find').
+
+        releaseNode(shard, node);
+        value = node->d_value_p.swap(0);
+
+        shard->d_length.addRelaxed(-1);
+    }
+
+    // 'value' is now unreachable, and is retired once it has been copied
+    // (even if the assignment throws).
+
+    RetireGuard retireGuard(this, value);
+
+    if (valueBuffer) {
+        *valueBuffer = value->d_object.object();
+    }
+
+    return 0;
+}
+
+template <class TYPE>
+void ShardedObjectCatalog<TYPE>::removeAll(bsl::vector<TYPE> *buffer)
+{
+    Value *head = 0;
+    Value *tail = 0;
+
+    for (int i = 0; i < static_cast<int>(d_shards.size()); ++i) {
+        Shard *shard = d_shards[i];
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&shard->d_mutex);
+
+        for (int c = 0; c < Shard::k_MAX_NUM_CHUNKS; ++c) {
+            Node *chunk = shard->d_chunks[c].loadRelaxed();
+
+            if (!chunk) {
+                break;
+            }
+
+            const int chunkSize = Shard::k_FIRST_CHUNK_SIZE << c;
+
+            for (int j = 0; j < chunkSize; ++j) {
+                Node *node = chunk + j;
+
+                if (!(node->d_handle.loadRelaxed() & k_BUSY_INDICATOR)) {
+                    continue;
+                }
+
+                releaseNode(shard, node);
+
+                Value *value = node->d_value_p.swap(0);
+
+                value->d_next_p = head;
+                head = value;
+                if (!tail) {
+                    tail = value;
+                }
+            }
+        }
+        shard->d_length.storeRelaxed(0);
+    }
+
+    if (!head) {
+        return;                                                       // RETURN
+    }
+
+    if (buffer) {
+        for (Value *value = head; value; value = value->d_next_p) {
+            buffer->push_back(value->d_object.object());
+        }
+    }
+
+    retire(head, tail);
+}
+
+template <class TYPE>
+int ShardedObjectCatalog<TYPE>::replace(int handle, const TYPE& newObject)
+{
+    Value        *value = createValue(newObject);
+    ValueProctor  proctor(this, value);
+
+    Shard *shard = d_shards[handle & d_shardMask];
+    Value *previous;
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&shard->d_mutex);
+
+        Node *node = findNode(handle);
+
+        if (!node) {
+            return -1;                                                // RETURN
+        }
+
+        previous = node->d_value_p.swap(value);
+    }
+
+    proctor.release();
+
+    previous->d_next_p = 0;
+    retire(previous, previous);
+
+    return 0;
+}
+
+// ACCESSORS
+template <class TYPE>
+int ShardedObjectCatalog<TYPE>::find(int handle, TYPE *valueBuffer) const
+{
+    // Slots are never deallocated, so a stale handle can be rejected without
+    // entering the current epoch.
+
+    const Node *node = findNode(handle);
+
+    if (!node) {
+        return -1;                                                    // RETURN
+    }
+
+    // Register this operation in the count of readers of the current epoch,
+    // so that the value loaded below is not destroyed until this operation
+    // completes.
+
+    ReaderGuard readerGuard(
+                   &d_shards[handle & d_shardMask]->d_numReaders[d_epoch.load()
+                                                                       & 1]);
+
+    const Value *value = node->d_value_p.load();
+
+    // 'remove' invalidates the handle before detaching the value, and 'add'
+    // stores the value before publishing the handle: if the handle is still
+    // valid, 'value' is the object it refers to (or its replacement).
+
+    if (!value || handle != node->d_handle.load()) {
+        return -1;                                                    // RETURN
+    }
+
+    if (valueBuffer) {
+        *valueBuffer = value->d_object.object();
+    }
+
+    return 0;
+}
+
+template <class TYPE>
+int ShardedObjectCatalog<TYPE>::length() const
+{
+    int length = 0;
+
+    for (int i = 0; i < static_cast<int>(d_shards.size()); ++i) {
+        length += d_shards[i]->d_length.loadRelaxed();
+    }
+
+    return length;
+}
+
+template <class TYPE>
+inline
+int ShardedObjectCatalog<TYPE>::numShards() const
+{
+    return static_cast<int>(d_shards.size());
+}
+
+                                  // Aspects
+
+template <class TYPE>
+inline
+bslma::Allocator *ShardedObjectCatalog<TYPE>::allocator() const
+{
+    return d_allocator_p;
+}
+
+template <class TYPE>
+void ShardedObjectCatalog<TYPE>::verifyState() const
+{
+    for (int i = 0; i < static_cast<int>(d_shards.size()); ++i) {
+        Shard *shard = d_shards[i];
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&shard->d_mutex);
+
+        int nBusy  = 0;
+        int nSlots = 0;
+
+        for (int c = 0; c < Shard::k_MAX_NUM_CHUNKS; ++c) {
+            const Node *chunk = shard->d_chunks[c].loadRelaxed();
+
+            if (!chunk) {
+                break;
+            }
+
+            const int chunkSize = Shard::k_FIRST_CHUNK_SIZE << c;
+            const int chunkStart = Shard::chunkStart(c);
+
+            for (int j = 0;
+                 j < chunkSize && chunkStart + j < shard->d_numNodes;
+                 ++j) {
+                const int handle = chunk[j].d_handle.loadRelaxed();
+
+                BSLS_ASSERT(static_cast<int>(handle & k_INDEX_MASK)
+                             == (((chunkStart + j) << d_shardShift) | i));
+
+                if (handle & k_BUSY_INDICATOR) {
+                    BSLS_ASSERT(0 != chunk[j].d_value_p.loadRelaxed());
+                    ++nBusy;
+                }
+                else {
+                    BSLS_ASSERT(0 == chunk[j].d_value_p.loadRelaxed());
+                }
+                ++nSlots;
+            }
+        }
+
+        BSLS_ASSERT(nSlots == shard->d_numNodes);
+        BSLS_ASSERT(nBusy  == shard->d_length.loadRelaxed());
+
+        int nFree = 0;
+        for (const Node *p = shard->d_nextFreeNode_p; p; p = p->d_next_p) {
+            ++nFree;
+        }
+
+        BSLS_ASSERT(nFree + nBusy == shard->d_numNodes);
+    }
+}
+
+           // ---------------------------------------
+           // class ShardedObjectCatalog::ReaderGuard
+           // ---------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+ShardedObjectCatalog<TYPE>::ReaderGuard::ReaderGuard(
+                                                   bsls::AtomicInt *numReaders)
+: d_numReaders_p(numReaders)
+{
+    d_numReaders_p->add(1);
+}
+
+template <class TYPE>
+inline
+ShardedObjectCatalog<TYPE>::ReaderGuard::~ReaderGuard()
+{
+    d_numReaders_p->add(-1);
+}
+
+           // ---------------------------------------
+           // class ShardedObjectCatalog::RetireGuard
+           // ---------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+ShardedObjectCatalog<TYPE>::RetireGuard::RetireGuard(
+                                           ShardedObjectCatalog<TYPE> *catalog,
+                                           Value                      *value)
+: d_catalog_p(catalog)
+, d_value_p(value)
+{
+}
+
+template <class TYPE>
+inline
+ShardedObjectCatalog<TYPE>::RetireGuard::~RetireGuard()
+{
+    d_value_p->d_next_p = 0;
+    d_catalog_p->retire(d_value_p, d_value_p);
+}
+
+           // ----------------------------------------
+           // class ShardedObjectCatalog::ValueProctor
+           // ----------------------------------------
+
+// CREATORS
+template <class TYPE>
+inline
+ShardedObjectCatalog<TYPE>::ValueProctor::ValueProctor(
+                                           ShardedObjectCatalog<TYPE> *catalog,
+                                           Value                      *value)
+: d_catalog_p(catalog)
+, d_value_p(value)
+{
+}
+
+template <class TYPE>
+inline
+ShardedObjectCatalog<TYPE>::ValueProctor::~ValueProctor()
+{
+    if (d_value_p) {
+        d_value_p->d_next_p = 0;
+        d_catalog_p->destroyValues(d_value_p);
+    }
+}
+
+// MANIPULATORS
+template <class TYPE>
+inline
+void ShardedObjectCatalog<TYPE>::ValueProctor::release()
+{
+    d_value_p = 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
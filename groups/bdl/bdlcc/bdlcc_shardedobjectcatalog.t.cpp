@@ -0,0 +1,1464 @@
+// bdlcc_shardedobjectcatalog.t.cpp                                   -*-C++-*-
+#include <bdlcc_shardedobjectcatalog.h>
+
+#include <bdlcc_objectcatalog.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_set.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'bdlcc::ShardedObjectCatalog' provides the interface of
+// 'bdlcc::ObjectCatalog' (minus iteration), implemented with sharded slots and
+// a wait-free 'find'.  We first verify the single-threaded behavior of the
+// primary manipulators ('add' and 'remove') and of the basic accessors, with
+// catalogs having various numbers of shards, and with threads adding objects
+// to different shards.  We then verify 'replace', 'removeAll', and the
+// rejection of stale and invalid handles.  Object lifetime, allocator
+// propagation, and exception safety are verified with 'bslma::TestAllocator'
+// and with element types that count their instances and throw on demand.
+// The deferred destruction of an object removed while a 'find' operation is
+// copying it is verified with an element type whose assignment operator
+// blocks on demand.  Finally, a concurrency test with readers, and with
+// writers adding, replacing, and removing objects, verifies that readers never
+// observe a destroyed or inconsistent object.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ShardedObjectCatalog(bslma::Allocator *basicAllocator = 0);
+// [ 2] ShardedObjectCatalog(int numShards, bslma::Allocator *ba = 0);
+// [ 5] ~ShardedObjectCatalog();
+//
+// MANIPULATORS
+// [ 2] int add(const TYPE& object);
+// [ 2] int remove(int handle, TYPE *valueBuffer = 0);
+// [ 3] void removeAll(bsl::vector<TYPE> *buffer = 0);
+// [ 3] int replace(int handle, const TYPE& newObject);
+//
+// ACCESSORS
+// [ 2] int find(int handle, TYPE *valueBuffer = 0) const;
+// [ 2] int length() const;
+// [ 2] int numShards() const;
+// [ 2] bslma::Allocator *allocator() const;
+// [ 2] void verifyState() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] STALE HANDLE REJECTION
+// [ 5] OBJECT LIFETIME AND EXCEPTION SAFETY
+// [ 6] DEFERRED DESTRUCTION
+// [ 7] CONCURRENCY TEST
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: 'ShardedObjectCatalog' vs. 'ObjectCatalog'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   THREAD-SAFE OUTPUT AND ASSERT MACROS
+// ----------------------------------------------------------------------------
+
+static bslmt::Mutex coutMutex;
+
+#define ASSERTT(X) {                                                          \
+   if (!(X)) {                                                                \
+       bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);                      \
+       aSsErT(1, #X, __LINE__); } }
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::ShardedObjectCatalog<int> Obj;
+typedef bsls::Types::Int64               Int64;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+enum {
+    k_INDEX_MASK     = 0x007fffff,
+    k_BUSY_INDICATOR = 0x00800000
+};
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+                               // =============
+                               // class Counted
+                               // =============
+
+class Counted {
+    // This class provides a value-semantic, allocator-aware type that counts
+    // its instances, and whose copy constructor throws an 'int' exception if
+    // the value being copied is negative.
+
+    // DATA
+    bsl::string             d_value;        // value (as a string, so that
+                                            // memory is allocated)
+
+    int                     d_intValue;     // value
+
+    static bsls::AtomicInt  s_numObjects;   // number of live instances
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Counted, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int numObjects()
+    {
+        return s_numObjects;
+    }
+
+    // CREATORS
+    explicit Counted(int value = 0, bslma::Allocator *basicAllocator = 0)
+    : d_value("a string long enough to require a memory allocation",
+              basicAllocator)
+    , d_intValue(value)
+    {
+        ++s_numObjects;
+    }
+
+    Counted(const Counted& original, bslma::Allocator *basicAllocator = 0)
+    : d_value(original.d_value, basicAllocator)
+    , d_intValue(original.d_intValue)
+    {
+        if (d_intValue < 0) {
+            throw d_intValue;
+        }
+        ++s_numObjects;
+    }
+
+    ~Counted()
+    {
+        --s_numObjects;
+    }
+
+    // MANIPULATORS
+    Counted& operator=(const Counted& rhs)
+    {
+        d_value    = rhs.d_value;
+        d_intValue = rhs.d_intValue;
+        return *this;
+    }
+
+    // ACCESSORS
+    bslma::Allocator *allocator() const
+    {
+        return d_value.get_allocator().mechanism();
+    }
+
+    int value() const
+    {
+        return d_intValue;
+    }
+};
+
+bsls::AtomicInt Counted::s_numObjects(0);
+
+                               // ==============
+                               // class Blocking
+                               // ==============
+
+class Blocking {
+    // This class provides a value-semantic type whose assignment operator
+    // blocks on a barrier while blocking is enabled, and which records the
+    // destruction of its instances having a non-zero value.
+
+    // DATA
+    int                     d_value;
+
+    static bslmt::Barrier  *s_barrier_p;      // barrier (when enabled)
+
+    static bsls::AtomicInt  s_numDestroyed;   // number of destroyed instances
+                                              // having a non-zero value
+
+  public:
+    // CLASS METHODS
+    static void enableBlocking(bslmt::Barrier *barrier)
+    {
+        s_barrier_p = barrier;
+    }
+
+    static int numDestroyed()
+    {
+        return s_numDestroyed;
+    }
+
+    // CREATORS
+    explicit Blocking(int value = 0)
+    : d_value(value)
+    {
+    }
+
+    Blocking(const Blocking& original)
+    : d_value(original.d_value)
+    {
+    }
+
+    ~Blocking()
+    {
+        if (d_value) {
+            ++s_numDestroyed;
+        }
+        d_value = -1;
+    }
+
+    // MANIPULATORS
+    Blocking& operator=(const Blocking& rhs)
+    {
+        bslmt::Barrier *barrier = s_barrier_p;
+
+        if (barrier) {
+            // Signal that the assignment started, and wait until the test is
+            // ready to let it complete.
+
+            s_barrier_p = 0;
+            barrier->wait();
+            barrier->wait();
+        }
+        d_value = rhs.d_value;
+        return *this;
+    }
+
+    // ACCESSORS
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+bslmt::Barrier  *Blocking::s_barrier_p = 0;
+bsls::AtomicInt  Blocking::s_numDestroyed(0);
+
+                               // =============
+                               // class Checked
+                               // =============
+
+class Checked {
+    // This class provides a value-semantic type holding a value and its
+    // complement, which are overwritten with inconsistent values on
+    // destruction, so that accessing a destroyed object can be detected.
+
+    // DATA
+    int          d_value;
+    unsigned int d_check;
+
+  public:
+    // CREATORS
+    explicit Checked(int value = 0)
+    : d_value(value)
+    , d_check(~static_cast<unsigned int>(value))
+    {
+    }
+
+    Checked(const Checked& original)
+    : d_value(original.d_value)
+    , d_check(original.d_check)
+    {
+    }
+
+    ~Checked()
+    {
+        d_value = 0;
+        d_check = 0;
+    }
+
+    // MANIPULATORS
+    Checked& operator=(const Checked& rhs)
+    {
+        d_value = rhs.d_value;
+        d_check = rhs.d_check;
+        return *this;
+    }
+
+    // ACCESSORS
+    bool isValid() const
+    {
+        return d_check == ~static_cast<unsigned int>(d_value);
+    }
+
+    int value() const
+    {
+        return d_value;
+    }
+};
+
+void findBlocking(bdlcc::ShardedObjectCatalog<Blocking> *catalog,
+                  int                                    handle,
+                  Blocking                              *result)
+    // Find the object having the specified 'handle' in the specified 'catalog'
+    // and load its value into the specified 'result'.
+{
+    ASSERTT(0 == catalog->find(handle, result));
+}
+
+                            // ===================
+                            // struct ConcurrentTest
+                            // ===================
+
+struct ConcurrentTest {
+    // This 'struct' holds the state shared by the threads of the concurrency
+    // test.
+
+    typedef bdlcc::ShardedObjectCatalog<Checked> Catalog;
+
+    // DATA
+    Catalog          *d_catalog_p;
+    bsl::vector<int>  d_handles;      // handles of objects that are never
+                                      // removed
+    bsls::AtomicInt   d_recentHandle; // handle of an object recently added
+                                      // by a writer
+    bsls::AtomicInt   d_numWriters;   // number of writers still running
+    bslmt::Barrier   *d_barrier_p;
+};
+
+void concurrentReader(ConcurrentTest *test)
+    // Look up the stable objects of the specified 'test', and the objects
+    // being removed by writers, until all writers have completed.
+{
+    test->d_barrier_p->wait();
+
+    const int numStable = static_cast<int>(test->d_handles.size());
+
+    Int64 iteration = 0;
+    while (test->d_numWriters > 0 || iteration < 1000) {
+        const int i = static_cast<int>(iteration % numStable);
+
+        Checked value;
+        ASSERTT(0 == test->d_catalog_p->find(test->d_handles[i], &value));
+        ASSERTT(value.isValid());
+        ASSERTT(value.value() % numStable == i);
+
+        // Look up a handle that may refer to an object being removed or
+        // replaced by a writer.
+
+        if (0 == test->d_catalog_p->find(test->d_recentHandle, &value)) {
+            ASSERTT(value.isValid());
+        }
+        ++iteration;
+    }
+}
+
+void concurrentWriter(ConcurrentTest *test, int numIterations)
+    // Add, replace, look up, and remove objects in the catalog of the
+    // specified 'test' the specified 'numIterations' times, and replace the
+    // stable objects of 'test' with equivalent objects.
+{
+    test->d_barrier_p->wait();
+
+    const int numStable = static_cast<int>(test->d_handles.size());
+
+    for (int i = 0; i < numIterations; ++i) {
+        const int handle = test->d_catalog_p->add(Checked(i));
+        test->d_recentHandle = handle;
+
+        Checked value;
+        ASSERTT(0 == test->d_catalog_p->find(handle, &value));
+        ASSERTT(value.isValid());
+        ASSERTT(i == value.value());
+
+        ASSERTT(0 == test->d_catalog_p->replace(handle, Checked(i + 1)));
+
+        // Replace a stable object with an object having an equivalent value.
+
+        const int s = i % numStable;
+        ASSERTT(0 == test->d_catalog_p->replace(test->d_handles[s],
+                                                Checked(s + numStable * i)));
+
+        ASSERTT(0 == test->d_catalog_p->remove(handle, &value));
+        ASSERTT(value.isValid());
+        ASSERTT(i + 1 == value.value());
+        ASSERTT(0 != test->d_catalog_p->find(handle));
+    }
+
+    --test->d_numWriters;
+}
+
+void addToCatalog(bdlcc::ShardedObjectCatalog<int> *catalog,
+                  int                               numObjects,
+                  bsl::vector<int>                 *handles)
+    // Add the specified 'numObjects' objects to the specified 'catalog', and
+    // load their handles into the specified 'handles'.
+{
+    for (int i = 0; i < numObjects; ++i) {
+        handles->push_back(catalog->add(i));
+    }
+}
+
+                              // ================
+                              // struct Benchmark
+                              // ================
+
+template <class CATALOG>
+struct Benchmark {
+    // This 'struct' holds the state shared by the threads of the performance
+    // test.
+
+    // DATA
+    CATALOG          *d_catalog_p;
+    bsl::vector<int>  d_handles;
+    bsls::AtomicInt   d_done;
+    bslmt::Barrier   *d_barrier_p;
+};
+
+template <class CATALOG>
+void benchmarkReader(Benchmark<CATALOG> *benchmark, int numLookups)
+    // Look up the specified 'numLookups' objects of the catalog of the
+    // specified 'benchmark'.
+{
+    benchmark->d_barrier_p->wait();
+
+    const int numHandles = static_cast<int>(benchmark->d_handles.size());
+
+    int sum = 0;
+    for (int i = 0; i < numLookups; ++i) {
+        int value;
+        if (0 == benchmark->d_catalog_p->find(
+                                  benchmark->d_handles[i % numHandles],
+                                  &value)) {
+            sum += value;
+        }
+    }
+    ASSERTT(0 <= sum);
+}
+
+template <class CATALOG>
+void benchmarkWriter(Benchmark<CATALOG> *benchmark)
+    // Add and remove objects to the catalog of the specified 'benchmark'
+    // until the benchmark is done.
+{
+    benchmark->d_barrier_p->wait();
+
+    while (!benchmark->d_done) {
+        for (int i = 0; i < 100; ++i) {
+            benchmark->d_catalog_p->remove(benchmark->d_catalog_p->add(i));
+        }
+        bslmt::ThreadUtil::yield();
+    }
+}
+
+template <class CATALOG>
+double runBenchmark(CATALOG *catalog, int numReaders, int numLookups)
+    // Return the time, in seconds, taken by the specified 'numReaders' threads
+    // to each look up the specified 'numLookups' objects in the specified
+    // 'catalog', while another thread adds and removes objects.
+{
+    enum { k_NUM_OBJECTS = 1000 };
+
+    Benchmark<CATALOG> benchmark;
+    bslmt::Barrier     barrier(numReaders + 2);
+
+    benchmark.d_catalog_p = catalog;
+    benchmark.d_barrier_p = &barrier;
+
+    for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+        benchmark.d_handles.push_back(catalog->add(i));
+    }
+
+    bslmt::ThreadGroup readers;
+    bslmt::ThreadGroup writers;
+
+    readers.addThreads(bdlf::BindUtil::bind(&benchmarkReader<CATALOG>,
+                                            &benchmark,
+                                            numLookups),
+                       numReaders);
+    writers.addThread(bdlf::BindUtil::bind(&benchmarkWriter<CATALOG>,
+                                           &benchmark));
+
+    bsls::Stopwatch stopwatch;
+    stopwatch.start();
+
+    barrier.wait();
+    readers.joinAll();
+
+    stopwatch.stop();
+
+    benchmark.d_done = 1;
+    writers.joinAll();
+
+    return stopwatch.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE_1 {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: A Registry of Sessions
+///- - - - - - - - - - - - - - - - -
+// In the following example a 'bdlcc::ShardedObjectCatalog' is used to map
+// integer identifiers, carried in every message received by a server, to the
+// sessions those messages belong to.  Messages are received by several I/O
+// threads, each of which looks up the session of every message; sessions are
+// opened and closed comparatively rarely.
+//
+// First, we define the information held for each session:
+//..
+    struct my_Session {
+        int d_userId;     // identifier of the user who opened the session
+        int d_priority;   // priority of the messages of the session
+    };
+//..
+// Then, we define the function used by an I/O thread to process a message
+// addressed to the session identified by 'sessionHandle'.  Looking up the
+// session does not block, even while other threads are opening or closing
+// sessions:
+//..
+    typedef bdlcc::ShardedObjectCatalog<my_Session> my_SessionCatalog;
+
+    int myProcessMessage(const my_SessionCatalog& sessions, int sessionHandle)
+        // Return the priority of a message addressed to the session having the
+        // specified 'sessionHandle' in the specified 'sessions', or -1 if the
+        // session has been closed.
+    {
+        my_Session session;
+        if (0 != sessions.find(sessionHandle, &session)) {
+            return -1;                                                // RETURN
+        }
+        return session.d_priority;
+    }
+//..
+
+}  // close namespace USAGE_EXAMPLE_1
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE_1;
+
+// Finally, we open two sessions, process messages addressed to both of them,
+// and close one; messages addressed to the closed session are then rejected:
+//..
+    bdlcc::ShardedObjectCatalog<my_Session> sessions;
+
+    my_Session alice = { 1, 10 };
+    my_Session bob   = { 2, 20 };
+
+    int aliceHandle = sessions.add(alice);
+    int bobHandle   = sessions.add(bob);
+    ASSERT(2 == sessions.length());
+
+    ASSERT(10 == myProcessMessage(sessions, aliceHandle));
+    ASSERT(20 == myProcessMessage(sessions, bobHandle));
+
+    my_Session closed;
+    ASSERT(0 == sessions.remove(bobHandle, &closed));
+    ASSERT(2  == closed.d_userId);
+    ASSERT(1  == sessions.length());
+
+    ASSERT(10 == myProcessMessage(sessions, aliceHandle));
+    ASSERT(-1 == myProcessMessage(sessions, bobHandle));
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 'find' never observes an object that was destroyed, or that is
+        //:   being constructed or destroyed, while other threads add, replace,
+        //:   and remove objects in the same shards.
+        //:
+        //: 2 Objects that are never removed are always found, even while they
+        //:   are being replaced.
+        //:
+        //: 3 All objects are destroyed, and the catalog is consistent, once
+        //:   all threads have completed.
+        //
+        // Plan:
+        //: 1 Add a set of stable objects, and start several reader threads,
+        //:   looking up the stable objects and handles that may refer to
+        //:   objects being removed, and several writer threads, adding,
+        //:   replacing, and removing objects, and replacing the stable
+        //:   objects.  The objects hold a value and its complement, which are
+        //:   overwritten on destruction; verify that the readers always
+        //:   observe consistent values.  (C-1..2)
+        //:
+        //: 2 After joining all threads, verify the state of the catalog, and
+        //:   that no memory is leaked.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        enum {
+            k_NUM_STABLE     = 64,
+            k_NUM_READERS    = 4,
+            k_NUM_WRITERS    = 4
+        };
+
+        const int NUM_ITERATIONS = 20000;
+
+        for (int numShards = 1; numShards <= 8; numShards *= 4) {
+            if (veryVerbose) { T_ P(numShards) }
+
+            bslma::TestAllocator ta(veryVeryVerbose);
+            {
+                ConcurrentTest::Catalog catalog(numShards, &ta);
+                bslmt::Barrier          barrier(k_NUM_READERS
+                                                + k_NUM_WRITERS);
+
+                ConcurrentTest test;
+                test.d_catalog_p = &catalog;
+                test.d_barrier_p = &barrier;
+                test.d_numWriters = k_NUM_WRITERS;
+
+                for (int i = 0; i < k_NUM_STABLE; ++i) {
+                    test.d_handles.push_back(catalog.add(Checked(i)));
+                }
+
+                bslmt::ThreadGroup threads;
+                threads.addThreads(bdlf::BindUtil::bind(&concurrentReader,
+                                                        &test),
+                                   k_NUM_READERS);
+                threads.addThreads(bdlf::BindUtil::bind(&concurrentWriter,
+                                                        &test,
+                                                        NUM_ITERATIONS),
+                                   k_NUM_WRITERS);
+                threads.joinAll();
+
+                catalog.verifyState();
+                ASSERTV(catalog.length(), k_NUM_STABLE == catalog.length());
+
+                for (int i = 0; i < k_NUM_STABLE; ++i) {
+                    Checked value;
+                    ASSERTV(i, 0 == catalog.find(test.d_handles[i], &value));
+                    ASSERTV(i, value.isValid());
+                    ASSERTV(i, i == value.value() % k_NUM_STABLE);
+                }
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // DEFERRED DESTRUCTION
+        //
+        // Concerns:
+        //: 1 An object removed (or replaced) while a 'find' operation is
+        //:   copying it is not destroyed before the 'find' operation
+        //:   completes, and the 'find' operation loads its value.
+        //:
+        //: 2 Such an object is destroyed by a subsequent modification of the
+        //:   catalog once the 'find' operation has completed.
+        //:
+        //: 3 In the absence of concurrent 'find' operations, objects are
+        //:   destroyed by 'remove' and 'replace'.
+        //
+        // Plan:
+        //: 1 Using an element type whose assignment operator blocks on a
+        //:   barrier on demand, start a 'find' operation in another thread,
+        //:   and, while it is blocked, remove (or replace) the object, and
+        //:   perform other modifications.  Verify that the object is not
+        //:   destroyed until the 'find' operation is released and another
+        //:   modification is performed.  (C-1..2)
+        //:
+        //: 2 Remove and replace objects in a single thread, and verify that
+        //:   they are destroyed immediately.  (C-3)
+        //
+        // Testing:
+        //   DEFERRED DESTRUCTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "DEFERRED DESTRUCTION" << endl
+                          << "====================" << endl;
+
+        typedef bdlcc::ShardedObjectCatalog<Blocking> Catalog;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        if (verbose) cout << "\tWithout concurrent 'find'." << endl;
+        {
+            Catalog mX(&ta);
+
+            const int base = Blocking::numDestroyed();
+
+            const int h1 = mX.add(Blocking(1));
+            ASSERTV(Blocking::numDestroyed(),
+                    base + 1 == Blocking::numDestroyed());  // temporary
+
+            ASSERT(0 == mX.replace(h1, Blocking(2)));
+            ASSERTV(Blocking::numDestroyed(),
+                    base + 3 == Blocking::numDestroyed());
+
+            ASSERT(0 == mX.remove(h1));
+            ASSERTV(Blocking::numDestroyed(),
+                    base + 4 == Blocking::numDestroyed());
+        }
+
+        for (int replaceFlag = 0; replaceFlag < 2; ++replaceFlag) {
+            if (verbose) cout << "\tWith a concurrent 'find' ("
+                              << (replaceFlag ? "replace" : "remove")
+                              << ")." << endl;
+
+            Catalog        mX(1, &ta);
+            bslmt::Barrier barrier(2);
+
+            const int h1 = mX.add(Blocking(1));
+            const int h2 = mX.add(Blocking(2));
+
+            const int base = Blocking::numDestroyed();
+
+            Blocking           result;
+            bslmt::ThreadGroup threads;
+
+            Blocking::enableBlocking(&barrier);
+            threads.addThread(bdlf::BindUtil::bind(&findBlocking,
+                                                   &mX,
+                                                   h1,
+                                                   &result));
+
+            barrier.wait();  // 'find' is copying the object
+
+            if (replaceFlag) {
+                ASSERT(0 == mX.replace(h1, Blocking(3)));
+            }
+            else {
+                ASSERT(0 == mX.remove(h1));
+                ASSERT(0 != mX.find(h1));
+            }
+
+            // Further modifications do not destroy the object.
+
+            ASSERT(0 == mX.replace(h2, Blocking(4)));
+            ASSERT(0 == mX.replace(h2, Blocking(5)));
+
+            const int numDestroyed = Blocking::numDestroyed() - base;
+
+            // Only the temporaries have been destroyed: the epoch cannot
+            // advance twice while 'find' is in progress.
+
+            ASSERTV(numDestroyed, (replaceFlag ? 3 : 2) == numDestroyed);
+
+            barrier.wait();  // release 'find'
+            threads.joinAll();
+
+            ASSERTV(result.value(), 1 == result.value());
+
+            // The next modification destroys the retired objects ('1', '2',
+            // '4', and '5'), and its temporary.
+
+            ASSERT(0 == mX.replace(h2, Blocking(6)));
+
+            ASSERTV(Blocking::numDestroyed() - base,
+                    numDestroyed + 5 == Blocking::numDestroyed() - base);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // OBJECT LIFETIME AND EXCEPTION SAFETY
+        //
+        // Concerns:
+        //: 1 Objects held by the catalog are created using the allocator of
+        //:   the catalog, if their type is allocator-aware.
+        //:
+        //: 2 Objects are destroyed by 'remove', 'replace', 'removeAll', and
+        //:   the destructor.
+        //:
+        //: 3 If the copy constructor of an object throws during 'add' or
+        //:   'replace', the catalog is unchanged, and no memory is leaked.
+        //:
+        //: 4 No memory is allocated from the default allocator.
+        //
+        // Plan:
+        //: 1 Using an allocator-aware type that counts its instances and whose
+        //:   copy constructor throws on demand, add, replace, and remove
+        //:   objects, verifying the number of live objects, the allocator of
+        //:   the objects held, and the state of the catalog.  (C-1..4)
+        //
+        // Testing:
+        //   ~ShardedObjectCatalog();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "OBJECT LIFETIME AND EXCEPTION SAFETY" << endl
+                          << "====================================" << endl;
+
+        typedef bdlcc::ShardedObjectCatalog<Counted> Catalog;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        bslma::TestAllocator oa(veryVeryVerbose);
+
+        {
+            Catalog mX(2, &ta);  const Catalog& X = mX;
+
+            const Counted V1(1, &oa);
+            const Counted V2(2, &oa);
+            const Counted VT(-1, &oa);
+
+            ASSERT(3 == Counted::numObjects());
+
+            const int h1 = mX.add(V1);
+            const int h2 = mX.add(V2);
+
+            ASSERT(5 == Counted::numObjects());
+
+            Counted value(0, &oa);
+            ASSERT(0 == X.find(h1, &value));
+            ASSERT(1 == value.value());
+            ASSERT(6 == Counted::numObjects());
+
+            {
+                bsl::vector<Counted> removed(&oa);
+                mX.removeAll(&removed);
+                ASSERT(2 == removed.size());
+                ASSERT(0 == X.length());
+                ASSERT(0 != X.find(h1));
+                ASSERT(0 != X.find(h2));
+            }
+            ASSERTV(Counted::numObjects(), 4 == Counted::numObjects());
+
+            const int h3 = mX.add(V1);
+            ASSERT(5 == Counted::numObjects());
+
+            if (verbose) cout << "\tException safety of 'add'." << endl;
+
+            const Int64 numBlocks = ta.numBlocksInUse();
+            try {
+                mX.add(VT);
+                ASSERT(0);
+            }
+            catch (int e) {
+                ASSERT(-1 == e);
+            }
+            ASSERT(1 == X.length());
+            ASSERT(5 == Counted::numObjects());
+            ASSERT(numBlocks == ta.numBlocksInUse());
+            X.verifyState();
+
+            if (verbose) cout << "\tException safety of 'replace'." << endl;
+
+            try {
+                mX.replace(h3, VT);
+                ASSERT(0);
+            }
+            catch (int e) {
+                ASSERT(-1 == e);
+            }
+            ASSERT(1 == X.length());
+            ASSERT(5 == Counted::numObjects());
+            ASSERT(numBlocks == ta.numBlocksInUse());
+            ASSERT(0 == X.find(h3, &value));
+            ASSERT(1 == value.value());
+            X.verifyState();
+
+            ASSERT(0 == mX.replace(h3, V2));
+            ASSERT(5 == Counted::numObjects());
+
+            ASSERT(0 == mX.remove(h3));
+            ASSERT(4 == Counted::numObjects());
+
+            for (int i = 0; i < 100; ++i) {
+                mX.add(V1);
+            }
+            ASSERT(104 == Counted::numObjects());
+
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+        }
+        ASSERTV(Counted::numObjects(), 0 == Counted::numObjects());
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksTotal(),
+                0 == defaultAllocator.numBlocksTotal());
+
+        if (verbose) cout << "\tAllocator propagation." << endl;
+        {
+            Catalog mX(&ta);  const Catalog& X = mX;
+
+            bsl::vector<int> handles;
+
+            const Counted V(7, &oa);
+
+            for (int i = 0; i < 10; ++i) {
+                handles.push_back(mX.add(V));
+            }
+
+            // Verify the allocator of the held objects through a buffer that
+            // is assigned into (and whose allocator is therefore unchanged),
+            // and through the objects loaded by 'removeAll'.
+
+            Counted value(0, &oa);
+            ASSERT(0 == X.find(handles[0], &value));
+            ASSERT(&oa == value.allocator());
+
+            const Int64 numBlocks = ta.numBlocksInUse();
+            {
+                bsl::vector<Counted> removed(&oa);
+                mX.removeAll(&removed);
+                ASSERT(10 == removed.size());
+            }
+
+            // The strings held by the removed objects were allocated by the
+            // catalog allocator.
+
+            ASSERTV(numBlocks, ta.numBlocksInUse(),
+                    numBlocks - 10 == ta.numBlocksInUse());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // STALE HANDLE REJECTION
+        //
+        // Concerns:
+        //: 1 A handle is rejected by 'find', 'replace', and 'remove' once its
+        //:   object has been removed, even if its slot has been reused.
+        //:
+        //: 2 Handles that were never returned by 'add' (including 0, handles
+        //:   whose "busy" bit is not set, and handles referring to slots that
+        //:   were never allocated) are rejected.
+        //
+        // Plan:
+        //: 1 Repeatedly add and remove an object, so that the same slot is
+        //:   reused, and verify that all previous handles are rejected.
+        //:   (C-1)
+        //:
+        //: 2 Verify that a set of invalid handles is rejected.  (C-2)
+        //
+        // Testing:
+        //   STALE HANDLE REJECTION
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STALE HANDLE REJECTION" << endl
+                          << "======================" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(4, &ta);  const Obj& X = mX;
+
+            bsl::vector<int> handles;
+
+            for (int i = 0; i < 255; ++i) {
+                const int handle = mX.add(i);
+
+                ASSERTV(i, handle);
+                ASSERTV(i, handle & k_BUSY_INDICATOR);
+                if (!handles.empty()) {
+                    // The same slot is reused.
+
+                    ASSERTV(i, (handles.back() & k_INDEX_MASK)
+                                                 == (handle & k_INDEX_MASK));
+                    ASSERTV(i, handles.back() != handle);
+                }
+
+                for (int j = 0; j < static_cast<int>(handles.size()); ++j) {
+                    ASSERTV(i, j, 0 != X.find(handles[j]));
+                    ASSERTV(i, j, 0 != mX.replace(handles[j], -1));
+                    ASSERTV(i, j, 0 != mX.remove(handles[j]));
+                }
+
+                int value;
+                ASSERTV(i, 0 == X.find(handle, &value));
+                ASSERTV(i, i == value);
+
+                ASSERTV(i, 0 == mX.remove(handle));
+                handles.push_back(handle);
+            }
+            X.verifyState();
+
+            const int h = mX.add(0);
+
+            const int INVALID[] = {
+                0,
+                -1,
+                h & ~k_BUSY_INDICATOR,
+                h + (1 << 2),            // next slot of the same shard
+                h + 1,                   // same position, in another shard
+                (h & ~k_INDEX_MASK) | ((k_INDEX_MASK >> 2) << 2),
+                k_BUSY_INDICATOR | k_INDEX_MASK,
+                0x7fffffff
+            };
+            const int NUM_INVALID = sizeof INVALID / sizeof *INVALID;
+
+            for (int i = 0; i < NUM_INVALID; ++i) {
+                ASSERTV(i, 0 != X.find(INVALID[i]));
+                ASSERTV(i, 0 != mX.replace(INVALID[i], 0));
+                ASSERTV(i, 0 != mX.remove(INVALID[i]));
+            }
+            ASSERT(0 == X.find(h));
+            ASSERT(1 == X.length());
+            X.verifyState();
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'replace' AND 'removeAll'
+        //
+        // Concerns:
+        //: 1 'replace' changes the value of the object having the handle, and
+        //:   does not change its handle or the length of the catalog.
+        //:
+        //: 2 'removeAll' removes all the objects, optionally appending them to
+        //:   the supplied buffer, and invalidates their handles.
+        //:
+        //: 3 The slots of removed objects are reused.
+        //
+        // Plan:
+        //: 1 Add objects, replace them, and verify their values.  (C-1)
+        //:
+        //: 2 Call 'removeAll' with and without a buffer, and verify the
+        //:   contents of the buffer and the state of the catalog.  Add objects
+        //:   again, and verify that no memory is allocated for new slots.
+        //:   (C-2..3)
+        //
+        // Testing:
+        //   void removeAll(bsl::vector<TYPE> *buffer = 0);
+        //   int replace(int handle, const TYPE& newObject);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'replace' AND 'removeAll'" << endl
+                          << "=================================" << endl;
+
+        enum { k_NUM_OBJECTS = 300 };
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(2, &ta);  const Obj& X = mX;
+
+            bsl::vector<int> handles;
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                handles.push_back(mX.add(i));
+            }
+
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                ASSERTV(i, 0 == mX.replace(handles[i], i + 1000));
+            }
+            ASSERT(k_NUM_OBJECTS == X.length());
+            X.verifyState();
+
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                int value;
+                ASSERTV(i, 0 == X.find(handles[i], &value));
+                ASSERTV(i, value, i + 1000 == value);
+            }
+
+            bsl::vector<int> removed(&ta);
+            removed.push_back(-1);
+
+            mX.removeAll(&removed);
+            ASSERT(0 == X.length());
+            ASSERT(k_NUM_OBJECTS + 1 == removed.size());
+            ASSERT(-1 == removed[0]);
+
+            bsl::sort(removed.begin() + 1, removed.end());
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                ASSERTV(i, i + 1000 == removed[i + 1]);
+                ASSERTV(i, 0 != X.find(handles[i]));
+            }
+            X.verifyState();
+
+            // The slots are reused.
+
+            const Int64 numBlocks = ta.numBlocksTotal();
+
+            handles.clear();
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                handles.push_back(mX.add(i));
+            }
+            ASSERTV(numBlocks, ta.numBlocksTotal(),
+                    numBlocks == ta.numBlocksTotal());
+            ASSERT(k_NUM_OBJECTS == X.length());
+            X.verifyState();
+
+            mX.removeAll();
+            ASSERT(0 == X.length());
+            X.verifyState();
+
+            mX.removeAll();
+            ASSERT(0 == X.length());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 The catalog is created with the specified (or default) number of
+        //:   shards, and uses the specified (or default) allocator.
+        //:
+        //: 2 'add' returns distinct non-zero handles, which can be used with
+        //:   'find' and 'remove', and 'length' reflects the number of objects
+        //:   held.
+        //:
+        //: 3 'remove' optionally loads the value of the removed object, and
+        //:   invalidates its handle.
+        //:
+        //: 4 Objects added by different threads are spread over the shards,
+        //:   and the handles identify their shard.
+        //:
+        //: 5 Slots are allocated in chunks as the catalog grows.
+        //
+        // Plan:
+        //: 1 Create catalogs with each valid number of shards, add many
+        //:   objects (spanning several chunks), verify their handles and
+        //:   values, and remove them in a different order.  (C-1..3, 5)
+        //:
+        //: 2 Add objects from several threads, and verify that more than one
+        //:   shard is used.  (C-4)
+        //
+        // Testing:
+        //   ShardedObjectCatalog(bslma::Allocator *basicAllocator = 0);
+        //   ShardedObjectCatalog(int numShards, bslma::Allocator *ba = 0);
+        //   int add(const TYPE& object);
+        //   int remove(int handle, TYPE *valueBuffer = 0);
+        //   int find(int handle, TYPE *valueBuffer = 0) const;
+        //   int length() const;
+        //   int numShards() const;
+        //   bslma::Allocator *allocator() const;
+        //   void verifyState() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout
+                         << endl
+                         << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                         << "========================================" << endl;
+
+        enum { k_NUM_OBJECTS = 1000 };
+
+        {
+            Obj mX;  const Obj& X = mX;
+            ASSERT(Obj::k_DEFAULT_NUM_SHARDS == X.numShards());
+            ASSERT(&defaultAllocator         == X.allocator());
+            ASSERT(0                         == X.length());
+        }
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int numShards = 1; numShards <= Obj::k_MAX_NUM_SHARDS;
+                                                              numShards *= 2) {
+            if (veryVerbose) { T_ P(numShards) }
+
+            Obj mX(numShards, &ta);  const Obj& X = mX;
+
+            ASSERT(numShards == X.numShards());
+            ASSERT(&ta       == X.allocator());
+            ASSERT(0         == X.length());
+
+            bsl::vector<int> handles;
+            bsl::set<int>    distinct;
+
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                const int handle = mX.add(i);
+
+                ASSERTV(numShards, i, 0 != handle);
+                ASSERTV(numShards, i, distinct.insert(handle).second);
+                ASSERTV(numShards, i, i + 1 == X.length());
+
+                handles.push_back(handle);
+            }
+            X.verifyState();
+
+            for (int i = 0; i < k_NUM_OBJECTS; ++i) {
+                int value = -1;
+                ASSERTV(numShards, i, 0 == X.find(handles[i]));
+                ASSERTV(numShards, i, 0 == X.find(handles[i], &value));
+                ASSERTV(numShards, i, i == value);
+            }
+
+            // Remove the odd objects first, then the even ones.
+
+            for (int parity = 1; parity >= 0; --parity) {
+                for (int i = parity; i < k_NUM_OBJECTS; i += 2) {
+                    int value = -1;
+                    ASSERTV(numShards, i, 0 == mX.remove(handles[i], &value));
+                    ASSERTV(numShards, i, i == value);
+                    ASSERTV(numShards, i, 0 != X.find(handles[i]));
+                    ASSERTV(numShards, i, 0 != mX.remove(handles[i]));
+                }
+                X.verifyState();
+            }
+            ASSERT(0 == X.length());
+
+            // Objects added by several threads use several shards.
+
+            if (1 < numShards) {
+                enum { k_NUM_THREADS = 16 };
+
+                bsl::vector<int>   threadHandles[k_NUM_THREADS];
+                bslmt::ThreadGroup threads;
+
+                for (int t = 0; t < k_NUM_THREADS; ++t) {
+                    threads.addThread(bdlf::BindUtil::bind(&addToCatalog,
+                                                           &mX,
+                                                           10,
+                                                           &threadHandles[t]));
+                }
+                threads.joinAll();
+
+                bsl::set<int> shards;
+                for (int t = 0; t < k_NUM_THREADS; ++t) {
+                    for (int i = 0; i < 10; ++i) {
+                        const int h = threadHandles[t][i];
+
+                        // All objects added by a thread use the same shard.
+
+                        ASSERTV(t, i, ((h ^ threadHandles[t][0])
+                                                     & (numShards - 1)) == 0);
+
+                        int value;
+                        ASSERTV(t, i, 0 == X.find(h, &value));
+                        ASSERTV(t, i, i == value);
+                    }
+                    shards.insert(threadHandles[t][0] & (numShards - 1));
+                }
+                if (veryVerbose) { T_ T_ P(shards.size()) }
+
+                ASSERTV(numShards, shards.size(), 1 < shards.size());
+                ASSERT(k_NUM_THREADS * 10 == X.length());
+                X.verifyState();
+            }
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add, find, replace, and remove a few objects.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta(veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            const int h1 = mX.add(1);
+            const int h2 = mX.add(2);
+
+            ASSERT(h1 != h2);
+            ASSERT(2  == X.length());
+
+            int value;
+            ASSERT(0 == X.find(h1, &value));  ASSERT(1 == value);
+            ASSERT(0 == X.find(h2, &value));  ASSERT(2 == value);
+
+            ASSERT(0 == mX.replace(h1, 3));
+            ASSERT(0 == X.find(h1, &value));  ASSERT(3 == value);
+
+            ASSERT(0 == mX.remove(h1, &value));  ASSERT(3 == value);
+            ASSERT(0 != X.find(h1));
+            ASSERT(1 == X.length());
+
+            const int h3 = mX.add(4);
+            ASSERT(h3 != h1);
+            ASSERT(0 == X.find(h3, &value));  ASSERT(4 == value);
+            ASSERT(2 == X.length());
+
+            X.verifyState();
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'ShardedObjectCatalog' vs. 'ObjectCatalog'
+        //
+        // Concerns:
+        //: 1 'find' on a 'ShardedObjectCatalog' scales better with the number
+        //:   of readers than on an 'ObjectCatalog', when another thread
+        //:   modifies the catalog.
+        //
+        // Plan:
+        //: 1 For an increasing number of reader threads, measure the
+        //:   throughput of 'find' operations on each type of catalog, while a
+        //:   writer thread continuously adds and removes objects.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'ShardedObjectCatalog' vs. 'ObjectCatalog'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        const int NUM_LOOKUPS = argc > 2 ? atoi(argv[2]) : 1000000;
+
+        cout << "Millions of 'find' per second (" << NUM_LOOKUPS
+             << " lookups per reader)" << endl
+             << "readers\tObjectCatalog\tShardedObjectCatalog" << endl;
+
+        for (int numReaders = 1; numReaders <= 16; numReaders *= 2) {
+            const double total = static_cast<double>(numReaders)
+                                                          * NUM_LOOKUPS / 1e6;
+
+            bdlcc::ObjectCatalog<int> catalog;
+            const double catalogTime = runBenchmark(&catalog,
+                                                    numReaders,
+                                                    NUM_LOOKUPS);
+
+            Obj shardedCatalog;
+            const double shardedTime = runBenchmark(&shardedCatalog,
+                                                    numReaders,
+                                                    NUM_LOOKUPS);
+
+            cout << numReaders
+                 << "\t" << total / catalogTime
+                 << "\t\t" << total / shardedTime << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
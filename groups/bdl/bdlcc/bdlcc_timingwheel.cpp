@@ -0,0 +1,407 @@
+// bdlcc_timingwheel.cpp                                              -*-C++-*-
+#include <bdlcc_timingwheel.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlcc_timingwheel_cpp,"$Id$ $CSID$")
+
+#include <bdlb_bitutil.h>
+
+///Implementation Note
+///-------------------
+// The wheel maintains the following invariants, where 'cur' is the current
+// tick, and the "digit" 'd(t, l)' of a tick 't' at level 'l' is
+// '(t >> (6 * l)) & 63':
+//
+//: o A node whose tick 't' is less than 'cur' is held in the late list.
+//:
+//: o Otherwise, a node is held in slot 'd(t, l)' of level 'l', where 'l' is
+//:   the index of the most significant digit in which 't' differs from 'cur'
+//:   (0 if 't == cur').  Hence the digit of 'cur' at level 'l' is less than
+//:   (or, for level 0, less than or equal to) the index of any non-empty slot
+//:   of level 'l', and the ticks of the nodes held at level 'l' are lower than
+//:   the ticks of the nodes held at any higher level.
+//
+// 'advance' processes the level-0 slots of the current period of 64 ticks,
+// then moves 'cur' directly to the first tick of the next non-empty slot of
+// the higher levels (the ticks in between having no node), where 'cascade'
+// redistributes the nodes of the slots starting at 'cur' to restore the
+// invariants.  Ticks are limited to 48 bits (about 8900 years after the
+// epoch), so that 8 levels of 6 bits cover all ticks.
+
+namespace BloombergLP {
+namespace bdlcc {
+
+namespace {
+
+typedef bsls::Types::Uint64 Uint64;
+
+const Uint64 k_SLOT_MASK = TimingWheel_Imp::k_NUM_SLOTS - 1;
+
+const Uint64 k_MAX_TICK  = (static_cast<Uint64>(1) << 48) - 2;
+    // highest tick, such that the current tick (at most 'k_MAX_TICK + 1')
+    // fits in 48 bits
+
+int highestSetBit(Uint64 value)
+    // Return the index of the most significant set bit of the specified
+    // 'value'.  The behavior is undefined unless '0 != value'.
+{
+    return 63 - bdlb::BitUtil::numLeadingUnsetBits(
+                                  static_cast<bdlb::BitUtil::uint64_t>(value));
+}
+
+int lowestSetBit(Uint64 value)
+    // Return the index of the least significant set bit of the specified
+    // 'value'.  The behavior is undefined unless '0 != value'.
+{
+    return bdlb::BitUtil::numTrailingUnsetBits(
+                                  static_cast<bdlb::BitUtil::uint64_t>(value));
+}
+
+bool isLess(const TimingWheel_Node *lhs, const TimingWheel_Node *rhs)
+    // Return 'true' if the specified 'lhs' node is to be returned before the
+    // specified 'rhs' node, and 'false' otherwise.
+{
+    return lhs->d_time < rhs->d_time
+        || (lhs->d_time == rhs->d_time && lhs->d_sequence < rhs->d_sequence);
+}
+
+Uint64 slotMask(int first, int last)
+    // Return a mask having the bits from the specified 'first' to the
+    // specified 'last' (inclusive) set.
+{
+    return (~static_cast<Uint64>(0) << first)
+         & (~static_cast<Uint64>(0) >> (63 - last));
+}
+
+bsls::TimeInterval toTime(Uint64 tick)
+    // Return the time value of the start of the specified 'tick'.
+{
+    return bsls::TimeInterval(static_cast<bsls::Types::Int64>(tick / 1000),
+                              static_cast<int>(tick % 1000) * 1000 * 1000);
+}
+
+}  // close unnamed namespace
+
+                          // ---------------------
+                          // class TimingWheel_Imp
+                          // ---------------------
+
+// PRIVATE CLASS METHODS
+Uint64 TimingWheel_Imp::toTick(const bsls::TimeInterval& time)
+{
+    if (time.seconds() < 0 || time.nanoseconds() < 0) {
+        return 0;                                                     // RETURN
+    }
+    if (static_cast<Uint64>(time.seconds()) >= k_MAX_TICK / 1000) {
+        return k_MAX_TICK;                                            // RETURN
+    }
+    return static_cast<Uint64>(time.seconds()) * 1000
+         + time.nanoseconds() / (1000 * 1000);
+}
+
+// PRIVATE MANIPULATORS
+void TimingWheel_Imp::advance(Uint64 lastTick, NodeVector *expired)
+{
+    BSLS_ASSERT(d_currentTick <= lastTick);
+
+    while (d_currentTick <= lastTick) {
+        const Uint64 periodEnd = d_currentTick | k_SLOT_MASK;
+        const Uint64 last      = bsl::min(periodEnd, lastTick);
+
+        Uint64 slots = d_occupied[0]
+                     & slotMask(static_cast<int>(d_currentTick & k_SLOT_MASK),
+                                static_cast<int>(last & k_SLOT_MASK));
+        while (slots) {
+            const int slot = lowestSetBit(slots);
+            slots &= slots - 1;
+
+            for (TimingWheel_Node *node = detachList(slot); node; ) {
+                TimingWheel_Node *next = node->d_next_p;
+                expired->push_back(node);
+                node = next;
+            }
+        }
+
+        if (last < periodEnd) {
+            d_currentTick = last + 1;
+            return;                                                   // RETURN
+        }
+
+        d_currentTick = nextBoundary(periodEnd + 1, lastTick + 1);
+        cascade();
+    }
+}
+
+void TimingWheel_Imp::cascade()
+{
+    for (int level = k_NUM_LEVELS - 1; 0 < level; --level) {
+        const int shift = level * k_BITS_PER_LEVEL;
+
+        if (d_currentTick & ((static_cast<Uint64>(1) << shift) - 1)) {
+            continue;
+        }
+
+        const int list = level * k_NUM_SLOTS
+                       + static_cast<int>((d_currentTick >> shift)
+                                                                & k_SLOT_MASK);
+        for (TimingWheel_Node *node = detachList(list); node; ) {
+            TimingWheel_Node *next = node->d_next_p;
+            place(node);
+            node = next;
+        }
+    }
+}
+
+void TimingWheel_Imp::detach(TimingWheel_Node *node)
+{
+    TimingWheel_Node *&first = d_lists[node->d_list];
+
+    if (node->d_next_p == node) {
+        first = 0;
+        if (k_LATE_LIST != node->d_list) {
+            d_occupied[node->d_list / k_NUM_SLOTS] &=
+                   ~(static_cast<Uint64>(1) << (node->d_list % k_NUM_SLOTS));
+        }
+    }
+    else {
+        node->d_prev_p->d_next_p = node->d_next_p;
+        node->d_next_p->d_prev_p = node->d_prev_p;
+        if (first == node) {
+            first = node->d_next_p;
+        }
+    }
+    node->d_list = -1;
+}
+
+TimingWheel_Node *TimingWheel_Imp::detachList(int list)
+{
+    TimingWheel_Node *first = d_lists[list];
+    if (!first) {
+        return 0;                                                     // RETURN
+    }
+
+    d_lists[list] = 0;
+    if (k_LATE_LIST != list) {
+        d_occupied[list / k_NUM_SLOTS] &=
+                            ~(static_cast<Uint64>(1) << (list % k_NUM_SLOTS));
+    }
+
+    first->d_prev_p->d_next_p = 0;
+    for (TimingWheel_Node *node = first; node; node = node->d_next_p) {
+        node->d_list = -1;
+    }
+    return first;
+}
+
+void TimingWheel_Imp::expire(int                       list,
+                             const bsls::TimeInterval& time,
+                             NodeVector               *expired)
+{
+    TimingWheel_Node *node = d_lists[list];
+    if (!node) {
+        return;                                                       // RETURN
+    }
+
+    TimingWheel_Node *const last = node->d_prev_p;
+    while (true) {
+        TimingWheel_Node *next = node->d_next_p;
+        const bool        done = node == last;
+
+        if (node->d_time <= time) {
+            detach(node);
+            expired->push_back(node);
+        }
+        if (done) {
+            break;
+        }
+        node = next;
+    }
+}
+
+void TimingWheel_Imp::place(TimingWheel_Node *node)
+{
+    const Uint64 tick = toTick(node->d_time);
+
+    if (tick < d_currentTick) {
+        pushBack(k_LATE_LIST, node);
+        return;                                                       // RETURN
+    }
+
+    const Uint64 diff  = tick ^ d_currentTick;
+    const int    level = diff ? highestSetBit(diff) / k_BITS_PER_LEVEL : 0;
+
+    pushBack(level * k_NUM_SLOTS
+                 + static_cast<int>((tick >> (level * k_BITS_PER_LEVEL))
+                                                                & k_SLOT_MASK),
+             node);
+}
+
+void TimingWheel_Imp::pushBack(int list, TimingWheel_Node *node)
+{
+    TimingWheel_Node *&first = d_lists[list];
+
+    node->d_list = list;
+    if (first) {
+        node->d_prev_p = first->d_prev_p;
+        node->d_next_p = first;
+        first->d_prev_p->d_next_p = node;
+        first->d_prev_p = node;
+    }
+    else {
+        node->d_prev_p = node;
+        node->d_next_p = node;
+        first = node;
+        if (k_LATE_LIST != list) {
+            d_occupied[list / k_NUM_SLOTS] |=
+                                static_cast<Uint64>(1) << (list % k_NUM_SLOTS);
+        }
+    }
+}
+
+// PRIVATE ACCESSORS
+Uint64 TimingWheel_Imp::nextBoundary(Uint64 tick, Uint64 limit) const
+{
+    BSLS_ASSERT(0 == d_occupied[0]);
+
+    Uint64 result = limit;
+    for (int level = 1; level < k_NUM_LEVELS; ++level) {
+        const int    shift = level * k_BITS_PER_LEVEL;
+        const int    digit = static_cast<int>((tick >> shift) & k_SLOT_MASK);
+        const Uint64 slots = d_occupied[level] & slotMask(digit, 63);
+
+        if (slots) {
+            const Uint64 slot  = lowestSetBit(slots);
+            const Uint64 start = (tick >> (shift + k_BITS_PER_LEVEL)
+                                       << (shift + k_BITS_PER_LEVEL))
+                               | (slot << shift);
+            result = bsl::min(result, start);
+        }
+    }
+
+    BSLS_ASSERT(tick <= result);
+    return result;
+}
+
+// CREATORS
+TimingWheel_Imp::TimingWheel_Imp()
+: d_currentTick(0)
+, d_nextSequence(0)
+, d_numNodes(0)
+{
+    bsl::fill(d_lists, d_lists + k_NUM_LISTS,
+              static_cast<TimingWheel_Node *>(0));
+    bsl::fill(d_occupied, d_occupied + k_NUM_LEVELS, static_cast<Uint64>(0));
+}
+
+// MANIPULATORS
+void TimingWheel_Imp::insert(TimingWheel_Node *node)
+{
+    node->d_sequence = d_nextSequence++;
+    place(node);
+    ++d_numNodes;
+}
+
+void TimingWheel_Imp::popLE(const bsls::TimeInterval& time,
+                            NodeVector               *expired)
+{
+    const bsl::size_t numExpired = expired->size();
+    const Uint64      tick       = toTick(time);
+
+    if (d_currentTick < tick) {
+        // All the nodes whose tick is less than 'tick' are expired.
+
+        if (d_numNodes) {
+            advance(tick - 1, expired);
+        }
+        else {
+            d_currentTick = tick;
+        }
+    }
+
+    if (d_lists[k_LATE_LIST]) {
+        expire(k_LATE_LIST, time, expired);
+    }
+    if (tick == d_currentTick && d_lists[tick & k_SLOT_MASK]) {
+        expire(static_cast<int>(tick & k_SLOT_MASK), time, expired);
+    }
+
+    d_numNodes -= static_cast<int>(expired->size() - numExpired);
+
+    bsl::sort(expired->begin() + numExpired, expired->end(), &isLess);
+}
+
+void TimingWheel_Imp::remove(TimingWheel_Node *node)
+{
+    BSLS_ASSERT(-1 != node->d_list);
+
+    detach(node);
+    --d_numNodes;
+}
+
+void TimingWheel_Imp::removeAll(NodeVector *removed)
+{
+    const bsl::size_t numRemoved = removed->size();
+
+    for (int list = 0; list < k_NUM_LISTS; ++list) {
+        for (TimingWheel_Node *node = detachList(list); node; ) {
+            TimingWheel_Node *next = node->d_next_p;
+            removed->push_back(node);
+            node = next;
+        }
+    }
+    d_numNodes = 0;
+
+    bsl::sort(removed->begin() + numRemoved, removed->end(), &isLess);
+}
+
+// ACCESSORS
+int TimingWheel_Imp::minTime(bsls::TimeInterval *result) const
+{
+    if (!d_numNodes) {
+        return 1;                                                     // RETURN
+    }
+
+    // The late list, if not empty, holds the lowest time value; otherwise the
+    // first non-empty slot of level 0, if any, does.
+
+    const TimingWheel_Node *first = d_lists[k_LATE_LIST];
+    if (!first && d_occupied[0]) {
+        first = d_lists[lowestSetBit(d_occupied[0])];
+    }
+
+    if (first) {
+        const TimingWheel_Node *node = first;
+        *result = node->d_time;
+        while ((node = node->d_next_p) != first) {
+            if (node->d_time < *result) {
+                *result = node->d_time;
+            }
+        }
+        return 0;                                                     // RETURN
+    }
+
+    // Otherwise, the start of the first non-empty slot of the higher levels
+    // is a lower bound.
+
+    *result = toTime(nextBoundary(d_currentTick, k_MAX_TICK + 1));
+    return 0;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
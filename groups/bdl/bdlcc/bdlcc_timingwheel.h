@@ -0,0 +1,854 @@
+// bdlcc_timingwheel.h                                                -*-C++-*-
+#ifndef INCLUDED_BDLCC_TIMINGWHEEL
+#define INCLUDED_BDLCC_TIMINGWHEEL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a thread-safe hierarchical timing wheel of timed items.
+//
+//@CLASSES:
+//  bdlcc::TimingWheel: hierarchical timing wheel of timed items
+//
+//@SEE_ALSO: bdlcc_timequeue
+//
+//@DESCRIPTION: This component defines a class template, 'bdlcc::TimingWheel',
+// that stores items of a parameterized 'DATA' type, each associated with a
+// 'bsls::TimeInterval' value, and that provides the subset of the interface of
+// 'bdlcc::TimeQueue' used to implement timers: 'add' stores an item and
+// returns a handle that can later be passed to 'update' and 'remove', and
+// 'popLE' removes (and optionally returns) all items whose time value is less
+// than or equal to a specified time, ordered by their time values.  The
+// removed items are returned as 'bdlcc::TimeQueueItem' objects, so that
+// 'bdlcc::TimingWheel' can be substituted for 'bdlcc::TimeQueue' in code
+// using only this subset.
+//
+// 'bdlcc::TimeQueue' keeps its items in a 'bsl::map' indexed by time value, so
+// that adding, updating and removing an item (e.g., arming, re-arming and
+// cancelling a timeout) take logarithmic time, and allocate or free a map
+// node.  'bdlcc::TimingWheel' is intended for holding a large number of such
+// timers, and differs in the following respects:
+//
+//: o 'add', 'update', and 'remove' take constant time: items are held in
+//:   intrusive doubly-linked lists (one per slot of the wheel, see
+//:   {Implementation Overview}), and the node holding an item is located
+//:   directly from the handle of the item.
+//:
+//: o No memory is allocated or freed when an item is updated or removed, and
+//:   (once the wheel has grown to its peak number of items) when an item is
+//:   added: the nodes of removed items are kept on a free list and reused.
+//:
+//: o 'minTime' loads a *lower* *bound* of the lowest time value held by the
+//:   wheel rather than the exact value when the item having the lowest time
+//:   value is due more than 64 milliseconds after the last call to 'popLE'
+//:   (see {Implementation Overview}).  A client waiting until the time loaded
+//:   by 'minTime' before calling 'popLE' may therefore wake up (at most once
+//:   per level of the wheel) without any item being due.
+//
+// Items having the same time value are returned by 'popLE' in the order in
+// which they were added (or last updated), as for 'bdlcc::TimeQueue'.
+//
+///Handles
+///-------
+// Handles are 'int' values having the same structure as
+// 'bdlcc::TimeQueue::Handle': the low-order 'numIndexBits' bits (17 by
+// default) identify the node holding the item, and the remaining bits hold an
+// iteration count incremented each time the node is freed, so that a stale
+// handle is rejected unless its node has been reused a multiple of
+// '2 ** (32 - numIndexBits) - 1' times.  Up to '2 ** numIndexBits - 2' items
+// can be held at the same time; 'add' returns -1 if this limit is reached.
+// The behavior is undefined unless '8 <= numIndexBits <= 24'.
+//
+///Implementation Overview
+///-----------------------
+// Time values are converted to a number of milliseconds since the epoch (the
+// time value 0), called a "tick".  The wheel consists of 8 levels, each having
+// 64 slots (i.e., 6 bits of a tick), and holds a "current tick", the tick of
+// the last (or next) call to 'popLE'.  An item is stored in the slot, at the
+// level of the most significant 6-bit digit in which its tick differs from the
+// current tick, indexed by the value of that digit in the tick of the item.
+// Hence level 0 holds the items due within the same (64-millisecond) period
+// as the current tick, level 1 the items due within the same 4096-millisecond
+// period, and so on.  When the current tick reaches the first tick of the
+// period covered by a slot at a level above 0, the items of that slot are
+// redistributed to lower levels, so that each item is moved at most 7 times.
+// A bit mask of non-empty slots is maintained for each level, so that 'popLE'
+// skips over empty slots, and 'minTime' finds the first non-empty slot of
+// each level, in constant time.
+//
+///Thread Safety
+///-------------
+// 'bdlcc::TimingWheel' is fully thread-safe: all of its methods can be called
+// concurrently on the same object.  As for 'bdlcc::TimeQueue', the 'DATA' of
+// removed items is destroyed after releasing the internal lock, so that it is
+// safe to add items whose destructor accesses the same wheel.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Connection Timeouts
+/// - - - - - - - - - - - - - - -
+// Suppose that a server closes the connections that have been idle for a
+// given time.  Each connection arms a timer when it is opened, and re-arms it
+// each time data is received.
+//
+// First, we create a wheel whose items identify a connection:
+//..
+//  bdlcc::TimingWheel<int> timers;
+//
+//  const bsls::TimeInterval IDLE_TIMEOUT(30);
+//  bsls::TimeInterval       now(1000);
+//..
+// Then, we arm the timers of two connections:
+//..
+//  bdlcc::TimingWheel<int>::Handle h1 = timers.add(now + IDLE_TIMEOUT, 1);
+//  bdlcc::TimingWheel<int>::Handle h2 = timers.add(now + IDLE_TIMEOUT, 2);
+//  assert(2 == timers.length());
+//..
+// Next, 10 seconds later, data is received on the first connection, and we
+// re-arm its timer:
+//..
+//  now += bsls::TimeInterval(10);
+//  int rc = timers.update(h1, now + IDLE_TIMEOUT);
+//  assert(0 == rc);
+//..
+// Then, 25 seconds later, we retrieve the connections that have timed out:
+//..
+//  now += bsls::TimeInterval(25);
+//
+//  bsl::vector<bdlcc::TimeQueueItem<int> > expired;
+//  timers.popLE(now, &expired);
+//
+//  assert(1 == expired.size());
+//  assert(2 == expired[0].data());
+//  assert(h2 == expired[0].handle());
+//..
+// Finally, the first connection is closed by its peer, and we cancel its
+// timer:
+//..
+//  rc = timers.remove(h1);
+//  assert(0 == rc);
+//  assert(0 == timers.length());
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLCC_TIMEQUEUE
+#include <bdlcc_timequeue.h>
+#endif
+
+#ifndef INCLUDED_BSLALG_SCALARPRIMITIVES
+#include <bslalg_scalarprimitives.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_DEFAULT
+#include <bslma_default.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_LOCKGUARD
+#include <bslmt_lockguard.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_OBJECTBUFFER
+#include <bsls_objectbuffer.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_ALGORITHM
+#include <bsl_algorithm.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlcc {
+
+                          // =======================
+                          // struct TimingWheel_Node
+                          // =======================
+
+struct TimingWheel_Node {
+    // [!PRIVATE!] This 'struct' provides the part of a node of a
+    // 'TimingWheel' that is independent of the type of the items held by the
+    // wheel.
+
+    // PUBLIC DATA
+    TimingWheel_Node    *d_prev_p;    // previous node in the list
+    TimingWheel_Node    *d_next_p;    // next node in the list (or in the free
+                                      // list)
+
+    bsls::TimeInterval   d_time;      // time value of the item
+
+    bsls::Types::Uint64  d_sequence;  // order in which the item was added
+
+    int                  d_list;      // index of the list holding this node,
+                                      // or -1 if this node is not held
+};
+
+                          // =====================
+                          // class TimingWheel_Imp
+                          // =====================
+
+class TimingWheel_Imp {
+    // [!PRIVATE!] This class implements the wheel of intrusive node lists of a
+    // 'TimingWheel'.  This class is *not* thread-safe.
+
+  public:
+    // TYPES
+    typedef bsl::vector<TimingWheel_Node *> NodeVector;
+
+    enum {
+        k_BITS_PER_LEVEL = 6,
+        k_NUM_SLOTS      = 1 << k_BITS_PER_LEVEL,   // slots per level
+        k_NUM_LEVELS     = 8,
+        k_LATE_LIST      = k_NUM_LEVELS * k_NUM_SLOTS,
+                                           // list of the nodes whose tick is
+                                           // before the current tick
+        k_NUM_LISTS      = k_LATE_LIST + 1
+    };
+
+  private:
+    // DATA
+    TimingWheel_Node    *d_lists[k_NUM_LISTS];     // first node of each list
+
+    bsls::Types::Uint64  d_occupied[k_NUM_LEVELS]; // bit mask of the non-empty
+                                                   // slots of each level
+
+    bsls::Types::Uint64  d_currentTick;            // first tick not yet
+                                                   // processed by 'popLE'
+
+    bsls::Types::Uint64  d_nextSequence;           // sequence number of the
+                                                   // next inserted node
+
+    int                  d_numNodes;               // number of held nodes
+
+    // PRIVATE CLASS METHODS
+    static bsls::Types::Uint64 toTick(const bsls::TimeInterval& time);
+        // Return the tick of the specified 'time'.
+
+    // PRIVATE MANIPULATORS
+    void advance(bsls::Types::Uint64 lastTick, NodeVector *expired);
+        // Move the current tick of this wheel to the specified 'lastTick'
+        // plus one, appending to the specified 'expired' the nodes whose tick
+        // is less than or equal to 'lastTick'.  The behavior is undefined
+        // unless the current tick is less than or equal to 'lastTick'.
+
+    void cascade();
+        // Redistribute the nodes of the slots whose period starts at the
+        // current tick to the lower levels of this wheel.
+
+    void detach(TimingWheel_Node *node);
+        // Remove the specified 'node' from the list holding it.
+
+    TimingWheel_Node *detachList(int list);
+        // Empty the specified 'list', and return its first node (the nodes of
+        // the list are linked by their 'd_next_p' member, and the last node
+        // is linked to 0).
+
+    void expire(int                       list,
+                const bsls::TimeInterval& time,
+                NodeVector               *expired);
+        // Remove from the specified 'list' the nodes whose time is less than
+        // or equal to the specified 'time', and append them to the specified
+        // 'expired'.
+
+    void place(TimingWheel_Node *node);
+        // Append the specified 'node' to the list corresponding to its time
+        // value.
+
+    void pushBack(int list, TimingWheel_Node *node);
+        // Append the specified 'node' to the specified 'list'.
+
+    // PRIVATE ACCESSORS
+    bsls::Types::Uint64 nextBoundary(bsls::Types::Uint64 tick,
+                                     bsls::Types::Uint64 limit) const;
+        // Return the first tick, greater than or equal to the specified
+        // 'tick' and less than the specified 'limit', starting the period of
+        // a non-empty slot at a level above 0, or 'limit' if there is no such
+        // tick.  The behavior is undefined unless level 0 is empty.
+
+  private:
+    // NOT IMPLEMENTED
+    TimingWheel_Imp(const TimingWheel_Imp&);
+    TimingWheel_Imp& operator=(const TimingWheel_Imp&);
+
+  public:
+    // CREATORS
+    TimingWheel_Imp();
+        // Create an empty wheel.
+
+    // MANIPULATORS
+    void insert(TimingWheel_Node *node);
+        // Insert the specified 'node' in this wheel, according to its
+        // 'd_time' value.
+
+    void popLE(const bsls::TimeInterval& time, NodeVector *expired);
+        // Remove the nodes having a time value less than or equal to the
+        // specified 'time' from this wheel, and append them to the specified
+        // 'expired', ordered by time value and, for equal time values, by
+        // order of insertion.
+
+    void remove(TimingWheel_Node *node);
+        // Remove the specified 'node' from this wheel.  The behavior is
+        // undefined unless 'node' is held by this wheel.
+
+    void removeAll(NodeVector *removed);
+        // Remove all the nodes from this wheel, and append them to the
+        // specified 'removed', ordered as for 'popLE'.
+
+    // ACCESSORS
+    int minTime(bsls::TimeInterval *result) const;
+        // Load into the specified 'result' a lower bound of the lowest time
+        // value of the nodes held by this wheel (see {Implementation
+        // Overview}).  Return 0 on success, and a non-zero value (with no
+        // effect on 'result') if this wheel is empty.
+
+    int numNodes() const;
+        // Return the number of nodes held by this wheel.
+};
+
+                             // =================
+                             // class TimingWheel
+                             // =================
+
+template <class DATA>
+class TimingWheel {
+    // This class template provides a thread-safe hierarchical timing wheel of
+    // items of the parameterized 'DATA' type, each associated with a time
+    // value, having the interface of 'TimeQueue' used to implement timers.
+    // See the component-level documentation for details.
+
+    // PRIVATE TYPES
+    enum {
+        k_NUM_INDEX_BITS_MIN     = 8,
+        k_NUM_INDEX_BITS_MAX     = 24,
+        k_NUM_INDEX_BITS_DEFAULT = 17
+    };
+
+    struct Node : TimingWheel_Node {
+        // This 'struct' provides the node holding an item.
+
+        // DATA
+        int                      d_index;  // handle of the item held by
+                                           // this node
+        bsls::ObjectBuffer<DATA> d_data;   // item held by this node
+    };
+
+  public:
+    // TYPES
+    typedef int Handle;
+        // 'Handle' defines an alias for uniquely identifying an item in the
+        // wheel (see {Handles}).
+
+  private:
+    // DATA
+    const int                    d_indexMask;
+    const int                    d_indexIterationMask;
+    const int                    d_indexIterationInc;
+
+    mutable bslmt::Mutex         d_mutex;          // serializes access to the
+                                                   // members below
+
+    TimingWheel_Imp              d_wheel;          // lists of held nodes
+
+    bsl::vector<Node *>          d_nodeArray;      // all the nodes, indexed
+                                                   // by handle index minus 1
+
+    bsls::AtomicPointer<Node>    d_nextFreeNode_p; // first free node (the
+                                                   // free list is linked by
+                                                   // 'd_next_p')
+
+    TimingWheel_Imp::NodeVector  d_expired;        // nodes removed by the
+                                                   // current 'popLE' or
+                                                   // 'removeAll'
+
+    bsls::AtomicInt              d_length;         // number of held items
+
+    bslma::Allocator            *d_allocator_p;    // memory allocator (held,
+                                                   // not owned)
+
+    // PRIVATE MANIPULATORS
+    void freeNode(Node *node);
+        // Increment the iteration count of the handle of the specified
+        // 'node', so that the handle of the removed item is no longer valid.
+
+    void putFreeNodes(Node *first);
+        // Destroy the item held by each node of the list starting with the
+        // specified 'first' node and linked by 'd_next_p', and prepend these
+        // nodes to the free list.  Note that this method must be called
+        // without holding 'd_mutex'.
+
+    Node *removeExpired(bsl::vector<TimeQueueItem<DATA> > *buffer);
+        // Free the nodes in 'd_expired', append a copy of the items they hold
+        // to the specified 'buffer' (if not 0), clear 'd_expired', and return
+        // the first node of the list of these nodes linked by 'd_next_p'.
+
+    // PRIVATE ACCESSORS
+    Node *lookup(Handle handle) const;
+        // Return the node holding the item having the specified 'handle', or
+        // 0 if there is no such item.
+
+  private:
+    // NOT IMPLEMENTED
+    TimingWheel(const TimingWheel&);
+    TimingWheel& operator=(const TimingWheel&);
+
+  public:
+    // CREATORS
+    explicit TimingWheel(bslma::Allocator *basicAllocator = 0);
+    explicit TimingWheel(int               numIndexBits,
+                         bslma::Allocator *basicAllocator = 0);
+        // Create an empty timing wheel.  Optionally specify 'numIndexBits' to
+        // configure the number of index bits of the handles of this wheel (see
+        // {Handles}).  If 'numIndexBits' is not specified, 17 is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '8 <= numIndexBits <= 24'.
+
+    ~TimingWheel();
+        // Destroy this timing wheel.
+
+    // MANIPULATORS
+    Handle add(const bsls::TimeInterval&  time,
+               const DATA&                data,
+               int                       *isNewTop = 0,
+               int                       *newLength = 0);
+        // Add to this wheel an item having the specified 'time' value and
+        // 'data'.  Optionally specify 'isNewTop' to load a non-zero value if
+        // 'time' is lower than the time value loaded by 'minTime' before
+        // this call (or if this wheel was empty), and 0 otherwise.  Optionally
+        // specify 'newLength' to load the number of items in this wheel after
+        // this call.  Return the handle of the added item, or -1 if the
+        // maximum number of items has been reached.
+
+    void popLE(const bsls::TimeInterval&          time,
+               bsl::vector<TimeQueueItem<DATA> > *buffer = 0,
+               int                               *newLength = 0,
+               bsls::TimeInterval                *newMinTime = 0);
+        // Remove from this wheel all the items having a time value less than
+        // or equal to the specified 'time', and optionally append to the
+        // specified 'buffer' a copy of the removed items, ordered by time
+        // value and, for equal time values, by order of addition.  Optionally
+        // specify 'newLength' to load the number of items remaining in this
+        // wheel, and 'newMinTime' to load the value that 'minTime' would load
+        // after this call (if any items remain).
+
+    int remove(Handle               handle,
+               int                 *newLength = 0,
+               bsls::TimeInterval  *newMinTime = 0,
+               TimeQueueItem<DATA> *item = 0);
+        // Remove from this wheel the item having the specified 'handle'.
+        // Optionally specify 'newLength' to load the number of items remaining
+        // in this wheel, 'newMinTime' to load the value that 'minTime' would
+        // load after this call (if any items remain), and 'item' to load a
+        // copy of the removed item.  Return 0 on success, and a non-zero value
+        // (with no effect) if there is no item having 'handle' in this wheel.
+
+    void removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer = 0);
+        // Remove all the items from this wheel, and optionally append to the
+        // specified 'buffer' a copy of the removed items, ordered as for
+        // 'popLE'.
+
+    int update(Handle                     handle,
+               const bsls::TimeInterval&  newTime,
+               int                       *isNewTop = 0);
+        // Set the time value of the item having the specified 'handle' to the
+        // specified 'newTime'.  Optionally specify 'isNewTop' to load a
+        // non-zero value if 'newTime' is lower than the time value that
+        // 'minTime' would load for the other items of this wheel (or if there
+        // is no other item), and 0 otherwise.  Return 0 on success, and a
+        // non-zero value (with no effect) if there is no item having 'handle'
+        // in this wheel.
+
+    // ACCESSORS
+    bool isRegisteredHandle(Handle handle) const;
+        // Return 'true' if an item having the specified 'handle' is held by
+        // this wheel, and 'false' otherwise.
+
+    int length() const;
+        // Return a snapshot of the number of items held by this wheel.
+
+    int minTime(bsls::TimeInterval *buffer) const;
+        // Load into the specified 'buffer' the lowest time value of the items
+        // held by this wheel, or a lower bound of that value (see
+        // {Implementation Overview}).  Return 0 on success, and a non-zero
+        // value (with no effect on 'buffer') if this wheel is empty.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                          // ---------------------
+                          // class TimingWheel_Imp
+                          // ---------------------
+
+// ACCESSORS
+inline
+int TimingWheel_Imp::numNodes() const
+{
+    return d_numNodes;
+}
+
+                             // -----------------
+                             // class TimingWheel
+                             // -----------------
+
+// PRIVATE MANIPULATORS
+template <class DATA>
+inline
+void TimingWheel<DATA>::freeNode(Node *node)
+{
+    node->d_index = ((node->d_index + d_indexIterationInc) &
+                         d_indexIterationMask) | (node->d_index & d_indexMask);
+
+    if (!(node->d_index & d_indexIterationMask)) {
+        node->d_index += d_indexIterationInc;
+    }
+}
+
+template <class DATA>
+void TimingWheel<DATA>::putFreeNodes(Node *first)
+{
+    if (!first) {
+        return;                                                       // RETURN
+    }
+
+    Node *last = first;
+    while (true) {
+        last->d_data.object().~DATA();
+        if (!last->d_next_p) {
+            break;
+        }
+        last = static_cast<Node *>(last->d_next_p);
+    }
+
+    Node *nextFreeNode = d_nextFreeNode_p;
+    last->d_next_p = nextFreeNode;
+    while (nextFreeNode != d_nextFreeNode_p.testAndSwap(nextFreeNode, first)) {
+        nextFreeNode   = d_nextFreeNode_p;
+        last->d_next_p = nextFreeNode;
+    }
+}
+
+template <class DATA>
+typename TimingWheel<DATA>::Node *TimingWheel<DATA>::removeExpired(
+                                    bsl::vector<TimeQueueItem<DATA> > *buffer)
+{
+    Node *first = 0;
+
+    // Link the nodes in reverse order, so that the first node of the list is
+    // the first expired node.
+
+    for (bsl::size_t i = d_expired.size(); 0 < i--; ) {
+        Node *node = static_cast<Node *>(d_expired[i]);
+
+        if (buffer) {
+            buffer->push_back(TimeQueueItem<DATA>(node->d_time,
+                                                  node->d_data.object(),
+                                                  node->d_index,
+                                                  d_allocator_p));
+        }
+        freeNode(node);
+        node->d_next_p = first;
+        first = node;
+    }
+
+    if (buffer) {
+        // The items were appended in reverse order.
+
+        bsl::reverse(buffer->end() - d_expired.size(), buffer->end());
+    }
+
+    d_length.addRelaxed(-static_cast<int>(d_expired.size()));
+    d_expired.clear();
+
+    return first;
+}
+
+// PRIVATE ACCESSORS
+template <class DATA>
+inline
+typename TimingWheel<DATA>::Node *TimingWheel<DATA>::lookup(
+                                                           Handle handle) const
+{
+    const int index = (handle & d_indexMask) - 1;
+    if (index < 0 || index >= static_cast<int>(d_nodeArray.size())) {
+        return 0;                                                     // RETURN
+    }
+
+    Node *node = d_nodeArray[index];
+    return node->d_index == handle && -1 != node->d_list ? node : 0;
+}
+
+// CREATORS
+template <class DATA>
+TimingWheel<DATA>::TimingWheel(bslma::Allocator *basicAllocator)
+: d_indexMask((1 << k_NUM_INDEX_BITS_DEFAULT) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_wheel()
+, d_nodeArray(basicAllocator)
+, d_nextFreeNode_p(0)
+, d_expired(basicAllocator)
+, d_length(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+}
+
+template <class DATA>
+TimingWheel<DATA>::TimingWheel(int               numIndexBits,
+                               bslma::Allocator *basicAllocator)
+: d_indexMask((1 << numIndexBits) - 1)
+, d_indexIterationMask(~d_indexMask)
+, d_indexIterationInc(d_indexMask + 1)
+, d_wheel()
+, d_nodeArray(basicAllocator)
+, d_nextFreeNode_p(0)
+, d_expired(basicAllocator)
+, d_length(0)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT(k_NUM_INDEX_BITS_MIN <= numIndexBits
+             && k_NUM_INDEX_BITS_MAX >= numIndexBits);
+}
+
+template <class DATA>
+TimingWheel<DATA>::~TimingWheel()
+{
+    removeAll();
+
+    for (bsl::size_t i = 0; i < d_nodeArray.size(); ++i) {
+        d_allocator_p->deleteObjectRaw(d_nodeArray[i]);
+    }
+}
+
+// MANIPULATORS
+template <class DATA>
+typename TimingWheel<DATA>::Handle TimingWheel<DATA>::add(
+                                          const bsls::TimeInterval&  time,
+                                          const DATA&                data,
+                                          int                       *isNewTop,
+                                          int                       *newLength)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Node *node = d_nextFreeNode_p;
+    if (node) {
+        // Nodes are only taken from the free list while holding 'd_mutex',
+        // but other threads may concurrently prepend nodes to it.
+
+        Node *next = static_cast<Node *>(node->d_next_p);
+        while (node != d_nextFreeNode_p.testAndSwap(node, next)) {
+            node = d_nextFreeNode_p;
+            next = static_cast<Node *>(node->d_next_p);
+        }
+    }
+    else {
+        if (static_cast<int>(d_nodeArray.size()) >= d_indexMask - 1) {
+            return -1;                                                // RETURN
+        }
+
+        node = new (*d_allocator_p) Node;
+        d_nodeArray.push_back(node);
+        node->d_index = static_cast<int>(d_nodeArray.size())
+                      | d_indexIterationInc;
+        node->d_list  = -1;
+    }
+
+    bslalg::ScalarPrimitives::copyConstruct(&node->d_data.object(),
+                                            data,
+                                            d_allocator_p);
+
+    if (isNewTop) {
+        bsls::TimeInterval top;
+        *isNewTop = 0 != d_wheel.minTime(&top) || time < top;
+    }
+
+    node->d_time = time;
+    d_wheel.insert(node);
+
+    const int length = d_length.addRelaxed(1);
+    if (newLength) {
+        *newLength = length;
+    }
+
+    return node->d_index;
+}
+
+template <class DATA>
+void TimingWheel<DATA>::popLE(const bsls::TimeInterval&          time,
+                              bsl::vector<TimeQueueItem<DATA> > *buffer,
+                              int                               *newLength,
+                              bsls::TimeInterval                *newMinTime)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_wheel.popLE(time, &d_expired);
+    Node *expired = removeExpired(buffer);
+
+    if (newLength) {
+        *newLength = d_length;
+    }
+    if (newMinTime) {
+        d_wheel.minTime(newMinTime);
+    }
+
+    guard.release()->unlock();
+
+    putFreeNodes(expired);
+}
+
+template <class DATA>
+int TimingWheel<DATA>::remove(Handle               handle,
+                              int                 *newLength,
+                              bsls::TimeInterval  *newMinTime,
+                              TimeQueueItem<DATA> *item)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Node *node = lookup(handle);
+    if (!node) {
+        return 1;                                                     // RETURN
+    }
+
+    if (item) {
+        item->time()   = node->d_time;
+        item->data()   = node->d_data.object();
+        item->handle() = node->d_index;
+    }
+
+    d_wheel.remove(node);
+    freeNode(node);
+    node->d_next_p = 0;
+
+    const int length = d_length.addRelaxed(-1);
+    if (newLength) {
+        *newLength = length;
+    }
+    if (newMinTime) {
+        d_wheel.minTime(newMinTime);
+    }
+
+    guard.release()->unlock();
+
+    putFreeNodes(node);
+    return 0;
+}
+
+template <class DATA>
+void TimingWheel<DATA>::removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    d_wheel.removeAll(&d_expired);
+    Node *removed = removeExpired(buffer);
+
+    guard.release()->unlock();
+
+    putFreeNodes(removed);
+}
+
+template <class DATA>
+int TimingWheel<DATA>::update(Handle                     handle,
+                              const bsls::TimeInterval&  newTime,
+                              int                       *isNewTop)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    Node *node = lookup(handle);
+    if (!node) {
+        return 1;                                                     // RETURN
+    }
+
+    d_wheel.remove(node);
+
+    if (isNewTop) {
+        bsls::TimeInterval top;
+        *isNewTop = 0 != d_wheel.minTime(&top) || newTime < top;
+    }
+
+    node->d_time = newTime;
+    d_wheel.insert(node);
+
+    return 0;
+}
+
+// ACCESSORS
+template <class DATA>
+inline
+bool TimingWheel<DATA>::isRegisteredHandle(Handle handle) const
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return 0 != lookup(handle);
+}
+
+template <class DATA>
+inline
+int TimingWheel<DATA>::length() const
+{
+    return d_length;
+}
+
+template <class DATA>
+inline
+int TimingWheel<DATA>::minTime(bsls::TimeInterval *buffer) const
+{
+    BSLS_ASSERT(buffer);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+    return d_wheel.minTime(buffer);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
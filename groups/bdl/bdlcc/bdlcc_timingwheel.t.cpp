@@ -0,0 +1,1178 @@
+// bdlcc_timingwheel.t.cpp                                            -*-C++-*-
+#include <bdlcc_timingwheel.h>
+
+#include <bdlcc_timequeue.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+#include <bslma_usesbslmaallocator.h>
+
+#include <bslmf_nestedtraitdeclaration.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_threadgroup.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bdlf_bind.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_string.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'bdlcc::TimingWheel' provides the timer subset of the interface of
+// 'bdlcc::TimeQueue', implemented with a hierarchical timing wheel.  We first
+// verify the primary manipulators ('add', 'popLE', and 'remove') and the basic
+// accessors, including the order of the items returned by 'popLE' and the
+// rejection of stale handles.  We then verify 'update', 'removeAll', the
+// values loaded into 'isNewTop', 'newLength', and 'newMinTime', and that
+// 'minTime' is a lower bound of the lowest time value.  The redistribution of
+// items between the levels of the wheel is verified by comparing the results
+// of random sequences of operations, over time spans from milliseconds to
+// centuries, with those of a 'bdlcc::TimeQueue'.  Object lifetime and
+// allocator propagation are verified with 'bslma::TestAllocator' and with an
+// item type counting its instances, whose destructor accesses the wheel.
+// Finally, a concurrency test verifies that no item is lost or returned twice
+// when several threads add, update, remove, and pop items.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] TimingWheel(bslma::Allocator *basicAllocator = 0);
+// [ 2] TimingWheel(int numIndexBits, bslma::Allocator *basicAllocator = 0);
+// [ 5] ~TimingWheel();
+//
+// MANIPULATORS
+// [ 2] Handle add(const TimeInterval& t, const DATA& d, int *, int *);
+// [ 2] void popLE(const TimeInterval& t, vector *, int *, TI *);
+// [ 2] int remove(Handle h, int *, TimeInterval *, TimeQueueItem *);
+// [ 3] void removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer = 0);
+// [ 3] int update(Handle h, const TimeInterval& newTime, int *isNewTop);
+//
+// ACCESSORS
+// [ 2] bool isRegisteredHandle(Handle handle) const;
+// [ 2] int length() const;
+// [ 3] int minTime(bsls::TimeInterval *buffer) const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] RANDOMIZED COMPARISON WITH 'TimeQueue'
+// [ 5] OBJECT LIFETIME
+// [ 6] CONCURRENCY TEST
+// [ 7] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: 'TimingWheel' vs. 'TimeQueue'
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   THREAD-SAFE OUTPUT AND ASSERT MACROS
+// ----------------------------------------------------------------------------
+
+static bslmt::Mutex coutMutex;
+
+#define ASSERTT(X) {                                                          \
+   if (!(X)) {                                                                \
+       bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);                      \
+       aSsErT(1, #X, __LINE__); } }
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlcc::TimingWheel<int>   Obj;
+typedef bdlcc::TimeQueueItem<int> Item;
+typedef bsls::TimeInterval        TI;
+typedef bsls::Types::Int64        Int64;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+TI ms(Int64 milliseconds)
+    // Return a time interval of the specified 'milliseconds'.
+{
+    return TI(milliseconds / 1000,
+              static_cast<int>(milliseconds % 1000) * 1000 * 1000);
+}
+
+                               // ============
+                               // class Random
+                               // ============
+
+class Random {
+    // This class provides a deterministic pseudo-random number generator.
+
+    // DATA
+    bsls::Types::Uint64 d_state;
+
+  public:
+    // CREATORS
+    explicit Random(unsigned seed)
+    : d_state(seed * 2654435761u + 1)
+    {
+    }
+
+    // MANIPULATORS
+    Int64 operator()(Int64 limit)
+        // Return a pseudo-random value in the range '[0, limit)'.
+    {
+        d_state = d_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<Int64>((d_state >> 16)
+                                  % static_cast<bsls::Types::Uint64>(limit));
+    }
+};
+
+                               // =============
+                               // class Counted
+                               // =============
+
+class Counted {
+    // This class provides an allocator-aware type that counts its instances,
+    // and whose destructor optionally accesses a 'TimingWheel'.
+
+    // DATA
+    bsl::string                        d_value;     // value (as a string, so
+                                                    // that memory is
+                                                    // allocated)
+
+    const bdlcc::TimingWheel<Counted> *d_wheel_p;   // wheel accessed by the
+                                                    // destructor, if not 0
+
+    static bsls::AtomicInt             s_numObjects;
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(Counted, bslma::UsesBslmaAllocator);
+
+    // CLASS METHODS
+    static int numObjects()
+    {
+        return s_numObjects;
+    }
+
+    // CREATORS
+    explicit Counted(const bdlcc::TimingWheel<Counted> *wheel = 0,
+                     bslma::Allocator                  *basicAllocator = 0)
+    : d_value("a string long enough to require a memory allocation",
+              basicAllocator)
+    , d_wheel_p(wheel)
+    {
+        ++s_numObjects;
+    }
+
+    Counted(const Counted& original, bslma::Allocator *basicAllocator = 0)
+    : d_value(original.d_value, basicAllocator)
+    , d_wheel_p(original.d_wheel_p)
+    {
+        ++s_numObjects;
+    }
+
+    ~Counted()
+    {
+        if (d_wheel_p) {
+            // Deadlocks if the wheel is locked by this thread.
+
+            d_wheel_p->isRegisteredHandle(0);
+        }
+        --s_numObjects;
+    }
+
+    // MANIPULATORS
+    Counted& operator=(const Counted& rhs)
+    {
+        d_value   = rhs.d_value;
+        d_wheel_p = rhs.d_wheel_p;
+        return *this;
+    }
+};
+
+bsls::AtomicInt Counted::s_numObjects(0);
+
+void verifyMinTime(const Obj& X, const bdlcc::TimeQueue<int>& Q, int line)
+    // Verify that the 'minTime' of the specified 'X' is a lower bound of the
+    // 'minTime' of the specified 'Q', and that both fail if empty.  Use the
+    // specified 'line' to report errors.
+{
+    TI xMin, qMin;
+    const int xRc = X.minTime(&xMin);
+    const int qRc = Q.minTime(&qMin);
+
+    LOOP3_ASSERT(line, xRc, qRc, (0 == xRc) == (0 == qRc));
+    if (0 == xRc && 0 == qRc) {
+        LOOP3_ASSERT(line, xMin, qMin, xMin <= qMin);
+    }
+}
+
+                            // ====================
+                            // struct ThreadContext
+                            // ====================
+
+struct ThreadContext {
+    // This 'struct' provides the state shared by the threads of the
+    // concurrency test.
+
+    Obj             d_wheel;
+    bsls::AtomicInt d_numAdded;
+    bsls::AtomicInt d_numRemoved;
+    bsls::AtomicInt d_numPopped;
+    bsls::AtomicInt d_numWriters;
+};
+
+void writerThread(ThreadContext *context, int id, int numIterations)
+    // Add, update, and remove items of the wheel of the specified 'context',
+    // identified by the specified 'id', for the specified 'numIterations'.
+{
+    Random random(id);
+
+    for (int i = 0; i < numIterations; ++i) {
+        const Obj::Handle h = context->d_wheel.add(ms(random(200)), id);
+        ASSERTT(-1 != h);
+        ++context->d_numAdded;
+
+        switch (random(3)) {
+          case 0: {
+            if (0 == context->d_wheel.remove(h)) {
+                ++context->d_numRemoved;
+            }
+          } break;
+          case 1: {
+            context->d_wheel.update(h, ms(random(200)));
+          } break;
+          default: {
+          } break;
+        }
+    }
+    --context->d_numWriters;
+}
+
+void popperThread(ThreadContext *context)
+    // Pop the items of the wheel of the specified 'context', with an
+    // increasing time, until all the writers are done and the wheel is empty.
+{
+    bsl::vector<Item> items;
+    Int64             now = 0;
+
+    while (0 < context->d_numWriters || 0 < context->d_wheel.length()) {
+        items.clear();
+        context->d_wheel.popLE(ms(now), &items);
+        for (bsl::size_t i = 0; i < items.size(); ++i) {
+            ASSERTT(items[i].time() <= ms(now));
+            ASSERTT(0 == i || items[i - 1].time() <= items[i].time());
+        }
+        context->d_numPopped += static_cast<int>(items.size());
+        now = now < 200 ? now + 1 : 0;
+    }
+}
+
+template <class QUEUE>
+void runBenchmark(double *armTime,
+                  double *runTime,
+                  QUEUE  *queue,
+                  int     numTimers,
+                  int     numRounds)
+    // Arm the specified 'numTimers' timers in the specified 'queue', each due
+    // within 30 seconds, and load the elapsed time in seconds into the
+    // specified 'armTime'.  Then, for the specified 'numRounds' rounds,
+    // advance the time by one millisecond, pop the expired timers and re-add
+    // them, and re-arm (as a connection receiving data would) as many timers
+    // as there are timers expected to expire per millisecond, and load the
+    // elapsed time in seconds into the specified 'runTime'.
+{
+    const int MAX_DELAY = 30 * 1000;
+
+    Random                                  random(numTimers);
+    bsl::vector<int>                        handles(numTimers);
+    bsl::vector<bdlcc::TimeQueueItem<int> > expired;
+
+    bsls::Stopwatch stopwatch;
+    stopwatch.start(true);
+
+    for (int i = 0; i < numTimers; ++i) {
+        handles[i] = queue->add(ms(random(MAX_DELAY)), i);
+    }
+
+    *armTime = stopwatch.accumulatedWallTime();
+    stopwatch.reset();
+    stopwatch.start(true);
+
+    const int numUpdates = numTimers / MAX_DELAY + 1;
+
+    for (int now = 0; now < numRounds; ++now) {
+        expired.clear();
+        queue->popLE(ms(now), &expired);
+
+        for (bsl::size_t i = 0; i < expired.size(); ++i) {
+            const int id = expired[i].data();
+            handles[id] = queue->add(ms(now + 1 + random(MAX_DELAY)), id);
+        }
+
+        for (int i = 0; i < numUpdates; ++i) {
+            const int id = static_cast<int>(random(numTimers));
+            queue->update(handles[id], ms(now + 1 + random(MAX_DELAY)));
+        }
+    }
+
+    *runTime = stopwatch.accumulatedWallTime();
+
+    queue->removeAll();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 7: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Connection Timeouts
+/// - - - - - - - - - - - - - - -
+// Suppose that a server closes the connections that have been idle for a
+// given time.  Each connection arms a timer when it is opened, and re-arms it
+// each time data is received.
+//
+// First, we create a wheel whose items identify a connection:
+//..
+    bdlcc::TimingWheel<int> timers;
+
+    const bsls::TimeInterval IDLE_TIMEOUT(30);
+    bsls::TimeInterval       now(1000);
+//..
+// Then, we arm the timers of two connections:
+//..
+    bdlcc::TimingWheel<int>::Handle h1 = timers.add(now + IDLE_TIMEOUT, 1);
+    bdlcc::TimingWheel<int>::Handle h2 = timers.add(now + IDLE_TIMEOUT, 2);
+    ASSERT(2 == timers.length());
+//..
+// Next, 10 seconds later, data is received on the first connection, and we
+// re-arm its timer:
+//..
+    now += bsls::TimeInterval(10);
+    int rc = timers.update(h1, now + IDLE_TIMEOUT);
+    ASSERT(0 == rc);
+//..
+// Then, 25 seconds later, we retrieve the connections that have timed out:
+//..
+    now += bsls::TimeInterval(25);
+
+    bsl::vector<bdlcc::TimeQueueItem<int> > expired;
+    timers.popLE(now, &expired);
+
+    ASSERT(1 == expired.size());
+    ASSERT(2 == expired[0].data());
+    ASSERT(h2 == expired[0].handle());
+//..
+// Finally, the first connection is closed by its peer, and we cancel its
+// timer:
+//..
+    rc = timers.remove(h1);
+    ASSERT(0 == rc);
+    ASSERT(0 == timers.length());
+//..
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 No item is lost or returned twice when several threads add,
+        //:   update, and remove items while another thread pops them.
+        //:
+        //: 2 The items returned by each call to 'popLE' are due, and ordered
+        //:   by time value.
+        //
+        // Plan:
+        //: 1 Run writer threads adding items, and either removing, updating,
+        //:   or keeping each of them, while a thread pops the items with a
+        //:   cycling time.  Verify that the number of added items is equal to
+        //:   the number of removed items plus the number of popped items.
+        //:   (C-1..2)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        const int NUM_WRITERS    = 4;
+        const int NUM_ITERATIONS = 20000;
+
+        ThreadContext context;
+        context.d_numWriters = NUM_WRITERS;
+
+        bslmt::ThreadGroup threads;
+        for (int i = 0; i < NUM_WRITERS; ++i) {
+            threads.addThread(bdlf::BindUtil::bind(&writerThread,
+                                                   &context,
+                                                   i,
+                                                   NUM_ITERATIONS));
+        }
+        threads.addThread(bdlf::BindUtil::bind(&popperThread, &context));
+        threads.joinAll();
+
+        if (veryVerbose) {
+            P_(context.d_numAdded); P_(context.d_numRemoved);
+            P(context.d_numPopped);
+        }
+
+        ASSERT(NUM_WRITERS * NUM_ITERATIONS == context.d_numAdded);
+        ASSERT(context.d_numAdded ==
+                              context.d_numRemoved + context.d_numPopped);
+        ASSERT(0 == context.d_wheel.length());
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // OBJECT LIFETIME
+        //
+        // Concerns:
+        //: 1 Each item added to the wheel is copied once, using the allocator
+        //:   of the wheel, and destroyed when it is removed (by 'popLE',
+        //:   'remove', or 'removeAll') or when the wheel is destroyed.
+        //:
+        //: 2 The removed items are destroyed without holding the lock of the
+        //:   wheel.
+        //:
+        //: 3 The nodes of removed items are reused.
+        //:
+        //: 4 All memory is supplied by the allocator of the wheel, and
+        //:   released when the wheel is destroyed.
+        //
+        // Plan:
+        //: 1 Add items of a type counting its instances, whose destructor
+        //:   calls a method of the wheel locking it, and remove them by each
+        //:   of the means above.  Verify the number of instances, and that
+        //:   no memory remains allocated from the default allocator.  (C-1..2)
+        //:
+        //: 2 Verify that adding items after having removed as many items does
+        //:   not allocate memory.  (C-3)
+        //:
+        //: 3 Verify that all memory is released when the wheel is destroyed.
+        //:   (C-4)
+        //
+        // Testing:
+        //   ~TimingWheel();
+        //   OBJECT LIFETIME
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "OBJECT LIFETIME" << endl
+                          << "===============" << endl;
+
+        typedef bdlcc::TimingWheel<Counted>   CObj;
+        typedef bdlcc::TimeQueueItem<Counted> CItem;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            CObj mX(&ta);  const CObj& X = mX;
+
+            // As for 'TimeQueue', the copies appended to a buffer by 'popLE'
+            // may be destroyed while holding the lock, so these copies do not
+            // access the wheel.
+
+            const Counted VALUE(&X, &ta);
+            const Counted PLAIN(0, &ta);
+            ASSERT(2 == Counted::numObjects());
+
+            CObj::Handle h[10];
+            for (int i = 0; i < 10; ++i) {
+                h[i] = mX.add(ms(i * 100), 3 == i || 4 == i ? PLAIN : VALUE);
+            }
+            ASSERT(12 == Counted::numObjects());
+
+            ASSERT(0 == mX.remove(h[0]));
+            ASSERT(11 == Counted::numObjects());
+
+            mX.popLE(ms(250));
+            ASSERT(9 == Counted::numObjects());
+
+            {
+                bsl::vector<CItem> items(&ta);
+                mX.popLE(ms(450), &items);
+                ASSERT(2 == items.size());
+                ASSERT(9 == Counted::numObjects());
+            }
+            ASSERT(7 == Counted::numObjects());
+
+            // Only the string of each copied item is allocated.
+
+            const Int64 NUM_BLOCKS = ta.numBlocksTotal();
+            for (int i = 0; i < 4; ++i) {
+                h[i] = mX.add(ms(i * 10), VALUE);
+            }
+            ASSERTV(ta.numBlocksTotal(),
+                    NUM_BLOCKS + 4 == ta.numBlocksTotal());
+            ASSERT(11 == Counted::numObjects());
+
+            mX.removeAll();
+            ASSERT(2 == Counted::numObjects());
+
+            for (int i = 0; i < 5; ++i) {
+                h[i] = mX.add(ms(i * 10), VALUE);
+            }
+            ASSERT(7 == Counted::numObjects());
+        }
+        ASSERT(0 == Counted::numObjects());
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        ASSERTV(defaultAllocator.numBlocksInUse(),
+                0 == defaultAllocator.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // RANDOMIZED COMPARISON WITH 'TimeQueue'
+        //
+        // Concerns:
+        //: 1 'popLE' returns exactly the items of a 'TimeQueue' on which the
+        //:   same operations were performed, in the same order, for any
+        //:   distribution of time values over the levels of the wheel, and
+        //:   when items are added with a time value lower than the time of
+        //:   the last call to 'popLE'.
+        //:
+        //: 2 'minTime' is a lower bound of the lowest time value, and is
+        //:   exact when an item is due within the same period of 64
+        //:   milliseconds as the time of the last call to 'popLE'.
+        //:
+        //: 3 Time values before the epoch, and far in the future, are
+        //:   supported.
+        //
+        // Plan:
+        //: 1 For time spans from 100 milliseconds to 1000 years, perform a
+        //:   random sequence of 'add', 'update', 'remove', and 'popLE' (with
+        //:   a time mostly increasing) on a 'TimingWheel' and a 'TimeQueue',
+        //:   and verify that the results are the same, and that the 'minTime'
+        //:   of the wheel is a lower bound of the one of the queue.  (C-1..2)
+        //:
+        //: 2 Add items with negative time values and time values beyond 2 **
+        //:   48 milliseconds, and verify that they are returned by 'popLE'.
+        //:   (C-3)
+        //
+        // Testing:
+        //   RANDOMIZED COMPARISON WITH 'TimeQueue'
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "RANDOMIZED COMPARISON WITH 'TimeQueue'" << endl
+                          << "======================================" << endl;
+
+        const Int64 SPANS[] = {
+            100LL,
+            10LL * 1000,
+            1000LL * 1000,
+            100LL * 1000 * 1000,
+            10000LL * 1000 * 1000,
+            1000LL * 365 * 24 * 3600 * 1000
+        };
+        const int NUM_SPANS = static_cast<int>(sizeof SPANS / sizeof *SPANS);
+
+        for (int ti = 0; ti < NUM_SPANS; ++ti) {
+            const Int64 SPAN = SPANS[ti];
+
+            if (veryVerbose) { T_ P(SPAN) }
+
+            Random                  random(ti);
+            Obj                     mX;  const Obj& X = mX;
+            bdlcc::TimeQueue<int>   mQ;  const bdlcc::TimeQueue<int>& Q = mQ;
+            bsl::vector<int>        xHandles;   // indexed by item id
+            bsl::vector<int>        qHandles;
+            bsl::vector<Item>       xItems, qItems;
+            Int64                   now = SPAN;
+
+            for (int i = 0; i < 20000; ++i) {
+                const int op = static_cast<int>(random(10));
+
+                if (op < 4 || xHandles.empty()) {
+                    const TI  time = ms(now - SPAN / 16 + random(SPAN));
+                    const int id   = static_cast<int>(xHandles.size());
+                    xHandles.push_back(mX.add(time, id));
+                    qHandles.push_back(mQ.add(time, id));
+                    ASSERTV(SPAN, i, -1 != xHandles.back());
+                }
+                else if (op < 6) {
+                    const int id   = static_cast<int>(
+                                                   random(xHandles.size()));
+                    const TI  time = ms(now + random(SPAN));
+                    const int xRc  = mX.update(xHandles[id], time);
+                    const int qRc  = mQ.update(qHandles[id], time);
+                    ASSERTV(SPAN, i, xRc, qRc, (0 == xRc) == (0 == qRc));
+                }
+                else if (op < 7) {
+                    const int id  = static_cast<int>(random(xHandles.size()));
+                    Item      xItem, qItem;
+                    const int xRc = mX.remove(xHandles[id], 0, 0, &xItem);
+                    const int qRc = mQ.remove(qHandles[id], 0, 0, &qItem);
+                    ASSERTV(SPAN, i, xRc, qRc, (0 == xRc) == (0 == qRc));
+                    if (0 == xRc && 0 == qRc) {
+                        ASSERTV(SPAN, i, xItem.time() == qItem.time());
+                        ASSERTV(SPAN, i, xItem.data() == qItem.data());
+                        ASSERTV(SPAN, i, xHandles[id] == xItem.handle());
+                    }
+                }
+                else {
+                    // Mostly advance the time, sometimes move it back.
+
+                    now += 0 == random(8) ? -random(SPAN / 8 + 1)
+                                          : random(SPAN / 4 + 1);
+
+                    xItems.clear();
+                    qItems.clear();
+
+                    int xLength, qLength;
+                    mX.popLE(ms(now), &xItems, &xLength);
+                    mQ.popLE(ms(now), &qItems, &qLength);
+
+                    ASSERTV(SPAN, i, xItems.size(), qItems.size(),
+                            xItems.size() == qItems.size());
+                    ASSERTV(SPAN, i, xLength, qLength, xLength == qLength);
+
+                    const bsl::size_t n = bsl::min(xItems.size(),
+                                                   qItems.size());
+                    for (bsl::size_t j = 0; j < n; ++j) {
+                        ASSERTV(SPAN, i, j,
+                                xItems[j].time() == qItems[j].time());
+                        ASSERTV(SPAN, i, j,
+                                xItems[j].data() == qItems[j].data());
+                        ASSERTV(SPAN, i, j,
+                                xHandles[xItems[j].data()] ==
+                                                         xItems[j].handle());
+                    }
+                }
+
+                ASSERTV(SPAN, i, X.length() == Q.length());
+                verifyMinTime(X, Q, L_);
+            }
+
+            // The remaining items are returned in the same order by
+            // 'removeAll'.
+
+            xItems.clear();
+            qItems.clear();
+            mX.removeAll(&xItems);
+            mQ.removeAll(&qItems);
+            ASSERTV(SPAN, xItems.size() == qItems.size());
+            for (bsl::size_t j = 0;
+                 j < xItems.size() && j < qItems.size();
+                 ++j) {
+                ASSERTV(SPAN, j, xItems[j].time() == qItems[j].time());
+                ASSERTV(SPAN, j, xItems[j].data() == qItems[j].data());
+            }
+        }
+
+        if (verbose) cout << "\tExtreme time values." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            const TI FAR(Int64(1) << 50, 999999999);
+
+            mX.add(FAR, 4);
+            mX.add(TI(-5, -1), 2);
+            mX.add(TI(0, -1), 3);
+            mX.add(TI(-100, 0), 1);
+            ASSERT(4 == X.length());
+
+            TI minTime;
+            ASSERT(0 == X.minTime(&minTime));
+            ASSERTV(minTime, TI(-100, 0) == minTime);
+
+            bsl::vector<Item> items;
+            mX.popLE(TI(0), &items);
+            ASSERTV(items.size(), 3 == items.size());
+            for (bsl::size_t j = 0; j < items.size(); ++j) {
+                ASSERTV(j, static_cast<int>(j) + 1 == items[j].data());
+            }
+
+            ASSERT(0 == X.minTime(&minTime));
+            ASSERTV(minTime, minTime <= FAR);
+
+            items.clear();
+            mX.popLE(TI(Int64(1) << 49), &items);
+            ASSERT(0 == items.size());
+
+            mX.popLE(FAR, &items);
+            ASSERT(1 == items.size());
+            ASSERT(0 == X.length());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'update', 'removeAll', AND 'minTime'
+        //
+        // Concerns:
+        //: 1 'update' moves an item to its new time value, and fails for a
+        //:   stale or invalid handle.
+        //:
+        //: 2 'isNewTop' is loaded with a non-zero value if and only if the
+        //:   new time value is lower than 'minTime' for the other items.
+        //:
+        //: 3 'minTime' fails for an empty wheel, is exact when the lowest time
+        //:   value is within 64 milliseconds of the last 'popLE', and is
+        //:   otherwise a lower bound of the lowest time value.
+        //:
+        //: 4 'removeAll' removes all the items and returns them in time
+        //:   order, and invalidates their handles.
+        //:
+        //: 5 'popLE' and 'remove' load the new length and new minimum time.
+        //
+        // Plan:
+        //: 1 Using ad-hoc data, update items, and check the results.
+        //:   (C-1..5)
+        //
+        // Testing:
+        //   void removeAll(bsl::vector<TimeQueueItem<DATA> > *buffer = 0);
+        //   int update(Handle h, const TimeInterval& newTime, int *isNewTop);
+        //   int minTime(bsls::TimeInterval *buffer) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'update', 'removeAll', AND 'minTime'" << endl
+                          << "====================================" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        TI minTime;
+        ASSERT(0 != X.minTime(&minTime));
+
+        int isNewTop = -1, newLength = -1;
+        const Obj::Handle H1 = mX.add(ms(30), 1, &isNewTop, &newLength);
+        ASSERT(1 == isNewTop);
+        ASSERT(1 == newLength);
+
+        ASSERT(0 == X.minTime(&minTime));
+        ASSERTV(minTime, ms(30) == minTime);
+
+        const Obj::Handle H2 = mX.add(ms(40), 2, &isNewTop, &newLength);
+        ASSERT(0 == isNewTop);
+        ASSERT(2 == newLength);
+
+        const Obj::Handle H3 = mX.add(ms(10), 3, &isNewTop);
+        ASSERT(1 == isNewTop);
+
+        ASSERT(0 == X.minTime(&minTime));
+        ASSERTV(minTime, ms(10) == minTime);
+
+        ASSERT(0 == mX.update(H3, ms(50), &isNewTop));
+        ASSERT(0 == isNewTop);
+        ASSERT(0 == X.minTime(&minTime));
+        ASSERTV(minTime, ms(30) == minTime);
+
+        ASSERT(0 == mX.update(H2, ms(20), &isNewTop));
+        ASSERT(1 == isNewTop);
+
+        // The only item is always the new top.
+
+        {
+            Obj mY;
+            const Obj::Handle H = mY.add(ms(100000), 0);
+            ASSERT(0 == mY.update(H, ms(200000), &isNewTop));
+            ASSERT(1 == isNewTop);
+        }
+
+        if (verbose) cout << "\tLower bound beyond level 0." << endl;
+
+        const Obj::Handle H4 = mX.add(ms(10000), 4);
+        const Obj::Handle H5 = mX.add(ms(10010), 5);
+
+        int length = -1;
+        mX.popLE(ms(100), 0, &length, &minTime);
+        ASSERT(2 == length);
+        ASSERTV(minTime, minTime <= ms(10000));
+        ASSERT(!X.isRegisteredHandle(H1));
+        ASSERT(!X.isRegisteredHandle(H2));
+        ASSERT(!X.isRegisteredHandle(H3));
+
+        ASSERT(0 == X.minTime(&minTime));
+        ASSERTV(minTime, minTime <= ms(10000));
+        ASSERTV(minTime, ms(100) < minTime);
+
+        ASSERT(0 != mX.update(H1, ms(0)));
+        ASSERT(0 != mX.update(0, ms(0)));
+        ASSERT(0 != mX.update(-1, ms(0)));
+
+        // A new item due before the lower bound is the new top.
+
+        const Obj::Handle H6 = mX.add(ms(5000), 6, &isNewTop);
+        ASSERT(1 == isNewTop);
+
+        mX.popLE(ms(9999), 0, &length, &minTime);
+        ASSERT(2 == length);
+        ASSERTV(minTime, ms(10000) == minTime);
+        ASSERT(!X.isRegisteredHandle(H6));
+
+        ASSERT(0 == mX.remove(H4, &length, &minTime));
+        ASSERT(1 == length);
+        ASSERTV(minTime, ms(10010) == minTime);
+
+        if (verbose) cout << "\tTesting 'removeAll'." << endl;
+
+        mX.add(ms(20000), 7);
+        mX.add(ms(15000), 8);
+        mX.add(ms(20000), 9);
+
+        bsl::vector<Item> items;
+        mX.removeAll(&items);
+        ASSERT(4 == items.size());
+        ASSERT(0 == X.length());
+        ASSERT(0 != X.minTime(&minTime));
+        ASSERT(!X.isRegisteredHandle(H5));
+
+        if (4 == items.size()) {
+            ASSERT(5 == items[0].data());
+            ASSERT(8 == items[1].data());
+            ASSERT(7 == items[2].data());
+            ASSERT(9 == items[3].data());
+            ASSERT(H5 == items[0].handle());
+        }
+
+        mX.removeAll();
+        ASSERT(0 == X.length());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // PRIMARY MANIPULATORS AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 'add' returns a distinct valid handle for each item, and -1 when
+        //:   the maximum number of items is reached.
+        //:
+        //: 2 'popLE' removes exactly the items whose time value is less than
+        //:   or equal to the specified time, including items whose time value
+        //:   is less than the time of a previous call to 'popLE', and returns
+        //:   them ordered by time value then order of addition.
+        //:
+        //: 3 'remove' removes the item having the handle, loads it, and
+        //:   fails for a removed, stale, or invalid handle.
+        //:
+        //: 4 The handle of a removed item is rejected even once its node has
+        //:   been reused.
+        //:
+        //: 5 Memory is supplied by the specified allocator.
+        //
+        // Plan:
+        //: 1 Using ad-hoc data, add items, pop and remove them, and check the
+        //:   results.  (C-1..5)
+        //
+        // Testing:
+        //   TimingWheel(bslma::Allocator *basicAllocator = 0);
+        //   TimingWheel(int numIndexBits, bslma::Allocator *ba = 0);
+        //   Handle add(const TimeInterval& t, const DATA& d, int *, int *);
+        //   void popLE(const TimeInterval& t, vector *, int *, TI *);
+        //   int remove(Handle h, int *, TimeInterval *, TimeQueueItem *);
+        //   bool isRegisteredHandle(Handle handle) const;
+        //   int length() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                       << "PRIMARY MANIPULATORS AND BASIC ACCESSORS" << endl
+                       << "========================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(&ta);  const Obj& X = mX;
+
+            ASSERT(0 == X.length());
+            ASSERT(!X.isRegisteredHandle(0));
+            ASSERT(!X.isRegisteredHandle(1));
+
+            const Obj::Handle H1 = mX.add(ms(1000), 1);
+            const Obj::Handle H2 = mX.add(ms(500),  2);
+            const Obj::Handle H3 = mX.add(ms(1000), 3);
+            const Obj::Handle H4 = mX.add(ms(70000), 4);
+            const Obj::Handle H5 = mX.add(ms(999), 5);
+            ASSERT(5 == X.length());
+            ASSERT(H1 != H2 && H1 != H3 && H2 != H3 && H3 != H4 && H4 != H5);
+            ASSERT(X.isRegisteredHandle(H1));
+            ASSERT(X.isRegisteredHandle(H4));
+            ASSERT(0 < ta.numBlocksInUse());
+            ASSERT(0 == defaultAllocator.numBlocksInUse());
+
+            bsl::vector<Item> items;
+            int               length = -1;
+            mX.popLE(ms(499), &items, &length);
+            ASSERT(0 == items.size());
+            ASSERT(5 == length);
+
+            mX.popLE(ms(1000), &items, &length);
+            ASSERT(4 == items.size());
+            ASSERT(1 == length);
+            if (4 == items.size()) {
+                ASSERT(2 == items[0].data());  ASSERT(H2 == items[0].handle());
+                ASSERT(5 == items[1].data());
+                ASSERT(1 == items[2].data());  ASSERT(ms(1000) ==
+                                                             items[2].time());
+                ASSERT(3 == items[3].data());
+            }
+            ASSERT(!X.isRegisteredHandle(H1));
+            ASSERT(X.isRegisteredHandle(H4));
+
+            // Items due before the last 'popLE' time.
+
+            const Obj::Handle H6 = mX.add(ms(100), 6);
+            const Obj::Handle H7 = mX.add(ms(1000), 7);
+            const Obj::Handle H8 = mX.add(ms(1001), 8);
+            ASSERT(H6 != H1 && H7 != H1);
+
+            items.clear();
+            mX.popLE(ms(900), &items);
+            ASSERT(1 == items.size());
+            ASSERT(6 == items[0].data());
+
+            items.clear();
+            mX.popLE(ms(1000), &items);
+            ASSERT(1 == items.size());
+            ASSERT(7 == items[0].data());
+            ASSERT(X.isRegisteredHandle(H8));
+
+            // 'remove'
+
+            Item item;
+            ASSERT(0 == mX.remove(H4, &length, 0, &item));
+            ASSERT(1 == length);
+            ASSERT(4 == item.data());
+            ASSERT(ms(70000) == item.time());
+            ASSERT(H4 == item.handle());
+            ASSERT(0 != mX.remove(H4));
+            ASSERT(0 != mX.remove(H7));
+            ASSERT(0 != mX.remove(0));
+            ASSERT(0 != mX.remove(-1));
+            ASSERT(0 != mX.remove(1 << 16));
+
+            // Stale handles are rejected once their node is reused.
+
+            const Obj::Handle H9 = mX.add(ms(2000), 9);
+            ASSERT(!X.isRegisteredHandle(H4));
+            ASSERT(0 != mX.remove(H4));
+            ASSERT(X.isRegisteredHandle(H9));
+
+            mX.popLE(ms(3000));
+            ASSERT(0 == X.length());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\tMaximum number of items." << endl;
+        {
+            Obj mX(8, &ta);  const Obj& X = mX;
+
+            for (int i = 0; i < 254; ++i) {
+                ASSERTV(i, -1 != mX.add(ms(i), i));
+            }
+            ASSERT(254 == X.length());
+            ASSERT(-1 == mX.add(ms(0), 0));
+
+            mX.popLE(ms(0));
+            ASSERT(-1 != mX.add(ms(0), 0));
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Add, update, pop and remove a few items.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+
+        const TI NOW(1000000);
+
+        const Obj::Handle H1 = mX.add(NOW + TI(1), 1);
+        const Obj::Handle H2 = mX.add(NOW + TI(2), 2);
+        const Obj::Handle H3 = mX.add(NOW + TI(3), 3);
+        ASSERT(3 == X.length());
+
+        ASSERT(0 == mX.update(H1, NOW + TI(4)));
+        ASSERT(0 == mX.remove(H2));
+        ASSERT(2 == X.length());
+
+        bsl::vector<Item> items;
+        mX.popLE(NOW + TI(3), &items);
+        ASSERT(1 == items.size());
+        ASSERT(H3 == items[0].handle());
+
+        mX.popLE(NOW + TI(4), &items);
+        ASSERT(2 == items.size());
+        ASSERT(H1 == items[1].handle());
+        ASSERT(0 == X.length());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST: 'TimingWheel' vs. 'TimeQueue'
+        //
+        // Concerns:
+        //: 1 Arming, re-arming, and expiring timers on a 'TimingWheel' is
+        //:   faster than on a 'TimeQueue' when many timers are armed.
+        //
+        // Plan:
+        //: 1 For an increasing number of armed timers (up to one million),
+        //:   measure the time taken to arm the timers, and then to pop the
+        //:   timers expiring over 10 seconds, re-adding each of them, while
+        //:   re-arming some of the other timers.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: 'TimingWheel' vs. 'TimeQueue'
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        const int NUM_ROUNDS = argc > 2 ? atoi(argv[2]) : 10000;
+
+        cout << "Seconds to arm the timers, and to run " << NUM_ROUNDS
+             << " rounds" << endl
+             << "timers\tTimeQueue (arm/run)\tTimingWheel (arm/run)" << endl;
+
+        for (int numTimers = 1000; numTimers <= 1000000; numTimers *= 10) {
+            double queueArm, queueRun;
+            {
+                bdlcc::TimeQueue<int> queue(21);
+                runBenchmark(&queueArm, &queueRun, &queue, numTimers,
+                             NUM_ROUNDS);
+            }
+
+            double wheelArm, wheelRun;
+            {
+                Obj wheel(21);
+                runBenchmark(&wheelArm, &wheelRun, &wheel, numTimers,
+                             NUM_ROUNDS);
+            }
+
+            cout << numTimers
+                 << "\t" << queueArm << "/" << queueRun
+                 << "\t" << wheelArm << "/" << wheelRun << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -31,6 +31,26 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+///Combining Checksums
+///-------------------
+// The class method 'combine' computes the checksum of the concatenation of two
+// datasets from the checksums of each and the length of the second, without
+// access to the data itself.  This allows a large dataset to be divided into
+// chunks whose checksums are computed independently (e.g., by separate
+// threads) and then combined:
+//..
+//  const char *data   = "The quick brown fox jumps over the lazy dog";
+//  const int   length = static_cast<int>(bsl::strlen(data));
+//
+//  bdlde::Crc32 head(data,      10);
+//  bdlde::Crc32 tail(data + 10, length - 10);
+//
+//  const unsigned int crc = bdlde::Crc32::combine(head.checksum(),
+//                                                 tail.checksum(),
+//                                                 length - 10);
+//  assert(bdlde::Crc32(data, length).checksum() == crc);
+//..
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate a typical use of the
@@ -94,6 +114,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_BSL_IOSFWD
 #include <bsl_iosfwd.h>
 #endif
@@ -130,6 +154,17 @@ class Crc32 {
 
   public:
     // CLASS METHODS
+    static unsigned int combine(unsigned int        checksumA,
+                                unsigned int        checksumB,
+                                bsls::Types::Uint64 lengthB);
+        // Return the CRC-32 checksum of the concatenation of two datasets 'A'
+        // and 'B', where the specified 'checksumA' is the checksum of 'A',
+        // the specified 'checksumB' is the checksum of 'B', and the specified
+        // 'lengthB' is the length of 'B' (in bytes).  Note that this allows
+        // the checksums of consecutive chunks of a dataset to be computed
+        // independently (e.g., in parallel) and then combined; the time taken
+        // is logarithmic in 'lengthB'.
+
     static int maxSupportedBdexVersion(int versionSelector);
         // Return the maximum valid BDEX format version, as indicated by the
         // specified 'versionSelector', to be passed to the 'bdexStreamOut'
@@ -72,6 +72,7 @@ using namespace bsl;  // automatically added by script
 //
 //-----------------------------------------------------------------------------
 // CLASS METHODS
+// [16] static unsigned int combine(unsigned int, unsigned int, Uint64);
 // [10] static int maxSupportedBdexVersion(int);
 //
 // CREATORS
@@ -98,9 +99,10 @@ using namespace bsl;  // automatically added by script
 // [ 5] bsl::ostream& operator<<(bsl::ostream& stream, const bdlde::Crc32&);
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [15] USAGE EXAMPLE
+// [17] USAGE EXAMPLE
 // [ 2] BOOTSTRAP: void update(const void *data, int length);
 // [14] CRC_TABLE TEST
+// [15] SLICE-BY-8 UPDATE
 // [-1] PERFORMANCE TEST
 //
 // [ 3] int ggg(bdlde::Crc32 *object, const char *spec, int vF = 1);
@@ -515,7 +517,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 15: {
+      case 17: {
         // --------------------------------------------------------------------
         // TESTING USAGE EXAMPLE
         //   This will test the usage example provided in the component header
@@ -546,6 +548,158 @@ int main(int argc, char *argv[])
         receiverExample(in);
 
       } break;
+      case 16: {
+        // --------------------------------------------------------------------
+        // TESTING 'combine'
+        //
+        // Concerns:
+        //: 1 'combine' returns the checksum of the concatenation of two
+        //:   datasets, given the checksums of each and the length of the
+        //:   second, for every split point of a dataset.
+        //:
+        //: 2 'combine' is correct for lengths that do not fit in an 'int',
+        //:   and an empty second dataset leaves the first checksum unchanged.
+        //
+        // Plan:
+        //: 1 For a range of data lengths and every split point, compare the
+        //:   combined checksums of the two parts against the oracle 'crc'
+        //:   applied to the whole.  (C-1)
+        //:
+        //: 2 Verify that combining with an empty dataset is the identity, and
+        //:   verify the associativity of 'combine' for datasets whose
+        //:   lengths, taken together, exceed 2^32 bytes.  (C-2)
+        //
+        // Testing:
+        //   static unsigned int combine(unsigned int, unsigned int, Uint64);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting 'combine'"
+                          << "\n=================" << endl;
+
+        typedef unsigned int Checksum;
+
+        enum { k_MAX_LEN = 96 };
+
+        char buffer[k_MAX_LEN];
+        for (int i = 0; i < k_MAX_LEN; ++i) {
+            buffer[i] = static_cast<char>(i * 37 + (i >> 3) * 11 + 5);
+        }
+
+        for (int len = 0; len <= k_MAX_LEN; ++len) {
+            const Checksum EXP = crc(buffer, len);
+
+            for (int split = 0; split <= len; ++split) {
+                const Checksum A = crc(buffer, split);
+                const Checksum B = crc(buffer + split, len - split);
+
+                LOOP2_ASSERT(len, split, EXP == Obj::combine(A, B,
+                                                             len - split));
+            }
+        }
+
+        const Checksum VALUES[] = { 0, 1, 0x80, ~Checksum(), crc(buffer, 17),
+                                    crc(buffer + 5, 40) };
+        enum { k_NUM_VALUES = sizeof VALUES / sizeof *VALUES };
+
+        const bsls::Types::Uint64 LENGTHS[] = { 0, 1, 7, 8, 1000, 1 << 20,
+                                                0xffffffffULL,
+                                                0x100000001ULL,
+                                                5000000000ULL };
+        enum { k_NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        for (int ai = 0; ai < k_NUM_VALUES; ++ai) {
+            const Checksum A = VALUES[ai];
+
+            LOOP_ASSERT(ai, A == Obj::combine(A, crc(buffer, 0), 0));
+
+            for (int bi = 0; bi < k_NUM_VALUES; ++bi) {
+                const Checksum B = VALUES[bi];
+
+                for (int ci = 0; ci < k_NUM_VALUES; ++ci) {
+                    const Checksum C = VALUES[ci];
+
+                    for (int li = 0; li < k_NUM_LENGTHS; ++li) {
+                        const bsls::Types::Uint64 LB = LENGTHS[li];
+                        const bsls::Types::Uint64 LC =
+                                          LENGTHS[k_NUM_LENGTHS - 1 - li];
+
+                        const Checksum AB    = Obj::combine(A, B, LB);
+                        const Checksum BC    = Obj::combine(B, C, LC);
+                        const Checksum LEFT  = Obj::combine(AB, C, LC);
+                        const Checksum RIGHT = Obj::combine(A, BC, LB + LC);
+
+                        LOOP4_ASSERT(ai, bi, ci, li, LEFT == RIGHT);
+                    }
+                }
+            }
+        }
+
+        // A dataset of 2^20 zero bytes, checked against 'update'.
+
+        {
+            bsl::vector<char> zeros(1 << 20, 0);
+
+            Obj mX(buffer, k_MAX_LEN);
+            mX.update(&zeros[0], static_cast<int>(zeros.size()));
+
+            const Checksum B = crc(&zeros[0],
+                                   static_cast<int>(zeros.size()));
+
+            ASSERT(mX.checksum() == Obj::combine(crc(buffer, k_MAX_LEN),
+                                                 B,
+                                                 zeros.size()));
+        }
+      } break;
+      case 15: {
+        // --------------------------------------------------------------------
+        // TESTING SLICE-BY-8 'update'
+        //
+        // Concerns:
+        //: 1 'update' consumes data 8 bytes at a time, then byte by byte;
+        //:   the checksum is that of the byte-at-a-time algorithm for every
+        //:   length and alignment of the data, and for every way of dividing
+        //:   the data between calls to 'update'.
+        //
+        // Plan:
+        //: 1 For every length up to several blocks, at every alignment
+        //:   within an 8-byte word, compare the checksum of the data computed
+        //:   with one call to 'update', and with two calls divided at a range
+        //:   of split points, against the oracle 'crc'.  (C-1)
+        //
+        // Testing:
+        //   SLICE-BY-8 UPDATE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTesting Slice-By-8 'update'"
+                          << "\n===========================" << endl;
+
+        typedef unsigned int Checksum;
+
+        enum { k_MAX_LEN = 160 };
+
+        char buffer[k_MAX_LEN + 8];
+        for (int i = 0; i < k_MAX_LEN + 8; ++i) {
+            buffer[i] = static_cast<char>(i * 113 + (i >> 2) * 29 + 3);
+        }
+
+        for (int offset = 0; offset < 8; ++offset) {
+            const char *const DATA = buffer + offset;
+
+            for (int len = 0; len <= k_MAX_LEN; ++len) {
+                const Checksum EXP = crc(DATA, len);
+
+                Obj mX(DATA, len);  const Obj& X = mX;
+                LOOP2_ASSERT(offset, len, EXP == X.checksum());
+
+                for (int split = 0; split <= len; split += 1 + len / 9) {
+                    Obj mY;  const Obj& Y = mY;
+                    mY.update(DATA, split);
+                    mY.update(DATA + split, len - split);
+                    LOOP3_ASSERT(offset, len, split, EXP == Y.checksum());
+                }
+            }
+        }
+      } break;
       case 14: {
         // --------------------------------------------------------------------
         // TESTING CRC_TABLE
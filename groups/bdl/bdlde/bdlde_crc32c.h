@@ -0,0 +1,408 @@
+// bdlde_crc32c.h                                                     -*-C++-*-
+#ifndef INCLUDED_BDLDE_CRC32C
+#define INCLUDED_BDLDE_CRC32C
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a mechanism to compute the CRC-32C checksum of a dataset.
+//
+//@CLASSES:
+//  bdlde::Crc32c: stores and updates a CRC-32C checksum
+//
+//@SEE_ALSO: bdlde_crc32, bdlde_crc64
+//
+//@DESCRIPTION: 'bdlde::Crc32c' implements a mechanism for computing, updating,
+// and streaming a CRC-32C checksum (a cyclic redundancy check comprising 32
+// bits, using the Castagnoli polynomial 0x1EDC6F41 as specified in RFC 3720).
+// CRC-32C has better error-detection properties than the CRC-32 computed by
+// 'bdlde::Crc32', and is the checksum used by iSCSI, SCTP, ext4, and many
+// storage and messaging formats.  Note that, like other CRCs, a CRC-32C
+// checksum does not aid in error correction and is not useful in any sort of
+// cryptographic application.
+//
+///Performance
+///-----------
+// On x86-64 processors supporting SSE4.2 (detected at run time, on compilers
+// that allow it), 'update' uses the 'crc32' instruction, which consumes 8
+// bytes at a time.  Inputs of at least 768 bytes are divided into three
+// interleaved streams, so that three independent 'crc32' instructions are in
+// flight at once, and the three partial checksums are merged with table
+// look-ups.  Elsewhere, 'update' uses the table-driven "slice-by-8" algorithm,
+// which also consumes 8 bytes per iteration.  Both produce identical results.
+//
+///Combining Checksums
+///-------------------
+// The class method 'combine' computes the checksum of the concatenation of two
+// datasets from the checksums of each and the length of the second, without
+// access to the data itself.  This allows a large dataset to be divided into
+// chunks whose checksums are computed independently (e.g., by separate
+// threads) and then combined.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Checksumming a Message in Parallel Chunks
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need the CRC-32C checksum of a large message, and want to
+// compute the checksums of its parts separately (e.g., on separate threads)
+// before combining them.
+//
+// First, we prepare a message, and divide it into two parts:
+//..
+//  const char *message = "The quick brown fox jumps over the lazy dog";
+//  const int   length  = static_cast<int>(bsl::strlen(message));
+//  const int   split   = 16;
+//..
+// Then, we compute the checksum of each part independently:
+//..
+//  bdlde::Crc32c head(message, split);
+//  bdlde::Crc32c tail(message + split, length - split);
+//..
+// Next, we combine the two checksums, supplying the length of the second
+// part:
+//..
+//  const unsigned int crc = bdlde::Crc32c::combine(head.checksum(),
+//                                                  tail.checksum(),
+//                                                  length - split);
+//..
+// Finally, we verify that the result is the checksum of the whole message:
+//..
+//  bdlde::Crc32c whole(message, length);
+//  assert(whole.checksum() == crc);
+//  assert(0x22620404      == crc);
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlde {
+
+                                // ============
+                                // class Crc32c
+                                // ============
+
+class Crc32c {
+    // This class represents a CRC-32C checksum value that can be updated as
+    // data is provided.
+    //
+    // More generally, this class supports a complete set of *value*
+    // *semantic* operations, including copy construction, assignment,
+    // equality comparison, 'ostream' printing, and 'bdex' serialization.
+    // (A precise operational definition of when two objects have the same
+    // value can be found in the description of 'operator==' for the class.)
+    // This class is *exception* *neutral* with no guarantee of rollback: if an
+    // exception is thrown during the invocation of a method on a pre-existing
+    // object, the class is left in a valid state, but its value is undefined.
+    // In no event is memory leaked.  Finally, *aliasing* (e.g., using all or
+    // part of an object as both source and destination) is supported in all
+    // cases.
+
+    // DATA
+    unsigned int d_crc;  // bitwise inverse of the current checksum
+
+    // FRIENDS
+    friend bool operator==(const Crc32c&, const Crc32c&);
+
+  public:
+    // CLASS METHODS
+    static unsigned int combine(unsigned int        checksumA,
+                                unsigned int        checksumB,
+                                bsls::Types::Uint64 lengthB);
+        // Return the CRC-32C checksum of the concatenation of two datasets 'A'
+        // and 'B', where the specified 'checksumA' is the checksum of 'A',
+        // the specified 'checksumB' is the checksum of 'B', and the specified
+        // 'lengthB' is the length of 'B' (in bytes).  The time taken is
+        // logarithmic in 'lengthB'.
+
+    static int maxSupportedBdexVersion(int versionSelector);
+        // Return the maximum valid BDEX format version, as indicated by the
+        // specified 'versionSelector', to be passed to the 'bdexStreamOut'
+        // method.  Note that the 'versionSelector' is expected to be formatted
+        // as 'yyyymmdd', a date representation.  See the 'bslx' package-level
+        // documentation for more information on BDEX streaming of
+        // value-semantic types and containers.
+
+    // CREATORS
+    Crc32c();
+        // Construct a checksum having the value corresponding to no data
+        // having been provided (i.e., having the value 0).
+
+    Crc32c(const void *data, int length);
+        // Construct a checksum corresponding to the specified 'data' having
+        // the specified 'length' (in bytes).  The behavior is undefined unless
+        // '0 <= length'.  Note that if 'data' is 0, then 'length' also must
+        // be 0.
+
+    Crc32c(const Crc32c& original);
+        // Construct a checksum having the value of the specified 'original'
+        // checksum.
+
+    // ~Crc32c();
+        // Destroy this checksum.  Note that this trivial destructor is
+        // generated by the compiler.
+
+    // MANIPULATORS
+    Crc32c& operator=(const Crc32c& rhs);
+        // Assign to this checksum the value of the specified 'rhs' checksum,
+        // and return a reference to this modifiable checksum.
+
+    template <class STREAM>
+    STREAM& bdexStreamIn(STREAM& stream, int version);
+        // Assign to this object the value read from the specified input
+        // 'stream' using the specified 'version' format, and return a
+        // reference to 'stream'.  If 'stream' is initially invalid, this
+        // operation has no effect.  If 'version' is not supported, this object
+        // is unaltered and 'stream' is invalidated but otherwise unmodified.
+        // If 'version' is supported but 'stream' becomes invalid during this
+        // operation, this object has an undefined, but valid, state.  Note
+        // that no version is read from 'stream'.  See the 'bslx' package-level
+        // documentation for more information on BDEX streaming of
+        // value-semantic types and containers.
+
+    unsigned int checksumAndReset();
+        // Return the current value of this checksum and set the value of this
+        // checksum to the value the default constructor provides.
+
+    void reset();
+        // Reset the value of this checksum to the value the default
+        // constructor provides.
+
+    void update(const void *data, int length);
+        // Update the value of this checksum to incorporate the specified
+        // 'data' having the specified 'length'.  If the current state is the
+        // default state, the resultant value of this checksum is the
+        // application of the CRC-32C algorithm upon the currently given
+        // 'data' of the given 'length'.  If this checksum has been previously
+        // provided data and has not been subsequently reset, the current state
+        // is not the default state and the resultant value is equivalent to
+        // applying the CRC-32C algorithm upon the concatenation of all the
+        // provided data.  The behavior is undefined unless '0 <= length'.
+        // Note that if 'data' is 0, then 'length' also must be 0.
+
+    // ACCESSORS
+    template <class STREAM>
+    STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        // Write this value to the specified output 'stream' using the
+        // specified 'version' format, and return a reference to 'stream'.  If
+        // 'stream' is initially invalid, this operation has no effect.  If
+        // 'version' is not supported, 'stream' is invalidated but otherwise
+        // unmodified.  Note that 'version' is not written to 'stream'.  See
+        // the 'bslx' package-level documentation for more information on BDEX
+        // streaming of value-semantic types and containers.
+
+    unsigned int checksum() const;
+        // Return the current value of this checksum.
+
+    bsl::ostream& print(bsl::ostream& stream) const;
+        // Format the current value of this checksum to the specified output
+        // 'stream' as "0x" followed by 8 lower-case hexadecimal digits, and
+        // return a reference to 'stream'.  If 'stream' is not valid on entry,
+        // this operation has no effect.
+};
+
+// FREE OPERATORS
+bool operator==(const Crc32c& lhs, const Crc32c& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' checksums have the same
+    // value, and 'false' otherwise.  Two checksums have the same value if the
+    // values obtained from their 'checksum' methods are identical.
+
+bool operator!=(const Crc32c& lhs, const Crc32c& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' checksums do not have the
+    // same value, and 'false' otherwise.  Two checksums do not have the same
+    // value if the values obtained from their 'checksum' methods differ.
+
+bsl::ostream& operator<<(bsl::ostream& stream, const Crc32c& checksum);
+    // Write to the specified output 'stream' the specified 'checksum' value
+    // and return a reference to the modifiable 'stream'.
+
+                             // ==================
+                             // struct Crc32c_Impl
+                             // ==================
+
+struct Crc32c_Impl {
+    // [!PRIVATE!] This 'struct' provides a namespace for the alternative
+    // implementations of the CRC-32C register update used by 'Crc32c', so
+    // that each can be tested on the platforms supporting it.  This 'struct'
+    // must not be used outside this component.
+
+    // CLASS METHODS
+    static bool isHardwareAccelerated();
+        // Return 'true' if 'updateHardware' may be called on the current
+        // platform and processor, and 'false' otherwise.
+
+    static unsigned int updateHardware(unsigned int  crc,
+                                       const void   *data,
+                                       bsl::size_t   length);
+        // Return the CRC-32C register resulting from feeding the specified
+        // 'length' bytes at the specified 'data' to a register having the
+        // specified 'crc' value, using the SSE4.2 'crc32' instruction.  The
+        // behavior is undefined unless 'isHardwareAccelerated()' is 'true'.
+
+    static unsigned int updateSoftware(unsigned int  crc,
+                                       const void   *data,
+                                       bsl::size_t   length);
+        // Return the CRC-32C register resulting from feeding the specified
+        // 'length' bytes at the specified 'data' to a register having the
+        // specified 'crc' value, using table look-ups.
+};
+
+// ============================================================================
+//                        INLINE DEFINITIONS
+// ============================================================================
+
+                                // ------------
+                                // class Crc32c
+                                // ------------
+
+// CLASS METHODS
+inline
+int Crc32c::maxSupportedBdexVersion(int)
+{
+    return 1;
+}
+
+// CREATORS
+inline
+Crc32c::Crc32c()
+: d_crc(0xffffffff)
+{
+}
+
+inline
+Crc32c::Crc32c(const void *data, int length)
+: d_crc(0xffffffff)
+{
+    update(data, length);
+}
+
+inline
+Crc32c::Crc32c(const Crc32c& original)
+: d_crc(original.d_crc)
+{
+}
+
+// MANIPULATORS
+inline
+Crc32c& Crc32c::operator=(const Crc32c& rhs)
+{
+    d_crc = rhs.d_crc;
+    return *this;
+}
+
+template <class STREAM>
+STREAM& Crc32c::bdexStreamIn(STREAM& stream, int version)
+{
+    if (stream) {
+        switch (version) {
+          case 1: {
+            unsigned int crc;
+            stream.getUint32(crc);
+            if (!stream) {
+                return stream;                                        // RETURN
+            }
+            d_crc = ~crc;
+          } break;
+          default: {
+            stream.invalidate();
+          } break;
+        }
+    }
+    return stream;
+}
+
+inline
+unsigned int Crc32c::checksumAndReset()
+{
+    const unsigned int crc = ~d_crc;
+    d_crc = 0xffffffff;
+    return crc;
+}
+
+inline
+void Crc32c::reset()
+{
+    d_crc = 0xffffffff;
+}
+
+// ACCESSORS
+template <class STREAM>
+STREAM& Crc32c::bdexStreamOut(STREAM& stream, int version) const
+{
+    switch (version) {
+      case 1: {
+        stream.putUint32(~d_crc);
+      } break;
+      default: {
+        stream.invalidate();
+      } break;
+    }
+    return stream;
+}
+
+inline
+unsigned int Crc32c::checksum() const
+{
+    return ~d_crc;
+}
+
+// FREE OPERATORS
+inline
+bool operator==(const Crc32c& lhs, const Crc32c& rhs)
+{
+    return lhs.d_crc == rhs.d_crc;
+}
+
+inline
+bool operator!=(const Crc32c& lhs, const Crc32c& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline
+bsl::ostream& operator<<(bsl::ostream& stream, const Crc32c& checksum)
+{
+    return checksum.print(stream);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,651 @@
+// bdlde_crc32c.t.cpp                                                 -*-C++-*-
+#include <bdlde_crc32c.h>
+
+#include <bslim_testutil.h>
+
+#include <bslx_testinstream.h>
+#include <bslx_testoutstream.h>
+
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// The component under test is a value-semantic scalar whose state is a single
+// 32-bit CRC register.  Most of the interface mirrors 'bdlde::Crc32' and
+// 'bdlde::Crc64'; the concerns specific to this component are that both
+// register-update implementations -- the SSE4.2 'crc32' instruction, where
+// available, and the slice-by-8 tables -- agree with the published check
+// values and with a bit-at-a-time oracle for every length, alignment, and
+// division of the data among calls to 'update', and that 'combine' computes
+// the checksum of concatenated datasets.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 4] static unsigned int combine(unsigned int, unsigned int, Uint64);
+// [ 5] static int maxSupportedBdexVersion(int);
+//
+// CREATORS
+// [ 1] bdlde::Crc32c();
+// [ 2] bdlde::Crc32c(const void *data, int length);
+// [ 5] bdlde::Crc32c(const bdlde::Crc32c& original);
+//
+// MANIPULATORS
+// [ 5] bdlde::Crc32c& operator=(const bdlde::Crc32c& rhs);
+// [ 5] STREAM& bdexStreamIn(STREAM& stream, int version);
+// [ 5] unsigned int checksumAndReset();
+// [ 5] void reset();
+// [ 3] void update(const void *data, int length);
+//
+// ACCESSORS
+// [ 5] STREAM& bdexStreamOut(STREAM& stream, int version) const;
+// [ 1] unsigned int checksum() const;
+// [ 5] bsl::ostream& print(bsl::ostream& stream) const;
+//
+// FREE OPERATORS
+// [ 5] bool operator==(const bdlde::Crc32c& lhs, const bdlde::Crc32c& rhs);
+// [ 5] bool operator!=(const bdlde::Crc32c& lhs, const bdlde::Crc32c& rhs);
+// [ 5] bsl::ostream& operator<<(bsl::ostream&, const bdlde::Crc32c&);
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 2] CHECK VALUES
+// [ 3] HARDWARE AND SOFTWARE UPDATE
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlde::Crc32c       Obj;
+typedef bdlde::Crc32c_Impl  Impl;
+typedef bslx::TestInStream  In;
+typedef bslx::TestOutStream Out;
+
+// ============================================================================
+//                     GLOBAL HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+unsigned int oracle(const char *data, int length)
+    // Return the CRC-32C checksum of the specified 'data' having the specified
+    // 'length', computed one bit at a time directly from the definition.
+{
+    unsigned int crc = 0xffffffff;
+    for (int i = 0; i < length; ++i) {
+        crc ^= static_cast<unsigned char>(data[i]);
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = crc & 1 ? (crc >> 1) ^ 0x82f63b78 : crc >> 1;
+        }
+    }
+    return ~crc;
+}
+
+static
+void fillBuffer(char *buffer, int length, unsigned int seed)
+    // Load into the specified 'buffer' having the specified 'length' a
+    // pseudo-random sequence of bytes determined by the specified 'seed'.
+{
+    for (int i = 0; i < length; ++i) {
+        seed = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<char>(seed >> 16);
+    }
+}
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    bool verbose = argc > 2;
+    bool veryVerbose = argc > 3;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Checksumming a Message in Parallel Chunks
+/// - - - - - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we need the CRC-32C checksum of a large message, and want to
+// compute the checksums of its parts separately (e.g., on separate threads)
+// before combining them.
+//
+// First, we prepare a message, and divide it into two parts:
+//..
+    const char *message = "The quick brown fox jumps over the lazy dog";
+    const int   length  = static_cast<int>(bsl::strlen(message));
+    const int   split   = 16;
+//..
+// Then, we compute the checksum of each part independently:
+//..
+    bdlde::Crc32c head(message, split);
+    bdlde::Crc32c tail(message + split, length - split);
+//..
+// Next, we combine the two checksums, supplying the length of the second
+// part:
+//..
+    const unsigned int crc = bdlde::Crc32c::combine(head.checksum(),
+                                                    tail.checksum(),
+                                                    length - split);
+//..
+// Finally, we verify that the result is the checksum of the whole message:
+//..
+    bdlde::Crc32c whole(message, length);
+    ASSERT(whole.checksum() == crc);
+    ASSERT(0x22620404      == crc);
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // VALUE SEMANTICS AND STREAMING
+        //
+        // Concerns:
+        //: 1 Copy construction and assignment copy the value, and equality
+        //:   compares it.
+        //:
+        //: 2 'checksumAndReset' returns the checksum and restores the default
+        //:   value, as does 'reset' (without returning it).
+        //:
+        //: 3 'print' and 'operator<<' write "0x" and 8 hexadecimal digits.
+        //:
+        //: 4 BDEX streaming round-trips the value as the 32-bit checksum,
+        //:   and an unsupported version invalidates the stream.
+        //
+        // Plan:
+        //: 1 Exercise each operation on checksums of several datasets and
+        //:   verify the results.  (C-1..4)
+        //
+        // Testing:
+        //   static int maxSupportedBdexVersion(int);
+        //   bdlde::Crc32c(const bdlde::Crc32c& original);
+        //   bdlde::Crc32c& operator=(const bdlde::Crc32c& rhs);
+        //   STREAM& bdexStreamIn(STREAM& stream, int version);
+        //   unsigned int checksumAndReset();
+        //   void reset();
+        //   STREAM& bdexStreamOut(STREAM& stream, int version) const;
+        //   bsl::ostream& print(bsl::ostream& stream) const;
+        //   bool operator==(const bdlde::Crc32c& lhs, const bdlde::Crc32c&);
+        //   bool operator!=(const bdlde::Crc32c& lhs, const bdlde::Crc32c&);
+        //   bsl::ostream& operator<<(bsl::ostream&, const bdlde::Crc32c&);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE SEMANTICS AND STREAMING" << endl
+                          << "=============================" << endl;
+
+        static const char *DATA[] = { "", "a", "123456789",
+                                      "The quick brown fox" };
+        enum { k_NUM_DATA = sizeof DATA / sizeof *DATA };
+
+        for (int i = 0; i < k_NUM_DATA; ++i) {
+            const int LEN_I = static_cast<int>(bsl::strlen(DATA[i]));
+            const Obj X(DATA[i], LEN_I);
+
+            LOOP_ASSERT(i, oracle(DATA[i], LEN_I) == X.checksum());
+
+            for (int j = 0; j < k_NUM_DATA; ++j) {
+                const int LEN_J = static_cast<int>(bsl::strlen(DATA[j]));
+                const Obj Y(DATA[j], LEN_J);
+
+                LOOP2_ASSERT(i, j, (i == j) == (X == Y));
+                LOOP2_ASSERT(i, j, (i != j) == (X != Y));
+
+                Obj mZ(Y);  const Obj& Z = mZ;
+                LOOP2_ASSERT(i, j, Y == Z);
+
+                mZ = X;
+                LOOP2_ASSERT(i, j, X == Z);
+            }
+
+            Obj mW(X);
+            LOOP_ASSERT(i, X.checksum() == mW.checksumAndReset());
+            LOOP_ASSERT(i, Obj() == mW);
+
+            mW = X;
+            mW.reset();
+            LOOP_ASSERT(i, Obj() == mW);
+
+            bsl::ostringstream expected;
+            expected << "0x" << bsl::hex;
+            expected.width(8);
+            expected.fill('0');
+            expected << X.checksum();
+
+            bsl::ostringstream printed;
+            X.print(printed);
+            LOOP_ASSERT(i, expected.str() == printed.str());
+
+            bsl::ostringstream streamed;
+            streamed << X;
+            LOOP_ASSERT(i, expected.str() == streamed.str());
+
+            const int VERSION = Obj::maxSupportedBdexVersion(20160101);
+            LOOP_ASSERT(i, 1 == VERSION);
+
+            Out out(20160101);
+            X.bdexStreamOut(out, VERSION);
+            LOOP_ASSERT(i, out);
+
+            In  in(out.data(), out.length());
+            Obj mU;  const Obj& U = mU;
+            mU.bdexStreamIn(in, VERSION);
+            LOOP_ASSERT(i, in);
+            LOOP_ASSERT(i, X == U);
+
+            In  bad(out.data(), out.length());
+            Obj mV(U);  const Obj& V = mV;
+            mV.bdexStreamIn(bad, 2);
+            LOOP_ASSERT(i, !bad);
+            LOOP_ASSERT(i, U == V);
+        }
+
+        {
+            // The checksum, rather than the register, is streamed.
+
+            const Obj X("123456789", 9);
+
+            Out out(20160101);
+            X.bdexStreamOut(out, 1);
+
+            In           in(out.data(), out.length());
+            unsigned int value;
+            in.getUint32(value);
+            ASSERT(in);
+            ASSERT(0xe3069283 == value);
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'combine'
+        //
+        // Concerns:
+        //: 1 'combine' returns the checksum of the concatenation of two
+        //:   datasets, given the checksums of each and the length of the
+        //:   second, for every split point of a dataset.
+        //:
+        //: 2 'combine' is correct for lengths that do not fit in an 'int',
+        //:   and an empty second dataset leaves the first checksum unchanged.
+        //
+        // Plan:
+        //: 1 For a range of data lengths and every split point, compare the
+        //:   combined checksums of the two parts against 'oracle' applied to
+        //:   the whole.  (C-1)
+        //:
+        //: 2 Verify that combining with an empty dataset is the identity, and
+        //:   verify the associativity of 'combine' for datasets whose
+        //:   lengths, taken together, exceed 2^32 bytes.  (C-2)
+        //
+        // Testing:
+        //   static unsigned int combine(unsigned int, unsigned int, Uint64);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'combine'" << endl
+                          << "=================" << endl;
+
+        enum { k_MAX_LEN = 96 };
+
+        char buffer[k_MAX_LEN];
+        fillBuffer(buffer, k_MAX_LEN, 4);
+
+        for (int len = 0; len <= k_MAX_LEN; ++len) {
+            const unsigned int EXP = oracle(buffer, len);
+
+            for (int split = 0; split <= len; ++split) {
+                const unsigned int A = oracle(buffer, split);
+                const unsigned int B = oracle(buffer + split, len - split);
+
+                LOOP2_ASSERT(len, split, EXP == Obj::combine(A, B,
+                                                             len - split));
+            }
+        }
+
+        const unsigned int VALUES[] = { 0, 1, 0x80, 0xffffffff,
+                                        oracle(buffer, 17),
+                                        oracle(buffer + 5, 40) };
+        enum { k_NUM_VALUES = sizeof VALUES / sizeof *VALUES };
+
+        const bsls::Types::Uint64 LENGTHS[] = { 0, 1, 7, 8, 1000, 1 << 20,
+                                                0xffffffffULL,
+                                                0x100000001ULL,
+                                                5000000000ULL };
+        enum { k_NUM_LENGTHS = sizeof LENGTHS / sizeof *LENGTHS };
+
+        for (int ai = 0; ai < k_NUM_VALUES; ++ai) {
+            const unsigned int A = VALUES[ai];
+
+            LOOP_ASSERT(ai, A == Obj::combine(A, oracle(buffer, 0), 0));
+
+            for (int bi = 0; bi < k_NUM_VALUES; ++bi) {
+                const unsigned int B = VALUES[bi];
+
+                for (int ci = 0; ci < k_NUM_VALUES; ++ci) {
+                    const unsigned int C = VALUES[ci];
+
+                    for (int li = 0; li < k_NUM_LENGTHS; ++li) {
+                        const bsls::Types::Uint64 LB = LENGTHS[li];
+                        const bsls::Types::Uint64 LC =
+                                          LENGTHS[k_NUM_LENGTHS - 1 - li];
+
+                        const unsigned int AB    = Obj::combine(A, B, LB);
+                        const unsigned int BC    = Obj::combine(B, C, LC);
+                        const unsigned int LEFT  = Obj::combine(AB, C, LC);
+                        const unsigned int RIGHT = Obj::combine(A,
+                                                                BC,
+                                                                LB + LC);
+
+                        LOOP4_ASSERT(ai, bi, ci, li, LEFT == RIGHT);
+                    }
+                }
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // HARDWARE AND SOFTWARE UPDATE
+        //
+        // Concerns:
+        //: 1 'Crc32c_Impl::updateSoftware' and, where available,
+        //:   'Crc32c_Impl::updateHardware' agree with the bit-at-a-time
+        //:   definition for every length and alignment of the data, including
+        //:   lengths at which the hardware update switches to and from its
+        //:   three-way interleaved loop.
+        //:
+        //: 2 Dividing the data among calls to 'update' does not change the
+        //:   checksum.
+        //
+        // Plan:
+        //: 1 For lengths from 0 to past 2 rounds of the interleaved loop, at
+        //:   each alignment within an 8-byte word, compare both
+        //:   implementations, and 'update', against 'oracle'.  (C-1)
+        //:
+        //: 2 Compare the checksum computed by two calls to 'update', divided
+        //:   at a range of split points, against 'oracle'.  (C-2)
+        //
+        // Testing:
+        //   void update(const void *data, int length);
+        //   HARDWARE AND SOFTWARE UPDATE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "HARDWARE AND SOFTWARE UPDATE" << endl
+                          << "============================" << endl;
+
+        const bool HARDWARE = Impl::isHardwareAccelerated();
+
+        if (verbose) { P(HARDWARE); }
+
+        enum { k_MAX_LEN = 1600 };
+
+        bsl::vector<char> buffer(k_MAX_LEN + 8);
+        fillBuffer(&buffer[0], k_MAX_LEN + 8, 3);
+
+        for (int offset = 0; offset < 8; ++offset) {
+            const char *const DATA = &buffer[offset];
+
+            for (int len = 0; len <= k_MAX_LEN; ++len) {
+                const unsigned int EXP = oracle(DATA, len);
+
+                if (veryVerbose) { T_ P_(offset) P_(len) P(EXP) }
+
+                LOOP2_ASSERT(offset, len,
+                             EXP == ~Impl::updateSoftware(0xffffffff,
+                                                          DATA,
+                                                          len));
+                if (HARDWARE) {
+                    LOOP2_ASSERT(offset, len,
+                                 EXP == ~Impl::updateHardware(0xffffffff,
+                                                              DATA,
+                                                              len));
+                }
+
+                Obj mX(DATA, len);  const Obj& X = mX;
+                LOOP2_ASSERT(offset, len, EXP == X.checksum());
+
+                for (int split = 0; split <= len; split += 1 + len / 5) {
+                    Obj mY;  const Obj& Y = mY;
+                    mY.update(DATA, split);
+                    mY.update(DATA + split, len - split);
+                    LOOP3_ASSERT(offset, len, split, EXP == Y.checksum());
+                }
+            }
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CHECK VALUES
+        //
+        // Concerns:
+        //: 1 The checksum agrees with the published CRC-32C check value and
+        //:   with the test vectors of RFC 3720, appendix B.4.
+        //
+        // Plan:
+        //: 1 Compute the checksum of each test vector with the value
+        //:   constructor and compare it against the published value.  (C-1)
+        //
+        // Testing:
+        //   bdlde::Crc32c(const void *data, int length);
+        //   CHECK VALUES
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CHECK VALUES" << endl
+                          << "============" << endl;
+
+        unsigned char zeros[32], ones[32], ascending[32], descending[32];
+        for (int i = 0; i < 32; ++i) {
+            zeros[i]      = 0;
+            ones[i]       = 0xff;
+            ascending[i]  = static_cast<unsigned char>(i);
+            descending[i] = static_cast<unsigned char>(31 - i);
+        }
+
+        ASSERT(0xe3069283 == Obj("123456789", 9).checksum());
+        ASSERT(0x8a9136aa == Obj(zeros,       32).checksum());
+        ASSERT(0x62a8ab43 == Obj(ones,        32).checksum());
+        ASSERT(0x46dd794e == Obj(ascending,   32).checksum());
+        ASSERT(0x113fdb5c == Obj(descending,  32).checksum());
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an object, update it, and verify its checksum.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == X.checksum());
+
+        mX.update("1234", 4);
+        mX.update("56789", 5);
+        ASSERT(0xe3069283 == X.checksum());
+        ASSERT(Obj("123456789", 9) == X);
+
+        mX.reset();
+        ASSERT(0 == X.checksum());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Report the throughput of both update implementations over
+        //:   buffers of several sizes.
+        //
+        // Plan:
+        //: 1 Time repeated updates of buffers from 64 bytes to 1MB, using the
+        //:   software and (where available) hardware implementation, and
+        //:   report the throughput in MB/s.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        enum { k_TOTAL = 256 * 1024 * 1024 };
+
+        const bool HARDWARE = Impl::isHardwareAccelerated();
+
+        bsl::vector<char> buffer(1024 * 1024);
+        fillBuffer(&buffer[0], static_cast<int>(buffer.size()), 5);
+
+        for (int size = 64; size <= 1024 * 1024; size *= 16) {
+            const int    ITERATIONS = k_TOTAL / size;
+            const double MB         = static_cast<double>(k_TOTAL)
+                                                             / (1024 * 1024);
+
+            unsigned int crc = 0;
+
+            bsls::Stopwatch timer;
+            timer.start();
+            for (int i = 0; i < ITERATIONS; ++i) {
+                crc = Impl::updateSoftware(crc, &buffer[0], size);
+            }
+            timer.stop();
+
+            cout << "size " << size << ": software "
+                 << MB / timer.accumulatedWallTime() << " MB/s";
+
+            if (HARDWARE) {
+                unsigned int hwCrc = 0;
+
+                timer.reset();
+                timer.start();
+                for (int i = 0; i < ITERATIONS; ++i) {
+                    hwCrc = Impl::updateHardware(hwCrc, &buffer[0], size);
+                }
+                timer.stop();
+
+                ASSERT(crc == hwCrc);
+
+                cout << ", hardware " << MB / timer.accumulatedWallTime()
+                     << " MB/s";
+            }
+            cout << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
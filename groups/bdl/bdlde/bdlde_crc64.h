@@ -24,6 +24,11 @@ BSLS_IDENT("$Id: $")
 // SHA-256, it is relatively easy to find alternate texts with identical
 // checksum.
 //
+// The class method 'combine' computes the checksum of the concatenation of two
+// datasets from the checksums of each and the length of the second, so that
+// the checksums of chunks of a large dataset can be computed independently
+// (e.g., by separate threads) and then combined.
+//
 ///Usage
 ///-----
 // The following snippets of code illustrate a typical use of the
@@ -87,6 +92,10 @@ BSLS_IDENT("$Id: $")
 #include <bsls_assert.h>
 #endif
 
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
 #ifndef INCLUDED_BSL_IOSFWD
 #include <bsl_iosfwd.h>
 #endif
@@ -122,6 +131,17 @@ class Crc64 {
 
   public:
     // CLASS METHODS
+    static bsls::Types::Uint64 combine(bsls::Types::Uint64 checksumA,
+                                       bsls::Types::Uint64 checksumB,
+                                       bsls::Types::Uint64 lengthB);
+        // Return the CRC-64 checksum of the concatenation of two datasets 'A'
+        // and 'B', where the specified 'checksumA' is the checksum of 'A',
+        // the specified 'checksumB' is the checksum of 'B', and the specified
+        // 'lengthB' is the length of 'B' (in bytes).  Note that this allows
+        // the checksums of consecutive chunks of a dataset to be computed
+        // independently (e.g., in parallel) and then combined; the time taken
+        // is logarithmic in 'lengthB'.
+
     static int maxSupportedBdexVersion(int versionSelector);
         // Return the maximum valid BDEX format version, as indicated by the
         // specified 'versionSelector', to be passed to the 'bdexStreamOut'
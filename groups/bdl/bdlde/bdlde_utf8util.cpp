@@ -12,14 +12,26 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlde_utf8util_cpp,"$Id$ $CSID$")
 
+#include <bdlb_bitutil.h>
+
 #include <bsls_assert.h>
 #include <bsls_performancehint.h>
+#include <bsls_platform.h>
 #include <bsls_types.h>
 
+#include <bsl_cstdint.h>
+#include <bsl_cstring.h>
+
 // LOCAL MACROS
 
 #define UNLIKELY(EXPRESSION) BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(EXPRESSION)
 
+#if defined(BSLS_PLATFORM_CPU_X86_64)                                         \
+ || (defined(BSLS_PLATFORM_CPU_X86) && defined(__SSE2__))
+#define BDLDE_UTF8UTIL_SSE2 1
+#include <emmintrin.h>
+#endif
+
 // LOCAL CONSTANTS
 
 namespace {
@@ -37,6 +49,11 @@ enum {
                                    // the 6 bits of value info
 };
 
+const bsl::size_t k_UNBOUNDED = ~static_cast<bsl::size_t>(0);
+                                   // 'maxLength' for an ASCII scan of a
+                                   // null-terminated string that stops only
+                                   // at a non-ASCII byte or the '\0'
+
 }  // close unnamed namespace
 
 // STATIC HELPER FUNCTIONS
@@ -92,6 +109,93 @@ int get4ByteValue(const char *pc)
                                |  (pc[3] & k_CONT_VALUE_MASK);
 }
 
+static inline
+bool isAsciiNotNull(char value)
+    // Return 'true' if the specified 'value' is a 7-bit ASCII character other
+    // than '\0', and 'false' otherwise.
+{
+    return static_cast<unsigned char>(value - 1) < 0x7f;
+}
+
+static
+const char *findNonAscii(const char *string, const char *end)
+    // Return the address of the first byte in the specified range
+    // '[string, end)' that is not a 7-bit ASCII character, or 'end' if every
+    // byte in the range is ASCII.  Note that '\0' is treated as ASCII.
+{
+#ifdef BDLDE_UTF8UTIL_SSE2
+    while (end - string >= 16) {
+        const int mask = _mm_movemask_epi8(
+                   _mm_loadu_si128(reinterpret_cast<const __m128i *>(string)));
+        if (mask) {
+            return string                                             // RETURN
+                 + BloombergLP::bdlb::BitUtil::numTrailingUnsetBits(
+                                            static_cast<bsl::uint32_t>(mask));
+        }
+        string += 16;
+    }
+#else
+    while (end - string >= 8) {
+        bsl::uint64_t word;
+        bsl::memcpy(&word, string, sizeof word);
+        if (word & 0x8080808080808080ULL) {
+            break;
+        }
+        string += 8;
+    }
+#endif
+
+    while (string < end && !(*string & 0x80)) {
+        ++string;
+    }
+    return string;
+}
+
+static
+const char *findNonAsciiOrNull(const char *string, bsl::size_t maxLength)
+    // Return the address of the first byte, among at most the specified
+    // 'maxLength' bytes starting at the specified 'string', that is either
+    // '\0' or not a 7-bit ASCII character, or 'string + maxLength' if there is
+    // no such byte.  The behavior is undefined unless 'string' is
+    // null-terminated or refers to at least 'maxLength' readable bytes.
+{
+#ifdef BDLDE_UTF8UTIL_SSE2
+    // Step to a 16-byte boundary first: an aligned 16-byte load never
+    // straddles a page, so the vector loop below can never fault by reading
+    // past the terminating '\0'.
+
+    while (reinterpret_cast<BloombergLP::bsls::Types::UintPtr>(string) & 15) {
+        if (0 == maxLength || !isAsciiNotNull(*string)) {
+            return string;                                            // RETURN
+        }
+        ++string;
+        --maxLength;
+    }
+
+    const __m128i zero = _mm_setzero_si128();
+
+    while (maxLength >= 16) {
+        const __m128i chunk =
+                     _mm_load_si128(reinterpret_cast<const __m128i *>(string));
+        const int     mask  = _mm_movemask_epi8(chunk)
+                            | _mm_movemask_epi8(_mm_cmpeq_epi8(chunk, zero));
+        if (mask) {
+            return string                                             // RETURN
+                 + BloombergLP::bdlb::BitUtil::numTrailingUnsetBits(
+                                            static_cast<bsl::uint32_t>(mask));
+        }
+        string    += 16;
+        maxLength -= 16;
+    }
+#endif
+
+    while (maxLength && isAsciiNotNull(*string)) {
+        ++string;
+        --maxLength;
+    }
+    return string;
+}
+
 static
 int validateAndCountCodePoints(const char **invalidString, const char *string)
     // Return the number of Unicode code points in the specified 'string' if it
@@ -126,7 +230,13 @@ int validateAndCountCodePoints(const char **invalidString, const char *string)
 
                 return count;                                         // RETURN
             }
-            ++string;
+
+            // Consume the whole run of ASCII that starts here; the '++count'
+            // below accounts for its first character.
+
+            const char *runEnd = findNonAsciiOrNull(string + 1, k_UNBOUNDED);
+            count  += static_cast<int>(runEnd - string) - 1;
+            string  = runEnd;
           } break;
           case 0xc:
           case 0xd: {
@@ -229,7 +339,12 @@ int validateAndCountCodePoints(
           case 5:
           case 6:
           case 7: {
-            ++pc;
+            // Consume the whole run of ASCII that starts here; the '++count'
+            // below accounts for its first character.
+
+            const char *runEnd = findNonAscii(pc + 1, string + length);
+            count += static_cast<int>(runEnd - pc) - 1;
+            pc     = runEnd;
           } break;
           case 0xc:
           case 0xd: {
@@ -411,7 +526,7 @@ int Utf8Util::advanceIfValid(int         *status,
                 *status = 0;
                 break;
             }
-          } continue;
+          }  // FALL THROUGH
 
           case 1:
           case 2:
@@ -420,8 +535,14 @@ int Utf8Util::advanceIfValid(int         *status,
           case 5:
           case 6:
           case 7: {
-            // binary: 0xxxxxxx: ASCII, but definitely not '\0'
-
+            // binary: 0xxxxxxx: ASCII, but definitely not '\0'.  Consume the
+            // run of ASCII that starts here, up to the remaining code point
+            // budget.
+
+            const char *runEnd = findNonAsciiOrNull(next,
+                                                    numCodePoints - ret - 1);
+            ret  += static_cast<int>(runEnd - next);
+            next  = runEnd;
           } continue;
 
           case 8:
@@ -605,8 +726,16 @@ int Utf8Util::advanceIfValid(int          *status,
           case 5:
           case 6:
           case 7: {
-            // binary: 0xxxxxxx: ASCII and possible '\0'
-
+            // binary: 0xxxxxxx: ASCII and possible '\0'.  Consume the run of
+            // ASCII that starts here, up to the remaining code point budget.
+
+            const int   budget = numCodePoints - ret - 1;
+            const char *runEnd = findNonAscii(next,
+                                              endOfInput - next <= budget
+                                              ? endOfInput
+                                              : next + budget);
+            ret  += static_cast<int>(runEnd - next);
+            next  = runEnd;
           } continue;
 
           case 8:
@@ -774,9 +903,7 @@ int Utf8Util::advanceRaw(const char **result,
 
                 break;
             }
-
-            ++string;
-          } continue;
+          }  // FALL THROUGH
 
           case 1:
           case 2:
@@ -785,9 +912,14 @@ int Utf8Util::advanceRaw(const char **result,
           case 5:
           case 6:
           case 7: {
-            // binary: 0xxxxxxx: ASCII (definitely not '\0')
-
-            ++string;
+            // binary: 0xxxxxxx: ASCII (definitely not '\0').  Consume the run
+            // of ASCII that starts here, up to the remaining code point
+            // budget.
+
+            const char *runEnd = findNonAsciiOrNull(string + 1,
+                                                    numCodePoints - ret - 1);
+            ret    += static_cast<int>(runEnd - string) - 1;
+            string  = runEnd;
           } continue;
 
           case 8:
@@ -876,9 +1008,16 @@ int Utf8Util::advanceRaw(const char  **result,
           case 5:
           case 6:
           case 7: {
-            // binary: 0xxxxxxx: ASCII, possibly '\0'
-
-            ++string;
+            // binary: 0xxxxxxx: ASCII, possibly '\0'.  Consume the run of
+            // ASCII that starts here, up to the remaining code point budget.
+
+            const int   budget = numCodePoints - ret - 1;
+            const char *runEnd = findNonAscii(string + 1,
+                                              endOfInput - string - 1 <= budget
+                                              ? endOfInput
+                                              : string + 1 + budget);
+            ret    += static_cast<int>(runEnd - string) - 1;
+            string  = runEnd;
           } continue;
 
           case 8:
@@ -983,7 +1122,10 @@ int Utf8Util::numCodePointsRaw(const char *string)
             if (!*string) {
                 return count;                                         // RETURN
             }
-            ++string;
+
+            const char *runEnd = findNonAsciiOrNull(string + 1, k_UNBOUNDED);
+            count  += static_cast<int>(runEnd - string) - 1;
+            string  = runEnd;
           } break;
           case 0xc:
           case 0xd: {
@@ -1022,7 +1164,9 @@ int Utf8Util::numCodePointsRaw(const char *string, bsl::size_t length)
           case 5:
           case 6:
           case 7: {
-            ++string;
+            const char *runEnd = findNonAscii(string + 1, end);
+            count  += static_cast<int>(runEnd - string) - 1;
+            string  = runEnd;
           } break;
           case 0xc:
           case 0xd: {
@@ -11,6 +11,7 @@
 
 #include <bdlb_random.h>
 
+#include <bsls_stopwatch.h>
 #include <bsls_types.h>
 
 #include <bsl_iostream.h>
@@ -72,11 +73,14 @@ using bsl::size_t;
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [ 2] TABLE-DRIVEN ENCODING / DECODING / VALIDATION TEST
-// [10] USAGE EXAMPLE
+// [11] USAGE EXAMPLE 1
+// [12] USAGE EXAMPLE 2
+// [10] ASCII FAST PATH
 // [ 9] Testing: 'advanceIfValid' on correct input followed by incorrect input
 // [ 8] Testing: all 'advance*' on machine-generated correct input
 // [-1] random number generator
 // [-2] 'utf8Encode', 'decode'
+// [-3] PERFORMANCE: ASCII-HEAVY, MIXED AND CJK CORPORA
 
 // ============================================================================
 //                      STANDARD BDE ASSERT TEST MACROS
@@ -2457,6 +2461,76 @@ bsl::string clone(const char *pc, int length)
     return ret;
 }
 
+static
+int refSequenceLength(const char *pc, size_t available, bool checkMax)
+    // Return the length of the valid UTF-8 sequence at the specified 'pc',
+    // using at most the specified 'available' bytes, or 0 if the bytes at
+    // 'pc' do not begin a valid sequence.  If the specified 'checkMax' is
+    // 'false', accept 4-octet sequences encoding values above 0x10ffff.  This
+    // is a deliberately naive, byte-at-a-time oracle for the optimized
+    // routines under test.
+{
+    const unsigned char *upc = reinterpret_cast<const unsigned char *>(pc);
+
+    int len;
+    int value;
+    int min;
+    if      (upc[0] < 0x80) { return 1; }                             // RETURN
+    else if (upc[0] < 0xc0) { return 0; }                             // RETURN
+    else if (upc[0] < 0xe0) { len = 2; value = upc[0] & 0x1f; min = 0x80; }
+    else if (upc[0] < 0xf0) { len = 3; value = upc[0] & 0x0f; min = 0x800; }
+    else if (upc[0] < 0xf8) { len = 4; value = upc[0] & 0x07; min = 0x10000;}
+    else                    { return 0; }                             // RETURN
+
+    if (available < static_cast<size_t>(len)) {
+        return 0;                                                     // RETURN
+    }
+    for (int i = 1; i < len; ++i) {
+        if (0x80 != (upc[i] & 0xc0)) {
+            return 0;                                                 // RETURN
+        }
+        value = (value << 6) | (upc[i] & 0x3f);
+    }
+
+    return value < min || (checkMax && value > 0x10ffff)
+        || (value >= 0xd800 && value <= 0xdfff) ? 0 : len;
+}
+
+static
+int refAdvance(int         *status,
+               size_t      *offset,
+               const char  *string,
+               size_t       length,
+               int          numCodePoints,
+               bool         checkMax = true)
+    // Advance over at most the specified 'numCodePoints' code points of the
+    // specified 'string' having the specified 'length', stopping at the first
+    // invalid sequence.  Load the number of bytes advanced into the specified
+    // 'offset', load 0 into the specified 'status' on success and -1 if an
+    // invalid sequence was found, and return the number of code points
+    // advanced.  Optionally specify 'checkMax'; if 'false', accept 4-octet
+    // sequences encoding values above 0x10ffff, as 'advanceIfValid' does.
+{
+    size_t pos = 0;
+    int    ret = 0;
+
+    *status = 0;
+    while (pos < length && ret < numCodePoints) {
+        const int len = refSequenceLength(string + pos,
+                                          length - pos,
+                                          checkMax);
+        if (0 == len) {
+            *status = -1;
+            break;
+        }
+        pos += len;
+        ++ret;
+    }
+
+    *offset = pos;
+    return ret;
+}
+
 // Some useful multi-octet code points:
 
     // The 2 lowest 2-octet code points.
@@ -2835,7 +2909,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 11: {
+      case 12: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 2: 'advance'.
         //
@@ -2947,7 +3021,7 @@ int main(int argc, char *argv[])
     ASSERT(static_cast<int>(string.length()) == result - start);
 //..
       } break;
-      case 10: {
+      case 11: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE 1: 'isValid' and 'numCodePoints*'
         //
@@ -3045,6 +3119,181 @@ int main(int argc, char *argv[])
     ASSERT(false == bdlde::Utf8Util::isValid(stringWithOverlong.c_str()));
 //..
       } break;
+      case 10: {
+        // --------------------------------------------------------------------
+        // ASCII FAST PATH
+        //
+        // Concerns:
+        //: 1 Runs of ASCII are consumed several octets at a time, yet the
+        //:   results and reported error positions are the same as for
+        //:   octet-at-a-time processing, wherever the run begins or ends
+        //:   relative to a block or to the alignment of the buffer.
+        //:
+        //: 2 A '\0' in the middle of a block ends a null-terminated string,
+        //:   and octets following it are ignored.
+        //:
+        //: 3 The 'numCodePoints' budget of the 'advance*' functions stops a
+        //:   run of ASCII in the middle of a block.
+        //
+        // Plan:
+        //: 1 Generate strings of random length with varying proportions of
+        //:   multi-octet code points, and corrupt a random octet (possibly
+        //:   with '\0') in two thirds of them.  Copy each string to every
+        //:   offset from a 16-byte boundary in a buffer filled with ASCII.
+        //:
+        //: 2 Compare 'isValid', 'numCodePointsIfValid', and 'advanceIfValid'
+        //:   with a range of budgets, and on valid input also
+        //:   'numCodePointsRaw' and 'advanceRaw', against the naive oracle
+        //:   'refAdvance', for both the null-terminated and the
+        //:   length-bounded overloads.  (C-1..3)
+        //
+        // Testing:
+        //   ASCII FAST PATH
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "ASCII FAST PATH\n"
+                             "===============\n";
+
+        enum { k_MAX_LEN = 80, k_NUM_OFFSETS = 16, k_NUM_STRINGS = 3000 };
+
+        static const unsigned char CORRUPTIONS[] = {
+            0x00, 0x7f, 0x80, 0xbf, 0xc0, 0xc1, 0xc2, 0xdf, 0xe0, 0xed, 0xef,
+            0xf0, 0xf4, 0xf5, 0xf8, 0xff };
+        enum { k_NUM_CORRUPTIONS = sizeof CORRUPTIONS / sizeof *CORRUPTIONS };
+
+        char        buffer[k_MAX_LEN + k_NUM_OFFSETS + 32];
+        const int   SKEW    = static_cast<int>(
+                         reinterpret_cast<bsls::Types::UintPtr>(buffer) % 16);
+        char *const aligned = buffer + (16 - SKEW) % 16;
+
+        for (int ti = 0; ti < k_NUM_STRINGS; ++ti) {
+            const size_t TARGET_LEN = randUnsigned() % k_MAX_LEN;
+            const int    DENSITY    = ti % 4;   // 0, 1/4, 1/2, or 3/4 of the
+                                                // code points are multi-octet
+
+            bsl::string str;
+            while (str.length() < TARGET_LEN) {
+                const unsigned r = randUnsigned() % 16;
+                if (r >= static_cast<unsigned>(DENSITY) * 4) {
+                    appendRand1Byte(&str);
+                }
+                else {
+                    switch (r % 3) {
+                      case 0: {
+                        appendRand2Byte(&str);
+                      } break;
+                      case 1: {
+                        appendRand3Byte(&str);
+                      } break;
+                      default: {
+                        appendRand4Byte(&str);
+                      }
+                    }
+                }
+            }
+            if (ti % 3 && !str.empty()) {
+                const unsigned r = randUnsigned();
+                const unsigned char c =
+                                    CORRUPTIONS[(r >> 8) % k_NUM_CORRUPTIONS];
+                str[r % str.length()] = static_cast<char>(c);
+            }
+
+            const size_t LEN = str.length();
+
+            for (int offset = 0; offset < k_NUM_OFFSETS; ++offset) {
+                bsl::memset(buffer, 'x', sizeof buffer);
+                char *const S = aligned + offset;
+                bsl::memcpy(S, str.data(), LEN);
+                S[LEN] = '\0';
+
+                const size_t ZLEN = bsl::strlen(S);
+
+                int          expSts, expZSts;
+                size_t       expOff, expZOff;
+                const int    EXP_N  = refAdvance(&expSts,  &expOff,  S, LEN,
+                                                 INT_MAX);
+                const int    EXP_ZN = refAdvance(&expZSts, &expZOff, S, ZLEN,
+                                                 INT_MAX);
+                const bool   VALID  = 0 == expSts;
+                const bool   ZVALID = 0 == expZSts;
+
+                if (veryVeryVerbose) {
+                    P_(ti);    P_(offset);    P_(LEN);    P(VALID);
+                }
+
+                const char *err = 0;
+
+                LOOP2_ASSERT(ti, offset, VALID == Obj::isValid(&err, S, LEN));
+                LOOP2_ASSERT(ti, offset, VALID || S + expOff == err);
+                LOOP2_ASSERT(ti, offset, ZVALID == Obj::isValid(&err, S));
+                LOOP2_ASSERT(ti, offset, ZVALID || S + expZOff == err);
+
+                err = 0;
+                int n = Obj::numCodePointsIfValid(&err, S, LEN);
+                LOOP2_ASSERT(ti, offset, VALID ? EXP_N == n : n < 0);
+                LOOP2_ASSERT(ti, offset, VALID ? 0 == err : S + expOff == err);
+
+                err = 0;
+                n = Obj::numCodePointsIfValid(&err, S);
+                LOOP2_ASSERT(ti, offset, ZVALID ? EXP_ZN == n : n < 0);
+                LOOP2_ASSERT(ti, offset,
+                                      ZVALID ? 0 == err : S + expZOff == err);
+
+                if (VALID) {
+                    LOOP2_ASSERT(ti, offset,
+                                     EXP_N == Obj::numCodePointsRaw(S, LEN));
+                }
+                if (ZVALID) {
+                    LOOP2_ASSERT(ti, offset,
+                                         EXP_ZN == Obj::numCodePointsRaw(S));
+                }
+
+                const int BUDGETS[] = { 0, 1, 2, 7, 15, 16, 17, EXP_N / 2,
+                                        EXP_N - 1, EXP_N, EXP_N + 1, INT_MAX,
+                                        static_cast<int>(randUnsigned() % 64)};
+                enum { k_NUM_BUDGETS = sizeof BUDGETS / sizeof *BUDGETS };
+
+                for (int bi = 0; bi < k_NUM_BUDGETS; ++bi) {
+                    const int NUM = bsl::max(BUDGETS[bi], 0);
+
+                    int         sts, expBSts;
+                    size_t      expBOff;
+                    const char *res = 0;
+
+                    int expRet = refAdvance(&expBSts, &expBOff, S, LEN, NUM,
+                                            false);
+                    int ret    = Obj::advanceIfValid(&sts, &res, S, LEN, NUM);
+                    LOOP3_ASSERT(ti, offset, NUM, expRet == ret);
+                    LOOP3_ASSERT(ti, offset, NUM,
+                                               (0 == expBSts) == (0 == sts));
+                    LOOP3_ASSERT(ti, offset, NUM, S + expBOff == res);
+
+                    if (VALID) {
+                        res = 0;
+                        ret = Obj::advanceRaw(&res, S, LEN, NUM);
+                        LOOP3_ASSERT(ti, offset, NUM, expRet == ret);
+                        LOOP3_ASSERT(ti, offset, NUM, S + expBOff == res);
+                    }
+
+                    res    = 0;
+                    expRet = refAdvance(&expBSts, &expBOff, S, ZLEN, NUM,
+                                        false);
+                    ret    = Obj::advanceIfValid(&sts, &res, S, NUM);
+                    LOOP3_ASSERT(ti, offset, NUM, expRet == ret);
+                    LOOP3_ASSERT(ti, offset, NUM,
+                                               (0 == expBSts) == (0 == sts));
+                    LOOP3_ASSERT(ti, offset, NUM, S + expBOff == res);
+
+                    if (ZVALID) {
+                        res = 0;
+                        ret = Obj::advanceRaw(&res, S, NUM);
+                        LOOP3_ASSERT(ti, offset, NUM, expRet == ret);
+                        LOOP3_ASSERT(ti, offset, NUM, S + expBOff == res);
+                    }
+                }
+            }
+        }
+      } break;
       case 9: {
         // --------------------------------------------------------------------
         // TESTING CORRECT + BROKEN GLASS
@@ -4910,6 +5159,112 @@ int main(int argc, char *argv[])
             ASSERT(bsl::strlen(str.c_str()) == str.length());
         }
       } break;
+      case -3: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ASCII-HEAVY, MIXED AND CJK CORPORA
+        //
+        // Concerns:
+        //: 1 The ASCII fast path speeds up ASCII-heavy input substantially and
+        //:   does not slow down input with few or no runs of ASCII.
+        //
+        // Plan:
+        //: 1 Build three corpora of about 1MB each: ASCII-heavy (JSON-like
+        //:   records with an occasional 2-octet code point), mixed (code
+        //:   points of all four encoded lengths in equal proportion), and CJK
+        //:   (3-octet code points with an ASCII space after every tenth).
+        //:
+        //: 2 Time the validating functions over each corpus, with the naive
+        //:   octet-at-a-time oracle 'refAdvance' as a baseline, and report
+        //:   the throughput in MB/s.
+        //
+        // Testing:
+        //   PERFORMANCE: ASCII-HEAVY, MIXED AND CJK CORPORA
+        // --------------------------------------------------------------------
+
+        if (verbose) cout <<
+                           "PERFORMANCE: ASCII-HEAVY, MIXED AND CJK CORPORA\n"
+                           "===============================================\n";
+
+        enum { k_CORPUS_SIZE = 1024 * 1024, k_NUM_ITERATIONS = 20 };
+
+        bsl::string corpora[3];
+        const char *NAMES[3] = { "ASCII-heavy", "mixed", "CJK" };
+
+        while (corpora[0].length() < k_CORPUS_SIZE) {
+            corpora[0] += "{\"name\":\"Jos\xc3\xa9\",\"id\":123456,"
+                          "\"px\":101.25,\"side\":\"BUY\",\"venue\":\"XNYS\","
+                          "\"comment\":\"no fill before the close\"},\n";
+        }
+        while (corpora[1].length() < k_CORPUS_SIZE) {
+            appendRandCorrectCodePoint(&corpora[1], false);
+        }
+        for (int i = 0; corpora[2].length() < k_CORPUS_SIZE; ++i) {
+            corpora[2] += utf8Encode(0x4e00 + randUnsigned() % 0x5000);
+            if (9 == i % 10) {
+                corpora[2] += ' ';
+            }
+        }
+
+        for (int ci = 0; ci < 3; ++ci) {
+            const bsl::string& CORPUS = corpora[ci];
+            const char        *S      = CORPUS.c_str();
+            const size_t       LEN    = CORPUS.length();
+            const double       MB     = static_cast<double>(LEN)
+                                      * k_NUM_ITERATIONS / (1024 * 1024);
+
+            ASSERT(Obj::isValid(S, LEN));
+
+            cout << NAMES[ci] << " (" << LEN << " bytes)\n";
+
+            for (int fi = 0; fi < 6; ++fi) {
+                const char *NAME  = 0;
+                const char *err   = 0;
+                int         total = 0;
+                int         status;
+                size_t      offset;
+
+                bsls::Stopwatch timer;
+                timer.start();
+                for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+                    switch (fi) {
+                      case 0: {
+                        NAME   = "oracle             ";
+                        total += refAdvance(&status, &offset, S, LEN,
+                                            INT_MAX);
+                      } break;
+                      case 1: {
+                        NAME   = "isValid(len)       ";
+                        total += Obj::isValid(&err, S, LEN);
+                      } break;
+                      case 2: {
+                        NAME   = "isValid(nul)       ";
+                        total += Obj::isValid(&err, S);
+                      } break;
+                      case 3: {
+                        NAME   = "numCodePoints(len) ";
+                        total += Obj::numCodePointsIfValid(&err, S, LEN);
+                      } break;
+                      case 4: {
+                        NAME   = "advanceIfValid(len)";
+                        total += Obj::advanceIfValid(&status, &err, S, LEN,
+                                                     INT_MAX);
+                      } break;
+                      default: {
+                        NAME   = "advanceIfValid(nul)";
+                        total += Obj::advanceIfValid(&status, &err, S,
+                                                     INT_MAX);
+                      }
+                    }
+                }
+                timer.stop();
+
+                ASSERT(0 < total);
+
+                cout << "    " << NAME << ": "
+                     << MB / timer.accumulatedWallTime() << " MB/s\n";
+            }
+        }
+      } break;
       default: {
         cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
         testStatus = -1;
@@ -0,0 +1,442 @@
+// bdlma_hugepageallocator.cpp                                        -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_hugepageallocator_cpp,"$Id$ $CSID$")
+
+#include <bslmf_assert.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_assert.h>
+#include <bsls_atomic.h>
+#include <bsls_exceptionutil.h>      // 'BSLS_THROW'
+#include <bsls_performancehint.h>
+#include <bsls_platform.h>
+#include <bsls_types.h>
+
+#include <bsl_cstddef.h>             // 'bsl::size_t'
+#include <bsl_new.h>                 // 'bsl::bad_alloc'
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+#include <windows.h>   // 'GetSystemInfo', 'VirtualAlloc',
+                       // 'VirtualAllocExNuma', 'VirtualFree'
+#else
+
+#include <stdio.h>     // 'fopen', 'fscanf', 'fclose'
+#include <sys/mman.h>  // 'madvise', 'mmap', 'munmap'
+#include <unistd.h>    // 'sysconf', 'syscall'
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+#include <sys/syscall.h>  // 'SYS_mbind'
+#endif
+
+#endif
+
+namespace BloombergLP {
+namespace {
+
+typedef bsls::Types::size_type size_type;
+
+union Header {
+    // This 'union' defines the header preceding each block returned by
+    // 'HugePageAllocator::allocate', which starts the mapping holding the
+    // block.
+
+    size_type                           d_mappingSize;  // size (in bytes) of
+                                                        // the mapping
+
+    bsls::AlignmentUtil::MaxAlignedType d_dummy;        // force alignment
+};
+
+// Define the offset (in bytes) from the start of a mapping to the address
+// returned to the user.
+
+static const size_type OFFSET = sizeof(Header);
+
+BSLMF_ASSERT(OFFSET == bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT);
+
+// Define the huge page size used if the system does not report one.
+
+static const size_type DEFAULT_HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+// HELPER FUNCTIONS
+
+size_type roundUp(size_type size, size_type alignment)
+    // Return the specified 'size' rounded up to a multiple of the specified
+    // 'alignment'.  The behavior is undefined unless 'alignment' is a power of
+    // 2.
+{
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+size_type getSystemPageSize()
+    // Return the size (in bytes) of a system memory page.
+{
+    static bsls::AtomicInt pageSize(0);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == pageSize.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        pageSize = static_cast<int>(info.dwPageSize);
+
+#else
+
+        pageSize = static_cast<int>(sysconf(_SC_PAGESIZE));
+
+#endif
+    }
+
+    return pageSize.loadRelaxed();
+}
+
+size_type getSystemHugePageSize()
+    // Return the size (in bytes) of a huge page as reported by the system, or
+    // 'DEFAULT_HUGE_PAGE_SIZE' if the system does not report one.
+{
+    static bsls::AtomicInt64 hugePageSize(0);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                                          0 == hugePageSize.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        size_type size = DEFAULT_HUGE_PAGE_SIZE;
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+        FILE *file = fopen(
+                        "/sys/kernel/mm/transparent_hugepage/hpage_pmd_size",
+                        "r");
+        if (file) {
+            unsigned long value = 0;
+
+            // Accept only a power of 2 larger than a regular page.
+
+            if (1 == fscanf(file, "%lu", &value)
+             && value > getSystemPageSize()
+             && 0 == (value & (value - 1))) {
+                size = value;
+            }
+            fclose(file);
+        }
+
+#endif
+
+        hugePageSize = static_cast<bsls::Types::Int64>(size);
+    }
+
+    return static_cast<size_type>(hugePageSize.loadRelaxed());
+}
+
+void *systemAlloc(size_type size, int numaNode)
+    // Allocate a page-aligned block of memory of the specified 'size' (in
+    // bytes), having its pages allocated from the specified 'numaNode' if the
+    // system supports it at allocation, and return the address of the
+    // allocated block, or 0 if the allocation fails.  The behavior is
+    // undefined unless 'size > 0'.
+{
+    BSLS_ASSERT(size > 0);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    if (bdlma::HugePageAllocator::k_ANY_NODE != numaNode) {
+        void *address = VirtualAllocExNuma(GetCurrentProcess(),
+                                           0,
+                                           size,
+                                           MEM_COMMIT | MEM_RESERVE,
+                                           PAGE_READWRITE,
+                                           static_cast<DWORD>(numaNode));
+        if (address) {
+            return address;                                           // RETURN
+        }
+    }
+
+    return VirtualAlloc(0, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+                                                                      // RETURN
+
+#else
+
+    (void)numaNode;
+
+    void *address = mmap(0,
+                         size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_ANON | MAP_PRIVATE,
+                         -1,
+                         0);
+
+    if (MAP_FAILED == address) {
+        return 0;                                                     // RETURN
+    }
+
+    return address;
+
+#endif
+}
+
+void systemFree(void *address, size_type size)
+    // Return the memory block at the specified 'address' having the specified
+    // 'size' (in bytes) back to the system.  The behavior is undefined unless
+    // 'address' and 'size' describe a mapping obtained from the system by
+    // this component.
+{
+    BSLS_ASSERT(address);
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+
+    VirtualFree(address, 0, MEM_RELEASE);
+    (void)size;
+
+#else
+
+    // On some of our platforms, 'munmap' takes a 'char*' argument, while on
+    // others it takes a 'void*'.  Casting to 'char*', which will work in both
+    // cases.
+
+    munmap(static_cast<char *>(address), size);
+
+#endif
+}
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+void *systemAllocExplicitHugePages(size_type size)
+    // Allocate a block of memory of the specified 'size' (in bytes) from the
+    // huge pages reserved by the system, and return the address of the
+    // allocated block, or 0 if the allocation fails.  The behavior is
+    // undefined unless 'size' is a multiple of 'getSystemHugePageSize()'.
+{
+#ifdef MAP_HUGETLB
+
+    void *address = mmap(0,
+                         size,
+                         PROT_READ | PROT_WRITE,
+                         MAP_ANON | MAP_PRIVATE | MAP_HUGETLB,
+                         -1,
+                         0);
+
+    if (MAP_FAILED == address) {
+        return 0;                                                     // RETURN
+    }
+
+    return address;
+
+#else
+
+    (void)size;
+    return 0;
+
+#endif
+}
+
+void *systemAllocTransparentHugePages(size_type size, size_type hugePageSize)
+    // Allocate a block of memory of the specified 'size' (in bytes) at an
+    // address aligned to the specified 'hugePageSize', advise the system to
+    // back it with transparent huge pages, and return the address of the
+    // allocated block, or 0 if the allocation fails.  The behavior is
+    // undefined unless 'size' is a multiple of 'getSystemPageSize()', and
+    // 'hugePageSize' is a power of 2 multiple of 'getSystemPageSize()'.
+{
+    // Over-allocate so that the mapping contains an aligned block of 'size'
+    // bytes, then return the unaligned head and the unused tail to the
+    // system.
+
+    const size_type mappingSize = size + hugePageSize - getSystemPageSize();
+
+    char *mapping = static_cast<char *>(systemAlloc(
+                                       mappingSize,
+                                       bdlma::HugePageAllocator::k_ANY_NODE));
+    if (!mapping) {
+        return 0;                                                     // RETURN
+    }
+
+    const size_type headSize = roundUp(reinterpret_cast<size_type>(mapping),
+                                       hugePageSize)
+                             - reinterpret_cast<size_type>(mapping);
+    const size_type tailSize = mappingSize - headSize - size;
+
+    char *address = mapping + headSize;
+
+    if (headSize) {
+        systemFree(mapping, headSize);
+    }
+    if (tailSize) {
+        systemFree(address + size, tailSize);
+    }
+
+#ifdef MADV_HUGEPAGE
+
+    // Failure is benign: the block is then backed by regular pages.
+
+    madvise(address, size, MADV_HUGEPAGE);
+
+#endif
+
+    return address;
+}
+
+void bindToNumaNode(void *address, size_type size, int numaNode)
+    // Bind the memory pages of the block at the specified 'address' having
+    // the specified 'size' (in bytes) to the specified 'numaNode', if the
+    // system supports it.  The behavior is undefined unless the block is
+    // page-aligned and none of its pages has been accessed.
+{
+#ifdef SYS_mbind
+
+    // 'mbind' is invoked directly, so as not to depend on 'libnuma'.
+
+    enum {
+        k_MPOL_BIND      = 2,  // 'MPOL_BIND' from '<linux/mempolicy.h>'
+        k_MAX_NODES      = 1024,
+        k_BITS_PER_WORD  = sizeof(unsigned long) * 8
+    };
+
+    if (numaNode >= k_MAX_NODES) {
+        return;                                                       // RETURN
+    }
+
+    unsigned long nodeMask[k_MAX_NODES / k_BITS_PER_WORD] = { 0 };
+    nodeMask[numaNode / k_BITS_PER_WORD] =
+                                      1UL << (numaNode % k_BITS_PER_WORD);
+
+    // Failure is benign: the pages are then allocated according to the
+    // policy of the calling thread.
+
+    syscall(SYS_mbind,
+            address,
+            size,
+            static_cast<int>(k_MPOL_BIND),
+            nodeMask,
+            static_cast<unsigned long>(k_MAX_NODES + 1),
+            0U);
+
+#else
+
+    (void)address;
+    (void)size;
+    (void)numaNode;
+
+#endif
+}
+
+#endif  // BSLS_PLATFORM_OS_LINUX
+
+}  // close unnamed namespace
+
+namespace bdlma {
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// CLASS METHODS
+bsls::Types::size_type HugePageAllocator::hugePageSize()
+{
+    return getSystemHugePageSize();
+}
+
+// CREATORS
+HugePageAllocator::~HugePageAllocator()
+{
+}
+
+// MANIPULATORS
+void *HugePageAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    const size_type pageSize = getSystemPageSize();
+
+    void      *mapping     = 0;
+    size_type  mappingSize = 0;
+
+    if (size <= ~static_cast<size_type>(0) - OFFSET - 2 * hugePageSize()) {
+        mappingSize = roundUp(size + OFFSET, pageSize);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+        const size_type hugeSize = hugePageSize();
+
+        if (e_EXPLICIT_HUGE_PAGES == d_pagePolicy) {
+            const size_type hugeMappingSize = roundUp(mappingSize, hugeSize);
+
+            mapping = systemAllocExplicitHugePages(hugeMappingSize);
+            if (mapping) {
+                mappingSize = hugeMappingSize;
+            }
+        }
+
+        if (!mapping
+         && e_REGULAR_PAGES != d_pagePolicy
+         && mappingSize >= hugeSize) {
+            mapping = systemAllocTransparentHugePages(mappingSize, hugeSize);
+        }
+
+        if (!mapping) {
+            mapping = systemAlloc(mappingSize, k_ANY_NODE);
+        }
+
+        if (mapping && k_ANY_NODE != d_numaNode) {
+            bindToNumaNode(mapping, mappingSize, d_numaNode);
+        }
+
+#else
+
+        mapping = systemAlloc(mappingSize, d_numaNode);
+
+#endif
+    }
+
+    if (!mapping) {
+#ifdef BDE_BUILD_TARGET_EXC
+        BSLS_THROW(bsl::bad_alloc());
+#else
+        return 0;                                                     // RETURN
+#endif
+    }
+
+    // Save 'mappingSize' - we'll need it for 'systemFree' in 'deallocate'.
+
+    static_cast<Header *>(mapping)->d_mappingSize = mappingSize;
+
+    return static_cast<char *>(mapping) + OFFSET;
+}
+
+void HugePageAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header *header = reinterpret_cast<Header *>(
+                                        static_cast<char *>(address) - OFFSET);
+
+    systemFree(header, header->d_mappingSize);
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,303 @@
+// bdlma_hugepageallocator.h                                          -*-C++-*-
+#ifndef INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+#define INCLUDED_BDLMA_HUGEPAGEALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide an allocator of huge-page-backed, NUMA-bound memory blocks.
+//
+//@CLASSES:
+//  bdlma::HugePageAllocator: allocator mapping huge pages from the system
+//
+//@SEE_ALSO: bdlma_guardingallocator, bdlma_sequentialallocator
+//
+//@DESCRIPTION: This component provides a concrete allocation mechanism,
+// 'bdlma::HugePageAllocator', that implements the 'bslma::Allocator' protocol
+// by mapping each block of memory directly from the operating system, backed
+// by huge pages when possible, and optionally bound to a NUMA node:
+//..
+//   ,------------------------.
+//  ( bdlma::HugePageAllocator )
+//   `------------------------'
+//               |         ctor/dtor
+//               |         hugePageSize
+//               |         numaNode
+//               |         pagePolicy
+//               V
+//      ,----------------.
+//     ( bslma::Allocator )
+//      `----------------'
+//                         allocate
+//                         deallocate
+//..
+// Each 'allocate' and 'deallocate' invocation is a system call, so this
+// allocator is intended to supply the large, long-lived blocks from which
+// pools and arenas such as 'bdlma::SequentialAllocator',
+// 'bdlma::SequentialPool', 'bdlma::BufferManager', 'bdlma::BlockList', and
+// 'bdlma::InfrequentDeleteBlockList' carve their memory, and not to serve
+// small objects directly.  Backing such blocks with huge pages (2MB on most
+// platforms) reduces the number of TLB misses incurred by random accesses to
+// them, and binding them to the NUMA node of the threads using them avoids
+// remote-node memory traffic.
+//
+///Page Policy
+///-----------
+// A constructor argument of type 'HugePageAllocator::PagePolicy' determines
+// how huge pages are requested:
+//
+//: 'e_TRANSPARENT_HUGE_PAGES' (default):
+//:   Blocks of at least 'hugePageSize()' bytes are mapped at an address
+//:   aligned to 'hugePageSize()', and the system is advised to back them with
+//:   transparent huge pages ('madvise(MADV_HUGEPAGE)').  The size of a
+//:   mapping is a multiple of the regular page size, so that a block that is
+//:   not a multiple of the huge page size wastes no memory: the part of the
+//:   block beyond its last whole huge page is backed by regular pages.
+//:
+//: 'e_EXPLICIT_HUGE_PAGES':
+//:   Blocks are mapped from the huge pages reserved by the system
+//:   administrator ('MAP_HUGETLB'), their size rounded up to a multiple of
+//:   'hugePageSize()'.  If no reserved huge page is available, the block is
+//:   mapped as for 'e_TRANSPARENT_HUGE_PAGES'.
+//:
+//: 'e_REGULAR_PAGES':
+//:   Blocks are mapped with regular pages.
+//
+// Huge pages are supported only on Linux; on other platforms, all blocks are
+// mapped with regular pages.
+//
+///NUMA Binding
+///------------
+// If a NUMA node is specified at construction, the memory of each block is
+// bound to that node ('mbind(MPOL_BIND)') before it is first accessed, so
+// that its pages are allocated from the memory local to that node.  Binding
+// is a best effort: if the system does not support NUMA, or the node does not
+// exist, the block is allocated without binding.  NUMA binding is supported
+// on Linux and Windows.
+//
+///Alignment and Overhead
+///----------------------
+// Each block is preceded by a header, the size of which is the maximum
+// alignment ('bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT'); the address returned
+// by 'allocate' is therefore maximally aligned, and, for blocks mapped at an
+// address aligned to 'hugePageSize()', at that offset from a huge page
+// boundary.  Blocks of fewer than 'hugePageSize()' bytes are mapped with
+// regular pages, and occupy a whole number of them.
+//
+///Thread Safety
+///-------------
+// The 'bdlma::HugePageAllocator' class is fully thread-safe (see
+// 'bsldoc_glossary').
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Supplying the Blocks of an Arena
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we build a large, long-lived index in an arena, and access it
+// randomly.  We want the memory of the arena to be backed by huge pages, and
+// to be local to the NUMA node on which the threads using the index run.
+//
+// First, we create a huge page allocator binding memory to the NUMA node 0:
+//..
+//  typedef bdlma::HugePageAllocator Obj;
+//
+//  Obj hugePageAllocator(Obj::e_TRANSPARENT_HUGE_PAGES, 0);
+//
+//  assert(0 == hugePageAllocator.numaNode());
+//..
+// Then, we create a sequential allocator taking blocks of 4 huge pages from
+// the huge page allocator.  Note that the block requested by the sequential
+// allocator is slightly larger than 4 huge pages, because of the headers used
+// by the sequential allocator and the huge page allocator; the excess is
+// backed by regular pages:
+//..
+//  const bsls::Types::size_type blockSize = 4 * Obj::hugePageSize();
+//
+//  bdlma::SequentialAllocator arena(blockSize,
+//                                   bsls::BlockGrowth::BSLS_CONSTANT,
+//                                   &hugePageAllocator);
+//..
+// Next, we allocate the nodes of our index from the arena:
+//..
+//  enum { k_NUM_NODES = 100000 };
+//
+//  bsl::vector<int *> nodes;
+//  for (int i = 0; i < k_NUM_NODES; ++i) {
+//      int *node = static_cast<int *>(arena.allocate(4 * sizeof(int)));
+//      node[0] = i;
+//      nodes.push_back(node);
+//  }
+//..
+// Finally, we observe that the arena returns its blocks to the system when it
+// is released:
+//..
+//  assert(k_NUM_NODES - 1 == nodes.back()[0]);
+//
+//  arena.release();
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+                          // =======================
+                          // class HugePageAllocator
+                          // =======================
+
+class HugePageAllocator : public bslma::Allocator {
+    // This class defines a concrete thread-safe allocator mechanism that
+    // implements the 'bslma::Allocator' protocol by mapping each memory block
+    // from the system, backed by huge pages according to the page policy
+    // specified at construction, and bound to the NUMA node specified at
+    // construction, if any.
+
+  public:
+    // PUBLIC TYPES
+    enum PagePolicy {
+        // Enumerate the ways of requesting huge pages from the system.
+
+        e_TRANSPARENT_HUGE_PAGES,  // advise the use of transparent huge pages
+                                   // for large blocks
+
+        e_EXPLICIT_HUGE_PAGES,     // map reserved huge pages, or transparent
+                                   // huge pages if none is available
+
+        e_REGULAR_PAGES            // map regular pages only
+    };
+
+    enum {
+        k_ANY_NODE = -1  // do not bind memory to a NUMA node
+    };
+
+  private:
+    // DATA
+    PagePolicy d_pagePolicy;  // how huge pages are requested
+    int        d_numaNode;    // NUMA node to which memory is bound, or
+                              // 'k_ANY_NODE'
+
+  private:
+    // NOT IMPLEMENTED
+    HugePageAllocator(const HugePageAllocator&);
+    HugePageAllocator& operator=(const HugePageAllocator&);
+
+  public:
+    // CLASS METHODS
+    static bsls::Types::size_type hugePageSize();
+        // Return the size (in bytes) of a huge page on this system.  Note that
+        // an implementation-defined value (2MB) is returned on platforms that
+        // do not support huge pages.
+
+    // CREATORS
+    explicit
+    HugePageAllocator(PagePolicy pagePolicy = e_TRANSPARENT_HUGE_PAGES);
+    HugePageAllocator(PagePolicy pagePolicy, int numaNode);
+        // Create a huge page allocator.  Optionally specify a 'pagePolicy'
+        // indicating how huge pages are requested.  If 'pagePolicy' is not
+        // specified, 'e_TRANSPARENT_HUGE_PAGES' is used.  Optionally specify a
+        // 'numaNode' to which the memory of each block is bound.  If
+        // 'numaNode' is not specified, or is 'k_ANY_NODE', memory is not
+        // bound.  The behavior is undefined unless 'k_ANY_NODE <= numaNode'.
+
+    virtual ~HugePageAllocator();
+        // Destroy this allocator object.  Note that destroying this allocator
+        // has no effect on any outstanding allocated memory.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return a newly-allocated maximally-aligned block of memory of the
+        // specified 'size' (in bytes), mapped from the system.  If 'size' is
+        // 0, no memory is allocated and 0 is returned.  If the allocation
+        // request exceeds the physical limit of the system, throw a
+        // 'bsl::bad_alloc' if exceptions are enabled, and return 0 otherwise.
+
+    virtual void deallocate(void *address);
+        // Return the memory block at the specified 'address' back to the
+        // system.  If 'address' is 0, this method has no effect.  The
+        // behavior is undefined unless 'address' was returned by 'allocate'
+        // and has not already been deallocated.
+
+    // ACCESSORS
+    int numaNode() const;
+        // Return the NUMA node to which the memory of the blocks allocated by
+        // this allocator is bound, or 'k_ANY_NODE' if memory is not bound.
+
+    PagePolicy pagePolicy() const;
+        // Return the policy used by this allocator to request huge pages.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                          // -----------------------
+                          // class HugePageAllocator
+                          // -----------------------
+
+// CREATORS
+inline
+HugePageAllocator::HugePageAllocator(PagePolicy pagePolicy)
+: d_pagePolicy(pagePolicy)
+, d_numaNode(k_ANY_NODE)
+{
+}
+
+inline
+HugePageAllocator::HugePageAllocator(PagePolicy pagePolicy, int numaNode)
+: d_pagePolicy(pagePolicy)
+, d_numaNode(numaNode)
+{
+    BSLS_ASSERT_SAFE(k_ANY_NODE <= numaNode);
+}
+
+// ACCESSORS
+inline
+int HugePageAllocator::numaNode() const
+{
+    return d_numaNode;
+}
+
+inline
+HugePageAllocator::PagePolicy HugePageAllocator::pagePolicy() const
+{
+    return d_pagePolicy;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,842 @@
+// bdlma_hugepageallocator.t.cpp                                      -*-C++-*-
+#include <bdlma_hugepageallocator.h>
+
+#include <bdlma_sequentialallocator.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_newdeleteallocator.h>            // for testing only
+#include <bslma_testallocator.h>
+
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_blockgrowth.h>
+#include <bsls_platform.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>     // 'memset'
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+  #include <windows.h>  // 'GetSystemInfo'
+#else
+  #include <stdio.h>    // 'fopen', 'fgets', 'sscanf', 'fclose'
+  #include <string.h>   // 'memcpy', 'strstr'
+  #include <unistd.h>   // 'sysconf'
+#endif
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::HugePageAllocator' is a special-purpose allocator mechanism that
+// maps each memory block from the system, backed by huge pages and bound to a
+// NUMA node where possible.  The primary concerns are that the blocks returned
+// by 'allocate' are properly aligned, writable over their whole extent, and
+// returned to the system by 'deallocate', and that, on Linux, the mappings
+// holding large blocks are aligned to huge page boundaries and advised to be
+// backed by transparent huge pages, which we observe through
+// '/proc/self/smaps'.  Whether the system actually grants huge pages, and
+// whether a NUMA node exists, depends on the configuration of the test
+// machine; we only report these in verbose mode.  Note that since the
+// 'bdlma::HugePageAllocator' constructor does not accept an optional allocator
+// argument, there is scant opportunity to use 'bslma::TestAllocator' in this
+// test driver.
+// ----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 2] static bsls::Types::size_type hugePageSize();
+//
+// CREATORS
+// [ 2] HugePageAllocator(PagePolicy pagePolicy = e_TRANSPARENT_HUGE_PAGES);
+// [ 2] HugePageAllocator(PagePolicy pagePolicy, int numaNode);
+// [ 2] ~HugePageAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+//
+// ACCESSORS
+// [ 2] int numaNode() const;
+// [ 2] PagePolicy pagePolicy() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] USAGE EXAMPLE
+// [ *] CONCERN: In no case does memory come from the global allocator.
+// [ 4] CONCERN: The 'allocate' and 'deallocate' methods are thread-safe.
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                      STANDARD BDE ASSERT TEST MACRO
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (0 <= testStatus && testStatus <= 100) ++testStatus;
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL VARIABLES / TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::HugePageAllocator Obj;
+typedef bsls::Types::size_type   size_type;
+typedef bsls::Types::UintPtr     UintPtr;
+
+static const size_type MAX_ALIGN = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT;
+
+// ============================================================================
+//                   HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+static
+size_type systemPageSize()
+    // Return the size (in bytes) of a system memory page.
+{
+#ifdef BSLS_PLATFORM_OS_WINDOWS
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    return sysconf(_SC_PAGESIZE);
+#endif
+}
+
+static
+bool isWritable(void *address, size_type size)
+    // Write a pattern to each page, and to the last byte, of the block at the
+    // specified 'address' having the specified 'size' (in bytes), and return
+    // 'true' if the pattern reads back, and 'false' otherwise.  Note that a
+    // block that is not writable causes a memory fault.
+{
+    char            *p        = static_cast<char *>(address);
+    const size_type  pageSize = systemPageSize();
+
+    for (size_type i = 0; i < size; i += pageSize) {
+        p[i] = static_cast<char>(i / pageSize);
+    }
+    p[size - 1] = 'z';
+
+    for (size_type i = 0; i + 1 < size; i += pageSize) {
+        if (p[i] != static_cast<char>(i / pageSize)) {
+            return false;                                             // RETURN
+        }
+    }
+    return 'z' == p[size - 1];
+}
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+
+static
+int findInMapping(const void *address, const char *text, bool verbose)
+    // Return 1 if the description, in '/proc/self/smaps', of the memory
+    // mapping containing the specified 'address' contains the specified
+    // 'text', 0 if it does not, and -1 if no mapping contains 'address'.  If
+    // the specified 'verbose' flag is 'true', print that description.
+{
+    FILE *file = fopen("/proc/self/smaps", "r");
+    if (!file) {
+        return -1;                                                    // RETURN
+    }
+
+    const UintPtr addr = reinterpret_cast<UintPtr>(address);
+
+    char line[1024];
+    int  result = -1;
+    bool inside = false;
+
+    while (fgets(line, sizeof line, file)) {
+        unsigned long start = 0;
+        unsigned long end   = 0;
+
+        // The description of a mapping starts with its address range.
+
+        if (2 == sscanf(line, "%lx-%lx ", &start, &end)) {
+            if (inside) {
+                break;
+            }
+            inside = start <= addr && addr < end;
+            if (inside) {
+                result = 0;
+            }
+        }
+        if (inside) {
+            if (verbose) {
+                cout << "\t" << line;
+            }
+            if (strstr(line, text)) {
+                result = 1;
+            }
+        }
+    }
+
+    fclose(file);
+    return result;
+}
+
+static
+void printNumaPolicy(const void *address)
+    // Print the description, in '/proc/self/numa_maps', of the memory mapping
+    // containing the specified 'address', if any.
+{
+    FILE *file = fopen("/proc/self/numa_maps", "r");
+    if (!file) {
+        return;                                                       // RETURN
+    }
+
+    const UintPtr addr = reinterpret_cast<UintPtr>(address);
+
+    // The entries are sorted by start address: the mapping containing 'addr'
+    // is described by the last entry starting at or before 'addr'.
+
+    char line[1024];
+    char found[1024] = "";
+
+    while (fgets(line, sizeof line, file)) {
+        unsigned long start = 0;
+
+        if (1 == sscanf(line, "%lx ", &start) && start <= addr) {
+            memcpy(found, line, sizeof line);
+        }
+    }
+
+    fclose(file);
+    cout << "\t" << found;
+}
+
+#endif
+
+namespace TestCase4 {
+
+enum { k_NUM_ITERATIONS = 200 };
+
+extern "C" void *threadFunction(void *arg)
+    // Allocate and deallocate blocks of various sizes, including sizes larger
+    // than a huge page, from the allocator at the specified 'arg', checking
+    // that each block is writable.
+{
+    Obj *mX = static_cast<Obj *>(arg);
+
+    const size_type SIZES[] = { 1, 100, 5000, 70000, 3 * 1024 * 1024 };
+    const int       NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+    for (int i = 0; i < k_NUM_ITERATIONS; ++i) {
+        void *blocks[NUM_SIZES];
+
+        for (int j = 0; j < NUM_SIZES; ++j) {
+            blocks[j] = mX->allocate(SIZES[j]);
+            ASSERT(blocks[j]);
+            const char value = static_cast<char>('a' + j);
+
+            static_cast<char *>(blocks[j])[0]            = value;
+            static_cast<char *>(blocks[j])[SIZES[j] - 1] = value;
+        }
+        for (int j = NUM_SIZES - 1; 0 <= j; --j) {
+            ASSERT('a' + j == static_cast<char *>(blocks[j])[0]);
+            ASSERT('a' + j == static_cast<char *>(blocks[j])[SIZES[j] - 1]);
+            mX->deallocate(blocks[j]);
+        }
+    }
+    return 0;
+}
+
+}  // close namespace TestCase4
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+    int verbose = argc > 2;
+    int veryVerbose = argc > 3;
+    int veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    bslma::TestAllocator globalAllocator(veryVeryVerbose);
+    bslma::Default::setGlobalAllocator(&globalAllocator);
+
+    const size_type pageSize = systemPageSize();
+
+    switch (test) { case 0:
+      case 5: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Supplying the Blocks of an Arena
+///- - - - - - - - - - - - - - - - - - - - - -
+// Suppose that we build a large, long-lived index in an arena, and access it
+// randomly.  We want the memory of the arena to be backed by huge pages, and
+// to be local to the NUMA node on which the threads using the index run.
+//
+// First, we create a huge page allocator binding memory to the NUMA node 0:
+//..
+    typedef bdlma::HugePageAllocator Obj;
+
+    Obj hugePageAllocator(Obj::e_TRANSPARENT_HUGE_PAGES, 0);
+
+    ASSERT(0 == hugePageAllocator.numaNode());
+//..
+// Then, we create a sequential allocator taking blocks of 4 huge pages from
+// the huge page allocator.  Note that the block requested by the sequential
+// allocator is slightly larger than 4 huge pages, because of the headers used
+// by the sequential allocator and the huge page allocator; the excess is
+// backed by regular pages:
+//..
+    const bsls::Types::size_type blockSize = 4 * Obj::hugePageSize();
+
+    bdlma::SequentialAllocator arena(blockSize,
+                                     bsls::BlockGrowth::BSLS_CONSTANT,
+                                     &hugePageAllocator);
+//..
+// Next, we allocate the nodes of our index from the arena:
+//..
+    enum { k_NUM_NODES = 100000 };
+
+    bsl::vector<int *> nodes;
+    for (int i = 0; i < k_NUM_NODES; ++i) {
+        int *node = static_cast<int *>(arena.allocate(4 * sizeof(int)));
+        node[0] = i;
+        nodes.push_back(node);
+    }
+//..
+// Finally, we observe that the arena returns its blocks to the system when it
+// is released:
+//..
+    ASSERT(k_NUM_NODES - 1 == nodes.back()[0]);
+
+    arena.release();
+//..
+
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //   Ensure that 'allocate' and 'deallocate' are thread-safe.
+        //
+        // Concerns:
+        //: 1 That 'allocate' and 'deallocate' are thread-safe.
+        //
+        // Plan:
+        //: 1 For each page policy, create an allocator, and four threads that
+        //:   repeatedly allocate and deallocate blocks of sizes smaller and
+        //:   larger than a huge page from it, checking that the blocks are
+        //:   writable and not shared.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: The 'allocate' and 'deallocate' methods are thread-safe.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        enum { k_NUM_THREADS = 4 };
+
+        const Obj::PagePolicy POLICIES[] = {
+            Obj::e_TRANSPARENT_HUGE_PAGES,
+            Obj::e_EXPLICIT_HUGE_PAGES,
+            Obj::e_REGULAR_PAGES
+        };
+
+        for (int pi = 0; pi < 3; ++pi) {
+            Obj mX(POLICIES[pi]);
+
+            bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                                   &handles[i],
+                                                   &TestCase4::threadFunction,
+                                                   &mX));
+            }
+            for (int i = 0; i < k_NUM_THREADS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(handles[i]));
+            }
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE AND DEALLOCATE
+        //   Ensure that 'allocate' and 'deallocate' work as expected.
+        //
+        // Concerns:
+        //: 1 'allocate' returns a maximally-aligned block that is writable
+        //:   over its whole extent, for sizes smaller than, equal to, and
+        //:   larger than both the page size and the huge page size.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 With a huge page policy, a block of at least one huge page is
+        //:   at the header offset from a huge page boundary, and, on Linux,
+        //:   its mapping is advised to be backed by huge pages.
+        //:
+        //: 4 With the regular page policy, no mapping is advised to be backed
+        //:   by huge pages.
+        //:
+        //: 5 A NUMA node that does not exist does not cause allocation to
+        //:   fail.
+        //:
+        //: 6 'deallocate' returns the whole mapping to the system.
+        //
+        // Plan:
+        //: 1 For each page policy and for NUMA nodes 'k_ANY_NODE', 0, and
+        //:   999, allocate blocks of a table of sizes, verify their
+        //:   alignment, and write to each of their pages.  (C-1, 5)
+        //:
+        //: 2 For the sizes of at least a huge page, verify the offset from a
+        //:   huge page boundary, and, on Linux, find the 'hg' flag
+        //:   ('MADV_HUGEPAGE') in the description of the mapping in
+        //:   '/proc/self/smaps' for the huge page policies, but not for the
+        //:   regular page policy.  (C-3, 4)
+        //:
+        //: 3 On Linux, verify that, after 'deallocate', the mapping is no
+        //:   longer found in '/proc/self/smaps'.  (C-6)
+        //:
+        //: 4 Allocate 0 bytes and deallocate 0.  (C-2)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE AND DEALLOCATE" << endl
+                          << "=======================" << endl;
+
+        const size_type H = Obj::hugePageSize();
+
+        const size_type SIZES[] = {
+            1,
+            MAX_ALIGN,
+            pageSize - MAX_ALIGN,
+            pageSize - MAX_ALIGN + 1,
+            pageSize,
+            10 * pageSize + 17,
+            H - MAX_ALIGN - 1,
+            H - MAX_ALIGN,
+            H,
+            H + 1,
+            3 * H - 5,
+            4 * H
+        };
+        const int NUM_SIZES = sizeof SIZES / sizeof *SIZES;
+
+        const Obj::PagePolicy POLICIES[] = {
+            Obj::e_TRANSPARENT_HUGE_PAGES,
+            Obj::e_EXPLICIT_HUGE_PAGES,
+            Obj::e_REGULAR_PAGES
+        };
+        const int NUM_POLICIES = sizeof POLICIES / sizeof *POLICIES;
+
+        const int NODES[] = { Obj::k_ANY_NODE, 0, 999 };
+        const int NUM_NODES = sizeof NODES / sizeof *NODES;
+
+        for (int pi = 0; pi < NUM_POLICIES; ++pi) {
+            const Obj::PagePolicy POLICY = POLICIES[pi];
+
+            for (int ni = 0; ni < NUM_NODES; ++ni) {
+                const int NODE = NODES[ni];
+
+                Obj mX(POLICY, NODE);
+
+                for (int si = 0; si < NUM_SIZES; ++si) {
+                    const size_type SIZE = SIZES[si];
+
+                    if (veryVerbose) { T_ P_(POLICY) P_(NODE) P(SIZE) }
+
+                    void *p = mX.allocate(SIZE);
+
+                    ASSERTV(POLICY, NODE, SIZE, p);
+                    if (!p) {
+                        continue;
+                    }
+
+                    const UintPtr addr = reinterpret_cast<UintPtr>(p);
+
+                    ASSERTV(POLICY, NODE, SIZE, 0 == addr % MAX_ALIGN);
+                    ASSERTV(POLICY, NODE, SIZE, isWritable(p, SIZE));
+
+                    // The mapping holding the block and its header is a whole
+                    // number of pages.
+
+                    const bool isHuge = Obj::e_REGULAR_PAGES != POLICY
+                                     && SIZE + MAX_ALIGN + pageSize > H;
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+                    if (isHuge) {
+                        ASSERTV(POLICY, NODE, SIZE, addr % H,
+                                MAX_ALIGN == addr % H);
+                    }
+
+                    const int hasHugePageFlag = findInMapping(
+                                                              p,
+                                                              " hg",
+                                                              veryVeryVerbose);
+
+                    // Explicit huge pages are never advised; they are found
+                    // only if the system has huge pages reserved.  Skip the
+                    // check if 'smaps' cannot be read.
+
+                    const bool isAdvised =
+                                  Obj::e_TRANSPARENT_HUGE_PAGES == POLICY
+                               && isHuge;
+
+                    if (-1 != hasHugePageFlag && isAdvised) {
+                        ASSERTV(NODE, SIZE, 1 == hasHugePageFlag);
+                    }
+                    if (-1 != hasHugePageFlag && !isHuge) {
+                        ASSERTV(POLICY, NODE, SIZE, 0 == hasHugePageFlag);
+                    }
+
+                    if (veryVerbose && Obj::k_ANY_NODE != NODE) {
+                        printNumaPolicy(p);
+                    }
+#else
+                    (void)isHuge;
+#endif
+
+                    mX.deallocate(p);
+
+#ifdef BSLS_PLATFORM_OS_LINUX
+                    ASSERTV(POLICY, NODE, SIZE,
+                            -1 == findInMapping(p, "", false));
+#endif
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'allocate(0)'." << endl;
+        {
+            Obj mX;
+
+            ASSERT(0 == mX.allocate(0));
+        }
+
+        if (verbose) cout << "\nTesting 'deallocate(0)'." << endl;
+        {
+            Obj mX;
+
+            mX.deallocate(0);
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CTOR, DTOR, AND ACCESSORS
+        //   Ensure that the allocator can be created with each page policy
+        //   and NUMA node, and that the accessors report them.
+        //
+        // Concerns:
+        //: 1 The default constructor uses 'e_TRANSPARENT_HUGE_PAGES' and
+        //:   'k_ANY_NODE'.
+        //:
+        //: 2 The page policy and NUMA node passed to the constructor are
+        //:   reported by 'pagePolicy' and 'numaNode'.
+        //:
+        //: 3 'hugePageSize' returns a power of 2 larger than the page size,
+        //:   and the same value on every call.
+        //:
+        //: 4 The accessors are declared 'const'.
+        //:
+        //: 5 The destructor does not release outstanding blocks.
+        //
+        // Plan:
+        //: 1 Default-construct an allocator, and verify its accessors through
+        //:   a 'const' reference.  (C-1, 4)
+        //:
+        //: 2 For each page policy, and for several NUMA nodes, construct an
+        //:   allocator and verify its accessors.  (C-2)
+        //:
+        //: 3 Verify the value of 'hugePageSize'.  (C-3)
+        //:
+        //: 4 Allocate a block, destroy the allocator, write to the block, and
+        //:   deallocate it through another allocator.  (C-5)
+        //
+        // Testing:
+        //   HugePageAllocator(PagePolicy pagePolicy = e_TRANSPARENT...);
+        //   HugePageAllocator(PagePolicy pagePolicy, int numaNode);
+        //   ~HugePageAllocator();
+        //   static bsls::Types::size_type hugePageSize();
+        //   int numaNode() const;
+        //   PagePolicy pagePolicy() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CTOR, DTOR, AND ACCESSORS" << endl
+                          << "=========================" << endl;
+
+        if (verbose) cout << "\nTesting default constructor." << endl;
+        {
+            Obj mX;  const Obj& X = mX;
+
+            ASSERT(Obj::e_TRANSPARENT_HUGE_PAGES == X.pagePolicy());
+            ASSERT(Obj::k_ANY_NODE               == X.numaNode());
+        }
+
+        if (verbose) cout << "\nTesting value constructors." << endl;
+        {
+            const Obj::PagePolicy POLICIES[] = {
+                Obj::e_TRANSPARENT_HUGE_PAGES,
+                Obj::e_EXPLICIT_HUGE_PAGES,
+                Obj::e_REGULAR_PAGES
+            };
+            const int NODES[] = { Obj::k_ANY_NODE, 0, 1, 63, 64, 1023, 5000 };
+
+            for (int pi = 0; pi < 3; ++pi) {
+                const Obj::PagePolicy POLICY = POLICIES[pi];
+
+                {
+                    Obj mX(POLICY);  const Obj& X = mX;
+
+                    ASSERTV(POLICY, POLICY           == X.pagePolicy());
+                    ASSERTV(POLICY, Obj::k_ANY_NODE  == X.numaNode());
+                }
+
+                for (int ni = 0; ni < 7; ++ni) {
+                    const int NODE = NODES[ni];
+
+                    Obj mX(POLICY, NODE);  const Obj& X = mX;
+
+                    ASSERTV(POLICY, NODE, POLICY == X.pagePolicy());
+                    ASSERTV(POLICY, NODE, NODE   == X.numaNode());
+                }
+            }
+        }
+
+        if (verbose) cout << "\nTesting 'hugePageSize'." << endl;
+        {
+            const size_type H = Obj::hugePageSize();
+
+            if (verbose) { P_(pageSize) P(H) }
+
+            ASSERTV(H, H > pageSize);
+            ASSERTV(H, 0 == (H & (H - 1)));
+            ASSERTV(H, H == Obj::hugePageSize());
+        }
+
+        if (verbose) cout << "\nTesting destructor." << endl;
+        {
+            void *p;
+            {
+                Obj mX;
+
+                p = mX.allocate(3 * Obj::hugePageSize());
+            }
+            ASSERT(isWritable(p, 3 * Obj::hugePageSize()));
+
+            Obj mY;
+
+            mY.deallocate(p);
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Create an allocator, allocate small and large blocks, write to
+        //:   them, and deallocate them.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;
+
+        char *p = static_cast<char *>(mX.allocate(10));
+        ASSERT(p);
+        memset(p, 'a', 10);
+
+        const size_type LARGE = 2 * Obj::hugePageSize() + 100;
+
+        char *q = static_cast<char *>(mX.allocate(LARGE));
+        ASSERT(q);
+        memset(q, 'b', LARGE);
+
+        ASSERT('a' == p[9]);
+        ASSERT('b' == q[LARGE - 1]);
+
+        mX.deallocate(q);
+        mX.deallocate(p);
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the cost of random accesses to a large arena backed by
+        //   huge pages with that of an arena backed by regular pages.
+        //
+        // Concerns:
+        //: 1 Random reads of a large block allocated with a huge page policy
+        //:   incur fewer TLB misses, and are thus faster, than those of a
+        //:   block allocated with regular pages.
+        //
+        // Plan:
+        //: 1 Allocate a 512MB block from 'bslma::NewDeleteAllocator' and from
+        //:   'bdlma::HugePageAllocator' with each page policy, fill it, and
+        //:   measure the time of 20 million dependent random reads (each
+        //:   index derived from the value previously read).
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const size_type ARENA_SIZE = 512 * 1024 * 1024;
+        const size_type NUM_WORDS  = ARENA_SIZE / sizeof(unsigned);
+        const int       NUM_READS  = 20 * 1000 * 1000;
+
+        Obj mT(Obj::e_TRANSPARENT_HUGE_PAGES);
+        Obj mE(Obj::e_EXPLICIT_HUGE_PAGES);
+        Obj mR(Obj::e_REGULAR_PAGES);
+
+        bslma::Allocator *const ALLOCATORS[] = {
+            &bslma::NewDeleteAllocator::singleton(), &mT, &mE, &mR
+        };
+        const char *const NAMES[] = {
+            "NewDeleteAllocator        ",
+            "HugePage (transparent)    ",
+            "HugePage (explicit)       ",
+            "HugePage (regular pages)  "
+        };
+        const int NUM_ALLOCATORS = sizeof NAMES / sizeof *NAMES;
+
+        for (int a = 0; a < NUM_ALLOCATORS; ++a) {
+            unsigned *arena = static_cast<unsigned *>(
+                                         ALLOCATORS[a]->allocate(ARENA_SIZE));
+
+            unsigned seed = 12345;
+            for (size_type i = 0; i < NUM_WORDS; ++i) {
+                seed = seed * 1103515245 + 12345;
+                arena[i] = seed;
+            }
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            unsigned index = 0;
+            unsigned sum   = 0;
+            for (int i = 0; i < NUM_READS; ++i) {
+                const unsigned value = arena[index];
+                sum  += value;
+                index = (value + i * 2654435761U) % NUM_WORDS;
+            }
+
+            timer.stop();
+
+            cout << NAMES[a] << timer.elapsedTime() << " s"
+                 << "  (" << sum % 10 << ")" << endl;
+
+            ALLOCATORS[a]->deallocate(arena);
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    // CONCERN: In no case does memory come from the global allocator.
+
+    LOOP_ASSERT(globalAllocator.numBlocksTotal(),
+                0 == globalAllocator.numBlocksTotal());
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
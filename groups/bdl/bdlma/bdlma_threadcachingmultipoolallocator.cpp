@@ -0,0 +1,471 @@
+// bdlma_threadcachingmultipoolallocator.cpp                          -*-C++-*-
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlma_threadcachingmultipoolallocator_cpp,"$Id$ $CSID$")
+
+#include <bdlma_concurrentpool.h>
+
+#include <bdlb_bitutil.h>
+
+#include <bslma_allocator.h>
+#include <bslma_autodestructor.h>
+#include <bslma_deallocatorproctor.h>
+
+#include <bslmf_assert.h>
+
+#include <bslmt_lockguard.h>
+
+#include <bsls_assert.h>
+#include <bsls_exceptionutil.h>
+#include <bsls_performancehint.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_cstdint.h>
+#include <bsl_limits.h>
+
+#include <new>           // placement 'new'
+
+namespace BloombergLP {
+
+enum {
+    k_DEFAULT_NUM_POOLS      = 10,
+    k_DEFAULT_MAX_CHUNK_SIZE = 32,
+    k_DEFAULT_MAX_BATCH_SIZE = 32,
+    k_MIN_BATCH_SIZE         = 2,
+    k_BATCH_BYTES            = 8192,  // block bytes beyond which a batch is
+                                      // made smaller than the maximum
+    k_MIN_BLOCK_SIZE         = 8
+};
+
+namespace bdlma {
+
+                   // -------------------------------------
+                   // class ThreadCachingMultipoolAllocator
+                   // -------------------------------------
+
+// PRIVATE CLASS METHODS
+void ThreadCachingMultipoolAllocator::releaseThreadCache(void *cache)
+{
+    ThreadCache *threadCache = static_cast<ThreadCache *>(cache);
+
+    threadCache->d_allocator_p->flushMagazines(threadCache);
+    threadCache->d_isClaimed.storeRelease(0);
+}
+
+// PRIVATE MANIPULATORS
+void ThreadCachingMultipoolAllocator::initialize(int maxBatchSize)
+{
+    BSLMF_ASSERT(sizeof(FreeBlock) <= sizeof(Header) + k_MIN_BLOCK_SIZE);
+
+    d_maxBlockSize = k_MIN_BLOCK_SIZE;
+
+    d_pools_p = static_cast<ConcurrentPool *>(
+                      d_allocAdapter.allocate(d_numPools * sizeof *d_pools_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoPoolsDeallocator(
+                                                              d_pools_p,
+                                                              &d_allocAdapter);
+
+    d_depots_p = static_cast<Depot *>(
+                     d_allocAdapter.allocate(d_numPools * sizeof *d_depots_p));
+
+    bslma::DeallocatorProctor<bslma::Allocator> autoDepotsDeallocator(
+                                                              d_depots_p,
+                                                              &d_allocAdapter);
+
+    bslma::AutoDestructor<ConcurrentPool> autoDtor(d_pools_p, 0);
+
+    for (int i = 0; i < d_numPools; ++i, ++autoDtor) {
+        new (d_pools_p + i) ConcurrentPool(
+                             d_maxBlockSize + static_cast<int>(sizeof(Header)),
+                             bsls::BlockGrowth::BSLS_GEOMETRIC,
+                             k_DEFAULT_MAX_CHUNK_SIZE,
+                             &d_allocAdapter);
+
+        // A batch holds at most 'k_BATCH_BYTES' of larger blocks, so that
+        // caching large blocks does not hold too much memory.
+
+        Depot& depot = d_depots_p[i];
+
+        new (&depot.d_lock) bsls::SpinLock(bsls::SpinLock::s_unlocked);
+        depot.d_batches_p = 0;
+        depot.d_batchSize = static_cast<int>(bsl::min<bsls::Types::size_type>(
+                   maxBatchSize,
+                   bsl::max<bsls::Types::size_type>(
+                                           k_MIN_BATCH_SIZE,
+                                           k_BATCH_BYTES / d_maxBlockSize)));
+
+        BSLS_ASSERT(d_maxBlockSize <=
+                       bsl::numeric_limits<bsls::Types::size_type>::max() / 2);
+
+        d_maxBlockSize *= 2;
+    }
+
+    d_maxBlockSize /= 2;
+
+    d_hasKey = 0 == bslmt::ThreadUtil::createKey(
+                           &d_key,
+                           (bslmt::ThreadUtil::Destructor)&releaseThreadCache);
+
+    autoDtor.release();
+    autoDepotsDeallocator.release();
+    autoPoolsDeallocator.release();
+}
+
+ThreadCachingMultipoolAllocator::ThreadCache *
+ThreadCachingMultipoolAllocator::claimThreadCache()
+{
+    BSLS_ASSERT(d_hasKey);
+
+    // Recycle the cache of an exited thread, if any.
+
+    ThreadCache *cache = d_caches.loadAcquire();
+    while (cache) {
+        if (0 == cache->d_isClaimed.loadRelaxed()
+         && 0 == cache->d_isClaimed.testAndSwap(0, 1)) {
+            break;
+        }
+        cache = cache->d_next_p;
+    }
+
+    if (!cache) {
+        cache = static_cast<ThreadCache *>(d_allocAdapter.allocate(
+                     sizeof(ThreadCache) + d_numPools * sizeof(Magazine)));
+
+        cache->d_allocator_p  = this;
+        cache->d_next_p       = 0;
+        new (&cache->d_isClaimed) bsls::AtomicInt(1);
+        cache->d_magazines_p  = reinterpret_cast<Magazine *>(cache + 1);
+
+        for (int i = 0; i < d_numPools; ++i) {
+            Magazine& magazine = cache->d_magazines_p[i];
+
+            magazine.d_head_p    = 0;
+            magazine.d_numBlocks = 0;
+            magazine.d_capacity  = 2 * d_depots_p[i].d_batchSize;
+        }
+
+        // Caches are never removed from the list before destruction, so the
+        // push is not subject to ABA.
+
+        ThreadCache *head = d_caches.loadRelaxed();
+        do {
+            cache->d_next_p = head;
+            head            = d_caches.testAndSwap(cache->d_next_p, cache);
+        } while (head != cache->d_next_p);
+    }
+
+    if (0 != bslmt::ThreadUtil::setSpecific(d_key, cache)) {
+        cache->d_isClaimed.storeRelease(0);
+        return 0;                                                     // RETURN
+    }
+    return cache;
+}
+
+void ThreadCachingMultipoolAllocator::flushMagazines(ThreadCache *cache)
+{
+    for (int i = 0; i < d_numPools; ++i) {
+        Magazine& magazine = cache->d_magazines_p[i];
+
+        if (0 == magazine.d_numBlocks) {
+            continue;
+        }
+
+        FreeBlock *batch   = magazine.d_head_p;
+        batch->d_numBlocks = magazine.d_numBlocks;
+
+        magazine.d_head_p    = 0;
+        magazine.d_numBlocks = 0;
+
+        Depot&              depot = d_depots_p[i];
+        bsls::SpinLockGuard guard(&depot.d_lock);
+
+        batch->d_nextBatch_p = depot.d_batches_p;
+        depot.d_batches_p    = batch;
+    }
+}
+
+void ThreadCachingMultipoolAllocator::refillMagazine(Magazine *magazine,
+                                                     int       pool)
+{
+    BSLS_ASSERT(0 == magazine->d_numBlocks);
+
+    Depot&     depot = d_depots_p[pool];
+    FreeBlock *batch;
+    {
+        bsls::SpinLockGuard guard(&depot.d_lock);
+
+        batch = depot.d_batches_p;
+        if (batch) {
+            depot.d_batches_p = batch->d_nextBatch_p;
+        }
+    }
+
+    if (batch) {
+        magazine->d_head_p    = batch;
+        magazine->d_numBlocks = batch->d_numBlocks;
+        return;                                                       // RETURN
+    }
+
+    // The depot is empty: take new blocks from the pool.  The blocks are added
+    // to the magazine one by one, so that none is lost if the pool throws.
+
+    ConcurrentPool& concurrentPool = d_pools_p[pool];
+    const int       batchSize      = magazine->d_capacity / 2;
+
+    for (int i = 0; i < batchSize; ++i) {
+        FreeBlock *block = static_cast<FreeBlock *>(concurrentPool.allocate());
+
+        block->d_next_p    = magazine->d_head_p;
+        magazine->d_head_p = block;
+        ++magazine->d_numBlocks;
+    }
+}
+
+void ThreadCachingMultipoolAllocator::releaseBatch(Magazine *magazine,
+                                                   int       pool)
+{
+    Depot&    depot     = d_depots_p[pool];
+    const int batchSize = magazine->d_capacity / 2;
+
+    FreeBlock *batch = magazine->d_head_p;
+    FreeBlock *last  = batch;
+    for (int i = 1; i < batchSize; ++i) {
+        last = last->d_next_p;
+    }
+
+    magazine->d_head_p     = last->d_next_p;
+    magazine->d_numBlocks -= batchSize;
+
+    last->d_next_p     = 0;
+    batch->d_numBlocks = batchSize;
+
+    bsls::SpinLockGuard guard(&depot.d_lock);
+
+    batch->d_nextBatch_p = depot.d_batches_p;
+    depot.d_batches_p    = batch;
+}
+
+// PRIVATE ACCESSORS
+inline
+int ThreadCachingMultipoolAllocator::findPool(
+                                           bsls::Types::size_type size) const
+{
+    return 31 - bdlb::BitUtil::numLeadingUnsetBits(static_cast<bsl::uint32_t>(
+                                ((size + k_MIN_BLOCK_SIZE - 1) >> 3) * 2 - 1));
+}
+
+// CREATORS
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                              bslma::Allocator *basicAllocator)
+: d_numPools(k_DEFAULT_NUM_POOLS)
+, d_hasKey(false)
+, d_caches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    initialize(k_DEFAULT_MAX_BATCH_SIZE);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                              int               numPools,
+                                              bslma::Allocator *basicAllocator)
+: d_numPools(numPools)
+, d_hasKey(false)
+, d_caches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    BSLS_ASSERT(1 <= numPools);
+
+    initialize(k_DEFAULT_MAX_BATCH_SIZE);
+}
+
+ThreadCachingMultipoolAllocator::ThreadCachingMultipoolAllocator(
+                                              int               numPools,
+                                              int               maxBatchSize,
+                                              bslma::Allocator *basicAllocator)
+: d_numPools(numPools)
+, d_hasKey(false)
+, d_caches(0)
+, d_blockList(basicAllocator)
+, d_allocAdapter(&d_mutex, basicAllocator)
+{
+    BSLS_ASSERT(1 <= numPools);
+    BSLS_ASSERT(1 <= maxBatchSize);
+
+    initialize(maxBatchSize);
+}
+
+ThreadCachingMultipoolAllocator::~ThreadCachingMultipoolAllocator()
+{
+    // Deleting the key first guarantees that 'releaseThreadCache' is not
+    // called for the caches deallocated below.
+
+    if (d_hasKey) {
+        bslmt::ThreadUtil::deleteKey(d_key);
+    }
+
+    ThreadCache *cache = d_caches.loadAcquire();
+    while (cache) {
+        ThreadCache *next = cache->d_next_p;
+
+        d_allocAdapter.deallocate(cache);
+        cache = next;
+    }
+
+    d_blockList.release();
+    for (int i = 0; i < d_numPools; ++i) {
+        d_pools_p[i].release();
+        d_pools_p[i].~ConcurrentPool();
+    }
+    d_allocAdapter.deallocate(d_depots_p);
+    d_allocAdapter.deallocate(d_pools_p);
+}
+
+// MANIPULATORS
+void *ThreadCachingMultipoolAllocator::allocate(bsls::Types::size_type size)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == size)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return 0;                                                     // RETURN
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(size > d_maxBlockSize)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // The requested size is large and will not be pooled.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+
+        Header *p = static_cast<Header *>(
+                d_blockList.allocate(size + static_cast<int>(sizeof(Header))));
+
+        p->d_poolIdx = -1;
+
+        return p + 1;                                                 // RETURN
+    }
+
+    const int pool = findPool(size);
+
+    ThreadCache *cache = 0;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_hasKey)) {
+        cache = static_cast<ThreadCache *>(
+                                     bslmt::ThreadUtil::getSpecific(d_key));
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            cache = claimThreadCache();
+        }
+    }
+
+    Header *p;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != cache)) {
+        Magazine& magazine = cache->d_magazines_p[pool];
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == magazine.d_numBlocks)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            refillMagazine(&magazine, pool);
+        }
+
+        FreeBlock *block  = magazine.d_head_p;
+        magazine.d_head_p = block->d_next_p;
+        --magazine.d_numBlocks;
+
+        p = reinterpret_cast<Header *>(block);
+    }
+    else {
+        p = static_cast<Header *>(d_pools_p[pool].allocate());
+    }
+
+    p->d_poolIdx = pool;
+
+    return p + 1;
+}
+
+void ThreadCachingMultipoolAllocator::deallocate(void *address)
+{
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 == address)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return;                                                       // RETURN
+    }
+
+    Header    *h    = static_cast<Header *>(address) - 1;
+    const int  pool = h->d_poolIdx;
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(-1 == pool)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_mutex);
+        d_blockList.deallocate(h);
+        return;                                                       // RETURN
+    }
+
+    ThreadCache *cache = 0;
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(d_hasKey)) {
+        cache = static_cast<ThreadCache *>(
+                                     bslmt::ThreadUtil::getSpecific(d_key));
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!cache)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+            // 'deallocate' must not throw: if no cache can be created for
+            // this thread, the block is returned directly to its pool.
+
+            BSLS_TRY {
+                cache = claimThreadCache();
+            }
+            BSLS_CATCH(...) {
+                cache = 0;
+            }
+        }
+    }
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 != cache)) {
+        Magazine&  magazine = cache->d_magazines_p[pool];
+        FreeBlock *block    = reinterpret_cast<FreeBlock *>(h);
+
+        block->d_next_p   = magazine.d_head_p;
+        magazine.d_head_p = block;
+
+        if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(
+                            ++magazine.d_numBlocks >= magazine.d_capacity)) {
+            BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+            releaseBatch(&magazine, pool);
+        }
+    }
+    else {
+        d_pools_p[pool].deallocate(h);
+    }
+}
+
+void ThreadCachingMultipoolAllocator::flushThreadCache()
+{
+    if (!d_hasKey) {
+        return;                                                       // RETURN
+    }
+
+    ThreadCache *cache = static_cast<ThreadCache *>(
+                                     bslmt::ThreadUtil::getSpecific(d_key));
+    if (cache) {
+        flushMagazines(cache);
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
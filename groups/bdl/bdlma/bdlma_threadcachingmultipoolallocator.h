@@ -0,0 +1,474 @@
+// bdlma_threadcachingmultipoolallocator.h                            -*-C++-*-
+#ifndef INCLUDED_BDLMA_THREADCACHINGMULTIPOOLALLOCATOR
+#define INCLUDED_BDLMA_THREADCACHINGMULTIPOOLALLOCATOR
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a multipool allocator with per-thread block caches.
+//
+//@CLASSES:
+//  bdlma::ThreadCachingMultipoolAllocator: multipool with thread caches
+//
+//@SEE_ALSO: bdlma_concurrentmultipoolallocator, bdlma_concurrentpool
+//
+//@DESCRIPTION: This component provides a thread-safe allocator,
+// 'bdlma::ThreadCachingMultipoolAllocator', that implements the
+// 'bslma::Allocator' protocol and dispenses memory blocks from the same size
+// classes as 'bdlma::ConcurrentMultipoolAllocator': a configurable number of
+// 'bdlma::ConcurrentPool' objects, the first dispensing blocks of 8 bytes and
+// each successive pool dispensing blocks twice the size of those of the
+// previous pool.  Requests larger than the block size of the last pool are
+// satisfied directly by the allocator supplied at construction.
+//..
+//   ,--------------------------------------.
+//  ( bdlma::ThreadCachingMultipoolAllocator )
+//   `--------------------------------------'
+//                     |        ctor/dtor
+//                     |        flushThreadCache
+//                     |        maxPooledBlockSize
+//                     |        numPools
+//                     V
+//             ,----------------.
+//            ( bslma::Allocator )
+//             `----------------'
+//                              allocate
+//                              deallocate
+//..
+// Every allocation from a 'bdlma::ConcurrentMultipoolAllocator' pops a block
+// from the lock-free free list of a 'bdlma::ConcurrentPool', and every
+// deallocation pushes one back, so that when many threads allocate and free
+// blocks of the same size, the compare-and-swap on the head of that free list
+// becomes a point of contention.  A 'bdlma::ThreadCachingMultipoolAllocator'
+// instead gives each thread that uses it a private *magazine* of free blocks
+// for each pool, from which 'allocate' pops, and onto which 'deallocate'
+// pushes, without any atomic operation.  Magazines exchange blocks with a
+// shared *depot* for each pool only in batches:
+//
+//: o When a magazine is empty, 'allocate' takes a whole batch of free blocks
+//:   from the depot, or, if the depot is empty, a batch of new blocks from the
+//:   pool.
+//:
+//: o When a magazine is full, 'deallocate' moves a whole batch of blocks from
+//:   the magazine to the depot.
+//
+// The depot is protected by a spin lock that is taken once per batch.  A batch
+// holds up to 32 blocks (fewer for pools dispensing large blocks, so that a
+// batch holds about 8K bytes), and a magazine holds at most two batches, which
+// bounds the amount of memory cached by each thread.
+//
+// A block may be deallocated by a thread other than the one that allocated it:
+// the block is added to the magazine of the deallocating thread, from which it
+// can be reused by that thread or returned, as part of a batch, to the depot
+// and so to every other thread.  When a thread that used the allocator exits,
+// its magazines are flushed to the depots and its cache is recycled for the
+// next thread that uses the allocator.  A thread may also call
+// 'flushThreadCache' to return the blocks it caches, for example before
+// becoming idle.
+//
+///Thread Safety
+///-------------
+// 'bdlma::ThreadCachingMultipoolAllocator' is *fully thread-safe*, meaning
+// that any operation on the same object can be safely invoked from any
+// thread.  The behavior is undefined if the allocator is destroyed while
+// another thread is using it or is exiting after having used it.
+//
+// Each allocator uses a thread-specific storage key (see
+// 'bslmt::ThreadUtil::createKey'), of which a process has a limited number;
+// the allocator is therefore intended to be long-lived and shared, not created
+// per task.  If no key is available, the allocator does not cache blocks, and
+// behaves like a 'bdlma::ConcurrentMultipoolAllocator'.
+//
+///Releasing Memory
+///----------------
+// Unlike 'bdlma::ConcurrentMultipoolAllocator', this allocator does not
+// implement the 'bdlma::ManagedAllocator' protocol: because other threads'
+// magazines may refer to any pooled block, memory is released back to the
+// allocator supplied at construction only when the
+// 'bdlma::ThreadCachingMultipoolAllocator' is destroyed.  Blocks larger than
+// 'maxPooledBlockSize()' are returned to that allocator when deallocated.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing an Allocator Among Threads
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several worker threads each build a list, and that the lists
+// are later consumed and destroyed by the main thread.  Allocating the nodes
+// of the lists from a 'bdlma::ThreadCachingMultipoolAllocator' lets each
+// worker allocate without contending with the others, and lets the main
+// thread free nodes allocated by the workers.
+//
+// First, we define the arguments of a worker thread, and the function that
+// the worker threads run:
+//..
+//  struct WorkerArgs {
+//      // This 'struct' holds the arguments of a worker thread.
+//
+//      bslma::Allocator *d_allocator_p;  // allocator to use (held)
+//      int               d_numValues;    // number of values to append
+//      bsl::list<int>   *d_list_p;       // list built by the worker
+//  };
+//
+//  extern "C" void *worker(void *arg)
+//      // Create a list of the number of values indicated by the specified
+//      // 'arg', which must be the address of a 'WorkerArgs' object, using
+//      // its allocator.
+//  {
+//      WorkerArgs       *args      = static_cast<WorkerArgs *>(arg);
+//      bslma::Allocator *allocator = args->d_allocator_p;
+//
+//      args->d_list_p = new (*allocator) bsl::list<int>(allocator);
+//
+//      for (int i = 0; i < args->d_numValues; ++i) {
+//          args->d_list_p->push_back(i);
+//      }
+//      return 0;
+//  }
+//..
+// Then, we create the allocator, and start the worker threads:
+//..
+//  bdlma::ThreadCachingMultipoolAllocator allocator;
+//
+//  enum { k_NUM_THREADS = 4 };
+//
+//  WorkerArgs                args[k_NUM_THREADS];
+//  bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+//
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      args[i].d_allocator_p = &allocator;
+//      args[i].d_numValues   = 1000 * (i + 1);
+//      args[i].d_list_p      = 0;
+//
+//      int rc = bslmt::ThreadUtil::create(&handles[i], &worker, &args[i]);
+//      assert(0 == rc);
+//  }
+//..
+// Next, we wait for the workers to finish.  When a worker thread exits, the
+// nodes cached for it by the allocator are made available to other threads:
+//..
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      int rc = bslmt::ThreadUtil::join(handles[i]);
+//      assert(0 == rc);
+//  }
+//..
+// Finally, the main thread consumes and destroys the lists.  The nodes
+// deallocated here are cached for the main thread, and are reused by its
+// subsequent allocations, or handed back to the other threads in batches:
+//..
+//  for (int i = 0; i < k_NUM_THREADS; ++i) {
+//      assert(1000 * (i + 1) == static_cast<int>(args[i].d_list_p->size()));
+//
+//      allocator.deleteObject(args[i].d_list_p);
+//  }
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_BLOCKLIST
+#include <bdlma_blocklist.h>
+#endif
+
+#ifndef INCLUDED_BDLMA_CONCURRENTALLOCATORADAPTER
+#include <bdlma_concurrentallocatoradapter.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADUTIL
+#include <bslmt_threadutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ALIGNMENTUTIL
+#include <bsls_alignmentutil.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_SPINLOCK
+#include <bsls_spinlock.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+namespace BloombergLP {
+namespace bdlma {
+
+class ConcurrentPool;
+
+                   // =====================================
+                   // class ThreadCachingMultipoolAllocator
+                   // =====================================
+
+class ThreadCachingMultipoolAllocator : public bslma::Allocator {
+    // This class implements the 'bslma::Allocator' protocol to provide a
+    // thread-safe allocator that maintains a configurable number of
+    // 'ConcurrentPool' objects, each dispensing memory blocks of a unique
+    // size, with each successive pool managing memory blocks of size twice
+    // that of the previous pool.  Each thread using the allocator caches free
+    // blocks of each size, and exchanges them with the pools in batches.
+    // Blocks larger than those of the last pool are allocated directly from
+    // the allocator supplied at construction.  The destructor releases all
+    // memory allocated via this object.
+
+    // PRIVATE TYPES
+    union Header {
+        // This 'union' provides header information for each allocated memory
+        // block: the index of the pool that supplied the block, or -1 if the
+        // block was supplied directly by the underlying allocator.
+
+        int                                 d_poolIdx;  // pool of the block
+
+        bsls::AlignmentUtil::MaxAlignedType d_dummy;    // force maximum
+                                                        // alignment
+    };
+
+    struct FreeBlock {
+        // This 'struct' overlays a free pooled block (including its 'Header')
+        // that is held by a magazine or by a depot.
+
+        FreeBlock *d_next_p;       // next free block of the magazine or batch
+
+        FreeBlock *d_nextBatch_p;  // next batch of the depot (meaningful only
+                                   // for the first block of a batch)
+
+        int        d_numBlocks;    // number of blocks in the batch
+                                   // (meaningful only for the first block of
+                                   // a batch)
+    };
+
+    struct Magazine {
+        // This 'struct' holds the free blocks of one pool cached for one
+        // thread.
+
+        FreeBlock *d_head_p;     // list of free blocks
+        int        d_numBlocks;  // number of blocks in 'd_head_p'
+        int        d_capacity;   // number of blocks at which a batch is moved
+                                 // to the depot
+    };
+
+    struct Depot {
+        // This 'struct' holds the batches of free blocks of one pool that are
+        // not cached for any thread.
+
+        bsls::SpinLock  d_lock;       // protects 'd_batches_p'
+        FreeBlock      *d_batches_p;  // list of batches
+        int             d_batchSize;  // number of blocks of a batch taken
+                                      // from the pool or a full magazine
+        char            d_padding[64];
+                                      // keep depots on separate cache lines
+    };
+
+    struct ThreadCache {
+        // This 'struct' holds the magazines of one thread.  Caches are never
+        // deallocated before the allocator is destroyed; the cache of an
+        // exited thread is claimed by the next thread using the allocator.
+
+        ThreadCachingMultipoolAllocator *d_allocator_p;  // owning allocator
+
+        ThreadCache                     *d_next_p;       // next cache of the
+                                                         // allocator
+
+        bsls::AtomicInt                  d_isClaimed;    // 1 if in use by a
+                                                         // thread, 0 otherwise
+
+        Magazine                        *d_magazines_p;  // one magazine per
+                                                         // pool
+    };
+
+    // DATA
+    int                              d_numPools;      // number of pools
+
+    bsls::Types::size_type           d_maxBlockSize;  // largest pooled block
+                                                      // size
+
+    ConcurrentPool                  *d_pools_p;       // array of pools, each
+                                                      // dispensing fixed-size
+                                                      // memory blocks
+
+    Depot                           *d_depots_p;      // array of depots, one
+                                                      // per pool
+
+    bslmt::ThreadUtil::Key           d_key;           // key of the cache of
+                                                      // each thread
+
+    bool                             d_hasKey;        // 'true' if 'd_key' was
+                                                      // created
+
+    bsls::AtomicPointer<ThreadCache> d_caches;        // list of all caches
+
+    bdlma::BlockList                 d_blockList;     // memory manager for
+                                                      // "large" memory blocks
+
+    bslmt::Mutex                     d_mutex;         // synchronize access to
+                                                      // 'd_blockList' and the
+                                                      // underlying allocator
+
+    ConcurrentAllocatorAdapter       d_allocAdapter;  // thread-safe adapter
+
+  private:
+    // NOT IMPLEMENTED
+    ThreadCachingMultipoolAllocator(const ThreadCachingMultipoolAllocator&);
+    ThreadCachingMultipoolAllocator& operator=(
+                                       const ThreadCachingMultipoolAllocator&);
+
+    // PRIVATE CLASS METHODS
+    static void releaseThreadCache(void *cache);
+        // Flush the magazines of the specified 'cache' to the depots of its
+        // allocator, and make 'cache' available to be claimed by another
+        // thread.  Note that this function is called on exit by each thread
+        // having a cache.
+
+    // PRIVATE MANIPULATORS
+    void initialize(int maxBatchSize);
+        // Create the pools and depots of this allocator, each depot moving
+        // batches of at most the specified 'maxBatchSize' blocks, and the
+        // thread-specific storage key of this allocator.
+
+    ThreadCache *claimThreadCache();
+        // Claim a cache for the calling thread, creating one if no cache is
+        // available, and return its address, or 0 if the cache could not be
+        // associated with the calling thread.  The behavior is undefined
+        // unless 'd_hasKey' is 'true' and the calling thread has no cache.
+
+    void flushMagazines(ThreadCache *cache);
+        // Move all the blocks of the magazines of the specified 'cache' to the
+        // depots of this allocator.
+
+    void refillMagazine(Magazine *magazine, int pool);
+        // Load into the specified empty 'magazine' a batch of free blocks of
+        // the specified 'pool', taken from the depot of 'pool' if it is not
+        // empty, and allocated from 'pool' otherwise.
+
+    void releaseBatch(Magazine *magazine, int pool);
+        // Move a batch of blocks from the specified full 'magazine' to the
+        // depot of the specified 'pool'.
+
+    // PRIVATE ACCESSORS
+    int findPool(bsls::Types::size_type size) const;
+        // Return the index of the memory pool in this allocator for an
+        // allocation request of the specified 'size' (in bytes).  Note that
+        // the index of the memory pool managing memory blocks having the
+        // minimum block size is 0.
+
+  public:
+    // CREATORS
+    explicit ThreadCachingMultipoolAllocator(
+                                         bslma::Allocator *basicAllocator = 0);
+    explicit ThreadCachingMultipoolAllocator(
+                                         int               numPools,
+                                         bslma::Allocator *basicAllocator = 0);
+    ThreadCachingMultipoolAllocator(int               numPools,
+                                    int               maxBatchSize,
+                                    bslma::Allocator *basicAllocator = 0);
+        // Create a thread-caching multipool allocator.  Optionally specify
+        // 'numPools', indicating the number of internally created
+        // 'ConcurrentPool' objects; the block size of the first pool is 8
+        // bytes, with the block size of each additional pool successively
+        // doubling.  If 'numPools' is not specified, an implementation-defined
+        // number of pools 'N' -- covering memory blocks ranging in size from
+        // '2^3 = 8' to '2^(N+2)' -- are created.  Optionally specify a
+        // 'maxBatchSize', indicating the maximum number of blocks moved at
+        // once between the cache of a thread and a pool; each thread caches
+        // at most '2 * maxBatchSize' blocks of each pool.  If 'maxBatchSize'
+        // is not specified, an implementation-defined value is used.
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless '1 <= numPools' and
+        // '1 <= maxBatchSize'.
+
+    virtual ~ThreadCachingMultipoolAllocator();
+        // Destroy this allocator, releasing all memory allocated via this
+        // object.  The behavior is undefined if another thread is using this
+        // allocator, or is exiting after having used it.
+
+    // MANIPULATORS
+    virtual void *allocate(bsls::Types::size_type size);
+        // Return the address of a contiguous block of maximally-aligned memory
+        // of (at least) the specified 'size' (in bytes).  If 'size' is 0, no
+        // memory is allocated and 0 is returned.  If
+        // 'size > maxPooledBlockSize()', the memory is allocated directly from
+        // the underlying allocator.
+
+    virtual void deallocate(void *address);
+        // Relinquish the memory block at the specified 'address' back to this
+        // allocator for reuse.  If 'address' is 0, this method has no effect.
+        // The behavior is undefined unless 'address' was allocated by this
+        // allocator (by any thread), and has not already been deallocated.
+
+    void flushThreadCache();
+        // Return all the free blocks cached for the calling thread to the
+        // pools of this allocator, making them available to other threads.
+        // This method has no effect if the calling thread has no cache.
+
+    // ACCESSORS
+    int numPools() const;
+        // Return the number of pools managed by this allocator.
+
+    bsls::Types::size_type maxPooledBlockSize() const;
+        // Return the maximum size of memory blocks that are pooled by this
+        // allocator.  Note that the maximum value is defined as:
+        //..
+        //  2 ^ (numPools + 2)
+        //..
+        // where 'numPools' is either specified at construction, or an
+        // implementation-defined value.
+};
+
+// ============================================================================
+//                             INLINE DEFINITIONS
+// ============================================================================
+
+                   // -------------------------------------
+                   // class ThreadCachingMultipoolAllocator
+                   // -------------------------------------
+
+// ACCESSORS
+inline
+int ThreadCachingMultipoolAllocator::numPools() const
+{
+    return d_numPools;
+}
+
+inline
+bsls::Types::size_type
+ThreadCachingMultipoolAllocator::maxPooledBlockSize() const
+{
+    return d_maxBlockSize;
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1155 @@
+// bdlma_threadcachingmultipoolallocator.t.cpp                        -*-C++-*-
+#include <bdlma_threadcachingmultipoolallocator.h>
+
+#include <bdlma_concurrentmultipoolallocator.h>  // for testing only
+#include <bdlma_concurrentpoolallocator.h>       // for testing only
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_mallocfreeallocator.h>           // for testing only
+#include <bslma_testallocator.h>
+
+#include <bslmt_barrier.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_alignmentutil.h>
+#include <bsls_stopwatch.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>     // 'atoi'
+#include <bsl_cstring.h>     // 'memset'
+#include <bsl_iostream.h>
+#include <bsl_list.h>
+#include <bsl_set.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+
+using bsl::cout;
+using bsl::cerr;
+using bsl::endl;
+using bsl::flush;
+
+// ============================================================================
+//                                TEST PLAN
+// ----------------------------------------------------------------------------
+//                                 Overview
+//                                 --------
+// 'bdlma::ThreadCachingMultipoolAllocator' dispenses blocks from size classes
+// managed by 'bdlma::ConcurrentPool' objects, through per-thread caches that
+// exchange blocks with the pools in batches.  We first verify the behavior
+// observable from a single thread: the size classes, the alignment of the
+// blocks, the reuse of deallocated blocks, and the release of all memory on
+// destruction.  We then verify, using a test allocator to count the
+// allocations from the underlying allocator, that blocks cached for a thread
+// are made available to other threads by 'flushThreadCache', by batches
+// moved from full caches, and on thread exit, including blocks deallocated by
+// a thread other than the one that allocated them.  Finally, we stress the
+// allocator from many threads, checking that no block is dispensed twice.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] ThreadCachingMultipoolAllocator(Allocator *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(int numPools, Allocator *ba = 0);
+// [ 2] ThreadCachingMultipoolAllocator(int nP, int maxB, Allocator *ba);
+// [ 2] ~ThreadCachingMultipoolAllocator();
+//
+// MANIPULATORS
+// [ 3] void *allocate(bsls::Types::size_type size);
+// [ 3] void deallocate(void *address);
+// [ 4] void flushThreadCache();
+//
+// ACCESSORS
+// [ 2] int numPools() const;
+// [ 2] bsls::Types::size_type maxPooledBlockSize() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 5] CONCURRENCY
+// [ 6] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                       STANDARD BDE TEST DRIVER MACROS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define Q   BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P   BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_  BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_  BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_  BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                  GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlma::ThreadCachingMultipoolAllocator Obj;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+enum {
+    k_DEFAULT_NUM_POOLS = 10,   // implementation-defined number of pools
+    k_MAX_ALIGNMENT     = bsls::AlignmentUtil::BSLS_MAX_ALIGNMENT
+};
+
+// ============================================================================
+//                      HELPER FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+struct AllocateArgs {
+    // This 'struct' holds the arguments of the 'allocateBlocks' and
+    // 'deallocateBlocks' thread functions.
+
+    Obj                 *d_allocator_p;  // allocator under test
+    bsl::vector<void *> *d_blocks_p;     // blocks allocated or to deallocate
+    int                  d_numBlocks;    // number of blocks to allocate
+    int                  d_blockSize;    // size of the blocks to allocate
+    bool                 d_flush;        // call 'flushThreadCache' at the end
+};
+
+extern "C" void *allocateBlocks(void *arg)
+    // Append to the vector of the specified 'arg', which must be the address
+    // of an 'AllocateArgs' object, the addresses of the indicated number of
+    // blocks of the indicated size allocated from the indicated allocator.
+{
+    AllocateArgs *args = static_cast<AllocateArgs *>(arg);
+
+    for (int i = 0; i < args->d_numBlocks; ++i) {
+        args->d_blocks_p->push_back(
+                             args->d_allocator_p->allocate(args->d_blockSize));
+    }
+    if (args->d_flush) {
+        args->d_allocator_p->flushThreadCache();
+    }
+    return 0;
+}
+
+extern "C" void *deallocateBlocks(void *arg)
+    // Deallocate, using the allocator of the specified 'arg', which must be
+    // the address of an 'AllocateArgs' object, all the blocks of its vector,
+    // and clear the vector.
+{
+    AllocateArgs *args = static_cast<AllocateArgs *>(arg);
+
+    for (bsl::size_t i = 0; i < args->d_blocks_p->size(); ++i) {
+        args->d_allocator_p->deallocate((*args->d_blocks_p)[i]);
+    }
+    args->d_blocks_p->clear();
+    if (args->d_flush) {
+        args->d_allocator_p->flushThreadCache();
+    }
+    return 0;
+}
+
+void runInThread(bslmt_ThreadFunction function, AllocateArgs *args)
+    // Run the specified 'function' with the specified 'args' in a new thread,
+    // and wait for the thread to exit.
+{
+    bslmt::ThreadUtil::Handle handle;
+
+    int rc = bslmt::ThreadUtil::create(&handle, function, args);
+    ASSERT(0 == rc);
+
+    rc = bslmt::ThreadUtil::join(handle);
+    ASSERT(0 == rc);
+}
+
+                              // ==============
+                              // CONCURRENCY
+                              // ==============
+
+enum {
+    k_STRESS_NUM_THREADS = 8,
+    k_STRESS_NUM_SLOTS   = 64,    // live blocks per thread
+    k_STRESS_NUM_ROUNDS  = 50,
+    k_STRESS_NUM_OPS     = 2000   // operations per round
+};
+
+struct StressArgs {
+    // This 'struct' holds the arguments of the 'stressThread' function.
+
+    Obj             *d_allocator_p;   // allocator under test
+    bslmt::Barrier  *d_barrier_p;     // synchronizes rounds
+    unsigned char  **d_slots_p;       // live blocks of all threads
+    int             *d_sizes_p;       // sizes of the blocks of 'd_slots_p'
+    int              d_index;         // index of this thread
+    bsls::AtomicInt *d_numErrors_p;   // number of corrupted blocks found
+};
+
+unsigned int nextRandom(unsigned int *seed)
+    // Return a pseudo-random number, and update the specified 'seed'.
+{
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 16;
+}
+
+void checkAndFree(StressArgs *args, int slot)
+    // Verify that the block in the specified 'slot' of the specified 'args'
+    // holds the pattern written when it was allocated, deallocate it, and set
+    // 'slot' to 0.
+{
+    unsigned char *block = args->d_slots_p[slot];
+
+    if (!block) {
+        return;                                                       // RETURN
+    }
+
+    const unsigned char pattern = static_cast<unsigned char>(slot);
+    for (int i = 0; i < args->d_sizes_p[slot]; ++i) {
+        if (block[i] != pattern) {
+            ++*args->d_numErrors_p;
+            break;
+        }
+    }
+    args->d_allocator_p->deallocate(block);
+    args->d_slots_p[slot] = 0;
+}
+
+extern "C" void *stressThread(void *arg)
+    // Repeatedly replace random blocks of the slots owned by this thread,
+    // then, every other round, free the blocks owned by the next thread, as
+    // described by the specified 'arg', which must be the address of a
+    // 'StressArgs' object.
+{
+    StressArgs   *args  = static_cast<StressArgs *>(arg);
+    const int     first = args->d_index * k_STRESS_NUM_SLOTS;
+    unsigned int  seed  = args->d_index + 1;
+
+    for (int round = 0; round < k_STRESS_NUM_ROUNDS; ++round) {
+        for (int op = 0; op < k_STRESS_NUM_OPS; ++op) {
+            const int slot = first + nextRandom(&seed) % k_STRESS_NUM_SLOTS;
+
+            checkAndFree(args, slot);
+
+            // Favor small blocks, but exercise every pool and the large
+            // blocks.
+
+            const int r    = nextRandom(&seed) % 100;
+            const int size = r < 80 ? 1 + r
+                           : r < 99 ? 1 + nextRandom(&seed) % 4096
+                           : 4097 + nextRandom(&seed) % 10000;
+
+            unsigned char *block = static_cast<unsigned char *>(
+                                        args->d_allocator_p->allocate(size));
+            bsl::memset(block, static_cast<unsigned char>(slot), size);
+
+            args->d_slots_p[slot] = block;
+            args->d_sizes_p[slot] = size;
+        }
+
+        args->d_barrier_p->wait();
+
+        if (round % 2) {
+            const int next = (args->d_index + 1) % k_STRESS_NUM_THREADS;
+            for (int i = 0; i < k_STRESS_NUM_SLOTS; ++i) {
+                checkAndFree(args, next * k_STRESS_NUM_SLOTS + i);
+            }
+        }
+
+        args->d_barrier_p->wait();
+    }
+
+    for (int i = 0; i < k_STRESS_NUM_SLOTS; ++i) {
+        checkAndFree(args, first + i);
+    }
+    return 0;
+}
+
+                              // ===========
+                              // PERFORMANCE
+                              // ===========
+
+enum {
+    k_PERF_WINDOW     = 64,       // live blocks per thread
+    k_PERF_NUM_OPS    = 2000000,  // allocations per thread
+    k_PERF_BATCH      = 1000,     // blocks per hand-off
+    k_PERF_MAX_SIZE   = 256       // largest block size
+};
+
+struct PerfArgs {
+    // This 'struct' holds the arguments of the performance test threads.
+
+    bslma::Allocator *d_allocator_p;   // allocator to measure
+    bslmt::Barrier   *d_barrier_p;     // synchronizes hand-offs
+    void            **d_blocks_p;      // hand-off blocks of all threads
+    int               d_index;         // index of this thread
+    int               d_numThreads;    // number of threads
+};
+
+extern "C" void *localChurn(void *arg)
+    // Repeatedly replace a random block of a window of blocks of random sizes
+    // using the allocator of the specified 'arg', which must be the address
+    // of a 'PerfArgs' object.
+{
+    PerfArgs     *args = static_cast<PerfArgs *>(arg);
+    void         *window[k_PERF_WINDOW] = { 0 };
+    unsigned int  seed = args->d_index + 1;
+
+    for (int i = 0; i < k_PERF_NUM_OPS; ++i) {
+        const int slot = nextRandom(&seed) % k_PERF_WINDOW;
+
+        if (window[slot]) {
+            args->d_allocator_p->deallocate(window[slot]);
+        }
+        window[slot] = args->d_allocator_p->allocate(
+                                    1 + nextRandom(&seed) % k_PERF_MAX_SIZE);
+        *static_cast<char *>(window[slot]) = 0;
+    }
+    for (int i = 0; i < k_PERF_WINDOW; ++i) {
+        if (window[i]) {
+            args->d_allocator_p->deallocate(window[i]);
+        }
+    }
+    return 0;
+}
+
+extern "C" void *handOff(void *arg)
+    // Repeatedly allocate a batch of blocks, and deallocate the batch
+    // allocated by the next thread, using the allocator of the specified
+    // 'arg', which must be the address of a 'PerfArgs' object.
+{
+    PerfArgs     *args  = static_cast<PerfArgs *>(arg);
+    void        **mine  = args->d_blocks_p + args->d_index * k_PERF_BATCH;
+    void        **other = args->d_blocks_p
+                        + (args->d_index + 1) % args->d_numThreads
+                                                               * k_PERF_BATCH;
+    unsigned int  seed  = args->d_index + 1;
+
+    for (int round = 0; round < k_PERF_NUM_OPS / k_PERF_BATCH; ++round) {
+        for (int i = 0; i < k_PERF_BATCH; ++i) {
+            mine[i] = args->d_allocator_p->allocate(
+                                    1 + nextRandom(&seed) % k_PERF_MAX_SIZE);
+        }
+        args->d_barrier_p->wait();
+        for (int i = 0; i < k_PERF_BATCH; ++i) {
+            args->d_allocator_p->deallocate(other[i]);
+        }
+        args->d_barrier_p->wait();
+    }
+    return 0;
+}
+
+double runPerf(bslma::Allocator     *allocator,
+               bslmt_ThreadFunction  function,
+               int                   numThreads)
+    // Return the number of millions of allocations per second performed by
+    // the specified 'numThreads' threads running the specified 'function'
+    // with the specified 'allocator'.
+{
+    bsl::vector<void *>                    blocks(numThreads * k_PERF_BATCH);
+    bsl::vector<PerfArgs>                  args(numThreads);
+    bsl::vector<bslmt::ThreadUtil::Handle> handles(numThreads);
+    bslmt::Barrier                         barrier(numThreads);
+
+    bsls::Stopwatch timer;
+    timer.start(true);
+
+    for (int i = 0; i < numThreads; ++i) {
+        args[i].d_allocator_p = allocator;
+        args[i].d_barrier_p   = &barrier;
+        args[i].d_blocks_p    = &blocks[0];
+        args[i].d_index       = i;
+        args[i].d_numThreads  = numThreads;
+
+        int rc = bslmt::ThreadUtil::create(&handles[i], function, &args[i]);
+        ASSERT(0 == rc);
+    }
+    for (int i = 0; i < numThreads; ++i) {
+        bslmt::ThreadUtil::join(handles[i]);
+    }
+
+    timer.stop();
+
+    return numThreads * (k_PERF_NUM_OPS / 1.0e6) / timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace USAGE_EXAMPLE {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Sharing an Allocator Among Threads
+///- - - - - - - - - - - - - - - - - - - - - - -
+// Suppose that several worker threads each build a list, and that the lists
+// are later consumed and destroyed by the main thread.  Allocating the nodes
+// of the lists from a 'bdlma::ThreadCachingMultipoolAllocator' lets each
+// worker allocate without contending with the others, and lets the main
+// thread free nodes allocated by the workers.
+//
+// First, we define the arguments of a worker thread, and the function that
+// the worker threads run:
+//..
+    struct WorkerArgs {
+        // This 'struct' holds the arguments of a worker thread.
+
+        bslma::Allocator *d_allocator_p;  // allocator to use (held)
+        int               d_numValues;    // number of values to append
+        bsl::list<int>   *d_list_p;       // list built by the worker
+    };
+
+    extern "C" void *worker(void *arg)
+        // Create a list of the number of values indicated by the specified
+        // 'arg', which must be the address of a 'WorkerArgs' object, using
+        // its allocator.
+    {
+        WorkerArgs       *args      = static_cast<WorkerArgs *>(arg);
+        bslma::Allocator *allocator = args->d_allocator_p;
+
+        args->d_list_p = new (*allocator) bsl::list<int>(allocator);
+
+        for (int i = 0; i < args->d_numValues; ++i) {
+            args->d_list_p->push_back(i);
+        }
+        return 0;
+    }
+//..
+
+}  // close namespace USAGE_EXAMPLE
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard guard(&defaultAllocator);
+
+    switch (test) { case 0:
+      case 6: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+        using namespace USAGE_EXAMPLE;
+
+// Then, we create the allocator, and start the worker threads:
+//..
+    bdlma::ThreadCachingMultipoolAllocator allocator;
+
+    enum { k_NUM_THREADS = 4 };
+
+    WorkerArgs                args[k_NUM_THREADS];
+    bslmt::ThreadUtil::Handle handles[k_NUM_THREADS];
+
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        args[i].d_allocator_p = &allocator;
+        args[i].d_numValues   = 1000 * (i + 1);
+        args[i].d_list_p      = 0;
+
+        int rc = bslmt::ThreadUtil::create(&handles[i], &worker, &args[i]);
+        ASSERT(0 == rc);
+    }
+//..
+// Next, we wait for the workers to finish.  When a worker thread exits, the
+// nodes cached for it by the allocator are made available to other threads:
+//..
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        int rc = bslmt::ThreadUtil::join(handles[i]);
+        ASSERT(0 == rc);
+    }
+//..
+// Finally, the main thread consumes and destroys the lists.  The nodes
+// deallocated here are cached for the main thread, and are reused by its
+// subsequent allocations, or handed back to the other threads in batches:
+//..
+    for (int i = 0; i < k_NUM_THREADS; ++i) {
+        ASSERT(1000 * (i + 1) == static_cast<int>(args[i].d_list_p->size()));
+
+        allocator.deleteObject(args[i].d_list_p);
+    }
+//..
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY
+        //   Ensure that the allocator can be used concurrently.
+        //
+        // Concerns:
+        //: 1 A block is never dispensed to two threads at once, whether it
+        //:   comes from a thread cache, a depot, a pool, or the underlying
+        //:   allocator.
+        //:
+        //: 2 Blocks may be deallocated by a thread other than the one that
+        //:   allocated them.
+        //:
+        //: 3 All memory is returned to the underlying allocator on
+        //:   destruction.
+        //
+        // Plan:
+        //: 1 In several threads, repeatedly replace random blocks of random
+        //:   sizes, writing a pattern in each block, and, periodically, free
+        //:   all the blocks of another thread.  Verify that the pattern of
+        //:   each block is intact when it is freed.  (C-1..2)
+        //:
+        //: 2 Use a test allocator, and verify that no memory is in use after
+        //:   the allocator is destroyed.  (C-3)
+        //
+        // Testing:
+        //   CONCURRENCY
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY" << endl
+                          << "===========" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int maxBatchSize = 1; maxBatchSize <= 64; maxBatchSize *= 4) {
+            if (veryVerbose) { T_ P(maxBatchSize) }
+
+            {
+                Obj mX(k_DEFAULT_NUM_POOLS, maxBatchSize, &ta);
+
+                bsl::vector<unsigned char *> slots(
+                                    k_STRESS_NUM_THREADS * k_STRESS_NUM_SLOTS,
+                                    static_cast<unsigned char *>(0));
+                bsl::vector<int>             sizes(slots.size(), 0);
+                bslmt::Barrier               barrier(k_STRESS_NUM_THREADS);
+                bsls::AtomicInt              numErrors(0);
+
+                StressArgs                args[k_STRESS_NUM_THREADS];
+                bslmt::ThreadUtil::Handle handles[k_STRESS_NUM_THREADS];
+
+                for (int i = 0; i < k_STRESS_NUM_THREADS; ++i) {
+                    args[i].d_allocator_p  = &mX;
+                    args[i].d_barrier_p    = &barrier;
+                    args[i].d_slots_p      = &slots[0];
+                    args[i].d_sizes_p      = &sizes[0];
+                    args[i].d_index        = i;
+                    args[i].d_numErrors_p  = &numErrors;
+
+                    int rc = bslmt::ThreadUtil::create(&handles[i],
+                                                       &stressThread,
+                                                       &args[i]);
+                    ASSERT(0 == rc);
+                }
+                for (int i = 0; i < k_STRESS_NUM_THREADS; ++i) {
+                    int rc = bslmt::ThreadUtil::join(handles[i]);
+                    ASSERT(0 == rc);
+                }
+
+                ASSERTV(maxBatchSize, numErrors, 0 == numErrors);
+                ASSERT(0 < ta.numBlocksInUse());
+            }
+            ASSERTV(maxBatchSize, ta.numBlocksInUse(),
+                    0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // BATCHED EXCHANGE BETWEEN THREADS
+        //   Ensure that blocks cached for a thread are made available to
+        //   other threads.
+        //
+        // Concerns:
+        //: 1 'flushThreadCache' makes all the blocks cached for the calling
+        //:   thread available to other threads.
+        //:
+        //: 2 When a thread exits, the blocks cached for it are made available
+        //:   to other threads.
+        //:
+        //: 3 Blocks deallocated by a thread other than the one that allocated
+        //:   them can be reused by any thread.
+        //:
+        //: 4 A thread caches a bounded number of blocks: blocks beyond the
+        //:   capacity of its cache are moved, in batches, to be available to
+        //:   other threads.
+        //:
+        //: 5 'flushThreadCache' has no effect in a thread without a cache.
+        //
+        // Plan:
+        //: 1 Allocate blocks in one thread and deallocate them in another
+        //:   thread that calls 'flushThreadCache' and then waits.  Verify that
+        //:   a third thread can allocate as many blocks without any allocation
+        //:   from the underlying allocator.  (C-1, 3)
+        //:
+        //: 2 Repeat P-1 without calling 'flushThreadCache'; the deallocating
+        //:   thread exits instead.  (C-2..3)
+        //:
+        //: 3 In the main thread, deallocate many blocks, without calling
+        //:   'flushThreadCache', and verify that another thread can allocate
+        //:   all but '2 * maxBatchSize' of them without any allocation from
+        //:   the underlying allocator.  (C-4)
+        //:
+        //: 4 Call 'flushThreadCache' from a thread that has never used the
+        //:   allocator.  (C-5)
+        //
+        // Testing:
+        //   void flushThreadCache();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BATCHED EXCHANGE BETWEEN THREADS" << endl
+                          << "================================" << endl;
+
+        enum { k_NUM_BLOCKS = 1000, k_BLOCK_SIZE = 24, k_MAX_BATCH = 16 };
+
+        if (verbose) cout << "\nTesting 'flushThreadCache'." << endl;
+
+        for (int flush = 0; flush < 2; ++flush) {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            Obj                  mX(k_DEFAULT_NUM_POOLS, k_MAX_BATCH, &ta);
+
+            bsl::vector<void *> blocks;
+            AllocateArgs        args = {
+                &mX, &blocks, k_NUM_BLOCKS, k_BLOCK_SIZE, true
+            };
+
+            runInThread(&allocateBlocks, &args);
+            ASSERT(k_NUM_BLOCKS == static_cast<int>(blocks.size()));
+
+            bsl::set<void *> allocated(blocks.begin(), blocks.end());
+            ASSERT(k_NUM_BLOCKS == static_cast<int>(allocated.size()));
+
+            // Deallocate in another thread, which, if 'flush' is 'true',
+            // flushes its cache explicitly (before exiting).
+
+            args.d_flush = flush;
+            runInThread(&deallocateBlocks, &args);
+            ASSERT(blocks.empty());
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            args.d_flush = false;
+            runInThread(&allocateBlocks, &args);
+
+            ASSERTV(flush, numAllocations, ta.numAllocations(),
+                    numAllocations == ta.numAllocations());
+
+            // The blocks are the ones allocated by the first thread.
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                ASSERTV(flush, i, allocated.count(blocks[i]));
+            }
+
+            runInThread(&deallocateBlocks, &args);
+        }
+
+        if (verbose) cout << "\nTesting the capacity of thread caches."
+                          << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            Obj                  mX(k_DEFAULT_NUM_POOLS, k_MAX_BATCH, &ta);
+
+            // Create the cache of the main thread, so that the cache of the
+            // thread below is recycled by the next thread.
+
+            mX.deallocate(mX.allocate(k_BLOCK_SIZE));
+
+            bsl::vector<void *> blocks;
+            AllocateArgs        args = {
+                &mX, &blocks, k_NUM_BLOCKS, k_BLOCK_SIZE, true
+            };
+
+            runInThread(&allocateBlocks, &args);
+
+            // Deallocate in the main thread, which does not flush its cache.
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                mX.deallocate(blocks[i]);
+            }
+            blocks.clear();
+
+            // At most '2 * k_MAX_BATCH - 1' blocks remain cached for the main
+            // thread.
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            args.d_numBlocks = k_NUM_BLOCKS - 2 * k_MAX_BATCH + 1;
+            args.d_flush     = false;
+            runInThread(&allocateBlocks, &args);
+
+            ASSERTV(numAllocations, ta.numAllocations(),
+                    numAllocations == ta.numAllocations());
+
+            runInThread(&deallocateBlocks, &args);
+            mX.flushThreadCache();
+        }
+
+        if (verbose) cout << "\nTesting a thread without a cache." << endl;
+        {
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+            Obj                  mX(&ta);
+
+            const bsls::Types::Int64 numAllocations = ta.numAllocations();
+
+            mX.flushThreadCache();
+
+            ASSERT(numAllocations == ta.numAllocations());
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // ALLOCATE AND DEALLOCATE
+        //   Ensure that 'allocate' and 'deallocate' dispense and reclaim
+        //   blocks of the expected size classes.
+        //
+        // Concerns:
+        //: 1 'allocate' returns maximally aligned, distinct, writable blocks
+        //:   of at least the requested size.
+        //:
+        //: 2 'allocate(0)' returns 0, and 'deallocate(0)' has no effect.
+        //:
+        //: 3 A deallocated block is reused by the next allocation of the same
+        //:   size class in the same thread.
+        //:
+        //: 4 Blocks larger than 'maxPooledBlockSize()' are allocated from, and
+        //:   returned to, the underlying allocator on each call.
+        //:
+        //: 5 The same blocks are dispensed for all the sizes of a size class.
+        //
+        // Plan:
+        //: 1 For each size up to 'maxPooledBlockSize() + 1', allocate, verify
+        //:   the alignment, write the whole block, and deallocate it.  Verify
+        //:   that allocating the same size again returns the same block.
+        //:   (C-1, 3)
+        //:
+        //: 2 Call 'allocate(0)' and 'deallocate(0)'.  (C-2)
+        //:
+        //: 3 Allocate and deallocate blocks larger than
+        //:   'maxPooledBlockSize()', and verify the number of blocks in use
+        //:   of the underlying test allocator.  (C-4)
+        //:
+        //: 4 For each size class, allocate and deallocate a block of the
+        //:   smallest size, and verify that allocating the largest size of the
+        //:   class returns the same block.  (C-5)
+        //
+        // Testing:
+        //   void *allocate(bsls::Types::size_type size);
+        //   void deallocate(void *address);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "ALLOCATE AND DEALLOCATE" << endl
+                          << "=======================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(4, &ta);
+
+            const int MAX = static_cast<int>(mX.maxPooledBlockSize());
+            ASSERT(64 == MAX);
+
+            if (verbose) cout << "\nTesting pooled blocks." << endl;
+
+            for (int size = 1; size <= MAX; ++size) {
+                char *p = static_cast<char *>(mX.allocate(size));
+
+                ASSERTV(size, 0 == reinterpret_cast<bsls::Types::UintPtr>(p)
+                                                       % k_MAX_ALIGNMENT);
+                bsl::memset(p, 0xa5, size);
+
+                mX.deallocate(p);
+
+                ASSERTV(size, p == mX.allocate(size));
+                mX.deallocate(p);
+            }
+
+            if (verbose) cout << "\nTesting size classes." << endl;
+
+            for (int size = 8; size <= MAX; size *= 2) {
+                void *p = mX.allocate(size / 2 + 1);
+                mX.deallocate(p);
+
+                ASSERTV(size, p == mX.allocate(size));
+
+                void *q = mX.allocate(size);
+                ASSERTV(size, p != q);
+
+                mX.deallocate(q);
+                mX.deallocate(p);
+            }
+
+            if (verbose) cout << "\nTesting zero." << endl;
+
+            ASSERT(0 == mX.allocate(0));
+            mX.deallocate(0);
+
+            if (verbose) cout << "\nTesting large blocks." << endl;
+
+            const bsls::Types::Int64 numBlocks = ta.numBlocksInUse();
+
+            for (int size = MAX + 1; size <= 4 * MAX; size += 17) {
+                char *p = static_cast<char *>(mX.allocate(size));
+
+                ASSERTV(size, 0 == reinterpret_cast<bsls::Types::UintPtr>(p)
+                                                       % k_MAX_ALIGNMENT);
+                ASSERTV(size, numBlocks + 1 == ta.numBlocksInUse());
+                bsl::memset(p, 0xa5, size);
+
+                mX.deallocate(p);
+                ASSERTV(size, numBlocks == ta.numBlocksInUse());
+            }
+
+            if (verbose) cout << "\nTesting distinct blocks." << endl;
+
+            bsl::vector<char *> blocks;
+            for (int i = 0; i < 1000; ++i) {
+                const int size = 1 + i % (2 * MAX);
+
+                blocks.push_back(static_cast<char *>(mX.allocate(size)));
+                bsl::memset(blocks.back(), i & 0xff, size);
+            }
+            for (int i = 0; i < 1000; ++i) {
+                const int size = 1 + i % (2 * MAX);
+
+                for (int j = 0; j < size; ++j) {
+                    ASSERTV(i, j, static_cast<char>(i & 0xff) ==
+                                                              blocks[i][j]);
+                }
+            }
+            for (int i = 0; i < 1000; i += 2) {
+                mX.deallocate(blocks[i]);
+            }
+            for (int i = 1; i < 1000; i += 2) {
+                mX.deallocate(blocks[i]);
+            }
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS AND ACCESSORS
+        //   Ensure that the allocator is created with the expected pools, and
+        //   uses the expected underlying allocator.
+        //
+        // Concerns:
+        //: 1 'numPools' returns the number of pools specified at construction,
+        //:   or the implementation-defined default.
+        //:
+        //: 2 'maxPooledBlockSize' returns '2 ^ (numPools + 2)'.
+        //:
+        //: 3 Memory is supplied by the specified allocator, or by the default
+        //:   allocator if none is specified.
+        //:
+        //: 4 The destructor releases all memory, including the blocks that
+        //:   were not deallocated, and the blocks cached for threads.
+        //:
+        //: 5 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor, with and without an
+        //:   allocator, verify the accessors, allocate blocks of every size
+        //:   class without deallocating some of them, and verify that no
+        //:   memory is in use after destruction.  (C-1..4)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-5)
+        //
+        // Testing:
+        //   ThreadCachingMultipoolAllocator(Allocator *ba = 0);
+        //   ThreadCachingMultipoolAllocator(int numPools, Allocator *ba = 0);
+        //   ThreadCachingMultipoolAllocator(int nP, int maxB, Allocator *ba);
+        //   ~ThreadCachingMultipoolAllocator();
+        //   int numPools() const;
+        //   bsls::Types::size_type maxPooledBlockSize() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS AND ACCESSORS" << endl
+                          << "======================" << endl;
+
+        for (char cfg = 'a'; cfg <= 'f'; ++cfg) {
+            const char CONFIG = cfg;
+
+            bslma::TestAllocator ta("object", veryVeryVerbose);
+
+            const bsls::Types::Int64 numDefault =
+                                             defaultAllocator.numBlocksTotal();
+
+            Obj *objPtr;
+            int  numPools = k_DEFAULT_NUM_POOLS;
+
+            switch (CONFIG) {
+              case 'a': {
+                objPtr = new (ta) Obj();
+              } break;
+              case 'b': {
+                objPtr = new (ta) Obj(&ta);
+              } break;
+              case 'c': {
+                numPools = 3;
+                objPtr   = new (ta) Obj(numPools);
+              } break;
+              case 'd': {
+                numPools = 1;
+                objPtr   = new (ta) Obj(numPools, &ta);
+              } break;
+              case 'e': {
+                numPools = 12;
+                objPtr   = new (ta) Obj(numPools, 1, &ta);
+              } break;
+              case 'f': {
+                numPools = 5;
+                objPtr   = new (ta) Obj(numPools, 100, &ta);
+              } break;
+              default: {
+                ASSERTV(CONFIG, !"Bad allocator config.");
+                return testStatus;                                    // RETURN
+              } break;
+            }
+
+            Obj&       mX = *objPtr;
+            const Obj& X  = mX;
+
+            bslma::TestAllocator& oa = 'a' == CONFIG || 'c' == CONFIG
+                                       ? defaultAllocator
+                                       : ta;
+
+            ASSERTV(CONFIG, numPools == X.numPools());
+            ASSERTV(CONFIG, static_cast<bsls::Types::size_type>(4)
+                                    << numPools == X.maxPooledBlockSize());
+
+            const bsls::Types::size_type MAX = X.maxPooledBlockSize();
+
+            for (bsls::Types::size_type size = 1; size <= 2 * MAX; size *= 2)
+            {
+                void *p = mX.allocate(size);
+                void *q = mX.allocate(size);
+                ASSERTV(CONFIG, size, p && q && p != q);
+
+                mX.deallocate(p);
+            }
+            ASSERTV(CONFIG, 0 < oa.numBlocksInUse());
+
+            if ('b' == CONFIG || 'd' == CONFIG || 'e' == CONFIG
+                                                            || 'f' == CONFIG) {
+                ASSERTV(CONFIG, numDefault ==
+                                            defaultAllocator.numBlocksTotal());
+            }
+
+            ta.deleteObject(objPtr);
+
+            ASSERTV(CONFIG, 0 == ta.numBlocksInUse());
+            ASSERTV(CONFIG, 0 == defaultAllocator.numBlocksInUse());
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Allocate and deallocate blocks of various sizes, in the main
+        //:   thread and in another thread.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(&ta);
+
+            void *p1 = mX.allocate(1);
+            void *p2 = mX.allocate(100);
+            void *p3 = mX.allocate(100000);
+            ASSERT(p1 && p2 && p3);
+            ASSERT(p1 != p2 && p2 != p3 && p1 != p3);
+
+            bsl::memset(p1, 1, 1);
+            bsl::memset(p2, 2, 100);
+            bsl::memset(p3, 3, 100000);
+
+            mX.deallocate(p2);
+            ASSERT(p2 == mX.allocate(65));
+
+            bsl::vector<void *> blocks;
+            AllocateArgs        args = { &mX, &blocks, 100, 40, false };
+
+            runInThread(&allocateBlocks, &args);
+            ASSERT(100 == static_cast<int>(blocks.size()));
+
+            for (bsl::size_t i = 0; i < blocks.size(); ++i) {
+                mX.deallocate(blocks[i]);
+            }
+
+            mX.deallocate(p1);
+            mX.deallocate(p2);
+            mX.deallocate(p3);
+        }
+        ASSERT(0 == ta.numBlocksInUse());
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //   Compare the throughput of this allocator with that of the other
+        //   thread-safe allocators.
+        //
+        // Concerns:
+        //: 1 With several threads, allocating and deallocating through thread
+        //:   caches is faster than through the shared free lists of
+        //:   'bdlma::ConcurrentMultipoolAllocator' and
+        //:   'bdlma::ConcurrentPoolAllocator'.
+        //
+        // Plan:
+        //: 1 For 1, 2, 4, and 8 threads, measure the number of allocations
+        //:   per second for two workloads: each thread repeatedly replacing a
+        //:   random block of a small window of blocks ("local"), and each
+        //:   thread allocating batches of blocks that are deallocated by
+        //:   another thread ("hand-off").  Block sizes are random, from 1 to
+        //:   256 bytes.  Compare 'bdlma::ThreadCachingMultipoolAllocator',
+        //:   'bdlma::ConcurrentMultipoolAllocator',
+        //:   'bdlma::ConcurrentPoolAllocator' (with 256-byte blocks), and
+        //:   'bslma::MallocFreeAllocator'.
+        //
+        // Testing:
+        //   PERFORMANCE TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE TEST" << endl
+                          << "================" << endl;
+
+        const char *const NAMES[] = {
+            "ThreadCachingMultipool",
+            "ConcurrentMultipool   ",
+            "ConcurrentPool        ",
+            "malloc                "
+        };
+        const int NUM_ALLOCATORS = sizeof NAMES / sizeof *NAMES;
+
+        const bslmt_ThreadFunction WORKLOADS[] = { &localChurn, &handOff };
+        const char *const WORKLOAD_NAMES[] = { "local", "hand-off" };
+
+        cout << "Millions of allocations per second:" << endl;
+
+        for (int w = 0; w < 2; ++w) {
+            cout << endl << WORKLOAD_NAMES[w] << endl;
+            cout << "                        "
+                 << "    1 thr    2 thr    4 thr    8 thr" << endl;
+
+            for (int a = 0; a < NUM_ALLOCATORS; ++a) {
+                cout << NAMES[a] << "  ";
+
+                for (int numThreads = 1; numThreads <= 8; numThreads *= 2) {
+                    bslma::Allocator *sa =
+                                      &bslma::MallocFreeAllocator::singleton();
+
+                    Obj                                 tcmp(sa);
+                    bdlma::ConcurrentMultipoolAllocator cmp(sa);
+                    bdlma::ConcurrentPoolAllocator      cp(k_PERF_MAX_SIZE,
+                                                           sa);
+
+                    bslma::Allocator *const ALLOCATORS[] = {
+                        &tcmp, &cmp, &cp, sa
+                    };
+
+                    const double rate = runPerf(ALLOCATORS[a],
+                                                WORKLOADS[w],
+                                                numThreads);
+
+                    cout.width(9);
+                    cout.precision(1);
+                    cout << bsl::fixed << rate;
+                }
+                cout << endl;
+            }
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
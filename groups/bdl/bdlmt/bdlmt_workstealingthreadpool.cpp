@@ -0,0 +1,560 @@
+// bdlmt_workstealingthreadpool.cpp                                   -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(bdlmt_workstealingthreadpool_cpp,"$Id$ $CSID$")
+
+#include <bslmt_lockguard.h>
+#include <bslmt_once.h>
+#include <bslmt_threadlocalvariable.h>
+#include <bslmt_threadutil.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_performancehint.h>
+#include <bsls_timeutil.h>
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+#include <bsl_c_signal.h>              // sigfillset
+#endif
+
+#include <bsl_algorithm.h>
+
+///Implementation Note
+///===================
+// Each worker owns a 'bsl::deque' of jobs protected by a mutex.  The owner
+// pushes and pops at the back of its deque, while thieves pop at the front,
+// so that the owner and a thief only contend on the mutex (the critical
+// sections are a few instructions long) and never on the same job.  A mutex is
+// used rather than a lock-free deque, because 'bsl::function' objects cannot
+// be copied out of a slot atomically.
+//
+// 'd_numPendingJobs' is updated under the mutex of the deque being modified,
+// so that it never underestimates the number of jobs that can be popped.  An
+// idle worker registers itself in 'd_numIdleThreads', and then checks
+// 'd_numPendingJobs' (and 'd_runningFlag') before waiting on
+// 'd_idleSemaphore'.  A thread enqueuing a job increments 'd_numPendingJobs',
+// and then checks 'd_numIdleThreads'.  Since all of these operations are
+// sequentially consistent, either the idle worker sees the new job, or the
+// enqueuing thread sees the idle worker.  As in 'bdlcc::BoundedQueue', a
+// waking thread *claims* the registrations of the threads it wakes up, so
+// that the semaphore is never posted more often than there are waiting
+// threads.
+
+namespace {
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+void initBlockSet(sigset_t *blockSet)
+{
+    sigfillset(blockSet);
+
+    const int synchronousSignals[] = {
+      SIGBUS,
+      SIGFPE,
+      SIGILL,
+      SIGSEGV,
+      SIGSYS,
+      SIGABRT,
+      SIGTRAP,
+     #if !defined(BSLS_PLATFORM_OS_CYGWIN) || defined(SIGIOT)
+      SIGIOT
+     #endif
+    };
+
+    const int SIZE = sizeof synchronousSignals / sizeof *synchronousSignals;
+
+    for (int i=0; i < SIZE; ++i) {
+        sigdelset(blockSet, synchronousSignals[i]);
+    }
+}
+#endif
+
+// Define a thread-local variable, 'g_currentWorker', (on supported platforms)
+// that will serve as cache for 'bslmt::ThreadUtil::getSpecific'; on other
+// platforms, the worker is held in thread-specific storage.
+
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+BSLMT_THREAD_LOCAL_VARIABLE(BloombergLP::bdlmt::WorkStealingThreadPool_Worker*,
+                            g_currentWorker,
+                            0);
+#else
+const BloombergLP::bslmt::ThreadUtil::Key& currentWorkerKey()
+    // Return a reference to the thread-specific storage key holding the
+    // address of the worker running in the calling thread.
+{
+    static BloombergLP::bslmt::ThreadUtil::Key s_currentWorkerKey;
+    BSLMT_ONCE_DO {
+        BloombergLP::bslmt::ThreadUtil::createKey(&s_currentWorkerKey, 0);
+    }
+    return s_currentWorkerKey;
+}
+#endif
+
+}  // close unnamed namespace
+
+namespace BloombergLP {
+namespace bdlmt {
+
+                    // ------------------------------------
+                    // struct WorkStealingThreadPool_Worker
+                    // ------------------------------------
+
+// CREATORS
+WorkStealingThreadPool_Worker::WorkStealingThreadPool_Worker(
+                                       WorkStealingThreadPool *pool,
+                                       int                     index,
+                                       bslma::Allocator       *basicAllocator)
+: d_jobs(basicAllocator)
+, d_numJobs(0)
+, d_pool_p(pool)
+, d_index(index)
+, d_randomState(static_cast<unsigned int>(index) * 2654435761U + 1)
+, d_numJobsExecuted(0)
+, d_numJobsStolen(0)
+, d_numStealFailures(0)
+, d_idleTime(0)
+{
+}
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// PRIVATE CLASS METHODS
+WorkStealingThreadPool::Worker *WorkStealingThreadPool::currentWorker()
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    return g_currentWorker;
+#else
+    return static_cast<Worker *>(
+                          bslmt::ThreadUtil::getSpecific(currentWorkerKey()));
+#endif
+}
+
+void WorkStealingThreadPool::setCurrentWorker(Worker *worker)
+{
+#ifdef BSLMT_THREAD_LOCAL_VARIABLE
+    g_currentWorker = worker;
+#else
+    bslmt::ThreadUtil::setSpecific(currentWorkerKey(), worker);
+#endif
+}
+
+// PRIVATE MANIPULATORS
+void WorkStealingThreadPool::completeJob()
+{
+    if (0 == d_numUnfinishedJobs.add(-1)) {
+        bslmt::LockGuard<bslmt::Mutex> lock(&d_drainMutex);
+        d_drainCondition.broadcast();
+    }
+}
+
+bool WorkStealingThreadPool::popLocalJob(Job *job, Worker *worker)
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&worker->d_mutex);
+
+    if (worker->d_jobs.empty()) {
+        return false;                                                 // RETURN
+    }
+
+    job->swap(worker->d_jobs.back());
+    worker->d_jobs.pop_back();
+    worker->d_numJobs.storeRelaxed(static_cast<int>(worker->d_jobs.size()));
+    d_numPendingJobs.add(-1);
+    return true;
+}
+
+void WorkStealingThreadPool::pushJob(const Job& job, Worker *worker)
+{
+    {
+        bslmt::LockGuard<bslmt::Mutex> lock(&worker->d_mutex);
+
+        worker->d_jobs.push_back(job);
+        worker->d_numJobs.storeRelaxed(
+                                     static_cast<int>(worker->d_jobs.size()));
+        d_numPendingJobs.add(1);
+    }
+
+    wakeIdleThreads(1);
+}
+
+void WorkStealingThreadPool::removeAllJobs()
+{
+    for (int i = 0; i < d_numThreads; ++i) {
+        Worker          *worker = d_workers[i];
+        bsl::deque<Job>  jobs(d_allocator_p);
+        {
+            bslmt::LockGuard<bslmt::Mutex> lock(&worker->d_mutex);
+
+            jobs.swap(worker->d_jobs);
+            worker->d_numJobs.storeRelaxed(0);
+            d_numPendingJobs.add(-static_cast<int>(jobs.size()));
+        }
+
+        // Destroy the jobs without holding the lock, and then account for
+        // their (non-)completion.
+
+        const int numJobs = static_cast<int>(jobs.size());
+        jobs.clear();
+
+        if (numJobs && 0 == d_numUnfinishedJobs.add(-numJobs)) {
+            bslmt::LockGuard<bslmt::Mutex> lock(&d_drainMutex);
+            d_drainCondition.broadcast();
+        }
+    }
+}
+
+int WorkStealingThreadPool::startNewThread(int index)
+{
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Block all asynchronous signals.
+
+    sigset_t oldset;
+    pthread_sigmask(SIG_BLOCK, &d_blockSet, &oldset);
+#endif
+
+    int rc = d_threadGroup.addThread(
+                  bdlf::BindUtil::bind(&WorkStealingThreadPool::workerThread,
+                                       this,
+                                       index),
+                  d_threadAttributes);
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    // Restore the mask.
+
+    pthread_sigmask(SIG_SETMASK, &oldset, &d_blockSet);
+#endif
+
+    return rc;
+}
+
+bool WorkStealingThreadPool::stealJob(Job *job, Worker *thief)
+{
+    if (1 == d_numThreads) {
+        return false;                                                 // RETURN
+    }
+
+    if (0 >= d_numPendingJobs.loadRelaxed()) {
+        thief->d_numStealFailures.addRelaxed(1);
+        return false;                                                 // RETURN
+    }
+
+    // Select the first victim with a xorshift generator, and visit the other
+    // workers in order from there.
+
+    unsigned int x = thief->d_randomState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    thief->d_randomState = x;
+
+    const int start = static_cast<int>(x % d_numThreads);
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        Worker *victim = d_workers[(start + i) % d_numThreads];
+        if (victim == thief || 0 == victim->d_numJobs.loadRelaxed()) {
+            // Do not lock the mutex of a worker whose queue is empty.
+
+            continue;
+        }
+
+        bslmt::LockGuard<bslmt::Mutex> lock(&victim->d_mutex);
+
+        if (!victim->d_jobs.empty()) {
+            job->swap(victim->d_jobs.front());
+            victim->d_jobs.pop_front();
+            d_numPendingJobs.add(-1);
+
+            thief->d_numJobsStolen.addRelaxed(1);
+            return true;                                              // RETURN
+        }
+    }
+
+    thief->d_numStealFailures.addRelaxed(1);
+    return false;
+}
+
+void WorkStealingThreadPool::stopThreads()
+{
+    d_runningFlag = 0;
+
+    // Claim every registered idle thread.
+
+    const int numIdleThreads = d_numIdleThreads.swap(0);
+    for (int i = 0; i < numIdleThreads; ++i) {
+        d_idleSemaphore.post();
+    }
+
+    d_threadGroup.joinAll();
+
+    // Discard any job enqueued concurrently with the call to 'disable'
+    // preceding this call, after the processing threads stopped looking for
+    // jobs.
+
+    removeAllJobs();
+}
+
+void WorkStealingThreadPool::waitForJob(Worker *worker)
+{
+    const bsls::Types::Int64 start = bsls::TimeUtil::getTimer();
+
+    d_numIdleThreads.add(1);
+
+    if (0 >= d_numPendingJobs && d_runningFlag) {
+        d_idleSemaphore.wait();
+    }
+    else {
+        // Withdraw the registration.  If every registration has already been
+        // claimed, a post is (or will be) pending for this thread.
+
+        int numIdle = d_numIdleThreads;
+        while (true) {
+            if (0 == numIdle) {
+                d_idleSemaphore.wait();
+                break;
+            }
+            const int current = d_numIdleThreads.testAndSwap(numIdle,
+                                                             numIdle - 1);
+            if (current == numIdle) {
+                break;
+            }
+            numIdle = current;
+        }
+    }
+
+    worker->d_idleTime.addRelaxed(bsls::TimeUtil::getTimer() - start);
+}
+
+void WorkStealingThreadPool::wakeIdleThreads(int maxCount)
+{
+    int numIdle = d_numIdleThreads;
+
+    while (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(0 < numIdle)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        const int count   = bsl::min(numIdle, maxCount);
+        const int current = d_numIdleThreads.testAndSwap(numIdle,
+                                                         numIdle - count);
+        if (current == numIdle) {
+            for (int i = 0; i < count; ++i) {
+                d_idleSemaphore.post();
+            }
+            return;                                                   // RETURN
+        }
+        numIdle = current;
+    }
+}
+
+void WorkStealingThreadPool::workerThread(int index)
+{
+    Worker *worker = d_workers[index];
+    setCurrentWorker(worker);
+
+    Job job(bsl::allocator_arg_t(), d_allocator_p);
+
+    while (true) {
+        if (popLocalJob(&job, worker) || stealJob(&job, worker)) {
+            d_numActiveThreads.addRelaxed(1);
+
+            job();
+
+            // Destroy the job before reporting its completion.
+
+            job = Job();
+
+            worker->d_numJobsExecuted.addRelaxed(1);
+            d_numActiveThreads.addRelaxed(-1);
+            completeJob();
+            continue;
+        }
+
+        if (!d_runningFlag) {
+            break;
+        }
+
+        waitForJob(worker);
+    }
+
+    setCurrentWorker(0);
+}
+
+// CREATORS
+WorkStealingThreadPool::WorkStealingThreadPool(
+                                              int               numThreads,
+                                              bslma::Allocator *basicAllocator)
+: d_workers(basicAllocator)
+, d_nextWorker(0)
+, d_numPendingJobs(0)
+, d_numUnfinishedJobs(0)
+, d_numActiveThreads(0)
+, d_numIdleThreads(0)
+, d_idleSemaphore(0)
+, d_enabledFlag(0)
+, d_runningFlag(0)
+, d_threadGroup(basicAllocator)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= d_numThreads);
+
+    d_workers.reserve(d_numThreads);
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_workers.push_back(new (*d_allocator_p) Worker(this,
+                                                        i,
+                                                        d_allocator_p));
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+}
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+                             const bslmt::ThreadAttributes&  threadAttributes,
+                             int                             numThreads,
+                             bslma::Allocator               *basicAllocator)
+: d_workers(basicAllocator)
+, d_nextWorker(0)
+, d_numPendingJobs(0)
+, d_numUnfinishedJobs(0)
+, d_numActiveThreads(0)
+, d_numIdleThreads(0)
+, d_idleSemaphore(0)
+, d_enabledFlag(0)
+, d_runningFlag(0)
+, d_threadGroup(basicAllocator)
+, d_threadAttributes(threadAttributes)
+, d_numThreads(numThreads)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+    BSLS_ASSERT_OPT(1 <= d_numThreads);
+
+    d_workers.reserve(d_numThreads);
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_workers.push_back(new (*d_allocator_p) Worker(this,
+                                                        i,
+                                                        d_allocator_p));
+    }
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    initBlockSet(&d_blockSet);
+#endif
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    shutdown();
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        d_allocator_p->deleteObjectRaw(d_workers[i]);
+    }
+}
+
+// MANIPULATORS
+int WorkStealingThreadPool::enqueueJob(const Job& functor)
+{
+    BSLS_ASSERT(functor);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_enabledFlag.loadRelaxed())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        return -1;                                                    // RETURN
+    }
+
+    d_numUnfinishedJobs.add(1);
+
+    Worker *worker = currentWorker();
+    if (0 == worker || this != worker->d_pool_p) {
+        const unsigned int next =
+                          static_cast<unsigned int>(d_nextWorker.add(1));
+        worker = d_workers[next % d_numThreads];
+    }
+
+    pushJob(functor, worker);
+    return 0;
+}
+
+void WorkStealingThreadPool::drain()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_drainMutex);
+
+    while (0 < d_numUnfinishedJobs) {
+        d_drainCondition.wait(&d_drainMutex);
+    }
+}
+
+void WorkStealingThreadPool::resetStatistics()
+{
+    for (int i = 0; i < d_numThreads; ++i) {
+        Worker *worker = d_workers[i];
+
+        worker->d_numJobsExecuted.storeRelaxed(0);
+        worker->d_numJobsStolen.storeRelaxed(0);
+        worker->d_numStealFailures.storeRelaxed(0);
+        worker->d_idleTime.storeRelaxed(0);
+    }
+}
+
+void WorkStealingThreadPool::shutdown()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    disable();
+
+    if (d_runningFlag) {
+        removeAllJobs();
+        stopThreads();
+    }
+}
+
+int WorkStealingThreadPool::start()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    if (d_runningFlag) {
+        return 0;                                                     // RETURN
+    }
+
+    d_runningFlag = 1;
+
+    for (int i = 0; i < d_numThreads; ++i) {
+        if (0 != startNewThread(i)) {
+            stopThreads();
+            return -1;                                                // RETURN
+        }
+    }
+
+    enable();
+    return 0;
+}
+
+void WorkStealingThreadPool::stop()
+{
+    bslmt::LockGuard<bslmt::Mutex> lock(&d_metaMutex);
+
+    disable();
+
+    if (d_runningFlag) {
+        drain();
+        stopThreads();
+    }
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
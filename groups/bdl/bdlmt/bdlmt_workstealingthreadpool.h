@@ -0,0 +1,718 @@
+// bdlmt_workstealingthreadpool.h                                     -*-C++-*-
+#ifndef INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+#define INCLUDED_BDLMT_WORKSTEALINGTHREADPOOL
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a fixed-size pool of threads that balance jobs by stealing.
+//
+//@CLASSES:
+//   bdlmt::WorkStealingThreadPool: fixed-size work-stealing thread pool
+//
+//@SEE_ALSO: bdlmt_fixedthreadpool, bdlmt_threadpool
+//
+//@DESCRIPTION: This component defines a thread pool,
+// 'bdlmt::WorkStealingThreadPool', that executes user-defined functions
+// ("jobs") on a fixed number of processing threads.  Unlike
+// 'bdlmt::FixedThreadPool' and 'bdlmt::ThreadPool', in which every job goes
+// through a single job queue shared by all threads, each processing thread
+// ("worker") of a 'bdlmt::WorkStealingThreadPool' owns a job queue of its
+// own:
+//
+//: o A job enqueued by a job running on a worker is placed on the queue of
+//:   that worker, and jobs are popped by their owner in last-in, first-out
+//:   order (favoring data that is still in the cache of that processor).
+//:
+//: o A job enqueued by any other thread is placed on the queue of one of the
+//:   workers, selected in a round-robin fashion.
+//:
+//: o A worker whose own queue is empty "steals" the oldest job from the queue
+//:   of another worker, starting the search at a randomly selected worker.
+//:   Only when every queue is empty does the worker block.
+//
+// Each per-worker queue is protected by its own mutex, which is held only
+// for the duration of a single push or pop.  Threads enqueuing jobs
+// therefore contend with each other (and with the workers) only when they
+// target the same worker, which makes this thread pool well suited to
+// executing a large number of fine-grained jobs, and, in particular, to
+// "divide and conquer" algorithms in which jobs enqueue other jobs.  Note
+// that no guarantee is made regarding the order in which jobs are executed.
+//
+// 'bdlmt::WorkStealingThreadPool' provides the 'enqueueJob', 'drain', 'stop',
+// and 'shutdown' operations with the same semantics as their counterparts in
+// 'bdlmt::FixedThreadPool', except that the number of pending jobs is not
+// bounded (and 'enqueueJob' therefore never blocks).
+//
+///Statistics
+///----------
+// A 'bdlmt::WorkStealingThreadPool' maintains the following statistics for
+// each worker, identified by its index in the range '[0 .. numThreads())':
+//..
+//  Accessor           Description
+//  -----------------  --------------------------------------------------------
+//  numJobsExecuted    number of jobs executed by the worker
+//  numJobsStolen      number of jobs the worker took from the queue of another
+//                     worker
+//  numStealFailures   number of times the worker found every other queue empty
+//  idleTime           total time the worker spent blocked waiting for a job
+//..
+// Statistics are updated with relaxed memory ordering, and may be reset with
+// 'resetStatistics'.
+//
+///Thread Safety
+///-------------
+// The 'bdlmt::WorkStealingThreadPool' class is both *fully thread-safe*
+// (i.e., all non-creator methods can correctly execute concurrently), and is
+// *thread-enabled* (i.e., the class does not function correctly in a
+// non-multi-threading environment).  See 'bsldoc_glossary' for complete
+// definitions of *fully thread-safe* and *thread-enabled*.
+//
+///Synchronous Signals on Unix
+///---------------------------
+// As 'bdlmt::FixedThreadPool', a work-stealing thread pool ensures that, on
+// unix platforms, all the threads in the pool block all asynchronous signals.
+// Specifically all the signals, except the following synchronous signals are
+// blocked:
+//..
+// SIGBUS
+// SIGFPE
+// SIGILL
+// SIGSEGV
+// SIGSYS
+// SIGABRT
+// SIGTRAP
+// SIGIOT
+//..
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parallel Divide and Conquer
+/// - - - - - - - - - - - - - - - - - - -
+// In this example we compute the sum of the elements of a large array by
+// recursively splitting the array into halves, each half being summed by a
+// separate job, until the sub-arrays are small enough to be summed directly.
+// The jobs enqueued by a job are placed on the queue of the worker running
+// it, and are stolen by the other workers as they become idle.
+//
+// First, we define the job summing a range of elements, and accumulating the
+// result in an atomic integer:
+//..
+//  struct SumJob {
+//      // This 'struct' provides a job computing the sum of a range of
+//      // integers.
+//
+//      // DATA
+//      bdlmt::WorkStealingThreadPool *d_pool_p;    // pool running the job
+//      const int                     *d_begin_p;   // first element
+//      const int                     *d_end_p;     // one past last element
+//      bsls::AtomicInt64             *d_result_p;  // accumulated sum
+//
+//      // MANIPULATORS
+//      void operator()() const
+//          // Add the sum of the range '[d_begin_p .. d_end_p)' to the
+//          // accumulated sum.
+//      {
+//          enum { k_THRESHOLD = 1024 };
+//
+//          if (d_end_p - d_begin_p <= k_THRESHOLD) {
+//              bsls::Types::Int64 sum = 0;
+//              for (const int *p = d_begin_p; p != d_end_p; ++p) {
+//                  sum += *p;
+//              }
+//              d_result_p->add(sum);
+//              return;                                               // RETURN
+//          }
+//..
+// Then, if the range is too large, we split it in two halves and enqueue a
+// job for each of them:
+//..
+//          const int *middle = d_begin_p + (d_end_p - d_begin_p) / 2;
+//
+//          SumJob left  = { d_pool_p, d_begin_p, middle,  d_result_p };
+//          SumJob right = { d_pool_p, middle,    d_end_p, d_result_p };
+//
+//          d_pool_p->enqueueJob(left);
+//          d_pool_p->enqueueJob(right);
+//      }
+//  };
+//..
+// Next, we create a thread pool with 4 workers, and start it:
+//..
+//  bdlmt::WorkStealingThreadPool pool(4);
+//
+//  int rc = pool.start();
+//  assert(0 == rc);
+//..
+// Then, we populate an array of integers, and enqueue the job summing the
+// whole array:
+//..
+//  bsl::vector<int> values(100000);
+//  for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+//      values[i] = i;
+//  }
+//
+//  bsls::AtomicInt64 result(0);
+//
+//  SumJob job = { &pool,
+//                 &values[0],
+//                 &values[0] + values.size(),
+//                 &result };
+//
+//  rc = pool.enqueueJob(job);
+//  assert(0 == rc);
+//..
+// Now, we wait for all the jobs, including the ones enqueued by other jobs,
+// to complete, and check the result:
+//..
+//  pool.drain();
+//
+//  assert(4999950000LL == result);
+//..
+// Finally, we look at the statistics of the pool, and stop it:
+//..
+//  bsls::Types::Int64 numExecuted = 0;
+//  for (int i = 0; i < pool.numThreads(); ++i) {
+//      numExecuted += pool.numJobsExecuted(i);
+//  }
+//  assert(255 == numExecuted);
+//
+//  pool.stop();
+//..
+
+#ifndef INCLUDED_BDLSCM_VERSION
+#include <bdlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BDLF_BIND
+#include <bdlf_bind.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_CONDITION
+#include <bslmt_condition.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_MUTEX
+#include <bslmt_mutex.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_SEMAPHORE
+#include <bslmt_semaphore.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADATTRIBUTES
+#include <bslmt_threadattributes.h>
+#endif
+
+#ifndef INCLUDED_BSLMT_THREADGROUP
+#include <bslmt_threadgroup.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_ALLOCATOR
+#include <bslma_allocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMA_USESBSLMAALLOCATOR
+#include <bslma_usesbslmaallocator.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ATOMIC
+#include <bsls_atomic.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TIMEINTERVAL
+#include <bsls_timeinterval.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_DEQUE
+#include <bsl_deque.h>
+#endif
+
+#ifndef INCLUDED_BSL_FUNCTIONAL
+#include <bsl_functional.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    #ifndef INCLUDED_BSL_CSIGNAL
+    #include <bsl_csignal.h>              // sigset_t
+    #endif
+#endif
+
+namespace BloombergLP {
+namespace bdlmt {
+
+extern "C" typedef void (*WorkStealingThreadPoolJobFunc)(void *);
+    // This type declares the prototype for functions that are suitable to be
+    // specified 'bdlmt::WorkStealingThreadPool::enqueueJob'.
+
+class WorkStealingThreadPool;
+
+                    // ====================================
+                    // struct WorkStealingThreadPool_Worker
+                    // ====================================
+
+struct WorkStealingThreadPool_Worker {
+    // This component-private 'struct' holds the job queue and the statistics
+    // of one worker of a 'WorkStealingThreadPool'.
+
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+    // DATA
+    bslmt::Mutex            d_mutex;             // protects 'd_jobs'
+
+    bsl::deque<Job>         d_jobs;              // pending jobs; the owner
+                                                 // pushes and pops at the
+                                                 // back, thieves pop at the
+                                                 // front
+
+    bsls::AtomicInt         d_numJobs;           // number of jobs in
+                                                 // 'd_jobs', readable without
+                                                 // locking 'd_mutex'
+
+    WorkStealingThreadPool *d_pool_p;            // pool owning this worker
+                                                 // (held, not owned)
+
+    int                     d_index;             // index of this worker in
+                                                 // the pool
+
+    unsigned int            d_randomState;       // state of the generator
+                                                 // selecting the first
+                                                 // victim of a steal
+
+    bsls::AtomicInt64       d_numJobsExecuted;   // number of jobs executed
+
+    bsls::AtomicInt64       d_numJobsStolen;     // number of jobs stolen
+
+    bsls::AtomicInt64       d_numStealFailures;  // number of failed steals
+
+    bsls::AtomicInt64       d_idleTime;          // time spent waiting, in
+                                                 // nanoseconds
+
+    // CREATORS
+    WorkStealingThreadPool_Worker(WorkStealingThreadPool *pool,
+                                  int                     index,
+                                  bslma::Allocator       *basicAllocator);
+        // Create a worker of the specified 'pool' having the specified
+        // 'index', and an empty job queue using the specified
+        // 'basicAllocator' to supply memory.
+};
+
+                        // ============================
+                        // class WorkStealingThreadPool
+                        // ============================
+
+class WorkStealingThreadPool {
+    // This class implements a fixed-size thread pool in which each processing
+    // thread owns a job queue, and idle threads steal jobs from the queues of
+    // busy threads.
+
+  public:
+    // TYPES
+    typedef bsl::function<void()> Job;
+
+  private:
+    // PRIVATE TYPES
+    typedef WorkStealingThreadPool_Worker Worker;
+
+    // DATA
+    bsl::vector<Worker *>    d_workers;           // workers, each owning a
+                                                  // job queue (owned)
+
+    bsls::AtomicInt          d_nextWorker;        // index (modulo the number
+                                                  // of workers) of the worker
+                                                  // receiving the next job
+                                                  // enqueued by a thread
+                                                  // outside this pool
+
+    bsls::AtomicInt          d_numPendingJobs;    // number of jobs enqueued,
+                                                  // but not yet started
+
+    bsls::AtomicInt          d_numUnfinishedJobs; // number of jobs enqueued,
+                                                  // but not yet completed
+
+    bsls::AtomicInt          d_numActiveThreads;  // number of threads
+                                                  // executing a job
+
+    bsls::AtomicInt          d_numIdleThreads;    // number of threads
+                                                  // registered to wait on
+                                                  // 'd_idleSemaphore'
+
+    bslmt::Semaphore         d_idleSemaphore;     // semaphore on which idle
+                                                  // threads wait for a job
+
+    bsls::AtomicInt          d_enabledFlag;       // non-zero if enqueuing is
+                                                  // enabled
+
+    bsls::AtomicInt          d_runningFlag;       // non-zero while the
+                                                  // processing threads must
+                                                  // keep running
+
+    bslmt::Mutex             d_metaMutex;         // ensures that there is
+                                                  // only one controlling
+                                                  // thread at any time
+
+    bslmt::Mutex             d_drainMutex;        // mutex associated with
+                                                  // 'd_drainCondition'
+
+    bslmt::Condition         d_drainCondition;    // signaled when the number
+                                                  // of unfinished jobs drops
+                                                  // to 0
+
+    bslmt::ThreadGroup       d_threadGroup;       // threads used by this pool
+
+    bslmt::ThreadAttributes  d_threadAttributes;  // thread attributes to be
+                                                  // used when constructing
+                                                  // processing threads
+
+    const int                d_numThreads;        // number of configured
+                                                  // processing threads
+
+#if defined(BSLS_PLATFORM_OS_UNIX)
+    sigset_t                 d_blockSet;          // set of signals to be
+                                                  // blocked in managed
+                                                  // threads
+#endif
+
+    bslma::Allocator        *d_allocator_p;       // memory allocator (held,
+                                                  // not owned)
+
+    // PRIVATE CLASS METHODS
+    static Worker *currentWorker();
+        // Return the address of the worker (of any pool) running in the
+        // calling thread, or 0 if the calling thread is not a processing
+        // thread of a 'WorkStealingThreadPool'.
+
+    static void setCurrentWorker(Worker *worker);
+        // Set the worker running in the calling thread to the specified
+        // 'worker'.
+
+    // PRIVATE MANIPULATORS
+    void completeJob();
+        // Record the completion of a job, and signal 'd_drainCondition' if
+        // there are no more unfinished jobs.
+
+    bool popLocalJob(Job *job, Worker *worker);
+        // Load into the specified 'job' the job most recently pushed onto the
+        // queue of the specified 'worker', and remove it from that queue.
+        // Return 'true' on success, and 'false' (with no effect) if that
+        // queue is empty.
+
+    void pushJob(const Job& job, Worker *worker);
+        // Push the specified 'job' onto the back of the queue of the
+        // specified 'worker', and wake up an idle thread if any.
+
+    void removeAllJobs();
+        // Remove every pending job from the queues of this pool without
+        // executing it.
+
+    int startNewThread(int index);
+        // Spawn the processing thread of the worker having the specified
+        // 'index'.  Return 0 on success, and a non-zero value otherwise.  Note
+        // that this method must be called with 'd_metaMutex' locked.
+
+    bool stealJob(Job *job, Worker *thief);
+        // Load into the specified 'job' the oldest job of the queue of a
+        // worker other than the specified 'thief', and remove it from that
+        // queue.  Return 'true' on success, and 'false' if the queues of all
+        // other workers are empty.
+
+    void stopThreads();
+        // Stop and join the processing threads.  Note that this method must be
+        // called with 'd_metaMutex' locked.
+
+    void waitForJob(Worker *worker);
+        // Block the calling processing thread of the specified 'worker' until
+        // a job is enqueued in this pool or the pool is stopped, unless there
+        // are already pending jobs.
+
+    void wakeIdleThreads(int maxCount);
+        // Wake up to the specified 'maxCount' threads waiting on
+        // 'd_idleSemaphore'.
+
+    void workerThread(int index);
+        // Process the jobs of this pool as the worker having the specified
+        // 'index' until this pool is stopped.
+
+    // NOT IMPLEMENTED
+    WorkStealingThreadPool(const WorkStealingThreadPool&);
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&);
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(WorkStealingThreadPool,
+                                   bslma::UsesBslmaAllocator);
+
+    // CREATORS
+    explicit
+    WorkStealingThreadPool(int               numThreads,
+                           bslma::Allocator *basicAllocator = 0);
+    WorkStealingThreadPool(const bslmt::ThreadAttributes&  threadAttributes,
+                           int                             numThreads,
+                           bslma::Allocator               *basicAllocator = 0);
+        // Construct a thread pool with the specified 'numThreads' number of
+        // workers.  Optionally specify 'threadAttributes' used to create the
+        // processing threads.  If 'threadAttributes' is not specified, default
+        // thread attributes are used.  Optionally specify a 'basicAllocator'
+        // used to supply memory.  If 'basicAllocator' is 0, the currently
+        // installed default allocator is used.  The behavior is undefined
+        // unless '1 <= numThreads'.  Note that enqueuing is disabled until
+        // 'start' is called.
+
+    ~WorkStealingThreadPool();
+        // Remove all pending jobs from the queues without executing them,
+        // block until all currently running jobs complete, and then destroy
+        // this thread pool.
+
+    // MANIPULATORS
+    void disable();
+        // Disable enqueuing into this pool.  Subsequent calls to 'enqueueJob'
+        // will immediately fail.  Note that this method has no effect on jobs
+        // currently in the pool.
+
+    void enable();
+        // Enable enqueuing into this pool.
+
+    int enqueueJob(const Job& functor);
+        // Enqueue the specified 'functor' to be executed by a processing
+        // thread.  If this method is called from a job executing in this
+        // pool, 'functor' is placed on the queue of the calling worker;
+        // otherwise, it is placed on the queue of the next worker in
+        // round-robin order.  Return 0 if enqueued successfully, and a
+        // non-zero value if enqueuing is currently disabled.  The behavior is
+        // undefined unless 'functor' is not "unset".
+
+    int enqueueJob(WorkStealingThreadPoolJobFunc function, void *userData);
+        // Enqueue the specified 'function' to be executed by a processing
+        // thread.  The specified 'userData' pointer will be passed to the
+        // function by the processing thread.  Return 0 if enqueued
+        // successfully, and a non-zero value if enqueuing is currently
+        // disabled.
+
+    void drain();
+        // Wait until all pending jobs complete, including the jobs enqueued
+        // by the pending jobs themselves.  Note that if any jobs are
+        // submitted concurrently with this method by other threads, this
+        // method may or may not wait until they have also completed.  The
+        // behavior is undefined if this method is called from a job executing
+        // in this pool.
+
+    void resetStatistics();
+        // Reset the statistics of every worker of this pool to 0.
+
+    void shutdown();
+        // Disable enqueuing on this thread pool, cancel all queued jobs, and
+        // after all active jobs have completed, join all processing threads.
+
+    int start();
+        // Spawn 'numThreads()' processing threads.  On success, enable
+        // enqueuing and return 0.  Return a non-zero value otherwise.  If
+        // 'numThreads()' threads were not successfully started, all threads
+        // are stopped.  This method has no effect if this pool is already
+        // started.
+
+    void stop();
+        // Disable enqueuing on this thread pool and wait until all pending
+        // jobs complete, then shut down all processing threads.
+
+    // ACCESSORS
+    bsls::TimeInterval idleTime(int workerIndex) const;
+        // Return the total time the worker having the specified
+        // 'workerIndex' spent waiting for a job since the construction of
+        // this pool or the last call to 'resetStatistics'.  The behavior is
+        // undefined unless '0 <= workerIndex < numThreads()'.
+
+    bool isEnabled() const;
+        // Return 'true' if enqueuing is enabled on this thread pool, and
+        // 'false' otherwise.
+
+    bool isStarted() const;
+        // Return 'true' if 'numThreads()' threads are started on this thread
+        // pool, and 'false' otherwise.
+
+    int numActiveThreads() const;
+        // Return a snapshot of the number of threads that are currently
+        // processing a job for this thread pool.
+
+    bsls::Types::Int64 numJobsExecuted(int workerIndex) const;
+        // Return the number of jobs executed by the worker having the
+        // specified 'workerIndex' since the construction of this pool or the
+        // last call to 'resetStatistics'.  The behavior is undefined unless
+        // '0 <= workerIndex < numThreads()'.
+
+    bsls::Types::Int64 numJobsStolen(int workerIndex) const;
+        // Return the number of jobs the worker having the specified
+        // 'workerIndex' took from the queue of another worker since the
+        // construction of this pool or the last call to 'resetStatistics'.
+        // The behavior is undefined unless '0 <= workerIndex < numThreads()'.
+
+    int numPendingJobs() const;
+        // Return a snapshot of the number of jobs currently enqueued to be
+        // processed by this thread pool.
+
+    bsls::Types::Int64 numStealFailures(int workerIndex) const;
+        // Return the number of times the worker having the specified
+        // 'workerIndex' found its own queue and the queues of all other
+        // workers empty since the construction of this pool or the last call
+        // to 'resetStatistics'.  The behavior is undefined unless
+        // '0 <= workerIndex < numThreads()'.
+
+    int numThreads() const;
+        // Return the number of threads passed to this thread pool at
+        // construction.
+
+    int numThreadsStarted() const;
+        // Return a snapshot of the number of threads currently started by this
+        // thread pool.
+};
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                        // ----------------------------
+                        // class WorkStealingThreadPool
+                        // ----------------------------
+
+// MANIPULATORS
+inline
+void WorkStealingThreadPool::disable()
+{
+    d_enabledFlag = 0;
+}
+
+inline
+void WorkStealingThreadPool::enable()
+{
+    d_enabledFlag = 1;
+}
+
+inline
+int WorkStealingThreadPool::enqueueJob(
+                                 WorkStealingThreadPoolJobFunc  function,
+                                 void                          *userData)
+{
+    return enqueueJob(bdlf::BindUtil::bindR<void>(function, userData));
+}
+
+// ACCESSORS
+inline
+bsls::TimeInterval WorkStealingThreadPool::idleTime(int workerIndex) const
+{
+    BSLS_ASSERT(0 <= workerIndex);
+    BSLS_ASSERT(workerIndex < d_numThreads);
+
+    return bsls::TimeInterval().addNanoseconds(
+                             d_workers[workerIndex]->d_idleTime.loadRelaxed());
+}
+
+inline
+bool WorkStealingThreadPool::isEnabled() const
+{
+    return 0 != d_enabledFlag;
+}
+
+inline
+bool WorkStealingThreadPool::isStarted() const
+{
+    return d_numThreads == d_threadGroup.numThreads();
+}
+
+inline
+int WorkStealingThreadPool::numActiveThreads() const
+{
+    return d_numActiveThreads.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 WorkStealingThreadPool::numJobsExecuted(
+                                                        int workerIndex) const
+{
+    BSLS_ASSERT(0 <= workerIndex);
+    BSLS_ASSERT(workerIndex < d_numThreads);
+
+    return d_workers[workerIndex]->d_numJobsExecuted.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 WorkStealingThreadPool::numJobsStolen(
+                                                        int workerIndex) const
+{
+    BSLS_ASSERT(0 <= workerIndex);
+    BSLS_ASSERT(workerIndex < d_numThreads);
+
+    return d_workers[workerIndex]->d_numJobsStolen.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numPendingJobs() const
+{
+    return d_numPendingJobs.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 WorkStealingThreadPool::numStealFailures(
+                                                        int workerIndex) const
+{
+    BSLS_ASSERT(0 <= workerIndex);
+    BSLS_ASSERT(workerIndex < d_numThreads);
+
+    return d_workers[workerIndex]->d_numStealFailures.loadRelaxed();
+}
+
+inline
+int WorkStealingThreadPool::numThreads() const
+{
+    return d_numThreads;
+}
+
+inline
+int WorkStealingThreadPool::numThreadsStarted() const
+{
+    return d_threadGroup.numThreads();
+}
+
+}  // close package namespace
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,1232 @@
+// bdlmt_workstealingthreadpool.t.cpp                                 -*-C++-*-
+#include <bdlmt_workstealingthreadpool.h>
+
+#include <bdlmt_fixedthreadpool.h>
+#include <bdlmt_threadpool.h>
+
+#include <bdlf_bind.h>
+
+#include <bslim_testutil.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bslmt_lockguard.h>
+#include <bslmt_mutex.h>
+#include <bslmt_semaphore.h>
+#include <bslmt_threadgroup.h>
+#include <bslmt_threadutil.h>
+
+#include <bsls_atomic.h>
+#include <bsls_stopwatch.h>
+#include <bsls_timeinterval.h>
+#include <bsls_types.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_iostream.h>
+#include <bsl_vector.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+// ============================================================================
+//                                  TEST PLAN
+// ----------------------------------------------------------------------------
+//                                  Overview
+//                                  --------
+// 'bdlmt::WorkStealingThreadPool' dispatches jobs onto a fixed number of
+// workers, each owning a job queue.  We first verify the basic life cycle of
+// the pool ('start', 'enqueueJob', 'drain', 'stop') and its accessors.  We
+// then verify that 'drain' waits for jobs enqueued by other jobs, that 'stop'
+// executes all pending jobs while 'shutdown' discards them, and that jobs
+// enqueued from a worker are stolen by idle workers (as reported by the
+// per-worker statistics).  Finally, a concurrency test enqueues a large number
+// of jobs, some of which enqueue further jobs, from several threads.
+// ----------------------------------------------------------------------------
+// CREATORS
+// [ 2] WorkStealingThreadPool(int numThreads, Allocator *ba = 0);
+// [ 2] WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+// [ 2] ~WorkStealingThreadPool();
+//
+// MANIPULATORS
+// [ 2] void disable();
+// [ 2] void enable();
+// [ 3] int enqueueJob(const Job& functor);
+// [ 3] int enqueueJob(WorkStealingThreadPoolJobFunc function, void *data);
+// [ 3] void drain();
+// [ 6] void resetStatistics();
+// [ 5] void shutdown();
+// [ 2] int start();
+// [ 4] void stop();
+//
+// ACCESSORS
+// [ 6] bsls::TimeInterval idleTime(int workerIndex) const;
+// [ 2] bool isEnabled() const;
+// [ 2] bool isStarted() const;
+// [ 5] int numActiveThreads() const;
+// [ 6] bsls::Types::Int64 numJobsExecuted(int workerIndex) const;
+// [ 6] bsls::Types::Int64 numJobsStolen(int workerIndex) const;
+// [ 5] int numPendingJobs() const;
+// [ 6] bsls::Types::Int64 numStealFailures(int workerIndex) const;
+// [ 2] int numThreads() const;
+// [ 2] int numThreadsStarted() const;
+// ----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 7] CONCURRENCY TEST
+// [ 8] USAGE EXAMPLE
+// [-1] PERFORMANCE TEST: work-stealing vs. fixed vs. dynamic thread pool
+
+// ============================================================================
+//                     STANDARD BDE ASSERT TEST FUNCTION
+// ----------------------------------------------------------------------------
+
+namespace {
+
+int testStatus = 0;
+
+void aSsErT(bool condition, const char *message, int line)
+{
+    if (condition) {
+        cout << "Error " __FILE__ "(" << line << "): " << message
+             << "    (failed)" << endl;
+
+        if (0 <= testStatus && testStatus <= 100) {
+            ++testStatus;
+        }
+    }
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//               STANDARD BDE TEST DRIVER MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT       BSLIM_TESTUTIL_ASSERT
+#define ASSERTV      BSLIM_TESTUTIL_ASSERTV
+
+#define LOOP_ASSERT  BSLIM_TESTUTIL_LOOP_ASSERT
+#define LOOP0_ASSERT BSLIM_TESTUTIL_LOOP0_ASSERT
+#define LOOP1_ASSERT BSLIM_TESTUTIL_LOOP1_ASSERT
+#define LOOP2_ASSERT BSLIM_TESTUTIL_LOOP2_ASSERT
+#define LOOP3_ASSERT BSLIM_TESTUTIL_LOOP3_ASSERT
+#define LOOP4_ASSERT BSLIM_TESTUTIL_LOOP4_ASSERT
+#define LOOP5_ASSERT BSLIM_TESTUTIL_LOOP5_ASSERT
+#define LOOP6_ASSERT BSLIM_TESTUTIL_LOOP6_ASSERT
+
+#define Q            BSLIM_TESTUTIL_Q   // Quote identifier literally.
+#define P            BSLIM_TESTUTIL_P   // Print identifier and value.
+#define P_           BSLIM_TESTUTIL_P_  // P(X) without '\n'.
+#define T_           BSLIM_TESTUTIL_T_  // Print a tab (w/o newline).
+#define L_           BSLIM_TESTUTIL_L_  // current Line number
+
+// ============================================================================
+//                   THREAD-SAFE OUTPUT AND ASSERT MACROS
+// ----------------------------------------------------------------------------
+
+static bslmt::Mutex coutMutex;
+
+#define ASSERTT(X) {                                                          \
+   if (!(X)) {                                                                \
+       bslmt::LockGuard<bslmt::Mutex> guard(&coutMutex);                      \
+       aSsErT(1, #X, __LINE__); } }
+
+// ============================================================================
+//                   GLOBAL TYPEDEFS/CONSTANTS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef bdlmt::WorkStealingThreadPool Obj;
+typedef bsls::Types::Int64            Int64;
+
+static int verbose;
+static int veryVerbose;
+static int veryVeryVerbose;
+
+// ============================================================================
+//                 HELPER CLASSES AND FUNCTIONS FOR TESTING
+// ----------------------------------------------------------------------------
+
+namespace {
+
+void incrementJob(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    counter->add(1);
+}
+
+extern "C" void incrementJobFunc(void *counter)
+    // Increment the 'bsls::AtomicInt' at the specified 'counter' address.
+{
+    static_cast<bsls::AtomicInt *>(counter)->add(1);
+}
+
+void blockingJob(bslmt::Semaphore *started, bslmt::Semaphore *release)
+    // Post the specified 'started' semaphore and wait on the specified
+    // 'release' semaphore.
+{
+    started->post();
+    release->wait();
+}
+
+void sleepingJob(bsls::AtomicInt *counter, int microseconds)
+    // Sleep for the specified 'microseconds', and increment the specified
+    // 'counter'.
+{
+    bslmt::ThreadUtil::microSleep(microseconds);
+    counter->add(1);
+}
+
+void spawningJob(Obj             *pool,
+                 bsls::AtomicInt *counter,
+                 int              numChildren,
+                 int              sleepMicroseconds)
+    // Enqueue the specified 'numChildren' jobs onto the specified 'pool',
+    // each sleeping for the specified 'sleepMicroseconds' and incrementing
+    // the specified 'counter', and then increment 'counter'.
+{
+    for (int i = 0; i < numChildren; ++i) {
+        ASSERTT(0 == pool->enqueueJob(
+                                   bdlf::BindUtil::bind(&sleepingJob,
+                                                        counter,
+                                                        sleepMicroseconds)));
+    }
+    counter->add(1);
+}
+
+void treeJob(Obj *pool, bsls::AtomicInt *counter, int depth)
+    // Increment the specified 'counter', and, unless the specified 'depth' is
+    // 0, enqueue two jobs of depth 'depth - 1' onto the specified 'pool'.
+{
+    counter->add(1);
+    if (depth > 0) {
+        pool->enqueueJob(bdlf::BindUtil::bind(&treeJob,
+                                              pool,
+                                              counter,
+                                              depth - 1));
+        pool->enqueueJob(bdlf::BindUtil::bind(&treeJob,
+                                              pool,
+                                              counter,
+                                              depth - 1));
+    }
+}
+
+void producer(Obj *pool, bsls::AtomicInt *counter, int numJobs, int depth)
+    // Enqueue the specified 'numJobs' tree jobs of the specified 'depth' onto
+    // the specified 'pool', each incrementing the specified 'counter'.
+{
+    for (int i = 0; i < numJobs; ++i) {
+        ASSERTT(0 == pool->enqueueJob(bdlf::BindUtil::bind(&treeJob,
+                                                           pool,
+                                                           counter,
+                                                           depth)));
+    }
+}
+
+void callShutdown(Obj *pool)
+    // Call 'shutdown' on the specified 'pool'.
+{
+    pool->shutdown();
+}
+
+Int64 totalExecuted(const Obj& pool)
+    // Return the number of jobs executed by all the workers of the specified
+    // 'pool'.
+{
+    Int64 result = 0;
+    for (int i = 0; i < pool.numThreads(); ++i) {
+        result += pool.numJobsExecuted(i);
+    }
+    return result;
+}
+
+Int64 totalStolen(const Obj& pool)
+    // Return the number of jobs stolen by all the workers of the specified
+    // 'pool'.
+{
+    Int64 result = 0;
+    for (int i = 0; i < pool.numThreads(); ++i) {
+        result += pool.numJobsStolen(i);
+    }
+    return result;
+}
+
+                      // ================================
+                      // Performance test helper functions
+                      // ================================
+
+void emptyJob(bsls::AtomicInt *counter)
+    // Increment the specified 'counter'.
+{
+    counter->addRelaxed(1);
+}
+
+template <class POOL>
+void benchTreeJob(POOL *pool, bsls::AtomicInt *counter, int depth)
+    // Increment the specified 'counter', and, unless the specified 'depth' is
+    // 0, enqueue two jobs of depth 'depth - 1' onto the specified 'pool'.
+{
+    counter->addRelaxed(1);
+    if (depth > 0) {
+        pool->enqueueJob(bdlf::BindUtil::bind(&benchTreeJob<POOL>,
+                                              pool,
+                                              counter,
+                                              depth - 1));
+        pool->enqueueJob(bdlf::BindUtil::bind(&benchTreeJob<POOL>,
+                                              pool,
+                                              counter,
+                                              depth - 1));
+    }
+}
+
+template <class POOL>
+void benchProducer(POOL *pool, bsls::AtomicInt *counter, int numJobs)
+    // Enqueue the specified 'numJobs' empty jobs onto the specified 'pool'.
+{
+    const typename POOL::Job job(bdlf::BindUtil::bind(&emptyJob, counter));
+    for (int i = 0; i < numJobs; ++i) {
+        pool->enqueueJob(job);
+    }
+}
+
+template <class POOL>
+double runFlatBenchmark(POOL *pool, int numProducers, int numJobs)
+    // Enqueue the specified 'numJobs' empty jobs from each of the specified
+    // 'numProducers' threads onto the specified (started) 'pool', wait for
+    // them to complete, and return the elapsed time in seconds.
+{
+    bsls::AtomicInt    counter(0);
+    bslmt::ThreadGroup group;
+
+    bsls::Stopwatch timer;
+    timer.start();
+
+    group.addThreads(bdlf::BindUtil::bind(&benchProducer<POOL>,
+                                          pool,
+                                          &counter,
+                                          numJobs),
+                     numProducers);
+    group.joinAll();
+    pool->drain();
+
+    timer.stop();
+
+    ASSERT(numProducers * numJobs == counter);
+    return timer.elapsedTime();
+}
+
+template <class POOL>
+double runTreeBenchmark(POOL *pool, int depth)
+    // Enqueue a job onto the specified (started) 'pool' that recursively
+    // enqueues a binary tree of jobs of the specified 'depth', wait for them
+    // to complete, and return the elapsed time in seconds.
+{
+    bsls::AtomicInt counter(0);
+
+    bsls::Stopwatch timer;
+    timer.start();
+
+    pool->enqueueJob(bdlf::BindUtil::bind(&benchTreeJob<POOL>,
+                                          pool,
+                                          &counter,
+                                          depth));
+
+    // 'bdlmt::ThreadPool::drain' disables the pool, so we poll for the
+    // completion of the tree.
+
+    const int numJobs = (2 << depth) - 1;
+    while (counter < numJobs) {
+        bslmt::ThreadUtil::yield();
+    }
+    pool->drain();
+
+    timer.stop();
+
+    return timer.elapsedTime();
+}
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                                USAGE EXAMPLE
+// ----------------------------------------------------------------------------
+
+namespace {
+
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Parallel Divide and Conquer
+/// - - - - - - - - - - - - - - - - - - -
+// In this example we compute the sum of the elements of a large array by
+// recursively splitting the array into halves, each half being summed by a
+// separate job, until the sub-arrays are small enough to be summed directly.
+// The jobs enqueued by a job are placed on the queue of the worker running
+// it, and are stolen by the other workers as they become idle.
+//
+// First, we define the job summing a range of elements, and accumulating the
+// result in an atomic integer:
+//..
+    struct SumJob {
+        // This 'struct' provides a job computing the sum of a range of
+        // integers.
+
+        // DATA
+        bdlmt::WorkStealingThreadPool *d_pool_p;    // pool running the job
+        const int                     *d_begin_p;   // first element
+        const int                     *d_end_p;     // one past last element
+        bsls::AtomicInt64             *d_result_p;  // accumulated sum
+
+        // MANIPULATORS
+        void operator()() const
+            // Add the sum of the range '[d_begin_p .. d_end_p)' to the
+            // accumulated sum.
+        {
+            enum { k_THRESHOLD = 1024 };
+
+            if (d_end_p - d_begin_p <= k_THRESHOLD) {
+                bsls::Types::Int64 sum = 0;
+                for (const int *p = d_begin_p; p != d_end_p; ++p) {
+                    sum += *p;
+                }
+                d_result_p->add(sum);
+                return;                                               // RETURN
+            }
+//..
+// Then, if the range is too large, we split it in two halves and enqueue a
+// job for each of them:
+//..
+            const int *middle = d_begin_p + (d_end_p - d_begin_p) / 2;
+
+            SumJob left  = { d_pool_p, d_begin_p, middle,  d_result_p };
+            SumJob right = { d_pool_p, middle,    d_end_p, d_result_p };
+
+            d_pool_p->enqueueJob(left);
+            d_pool_p->enqueueJob(right);
+        }
+    };
+//..
+
+}  // close unnamed namespace
+
+// ============================================================================
+//                               MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int test = argc > 1 ? atoi(argv[1]) : 0;
+
+    verbose = argc > 2;
+    veryVerbose = argc > 3;
+    veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    bslma::TestAllocator defaultAllocator("default", veryVeryVerbose);
+    bslma::DefaultAllocatorGuard defaultGuard(&defaultAllocator);
+
+    switch (test) { case 0:  // Zero is always the leading case.
+      case 8: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //   Extracted from component header file.
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+// Next, we create a thread pool with 4 workers, and start it:
+//..
+    bdlmt::WorkStealingThreadPool pool(4);
+
+    int rc = pool.start();
+    ASSERT(0 == rc);
+//..
+// Then, we populate an array of integers, and enqueue the job summing the
+// whole array:
+//..
+    bsl::vector<int> values(100000);
+    for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+        values[i] = i;
+    }
+
+    bsls::AtomicInt64 result(0);
+
+    SumJob job = { &pool,
+                   &values[0],
+                   &values[0] + values.size(),
+                   &result };
+
+    rc = pool.enqueueJob(job);
+    ASSERT(0 == rc);
+//..
+// Now, we wait for all the jobs, including the ones enqueued by other jobs,
+// to complete, and check the result:
+//..
+    pool.drain();
+
+    ASSERT(4999950000LL == result);
+//..
+// Finally, we look at the statistics of the pool, and stop it:
+//..
+    bsls::Types::Int64 numExecuted = 0;
+    for (int i = 0; i < pool.numThreads(); ++i) {
+        numExecuted += pool.numJobsExecuted(i);
+    }
+    ASSERT(255 == numExecuted);
+
+    pool.stop();
+//..
+      } break;
+      case 7: {
+        // --------------------------------------------------------------------
+        // CONCURRENCY TEST
+        //
+        // Concerns:
+        //: 1 Jobs enqueued concurrently by several external threads, and by
+        //:   jobs running in the pool, are all executed exactly once.
+        //:
+        //: 2 'drain' returns only once every job, including the jobs enqueued
+        //:   by other jobs, has completed.
+        //:
+        //: 3 No memory is leaked.
+        //
+        // Plan:
+        //: 1 For various numbers of workers, start several producer threads
+        //:   each enqueuing tree jobs (each enqueuing two children up to a
+        //:   fixed depth).  Join the producers, 'drain' the pool, and verify
+        //:   the number of executed jobs with a counter and with the
+        //:   statistics of the pool.  (C-1..2)
+        //:
+        //: 2 Use a test allocator to verify that all memory is released.
+        //:   (C-3)
+        //
+        // Testing:
+        //   CONCURRENCY TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CONCURRENCY TEST" << endl
+                          << "================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        const int NUM_PRODUCERS = 4;
+        const int NUM_JOBS      = 200;
+        const int DEPTH         = 5;
+        const int TREE_SIZE     = (2 << DEPTH) - 1;
+
+        const int NUM_THREADS[] = { 1, 2, 3, 4, 8 };
+        const int NUM_DATA      = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int NT = NUM_THREADS[ti];
+
+            if (veryVerbose) { T_ P(NT) }
+
+            {
+                Obj mX(NT, &ta);  const Obj& X = mX;
+
+                ASSERT(0 == mX.start());
+
+                for (int iteration = 0; iteration < 3; ++iteration) {
+                    bsls::AtomicInt    counter(0);
+                    bslmt::ThreadGroup producers;
+
+                    producers.addThreads(bdlf::BindUtil::bind(&producer,
+                                                              &mX,
+                                                              &counter,
+                                                              NUM_JOBS,
+                                                              DEPTH),
+                                         NUM_PRODUCERS);
+                    producers.joinAll();
+
+                    mX.drain();
+
+                    ASSERTV(NT, counter,
+                            NUM_PRODUCERS * NUM_JOBS * TREE_SIZE == counter);
+                    ASSERTV(NT, X.numPendingJobs(), 0 == X.numPendingJobs());
+                    ASSERTV(NT, totalExecuted(X),
+                            NUM_PRODUCERS * NUM_JOBS * TREE_SIZE ==
+                                                            totalExecuted(X));
+
+                    mX.resetStatistics();
+                }
+
+                mX.stop();
+            }
+            ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+        }
+      } break;
+      case 6: {
+        // --------------------------------------------------------------------
+        // STEALING AND STATISTICS
+        //
+        // Concerns:
+        //: 1 Jobs enqueued by a job are placed on the queue of the worker
+        //:   running that job, and are stolen by idle workers.
+        //:
+        //: 2 With a single worker, no job is ever stolen.
+        //:
+        //: 3 'numJobsExecuted', 'numJobsStolen', 'numStealFailures', and
+        //:   'idleTime' report the activity of each worker.
+        //:
+        //: 4 'resetStatistics' resets all statistics to 0.
+        //
+        // Plan:
+        //: 1 Enqueue a job that enqueues a number of slow child jobs on a pool
+        //:   of 1 worker, and verify that no job is stolen.  (C-2)
+        //:
+        //: 2 Repeat on a pool of 4 workers, and verify that some of the child
+        //:   jobs were stolen, that the total number of executed jobs is
+        //:   correct, and that the idle workers accumulated steal failures
+        //:   and idle time.  (C-1, 3)
+        //:
+        //: 3 Call 'resetStatistics' and verify that all statistics are 0.
+        //:   (C-4)
+        //
+        // Testing:
+        //   void resetStatistics();
+        //   bsls::TimeInterval idleTime(int workerIndex) const;
+        //   bsls::Types::Int64 numJobsExecuted(int workerIndex) const;
+        //   bsls::Types::Int64 numJobsStolen(int workerIndex) const;
+        //   bsls::Types::Int64 numStealFailures(int workerIndex) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "STEALING AND STATISTICS" << endl
+                          << "=======================" << endl;
+
+        const int NUM_CHILDREN = 40;
+
+        if (verbose) cout << "\nA single worker never steals." << endl;
+        {
+            Obj mX(1);  const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            bsls::AtomicInt counter(0);
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&spawningJob,
+                                                           &mX,
+                                                           &counter,
+                                                           NUM_CHILDREN,
+                                                           100)));
+            mX.drain();
+
+            ASSERTV(counter,             NUM_CHILDREN + 1 == counter);
+            ASSERTV(X.numJobsExecuted(0),
+                    NUM_CHILDREN + 1 == X.numJobsExecuted(0));
+            ASSERTV(X.numJobsStolen(0),    0 == X.numJobsStolen(0));
+            ASSERTV(X.numStealFailures(0), 0 == X.numStealFailures(0));
+
+            mX.stop();
+        }
+
+        if (verbose) cout << "\nIdle workers steal jobs." << endl;
+        {
+            const int NT = 4;
+
+            Obj mX(NT);  const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            // Let the workers become idle.
+
+            bslmt::ThreadUtil::microSleep(10000);
+
+            bsls::AtomicInt counter(0);
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&spawningJob,
+                                                           &mX,
+                                                           &counter,
+                                                           NUM_CHILDREN,
+                                                           1000)));
+            mX.drain();
+
+            ASSERTV(counter, NUM_CHILDREN + 1 == counter);
+            ASSERTV(totalExecuted(X), NUM_CHILDREN + 1 == totalExecuted(X));
+            ASSERTV(totalStolen(X),   0 < totalStolen(X));
+            ASSERTV(totalStolen(X),   NUM_CHILDREN >= totalStolen(X));
+
+            Int64              numFailures = 0;
+            bsls::TimeInterval idle;
+            for (int i = 0; i < NT; ++i) {
+                if (veryVerbose) {
+                    T_ P_(i) P_(X.numJobsExecuted(i)) P_(X.numJobsStolen(i))
+                    P_(X.numStealFailures(i)) P(X.idleTime(i))
+                }
+                numFailures += X.numStealFailures(i);
+                idle        += X.idleTime(i);
+            }
+            ASSERTV(numFailures, 0 < numFailures);
+            ASSERTV(idle, bsls::TimeInterval() < idle);
+
+            mX.resetStatistics();
+
+            for (int i = 0; i < NT; ++i) {
+                ASSERTV(i, 0 == X.numJobsExecuted(i));
+                ASSERTV(i, 0 == X.numJobsStolen(i));
+                ASSERTV(i, 0 == X.numStealFailures(i));
+                ASSERTV(i, bsls::TimeInterval() == X.idleTime(i));
+            }
+
+            mX.stop();
+        }
+      } break;
+      case 5: {
+        // --------------------------------------------------------------------
+        // TESTING 'shutdown'
+        //
+        // Concerns:
+        //: 1 'shutdown' disables enqueuing, discards the pending jobs without
+        //:   executing them, and waits for the active jobs to complete.
+        //:
+        //: 2 'numPendingJobs' and 'numActiveThreads' report the jobs waiting
+        //:   and being executed.
+        //:
+        //: 3 The destructor discards the pending jobs.
+        //
+        // Plan:
+        //: 1 Using a single worker, enqueue a job blocking on a semaphore, and
+        //:   wait until it started.  Enqueue a number of jobs incrementing a
+        //:   counter, and verify the values of 'numPendingJobs' and
+        //:   'numActiveThreads'.  (C-2)
+        //:
+        //: 2 Call 'shutdown' in a separate thread, wait until the pending jobs
+        //:   are discarded, and then release the blocking job.  Verify that
+        //:   the counter was never incremented, and that enqueuing is
+        //:   disabled.  (C-1)
+        //:
+        //: 3 Repeat P-1, and destroy the pool (releasing the blocking job
+        //:   from a separate thread).  (C-3)
+        //
+        // Testing:
+        //   void shutdown();
+        //   int numActiveThreads() const;
+        //   int numPendingJobs() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'shutdown'" << endl
+                          << "==================" << endl;
+
+        const int NUM_JOBS = 10;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+        {
+            Obj mX(1, &ta);  const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            bslmt::Semaphore started;
+            bslmt::Semaphore release;
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&blockingJob,
+                                                           &started,
+                                                           &release)));
+            started.wait();
+
+            ASSERT(1 == X.numActiveThreads());
+            ASSERT(0 == X.numPendingJobs());
+
+            bsls::AtomicInt counter(0);
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                               &counter)));
+            }
+            ASSERTV(X.numPendingJobs(), NUM_JOBS == X.numPendingJobs());
+
+            bslmt::ThreadUtil::Handle handle;
+            ASSERT(0 == bslmt::ThreadUtil::create(
+                              &handle,
+                              bdlf::BindUtil::bind(&callShutdown, &mX)));
+
+            while (0 != X.numPendingJobs()) {
+                bslmt::ThreadUtil::yield();
+            }
+            release.post();
+
+            ASSERT(0 == bslmt::ThreadUtil::join(handle));
+
+            ASSERTV(counter, 0 == counter);
+            ASSERT(false == X.isEnabled());
+            ASSERT(0     != mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                               &counter)));
+            ASSERT(0     == X.numThreadsStarted());
+            ASSERT(0     == X.numActiveThreads());
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+
+        if (verbose) cout << "\nThe destructor discards pending jobs." << endl;
+        {
+            bsls::AtomicInt  counter(0);
+            bslmt::Semaphore started;
+            bslmt::Semaphore release;
+            {
+                Obj mX(1, &ta);
+
+                ASSERT(0 == mX.start());
+
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&blockingJob,
+                                                               &started,
+                                                               &release)));
+                started.wait();
+
+                for (int i = 0; i < NUM_JOBS; ++i) {
+                    ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                                 &incrementJob,
+                                                                 &counter)));
+                }
+
+                // The blocking job is released before the destructor is
+                // called, but (with a single worker) the pending jobs cannot
+                // run before it completes.
+
+                release.post();
+            }
+            ASSERTV(counter, NUM_JOBS >= counter);
+        }
+        ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+      } break;
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING 'stop'
+        //
+        // Concerns:
+        //: 1 'stop' disables enqueuing, executes all pending jobs, and joins
+        //:   the processing threads.
+        //:
+        //: 2 A stopped pool can be restarted.
+        //
+        // Plan:
+        //: 1 Using a single worker, enqueue a job blocking on a semaphore,
+        //:   followed by a number of jobs incrementing a counter.  Release
+        //:   the blocking job and call 'stop'.  Verify that every job was
+        //:   executed, that enqueuing is disabled, and that no thread is
+        //:   started.  (C-1)
+        //:
+        //: 2 Restart the pool, and verify that jobs are executed.  (C-2)
+        //
+        // Testing:
+        //   void stop();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'stop'" << endl
+                          << "==============" << endl;
+
+        const int NUM_JOBS = 100;
+
+        const int NUM_THREADS[] = { 1, 2, 4 };
+        const int NUM_DATA      = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int NT = NUM_THREADS[ti];
+
+            Obj mX(NT);  const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            bslmt::Semaphore started;
+            bslmt::Semaphore release;
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&blockingJob,
+                                                           &started,
+                                                           &release)));
+            started.wait();
+
+            bsls::AtomicInt counter(0);
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&sleepingJob,
+                                                               &counter,
+                                                               100)));
+            }
+            release.post();
+
+            mX.stop();
+
+            ASSERTV(NT, counter, NUM_JOBS == counter);
+            ASSERT(false == X.isEnabled());
+            ASSERT(false == X.isStarted());
+            ASSERT(0     == X.numThreadsStarted());
+            ASSERT(0     != mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                               &counter)));
+
+            // Restart the pool.
+
+            ASSERT(0 == mX.start());
+            ASSERT(true == X.isStarted());
+
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                               &counter)));
+            }
+            mX.stop();
+
+            ASSERTV(NT, counter, 2 * NUM_JOBS == counter);
+        }
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING 'enqueueJob' AND 'drain'
+        //
+        // Concerns:
+        //: 1 Both 'enqueueJob' overloads enqueue a job that is executed by the
+        //:   pool.
+        //:
+        //: 2 'drain' waits until all jobs, including the jobs enqueued by
+        //:   other jobs, have completed, and does not disable enqueuing.
+        //:
+        //: 3 'drain' returns immediately if there are no jobs.
+        //
+        // Plan:
+        //: 1 For various numbers of workers, enqueue jobs with both overloads,
+        //:   'drain' the pool, and verify the number of executed jobs.  (C-1)
+        //:
+        //: 2 Enqueue a tree job enqueuing further jobs, 'drain' the pool, and
+        //:   verify that all jobs of the tree were executed, and that the pool
+        //:   is still enabled.  (C-2)
+        //:
+        //: 3 Call 'drain' on an idle pool.  (C-3)
+        //
+        // Testing:
+        //   int enqueueJob(const Job& functor);
+        //   int enqueueJob(WorkStealingThreadPoolJobFunc function, void *d);
+        //   void drain();
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "TESTING 'enqueueJob' AND 'drain'" << endl
+                          << "================================" << endl;
+
+        const int NUM_JOBS = 1000;
+        const int DEPTH    = 8;
+
+        const int NUM_THREADS[] = { 1, 2, 3, 4, 8 };
+        const int NUM_DATA      = sizeof NUM_THREADS / sizeof *NUM_THREADS;
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int NT = NUM_THREADS[ti];
+
+            if (veryVerbose) { T_ P(NT) }
+
+            Obj mX(NT);  const Obj& X = mX;
+
+            mX.drain();
+
+            ASSERT(0 == mX.start());
+
+            mX.drain();
+
+            bsls::AtomicInt counter(0);
+            for (int i = 0; i < NUM_JOBS; ++i) {
+                if (i % 2) {
+                    ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(
+                                                                 &incrementJob,
+                                                                 &counter)));
+                }
+                else {
+                    ASSERT(0 == mX.enqueueJob(&incrementJobFunc, &counter));
+                }
+            }
+            mX.drain();
+
+            ASSERTV(NT, counter, NUM_JOBS == counter);
+            ASSERTV(NT, NUM_JOBS == totalExecuted(X));
+
+            counter = 0;
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&treeJob,
+                                                           &mX,
+                                                           &counter,
+                                                           DEPTH)));
+            mX.drain();
+
+            ASSERTV(NT, counter, (2 << DEPTH) - 1 == counter);
+            ASSERT(true == X.isEnabled());
+            ASSERT(0    == X.numPendingJobs());
+
+            mX.stop();
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // CREATORS, 'start', AND BASIC ACCESSORS
+        //
+        // Concerns:
+        //: 1 A newly created pool has the specified number of threads, is not
+        //:   started, and does not accept jobs.
+        //:
+        //: 2 'start' spawns 'numThreads()' threads and enables enqueuing, and
+        //:   has no effect if the pool is already started.
+        //:
+        //: 3 'disable' and 'enable' control enqueuing.
+        //:
+        //: 4 The constructors use the specified allocator, and the destructor
+        //:   releases all memory.
+        //
+        // Plan:
+        //: 1 Create pools with both constructors and a test allocator, and
+        //:   verify the accessors before and after calling 'start'.  (C-1..2)
+        //:
+        //: 2 Call 'disable' and 'enable', and verify the return value of
+        //:   'enqueueJob'.  (C-3)
+        //:
+        //: 3 Verify that the test allocator is used, and that no memory is
+        //:   in use after destruction.  (C-4)
+        //
+        // Testing:
+        //   WorkStealingThreadPool(int numThreads, Allocator *ba = 0);
+        //   WorkStealingThreadPool(const ThreadAttributes&, int, Allocator *);
+        //   ~WorkStealingThreadPool();
+        //   void disable();
+        //   void enable();
+        //   int start();
+        //   bool isEnabled() const;
+        //   bool isStarted() const;
+        //   int numThreads() const;
+        //   int numThreadsStarted() const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "CREATORS, 'start', AND BASIC ACCESSORS" << endl
+                          << "======================================" << endl;
+
+        bslma::TestAllocator ta("object", veryVeryVerbose);
+
+        for (int NT = 1; NT <= 5; ++NT) {
+            for (int ci = 0; ci < 2; ++ci) {
+                if (veryVerbose) { T_ P_(NT) P(ci) }
+
+                {
+                    bslmt::ThreadAttributes attributes;
+                    attributes.setStackSize(256 * 1024);
+
+                    Obj *objPtr = 0 == ci
+                                ? new (ta) Obj(NT, &ta)
+                                : new (ta) Obj(attributes, NT, &ta);
+                    Obj& mX = *objPtr;  const Obj& X = mX;
+
+                    ASSERT(0 < ta.numBlocksInUse());
+
+                    ASSERT(NT    == X.numThreads());
+                    ASSERT(0     == X.numThreadsStarted());
+                    ASSERT(false == X.isStarted());
+                    ASSERT(false == X.isEnabled());
+                    ASSERT(0     == X.numPendingJobs());
+                    ASSERT(0     == X.numActiveThreads());
+
+                    bsls::AtomicInt counter(0);
+
+                    ASSERT(0 != mX.enqueueJob(&incrementJobFunc, &counter));
+
+                    ASSERT(0     == mX.start());
+                    ASSERT(NT    == X.numThreadsStarted());
+                    ASSERT(true  == X.isStarted());
+                    ASSERT(true  == X.isEnabled());
+
+                    ASSERT(0     == mX.start());
+                    ASSERT(NT    == X.numThreadsStarted());
+
+                    mX.disable();
+                    ASSERT(false == X.isEnabled());
+                    ASSERT(0     != mX.enqueueJob(&incrementJobFunc,
+                                                  &counter));
+
+                    mX.enable();
+                    ASSERT(true  == X.isEnabled());
+                    ASSERT(0     == mX.enqueueJob(&incrementJobFunc,
+                                                  &counter));
+
+                    mX.drain();
+                    ASSERT(1     == counter);
+
+                    ta.deleteObject(objPtr);
+                }
+                ASSERTV(ta.numBlocksInUse(), 0 == ta.numBlocksInUse());
+            }
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Start a pool, enqueue jobs, drain the pool, and stop it.  (C-1)
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX(4);  const Obj& X = mX;
+
+        ASSERT(4     == X.numThreads());
+        ASSERT(false == X.isStarted());
+
+        ASSERT(0 == mX.start());
+        ASSERT(true == X.isStarted());
+
+        bsls::AtomicInt counter(0);
+        for (int i = 0; i < 100; ++i) {
+            ASSERT(0 == mX.enqueueJob(bdlf::BindUtil::bind(&incrementJob,
+                                                           &counter)));
+        }
+        mX.drain();
+        ASSERTV(counter, 100 == counter);
+
+        mX.stop();
+        ASSERT(false == X.isStarted());
+        ASSERTV(totalExecuted(X), 100 == totalExecuted(X));
+      } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE TEST
+        //
+        // Concerns:
+        //: 1 Compare the throughput of 'bdlmt::WorkStealingThreadPool' with
+        //:   'bdlmt::FixedThreadPool' and 'bdlmt::ThreadPool' for
+        //:   fine-grained jobs.
+        //
+        // Plan:
+        //: 1 For each number of threads 'N' in '{ 1, 2, 4, 8, 16, 32, 64 }',
+        //:   measure the time to execute (a) empty jobs enqueued by 4
+        //:   external threads, and (b) a binary tree of empty jobs, each
+        //:   enqueuing its two children, with pools of 'N' threads.  Optional
+        //:   second and third arguments specify the number of jobs per
+        //:   producer and the depth of the tree.
+        //
+        // Testing:
+        //   PERFORMANCE TEST: work-stealing vs. fixed vs. dynamic thread pool
+        // --------------------------------------------------------------------
+
+        cout << endl
+             << "PERFORMANCE TEST" << endl
+             << "================" << endl;
+
+        const int NUM_JOBS      = argc > 2 ? atoi(argv[2]) : 100000;
+        const int DEPTH         = argc > 3 ? atoi(argv[3]) : 16;
+        const int NUM_PRODUCERS = 4;
+
+        cout << "jobs per producer: " << NUM_JOBS
+             << ", producers: "       << NUM_PRODUCERS
+             << ", tree depth: "      << DEPTH << endl
+             << "threads\tFixed\tDynamic\tWorkStealing\t"
+             << "Fixed(tree)\tDynamic(tree)\tWorkStealing(tree)"
+             << "\t(M jobs/s)" << endl;
+
+        const double flatTotal = NUM_PRODUCERS * NUM_JOBS / 1e6;
+        const double treeTotal = ((2 << DEPTH) - 1) / 1e6;
+
+        for (int numThreads = 1; numThreads <= 64; numThreads *= 2) {
+            bslmt::ThreadAttributes attributes;
+
+            double fixedTime, fixedTreeTime;
+            {
+                // The queue must be large enough to hold a whole tree, since
+                // jobs enqueuing jobs into a full queue would deadlock.
+
+                bdlmt::FixedThreadPool pool(attributes,
+                                            numThreads,
+                                            (2 << DEPTH) + 1);
+                pool.start();
+                fixedTime     = runFlatBenchmark(&pool,
+                                                 NUM_PRODUCERS,
+                                                 NUM_JOBS);
+                fixedTreeTime = runTreeBenchmark(&pool, DEPTH);
+                pool.stop();
+            }
+
+            double dynamicTime, dynamicTreeTime;
+            {
+                bdlmt::ThreadPool pool(attributes,
+                                       numThreads,
+                                       numThreads,
+                                       1000);
+                pool.start();
+                dynamicTime = runFlatBenchmark(&pool,
+                                               NUM_PRODUCERS,
+                                               NUM_JOBS);
+
+                // 'bdlmt::ThreadPool::drain' disables enqueuing.
+
+                pool.start();
+                dynamicTreeTime = runTreeBenchmark(&pool, DEPTH);
+                pool.stop();
+            }
+
+            double stealingTime, stealingTreeTime;
+            {
+                Obj pool(attributes, numThreads);
+                pool.start();
+                stealingTime     = runFlatBenchmark(&pool,
+                                                    NUM_PRODUCERS,
+                                                    NUM_JOBS);
+                stealingTreeTime = runTreeBenchmark(&pool, DEPTH);
+
+                if (veryVerbose) {
+                    for (int i = 0; i < pool.numThreads(); ++i) {
+                        T_ P_(i) P_(pool.numJobsExecuted(i))
+                        P_(pool.numJobsStolen(i))
+                        P_(pool.numStealFailures(i)) P(pool.idleTime(i))
+                    }
+                }
+                pool.stop();
+            }
+
+            cout << numThreads               << '\t'
+                 << flatTotal / fixedTime    << '\t'
+                 << flatTotal / dynamicTime  << '\t'
+                 << flatTotal / stealingTime << '\t'
+                 << treeTotal / fixedTreeTime    << '\t'
+                 << treeTotal / dynamicTreeTime  << '\t'
+                 << treeTotal / stealingTreeTime << endl;
+        }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
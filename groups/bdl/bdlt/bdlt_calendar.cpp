@@ -4,9 +4,12 @@
 #include <bsls_ident.h>
 BSLS_IDENT_RCSID(bdlt_calendar_cpp,"$Id$ $CSID$")
 
+#include <bdlb_bitutil.h>
+
 #include <bslalg_swaputil.h>
 #include <bslma_default.h>
 #include <bsls_assert.h>
+#include <bsls_types.h>
 
 #include <bsl_algorithm.h>
 #include <bsl_ostream.h>
@@ -18,11 +21,59 @@ namespace bdlt {
 // 'bdlc::BitArray::find*', when cast to an 'int', is -1.
 BSLMF_ASSERT(-1 == static_cast<int>(bdlc::BitArray::k_INVALID_INDEX));
 
+namespace {
+
+enum { k_BITS_PER_BLOCK = bdlc::BitArray::k_BITS_PER_UINT64 };
+
+}  // close unnamed namespace
+
                               // --------------
                               // class Calendar
                               // --------------
 
 // PRIVATE MANIPULATORS
+void Calendar::reserveCacheCapacity(int numDays)
+{
+    d_nonBusinessDays.reserveCapacity(numDays);
+    d_businessDayRanks.reserve(
+                        (numDays + k_BITS_PER_BLOCK - 1) / k_BITS_PER_BLOCK + 1);
+}
+
+void Calendar::synchronizeBusinessDayRanks(int offset)
+{
+    BSLS_ASSERT(0 <= offset);
+
+    const int length = static_cast<int>(d_nonBusinessDays.length());
+
+    if (0 == length) {
+        d_businessDayRanks.clear();
+        return;                                                       // RETURN
+    }
+
+    const int numBlocks = (length + k_BITS_PER_BLOCK - 1) / k_BITS_PER_BLOCK;
+
+    if (d_businessDayRanks.size() != static_cast<bsl::size_t>(numBlocks + 1)) {
+        d_businessDayRanks.resize(numBlocks + 1);
+        offset = 0;
+    }
+
+    BSLS_ASSERT(offset < length);
+
+    int block = offset / k_BITS_PER_BLOCK;
+    int rank  = d_businessDayRanks[block];
+
+    for (; block < numBlocks; ++block) {
+        const int blockBase = block * k_BITS_PER_BLOCK;
+        const int numBits   = bsl::min<int>(k_BITS_PER_BLOCK,
+                                            length - blockBase);
+
+        d_businessDayRanks[block] = rank;
+        rank += numBits - bdlb::BitUtil::numBitsSet(
+                                 d_nonBusinessDays.bits(blockBase, numBits));
+    }
+    d_businessDayRanks[numBlocks] = rank;
+}
+
 void Calendar::synchronizeCache()
 {
     const int length = d_packedCalendar.length();
@@ -89,6 +140,7 @@ void Calendar::synchronizeCache()
             }
         }
     }
+    synchronizeBusinessDayRanks(0);
 }
 
 // PRIVATE ACCESSORS
@@ -100,7 +152,25 @@ bool Calendar::isCacheSynchronized() const
     }
 
     if (0 == d_packedCalendar.length()) {
-        return true;                                                  // RETURN
+        return d_businessDayRanks.empty();                            // RETURN
+    }
+
+    const int numBlocks = (d_packedCalendar.length() + k_BITS_PER_BLOCK - 1)
+                        / k_BITS_PER_BLOCK;
+
+    if (d_businessDayRanks.size() != static_cast<bsl::size_t>(numBlocks + 1)
+     || d_businessDayRanks.back() !=
+                            static_cast<int>(d_nonBusinessDays.num0())) {
+        return false;                                                 // RETURN
+    }
+
+    for (int block = 0; block < numBlocks; ++block) {
+        const bsl::size_t blockBase = block * k_BITS_PER_BLOCK;
+
+        if (d_businessDayRanks[block] !=
+                  static_cast<int>(d_nonBusinessDays.num0(0, blockBase))) {
+            return false;                                             // RETURN
+        }
     }
 
     PackedCalendar::BusinessDayConstIterator iter =
@@ -125,6 +195,7 @@ bool Calendar::isCacheSynchronized() const
 Calendar::Calendar(bslma::Allocator *basicAllocator)
 : d_packedCalendar(basicAllocator)
 , d_nonBusinessDays(basicAllocator)
+, d_businessDayRanks(basicAllocator)
 {
 }
 
@@ -133,14 +204,17 @@ Calendar::Calendar(const Date&       firstDate,
                    bslma::Allocator *basicAllocator)
 : d_packedCalendar(firstDate, lastDate, basicAllocator)
 , d_nonBusinessDays(basicAllocator)
+, d_businessDayRanks(basicAllocator)
 {
     d_nonBusinessDays.setLength(d_packedCalendar.length(), 0);
+    synchronizeBusinessDayRanks(0);
 }
 
 Calendar::Calendar(const PackedCalendar&  packedCalendar,
                    bslma::Allocator      *basicAllocator)
 : d_packedCalendar(packedCalendar, basicAllocator)
 , d_nonBusinessDays(basicAllocator)
+, d_businessDayRanks(basicAllocator)
 {
     synchronizeCache();
 }
@@ -148,6 +222,7 @@ Calendar::Calendar(const PackedCalendar&  packedCalendar,
 Calendar::Calendar(const Calendar& original, bslma::Allocator *basicAllocator)
 : d_packedCalendar(original.d_packedCalendar, basicAllocator)
 , d_nonBusinessDays(original.d_nonBusinessDays, basicAllocator)
+, d_businessDayRanks(original.d_businessDayRanks, basicAllocator)
 {
 }
 
@@ -173,21 +248,19 @@ void Calendar::addDay(const Date& date)
 void Calendar::addHoliday(const Date& date)
 {
     if (0 == length()) {
-        d_nonBusinessDays.reserveCapacity(1);
+        reserveCacheCapacity(1);
         reserveHolidayCapacity(1);
         d_packedCalendar.addHoliday(date);
         synchronizeCache();
     }
     else if (date < d_packedCalendar.firstDate()) {
-        d_nonBusinessDays.reserveCapacity(
-                                       d_packedCalendar.lastDate() - date + 1);
+        reserveCacheCapacity(d_packedCalendar.lastDate() - date + 1);
         reserveHolidayCapacity(numHolidays() + 1);
         d_packedCalendar.addHoliday(date);
         synchronizeCache();
     }
     else if (date > d_packedCalendar.lastDate()) {
-        d_nonBusinessDays.reserveCapacity(
-                                      date - d_packedCalendar.firstDate() + 1);
+        reserveCacheCapacity(date - d_packedCalendar.firstDate() + 1);
         reserveHolidayCapacity(numHolidays() + 1);
         d_packedCalendar.addHoliday(date);
         synchronizeCache();
@@ -196,29 +269,28 @@ void Calendar::addHoliday(const Date& date)
         reserveHolidayCapacity(numHolidays() + 1);
         d_packedCalendar.addHoliday(date);
         d_nonBusinessDays.assign1(date - d_packedCalendar.firstDate());
+        synchronizeBusinessDayRanks(date - d_packedCalendar.firstDate());
     }
 }
 
 void Calendar::addHolidayCode(const Date& date, int holidayCode)
 {
     if (0 == length()) {
-        d_nonBusinessDays.reserveCapacity(1);
+        reserveCacheCapacity(1);
         reserveHolidayCapacity(1);
         reserveHolidayCodeCapacity(1);
         d_packedCalendar.addHolidayCode(date, holidayCode);
         synchronizeCache();
     }
     else if (date < d_packedCalendar.firstDate()) {
-        d_nonBusinessDays.reserveCapacity(
-                                       d_packedCalendar.lastDate() - date + 1);
+        reserveCacheCapacity(d_packedCalendar.lastDate() - date + 1);
         reserveHolidayCapacity(numHolidays() + 1);
         reserveHolidayCodeCapacity(numHolidayCodesTotal() + 1);
         d_packedCalendar.addHolidayCode(date, holidayCode);
         synchronizeCache();
     }
     else if (date > d_packedCalendar.lastDate()) {
-        d_nonBusinessDays.reserveCapacity(
-                                      date - d_packedCalendar.firstDate() + 1);
+        reserveCacheCapacity(date - d_packedCalendar.firstDate() + 1);
         reserveHolidayCapacity(numHolidays() + 1);
         reserveHolidayCodeCapacity(numHolidayCodesTotal() + 1);
         d_packedCalendar.addHolidayCode(date, holidayCode);
@@ -229,6 +301,7 @@ void Calendar::addHolidayCode(const Date& date, int holidayCode)
         reserveHolidayCodeCapacity(numHolidayCodesTotal() + 1);
         d_packedCalendar.addHolidayCode(date, holidayCode);
         d_nonBusinessDays.assign1(date - d_packedCalendar.firstDate());
+        synchronizeBusinessDayRanks(date - d_packedCalendar.firstDate());
     }
 }
 
@@ -246,6 +319,7 @@ void Calendar::addWeekendDay(DayOfWeek::Enum weekendDay)
             d_nonBusinessDays.assign1(weekendDayIndex);
             weekendDayIndex += 7;
         }
+        synchronizeBusinessDayRanks(0);
     }
 }
 
@@ -279,7 +353,7 @@ void Calendar::unionBusinessDays(const PackedCalendar& other)
         newLength = length() + other.length();
     }
 
-    d_nonBusinessDays.reserveCapacity(newLength);
+    reserveCacheCapacity(newLength);
     d_packedCalendar.unionBusinessDays(other);
     synchronizeCache();
 }
@@ -300,12 +374,62 @@ void Calendar::unionNonBusinessDays(const PackedCalendar& other)
         newLength = length() + other.length();
     }
 
-    d_nonBusinessDays.reserveCapacity(newLength);
+    reserveCacheCapacity(newLength);
     d_packedCalendar.unionNonBusinessDays(other);
     synchronizeCache();
 }
 
 // ACCESSORS
+Date Calendar::businessDay(int index) const
+{
+    BSLS_ASSERT(0 <= index);
+    BSLS_ASSERT(index < numBusinessDays());
+
+    // Find the last block preceded by at most 'index' business days; it
+    // contains the business day.  Business days are usually spread evenly
+    // over the calendar, so the block that 'index' would fall in were the
+    // spread exactly even is tried first; otherwise, the directory is binary
+    // searched on the side of that block known to hold the business day.
+
+    typedef bsl::vector<int>::const_iterator RankIter;
+
+    const RankIter begin     = d_businessDayRanks.begin();
+    const int      numBlocks = static_cast<int>(d_businessDayRanks.size()) - 1;
+
+    int block = static_cast<int>(static_cast<bsls::Types::Int64>(index)
+                                 * numBlocks
+                                 / d_businessDayRanks.back());
+
+    if (d_businessDayRanks[block] > index) {
+        block = static_cast<int>(bsl::upper_bound(begin,
+                                                  begin + block,
+                                                  index) - begin)
+              - 1;
+    }
+    else if (d_businessDayRanks[block + 1] <= index) {
+        block = static_cast<int>(bsl::upper_bound(begin + block + 1,
+                                                  d_businessDayRanks.end(),
+                                                  index) - begin)
+              - 1;
+    }
+
+    const int blockBase = block * k_BITS_PER_BLOCK;
+    const int numBits   = bsl::min<int>(k_BITS_PER_BLOCK,
+                                        length() - blockBase);
+
+    // Clear, in the business days of the block, the ones preceding the
+    // business day, which is then the lowest one remaining.
+
+    bsl::uint64_t businessDays = ~d_nonBusinessDays.bits(blockBase, numBits);
+    for (int n = index - d_businessDayRanks[block]; 0 < n; --n) {
+        businessDays &= businessDays - 1;
+    }
+
+    return firstDate()
+         + blockBase
+         + bdlb::BitUtil::numTrailingUnsetBits(businessDays);
+}
+
 int Calendar::getNextBusinessDay(Date        *nextBusinessDay,
                                  const Date&  date,
                                  int          nth) const
@@ -317,16 +441,13 @@ int Calendar::getNextBusinessDay(Date        *nextBusinessDay,
 
     enum { e_SUCCESS = 0, e_FAILURE = 1 };
 
-    int offset = date - firstDate();
-    while (nth) {
-        offset = static_cast<int>(
-                                d_nonBusinessDays.find0AtMinIndex(offset + 1));
-        if (0 > offset) {
-            return e_FAILURE;                                         // RETURN
-        }
-        --nth;
+    const int numFollowing = numBusinessDays()
+                           - businessDayRank(date + 1 - firstDate());
+    if (nth > numFollowing) {
+        return e_FAILURE;                                             // RETURN
     }
-    *nextBusinessDay = firstDate() + offset;
+
+    *nextBusinessDay = businessDay(numBusinessDays() - numFollowing + nth - 1);
 
     return e_SUCCESS;
 }
@@ -34,6 +34,17 @@ BSLS_IDENT("$Id: $")
 // binary search in a 'bdlt::PackedCalendar' representing the same calendar
 // value.
 //
+// A 'bdlt::Calendar' also maintains a directory holding the number of business
+// days that precede every 64th date of its valid range.  Counting the business
+// days in a range of dates (see 'numBusinessDays' and
+// 'numBusinessDaysBefore') is thus a constant-time operation, and finding the
+// business day at a given position (see 'businessDay') takes time logarithmic
+// in the length of the valid range, regardless of the distance between the
+// dates involved.  'bdlt::CalendarUtil' uses these methods to add and subtract
+// business days.  Maintaining the directory costs a single pass over it when
+// one date changes (e.g., in 'addHoliday'), in addition to the cost of the
+// change itself.
+//
 // Default-constructed calendars are empty, and have an empty valid range.
 // Calendars can also be constructed with an initial (non-empty) valid range,
 // implying that all dates within that range are business days.  The
@@ -483,6 +494,10 @@ BSLS_IDENT("$Id: $")
 #include <bdlt_packedcalendar.h>
 #endif
 
+#ifndef INCLUDED_BDLB_BITUTIL
+#include <bdlb_bitutil.h>
+#endif
+
 #ifndef INCLUDED_BDLC_BITARRAY
 #include <bdlc_bitarray.h>
 #endif
@@ -519,6 +534,10 @@ BSLS_IDENT("$Id: $")
 #include <bsl_iterator.h>
 #endif
 
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
 namespace BloombergLP {
 namespace bdlt {
 
@@ -556,6 +575,12 @@ class Calendar {
                                // of the valid range is defined by
                                // 'd_packedCalendar.firstDate() + length() - 1'
 
+    bsl::vector<int>  d_businessDayRanks;
+                               // number of business days preceding each
+                               // 64-day block of 'd_nonBusinessDays', and in
+                               // the whole cache (as the last element); empty
+                               // if and only if this calendar is empty
+
     // FRIENDS
     friend bool operator==(const Calendar&, const Calendar&);
     friend bool operator!=(const Calendar&, const Calendar&);
@@ -564,6 +589,19 @@ class Calendar {
 
   private:
     // PRIVATE MANIPULATORS
+    void reserveCacheCapacity(int numDays);
+        // Reserve sufficient memory for this calendar's cache to represent a
+        // valid range of the specified 'numDays' without allocation.
+
+    void synchronizeBusinessDayRanks(int offset);
+        // Synchronize the number of business days preceding each 64-day block
+        // of this calendar's cache, starting with the block containing the
+        // day at the specified 'offset' from 'firstDate()', with the cache.
+        // The behavior is undefined unless '0 <= offset', and
+        // 'offset < length()' or the number of blocks in the cache has
+        // changed.  Note that this method is only *exception*-*neutral*, and
+        // does not allocate if the number of blocks has not changed.
+
     void synchronizeCache();
         // Synchronize this calendar's cache by first clearing the cache, then
         // repopulating it with the holiday and weekend information from this
@@ -572,6 +610,11 @@ class Calendar {
         // handled by the caller.
 
     // PRIVATE ACCESSORS
+    int businessDayRank(int offset) const;
+        // Return the number of business days in this calendar preceding the
+        // day at the specified 'offset' from 'firstDate()'.  The behavior is
+        // undefined unless '0 <= offset <= length()' and '0 < length()'.
+
     bool isCacheSynchronized() const;
         // Return 'true' if this calendar's cache correctly represents the
         // holiday and weekend information stored in this calendar's
@@ -905,6 +948,14 @@ class Calendar {
         // calendar has no weekend-days transitions, the returned iterator has
         // the same value as that returned by 'endWeekendDaysTransitions()'.
 
+    Date businessDay(int index) const;
+        // Return the business day at the specified 'index' in this calendar,
+        // i.e., the business day preceded by exactly 'index' business days in
+        // the valid range of this calendar.  The behavior is undefined unless
+        // '0 <= index < numBusinessDays()'.  Note that the business day is
+        // found in time logarithmic in 'length()', and that
+        // 'index == numBusinessDaysBefore(businessDay(index))'.
+
     BusinessDayConstIterator endBusinessDays() const;
         // Return an iterator providing non-modifiable access to the
         // past-the-end business day in this calendar.
@@ -1061,7 +1112,17 @@ class Calendar {
         // '[beginDate .. endDate]' of this calendar that are considered
         // business days -- i.e., are neither holidays nor weekend days.  The
         // behavior is undefined unless 'beginDate' and 'endDate' are within
-        // the valid range of this calendar, and 'beginDate <= endDate'.
+        // the valid range of this calendar, and 'beginDate <= endDate'.  Note
+        // that the number is computed in constant time.
+
+    int numBusinessDaysBefore(const Date& date) const;
+        // Return the number of days in the valid range of this calendar that
+        // precede the specified 'date' and are considered business days.  The
+        // behavior is undefined unless 'date' is within the valid range of
+        // this calendar.  Note that the number is computed in constant time,
+        // and that, for 'beginDate <= endDate',
+        // 'numBusinessDaysBefore(endDate) - numBusinessDaysBefore(beginDate)'
+        // is the number of business days in '[beginDate .. endDate)'.
 
     int numHolidayCodes(const Date& date) const;
         // Return the number of (unique) holiday codes associated with the
@@ -1485,6 +1546,7 @@ void Calendar::removeAll()
 {
     d_packedCalendar.removeAll();
     d_nonBusinessDays.removeAll();
+    d_businessDayRanks.clear();
 }
 
 inline
@@ -1494,6 +1556,7 @@ void Calendar::removeHoliday(const Date& date)
 
     if (true == isInRange(date) && false == isWeekendDay(date)) {
         d_nonBusinessDays.assign0(date - firstDate());
+        synchronizeBusinessDayRanks(date - firstDate());
     }
 }
 
@@ -1524,7 +1587,7 @@ void Calendar::setValidRange(const Date& firstDate, const Date& lastDate)
         // For backwards compatibility, 'firstDate > lastDate' results in an
         // empty calendar (when asserts are not enabled).
 
-        d_nonBusinessDays.reserveCapacity(lastDate - firstDate + 1);
+        reserveCacheCapacity(lastDate - firstDate + 1);
     }
 
     d_packedCalendar.setValidRange(firstDate, lastDate);
@@ -1555,7 +1618,7 @@ STREAM& Calendar::bdexStreamIn(STREAM& stream, int version)
         if (!stream) {
             return stream;                                            // RETURN
         }
-        d_nonBusinessDays.reserveCapacity(inCal.length());
+        reserveCacheCapacity(inCal.length());
         d_packedCalendar.swap(inCal);
         synchronizeCache();
     }
@@ -1572,6 +1635,31 @@ void Calendar::swap(Calendar& other)
 
     bslalg::SwapUtil::swap(&d_packedCalendar,  &other.d_packedCalendar);
     bslalg::SwapUtil::swap(&d_nonBusinessDays, &other.d_nonBusinessDays);
+    bslalg::SwapUtil::swap(&d_businessDayRanks,
+                           &other.d_businessDayRanks);
+}
+
+// PRIVATE ACCESSORS
+inline
+int Calendar::businessDayRank(int offset) const
+{
+    BSLS_ASSERT_SAFE(0 <= offset);
+    BSLS_ASSERT_SAFE(offset <= length());
+    BSLS_ASSERT_SAFE(!d_businessDayRanks.empty());
+
+    enum { k_BITS_PER_BLOCK = bdlc::BitArray::k_BITS_PER_UINT64 };
+
+    const int block     = offset / k_BITS_PER_BLOCK;
+    const int numBits   = offset % k_BITS_PER_BLOCK;
+    const int blockBase = block * k_BITS_PER_BLOCK;
+
+    // 'bits' is called with 'numBits == 0' at the end of a full block, and
+    // then returns 0.
+
+    return d_businessDayRanks[block]
+         + numBits
+         - bdlb::BitUtil::numBitsSet(d_nonBusinessDays.bits(blockBase,
+                                                            numBits));
 }
 
 // ACCESSORS
@@ -1784,7 +1872,7 @@ int Calendar::length() const
 inline
 int Calendar::numBusinessDays() const
 {
-    return static_cast<int>(d_nonBusinessDays.num0());
+    return d_businessDayRanks.empty() ? 0 : d_businessDayRanks.back();
 }
 
 inline
@@ -1794,8 +1882,16 @@ int Calendar::numBusinessDays(const Date& beginDate, const Date& endDate) const
     BSLS_ASSERT_SAFE(isInRange(endDate));
     BSLS_ASSERT_SAFE(beginDate <= endDate);
 
-    return static_cast<int>(d_nonBusinessDays.num0(beginDate - firstDate(),
-                                                   endDate - firstDate() + 1));
+    return businessDayRank(endDate - firstDate() + 1)
+         - businessDayRank(beginDate - firstDate());
+}
+
+inline
+int Calendar::numBusinessDaysBefore(const Date& date) const
+{
+    BSLS_ASSERT_SAFE(isInRange(date));
+
+    return businessDayRank(date - firstDate());
 }
 
 inline
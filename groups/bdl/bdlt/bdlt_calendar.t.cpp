@@ -22,6 +22,7 @@
 #include <bslx_testoutstream.h>
 #include <bslx_versionfunctions.h>
 
+#include <bsl_algorithm.h>
 #include <bsl_cctype.h>
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -29,6 +30,7 @@
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
 #include <bsl_unordered_map.h>
+#include <bsl_vector.h>
 
 using namespace BloombergLP;
 using namespace bsl;
@@ -155,6 +157,8 @@ using namespace bsl;
 // [20] HolidayConstReverseIterator rendHolidays(const Date& date) const;
 // [26] WDTCRI rendWeekendDaysTransitions() const;
 // [ 4] WeekendDaysTransition weekendDaysTransition(int index) const;
+// [31] Date businessDay(int index) const;
+// [31] int numBusinessDaysBefore(const Date& date) const;
 // [ 4] bslma::Allocator *allocator() const;
 // [10] STREAM& bdexStreamOut(STREAM& stream, int version) const;
 // [ 5] ostream& print(ostream& stream, int level = 0, int sPL = 4) const;
@@ -170,7 +174,7 @@ using namespace bsl;
 // [ 8] void swap(Calendar& a, Calendar& b);
 // ----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
-// [31] USAGE EXAMPLE
+// [32] USAGE EXAMPLE
 // [ 3] CALENDAR& gg(CALENDAR *o, const char *s);
 // [ 3] int ggg(CALENDAR *obj, const char *spec, bool vF);
 // ============================================================================
@@ -1153,7 +1157,7 @@ int main(int argc, char *argv[])
     bslma::Default::setDefaultAllocator(&defaultAllocator);
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 31: {
+      case 32: {
         // --------------------------------------------------------------------
         // USAGE EXAMPLE
         //   Extracted from component header file.
@@ -1222,6 +1226,281 @@ int main(int argc, char *argv[])
                          MyCalendarUtil::modifiedFollowing(31, 7, 2015, cal2));
 //..
       } break;
+      case 31: {
+        // --------------------------------------------------------------------
+        // TESTING 'businessDay' AND 'numBusinessDaysBefore'
+        //   Ensure that business days are counted and located correctly, as
+        //   the calendar is modified.
+        //
+        // Concerns:
+        //: 1 'numBusinessDaysBefore' returns the number of business days
+        //:   preceding the specified date, for every date in the valid range.
+        //:
+        //: 2 'businessDay' returns the business day at the specified index,
+        //:   for every index from 0 to 'numBusinessDays() - 1'.
+        //:
+        //: 3 'numBusinessDays', with and without a range, and
+        //:   'getNextBusinessDay' are consistent with the business days of
+        //:   the calendar.
+        //:
+        //: 4 The results are correct for valid ranges of any length, in
+        //:   particular at the boundaries of the blocks of 64 days by which
+        //:   business days are counted, and after each manipulator changing
+        //:   the business days.
+        //:
+        //: 5 The methods are declared 'const'.
+        //:
+        //: 6 QoI: Asserted precondition violations are detected when enabled.
+        //:
+        //: 7 The results are correct when business days are spread unevenly
+        //:   over the calendar, e.g., around long runs of non-business days.
+        //
+        // Plan:
+        //: 1 For valid ranges of lengths around multiples of 64 days, create
+        //:   calendars and modify them with each manipulator changing the
+        //:   business days.  After each modification, compare, through a
+        //:   'const' reference, the results of the methods with those obtained
+        //:   by inspecting each day with 'isBusinessDay'.  (C-1..5)
+        //:
+        //: 2 Verify defensive checks are triggered for invalid values.  (C-6)
+        //:
+        //: 3 Create calendars spanning twenty years in which a run of years
+        //:   having no business days, obtained from a weekend-days transition
+        //:   to all days of the week, lies at the start, in the middle, or at
+        //:   the end of the valid range, and verify them as in P-1.  (C-7)
+        //
+        // Testing:
+        //   Date businessDay(int index) const;
+        //   int numBusinessDaysBefore(const Date& date) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+            << "TESTING 'businessDay' AND 'numBusinessDaysBefore'" << endl
+            << "=================================================" << endl;
+
+        struct Oracle {
+            static void verify(int line, int step, const Obj& X)
+                // Verify, using the specified 'line' and 'step' to identify
+                // failures, that the business day accessors of the specified
+                // 'X' are consistent with 'isBusinessDay'.
+            {
+                bsl::vector<bdlt::Date> businessDays;
+
+                for (int i = 0; i < X.length(); ++i) {
+                    const bdlt::Date DATE = X.firstDate() + i;
+
+                    LOOP3_ASSERT(line, step, i,
+                                 static_cast<int>(businessDays.size()) ==
+                                               X.numBusinessDaysBefore(DATE));
+
+                    if (X.isBusinessDay(DATE)) {
+                        businessDays.push_back(DATE);
+                    }
+                }
+
+                const int NUM_BUSINESS_DAYS =
+                                       static_cast<int>(businessDays.size());
+
+                LOOP2_ASSERT(line, step,
+                             NUM_BUSINESS_DAYS == X.numBusinessDays());
+
+                for (int i = 0; i < NUM_BUSINESS_DAYS; ++i) {
+                    LOOP3_ASSERT(line, step, i,
+                                 businessDays[i] == X.businessDay(i));
+                }
+
+                // Check ranges starting and ending at various offsets.
+
+                for (int i = 0; i < X.length(); i += 13) {
+                    for (int j = i; j < X.length(); j += 29) {
+                        const bdlt::Date BEGIN = X.firstDate() + i;
+                        const bdlt::Date END   = X.firstDate() + j;
+
+                        const int EXP = static_cast<int>(
+                              bsl::upper_bound(businessDays.begin(),
+                                               businessDays.end(),
+                                               END)
+                            - bsl::lower_bound(businessDays.begin(),
+                                               businessDays.end(),
+                                               BEGIN));
+
+                        LOOP4_ASSERT(line, step, i, j,
+                                     EXP == X.numBusinessDays(BEGIN, END));
+                    }
+                }
+
+                for (int i = 0; i + 1 < X.length(); i += 7) {
+                    const bdlt::Date DATE = X.firstDate() + i;
+
+                    const int NUM_FOLLOWING = static_cast<int>(
+                              businessDays.end()
+                            - bsl::upper_bound(businessDays.begin(),
+                                               businessDays.end(),
+                                               DATE));
+
+                    for (int nth = 1; nth <= NUM_FOLLOWING + 1; nth += 5) {
+                        bdlt::Date result;
+
+                        const int rc = X.getNextBusinessDay(&result,
+                                                            DATE,
+                                                            nth);
+
+                        LOOP4_ASSERT(line, step, i, nth,
+                                     (nth > NUM_FOLLOWING) == (0 != rc));
+
+                        if (0 == rc) {
+                            LOOP4_ASSERT(line, step, i, nth,
+                                         businessDays[NUM_BUSINESS_DAYS
+                                                      - NUM_FOLLOWING
+                                                      + nth - 1] == result);
+                        }
+                    }
+                }
+            }
+        };
+
+        const int LENGTHS[] = { 1, 2, 63, 64, 65, 127, 128, 129, 365, 1000 };
+        const int NUM_LENGTHS = static_cast<int>(sizeof LENGTHS /
+                                                 sizeof *LENGTHS);
+
+        const bdlt::Date START(2015, 1, 1);
+
+        for (int ti = 0; ti < NUM_LENGTHS; ++ti) {
+            const int LENGTH = LENGTHS[ti];
+            const int LINE   = LENGTH;
+
+            if (veryVerbose) { T_ P(LENGTH) }
+
+            bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+            Obj mX(START, START + LENGTH - 1, &oa);  const Obj& X = mX;
+
+            Oracle::verify(LINE, 0, X);
+
+            mX.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+            Oracle::verify(LINE, 1, X);
+
+            mX.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+            Oracle::verify(LINE, 2, X);
+
+            for (int i = 0; i < LENGTH; i += 11) {
+                mX.addHoliday(START + i);
+            }
+            Oracle::verify(LINE, 3, X);
+
+            for (int i = 0; i < LENGTH; i += 33) {
+                mX.addHolidayCode(START + i + LENGTH / 2 % (LENGTH - i), 7);
+            }
+            Oracle::verify(LINE, 4, X);
+
+            for (int i = 0; i < LENGTH; i += 22) {
+                mX.removeHoliday(START + i);
+            }
+            Oracle::verify(LINE, 5, X);
+
+            mX.addHoliday(START - 70);
+            Oracle::verify(LINE, 6, X);
+
+            mX.addDay(START + LENGTH + 64);
+            Oracle::verify(LINE, 7, X);
+
+            mX.addWeekendDaysTransition(START + LENGTH / 3,
+                                        bdlt::DayOfWeekSet());
+            Oracle::verify(LINE, 8, X);
+
+            mX.setValidRange(START + LENGTH / 2, START + LENGTH);
+            Oracle::verify(LINE, 9, X);
+
+            Obj mY(X, &oa);  const Obj& Y = mY;
+            Oracle::verify(LINE, 10, Y);
+
+            Obj mZ(X.packedCalendar(), &oa);  const Obj& Z = mZ;
+            mZ.unionNonBusinessDays(Y);
+            Oracle::verify(LINE, 11, Z);
+
+            mZ.swap(mX);
+            Oracle::verify(LINE, 12, X);
+            Oracle::verify(LINE, 13, Z);
+
+            mX.removeAll();
+            ASSERT(0 == X.numBusinessDays());
+
+            mX.addDay(START);
+            Oracle::verify(LINE, 14, X);
+        }
+
+        if (verbose) cout << "\nTesting long runs of non-business days."
+                          << endl;
+        {
+            bdlt::DayOfWeekSet allDays;
+            for (int d = 1; d <= 7; ++d) {
+                allDays.add(static_cast<bdlt::DayOfWeek::Enum>(d));
+            }
+
+            bdlt::DayOfWeekSet saturdayAndSunday;
+            saturdayAndSunday.add(bdlt::DayOfWeek::e_SAT);
+            saturdayAndSunday.add(bdlt::DayOfWeek::e_SUN);
+
+            static const struct {
+                int d_line;        // source line number
+                int d_runBegin;    // first year without business days
+                int d_runEnd;      // first year after the run
+            } DATA[] = {
+                //LINE  BEGIN  END
+                //----  -----  ----
+                { L_,   2000,  2015 },
+                { L_,   2003,  2017 },
+                { L_,   2005,  2020 },
+                { L_,   2010,  2011 },
+            };
+            const int NUM_DATA = static_cast<int>(sizeof DATA / sizeof *DATA);
+
+            for (int ti = 0; ti < NUM_DATA; ++ti) {
+                const int LINE      = DATA[ti].d_line;
+                const int RUN_BEGIN = DATA[ti].d_runBegin;
+                const int RUN_END   = DATA[ti].d_runEnd;
+
+                if (veryVerbose) { T_ P_(RUN_BEGIN) P(RUN_END) }
+
+                bslma::TestAllocator oa("object", veryVeryVeryVerbose);
+
+                Obj mX(bdlt::Date(2000, 1, 1), bdlt::Date(2019, 12, 31), &oa);
+                const Obj& X = mX;
+
+                mX.addWeekendDaysTransition(bdlt::Date(1, 1, 1),
+                                            saturdayAndSunday);
+                mX.addWeekendDaysTransition(bdlt::Date(RUN_BEGIN, 1, 1),
+                                            allDays);
+                mX.addWeekendDaysTransition(bdlt::Date(RUN_END, 1, 1),
+                                            saturdayAndSunday);
+
+                Oracle::verify(LINE, 0, X);
+
+                mX.addHoliday(bdlt::Date(2019, 12, 31));
+                mX.addHoliday(bdlt::Date(RUN_END, 1, 2));
+                Oracle::verify(LINE, 1, X);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertFailureHandlerGuard hG(
+                                             bsls::AssertTest::failTestDriver);
+
+            Obj mX;  const Obj& X = gg(&mX, "ua@2015/1/1 30");
+
+            ASSERT_SAFE_PASS(X.numBusinessDaysBefore(bdlt::Date(2015, 1,  1)));
+            ASSERT_SAFE_PASS(X.numBusinessDaysBefore(bdlt::Date(2015, 1, 31)));
+            ASSERT_SAFE_FAIL(X.numBusinessDaysBefore(bdlt::Date(2014, 12,
+                                                                31)));
+            ASSERT_SAFE_FAIL(X.numBusinessDaysBefore(bdlt::Date(2015, 2,  1)));
+
+            ASSERT_PASS(X.businessDay(0));
+            ASSERT_PASS(X.businessDay(X.numBusinessDays() - 1));
+            ASSERT_FAIL(X.businessDay(-1));
+            ASSERT_FAIL(X.businessDay(X.numBusinessDays()));
+        }
+      } break;
       case 30: {
         // --------------------------------------------------------------------
         // TESTING: hashAppend
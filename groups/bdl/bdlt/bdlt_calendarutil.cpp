@@ -7,6 +7,8 @@ BSLS_IDENT_RCSID(bdlt_calendarutil_cpp,"$Id$ $CSID$")
 #include <bdlt_date.h>
 #include <bdlt_serialdateimputil.h>
 
+#include <bsls_types.h>
+
 namespace BloombergLP {
 namespace bdlt {
 
@@ -28,49 +30,25 @@ int CalendarUtil::addBusinessDaysIfValid(
         return e_OUT_OF_RANGE;                                        // RETURN
     }
 
-    unsigned int absNumBusDays = numBusinessDays >= 0
-                               ? numBusinessDays
-                               : -numBusinessDays;
-
-    // declare forward and reverse iterators
-
-    unsigned int count = calendar.isBusinessDay(original) ? 0 : 1;
-
-    if (numBusinessDays < 0) {
-        // an iterator to the business day on or before original
-
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                         calendar.rbeginBusinessDays(original);
-
-        while (rit != calendar.rendBusinessDays() && count < absNumBusDays) {
-            ++rit;
-            ++count;
-        }
+    // Compute the index of the resulting business day in 'calendar' (see
+    // 'Calendar::businessDay').  If 'original' is not a business day, the
+    // first business day following it is the first one counted.
 
-        if (rit == calendar.rendBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
+    bsls::Types::Int64 index =
+                       static_cast<bsls::Types::Int64>(
+                                    calendar.numBusinessDaysBefore(original))
+                     + numBusinessDays;
 
-        *result = *rit;
+    if (0 < numBusinessDays && !calendar.isBusinessDay(original)) {
+        --index;
     }
-    else {
-        // an iterator to the business day on or after 'original'
-
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                          calendar.beginBusinessDays(original);
 
-        while (fit != calendar.endBusinessDays() && count < absNumBusDays) {
-            ++fit;
-            ++count;
-        }
-
-        if (fit == calendar.endBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
-
-        *result = *fit;
+    if (0 > index || calendar.numBusinessDays() <= index) {
+        return e_OUT_OF_RANGE;                                        // RETURN
     }
 
+    *result = calendar.businessDay(static_cast<int>(index));
+
     return e_SUCCESS;
 }
 
@@ -98,63 +76,23 @@ int CalendarUtil::nthBusinessDayOfMonthOrMaxIfValid(
         return e_OUT_OF_RANGE;                                        // RETURN
     }
 
-    bdlt::Date countStart = (n > 0 ? monthStart : monthEnd);
+    // The business days of the month are those at the indices
+    // '[first .. first + count)' in 'calendar' (see 'Calendar::businessDay').
 
-    if (n < 0) {
-        // Create an iterator to the business day on or before 'countStart'.
+    const int count = calendar.numBusinessDays(monthStart, monthEnd);
 
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                       calendar.rbeginBusinessDays(countStart);
-        ++n;
-
-        // The 'calendar' must have at least one business day in the specified
-        // month and the whole month must be in the valid range if the
-        // 'calendar'.
-
-        if (rit == calendar.rendBusinessDays() || *rit < monthStart) {
-            return e_NOT_FOUND;                                       // RETURN
-        }
-
-        while (n < 0) {
-            ++rit;
-
-            if (rit == calendar.rendBusinessDays() || *rit < monthStart ) {
-                --rit;
-                break;
-            }
+    if (0 == count) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
 
-            ++n;
-        }
+    const int first = calendar.numBusinessDaysBefore(monthStart);
 
-        *result = *rit;
+    if (n > 0) {
+        *result = calendar.businessDay(first + (n < count ? n : count) - 1);
     }
     else {
-        // Create an iterator to the business day on or after 'countStart'.
-
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                        calendar.beginBusinessDays(countStart);
-        --n;
-
-        // The 'calendar' must have at least one business day in the specified
-        // month and the whole month must be in the valid range if the
-        // 'calendar'.
-
-        if (fit == calendar.endBusinessDays() || *fit > monthEnd) {
-            return e_NOT_FOUND;                                       // RETURN
-        }
-
-        while (n > 0) {
-            ++fit;
-
-            if (fit == calendar.endBusinessDays() || *fit > monthEnd) {
-                --fit;
-                break;
-            }
-
-            --n;
-        }
-
-        *result = *fit;
+        *result = calendar.businessDay(first + count
+                                             - (n > -count ? -n : count));
     }
 
     return e_SUCCESS;
@@ -368,49 +306,25 @@ int CalendarUtil::subtractBusinessDaysIfValid(
         return e_OUT_OF_RANGE;                                        // RETURN
     }
 
-    unsigned int absNumBusDays = numBusinessDays >= 0
-                               ? numBusinessDays
-                               : -numBusinessDays;
-
-    // declare forward and reverse iterators
-
-    unsigned int count = calendar.isBusinessDay(original) ? 0 : 1;
-
-    if (numBusinessDays >= 0) {
-        // an iterator to the business day on or before original
-
-        bdlt::Calendar::BusinessDayConstReverseIterator rit =
-                                         calendar.rbeginBusinessDays(original);
+    // Compute the index of the resulting business day in 'calendar' (see
+    // 'Calendar::businessDay').  If 'original' is not a business day, the
+    // last business day preceding it is the first one counted.
 
-        while (rit != calendar.rendBusinessDays() && count < absNumBusDays) {
-            ++rit;
-            ++count;
-        }
-
-        if (rit == calendar.rendBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
+    bsls::Types::Int64 index =
+                       static_cast<bsls::Types::Int64>(
+                                    calendar.numBusinessDaysBefore(original))
+                     - numBusinessDays;
 
-        *result = *rit;
+    if (0 >= numBusinessDays && !calendar.isBusinessDay(original)) {
+        --index;
     }
-    else {
-        // an iterator to the business day on or after 'original'
-
-        bdlt::Calendar::BusinessDayConstIterator fit =
-                                          calendar.beginBusinessDays(original);
 
-        while (fit != calendar.endBusinessDays() && count < absNumBusDays) {
-            ++fit;
-            ++count;
-        }
-
-        if (fit == calendar.endBusinessDays()) {
-            return e_OUT_OF_RANGE;                                    // RETURN
-        }
-
-        *result = *fit;
+    if (0 > index || calendar.numBusinessDays() <= index) {
+        return e_OUT_OF_RANGE;                                        // RETURN
     }
 
+    *result = calendar.businessDay(static_cast<int>(index));
+
     return e_SUCCESS;
 }
 
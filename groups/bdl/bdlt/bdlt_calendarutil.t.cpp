@@ -13,6 +13,7 @@
 
 #include <bsls_assert.h>
 #include <bsls_asserttest.h>
+#include <bsls_stopwatch.h>
 
 #include <bsl_cstdlib.h>
 #include <bsl_cstring.h>
@@ -46,6 +47,7 @@ using namespace bsl;
 // [10] USAGE EXAMPLE
 // [ 1] parseCalendar(const char *, const bdlt::Date&)
 // [ 2] getStartDate(const char *)
+// [-1] PERFORMANCE: ADDING BUSINESS DAYS
 //-----------------------------------------------------------------------------
 
 // ============================================================================
@@ -6040,6 +6042,101 @@ int main(int argc, char *argv[])
                     rval.length() == LENGTH);
         }
       } break;
+      case -1: {
+        // --------------------------------------------------------------------
+        // PERFORMANCE: ADDING BUSINESS DAYS
+        //   Measure the cost of adding business days and of counting business
+        //   days on a calendar spanning 50 years.
+        //
+        // Concerns:
+        //: 1 The cost of 'addBusinessDaysIfValid' and 'numBusinessDays' does
+        //:   not depend on the number of business days involved.
+        //
+        // Plan:
+        //: 1 Create a calendar spanning 50 years, with weekends and a holiday
+        //:   every 40 days.  For several ranges of numbers of business days,
+        //:   time 1,000,000 calls of 'addBusinessDaysIfValid' and of
+        //:   'numBusinessDays' on pseudo-random dates, and report the time per
+        //:   call.  (C-1)
+        //
+        // Testing:
+        //   PERFORMANCE: ADDING BUSINESS DAYS
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "PERFORMANCE: ADDING BUSINESS DAYS" << endl
+                          << "=================================" << endl;
+
+        enum { k_NUM_CALLS = 1000 * 1000 };
+
+        const bdlt::Date FIRST(2000, 1, 1);
+        const bdlt::Date LAST(2049, 12, 31);
+
+        bdlt::Calendar calendar(FIRST, LAST);
+        calendar.addWeekendDay(bdlt::DayOfWeek::e_SAT);
+        calendar.addWeekendDay(bdlt::DayOfWeek::e_SUN);
+        for (bdlt::Date date = FIRST; date <= LAST - 40; date += 40) {
+            calendar.addHoliday(date);
+        }
+
+        const int LENGTH = calendar.length();
+
+        const int MAX_NUM_BUSINESS_DAYS[] = { 1, 10, 252, 2520 };
+
+        for (int ti = 0; ti < 4; ++ti) {
+            const int MAX = MAX_NUM_BUSINESS_DAYS[ti];
+
+            unsigned int seed = 12345;
+            int          sum  = 0;
+
+            bsls::Stopwatch timer;
+            timer.start();
+
+            for (int i = 0; i < k_NUM_CALLS; ++i) {
+                seed = seed * 1103515245 + 12345;
+
+                const bdlt::Date ORIGINAL = FIRST + (seed >> 8) % LENGTH;
+                const int        NUM      = static_cast<int>(
+                                                (seed >> 4) % (2 * MAX + 1))
+                                          - MAX;
+
+                bdlt::Date result;
+                if (0 == Util::addBusinessDaysIfValid(&result,
+                                                      ORIGINAL,
+                                                      calendar,
+                                                      NUM)) {
+                    sum += result.day();
+                }
+            }
+
+            timer.stop();
+
+            const double addTime = timer.elapsedTime();
+
+            timer.reset();
+            timer.start();
+
+            for (int i = 0; i < k_NUM_CALLS; ++i) {
+                seed = seed * 1103515245 + 12345;
+
+                const int        BEGIN = (seed >> 8) % (LENGTH - MAX);
+                const bdlt::Date DATE  = FIRST + BEGIN;
+
+                sum += calendar.numBusinessDays(DATE,
+                                                DATE + (seed >> 4) % MAX);
+            }
+
+            timer.stop();
+
+            const double countTime = timer.elapsedTime();
+
+            cout << "up to " << MAX << " business days: "
+                 << addTime / k_NUM_CALLS * 1e9
+                 << " ns per 'addBusinessDaysIfValid', "
+                 << countTime / k_NUM_CALLS * 1e9
+                 << " ns per 'numBusinessDays' (" << sum << ")" << endl;
+        }
+      } break;
       default: {
         bsl::cerr << "WARNING: CASE `" << test << "' NOT FOUND." << bsl::endl;
         testStatus = -1;
@@ -48,6 +48,8 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <bsls_types.h>
 
 #include <bsl_algorithm.h>
+#include <bsl_cstddef.h>
+#include <bsl_deque.h>
 #include <bsl_functional.h>
 #include <bsl_string.h>
 #include <bsl_utility.h>
@@ -57,6 +59,7 @@ BSLS_IDENT("$Id$ $CSID$")
 #include <sys/types.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <bsl_c_errno.h>
 #endif
 
 #ifdef min
@@ -234,6 +237,10 @@ enum {
     k_WAIT_FOR_RESOURCES = 1,            // 1s
     k_MAX_EXP_BACKOFF    = 64,           // 64s
 
+    // Polling period of the zero-copy completions of a channel not reading.
+
+    k_ZERO_COPY_POLL     = 1000 * 1000,  // 1ms (in nanoseconds)
+
     // Error codes
 
     e_SET_NONBLOCKING_FAILED = -7, // matches what 'listen' returns
@@ -267,6 +274,220 @@ int getPlatformErrorCode()
 #else
     return errno;
 #endif
+}
+
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+
+                    // =============================
+                    // local class LocalStreamSocket
+                    // =============================
+
+// IMPLEMENTATION NOTE: The channel pool manipulates all its sockets through
+// the 'btlso::StreamSocket<btlso::IPv4Address>' protocol, and deallocates them
+// with its 'btlso::InetStreamSocketFactory<btlso::IPv4Address>'.  Local
+// (Unix-domain) sockets are supported by deriving from the socket type of that
+// factory, so that they share the I/O operations (which do not depend on the
+// address type), and are destroyed and deallocated by the factory (through the
+// virtual destructor) as any other socket, provided they are allocated from
+// the allocator of the factory.  Only the operations taking or returning an
+// address are redefined.
+
+class LocalStreamSocket : public btlso::InetStreamSocket<btlso::IPv4Address> {
+    // This class implements the 'btlso::StreamSocket<btlso::IPv4Address>'
+    // protocol for a stream socket of the local ('AF_UNIX') domain: the
+    // operations taking an 'btlso::IPv4Address' fail, the addresses of the
+    // socket are reported as the default 'btlso::IPv4Address', and 'bind' and
+    // 'connect' are provided for a 'btlso::LocalAddress' instead.
+
+    // DATA
+    bslma::Allocator *d_allocator_p;  // allocator of this object (held, not
+                                      // owned)
+
+  private:
+    // NOT IMPLEMENTED
+    LocalStreamSocket(const LocalStreamSocket&);
+    LocalStreamSocket& operator=(const LocalStreamSocket&);
+
+  public:
+    // CLASS METHODS
+    static StreamSocket *allocate(bslma::Allocator *allocator);
+        // Return the address of a new local stream socket allocated from the
+        // specified 'allocator', or 0 if the socket could not be opened.
+
+    // CREATORS
+    LocalStreamSocket(btlso::SocketHandle::Handle  handle,
+                      bslma::Allocator            *allocator);
+        // Create a stream socket attached to the specified local socket
+        // 'handle', that is allocated from the specified 'allocator'.
+
+    // MANIPULATORS
+    virtual int accept(StreamSocket **socket);
+    virtual int accept(StreamSocket **socket, btlso::IPv4Address *peerAddress);
+        // Accept an incoming connection request and load the address of a new
+        // local stream socket into the specified 'socket' (and load the
+        // default 'btlso::IPv4Address' into the optionally specified
+        // 'peerAddress').  Return 0 on success, and a non-zero value
+        // otherwise.
+
+    virtual int bind(const btlso::IPv4Address& address);
+    virtual int connect(const btlso::IPv4Address& address);
+        // Return a non-zero value with no effect: a local socket does not
+        // have an IPv4 'address'.
+
+    int bind(const btlso::LocalAddress& address);
+        // Associate the specified 'address' with this socket.  Return 0 on
+        // success, and a non-zero value otherwise.
+
+    int connect(const btlso::LocalAddress& address);
+        // Initiate a connection to the specified 'address'.  Return 0 on
+        // success, 'btlso::SocketHandle::e_ERROR_WOULDBLOCK' if the socket is
+        // in non-blocking mode and the connection is in progress, and another
+        // non-zero value otherwise.  Note that a non-blocking connection to a
+        // local server whose backlog is full fails (rather than being in
+        // progress), so that it is retried at the next attempt.
+
+    // ACCESSORS
+    virtual int localAddress(btlso::IPv4Address *result) const;
+    virtual int peerAddress(btlso::IPv4Address *result) const;
+        // Load the default 'btlso::IPv4Address' into the specified 'result'
+        // and return 0.
+};
+
+// CLASS METHODS
+StreamSocket *LocalStreamSocket::allocate(bslma::Allocator *allocator)
+{
+    btlso::SocketHandle::Handle handle;
+    if (0 != btlso::SocketImpUtil::open<btlso::LocalAddress>(
+                                      &handle,
+                                      btlso::SocketImpUtil::k_SOCKET_STREAM)) {
+        return 0;                                                     // RETURN
+    }
+
+    return new (*allocator) LocalStreamSocket(handle, allocator);
+}
+
+// CREATORS
+LocalStreamSocket::LocalStreamSocket(btlso::SocketHandle::Handle  handle,
+                                     bslma::Allocator            *allocator)
+: btlso::InetStreamSocket<btlso::IPv4Address>(handle, allocator)
+, d_allocator_p(allocator)
+{
+}
+
+// MANIPULATORS
+int LocalStreamSocket::accept(StreamSocket **socket)
+{
+    btlso::SocketHandle::Handle newHandle;
+
+    const int rc = btlso::SocketImpUtil::accept<btlso::LocalAddress>(
+                                                                 &newHandle,
+                                                                 handle());
+    if (rc) {
+        return rc;                                                    // RETURN
+    }
+
+    *socket = new (*d_allocator_p) LocalStreamSocket(newHandle, d_allocator_p);
+    return 0;
+}
+
+int LocalStreamSocket::accept(StreamSocket       **socket,
+                              btlso::IPv4Address  *peerAddress)
+{
+    *peerAddress = btlso::IPv4Address();
+    return accept(socket);
+}
+
+int LocalStreamSocket::bind(const btlso::IPv4Address&)
+{
+    return btlso::SocketHandle::e_ERROR_UNCLASSIFIED;
+}
+
+int LocalStreamSocket::connect(const btlso::IPv4Address&)
+{
+    return btlso::SocketHandle::e_ERROR_UNCLASSIFIED;
+}
+
+int LocalStreamSocket::bind(const btlso::LocalAddress& address)
+{
+    return btlso::SocketImpUtil::bind<btlso::LocalAddress>(handle(), address);
+}
+
+int LocalStreamSocket::connect(const btlso::LocalAddress& address)
+{
+    int       errorCode = 0;
+    const int rc        = btlso::SocketImpUtil::connect<btlso::LocalAddress>(
+                                                                   handle(),
+                                                                   address,
+                                                                   &errorCode);
+
+    // A non-blocking local 'connect' reports 'EAGAIN' (mapped, as
+    // 'EINPROGRESS', to 'e_ERROR_WOULDBLOCK') when the backlog of the server
+    // is full, and the socket is then *not* connecting.
+
+    if (btlso::SocketHandle::e_ERROR_WOULDBLOCK == rc && EAGAIN == errorCode) {
+        return btlso::SocketHandle::e_ERROR_UNCLASSIFIED;             // RETURN
+    }
+    return rc;
+}
+
+// ACCESSORS
+int LocalStreamSocket::localAddress(btlso::IPv4Address *result) const
+{
+    *result = btlso::IPv4Address();
+    return 0;
+}
+
+int LocalStreamSocket::peerAddress(btlso::IPv4Address *result) const
+{
+    *result = btlso::IPv4Address();
+    return 0;
+}
+
+#endif
+
+StreamSocket *allocateLocalSocket(bslma::Allocator *allocator)
+    // Return the address of a new local stream socket allocated from the
+    // specified 'allocator', or 0 if the socket could not be opened or if the
+    // platform does not support local sockets.  Note that the returned socket
+    // must be deallocated with an 'btlso::InetStreamSocketFactory' using the
+    // same 'allocator'.
+{
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+    return LocalStreamSocket::allocate(allocator);
+#else
+    (void)allocator;
+    return 0;
+#endif
+}
+
+int bindLocalSocket(StreamSocket *socket, const btlso::LocalAddress& address)
+    // Associate the specified 'address' with the specified 'socket', which
+    // must have been returned by 'allocateLocalSocket'.  Return 0 on success,
+    // and a non-zero value otherwise.
+{
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+    return static_cast<LocalStreamSocket *>(socket)->bind(address);
+#else
+    (void)socket;
+    (void)address;
+    return -1;
+#endif
+}
+
+int connectLocalSocket(StreamSocket                *socket,
+                       const btlso::LocalAddress&  address)
+    // Initiate a connection of the specified 'socket', which must have been
+    // returned by 'allocateLocalSocket', to the specified 'address'.  Return
+    // 0 on success, 'btlso::SocketHandle::e_ERROR_WOULDBLOCK' if the
+    // connection is in progress, and another non-zero value otherwise.
+{
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+    return static_cast<LocalStreamSocket *>(socket)->connect(address);
+#else
+    (void)socket;
+    (void)address;
+    return -1;
+#endif
 }
 
                     // ===================
@@ -351,6 +572,21 @@ class Channel {
             // corresponding high watermark callback was delivered to the user.
     };
 
+    struct ZeroCopyWrite {
+        // This 'struct' describes a write performed without copying the data
+        // into the kernel (see 'writeOvecs'), whose blob buffers must be held
+        // until the kernel reports its completion.
+
+        int  d_numBuffers;   // number of elements of 'd_zeroCopyBuffers'
+                             // referenced by this write
+
+        int  d_numBytes;     // number of bytes written
+
+        bool d_isCompleted;  // 'true' if the kernel released the buffers
+
+        bool d_isCopied;     // 'true' if the kernel copied the data anyway
+    };
+
     // PRIVATE DATA MEMBERS
 
     // Socket section
@@ -435,7 +671,37 @@ class Channel {
     // Channel managers section
     ChannelPool                     *d_channelPool_p;    // (held)
 
-    TcpTimerEventManager            *d_eventManager_p;   // (held)
+    bsls::AtomicPointer<TcpTimerEventManager>
+                                     d_eventManager_p;   // (held) manager
+                                                         // in whose
+                                                         // dispatcher thread
+                                                         // the callbacks of
+                                                         // this channel are
+                                                         // invoked; changed
+                                                         // only by
+                                                         // 'migrateCb'
+
+    TcpTimerEventManager            *d_migrationTarget_p;// (held) manager
+                                                         // this channel is
+                                                         // being migrated to,
+                                                         // or 0
+
+    bsl::vector<bsl::function<void()> >
+                                     d_deferredFunctors; // functors enqueued
+                                                         // while a migration
+                                                         // is pending
+
+    bslmt::Mutex                     d_executeMutex;     // guards the
+                                                         // change of the three
+                                                         // data members above
+
+    bsls::Types::Int64               d_rebalanceNumBytes;// bytes transferred
+                                                         // when this channel
+                                                         // was last considered
+                                                         // for rebalancing
+                                                         // (see
+                                                         // 'ChannelPool::
+                                                         // rebalanceChannels')
 
     void                            *d_readTimeoutTimerId;
 
@@ -515,6 +781,41 @@ class Channel {
                                                          // in
                                                          // d_writeActiveData)
 
+    // Zero-copy transmission section (modified only in the constructor and in
+    // the dispatcher thread of the event manager associated with this
+    // channel)
+
+    int                              d_zeroCopyThreshold;// minimum number of
+                                                         // bytes written
+                                                         // without copying,
+                                                         // or 0 if disabled
+
+    bsl::deque<ZeroCopyWrite>        d_zeroCopyWrites;   // writes not yet
+                                                         // released, in
+                                                         // sequence order
+
+    unsigned int                     d_zeroCopySequence; // kernel sequence
+                                                         // number of the
+                                                         // front of
+                                                         // 'd_zeroCopyWrites'
+
+    bsl::deque<btlb::BlobBuffer>     d_zeroCopyBuffers;  // buffers held for
+                                                         // 'd_zeroCopyWrites'
+
+    void                            *d_zeroCopyTimerId;  // timer polling the
+                                                         // completions while
+                                                         // 'readCb' does not,
+                                                         // or 0 if none
+
+    bsls::AtomicInt64                d_numBytesWrittenZeroCopy;
+                                                         // completed bytes
+                                                         // sent without
+                                                         // copying
+
+    bsls::AtomicInt64                d_numBytesWrittenCopied;
+                                                         // bytes copied into
+                                                         // the kernel
+
     bdlma::ConcurrentPoolAllocator  *d_sharedPtrRepAllocator_p;
 
     bslma::Allocator                *d_allocator_p;      // for memory
@@ -539,6 +840,23 @@ class Channel {
         // invoking the user callback if required, and adjusting the internal
         // data buffer as needed.
 
+    void processZeroCopyCompletions();
+        // Read the zero-copy completions reported by the kernel for the
+        // socket underlying this channel, and release, in sequence order, the
+        // blob buffers held by the completed zero-copy writes.
+
+    int writeOvecs(int numVecs, int firstBuffer, int numBytes);
+        // Write to the socket underlying this channel the first specified
+        // 'numVecs' elements of 'd_ovecs', holding a total of the specified
+        // 'numBytes', and corresponding to the buffers of 'd_writeActiveData'
+        // starting at the specified 'firstBuffer' index.  If zero-copy
+        // transmission is enabled for this channel and 'numBytes' is at least
+        // the zero-copy threshold, send the data without copying it and hold
+        // the buffers that were (even partially) sent until the kernel reports
+        // the completion of the write.  Return the number of bytes written on
+        // success, and a negative value, as returned by
+        // 'StreamSocket::writev', otherwise.
+
     // PRIVATE METHODS
     void cancelAll();
         // Remove all the pending timers from the event manager.
@@ -580,6 +898,17 @@ class Channel {
         // that this function should always be executed in the dispatcher
         // thread of the event manager associated with this channel.
 
+    void migrateCb(ChannelHandle self);
+        // Complete the migration of this channel to the event manager
+        // recorded by 'migrate': deregister the socket events and the read
+        // timeout of this channel from its current event manager, make the
+        // new event manager the one associated with this channel, and enqueue
+        // in the new event manager 'resumeCb', followed by the functors
+        // enqueued by 'execute' since the migration was initiated.  If this
+        // channel is (even partially) down, abandon the migration instead.
+        // Note that this function should always be executed in the dispatcher
+        // thread of the event manager associated with this channel.
+
     void notifyChannelDown(ChannelHandle             self,
                            btlso::Flag::ShutdownType type,
                            bool                      serializedFlag = true);
@@ -625,6 +954,18 @@ class Channel {
         // return non-zero, if there is more data enqueued in the outgoing
         // blob.  Otherwise, return 0.
 
+    void resumeCb(ChannelHandle self,
+                  bool          readFlag,
+                  bool          writeFlag,
+                  bool          readTimeoutFlag);
+        // Register with the event manager associated with this channel the
+        // socket events that were registered for this channel in the event
+        // manager it was migrated from, as indicated by the specified
+        // 'readFlag' and 'writeFlag', and restart the read timeout if the
+        // specified 'readTimeoutFlag' is 'true'.  Note that this function
+        // should always be executed in the dispatcher thread of the event
+        // manager associated with this channel.
+
     void registerReadTimeoutCallback(bsls::TimeInterval   timeout,
                                      const ChannelHandle& self);
         // Register 'readTimeoutCb' to be called by the manager in its
@@ -639,6 +980,14 @@ class Channel {
         // also that the specified 'self' is guaranteed to live throughout the
         // lifetime of this function call.
 
+    void registerZeroCopyTimer(const ChannelHandle& self);
+        // Register 'zeroCopyTimerCb' to be called by the manager in its
+        // dispatcher thread after a short delay, if zero-copy writes are
+        // pending and 'readCb', which otherwise processes their completions,
+        // is not registered, and unless already registered.  Note that this
+        // function should always be executed in the dispatcher thread of the
+        // event manager associated with this channel.
+
     void writeCb(ChannelHandle self);
         // Write the first message(s) enqueued for this channel to the
         // underlying 'StreamSocket'.  If more data is available for writing
@@ -653,6 +1002,13 @@ class Channel {
         // the dispatcher thread of the event manager associated with this
         // channel.
 
+    void zeroCopyTimerCb(ChannelHandle self);
+        // Process the zero-copy completions reported for this channel, and
+        // register this callback again if zero-copy writes are still pending
+        // and 'readCb' is not registered.  Note that this function should
+        // always be executed in the dispatcher thread of the event manager
+        // associated with this channel.
+
     // FRIENDS
     friend class ChannelPool;
 
@@ -693,11 +1049,35 @@ class Channel {
         // Destroy this channel.
 
     // MANIPULATORS
+    void clearDeferredFunctors();
+        // Discard the functors enqueued by 'execute' while a migration of
+        // this channel is pending.  The behavior is undefined unless the event
+        // manager associated with this channel is stopped and will not be
+        // restarted.  Note that this breaks the reference cycle between this
+        // channel and the functors (which hold a handle to it) that would
+        // otherwise persist if the migration never completes.
+
     void disableRead(ChannelHandle self, bool enqueueStateChangeCb);
         // Disable automatic reading of data from this channel enqueuing the
         // change state callback if the specified 'enqueueStateChangeCb' is
         // 'true', and invoking it inline otherwise.
 
+    void execute(const bsl::function<void()>& functor);
+        // Enqueue the specified 'functor' to be invoked in the dispatcher
+        // thread of the event manager associated with this channel.  Functors
+        // enqueued by this method are invoked in the order in which they were
+        // enqueued, even if this channel is migrated to another event manager
+        // in the meantime.
+
+    int migrate(TcpTimerEventManager *eventManager, ChannelHandle self);
+        // Initiate the migration of this channel to the specified
+        // 'eventManager'.  Return 0 on success, and a non-zero value if this
+        // channel is not up, is (even partially) down, is already associated
+        // with 'eventManager', or is already being migrated.  Upon success,
+        // 'migrateCb' is enqueued in the current event manager of this
+        // channel, and the functors subsequently enqueued by 'execute' are
+        // deferred until it completes.
+
     int initiateReadSequence(ChannelHandle self);
         // Schedule an asynchronous timed reading from this channel and also
         // process any incoming data left-over in this channel's internal
@@ -777,7 +1157,8 @@ class Channel {
         // from within the channel pool.
 
     TcpTimerEventManager *eventManager() const;
-        // Return a pointer to this channel's event manager.
+        // Return a pointer to this channel's event manager.  Note that the
+        // returned value may change if this channel is migrated.
 
     const btlso::IPv4Address& peerAddress() const;
         // Return the address of the peer that this channel is connected to.
@@ -809,6 +1190,25 @@ class Channel {
         // Return a snapshot of the maximum recorded size, in bytes, of the
         // queue of data to be written to this channel.
 
+    bool isZeroCopyCandidate(const btlb::Blob& msg, int length) const;
+        // Return 'true' if the specified 'msg' of the specified 'length'
+        // should be sent without copying, and 'false' otherwise.
+
+    template <class IOVEC>
+    bool isZeroCopyCandidate(const ChannelPool_IovecArray<IOVEC>& msg,
+                             int                                  length)
+                                                                         const;
+        // Return 'false'.  Note that the buffers of 'msg' are not owned by
+        // this channel, and so cannot be held until the kernel releases them.
+
+    bsls::Types::Int64 numBytesWrittenCopied() const;
+        // Return the number of bytes written to this channel that were copied
+        // into the kernel.
+
+    bsls::Types::Int64 numBytesWrittenZeroCopy() const;
+        // Return the number of bytes written to this channel that were sent
+        // without copying, and whose completion was reported by the kernel.
+
     StreamSocket *socket() const;
         // Return a pointer to this channel's underlying socket.
 
@@ -912,6 +1312,38 @@ int Channel::recordedMaxWriteQueueSize() const
     return d_recordedMaxWriteQueueSize.loadRelaxed();
 }
 
+inline
+bool Channel::isZeroCopyCandidate(const btlb::Blob& msg, int length) const
+{
+    (void)msg;
+
+    return 0 < d_zeroCopyThreshold && d_zeroCopyThreshold <= length;
+}
+
+template <class IOVEC>
+inline
+bool Channel::isZeroCopyCandidate(const ChannelPool_IovecArray<IOVEC>& msg,
+                                  int                                  length)
+                                                                          const
+{
+    (void)msg;
+    (void)length;
+
+    return false;
+}
+
+inline
+bsls::Types::Int64 Channel::numBytesWrittenCopied() const
+{
+    return d_numBytesWrittenCopied.loadRelaxed();
+}
+
+inline
+bsls::Types::Int64 Channel::numBytesWrittenZeroCopy() const
+{
+    return d_numBytesWrittenZeroCopy.loadRelaxed();
+}
+
 inline
 StreamSocket *Channel::socket() const
 {
@@ -989,6 +1421,7 @@ Connector::Connector(const Connector&  original,
 , d_keepHalfOpenMode(original.d_keepHalfOpenMode)
 , d_socketOptions(original.d_socketOptions)
 , d_localAddress(original.d_localAddress)
+, d_localServerAddress(original.d_localServerAddress)
 {
 }
 
@@ -1056,12 +1489,53 @@ class ServerState {
                                                       // server connections
                                                       // must create channels
 
+    bool                        d_isShardedFlag;      // is the port shared
+                                                      // with other listening
+                                                      // sockets, in which case
+                                                      // channels stay with
+                                                      // 'd_manager_p'?
+
+    bsls::AtomicInt64           d_numAccepted;        // number of connections
+                                                      // accepted on this
+                                                      // socket
+
+    bsl::shared_ptr<ServerState>
+                                d_nextShard;          // next listening socket
+                                                      // of the same server, if
+                                                      // sharded
+
+    bsl::weak_ptr<ServerState>  d_primary;            // first listening socket
+                                                      // of the server (holding
+                                                      // the accept timeout),
+                                                      // empty if this is it
+
     // CREATORS
+    ServerState();
+        // Create a server state having no socket.  The members are set by
+        // 'ChannelPool::listen'.
+
     ~ServerState();
         // Destroy this server,
 };
 
 // CREATORS
+inline
+ServerState::ServerState()
+: d_socket_p(0)
+, d_factory_p(0)
+, d_manager_p(0)
+, d_timeoutTimerId(0)
+, d_acceptAgainId(0)
+, d_exponentialBackoff(0)
+, d_isClosedFlag(0)
+, d_isTimedFlag(false)
+, d_readEnabledFlag(false)
+, d_keepHalfOpenMode(false)
+, d_isShardedFlag(false)
+, d_numAccepted(0)
+{
+}
+
 inline
 ServerState::~ServerState()
 {
@@ -1188,6 +1662,106 @@ void Channel::processReadData(int numBytes)
         d_minBytesBeforeNextCb = minAdditional;
     }
 }
+
+void Channel::processZeroCopyCompletions()
+{
+    unsigned int first;
+    unsigned int last;
+    bool         copied;
+    int          rc;
+
+    while (0 <= (rc = btlso::SocketImpUtil::readZeroCopyCompletion(
+                                                        &first,
+                                                        &last,
+                                                        &copied,
+                                                        socket()->handle()))) {
+        if (0 < rc) {
+            // Not a zero-copy completion (e.g., an ICMP error): ignore it.
+
+            continue;
+        }
+
+        // The kernel numbers the zero-copy writes of a socket with 32-bit
+        // sequence numbers that wrap around, so the positions in
+        // 'd_zeroCopyWrites' are computed using unsigned arithmetic.
+
+        const bsl::size_t numWrites = d_zeroCopyWrites.size();
+        const bsl::size_t begin     = first - d_zeroCopySequence;
+        const bsl::size_t end       = bsl::min<bsl::size_t>(
+                                          (last - d_zeroCopySequence) + 1,
+                                          numWrites);
+
+        for (bsl::size_t i = begin; i < end; ++i) {
+            d_zeroCopyWrites[i].d_isCompleted = true;
+            d_zeroCopyWrites[i].d_isCopied    = copied;
+        }
+    }
+
+    // Completions may be reported out of order: release the buffers of the
+    // completed writes at the front of the queue only.
+
+    while (!d_zeroCopyWrites.empty() && d_zeroCopyWrites.front().d_isCompleted)
+    {
+        const ZeroCopyWrite& write = d_zeroCopyWrites.front();
+
+        if (write.d_isCopied) {
+            d_numBytesWrittenCopied.addRelaxed(write.d_numBytes);
+        }
+        else {
+            d_numBytesWrittenZeroCopy.addRelaxed(write.d_numBytes);
+        }
+
+        d_zeroCopyBuffers.erase(d_zeroCopyBuffers.begin(),
+                                d_zeroCopyBuffers.begin() +
+                                                        write.d_numBuffers);
+        d_zeroCopyWrites.pop_front();
+        ++d_zeroCopySequence;
+    }
+}
+
+int Channel::writeOvecs(int numVecs, int firstBuffer, int numBytes)
+{
+    if (0 < d_zeroCopyThreshold && d_zeroCopyThreshold <= numBytes) {
+        // Note that 'btls::Iovec' and 'btls::Ovec' have the same layout (see
+        // 'btlso::InetStreamSocket::writev').
+
+        const int rc = btlso::SocketImpUtil::writevZeroCopy(
+                                 socket()->handle(),
+                                 reinterpret_cast<const btls::Ovec *>(d_ovecs),
+                                 numVecs);
+
+        if (0 < rc) {
+            // Hold the buffers (even partially) sent until the kernel
+            // releases them.
+
+            ZeroCopyWrite write = { 0, rc, false, false };
+
+            for (int remaining = rc; 0 < remaining; ++write.d_numBuffers) {
+                const int i = write.d_numBuffers;
+
+                d_zeroCopyBuffers.push_back(
+                                   d_writeActiveData->buffer(firstBuffer + i));
+                remaining -= d_ovecs[i].length();
+            }
+            d_zeroCopyWrites.push_back(write);
+            return rc;                                                // RETURN
+        }
+
+        if (btlso::SocketHandle::e_ERROR_WOULDBLOCK == rc) {
+            return rc;                                                // RETURN
+        }
+
+        // Otherwise (e.g., the kernel could not pin more memory for this
+        // socket), fall back to a regular write, which will report the error
+        // if the socket itself is in error.
+    }
+
+    const int rc = socket()->writev(d_ovecs, numVecs);
+    if (0 < rc) {
+        d_numBytesWrittenCopied.addRelaxed(rc);
+    }
+    return rc;
+}
 }  // close package namespace
 
 // ============================================================================
@@ -1223,9 +1797,15 @@ void Channel::invokeChannelDown(ChannelHandle              self,
             d_eventManager_p->deregisterSocketEvent(socket()->handle(),
                                                     btlso::EventType::e_READ);
         }
+        registerZeroCopyTimer(self);
     }
     else if (ChannelPool::e_CHANNEL_DOWN == type) {
         d_eventManager_p->deregisterSocket(socket()->handle());
+
+        if (d_zeroCopyTimerId) {
+            d_eventManager_p->deregisterTimer(d_zeroCopyTimerId);
+            d_zeroCopyTimerId = 0;
+        }
     }
 
     // Do not deregister the read time out if not closing the read part.
@@ -1307,6 +1887,103 @@ void Channel::invokeWriteQueueLowWatermark(ChannelHandle)
                      d_userData);
 }
 
+void Channel::migrateCb(ChannelHandle self)
+{
+    TcpTimerEventManager *source = d_eventManager_p;
+
+    BSLS_ASSERT(bslmt::ThreadUtil::isEqual(bslmt::ThreadUtil::self(),
+                                           source->dispatcherThreadHandle()));
+    BSLS_ASSERT(this == self.get());
+
+    bsl::vector<bsl::function<void()> > deferredFunctors(d_allocator_p);
+
+    if (d_channelDownFlag) {
+        // The channel is going down: its socket events are being deregistered
+        // from 'source' and the channel down callbacks are (or will be)
+        // enqueued, so stay with 'source'.
+
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&d_executeMutex);
+
+            d_migrationTarget_p = 0;
+            deferredFunctors.swap(d_deferredFunctors);
+        }
+
+        for (bsl::size_t i = 0; i < deferredFunctors.size(); ++i) {
+            source->execute(deferredFunctors[i]);
+        }
+        return;                                                       // RETURN
+    }
+
+    // Since this callback runs in the dispatcher thread of 'source', neither
+    // 'readCb' nor 'writeCb' can be running.  The read data and the write
+    // queue are left untouched, and will be picked up from the new dispatcher
+    // thread by 'resumeCb'.
+
+    const btlso::SocketHandle::Handle handle = socket()->handle();
+
+    const bool readFlag  = source->isRegistered(handle,
+                                                btlso::EventType::e_READ);
+    const bool writeFlag = source->isRegistered(handle,
+                                                btlso::EventType::e_WRITE);
+
+    source->deregisterSocket(handle);
+
+    const bool readTimeoutFlag = 0 != d_readTimeoutTimerId;
+    if (readTimeoutFlag) {
+        source->deregisterTimer(d_readTimeoutTimerId);
+        d_readTimeoutTimerId = 0;
+    }
+
+    // The zero-copy timer, if any, is registered again by 'resumeCb'.
+
+    if (d_zeroCopyTimerId) {
+        source->deregisterTimer(d_zeroCopyTimerId);
+        d_zeroCopyTimerId = 0;
+    }
+
+    TcpTimerEventManager *target;
+    {
+        // Enqueue 'resumeCb' and the deferred functors while holding the
+        // lock, so that any functor enqueued by 'execute' from now on is
+        // enqueued after them.
+
+        bslmt::LockGuard<bslmt::Mutex> guard(&d_executeMutex);
+
+        target = d_migrationTarget_p;
+        BSLS_ASSERT(target);
+
+        d_eventManager_p    = target;
+        d_migrationTarget_p = 0;
+
+        target->execute(bdlf::BindUtil::bind(&Channel::resumeCb,
+                                             this,
+                                             self,
+                                             readFlag,
+                                             writeFlag,
+                                             readTimeoutFlag));
+
+        for (bsl::size_t i = 0; i < d_deferredFunctors.size(); ++i) {
+            target->execute(d_deferredFunctors[i]);
+        }
+        d_deferredFunctors.clear();
+    }
+
+    ++d_channelPool_p->d_numChannelMigrations;
+
+    const bsl::vector<TcpTimerEventManager *>& managers =
+                                                 d_channelPool_p->d_managers;
+
+    const int threadIndex = static_cast<int>(
+                                     bsl::find(managers.begin(),
+                                               managers.end(),
+                                               target) - managers.begin());
+
+    d_channelPool_p->d_poolStateCb(ChannelPool::e_CHANNEL_MIGRATED,
+                                   d_channelId,
+                                   threadIndex);
+}
+
 void Channel::notifyChannelDown(ChannelHandle             self,
                                 btlso::Flag::ShutdownType type,
                                 bool                      serializedFlag)
@@ -1369,7 +2046,7 @@ void Channel::notifyChannelDown(ChannelHandle             self,
                                             this,
                                             self,
                                             ChannelPool::e_CHANNEL_DOWN_READ));
-            d_eventManager_p->execute(cb);
+            execute(cb);
         }
     }
 
@@ -1385,7 +2062,7 @@ void Channel::notifyChannelDown(ChannelHandle             self,
                                            this,
                                            self,
                                            ChannelPool::e_CHANNEL_DOWN_WRITE));
-            d_eventManager_p->execute(cb);
+            execute(cb);
         }
     }
 
@@ -1414,6 +2091,10 @@ void Channel::notifyChannelDown(ChannelHandle             self,
             d_channelPool_p->d_totalBytesReadAdjustment    += numBytesRead();
             d_channelPool_p->d_totalBytesRequestedWrittenAdjustment +=
                                                 numBytesRequestedToBeWritten();
+            d_channelPool_p->d_totalBytesWrittenZeroCopyAdjustment +=
+                                                     numBytesWrittenZeroCopy();
+            d_channelPool_p->d_totalBytesWrittenCopiedAdjustment +=
+                                                       numBytesWrittenCopied();
 
             int rc = d_channelPool_p->d_channels.remove(d_channelId);
 
@@ -1430,7 +2111,7 @@ void Channel::notifyChannelDown(ChannelHandle             self,
                                                  self,
                                                  ChannelPool::e_CHANNEL_DOWN));
 
-            d_eventManager_p->execute(cb);
+            execute(cb);
         }
     }
 }
@@ -1464,6 +2145,14 @@ void Channel::readCb(ChannelHandle self)
         return;                                                       // RETURN
     }
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_zeroCopyWrites.empty())) {
+        // The kernel reports zero-copy completions on the error queue of the
+        // socket, which the event manager signals as a read event.
+
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        processZeroCopyCompletions();
+    }
+
     if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_enableReadFlag)) {
         // This readCb was still pending while we were executing 'disableRead'
         // and didn't get properly deregistered.  We abort now to avoid
@@ -1520,6 +2209,7 @@ void Channel::readCb(ChannelHandle self)
     }
 
     int readRet = 0;
+    int numReads = 0;
     while (1) {
         // Because buffered sockets (e.g. OpenSsl) may hold data internally,
         // they may not trigger a call to readCb, so we must attempt to read as
@@ -1545,8 +2235,16 @@ void Channel::readCb(ChannelHandle self)
                 // No more data to read, we can exit, knowing that 'readCb'
                 // will be called again by event manager if data becomes
                 // available again.  Reschedule a timeout from the time of the
-                // last read and register this socket event.
-
+                // last read and register this socket event.  Note that a
+                // socket sending without copying is signaled for reading when
+                // zero-copy completions are available, in which case the
+                // pending read timeout is left untouched.
+
+                if (0 == numReads
+                 && 0 < d_zeroCopyThreshold
+                 && d_readTimeoutTimerId) {
+                    return;                                           // RETURN
+                }
                 break;
             }
 
@@ -1563,6 +2261,7 @@ void Channel::readCb(ChannelHandle self)
         // executes in the (single) event manager thread.
 
         d_numBytesRead.addRelaxed(readRet);
+        ++numReads;
 
         if (d_useReadTimeout) {
             lastRead = bdlt::CurrentTime::now();
@@ -1640,6 +2339,55 @@ int Channel::refillOutgoingMsg()
     return 1;
 }
 
+void Channel::resumeCb(ChannelHandle self,
+                       bool          readFlag,
+                       bool          writeFlag,
+                       bool          readTimeoutFlag)
+{
+    BSLS_ASSERT(bslmt::ThreadUtil::isEqual(
+                                  bslmt::ThreadUtil::self(),
+                                  d_eventManager_p->dispatcherThreadHandle()));
+    BSLS_ASSERT(this == self.get());
+
+    // If the channel went down after the migration, 'invokeChannelDown' is
+    // enqueued after this callback and deregisters whatever is registered
+    // here.
+
+    if (readFlag && !isChannelDown(e_CLOSED_RECEIVE_MASK)) {
+        bsl::function<void()> readFunctor(bdlf::BindUtil::bind(
+                                                             &Channel::readCb,
+                                                             this,
+                                                             self));
+
+        if (0 != d_eventManager_p->registerSocketEvent(
+                                                     socket()->handle(),
+                                                     btlso::EventType::e_READ,
+                                                     readFunctor)) {
+            notifyChannelDown(self, btlso::Flag::e_SHUTDOWN_RECEIVE);
+        }
+        else if (readTimeoutFlag) {
+            registerReadTimeoutCallback(
+                               bdlt::CurrentTime::now() + d_readTimeout, self);
+        }
+    }
+
+    if (writeFlag && !isChannelDown(e_CLOSED_SEND_MASK)) {
+        bsl::function<void()> writeFunctor(bdlf::BindUtil::bind(
+                                                             &Channel::writeCb,
+                                                             this,
+                                                             self));
+
+        if (0 != d_eventManager_p->registerSocketEvent(
+                                                     socket()->handle(),
+                                                     btlso::EventType::e_WRITE,
+                                                     writeFunctor)) {
+            notifyChannelDown(self, btlso::Flag::e_SHUTDOWN_SEND);
+        }
+    }
+
+    registerZeroCopyTimer(self);
+}
+
 void Channel::registerReadTimeoutCallback(bsls::TimeInterval   timeout,
                                           const ChannelHandle& self)
 {
@@ -1691,6 +2439,32 @@ void Channel::registerWriteCb(ChannelHandle self)
     // We simply wait until the socket calls us back.
 }
 
+void Channel::registerZeroCopyTimer(const ChannelHandle& self)
+{
+    if (d_zeroCopyTimerId
+     || d_zeroCopyWrites.empty()
+     || d_eventManager_p->isRegistered(socket()->handle(),
+                                       btlso::EventType::e_READ)) {
+        return;                                                       // RETURN
+    }
+
+    // 'readCb' is not registered (e.g., automatic reading is disabled), and
+    // nothing else would read the completions that the kernel reports on the
+    // error queue of the socket, so that the buffers held would never be
+    // released: poll for the completions instead.
+
+    bsl::function<void()> zeroCopyTimerFunctor(bdlf::BindUtil::bind(
+                                                     &Channel::zeroCopyTimerCb,
+                                                     this,
+                                                     self));
+
+    const bsls::TimeInterval timeout = bdlt::CurrentTime::now()
+                                     + bsls::TimeInterval(0, k_ZERO_COPY_POLL);
+
+    d_zeroCopyTimerId = d_eventManager_p->registerTimer(timeout,
+                                                        zeroCopyTimerFunctor);
+}
+
 void Channel::writeCb(ChannelHandle self)
 {
     // This callback is executed whenever the write buffer of 'd_socket_p' has
@@ -1700,6 +2474,11 @@ void Channel::writeCb(ChannelHandle self)
         return;                                                       // RETURN
     }
 
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(!d_zeroCopyWrites.empty())) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+        processZeroCopyCompletions();
+    }
+
     // This method is always executed in the dispatcher thread of the event
     // manager, and thus there is no race with 'writeMessage', as long as the
     // outgoing flag is set (since 'writeMessage' will append to the outgoing
@@ -1741,9 +2520,11 @@ void Channel::writeCb(ChannelHandle self)
         int numMaxVecs = bsl::min(numBuffers - currentBuffer,
                                   static_cast<int>(k_MAX_IOVEC_SIZE));
 
+        int numBytes = bufSize - currentOffset;
+
         d_ovecs[0].setBuffer(
                d_writeActiveData->buffer(currentBuffer).data() + currentOffset,
-               bufSize - currentOffset);
+               numBytes);
 
         for (int i = currentBuffer + 1; numVecs < numMaxVecs; ++i, ++numVecs) {
             const btlb::BlobBuffer&  blobBuffer = d_writeActiveData->buffer(i);
@@ -1751,14 +2532,15 @@ void Channel::writeCb(ChannelHandle self)
 
             bsls::PerformanceHint::prefetchForReading(buf);
 
-            d_ovecs[numVecs].setBuffer(
-                                  buf,
-                                  i < numBuffers - 1
-                                  ? blobBuffer.size()
-                                  : d_writeActiveData->lastDataBufferLength());
+            const int length = i < numBuffers - 1
+                               ? blobBuffer.size()
+                               : d_writeActiveData->lastDataBufferLength();
+
+            d_ovecs[numVecs].setBuffer(buf, length);
+            numBytes += length;
         }
 
-        int writeRet = socket()->writev(d_ovecs, numVecs);
+        int writeRet = writeOvecs(numVecs, currentBuffer, numBytes);
 
         if (btlso::SocketHandle::e_ERROR_WOULDBLOCK == writeRet) {
             // In theory, this is the only writing thread so if 'writeCb' we
@@ -1833,7 +2615,7 @@ void Channel::writeCb(ChannelHandle self)
                                         &Channel::invokeWriteQueueLowWatermark,
                                         this,
                                         self));
-                    d_eventManager_p->execute(functor);
+                    execute(functor);
                 }
                 else {
                     prevHighWatermarkState =
@@ -1905,9 +2687,11 @@ void Channel::writeCb(ChannelHandle self)
             // done in 'refillOutgoingMsg'.
 
             if (isChannelDown(e_CLOSED_SEND_MASK) || !refillOutgoingMsg()) {
-                // There isn't any pending data, our work here is done.
+                // There isn't any pending data, our work here is done, except
+                // for the zero-copy writes not yet completed.
 
                 deregisterSocketWrite(self);
+                registerZeroCopyTimer(self);
                 return;                                               // RETURN
             }
 
@@ -1927,6 +2711,18 @@ void Channel::writeCb(ChannelHandle self)
     BSLS_ASSERT(0 && "Unreachable by design");
 }
 
+void Channel::zeroCopyTimerCb(ChannelHandle self)
+{
+    d_zeroCopyTimerId = 0;
+
+    if (0 != protectAndCheckCallback(self)) {
+        return;                                                       // RETURN
+    }
+
+    processZeroCopyCompletions();
+    registerZeroCopyTimer(self);
+}
+
 // CREATORS
 Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
                  int                              channelId,
@@ -1963,6 +2759,9 @@ Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
 , d_channelUpFlag(0)
 , d_channelPool_p(channelPool)
 , d_eventManager_p(eventManager)
+, d_migrationTarget_p(0)
+, d_deferredFunctors(basicAllocator)
+, d_rebalanceNumBytes(0)
 , d_readTimeoutTimerId(0)
 , d_creationTime(bdlt::CurrentTime::now())
 , d_numBytesRead(0)
@@ -1976,6 +2775,13 @@ Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
 , d_writeActiveDataCurrentOffset(0)
 , d_isWriteActive(false)
 , d_writeActiveQueueSize(0)
+, d_zeroCopyThreshold(0)
+, d_zeroCopyWrites(basicAllocator)
+, d_zeroCopySequence(0)
+, d_zeroCopyBuffers(basicAllocator)
+, d_zeroCopyTimerId(0)
+, d_numBytesWrittenZeroCopy(0)
+, d_numBytesWrittenCopied(0)
 , d_sharedPtrRepAllocator_p(sharedPtrAllocator)
 , d_allocator_p(basicAllocator)
 {
@@ -1995,6 +2801,16 @@ Channel::Channel(bslma::ManagedPtr<StreamSocket> *socket,
     (void)ret; BSLS_ASSERT( -1 != ret);
 #endif
 
+    // Imported sockets may not write directly to their handle (e.g., if they
+    // encrypt the data), so zero-copy transmission is never enabled for them.
+    // If the platform does not support it, the channel silently copies.
+
+    if (0 < config.zeroCopyThreshold()
+     && ChannelType::e_IMPORTED_CHANNEL != channelType
+     && 0 == btlso::SocketImpUtil::enableZeroCopy(d_socket->handle())) {
+        d_zeroCopyThreshold = config.zeroCopyThreshold();
+    }
+
     d_writeEnqueuedData.createInplace(d_allocator_p,
                                       d_writeBlobFactory_p,
                                       d_allocator_p);
@@ -2022,6 +2838,13 @@ Channel::~Channel()
 }
 
 // MANIPULATORS
+void Channel::clearDeferredFunctors()
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_executeMutex);
+
+    d_deferredFunctors.clear();
+}
+
 void Channel::disableRead(ChannelHandle self, bool enqueueStateChangeCb)
 {
     BSLS_ASSERT(bslmt::ThreadUtil::isEqual(
@@ -2037,6 +2860,8 @@ void Channel::disableRead(ChannelHandle self, bool enqueueStateChangeCb)
     }
     d_enableReadFlag = false;
 
+    registerZeroCopyTimer(self);
+
     if (enqueueStateChangeCb) {
         bsl::function<void()> stateCbFunctor(
                         bdlf::BindUtil::bind(d_channelStateCb,
@@ -2045,7 +2870,7 @@ void Channel::disableRead(ChannelHandle self, bool enqueueStateChangeCb)
                                              ChannelPool::e_AUTO_READ_DISABLED,
                                              d_userData));
 
-        d_eventManager_p->execute(stateCbFunctor);
+        execute(stateCbFunctor);
     }
     else {
         d_channelStateCb(d_channelId,
@@ -2055,6 +2880,23 @@ void Channel::disableRead(ChannelHandle self, bool enqueueStateChangeCb)
     }
 }
 
+void Channel::execute(const bsl::function<void()>& functor)
+{
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_executeMutex);
+
+    if (BSLS_PERFORMANCEHINT_PREDICT_UNLIKELY(d_migrationTarget_p)) {
+        BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
+
+        // 'migrateCb' is pending in the current event manager: 'functor' must
+        // not run before it (nor, therefore, in the current event manager).
+
+        d_deferredFunctors.push_back(functor);
+        return;                                                       // RETURN
+    }
+
+    d_eventManager_p->execute(functor);
+}
+
 int Channel::initiateReadSequence(ChannelHandle self)
 {
     if (0 != protectAndCheckCallback(self) || d_enableReadFlag) {
@@ -2145,7 +2987,7 @@ int Channel::writeMessage(const MessageType&   msg,
                                       this,
                                       self));
 
-            d_eventManager_p->execute(functor);
+            execute(functor);
 
             // We must release the mutex AFTER 'functor' is enqueued to be
             // executed.  Otherwise, another thread can come in between and
@@ -2191,9 +3033,15 @@ int Channel::writeMessage(const MessageType&   msg,
 
         oGuard.release()->unlock();
 
-        // Let's first attempt to write the blob directly using iovec.
+        // Let's first attempt to write the blob directly using iovec, unless
+        // it should be sent without copying, which requires holding its
+        // buffers and is therefore left to 'writeCb'.
 
-        int writeRet = MessageUtil::write(this->socket(), d_ovecs, msg);
+        int writeRet = isZeroCopyCandidate(msg,
+                                           static_cast<int>(dataLength))
+                       ? static_cast<int>(
+                                      btlso::SocketHandle::e_ERROR_WOULDBLOCK)
+                       : MessageUtil::write(this->socket(), d_ovecs, msg);
 
         if (BSLS_PERFORMANCEHINT_PREDICT_LIKELY(0 < writeRet)) {
             // 'd_numBytesWritten' is modified only in the 'writeCb' or
@@ -2201,6 +3049,7 @@ int Channel::writeMessage(const MessageType&   msg,
             // and when 'd_isWriteActive' is 'true'.
 
             d_numBytesWritten.addRelaxed(writeRet);
+            d_numBytesWrittenCopied.addRelaxed(writeRet);
         }
         else if (btlso::SocketHandle::e_ERROR_WOULDBLOCK == writeRet) {
             // In case writeRet < 0, then either the socket is dead, or would
@@ -2258,7 +3107,7 @@ int Channel::writeMessage(const MessageType&   msg,
                                                      this,
                                                      self));
 
-        d_eventManager_p->execute(initWriteFunctor);
+        execute(initWriteFunctor);
         return ChannelStatus::e_SUCCESS;                              // RETURN
     }
     BSLS_PERFORMANCEHINT_UNLIKELY_HINT;
@@ -2283,6 +3132,28 @@ int Channel::writeMessage(const MessageType&   msg,
     return ChannelStatus::e_SUCCESS;
 }
 
+int Channel::migrate(TcpTimerEventManager *eventManager, ChannelHandle self)
+{
+    BSLS_ASSERT(eventManager);
+    BSLS_ASSERT(this == self.get());
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_executeMutex);
+
+    if (!d_channelUpFlag
+     || d_channelDownFlag
+     || d_migrationTarget_p
+     || eventManager == d_eventManager_p) {
+        return 1;                                                     // RETURN
+    }
+
+    d_migrationTarget_p = eventManager;
+
+    d_eventManager_p->execute(bdlf::BindUtil::bind(&Channel::migrateCb,
+                                                   this,
+                                                   self));
+    return 0;
+}
+
 int Channel::setWriteQueueHighWatermark(int numBytes, ChannelHandle self)
 {
     bslmt::LockGuard<bslmt::Mutex> guard(&d_writeMutex);
@@ -2316,7 +3187,7 @@ void Channel::setWriteQueueHighWatermarkRaw(int numBytes, ChannelHandle self)
                                      this,
                                      self));
 
-            d_eventManager_p->execute(functor);
+            execute(functor);
         }
      }
 
@@ -2359,7 +3230,7 @@ void Channel::setWriteQueueLowWatermarkRaw(int numBytes, ChannelHandle self)
                                         this,
                                         self));
 
-            d_eventManager_p->execute(functor);
+            execute(functor);
         }
         else {
             // We are guaranteed that 'd_highWatermarkAlertState' will not
@@ -2381,7 +3252,7 @@ void Channel::setWriteQueueLowWatermarkRaw(int numBytes, ChannelHandle self)
                                         this,
                                         self));
 
-                d_eventManager_p->execute(functor);
+                execute(functor);
             }
         }
     }
@@ -2486,9 +3357,20 @@ void ChannelPool::init()
     // in).  The reason for this is that dynamic manager allocation does not
     // work very well.
 
+    // Channels register for WRITE events each time their write queue fills
+    // up; if so configured, prefer a socket event multiplexer that batches
+    // these registrations (see 'btlmt_tcptimereventmanager').
+
+    const TcpTimerEventManager::Hint hint =
+                                   d_config.batchSubmission()
+                                   ? TcpTimerEventManager::e_BATCH_SUBMISSION
+                                   : TcpTimerEventManager::e_NO_HINT;
+
     for (int i = 0; i < maxThread; ++i) {
-        TcpTimerEventManager *manager =
-                new (*d_allocator_p) TcpTimerEventManager(d_collectTimeMetrics,
+        TcpTimerEventManager *manager = new (*d_allocator_p)
+                                     TcpTimerEventManager(hint,
+                                                          d_collectTimeMetrics,
+                                                          false,
                                                           d_allocator_p);
 
         if (d_startFlag) {
@@ -2601,6 +3483,7 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
     // proceed.
 
     server->d_exponentialBackoff = 0;
+    ++server->d_numAccepted;
 
     typedef btlso::StreamSocketFactoryDeleter Deleter;
 
@@ -2617,7 +3500,12 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
         return;                                                       // RETURN
     }
 
-    TcpTimerEventManager *manager = allocateEventManager();
+    // Channels accepted on a sharded listening socket stay with the thread
+    // that accepted them: the kernel already balanced the connections.
+
+    TcpTimerEventManager *manager = server->d_isShardedFlag
+                                  ? server->d_manager_p
+                                  : allocateEventManager();
     BSLS_ASSERT(manager);
 
     // Reserve location for new channel.  This is so we have a 'newId' to
@@ -2649,23 +3537,21 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
     int rc = d_channels.replace(newId, channelHandle);
     (void)rc; BSLS_ASSERT(0 == rc);
 
-    // Reschedule the acceptTimeoutCb.
-
-    if (server->d_isTimedFlag) {
-        BSLS_ASSERT(server->d_timeoutTimerId);
-        server->d_manager_p->deregisterTimer(server->d_timeoutTimerId);
-
-        bsl::function<void()> acceptTimeoutFunctor(
-                            bdlf::BindUtil::bind(&ChannelPool::acceptTimeoutCb,
-                                                 this,
-                                                 serverId,
-                                                 server));
-
-        server->d_start = bdlt::CurrentTime::now() + server->d_timeout;
-        server->d_timeoutTimerId = server->d_manager_p->registerTimer(
-                                                         server->d_start,
-                                                         acceptTimeoutFunctor);
-        BSLS_ASSERT(server->d_timeoutTimerId);
+    // Reschedule the acceptTimeoutCb, which is held by the first listening
+    // socket of the server, in the dispatcher thread of that socket.
+
+    if (server->d_isTimedFlag) {
+        resetAcceptTimeoutCb(serverId, server);
+    }
+    else {
+        bsl::shared_ptr<ServerState> primary = server->d_primary.lock();
+        if (primary && primary->d_isTimedFlag) {
+            primary->d_manager_p->execute(bdlf::BindUtil::bind(
+                                            &ChannelPool::resetAcceptTimeoutCb,
+                                            this,
+                                            serverId,
+                                            primary));
+        }
     }
 
     bsl::function<void()> invokeChannelUpCommand(
@@ -2681,9 +3567,9 @@ void ChannelPool::acceptCb(int serverId, bsl::shared_ptr<ServerState> server)
                                                 channelHandle);
     }
 
-    manager->execute(invokeChannelUpCommand);
+    channelPtr->execute(invokeChannelUpCommand);
     if (server->d_readEnabledFlag) {
-        manager->execute(initiateReadCommand);
+        channelPtr->execute(initiateReadCommand);
     }
 
     if (d_config.maxConnections() == numChannels) {
@@ -2749,6 +3635,35 @@ void ChannelPool::acceptTimeoutCb(int                          serverId,
     d_poolStateCb(e_ACCEPT_TIMEOUT, serverId, 0);
 }
 
+void ChannelPool::resetAcceptTimeoutCb(int                          serverId,
+                                       bsl::shared_ptr<ServerState> server)
+{
+    // Always executed in the event manager's dispatcher thread.
+    BSLS_ASSERT(server->d_isTimedFlag);
+    BSLS_ASSERT(bslmt::ThreadUtil::isEqual(
+                               bslmt::ThreadUtil::self(),
+                               server->d_manager_p->dispatcherThreadHandle()));
+
+    if (server->d_isClosedFlag) {
+        return;                                                       // RETURN
+    }
+
+    BSLS_ASSERT(server->d_timeoutTimerId);
+    server->d_manager_p->deregisterTimer(server->d_timeoutTimerId);
+
+    bsl::function<void()> acceptTimeoutFunctor(
+                            bdlf::BindUtil::bind(&ChannelPool::acceptTimeoutCb,
+                                                 this,
+                                                 serverId,
+                                                 server));
+
+    server->d_start = bdlt::CurrentTime::now() + server->d_timeout;
+    server->d_timeoutTimerId = server->d_manager_p->registerTimer(
+                                                         server->d_start,
+                                                         acceptTimeoutFunctor);
+    BSLS_ASSERT(server->d_timeoutTimerId);
+}
+
 int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
                         int                         backlog,
                         int                         serverId,
@@ -2758,8 +3673,12 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
                         bool                        isTimedFlag,
                         const bsls::TimeInterval&   timeout,
                         const btlso::SocketOptions *socketOptions,
-                        int                        *platformErrorCode)
+                        int                        *platformErrorCode,
+                        const btlso::LocalAddress  *localEndpoint)
 {
+    BSLS_ASSERT(0 == localEndpoint || (0 == reuseAddress
+                                    && 0 == socketOptions));
+
     enum {
         e_AMBIGUOUS_REUSE_ADDRESS     = -11,
         e_SET_SOCKET_OPTION_FAILED    = -10,
@@ -2817,99 +3736,154 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
     ss->d_readEnabledFlag    = readEnabledFlag;
     ss->d_keepHalfOpenMode   = mode;
 
-    // Open the server socket: from btlsos_tcptimedcbacceptor.  Upon early
-    // return, destroying the shared ptr 'server' destroys 'ss'.  (In
-    // particular, it will deallocate the socket, which is why it must be set
-    // to 0 above in case we exit before 'ss->d_socket_p = serverSocket'.)
+    // With sharded listeners, open one listening socket per event manager,
+    // all bound to the same port with 'SO_REUSEPORT', and chain their server
+    // states from 'ss'.  Only 'ss' holds the accept timeout.
 
-    StreamSocket *serverSocket = d_factory.allocate();
-    if (!serverSocket) {
-        if (platformErrorCode) {
-            *platformErrorCode = getPlatformErrorCode();
-        }
-        return e_ALLOCATE_FAILED;                                     // RETURN
+    int numListeners = 1;
+#ifdef SO_REUSEPORT
+    if (d_config.reusePortListeners() && !localEndpoint) {
+        numListeners = static_cast<int>(d_managers.size());
     }
-    ss->d_socket_p = serverSocket;
+#endif
+    ss->d_isShardedFlag = 1 < numListeners;
+
+    btlso::IPv4Address  serverAddress(endpoint);
+    ServerState        *shard = ss;
+
+    for (int i = 0; i < numListeners; ++i) {
+        if (0 < i) {
+            shard->d_nextShard.createInplace(d_allocator_p);
+            shard = shard->d_nextShard.get();
+
+            shard->d_factory_p        = &d_factory;
+            shard->d_endpoint         = serverAddress;
+            shard->d_creationTime     = ss->d_creationTime;
+            shard->d_readEnabledFlag  = readEnabledFlag;
+            shard->d_keepHalfOpenMode = mode;
+            shard->d_isShardedFlag    = true;
+            shard->d_primary          = server;
+        }
 
-    // From now on, destroying the shared ptr 'server' deallocates
-    // 'serverSocket' (in dtor of 'ss') and also deallocates 'ss'.
+        // Open the server socket: from btlsos_tcptimedcbacceptor.  Upon early
+        // return, destroying the shared ptr 'server' destroys 'ss' and the
+        // chained server states.  (In particular, it will deallocate the
+        // socket, which is why it must be 0 until
+        // 'shard->d_socket_p = serverSocket'.)
 
-    btlso::IPv4Address serverAddress;
-    if (0 != serverSocket->setOption(btlso::SocketOptUtil::k_SOCKETLEVEL,
-                                     btlso::SocketOptUtil::k_REUSEADDRESS,
-                                     !!reuseAddress)) {
-        if (platformErrorCode) {
-            *platformErrorCode = getPlatformErrorCode();
+        StreamSocket *serverSocket = localEndpoint
+                                   ? allocateLocalSocket(d_allocator_p)
+                                   : d_factory.allocate();
+        if (!serverSocket) {
+            if (platformErrorCode) {
+                *platformErrorCode = getPlatformErrorCode();
+            }
+            return e_ALLOCATE_FAILED;                                 // RETURN
         }
-        return e_SET_OPTION_FAILED;                                   // RETURN
-    }
+        shard->d_socket_p = serverSocket;
 
-    if (socketOptions) {
-        const int rc = btlso::SocketOptUtil::setSocketOptions(
-                                                        serverSocket->handle(),
-                                                       *socketOptions);
-        if (rc) {
+        // From now on, destroying the shared ptr 'server' deallocates
+        // 'serverSocket' (in dtor of 'shard') and also deallocates 'shard'.
+
+        if (!localEndpoint
+         && 0 != serverSocket->setOption(btlso::SocketOptUtil::k_SOCKETLEVEL,
+                                         btlso::SocketOptUtil::k_REUSEADDRESS,
+                                         !!reuseAddress)) {
             if (platformErrorCode) {
                 *platformErrorCode = getPlatformErrorCode();
             }
-            return e_SET_SOCKET_OPTION_FAILED;                        // RETURN
+            return e_SET_OPTION_FAILED;                               // RETURN
         }
-    }
 
-    if (0 != serverSocket->bind(endpoint)) {
-        if (platformErrorCode) {
-            *platformErrorCode = getPlatformErrorCode();
+#ifdef SO_REUSEPORT
+        if (ss->d_isShardedFlag
+         && 0 != serverSocket->setOption(btlso::SocketOptUtil::k_SOCKETLEVEL,
+                                         SO_REUSEPORT,
+                                         1)) {
+            if (platformErrorCode) {
+                *platformErrorCode = getPlatformErrorCode();
+            }
+            return e_SET_OPTION_FAILED;                               // RETURN
         }
-        return e_BIND_FAILED;                                         // RETURN
-    }
+#endif
 
-    if (0 != serverSocket->localAddress(&serverAddress)) {
-        if (platformErrorCode) {
-            *platformErrorCode = getPlatformErrorCode();
+        if (socketOptions) {
+            const int rc = btlso::SocketOptUtil::setSocketOptions(
+                                                        serverSocket->handle(),
+                                                       *socketOptions);
+            if (rc) {
+                if (platformErrorCode) {
+                    *platformErrorCode = getPlatformErrorCode();
+                }
+                return e_SET_SOCKET_OPTION_FAILED;                    // RETURN
+            }
         }
-        return e_LOCAL_ADDRESS_FAILED;                                // RETURN
-    }
 
-    BSLS_ASSERT(serverAddress.portNumber());
-    ss->d_endpoint = serverAddress;
+        // The first socket binds 'endpoint' (possibly with an ephemeral
+        // port); the other ones bind the address it actually obtained.  A
+        // local socket binds its path, and keeps the default 'd_endpoint'.
 
-    if (0 != serverSocket->listen(backlog)) {
-        if (platformErrorCode) {
-            *platformErrorCode = getPlatformErrorCode();
+        const int bindRc = localEndpoint
+                         ? bindLocalSocket(serverSocket, *localEndpoint)
+                         : serverSocket->bind(serverAddress);
+        if (0 != bindRc) {
+            if (platformErrorCode) {
+                *platformErrorCode = getPlatformErrorCode();
+            }
+            return e_BIND_FAILED;                                     // RETURN
+        }
+
+        if (0 == i && !localEndpoint) {
+            if (0 != serverSocket->localAddress(&serverAddress)) {
+                if (platformErrorCode) {
+                    *platformErrorCode = getPlatformErrorCode();
+                }
+                return e_LOCAL_ADDRESS_FAILED;                        // RETURN
+            }
+
+            BSLS_ASSERT(serverAddress.portNumber());
+            ss->d_endpoint = serverAddress;
+        }
+
+        if (0 != serverSocket->listen(backlog)) {
+            if (platformErrorCode) {
+                *platformErrorCode = getPlatformErrorCode();
+            }
+            return e_LISTEN_FAILED;                                   // RETURN
         }
-        return e_LISTEN_FAILED;                                       // RETURN
-    }
 
 #ifndef BTLSO_PLATFORM_WIN_SOCKETS
         // Windows has a bug -- setting listening socket to non-blocking mode
         // will force subsequent 'accept' calls to return WSAEWOULDBLOCK *even
         // when connection is present*.
 
-    if (0 != serverSocket->setBlockingMode(btlso::Flag::e_NONBLOCKING_MODE)) {
-        if (platformErrorCode) {
-            *platformErrorCode = getPlatformErrorCode();
+        if (0 != serverSocket->setBlockingMode(
+                                             btlso::Flag::e_NONBLOCKING_MODE)) {
+            if (platformErrorCode) {
+                *platformErrorCode = getPlatformErrorCode();
+            }
+            return e_SET_NONBLOCKING_FAILED;                          // RETURN
         }
-        return e_SET_NONBLOCKING_FAILED;                              // RETURN
-    }
 
 #endif
 
 #ifdef BSLS_PLATFORM_OS_UNIX
-    // Set close-on-exec flag: this only makes sense in Unix, there is no
-    // equivalent for Windows.
+        // Set close-on-exec flag: this only makes sense in Unix, there is no
+        // equivalent for Windows.
 
-    int fd    = serverSocket->handle();
-    int flags = fcntl(fd, F_GETFD);
-    int ret   = fcntl(fd, F_SETFD, flags | FD_CLOEXEC);
+        int fd    = serverSocket->handle();
+        int flags = fcntl(fd, F_GETFD);
+        int ret   = fcntl(fd, F_SETFD, flags | FD_CLOEXEC);
 
-    if (-1 == ret) {
-        if (platformErrorCode) {
-            *platformErrorCode = getPlatformErrorCode();
+        if (-1 == ret) {
+            if (platformErrorCode) {
+                *platformErrorCode = getPlatformErrorCode();
+            }
+            return e_SET_CLOEXEC_FAILED;                              // RETURN
         }
-        return e_SET_CLOEXEC_FAILED;                                  // RETURN
-    }
 
 #endif
+    }
 
     bsl::pair<ServerStateMap::iterator, bool> idx_status =
                                     d_acceptors.insert(bsl::make_pair(serverId,
@@ -2917,32 +3891,49 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
     idx = idx_status.first;
     BSLS_ASSERT(idx_status.second);
 
-    TcpTimerEventManager *manager = allocateEventManager();
-    BSLS_ASSERT(manager);
-
-    ss->d_manager_p = manager;
-
     // Closely identical to allocateServer, but must execute the pool state
-    // callback in the event manager's dispatcher thread.
-
-    bsl::function<void()> acceptFunctor(bdlf::BindUtil::bind(
+    // callback in the event manager's dispatcher thread.  A sharded listening
+    // socket is registered with the event manager of the same index, so that
+    // each event manager accepts on exactly one socket.
+
+    int i = 0;
+    for (bsl::shared_ptr<ServerState> current = server;
+         current;
+         current = current->d_nextShard, ++i) {
+        TcpTimerEventManager *manager = ss->d_isShardedFlag
+                                      ? d_managers[i]
+                                      : allocateEventManager();
+        BSLS_ASSERT(manager);
+
+        current->d_manager_p = manager;
+
+        bsl::function<void()> acceptFunctor(bdlf::BindUtil::bind(
                                                         &ChannelPool::acceptCb,
                                                         this,
                                                         serverId,
-                                                        server));
+                                                        current));
 
-    if (0 != manager->registerSocketEvent(serverSocket->handle(),
-                                          btlso::EventType::e_ACCEPT,
-                                          acceptFunctor)) {
-        d_acceptors.erase(idx);
+        if (0 != manager->registerSocketEvent(current->d_socket_p->handle(),
+                                              btlso::EventType::e_ACCEPT,
+                                              acceptFunctor)) {
+            if (platformErrorCode) {
+                *platformErrorCode = getPlatformErrorCode();
+            }
 
-        aGuard.release()->unlock();
+            // Undo the registrations of the previous sockets.
 
-        if (platformErrorCode) {
-            *platformErrorCode = getPlatformErrorCode();
-        }
+            for (ServerState *s = ss; s != current.get();
+                                                   s = s->d_nextShard.get()) {
+                s->d_isClosedFlag = 1;
+                s->d_manager_p->deregisterSocket(s->d_socket_p->handle());
+            }
 
-        return e_REGISTER_FAILED;                                     // RETURN
+            d_acceptors.erase(idx);
+
+            aGuard.release()->unlock();
+
+            return e_REGISTER_FAILED;                                 // RETURN
+        }
     }
 
     if (isTimedFlag) {
@@ -2952,7 +3943,7 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
                                                  serverId,
                                                  server));
 
-        ss->d_timeoutTimerId = manager->registerTimer(
+        ss->d_timeoutTimerId = ss->d_manager_p->registerTimer(
                                             bdlt::CurrentTime::now() + timeout,
                                             acceptTimeoutFunctor);
         BSLS_ASSERT(ss->d_timeoutTimerId);
@@ -3096,7 +4087,9 @@ void ChannelPool::connectInitiateCb(ConnectorMap::iterator idx)
     }
 
     if (continueFlag && !cs.d_socket) {
-        StreamSocket *connectionSocket = d_factory.allocate();
+        StreamSocket *connectionSocket = cs.d_localServerAddress.isNull()
+                                       ? d_factory.allocate()
+                                       : allocateLocalSocket(d_allocator_p);
 
         if (connectionSocket) {
             if (0 == connectionSocket->setBlockingMode(
@@ -3162,7 +4155,10 @@ void ChannelPool::connectInitiateCb(ConnectorMap::iterator idx)
             }
         }
 
-        int retCode = socket->connect(cs.d_serverAddress);
+        int retCode = cs.d_localServerAddress.isNull()
+                    ? socket->connect(cs.d_serverAddress)
+                    : connectLocalSocket(socket,
+                                         cs.d_localServerAddress.value());
 
         if (0 == retCode && 0 == socket->connectionStatus()) {
             // Since we are already in the event manager dispatcher's thread...
@@ -3356,10 +4352,10 @@ void ChannelPool::importCb(StreamSocket                    *socket_p,
                                                 channelHandle);
     }
 
-    manager->execute(invokeChannelUpCommand);
+    channelPtr->execute(invokeChannelUpCommand);
 
     if (readEnabledFlag) {
-        manager->execute(initiateReadCommand);
+        channelPtr->execute(initiateReadCommand);
     }
 
     if (d_config.maxConnections() == d_channels.length()) {
@@ -3422,11 +4418,18 @@ void ChannelPool::metricsCb()
     BSLS_ASSERT(0 < numManagers);
     BSLS_ASSERT(0 < d_config.maxThreads());
 
+    bsl::vector<int> workloads(numManagers, 0, d_allocator_p);
+
     for (size_type i = 0; i < numManagers; ++i) {
-        s += d_managers[i]->timeMetrics()->percentage(e_CPU_BOUND);
+        workloads[i] = d_managers[i]->timeMetrics()->percentage(e_CPU_BOUND);
+        s += workloads[i];
         d_managers[i]->timeMetrics()->resetAll();
     }
 
+    if (0 < d_config.migrationThreshold()) {
+        rebalanceChannelsImp(workloads, d_config.migrationThreshold());
+    }
+
     double d = static_cast<double>(s) / d_config.maxThreads();
 
     BSLS_ASSERT(0 <= d);
@@ -3440,6 +4443,77 @@ void ChannelPool::metricsCb()
                          d_metricsFunctor));
 }
 
+int ChannelPool::rebalanceChannelsImp(const bsl::vector<int>& workloads,
+                                      int                     threshold)
+{
+    typedef bsl::vector<TcpTimerEventManager *>::size_type size_type;
+    typedef bsl::pair<bsls::Types::Int64, ChannelHandle>   Candidate;
+
+    BSLS_ASSERT(workloads.size() == d_managers.size());
+    BSLS_ASSERT(0 <= threshold);
+
+    bslmt::LockGuard<bslmt::Mutex> guard(&d_rebalanceLock);
+
+    size_type busiest = 0;
+    size_type idlest  = 0;
+    for (size_type i = 1; i < workloads.size(); ++i) {
+        if (workloads[i] > workloads[busiest]) {
+            busiest = i;
+        }
+        if (workloads[i] < workloads[idlest]) {
+            idlest = i;
+        }
+    }
+
+    // Record the number of bytes transferred by every channel since the
+    // previous call, even if no migration is needed, so that the selection
+    // below is based on the traffic over the last interval only.
+
+    bsl::vector<Candidate> candidates(d_allocator_p);
+    bsls::Types::Int64     busiestNumBytes = 0;
+
+    for (bdlcc::ObjectCatalogIter<ChannelHandle> it(d_channels); it; ++it) {
+        Channel *channel = it().second.get();
+        if (!channel) {
+            continue;                                               // CONTINUE
+        }
+
+        const bsls::Types::Int64 numBytes = channel->numBytesRead()
+                                          + channel->numBytesWritten();
+        const bsls::Types::Int64 delta = numBytes
+                                       - channel->d_rebalanceNumBytes;
+
+        channel->d_rebalanceNumBytes = numBytes;
+
+        if (channel->eventManager() == d_managers[busiest] && 0 < delta) {
+            busiestNumBytes += delta;
+            candidates.push_back(Candidate(delta, it().second));
+        }
+    }
+
+    if (workloads[busiest] - workloads[idlest] <= threshold) {
+        return 0;                                                     // RETURN
+    }
+
+    // Migrating a channel that carries more than half of the traffic of the
+    // busiest thread would only move the imbalance to the idlest thread.
+
+    const Candidate *selected = 0;
+    for (size_type i = 0; i < candidates.size(); ++i) {
+        if (2 * candidates[i].first <= busiestNumBytes
+         && (!selected || candidates[i].first > selected->first)) {
+            selected = &candidates[i];
+        }
+    }
+
+    if (!selected) {
+        return 0;                                                     // RETURN
+    }
+
+    return 0 == selected->second->migrate(d_managers[idlest],
+                                          selected->second) ? 1 : 0;
+}
+
 // CREATORS
 ChannelPool::ChannelPool(ChannelStateChangeCallback       channelStateCb,
                          BlobBasedReadCallback            blobBasedReadCb,
@@ -3467,7 +4541,10 @@ ChannelPool::ChannelPool(ChannelStateChangeCallback       channelStateCb,
 , d_totalBytesReadAdjustment(0)
 , d_totalBytesWrittenAdjustment(0)
 , d_totalBytesRequestedWrittenAdjustment(0)
+, d_totalBytesWrittenZeroCopyAdjustment(0)
+, d_totalBytesWrittenCopiedAdjustment(0)
 , d_metricAdjustmentMutex()
+, d_numChannelMigrations(0)
 , d_factory(basicAllocator)
 , d_pool(sizeof(Channel), basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
@@ -3501,7 +4578,10 @@ ChannelPool::ChannelPool(btlb::BlobBufferFactory         *blobBufferFactory,
 , d_totalBytesReadAdjustment(0)
 , d_totalBytesWrittenAdjustment(0)
 , d_totalBytesRequestedWrittenAdjustment(0)
+, d_totalBytesWrittenZeroCopyAdjustment(0)
+, d_totalBytesWrittenCopiedAdjustment(0)
 , d_metricAdjustmentMutex()
+, d_numChannelMigrations(0)
 , d_factory(basicAllocator)
 , d_pool(sizeof(Channel), basicAllocator)
 , d_allocator_p(bslma::Default::allocator(basicAllocator))
@@ -3516,7 +4596,14 @@ ChannelPool::~ChannelPool()
         d_managers[0]->deregisterTimer(d_metricsTimerId.value());
     }
 
-    // Deallocate channels.
+    // Deallocate channels.  Note that the functors deferred by a pending
+    // migration hold a handle to their channel, and must be released first.
+
+    for (bdlcc::ObjectCatalogIter<ChannelHandle> it(d_channels); it; ++it) {
+        if (it().second) {
+            it().second->clearDeferredFunctors();
+        }
+    }
 
     d_channels.removeAll();
 
@@ -3559,7 +4646,9 @@ int ChannelPool::close(int serverId)
     // Safe even if not in the dispatcher thread, because all accesses to idx
     // (and hence the lifetime of ss) are safeguarded by the acceptors lock.
 
-    ss->d_isClosedFlag = 1;
+    for (ServerState *shard = ss; shard; shard = shard->d_nextShard.get()) {
+        shard->d_isClosedFlag = 1;
+    }
 
     // Each call below erases one reference to the shared ptr to the server
     // state, but the deregisterTimer may not succeed if the callback is
@@ -3573,12 +4662,14 @@ int ChannelPool::close(int serverId)
         ss->d_timeoutTimerId = 0;
     }
 
-    if (ss->d_acceptAgainId) {
-        ss->d_manager_p->deregisterTimer(ss->d_acceptAgainId);
-        ss->d_acceptAgainId = 0;
-    }
+    for (ServerState *shard = ss; shard; shard = shard->d_nextShard.get()) {
+        if (shard->d_acceptAgainId) {
+            shard->d_manager_p->deregisterTimer(shard->d_acceptAgainId);
+            shard->d_acceptAgainId = 0;
+        }
 
-    ss->d_manager_p->deregisterSocket(ss->d_socket_p->handle());
+        shard->d_manager_p->deregisterSocket(shard->d_socket_p->handle());
+    }
 
     d_acceptors.erase(idx);
 
@@ -3682,6 +4773,28 @@ int ChannelPool::listen(const btlso::IPv4Address&   endpoint,
                         platformErrorCode);
 }
 
+int ChannelPool::listen(const btlso::LocalAddress&  endpoint,
+                        int                         backlog,
+                        int                         serverId,
+                        bool                        readEnabledFlag,
+                        KeepHalfOpenMode            mode,
+                        int                        *platformErrorCode)
+{
+    enum { e_IS_NOT_TIMED = 0 };
+
+    return this->listen(btlso::IPv4Address(),
+                        backlog,
+                        serverId,
+                        0,
+                        readEnabledFlag,
+                        mode,
+                        e_IS_NOT_TIMED,
+                        bsls::TimeInterval(),
+                        0,
+                        platformErrorCode,
+                        &endpoint);
+}
+
                          // *** Client-related section
 
 int ChannelPool::connect(
@@ -3756,6 +4869,30 @@ int ChannelPool::connect(
                       platformErrorCode);
 }
 
+int ChannelPool::connect(const btlso::LocalAddress&  serverAddress,
+                         int                         numAttempts,
+                         const bsls::TimeInterval&   interval,
+                         int                         sourceId,
+                         bool                        readEnabledFlag,
+                         KeepHalfOpenMode            mode,
+                         int                        *platformErrorCode)
+{
+    BSLS_ASSERT(0 < numAttempts);
+    BSLS_ASSERT(bsls::TimeInterval(0) < interval || 1 == numAttempts);
+
+    return connectImp(btlso::IPv4Address(),
+                      numAttempts,
+                      interval,
+                      sourceId,
+                      0,
+                      readEnabledFlag,
+                      mode,
+                      0,
+                      0,
+                      platformErrorCode,
+                      &serverAddress);
+}
+
 int ChannelPool::connectImp(
                     const char                 *serverName,
                     int                         portNumber,
@@ -3863,9 +5000,13 @@ int ChannelPool::connectImp(
                     KeepHalfOpenMode            mode,
                     const btlso::SocketOptions *socketOptions,
                     const btlso::IPv4Address   *localAddress,
-                    int                        *platformErrorCode)
+                    int                        *platformErrorCode,
+                    const btlso::LocalAddress  *localServerAddress)
 {
     BSLS_ASSERT(0 == socketOptions || 0 == socket);
+    BSLS_ASSERT(0 == localServerAddress || (0 == socket
+                                         && 0 == socketOptions
+                                         && 0 == localAddress));
 
     if (!d_startFlag) {
         if (platformErrorCode) {
@@ -3907,6 +5048,9 @@ int ChannelPool::connectImp(
     idx = idx_status.first;
     BSLS_ASSERT(idx_status.second);
     idx->second.d_serverAddress = server;
+    if (localServerAddress) {
+        idx->second.d_localServerAddress = *localServerAddress;
+    }
 
     cGuard.release()->unlock();
 
@@ -3922,6 +5066,30 @@ int ChannelPool::connectImp(
 
                          // *** Channel management ***
 
+int ChannelPool::migrateChannel(int channelId, int threadIndex)
+{
+    enum {
+        e_NOT_FOUND      = -1,
+        e_INVALID_THREAD = -2,
+        e_FAILED         = -3
+    };
+
+    ChannelHandle channelHandle;
+    if (0 != findChannelHandle(&channelHandle, channelId)) {
+        return e_NOT_FOUND;                                           // RETURN
+    }
+
+    if (threadIndex < 0
+     || threadIndex >= static_cast<int>(d_managers.size())) {
+        return e_INVALID_THREAD;                                      // RETURN
+    }
+
+    if (0 != channelHandle->migrate(d_managers[threadIndex], channelHandle)) {
+        return e_FAILED;                                              // RETURN
+    }
+    return 0;
+}
+
 int ChannelPool::disableRead(int channelId)
 {
     enum { e_NOT_FOUND = -1 };
@@ -3946,7 +5114,7 @@ int ChannelPool::disableRead(int channelId)
                                                          channelHandle,
                                                          false));
 
-        channel->eventManager()->execute(disableReadCommand);
+        channel->execute(disableReadCommand);
     }
     return 0;
 }
@@ -3968,7 +5136,7 @@ int ChannelPool::enableRead(int channelId)
                                                 channel,
                                                 channelHandle));
 
-    channel->eventManager()->execute(initiateReadCommand);
+    channel->execute(initiateReadCommand);
     return 0;
 }
 
@@ -4526,9 +5694,16 @@ int ChannelPool::setServerSocketOption(int  option,
         }
         return e_NOT_FOUND;                                           // RETURN
     }
-    BSLS_ASSERT(idx->second->d_socket_p);
+    // Apply the option to every listening socket of a sharded server.
 
-    const int rc = idx->second->d_socket_p->setOption(level, option, value);
+    int rc = 0;
+    for (const ServerState *shard = idx->second.get();
+         shard && 0 == rc;
+         shard = shard->d_nextShard.get()) {
+        BSLS_ASSERT(shard->d_socket_p);
+
+        rc = shard->d_socket_p->setOption(level, option, value);
+    }
 
     if (rc && platformErrorCode) {
         *platformErrorCode = getPlatformErrorCode();
@@ -4647,6 +5822,27 @@ void ChannelPool::totalBytesRequestedToBeWrittenReset(
     d_totalBytesRequestedWrittenAdjustment = -total;
 }
 
+int ChannelPool::rebalanceChannels(int threshold)
+{
+    typedef bsl::vector<TcpTimerEventManager *>::size_type size_type;
+
+    BSLS_ASSERT(0 <= threshold);
+    BSLS_ASSERT(threshold <= 100);
+
+    if (!d_collectTimeMetrics) {
+        return 0;                                                     // RETURN
+    }
+
+    const size_type numManagers = d_managers.size();
+
+    bsl::vector<int> workloads(numManagers, 0, d_allocator_p);
+    for (size_type i = 0; i < numManagers; ++i) {
+        workloads[i] = d_managers[i]->timeMetrics()->percentage(e_CPU_BOUND);
+    }
+
+    return rebalanceChannelsImp(workloads, threshold);
+}
+
 // ACCESSORS
 
 void *ChannelPool::channelContext(int channelId) const
@@ -4728,21 +5924,27 @@ void ChannelPool::getHandleStatistics(
         ServerStateMap::const_iterator iter = d_acceptors.begin();
         ServerStateMap::const_iterator last = d_acceptors.end();
 
-        handleInfo->resize(idx + d_acceptors.size());
-        for (; iter != last; ++iter, ++idx) {
-            HandleInfo&        info = (*handleInfo)[idx];
-            const ServerState& ss   = *(iter->second);
-
-            // Because we hold the 'd_acceptorsLock', it's impossible that
-            // 'ss.d_socket_p' could be 0 as it is set once and for all in
-            // 'listen()' under the lock.
-
-            info.d_handle       = ss.d_socket_p->handle();
-            info.d_channelType  = ChannelType::e_LISTENING_CHANNEL;
-            info.d_channelId    = -1;
-            info.d_creationTime = ss.d_creationTime;
-            info.d_threadHandle = ss.d_manager_p->dispatcherThreadHandle();
-            info.d_userId       = iter->first;
+        handleInfo->reserve(idx + d_acceptors.size());
+        for (; iter != last; ++iter) {
+            for (const ServerState *ss = iter->second.get();
+                 ss;
+                 ss = ss->d_nextShard.get()) {
+                handleInfo->resize(++idx);
+                HandleInfo& info = handleInfo->back();
+
+                // Because we hold the 'd_acceptorsLock', it's impossible that
+                // 'ss->d_socket_p' could be 0 as it is set once and for all
+                // in 'listen()' under the lock.
+
+                info.d_handle       = ss->d_socket_p->handle();
+                info.d_channelType  = ChannelType::e_LISTENING_CHANNEL;
+                info.d_channelId    = -1;
+                info.d_creationTime = ss->d_creationTime;
+                info.d_threadHandle = ss->d_manager_p->
+                                                      dispatcherThreadHandle();
+                info.d_userId       = iter->first;
+                info.d_numAccepted  = ss->d_numAccepted;
+            }
         }
     }
 
@@ -4769,6 +5971,7 @@ void ChannelPool::getHandleStatistics(
                 info.d_creationTime = cs.d_creationTime;
                 info.d_threadHandle = cs.d_manager_p->dispatcherThreadHandle();
                 info.d_userId       = iter->first;
+                info.d_numAccepted  = 0;
             }
         }
     }
@@ -4791,6 +5994,7 @@ void ChannelPool::getHandleStatistics(
                 info.d_threadHandle = channel.eventManager()->
                                                       dispatcherThreadHandle();
                 info.d_userId       = channel.sourceId();
+                info.d_numAccepted  = 0;
             }
         }
     }
@@ -4900,6 +6104,40 @@ void ChannelPool::totalBytesWritten(bsls::Types::Int64 *result) const
     *result = total + d_totalBytesWrittenAdjustment;
 }
 
+void ChannelPool::totalBytesWrittenCopied(bsls::Types::Int64 *result) const
+{
+    // Note that this lock must be held to ensure that updating the adjustment
+    // to the metric total, and removing the channel is handled atomically.
+
+    bslmt::LockGuard<bslmt::Mutex>          guard(&d_metricAdjustmentMutex);
+    bdlcc::ObjectCatalogIter<ChannelHandle> it(d_channels);
+    bsls::Types::Int64                      total = 0;
+
+    for (; it; ++it) {
+        if (it().second) {
+            total += it().second->numBytesWrittenCopied();
+        }
+    }
+    *result = total + d_totalBytesWrittenCopiedAdjustment;
+}
+
+void ChannelPool::totalBytesWrittenZeroCopy(bsls::Types::Int64 *result) const
+{
+    // Note that this lock must be held to ensure that updating the adjustment
+    // to the metric total, and removing the channel is handled atomically.
+
+    bslmt::LockGuard<bslmt::Mutex>          guard(&d_metricAdjustmentMutex);
+    bdlcc::ObjectCatalogIter<ChannelHandle> it(d_channels);
+    bsls::Types::Int64                      total = 0;
+
+    for (; it; ++it) {
+        if (it().second) {
+            total += it().second->numBytesWrittenZeroCopy();
+        }
+    }
+    *result = total + d_totalBytesWrittenZeroCopyAdjustment;
+}
+
 void ChannelPool::totalBytesRead(bsls::Types::Int64 *result) const
 {
     // Note that this lock must be held to ensure that updating the adjustment
@@ -116,6 +116,55 @@ BSLS_IDENT("$Id: $")
 // is space available in the channel's buffer.  The same limit applies for
 // every channel.
 //
+///Sharded Listeners
+///-----------------
+// By default, 'listen' opens a single listening socket, which is registered
+// with one of the managed threads, and channels accepted on that socket are
+// handed over to the least busy thread.  Under heavy connection load (e.g.,
+// when many clients reconnect at once) that single socket, and the thread
+// accepting on it, limit the rate at which connections can be accepted.  If
+// the 'reusePortListeners' attribute of the configuration is 'true', and the
+// platform supports the 'SO_REUSEPORT' socket option, 'listen' instead opens
+// one listening socket per managed thread, all bound to the same endpoint,
+// and the operating system distributes incoming connections amongst them.
+// Each channel is then managed by the thread that accepted it.  All the
+// listening sockets are associated with the same server ID: 'close' closes
+// all of them, 'setServerSocketOption' applies to all of them, and
+// 'getServerSocketOption' reports the option of the first one.
+//
+// 'getHandleStatistics' reports one 'e_LISTENING_CHANNEL' entry per listening
+// socket, including the number of connections accepted on that socket
+// ('d_numAccepted') since its creation ('d_creationTime'), from which the
+// accept rate of each thread can be derived; the distribution of channels
+// amongst the threads is given by the 'd_threadHandle' of the other entries.
+//
+///Local (Unix-Domain) Sockets
+///----------------------------
+// Processes running on the same host can communicate over local (Unix-domain,
+// 'AF_UNIX') stream sockets instead of TCP over the loopback interface.  Local
+// sockets bypass the TCP/IP stack (no checksums, congestion control, or
+// acknowledgments), which lowers the latency and raises the throughput of
+// local channels.  On platforms providing BSD sockets, the 'listen' and
+// 'connect' overloads taking a 'btlso::LocalAddress' (a file-system path)
+// create such channels, which are then used exactly like TCP channels
+// (through the same channel IDs, callbacks, and write methods).  The
+// following restrictions apply:
+//
+//: o The addresses of a local channel or server (as reported, e.g., by
+//:   'getLocalAddress', 'getPeerAddress', and 'getServerAddress') are the
+//:   default 'btlso::IPv4Address'.
+//:
+//: o Socket options specific to TCP (e.g., 'TCP_NODELAY') cannot be set on
+//:   local channels, and listening sockets are never sharded (see "Sharded
+//:   Listeners" above).
+//:
+//: o Binding a local server creates a socket file at its path, which the
+//:   channel pool does *not* remove when the server is closed: the user must
+//:   'unlink' that file, both after closing the server and before listening
+//:   again on the same path.
+//
+// On other platforms, these overloads fail.
+//
 ///Behavior on 'fork'
 ///------------------
 // On Unix systems, the channel's underlying sockets (file descriptors) have
@@ -172,6 +221,63 @@ BSLS_IDENT("$Id: $")
 //            T
 //..
 //
+///Channel Migration
+///-----------------
+// A channel is assigned to the least busy managed thread when it is created,
+// and all its callbacks are invoked in that thread.  As the traffic of
+// long-lived channels shifts, some threads may become saturated while others
+// are idle.  'migrateChannel' moves an open channel to another managed
+// thread.  The state of the channel is preserved: data already enqueued for
+// writing is written, in order, from the new thread; data received but not
+// yet delivered is kept; and callbacks already scheduled for the channel are
+// invoked, in order, before any callback scheduled after the migration was
+// initiated.  The callbacks of a channel are never invoked concurrently.
+// Note that a pending read timeout is restarted when a channel is migrated,
+// and that clocks registered with 'registerClock' for a channel remain with
+// the thread that managed the channel when the clock was registered.
+//
+// If the 'migrationThreshold' attribute of the configuration is positive (and
+// time metrics are collected), the channel pool also rebalances its channels
+// automatically: at each metrics interval, if the workloads (see "Metrics and
+// Capacity" above) of the busiest and least busy threads differ by more than
+// 'migrationThreshold' percentage points, one channel is migrated from the
+// former to the latter.  The channel chosen is the one that transferred the
+// most bytes during the interval among those that transferred no more than
+// half of the bytes of their thread, so that a single hot channel is not
+// bounced between threads.  'rebalanceChannels' performs the same step on
+// demand.  Each completed migration is reported to the pool state callback as
+// an 'e_CHANNEL_MIGRATED' event, and 'numChannelMigrations' returns the
+// number of migrations completed.
+//
+///Zero-Copy Transmission
+///----------------------
+// By default, writing to a channel copies the data into the kernel.  If the
+// 'zeroCopyThreshold' attribute of the configuration is positive, and the
+// platform supports it (Linux, with 'SO_ZEROCOPY'), the channels accepted or
+// connected by the pool instead send the data of each write of at least
+// 'zeroCopyThreshold' bytes directly from the blob buffers of the message.
+// The channel pool holds a reference to these blob buffers until the kernel
+// reports that it no longer needs them, at which point the buffers are
+// released (e.g., returned to their blob buffer factory).  Since pinning the
+// pages of a buffer and processing its completion costs more than copying a
+// few kilobytes, zero-copy transmission pays off only for large writes (the
+// kernel documentation suggests writes of at least 10KB).
+//
+// Zero-copy transmission applies to messages written as a 'btlb::Blob' only
+// (the buffers of a 'btls::Iovec' or 'btls::Ovec' array are not owned by the
+// channel pool, and are always copied), and is never used for imported
+// channels, whose sockets may transform the data before writing it.  A socket
+// supplied to 'connect' must write its data directly to its handle, as does
+// 'btlso::InetStreamSocket'.  The user must not modify the blob buffers of a
+// message after writing it (as for any message enqueued for writing).  Note
+// that the kernel may still copy the data (e.g., over the loopback interface,
+// or to a device that does not support scatter-gather I/O), which
+// 'totalBytesWrittenCopied' reports.  Also note that the kernel reports the
+// completions as socket events that are processed when the channel is
+// notified for reading or writing, so a channel for which reading is disabled
+// may hold the buffers of its last writes until it writes again or is
+// closed.
+//
 ///Thread Safety
 ///-------------
 // The channel pool is *thread-enabled* meaning that any operation on the same
@@ -573,6 +679,10 @@ BSLS_IDENT("$Id: $")
 #include <btlso_inetstreamsocketfactory.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_LOCALADDRESS
+#include <btlso_localaddress.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_SOCKETHANDLE
 #include <btlso_sockethandle.h>
 #endif
@@ -769,6 +879,15 @@ class Connector {
                                    d_localAddress;     // client address to
                                                        // bind while connecting
 
+    bdlb::NullableValue<btlso::LocalAddress>
+                                   d_localServerAddress;
+                                                       // local (Unix-domain)
+                                                       // server to connect to,
+                                                       // if not null (in which
+                                                       // case
+                                                       // 'd_serverAddress' is
+                                                       // unused)
+
     // CREATORS
     Connector(const bsl::shared_ptr<btlso::StreamSocket<btlso::IPv4Address> >&
                                           socket,
@@ -913,8 +1032,10 @@ class ChannelPool {
         // 'CHANNEL_LIMIT' alert).  The third parameter, if 'eventType' is an
         // error, may (or may not) be loaded with a non-zero value indicating
         // the underlying platform-specific error code that resulted in the
-        // error event.  The prototype of a pool state callback might look
-        // like:
+        // error event.  For an 'e_CHANNEL_MIGRATED' event, the second
+        // parameter is the ID of the migrated channel, and the third parameter
+        // is the index of the thread now managing that channel.  The prototype
+        // of a pool state callback might look like:
         //..
         //  void poolStateCallback(int eventType,
         //                         int sourceId,
@@ -949,7 +1070,8 @@ class ChannelPool {
         e_CAPACITY_LIMIT,               // capacity limit reached
         e_ERROR_BINDING_CLIENT_ADDR,    // error binding client address
         e_ERROR_SETTING_OPTIONS,        // error setting socket options
-        e_EVENT_MANAGER_LIMIT           // event manager limit reached
+        e_EVENT_MANAGER_LIMIT,          // event manager limit reached
+        e_CHANNEL_MIGRATED              // channel migrated to another thread
 
     };
 
@@ -996,7 +1118,9 @@ class ChannelPool {
         // by a call to 'connect' or 'import').  Some channel types correspond
         // to a channel in process of creation (during 'connect') and may not
         // yet have a channel ID, in which case -1 is used for 'd_channelId'
-        // and for 'd_userId' instead.
+        // and for 'd_userId' instead.  For a listening socket, 'd_numAccepted'
+        // is the number of connections accepted on that socket since its
+        // creation; it is 0 for all other channel types.
 
         btlso::SocketHandle::Handle d_handle;       // socket handle (file
                                                     // descriptor)
@@ -1014,6 +1138,10 @@ class ChannelPool {
                                                     // thread
 
         int                         d_userId;       // 'serverId' or 'sourceId'
+
+        bsls::Types::Int64          d_numAccepted;  // number of connections
+                                                    // accepted (listening
+                                                    // sockets only)
     };
 
   private:
@@ -1107,10 +1235,32 @@ class ChannelPool {
                                                // channels and calls to
                                                // reset
 
+    volatile bsls::Types::Int64         d_totalBytesWrittenZeroCopyAdjustment;
+                                               // adjustment to the sum of
+                                               // individual channel values,
+                                               // accounting for closed
+                                               // channels
+
+    volatile bsls::Types::Int64         d_totalBytesWrittenCopiedAdjustment;
+                                               // adjustment to the sum of
+                                               // individual channel values,
+                                               // accounting for closed
+                                               // channels
+
     mutable bslmt::Mutex                d_metricAdjustmentMutex;
                                                // synchronize operations on
                                                // two metric adjustment values
 
+                                        // *** Channel migration ***
+
+    bsls::AtomicInt64                   d_numChannelMigrations;
+                                               // number of channel
+                                               // migrations completed
+
+    bslmt::Mutex                        d_rebalanceLock;
+                                               // serialize the selection of
+                                               // channels to migrate
+
                                         // *** Memory allocation ***
 
     btlso::InetStreamSocketFactory<btlso::IPv4Address>
@@ -1163,6 +1313,13 @@ class ChannelPool {
         // server state since the last server connection or last timeout
         // callback.
 
+    void resetAcceptTimeoutCb(int serverId, ServerHandle server);
+        // Re-schedule the 'acceptTimeoutCb' of the specified 'server' whose ID
+        // is the specified 'serverId' to occur one timeout period from now.
+        // This callback is invoked, in the dispatcher thread of the event
+        // manager of 'server', whenever a connection is accepted on one of
+        // the listening sockets of a timed server.
+
     int listen(const btlso::IPv4Address&   endpoint,
                int                         backlog,
                int                         serverId,
@@ -1172,12 +1329,16 @@ class ChannelPool {
                bool                        isTimedFlag,
                const bsls::TimeInterval&   timeout = bsls::TimeInterval(),
                const btlso::SocketOptions *socketOptions = 0,
-               int                        *platformErrorCode = 0);
+               int                        *platformErrorCode = 0,
+               const btlso::LocalAddress  *localEndpoint = 0);
         // Establish a listening socket having the specified 'backlog' maximum
-        // number of pending connections on the specified 'endpoint' and the
-        // specified 'reuseAddress' used in setting 'e_REUSEADDRESS' socket
-        // option, and associate this newly established socket with the
-        // specified 'serverId'.  If the specified 'readEnabledFlag' is
+        // number of pending connections on the specified 'endpoint' (or on
+        // the optionally specified 'localEndpoint', if not 0, in which case
+        // the listening socket is a local socket, 'endpoint' is ignored, and
+        // 'reuseAddress' and 'socketOptions' must be 0) and the specified
+        // 'reuseAddress' used in setting 'e_REUSEADDRESS' socket option, and
+        // associate this newly established socket with the specified
+        // 'serverId'.  If the specified 'readEnabledFlag' is
         // non-zero, any channel created by 'acceptCb' will be enabled for read
         // upon creation, and otherwise it will not.  If the specified
         // 'isTimedFlag' is non-zero, register a timer which will execute
@@ -1242,14 +1403,18 @@ class ChannelPool {
                    KeepHalfOpenMode            mode,
                    const btlso::SocketOptions *socketOptions,
                    const btlso::IPv4Address   *localAddress,
-                   int                        *platformErrorCode = 0);
+                   int                        *platformErrorCode = 0,
+                   const btlso::LocalAddress  *localServerAddress = 0);
         // Asynchronously issue up to the specified 'numAttempts' connection
-        // requests to a server at the specified 'serverAddress', with at least
-        // the specified (relative) time 'interval' after each attempt before
-        // either a new connection is retried (if 'numAttempts' is not reached)
-        // or the connection attempts are abandoned (if 'numAttempts' is
-        // reached).  When the connection is established, an internal channel
-        // is created and a channel state callback, with the event
+        // requests to a server at the specified 'serverAddress' (or at the
+        // optionally specified 'localServerAddress', if not 0, in which case
+        // the pool connects a local socket, 'serverAddress' is ignored, and
+        // 'socket', 'socketOptions', and 'localAddress' must be 0), with at
+        // least the specified (relative) time 'interval' after each attempt
+        // before either a new connection is retried (if 'numAttempts' is not
+        // reached) or the connection attempts are abandoned (if 'numAttempts'
+        // is reached).  When the connection is established, an internal
+        // channel is created and a channel state callback, with the event
         // 'e_CHANNEL_UP', the newly created channel ID, and the specified
         // 'sourceId' is invoked in an internal thread.  If the 'interval' is
         // reached, or in case other events occur (e.g., 'e_ERROR_CONNECTING',
@@ -1360,6 +1525,17 @@ class ChannelPool {
     void metricsCb();
         // Update metrics for each event manager.
 
+    int rebalanceChannelsImp(const bsl::vector<int>& workloads,
+                             int                     threshold);
+        // Initiate the migration of one channel from the managed thread
+        // having the highest of the specified 'workloads' to the managed
+        // thread having the lowest, if these differ by more than the specified
+        // 'threshold' (in percentage points), and return the number of
+        // migrations initiated (i.e., 0 or 1).  The behavior is undefined
+        // unless 'workloads' has one element per managed thread.  See
+        // "Channel Migration" in the component-level documentation for the
+        // choice of the channel.
+
     // PRIVATE ACCESSORS
     int findChannelHandle(ChannelHandle *handle, int channelId) const;
         // Load into 'handle' a shared-pointer to the channel associated with
@@ -1485,8 +1661,37 @@ class ChannelPool {
         // unique) and a negative value if an error occurred.  Every time a
         // connection is accepted by this pool on this (newly established)
         // listening socket, 'serverId' is passed to the callback provided in
-        // the configuration at construction.  The behavior is undefined unless
-        // '0 < backlog'.
+        // the configuration at construction.  Note that, if the
+        // 'reusePortListeners' attribute of the configuration is 'true', one
+        // listening socket is established per managed thread (see "Sharded
+        // Listeners" in the component-level documentation).  The behavior is
+        // undefined unless '0 < backlog'.
+
+    int listen(const btlso::LocalAddress&  endpoint,
+               int                         backlog,
+               int                         serverId,
+               bool                        readEnabledFlag = true,
+               KeepHalfOpenMode            mode = e_CLOSE_BOTH,
+               int                        *platformErrorCode = 0);
+        // Establish a local (Unix-domain) listening socket having the
+        // specified 'backlog' maximum number of pending connections on the
+        // specified 'endpoint' path, and associate this newly established
+        // socket with the specified 'serverId'.  Optionally specify via a
+        // 'readEnabledFlag' whether automatic reading should be enabled on the
+        // channels accepted on this socket immediately after creation; if
+        // 'readEnabledFlag' is not specified, then 'true' is used.  Optionally
+        // specify a 'mode' to keep a channel accepted on this socket half-open
+        // when it is half-closed; if 'mode' is not specified, then
+        // 'e_CLOSE_BOTH' is used.  Optionally specify 'platformErrorCode' that
+        // will be loaded with the platform-specific error code if this method
+        // fails.  Return 0 on success, a positive value if there is a
+        // listening socket associated with 'serverId' (i.e., 'serverId' is not
+        // unique) and a negative value if an error occurred (in particular, if
+        // a file already exists at 'endpoint', or if the platform does not
+        // support local sockets).  The behavior is undefined unless
+        // '0 < backlog'.  Note that the socket file created at 'endpoint' is
+        // not removed by this pool (see "Local (Unix-Domain) Sockets" in the
+        // component-level documentation).
 
                                   // *** Client part ***
 
@@ -1627,8 +1832,50 @@ class ChannelPool {
         // 'import' as long as two calls to connect with the same 'sourceId' do
         // not overlap.
 
+    int connect(const btlso::LocalAddress&  serverAddress,
+                int                         numAttempts,
+                const bsls::TimeInterval&   interval,
+                int                         sourceId,
+                bool                        readEnabledFlag = true,
+                KeepHalfOpenMode            mode = e_CLOSE_BOTH,
+                int                        *platformErrorCode = 0);
+        // Asynchronously issue up to the specified 'numAttempts' connection
+        // requests to a local (Unix-domain) server listening on the specified
+        // 'serverAddress' path, with at least the specified (relative) time
+        // 'interval' after each attempt, and create a channel on success, as
+        // described for the 'connect' overloads taking a
+        // 'btlso::IPv4Address'.  Optionally specify via a 'readEnabledFlag'
+        // whether automatic reading should be enabled on this channel
+        // immediately after creation; if 'readEnabledFlag' is not specified,
+        // then 'true' is used.  Optionally specify a half-close 'mode' in case
+        // the channel created for this connection is half-closed; if 'mode'
+        // is not specified, then 'e_CLOSE_BOTH' is used.  Optionally specify
+        // 'platformErrorCode' that will be loaded with the platform-specific
+        // error code if this method fails.  Return 0 on successful initiation,
+        // a positive value if there is an active connection attempt with the
+        // same 'sourceId', or a negative value if an error occurred (in
+        // particular, if the platform does not support local sockets), with
+        // the value of -1 indicating that the channel pool is not running.
+        // The behavior is undefined unless '0 < numAttempts', and either
+        // '0 < interval' or '1 == numAttempts' or both.  Note that the
+        // connection attempts of a local socket complete (or fail)
+        // immediately, e.g., if no server is listening on 'serverAddress' or
+        // if its backlog is full, and are then retried after 'interval'.
+
                                   // *** Channel management ***
 
+    int migrateChannel(int channelId, int threadIndex);
+        // Initiate the migration of the channel having the specified
+        // 'channelId' to the managed thread having the specified
+        // 'threadIndex'.  Return 0 on success, and a non-zero value if there
+        // is no such channel, if 'threadIndex' is out of range, if the channel
+        // is not up yet or is (even partially) down, if it is already managed
+        // by that thread, or if it is already being migrated.  Once the
+        // migration completes, all callbacks for that channel are invoked in
+        // the thread identified by 'threadIndex', and the pool state callback
+        // is invoked with 'e_CHANNEL_MIGRATED'.  See "Channel Migration" in
+        // the component-level documentation for the guarantees provided.
+
     int disableRead(int channelId);
         // Enqueue a request to disable automatic reading on the channel having
         // the specified 'channelId'.  Return 0 on success and a non-zero value
@@ -1956,6 +2203,17 @@ class ChannelPool {
         // Load, into the specified 'result', and atomically reset the total
         // number of bytes requested to be written by the pool.
 
+    int rebalanceChannels(int threshold);
+        // Initiate the migration of one channel from the busiest managed
+        // thread to the least busy one if their workloads over the current
+        // metrics interval differ by more than the specified 'threshold'
+        // percentage points, and return the number of migrations initiated
+        // (i.e., 0 or 1).  Return 0 with no effect if time metrics are not
+        // collected.  The behavior is undefined unless
+        // '0 <= threshold <= 100'.  Note that, if the 'migrationThreshold'
+        // attribute of the configuration is positive, this channel pool
+        // performs this step automatically at each metrics interval.
+
     // ACCESSORS
     int busyMetrics() const;
         // Return the (percent) value in the range [0..100] (inclusive) that
@@ -2024,9 +2282,12 @@ class ChannelPool {
         //     result of a call to 'import'
         //     with the given 'sourceId'
         //..
-        // Also note that there is no specified order in which 'handleInfo' is
-        // updated.  Finally note that entries are appended to 'handleInfo';
-        // clear this vector prior to calling this function if desired.
+        // A server listening on sharded sockets (see "Sharded Listeners" in
+        // the component-level documentation) has one entry for each of its
+        // listening sockets.  Also note that there is no specified order in
+        // which 'handleInfo' is updated.  Finally note that entries are
+        // appended to 'handleInfo'; clear this vector prior to calling this
+        // function if desired.
 
     int getServerAddress(btlso::IPv4Address *result, int serverId) const;
         // Load into the specified 'result' the complete IP address associated
@@ -2073,6 +2334,10 @@ class ChannelPool {
         // Return the number of channels currently managed by this channel
         // pool.
 
+    bsls::Types::Int64 numChannelMigrations() const;
+        // Return the number of channel migrations completed by this channel
+        // pool since its construction.
+
     int numEvents(int index) const;
         // Return the number of events currently registered with an event
         // manager corresponding to the specified 'index'.  The behavior is
@@ -2108,6 +2373,21 @@ class ChannelPool {
         // Load, into the specified 'result', the total number of bytes written
         // by the pool.
 
+    void totalBytesWrittenCopied(bsls::Types::Int64 *result) const;
+        // Load, into the specified 'result', the total number of bytes written
+        // by the pool that were copied into the kernel.  Note that this
+        // includes the bytes of zero-copy writes for which the kernel reported
+        // that it copied the data anyway (see "Zero-Copy Transmission" in the
+        // component-level documentation).
+
+    void totalBytesWrittenZeroCopy(bsls::Types::Int64 *result) const;
+        // Load, into the specified 'result', the total number of bytes written
+        // by the pool that were sent without being copied into the kernel
+        // (see "Zero-Copy Transmission" in the component-level documentation).
+        // Note that the bytes of a zero-copy write are counted (either by this
+        // method or by 'totalBytesWrittenCopied') only once the kernel reports
+        // its completion.
+
 
 
 };
@@ -2377,6 +2657,12 @@ int ChannelPool::numChannels() const
     return d_channels.length();
 }
 
+inline
+bsls::Types::Int64 ChannelPool::numChannelMigrations() const
+{
+    return d_numChannelMigrations;
+}
+
 inline
 int ChannelPool::numThreads() const
 {
@@ -17,6 +17,7 @@
 #include <btlso_flag.h>
 #include <btlso_inetstreamsocketfactory.h>
 #include <btlso_ipv4address.h>
+#include <btlso_localaddress.h>
 #include <btlso_resolveutil.h>
 #include <btlso_streamsocket.h>
 #include <btlso_socketoptions.h>
@@ -68,6 +69,7 @@
 #include <bsl_map.h>
 #include <bsl_memory.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 #include <bsl_vector.h>
 
 #include <bsls_assert.h>
@@ -75,6 +77,7 @@
 #ifdef BSLS_PLATFORM_OS_UNIX
 #include <bsl_c_signal.h>
 #include <sys/resource.h>
+#include <unistd.h>
 #endif
 
 using namespace bsl;  // automatically added by script
@@ -166,6 +169,12 @@ using namespace bdlf::PlaceHolders;
 // [28] TESTING: 'busyMetrics' and time metrics collection.
 // [28] CONCERN: Event Manager Allocation
 // [30] Implementing a QueueProcessor
+// [40] CONCERN: 'reusePortListeners' opens one listener per thread
+// [41] CONCERN: Channel migration preserves ordering and state
+// [42] CONCERN: Zero-copy transmission holds and releases blob buffers
+// [43] CONCERN: Local (Unix-domain) channels transfer data
+// [44] CONCERN: 'batchSubmission' pools transfer data
+// [45] CONCERN: Zero-copy buffers are released when not reading
 // [37] USAGE EXAMPLE
 //=============================================================================
 //                       STANDARD BDE ASSERT TEST MACROS
@@ -362,7 +371,8 @@ struct PoolState {
         e_CAPACITY_LIMIT,               // capacity limit reached
         e_ERROR_BINDING_CLIENT_ADDR,    // error binding client address
         e_ERROR_SETTING_OPTIONS,        // error setting socket options
-        e_EVENT_MANAGER_LIMIT           // event manager limit reached
+        e_EVENT_MANAGER_LIMIT,          // event manager limit reached
+        e_CHANNEL_MIGRATED              // channel migrated to another thread
     };
 };
 
@@ -5262,7 +5272,8 @@ operator<<(bsl::ostream& s,
           << handles[i].d_channelType << ", "
           << handles[i].d_channelId << ", "
 //          << handles[i].d_threadHandle << ", "
-          << handles[i].d_userId
+          << handles[i].d_userId << ", "
+          << handles[i].d_numAccepted
           << " }";
     }
     s << " }";
@@ -7949,151 +7960,1988 @@ void *usageExampleMinusOne(void *arg)
 
 }  // close namespace QUEUE_CLIENT_NAMESPACE
 
+//-----------------------------------------------------------------------------
+//                  TEST_CASE_REUSE_PORT supporting classes and methods
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_REUSE_PORT {
+
+enum {
+    SERVER_ID       = 0x5e4d,
+    TIMED_SERVER_ID = 0x5e4e
+};
+
+void poolStateCb(int state, int source, int platformError)
+{
+    if (veryVerbose) {
+        MTCOUT << "Pool state callback called with"
+               << " State: " << state
+               << " Source: "  << source
+               << " PlatformError: " << platformError << MTENDL;
+    }
+}
+
+void channelStateCb(int              channelId,
+                    int              serverId,
+                    int              state,
+                    void            *,
+                    bsls::AtomicInt *numChannels)
+{
+    if (veryVerbose) {
+        MTCOUT << "Channel state callback called with"
+               << " Channel Id: " << channelId
+               << " Server Id: "  << serverId
+               << " State: " << state << MTENDL;
+    }
+
+    if (btlmt::ChannelPool::e_CHANNEL_UP == state) {
+        ++*numChannels;
+    }
+}
+
+void blobBasedReadCb(int        *needed,
+                     btlb::Blob *msg,
+                     int         ,
+                     void       *)
+{
+    *needed = 1;
+    msg->removeAll();
+}
+
+int connectClients(
+          bsl::vector<btlso::StreamSocket<btlso::IPv4Address> *> *clients,
+          btlso::StreamSocketFactory<btlso::IPv4Address>         *factory,
+          const btlso::IPv4Address&                               address,
+          int                                                     numClients)
+    // Connect the specified 'numClients' sockets allocated from the specified
+    // 'factory' to the specified 'address', and append them to the specified
+    // 'clients'.  Return the number of sockets successfully connected.
+{
+    int numConnected = 0;
+    for (int i = 0; i < numClients; ++i) {
+        btlso::StreamSocket<btlso::IPv4Address> *socket = factory->allocate();
+        ASSERT(socket);
+        if (0 == socket->connect(address)) {
+            ++numConnected;
+        }
+        clients->push_back(socket);
+    }
+    return numConnected;
+}
+
+void waitForChannels(bsls::AtomicInt *numChannels, int expected)
+    // Wait for at most 10 seconds until the specified 'numChannels' reaches
+    // the specified 'expected' value.
+{
+    for (int i = 0; i < 1000 && *numChannels < expected; ++i) {
+        bslmt::ThreadUtil::microSleep(10000);
+    }
+}
+
+}  // close namespace TEST_CASE_REUSE_PORT
+
+//-----------------------------------------------------------------------------
+//                  TEST_CASE_MIGRATION supporting classes and methods
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_MIGRATION {
+
+enum {
+    SERVER_ID = 0x3c1e,
+    k_MODULUS = 251      // the byte at offset 'i' of a stream is 'i % 251'
+};
+
+typedef btlso::StreamSocket<btlso::IPv4Address> ClientSocket;
+
+bsls::AtomicInt s_spinMicroseconds(0);
+    // time spent busy-waiting by 'readCb' at each invocation
+
+struct ChannelData {
+    // This 'struct' holds the state of a channel, as observed by its data
+    // callback.
+
+    bsls::AtomicInt64  d_numReceived;   // bytes received by the pool
+    bsls::AtomicInt    d_numErrors;     // bytes received out of sequence
+    bsls::AtomicInt    d_numActive;     // data callbacks in progress
+    bsls::AtomicInt    d_numOverlaps;   // concurrent data callbacks
+    bsls::AtomicInt64  d_threadId;      // thread of the last data callback
+};
+
+struct PoolObserver {
+    // This 'struct' records the channels created by a pool, and the channel
+    // migrations it reports.
+
+    bslmt::Mutex     d_mutex;
+    bsl::vector<int> d_channelIds;             // guarded by 'd_mutex'
+    bsls::AtomicInt  d_numMigratedEvents;
+};
+
+void channelStateCb(int           channelId,
+                    int           ,
+                    int           state,
+                    void         *,
+                    PoolObserver *observer)
+{
+    if (btlmt::ChannelPool::e_CHANNEL_UP == state) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&observer->d_mutex);
+        observer->d_channelIds.push_back(channelId);
+    }
+}
+
+void poolStateCb(int           state,
+                 int           source,
+                 int           threadIndex,
+                 PoolObserver *observer)
+{
+    if (veryVerbose) {
+        MTCOUT << "Pool state callback called with"
+               << " State: " << state
+               << " Source: "  << source
+               << " Thread: " << threadIndex << MTENDL;
+    }
+
+    if (btlmt::ChannelPool::e_CHANNEL_MIGRATED == state) {
+        LOOP_ASSERT(threadIndex, 0 <= threadIndex);
+        ++observer->d_numMigratedEvents;
+    }
+}
+
+void readCb(int *needed, btlb::Blob *msg, int channelId, void *context)
+    // Verify that the data in the specified 'msg' continues the pattern of
+    // the channel having the specified 'channelId' and the state in the
+    // specified 'context', record the calling thread, and consume the data.
+{
+    *needed = 1;
+
+    ChannelData *data = static_cast<ChannelData *>(context);
+    LOOP_ASSERT(channelId, data);
+    if (!data) {
+        msg->removeAll();
+        return;                                                       // RETURN
+    }
+
+    if (1 != ++data->d_numActive) {
+        ++data->d_numOverlaps;
+    }
+    data->d_threadId = static_cast<bsls::Types::Int64>(
+                                      bslmt::ThreadUtil::selfIdAsUint64());
+
+    bsls::Types::Int64 offset = data->d_numReceived;
+    for (int i = 0; i < msg->numDataBuffers(); ++i) {
+        const char *buffer = msg->buffer(i).data();
+        const int   length = i < msg->numDataBuffers() - 1
+                             ? msg->buffer(i).size()
+                             : msg->lastDataBufferLength();
+
+        for (int j = 0; j < length; ++j, ++offset) {
+            if (static_cast<char>(offset % k_MODULUS) != buffer[j]) {
+                ++data->d_numErrors;
+            }
+        }
+    }
+    data->d_numReceived = offset;
+    msg->removeAll();
+
+    if (s_spinMicroseconds) {
+        bsls::Stopwatch timer;
+        timer.start();
+        while (timer.elapsedTime() * 1000000 < s_spinMicroseconds) {
+        }
+    }
+
+    --data->d_numActive;
+}
+
+template <class SOCKET>
+void sendPattern(SOCKET             *socket,
+                 bsls::Types::Int64 *numSent,
+                 int                 numBytes)
+    // Write to the specified 'socket' the specified 'numBytes' next bytes of
+    // the test pattern, starting at offset '*numSent', and add the number of
+    // bytes written to the specified 'numSent'.
+{
+    char buffer[4096];
+
+    while (0 < numBytes) {
+        const int length = bsl::min(numBytes,
+                                    static_cast<int>(sizeof buffer));
+        for (int i = 0; i < length; ++i) {
+            buffer[i] = static_cast<char>((*numSent + i) % k_MODULUS);
+        }
+
+        const int rc = socket->write(buffer, length);
+        LOOP_ASSERT(rc, 0 < rc);
+        if (rc <= 0) {
+            return;                                                   // RETURN
+        }
+        *numSent += rc;
+        numBytes -= rc;
+    }
+}
+
+template <class SOCKET>
+int receivePattern(SOCKET             *socket,
+                   bsls::Types::Int64 *numReceived,
+                   bsls::Types::Int64  numBytes)
+    // Read from the specified 'socket' the specified 'numBytes' next bytes of
+    // the test pattern, starting at offset '*numReceived', and add the number
+    // of bytes read to the specified 'numReceived'.  Return the number of
+    // bytes out of sequence, or a negative value if the bytes could not be
+    // read within 10 seconds.
+{
+    const bsls::TimeInterval timeout = bdlt::CurrentTime::now()
+                                     + bsls::TimeInterval(10);
+
+    char buffer[4096];
+    int  numErrors = 0;
+
+    while (0 < numBytes) {
+        if (btlso::Flag::e_IO_READ != socket->waitForIO(btlso::Flag::e_IO_READ,
+                                                        timeout)) {
+            return -1;                                                // RETURN
+        }
+
+        const int length = static_cast<int>(
+                     bsl::min(numBytes,
+                              static_cast<bsls::Types::Int64>(sizeof buffer)));
+
+        const int rc = socket->read(buffer, length);
+        if (rc <= 0) {
+            return -1;                                                // RETURN
+        }
+
+        for (int i = 0; i < rc; ++i) {
+            if (static_cast<char>((*numReceived + i) % k_MODULUS)
+                                                               != buffer[i]) {
+                ++numErrors;
+            }
+        }
+        *numReceived += rc;
+        numBytes     -= rc;
+    }
+    return numErrors;
+}
+
+void writePattern(btlmt::ChannelPool *pool,
+                  int                 channelId,
+                  bsls::Types::Int64 *numWritten,
+                  int                 numBytes)
+    // Enqueue for writing to the channel having the specified 'channelId' in
+    // the specified 'pool' the specified 'numBytes' next bytes of the test
+    // pattern, starting at offset '*numWritten', and add 'numBytes' to the
+    // specified 'numWritten'.
+{
+    char buffer[1024];
+    BSLS_ASSERT(numBytes <= static_cast<int>(sizeof buffer));
+
+    for (int i = 0; i < numBytes; ++i) {
+        buffer[i] = static_cast<char>((*numWritten + i) % k_MODULUS);
+    }
+
+    btlb::Blob blob(pool->outboundBlobBufferFactory());
+    btlb::BlobUtil::append(&blob, buffer, numBytes);
+
+    const int rc = pool->write(channelId, blob);
+    LOOP_ASSERT(rc, 0 == rc);
+
+    *numWritten += numBytes;
+}
+
+bool waitFor(const bsls::AtomicInt64& value, bsls::Types::Int64 expected)
+    // Wait for at most 10 seconds until the specified 'value' reaches the
+    // specified 'expected' value.  Return 'true' if it did, and 'false'
+    // otherwise.
+{
+    for (int i = 0; i < 1000 && value < expected; ++i) {
+        bslmt::ThreadUtil::microSleep(10000);
+    }
+    return value >= expected;
+}
+
+bsls::Types::Uint64 threadIdOfChannel(const btlmt::ChannelPool& pool,
+                                      int                       channelId)
+    // Return the ID of the thread managing the channel having the specified
+    // 'channelId' in the specified 'pool', as reported by
+    // 'getHandleStatistics', or 0 if there is no such channel.
+{
+    bsl::vector<btlmt::ChannelPool::HandleInfo> handles;
+    pool.getHandleStatistics(&handles);
+
+    for (bsl::size_t i = 0; i < handles.size(); ++i) {
+        if (channelId == handles[i].d_channelId
+         && btlmt::ChannelType::e_LISTENING_CHANNEL
+                                               != handles[i].d_channelType) {
+            return bslmt::ThreadUtil::idAsUint64(
+                     bslmt::ThreadUtil::handleToId(handles[i].d_threadHandle));
+                                                                      // RETURN
+        }
+    }
+    return 0;
+}
+
+int setUpChannels(bsl::vector<int>                  *channelIds,
+                  btlmt::ChannelPool                *pool,
+                  PoolObserver                      *observer,
+                  const bsl::vector<ClientSocket *>& clients,
+                  ChannelData                       *data)
+    // Wait for at most 10 seconds until the specified 'observer' has recorded
+    // a channel for each of the specified 'clients' of the specified 'pool',
+    // load into the specified 'channelIds' the ID of the channel of each
+    // client, and set the context of that channel to the corresponding
+    // element of the specified 'data' array.  Return 0 on success, and a
+    // non-zero value otherwise.
+{
+    const int numClients = static_cast<int>(clients.size());
+
+    bsl::vector<int> ids;
+    for (int i = 0; i < 1000; ++i) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&observer->d_mutex);
+            ids = observer->d_channelIds;
+        }
+        if (numClients <= static_cast<int>(ids.size())) {
+            break;
+        }
+        bslmt::ThreadUtil::microSleep(10000);
+    }
+    if (numClients != static_cast<int>(ids.size())) {
+        return -1;                                                    // RETURN
+    }
+
+    channelIds->assign(numClients, -1);
+    for (int i = 0; i < numClients; ++i) {
+        btlso::IPv4Address peer;
+        if (0 != pool->getPeerAddress(&peer, ids[i])) {
+            return -2;                                                // RETURN
+        }
+        for (int j = 0; j < numClients; ++j) {
+            btlso::IPv4Address local;
+            clients[j]->localAddress(&local);
+            if (local == peer) {
+                (*channelIds)[j] = ids[i];
+                pool->setChannelContext(ids[i], &data[j]);
+            }
+        }
+    }
+
+    for (int j = 0; j < numClients; ++j) {
+        if (-1 == (*channelIds)[j]) {
+            return -3;                                                // RETURN
+        }
+    }
+    return 0;
+}
+
+bool waitForMigrations(const btlmt::ChannelPool& pool,
+                       bsls::Types::Int64        expected)
+    // Wait for at most 10 seconds until the specified 'pool' has completed
+    // the specified 'expected' number of channel migrations.  Return 'true'
+    // if it did, and 'false' otherwise.
+{
+    for (int i = 0; i < 1000 && pool.numChannelMigrations() < expected; ++i) {
+        bslmt::ThreadUtil::microSleep(10000);
+    }
+    return pool.numChannelMigrations() >= expected;
+}
+
+}  // close namespace TEST_CASE_MIGRATION
+
+//-----------------------------------------------------------------------------
+// CASE 43
+//-----------------------------------------------------------------------------
+
+namespace TEST_CASE_LOCAL_SOCKETS {
+
+enum {
+    SERVER_ID = 0x10ca,
+    CLIENT_ID = 0x10cb
+};
+
+typedef btlso::StreamSocket<btlso::LocalAddress> LocalSocket;
+
+struct Observer {
+    // This 'struct' records the channels created by a pool, along with the
+    // source (server or client) ID of each, and the connection errors it
+    // reports.
+
+    bslmt::Mutex       d_mutex;
+    bsl::map<int, int> d_sourceIds;          // channel ID -> source ID,
+                                             // guarded by 'd_mutex'
+    bsls::AtomicInt    d_numConnectErrors;
+};
+
+void channelStateCb(int       channelId,
+                    int       sourceId,
+                    int       state,
+                    void     *,
+                    Observer *observer)
+{
+    if (btlmt::ChannelPool::e_CHANNEL_UP == state) {
+        bslmt::LockGuard<bslmt::Mutex> guard(&observer->d_mutex);
+        observer->d_sourceIds[channelId] = sourceId;
+    }
+}
+
+void poolStateCb(int state, int source, int, Observer *observer)
+{
+    if (veryVerbose) {
+        MTCOUT << "Pool state callback called with"
+               << " State: " << state
+               << " Source: "  << source << MTENDL;
+    }
+
+    if (btlmt::ChannelPool::e_ERROR_CONNECTING == state) {
+        ++observer->d_numConnectErrors;
+    }
+}
+
+int waitForChannel(Observer *observer, int sourceId, int exclude = -1)
+    // Wait for at most 10 seconds until the specified 'observer' has recorded
+    // a channel having the specified 'sourceId' and an ID other than the
+    // optionally specified 'exclude'.  Return the ID of that channel, or a
+    // negative value if there is none.
+{
+    for (int i = 0; i < 1000; ++i) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&observer->d_mutex);
+
+            for (bsl::map<int, int>::const_iterator it =
+                                               observer->d_sourceIds.begin();
+                 it != observer->d_sourceIds.end();
+                 ++it) {
+                if (sourceId == it->second && exclude != it->first) {
+                    return it->first;                                 // RETURN
+                }
+            }
+        }
+        bslmt::ThreadUtil::microSleep(10000);
+    }
+    return -1;
+}
+
+bsl::string socketPath(const char *suffix)
+    // Return a path, unique to this process, for a socket of this test
+    // driver, ending with the specified 'suffix'.
+{
+    bsl::ostringstream oss;
+#ifdef BSLS_PLATFORM_OS_UNIX
+    oss << "/tmp/btlmt_channelpool.t." << ::getpid() << suffix;
+#else
+    oss << "btlmt_channelpool.t." << suffix;
+#endif
+    return oss.str();
+}
+
+
+struct BenchmarkChannel {
+    // This 'struct' holds the state of a channel used to compare the
+    // performance of local and TCP channels.
+
+    btlmt::ChannelPool *d_pool_p;        // pool managing the channel
+    bsls::AtomicInt64   d_numReceived;   // bytes received by the pool
+    bsls::AtomicBool    d_echo;          // whether to echo the data received
+};
+
+void benchmarkReadCb(int        *needed,
+                     btlb::Blob *msg,
+                     int         channelId,
+                     void       *context)
+    // Record the length of the specified 'msg' in the 'BenchmarkChannel'
+    // specified by 'context' and, if so requested, write 'msg' back to the
+    // channel having the specified 'channelId'.
+{
+    *needed = 1;
+
+    BenchmarkChannel *channel = static_cast<BenchmarkChannel *>(context);
+    if (channel) {
+        channel->d_numReceived += msg->length();
+        if (channel->d_echo) {
+            channel->d_pool_p->write(channelId, *msg);
+        }
+    }
+    msg->removeAll();
+}
+
+int listenOn(btlso::IPv4Address        *serverAddress,
+             btlmt::ChannelPool        *pool,
+             const btlso::IPv4Address&  endpoint)
+    // Open a server of the specified 'pool' on the specified 'endpoint', and
+    // load into the specified 'serverAddress' the address to connect to.
+    // Return 0 on success, and a non-zero value otherwise.
+{
+    const int rc = pool->listen(endpoint, 16, SERVER_ID);
+    if (0 == rc) {
+        *serverAddress = getServerLocalAddress(pool, SERVER_ID);
+    }
+    return rc;
+}
+
+int listenOn(btlso::LocalAddress        *serverAddress,
+             btlmt::ChannelPool         *pool,
+             const btlso::LocalAddress&  endpoint)
+    // Open a server of the specified 'pool' on the specified 'endpoint', and
+    // load into the specified 'serverAddress' the address to connect to.
+    // Return 0 on success, and a non-zero value otherwise.
+{
+    *serverAddress = endpoint;
+    return pool->listen(endpoint, 16, SERVER_ID);
+}
+
+template <class ADDRESS>
+void benchmarkTransport(const char     *name,
+                        const ADDRESS&  endpoint,
+                        int             numRoundTrips,
+                        int             messageSize,
+                        int             numBytes)
+    // Measure, on a channel of a 'btlmt::ChannelPool' listening on the
+    // specified 'endpoint', the time of the specified 'numRoundTrips' echoes
+    // of messages of the specified 'messageSize' bytes, and the time to
+    // receive the specified 'numBytes' bytes, and print them with the
+    // specified 'name' of the transport.
+{
+    Observer         observer;
+    BenchmarkChannel channel;
+
+    btlmt::ChannelPoolConfiguration config;
+    config.setMaxThreads(1);
+    config.setWriteQueueWatermarks(0, 1 << 24);
+
+    btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                          bdlf::BindUtil::bind(&channelStateCb,
+                                                               _1, _2, _3, _4,
+                                                               &observer));
+    btlmt::ChannelPool::PoolStateChangeCallback poolCb(
+                                          bdlf::BindUtil::bind(&poolStateCb,
+                                                               _1, _2, _3,
+                                                               &observer));
+    btlmt::ChannelPool::BlobBasedReadCallback dataCb(&benchmarkReadCb);
+
+    btlso::InetStreamSocketFactory<ADDRESS> factory;
+    btlso::StreamSocket<ADDRESS>           *client = 0;
+
+    bsl::vector<char> buffer(64 * 1024, 'x');
+    bsls::Stopwatch   timer;
+
+    {
+        btlmt::ChannelPool mX(channelCb, dataCb, poolCb, config);
+        channel.d_pool_p = &mX;
+
+        ASSERT(0 == mX.start());
+
+        ADDRESS serverAddress;
+        ASSERT(0 == listenOn(&serverAddress, &mX, endpoint));
+
+        client = factory.allocate();
+        ASSERT(0 == client->connect(serverAddress));
+
+        const int channelId = waitForChannel(&observer, SERVER_ID);
+        ASSERT(0 <= channelId);
+        mX.setChannelContext(channelId, &channel);
+
+        channel.d_echo = true;
+        timer.start(true);
+        for (int i = 0; i < numRoundTrips; ++i) {
+            LOOP_ASSERT(i, messageSize == client->write(&buffer[0],
+                                                        messageSize));
+            int numRead = 0;
+            while (numRead < messageSize) {
+                const int rc = client->read(&buffer[numRead],
+                                            messageSize - numRead);
+                LOOP_ASSERT(rc, 0 < rc);
+                if (rc <= 0) {
+                    break;
+                }
+                numRead += rc;
+            }
+        }
+        timer.stop();
+        const double latency = timer.accumulatedWallTime()
+                             / numRoundTrips
+                             * 1000000;
+
+        channel.d_echo        = false;
+        channel.d_numReceived = 0;
+        timer.reset();
+        timer.start(true);
+        for (int numSent = 0; numSent < numBytes;) {
+            const int length = bsl::min(numBytes - numSent,
+                                        static_cast<int>(buffer.size()));
+            const int rc = client->write(&buffer[0], length);
+            LOOP_ASSERT(rc, 0 < rc);
+            if (rc <= 0) {
+                break;
+            }
+            numSent += rc;
+        }
+        while (channel.d_numReceived < numBytes) {
+            bslmt::ThreadUtil::yield();
+        }
+        timer.stop();
+        const double seconds = timer.accumulatedWallTime();
+
+        cout << name << ":\n"
+             << "\tround trip of " << messageSize << " bytes: "
+             << latency << " us\n"
+             << "\tthroughput: "
+             << static_cast<double>(numBytes) / seconds / (1024 * 1024)
+             << " MB/s (" << seconds << " s for " << numBytes << " bytes)"
+             << endl;
+
+        ASSERT(0 == mX.stop());
+    }
+    factory.deallocate(client);
+}
+
+}  // close namespace TEST_CASE_LOCAL_SOCKETS
+
+
+// ============================================================================
+//                     GLOBAL 'class' FOR TESTING
+// ----------------------------------------------------------------------------
+
+class TestDriver {
+    // This 'class' provide a namespace for testing 'btlmt::ChannelPool's
+    // functionality.
+
+  public:
+    // TEST CASES
+    static void testCase45();
+        // Test that the blob buffers held by zero-copy writes are released
+        // even if automatic reading is disabled.
+
+    static void testCase44();
+        // Test that channels transfer data whether or not the managed threads
+        // prefer a batching socket event multiplexer.
+
+    static void testCase43();
+        // Test that channels can be established over local (Unix-domain)
+        // sockets.
+
+    static void testCase42();
+        // Test that zero-copy transmission preserves the data and releases
+        // the blob buffers.
+
+    static void testCase41();
+        // Test that channels can be migrated between threads.
+
+    static void testCase40();
+        // Test that sharded listeners are opened and reported.
+
+    static void testCase39();
+        // Test usage example.
+
+    static void testCase38();
+        // Test that the high and low watermark callbacks are always in
+        // sequence and only one of each type is outstanding at a time.
+
+    static void testCase37();
+        // Test that platform-specific errors are returned.
+
+    static void testCase36();
+        // Test the new constructor form that takes a BlobBufferFactory.
+
+    static void testCase35();
+        // Test that 'stopAndRemoveAllChannels' correctly releases all
+        // resources held by channels.
+
+    static void testCase34();
+        // Test that 'e_WRITE_QUEUE_LOWWATER' is invoked after the
+        // 'enqueueWatermark' is exceeded on the 'write'.
+
+    static void testCase33();
+        // Test that additional write statistics are reported as expected.
+
+    static void testCase32();
+        // Test that 'peerAddress' is correctly returned.
+
+    static void testCase31();
+        // Test that 'disableRead' when called from dispatcher thread stops
+        // reading from the socket.
+
+    static void testCase30();
+        // Test a queue processor implementation.
+
+    static void testCase29();
+        // Test that channel pool does not read extra data even after
+        // numNeeded is set to 0.
+
+    static void testCase28();
+        // Test that providing socket options sets the appropriate options on
+        // the socket.
+
+    static void testCase27();
+        // Test that reading into a partially filled blob works as expected.
+
+    static void testCase26();
+        // Test that blob-based 'read' works as expected.
+
+    static void testCase25();
+        // Test that the allocation of event managers works as expected.
+
+    static void testCase24();
+        // Test that the time metrics are correctly computed.
+
+    static void testCase23();
+        // Test that read operations time out correctly.
+
+    static void testCase22();
+        // Test that 'btlmt::ChannelPool_MessageUtil' class works as expected.
+
+    static void testCase21();
+        // Test that 'setWriteQueue[Hi|Low]Watermark' and
+        // 'setWriteQueueWatermarks' work as expected.
+
+    static void testCase20();
+        // Test that reading from OpenSSL sockets works as expected.
+
+    static void testCase19();
+        // Test that 'import' works under high load.
+
+    static void testCase18();
+        // Test that channel pool fails to accept connections when its file
+        // descriptor limit is reached.
+
+    static void testCase17();
+        // Test that channel pool only creates 'maxConnections' channels.
+
+    static void testCase16();
+        // Test that CHANNEL_UP and CHANNEL_DOWN callbacks are correctly
+        // delivered.
+
+    static void testCase15();
+        // Test that 'shutdown' is correctly processed from within a channel
+        // state callback.
+
+    static void testCase14();
+        // Test that the 'getHandleStatistics' returns the correct statistics.
+
+    static void testCase13();
+        // Test that 'numBytes*', 'totalBytes*' and related accessors return
+        // the right values.
+
+    static void testCase12();
+        // Test that 'reportWeightedAverageReset' works as expected.
+
+    static void testCase11();
+        // Test that HIGHWATER and LOWWATER callbacks are correctly invoked.
+
+    static void testCase10();
+        // Test that 'enableRead' and 'disableRead' work as expected.
+
+    static void testCase9();
+        // Test that 'registerClock' AND 'deregisterClock' work as expected.
+
+    static void testCase8();
+        // Test that 'writeMessage' works as expected.
+
+    static void testCase7();
+        // Test that 'shutdown' works as expected.
+
+    static void testCase6();
+        // Test that a half-closed socket pair can be correctly imported and
+        // that the channel is correctly recognized as half-closed.
+
+    static void testCase5();
+        // Test that 'import' works as expected.
+
+    static void testCase4();
+        // Test that 'listen' works as expected.
+
+    static void testCase3();
+        // Test that 'connect' works as expected.
+
+    static void testCase2();
+        // Test that 'start' and 'stop' work as expected.
+
+    static void testCase1();
+        // Breathing test.
+};
+
+
+                               // --------------
+                               // TEST APPARATUS
+                               // --------------
+
+void TestDriver::testCase45()
+{
+        // --------------------------------------------------------------------
+        // TESTING ZERO-COPY COMPLETIONS WITHOUT READING
+        //
+        // Concerns:
+        //: 1 The blob buffers held by a zero-copy write are released once the
+        //:   kernel reports the completion of the write, even if automatic
+        //:   reading is disabled for the channel, and no further data is
+        //:   written to or read from the channel.
+        //
+        // Plan:
+        //: 1 For a pool configured with a zero-copy threshold of 16KB, disable
+        //:   automatic reading for a channel, write to it a single blob
+        //:   larger than the threshold, holding a reference to one of its
+        //:   buffers, and read the blob from the client.  Then, without any
+        //:   further I/O on the channel, wait for the sum of
+        //:   'totalBytesWrittenZeroCopy' and 'totalBytesWrittenCopied' to
+        //:   reach 'totalBytesWritten', and verify that the blob buffer held
+        //:   is no longer referenced by the pool.  (C-1)
+        //
+        // Testing:
+        //   CONCERN: Zero-copy buffers are released when not reading
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ZERO-COPY COMPLETIONS WITHOUT READING"
+                          << "\n============================================="
+                          << endl;
+
+        using namespace TEST_CASE_MIGRATION;
+
+        enum {
+            THRESHOLD   = 16 * 1024,
+            BUFFER_SIZE = 8 * 1024,
+            LARGE_SIZE  = 64 * 1024
+        };
+
+        btlso::InetStreamSocketFactory<btlso::IPv4Address> factory;
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        PoolObserver observer;
+        ChannelData  data[1];
+
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(1);
+        ASSERT(0 == config.setZeroCopyThreshold(THRESHOLD));
+
+        btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                       bdlf::BindUtil::bind(&channelStateCb,
+                                                            _1, _2, _3, _4,
+                                                            &observer));
+        btlmt::ChannelPool::PoolStateChangeCallback poolCb(
+                                       bdlf::BindUtil::bind(&poolStateCb,
+                                                            _1, _2, _3,
+                                                            &observer));
+        btlmt::ChannelPool::BlobBasedReadCallback dataCb(&readCb);
+
+        btlb::PooledBlobBufferFactory bufferFactory(BUFFER_SIZE, &ta);
+        btlb::BlobBuffer              heldBuffer;
+
+        bsl::vector<ClientSocket *> clients;
+        bsl::vector<int>            ids;
+        {
+            Obj mX(channelCb, dataCb, poolCb, config, &ta);
+            const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.listen(getLocalAddress(), 128, SERVER_ID));
+
+            ASSERT(1 == TEST_CASE_REUSE_PORT::connectClients(
+                                        &clients,
+                                        &factory,
+                                        getServerLocalAddress(&mX, SERVER_ID),
+                                        1));
+            ASSERT(0 == setUpChannels(&ids, &mX, &observer, clients, data));
+
+            // Let the dispatcher thread disable reading before writing.
+
+            ASSERT(0 == mX.disableRead(ids[0]));
+            bslmt::ThreadUtil::microSleep(100000);
+
+            char buffer[LARGE_SIZE];
+            for (int i = 0; i < LARGE_SIZE; ++i) {
+                buffer[i] = static_cast<char>(i % k_MODULUS);
+            }
+
+            {
+                btlb::Blob blob(&bufferFactory, &ta);
+                btlb::BlobUtil::append(&blob, buffer, LARGE_SIZE);
+                heldBuffer = blob.buffer(0);
+                ASSERT(0 == mX.write(ids[0], blob));
+            }
+
+            bsls::Types::Int64 numRead = 0;
+            ASSERT(0 == receivePattern(clients[0], &numRead, LARGE_SIZE));
+            LOOP_ASSERT(numRead, LARGE_SIZE == numRead);
+
+            bsls::Types::Int64 total    = 0;
+            bsls::Types::Int64 zeroCopy = 0;
+            bsls::Types::Int64 copied   = 0;
+            for (int i = 0; i < 1000; ++i) {
+                X.totalBytesWritten(&total);
+                X.totalBytesWrittenZeroCopy(&zeroCopy);
+                X.totalBytesWrittenCopied(&copied);
+                if (LARGE_SIZE == total
+                 && total == zeroCopy + copied
+                 && 1 == heldBuffer.buffer().use_count()) {
+                    break;
+                }
+                bslmt::ThreadUtil::microSleep(10000);
+            }
+            if (verbose) { P_(total) P_(zeroCopy) P(copied) }
+
+            LOOP_ASSERT(total, LARGE_SIZE == total);
+            LOOP3_ASSERT(total, zeroCopy, copied, total == zeroCopy + copied);
+            LOOP_ASSERT(heldBuffer.buffer().use_count(),
+                        1 == heldBuffer.buffer().use_count());
+
+            ASSERT(0 == mX.stop());
+        }
+
+        for (int i = 0; i < (int)clients.size(); ++i) {
+            factory.deallocate(clients[i]);
+        }
+}
+
+void TestDriver::testCase44()
+{
+        // --------------------------------------------------------------------
+        // TESTING 'batchSubmission'
+        //
+        // Concerns:
+        //: 1 Whether or not the 'batchSubmission' attribute of the
+        //:   configuration is set, data is transferred in order, and without
+        //:   loss, in both directions of the channels of the pool.
+        //:
+        //: 2 Data enqueued while the peer is not reading (i.e., while the
+        //:   channel is registered for WRITE events) is eventually written.
+        //
+        // Plan:
+        //: 1 For each value of 'batchSubmission', create a pool managing two
+        //:   threads and connect two clients to it.  Send the test pattern
+        //:   from each client to the pool, and verify the data received.
+        //:   (C-1)
+        //:
+        //: 2 Enqueue the test pattern for writing to each channel before the
+        //:   clients read anything, then read it from each client and verify
+        //:   it.  (C-1..2)
+        //
+        // Testing:
+        //   CONCERN: 'batchSubmission' pools transfer data
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING 'batchSubmission'"
+                          << "\n=========================" << endl;
+
+        using namespace TEST_CASE_MIGRATION;
+
+        enum {
+            NUM_CLIENTS = 2,
+            NUM_BYTES   = 1024 * 1024,
+            CHUNK_SIZE  = 1000
+        };
+
+        btlso::InetStreamSocketFactory<btlso::IPv4Address> factory;
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int batch = 0; batch < 2; ++batch) {
+            const bool BATCH_SUBMISSION = batch;
+
+            if (verbose) { P(BATCH_SUBMISSION); }
+
+            PoolObserver observer;
+            ChannelData  data[NUM_CLIENTS];
+
+            btlmt::ChannelPoolConfiguration config;
+            config.setMaxThreads(NUM_CLIENTS);
+            config.setWriteQueueWatermarks(0, 1 << 26);
+            ASSERT(0 == config.setBatchSubmission(BATCH_SUBMISSION));
+
+            btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                       bdlf::BindUtil::bind(&channelStateCb,
+                                                            _1, _2, _3, _4,
+                                                            &observer));
+            btlmt::ChannelPool::PoolStateChangeCallback poolCb(
+                                       bdlf::BindUtil::bind(&poolStateCb,
+                                                            _1, _2, _3,
+                                                            &observer));
+            btlmt::ChannelPool::BlobBasedReadCallback dataCb(&readCb);
+
+            bsl::vector<ClientSocket *> clients;
+            bsl::vector<int>            ids;
+            {
+                Obj mX(channelCb, dataCb, poolCb, config, &ta);
+
+                ASSERT(0 == mX.start());
+                ASSERT(0 == mX.listen(getLocalAddress(), 128, SERVER_ID));
+
+                ASSERT(NUM_CLIENTS == TEST_CASE_REUSE_PORT::connectClients(
+                                        &clients,
+                                        &factory,
+                                        getServerLocalAddress(&mX, SERVER_ID),
+                                        NUM_CLIENTS));
+                ASSERT(0 == setUpChannels(&ids,
+                                          &mX,
+                                          &observer,
+                                          clients,
+                                          data));
+
+                for (int i = 0; i < NUM_CLIENTS; ++i) {
+                    bsls::Types::Int64 numSent = 0;
+                    sendPattern(clients[i], &numSent, NUM_BYTES);
+                    LOOP2_ASSERT(BATCH_SUBMISSION, i, NUM_BYTES == numSent);
+                }
+                for (int i = 0; i < NUM_CLIENTS; ++i) {
+                    LOOP2_ASSERT(BATCH_SUBMISSION, i,
+                                 waitFor(data[i].d_numReceived, NUM_BYTES));
+                    LOOP3_ASSERT(BATCH_SUBMISSION, i,
+                                 data[i].d_numReceived.load(),
+                                 NUM_BYTES == data[i].d_numReceived);
+                    LOOP3_ASSERT(BATCH_SUBMISSION, i,
+                                 data[i].d_numErrors.load(),
+                                 0 == data[i].d_numErrors);
+                }
+
+                bsls::Types::Int64 numWritten[NUM_CLIENTS] = { 0, 0 };
+                for (int i = 0; i < NUM_CLIENTS; ++i) {
+                    while (numWritten[i] < NUM_BYTES) {
+                        writePattern(&mX, ids[i], &numWritten[i], CHUNK_SIZE);
+                    }
+                }
+                for (int i = 0; i < NUM_CLIENTS; ++i) {
+                    bsls::Types::Int64 numRead = 0;
+                    LOOP2_ASSERT(BATCH_SUBMISSION, i,
+                                 0 == receivePattern(clients[i],
+                                                     &numRead,
+                                                     numWritten[i]));
+                    LOOP3_ASSERT(BATCH_SUBMISSION, i, numRead,
+                                 numWritten[i] == numRead);
+                }
+
+                ASSERT(0 == mX.stop());
+            }
+
+            for (int i = 0; i < (int)clients.size(); ++i) {
+                factory.deallocate(clients[i]);
+            }
+        }
+}
+
+void TestDriver::testCase43()
+{
+        // --------------------------------------------------------------------
+        // TESTING LOCAL (UNIX-DOMAIN) CHANNELS
+        //
+        // Concerns:
+        //: 1 'listen' on a 'btlso::LocalAddress' creates a server that accepts
+        //:   connections from local stream sockets, and a second server
+        //:   cannot listen on the same path.
+        //:
+        //: 2 Data is transferred in order, and without loss, in both
+        //:   directions of an accepted local channel.
+        //:
+        //: 3 'connect' to a 'btlso::LocalAddress' establishes a channel to a
+        //:   local server, and data written to it is received by the peer.
+        //:
+        //: 4 The local and peer addresses of a local channel, and the address
+        //:   of a local server, are reported as a default
+        //:   'btlso::IPv4Address'.
+        //:
+        //: 5 'connect' to a path on which no server listens reports
+        //:   'e_ERROR_CONNECTING' once all attempts have failed.
+        //
+        // Plan:
+        //: 1 Listen on a path unique to this process, and verify that the
+        //:   server address is the default 'btlso::IPv4Address'.  Verify that
+        //:   listening again on the same path fails.  (C-1, 4)
+        //:
+        //: 2 Connect a local client socket to the server, and send the test
+        //:   pattern from the client to the pool, then from the pool to the
+        //:   client.  Verify the data received, and the addresses of the
+        //:   channel.  (C-1..2, 4)
+        //:
+        //: 3 Connect the pool to its own server, write the test pattern to
+        //:   the connected channel, and verify that it is received by the
+        //:   accepted channel.  (C-3)
+        //:
+        //: 4 Connect the pool to a path on which no server listens, and wait
+        //:   for the pool state callback to report the error.  (C-5)
+        //
+        // Testing:
+        //   CONCERN: Local (Unix-domain) channels transfer data
+        //   int listen(const LocalAddress&, int, int, bool, mode, int *);
+        //   int connect(const LocalAddress&, int, const TimeInterval&, ...);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING LOCAL (UNIX-DOMAIN) CHANNELS"
+                          << "\n====================================" << endl;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        using namespace TEST_CASE_MIGRATION;
+        namespace TC = TEST_CASE_LOCAL_SOCKETS;
+
+        enum { NUM_BYTES = 256 * 1024, CHUNK_SIZE = 1000 };
+
+        const bsl::string PATH    = TC::socketPath(".sock");
+        const bsl::string MISSING = TC::socketPath(".missing");
+        ::unlink(PATH.c_str());
+        ::unlink(MISSING.c_str());
+
+        const btlso::LocalAddress ADDRESS(PATH.c_str());
+        const btlso::IPv4Address  DEFAULT_ADDRESS;
+
+        btlso::InetStreamSocketFactory<btlso::LocalAddress> factory;
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        TC::Observer observer;
+        ChannelData  serverData;
+        ChannelData  acceptedData;
+
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(2);
+        config.setWriteQueueWatermarks(0, 1 << 24);
+
+        btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                      bdlf::BindUtil::bind(&TC::channelStateCb,
+                                                           _1, _2, _3, _4,
+                                                           &observer));
+        btlmt::ChannelPool::PoolStateChangeCallback poolCb(
+                                      bdlf::BindUtil::bind(&TC::poolStateCb,
+                                                           _1, _2, _3,
+                                                           &observer));
+        btlmt::ChannelPool::BlobBasedReadCallback dataCb(&readCb);
+
+        TC::LocalSocket *client = 0;
+        {
+            Obj mX(channelCb, dataCb, poolCb, config, &ta);
+            const Obj& X = mX;
+
+            ASSERT(0 == mX.start());
+
+            if (verbose) cout << "\tListening on a local address.\n";
+
+            ASSERT(0 == mX.listen(ADDRESS, 16, TC::SERVER_ID));
+
+            btlso::IPv4Address serverAddress(getLocalAddress());
+            ASSERT(0 == X.getServerAddress(&serverAddress, TC::SERVER_ID));
+            LOOP_ASSERT(serverAddress, DEFAULT_ADDRESS == serverAddress);
+
+            int platformError = 0;
+            ASSERT(0 != mX.listen(ADDRESS,
+                                  16,
+                                  TC::SERVER_ID + 2,
+                                  true,
+                                  btlmt::ChannelPool::e_CLOSE_BOTH,
+                                  &platformError));
+            if (verbose) { P(platformError); }
+
+            if (verbose) cout << "\tExchanging data with a local client.\n";
+
+            client = factory.allocate();
+            ASSERT(client);
+            ASSERT(0 == client->connect(ADDRESS));
+
+            const int serverChannelId = TC::waitForChannel(&observer,
+                                                           TC::SERVER_ID);
+            ASSERT(0 <= serverChannelId);
+            mX.setChannelContext(serverChannelId, &serverData);
+
+            btlso::IPv4Address address(getLocalAddress());
+            ASSERT(0 == X.getPeerAddress(&address, serverChannelId));
+            LOOP_ASSERT(address, DEFAULT_ADDRESS == address);
+
+            address = getLocalAddress();
+            ASSERT(0 == X.getLocalAddress(&address, serverChannelId));
+            LOOP_ASSERT(address, DEFAULT_ADDRESS == address);
+
+            bsls::Types::Int64 numSent = 0;
+            sendPattern(client, &numSent, NUM_BYTES);
+            ASSERT(NUM_BYTES == numSent);
+            ASSERT(waitFor(serverData.d_numReceived, NUM_BYTES));
+            LOOP_ASSERT(serverData.d_numReceived.load(),
+                        NUM_BYTES == serverData.d_numReceived);
+            LOOP_ASSERT(serverData.d_numErrors.load(),
+                        0 == serverData.d_numErrors);
+
+            bsls::Types::Int64 numWritten = 0;
+            while (numWritten < NUM_BYTES) {
+                writePattern(&mX, serverChannelId, &numWritten, CHUNK_SIZE);
+            }
+
+            bsls::Types::Int64 numRead = 0;
+            ASSERT(0 == receivePattern(client, &numRead, numWritten));
+            LOOP2_ASSERT(numRead, numWritten, numWritten == numRead);
+
+            if (verbose) cout << "\tConnecting to a local server.\n";
+
+            ASSERT(0 == mX.connect(ADDRESS,
+                                   1,
+                                   bsls::TimeInterval(0.1),
+                                   TC::CLIENT_ID));
+
+            const int clientChannelId = TC::waitForChannel(&observer,
+                                                           TC::CLIENT_ID);
+            ASSERT(0 <= clientChannelId);
+
+            const int acceptedChannelId = TC::waitForChannel(&observer,
+                                                             TC::SERVER_ID,
+                                                             serverChannelId);
+            ASSERT(0 <= acceptedChannelId);
+            mX.setChannelContext(acceptedChannelId, &acceptedData);
+
+            numWritten = 0;
+            while (numWritten < NUM_BYTES) {
+                writePattern(&mX, clientChannelId, &numWritten, CHUNK_SIZE);
+            }
+            ASSERT(waitFor(acceptedData.d_numReceived, numWritten));
+            LOOP2_ASSERT(numWritten, acceptedData.d_numReceived.load(),
+                         numWritten == acceptedData.d_numReceived);
+            LOOP_ASSERT(acceptedData.d_numErrors.load(),
+                        0 == acceptedData.d_numErrors);
+
+            if (verbose) cout << "\tConnecting to a missing server.\n";
+
+            ASSERT(0 == mX.connect(btlso::LocalAddress(MISSING.c_str()),
+                                   2,
+                                   bsls::TimeInterval(0.01),
+                                   TC::CLIENT_ID + 1));
+            for (int i = 0; i < 1000 && 0 == observer.d_numConnectErrors;
+                                                                        ++i) {
+                bslmt::ThreadUtil::microSleep(10000);
+            }
+            LOOP_ASSERT(observer.d_numConnectErrors.load(),
+                        1 == observer.d_numConnectErrors);
+
+            ASSERT(0 == mX.stop());
+        }
+        factory.deallocate(client);
+
+        ::unlink(PATH.c_str());
+#else
+        if (verbose) cout << "\tLocal sockets are not supported.\n";
+#endif
+}
+
+void TestDriver::testCase42()
+{
+        // --------------------------------------------------------------------
+        // TESTING ZERO-COPY TRANSMISSION
+        //
+        // Concerns:
+        //: 1 If the 'zeroCopyThreshold' attribute of the configuration is
+        //:   positive, the data written to a channel is received in order,
+        //:   and without loss.
+        //:
+        //: 2 The blob buffers of the messages written are released once the
+        //:   kernel reports that it no longer needs them.
+        //:
+        //: 3 Every byte written is eventually counted by either
+        //:   'totalBytesWrittenZeroCopy' or 'totalBytesWrittenCopied'.
+        //:
+        //: 4 Writes smaller than the threshold, and writes of 'btls::Iovec'
+        //:   arrays, are copied.
+        //:
+        //: 5 If the 'zeroCopyThreshold' attribute of the configuration is 0,
+        //:   every byte written is copied.
+        //
+        // Plan:
+        //: 1 For a pool configured with a threshold of 16KB, and for one
+        //:   configured with a threshold of 0, write a byte pattern to a
+        //:   channel, alternating large blobs, small blobs, and 'btls::Iovec'
+        //:   arrays, while the client is not reading, so that the writes are
+        //:   enqueued.  Hold a reference to one of the blob buffers written.
+        //:   (C-1..5)
+        //:
+        //: 2 Read the pattern from the client and verify it.  Then wait for
+        //:   the sum of 'totalBytesWrittenZeroCopy' and
+        //:   'totalBytesWrittenCopied' to reach 'totalBytesWritten', and
+        //:   verify that the blob buffer held is no longer referenced by the
+        //:   pool.  (C-1..5)
+        //
+        // Testing:
+        //   CONCERN: Zero-copy transmission holds and releases blob buffers
+        //   void totalBytesWrittenZeroCopy(bsls::Types::Int64 *) const;
+        //   void totalBytesWrittenCopied(bsls::Types::Int64 *) const;
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING ZERO-COPY TRANSMISSION"
+                          << "\n==============================" << endl;
+
+        using namespace TEST_CASE_MIGRATION;
+
+        enum {
+            THRESHOLD   = 16 * 1024,
+            BUFFER_SIZE = 8 * 1024,
+            LARGE_SIZE  = 64 * 1024,   // size of the large blobs
+            SMALL_SIZE  = 1000,        // size of the small blobs and arrays
+            NUM_ROUNDS  = 64
+        };
+
+        const int THRESHOLDS[] = { THRESHOLD, 0 };
+        const int NUM_THRESHOLDS = sizeof THRESHOLDS / sizeof *THRESHOLDS;
+
+        btlso::InetStreamSocketFactory<btlso::IPv4Address> factory;
+        bslma::TestAllocator ta(veryVeryVerbose);
+
+        for (int ti = 0; ti < NUM_THRESHOLDS; ++ti) {
+            const int ZERO_COPY_THRESHOLD = THRESHOLDS[ti];
+
+            if (verbose) { P(ZERO_COPY_THRESHOLD); }
+
+            PoolObserver observer;
+            ChannelData  data[1];
+
+            btlmt::ChannelPoolConfiguration config;
+            config.setMaxThreads(1);
+            config.setWriteQueueWatermarks(0, 1 << 26);
+            ASSERT(0 == config.setZeroCopyThreshold(ZERO_COPY_THRESHOLD));
+
+            btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                       bdlf::BindUtil::bind(&channelStateCb,
+                                                            _1, _2, _3, _4,
+                                                            &observer));
+            btlmt::ChannelPool::PoolStateChangeCallback poolCb(
+                                       bdlf::BindUtil::bind(&poolStateCb,
+                                                            _1, _2, _3,
+                                                            &observer));
+            btlmt::ChannelPool::BlobBasedReadCallback dataCb(&readCb);
+
+            btlb::PooledBlobBufferFactory bufferFactory(BUFFER_SIZE, &ta);
+            btlb::BlobBuffer              heldBuffer;
+
+            bsl::vector<ClientSocket *> clients;
+            bsl::vector<int>            ids;
+            {
+                Obj mX(channelCb, dataCb, poolCb, config, &ta);
+                const Obj& X = mX;
+
+                ASSERT(0 == mX.start());
+                ASSERT(0 == mX.listen(getLocalAddress(), 128, SERVER_ID));
+
+                ASSERT(1 == TEST_CASE_REUSE_PORT::connectClients(
+                                        &clients,
+                                        &factory,
+                                        getServerLocalAddress(&mX, SERVER_ID),
+                                        1));
+                ASSERT(0 == setUpChannels(&ids,
+                                          &mX,
+                                          &observer,
+                                          clients,
+                                          data));
+
+                bsls::Types::Int64 numWritten = 0;
+                char               buffer[LARGE_SIZE];
+
+                for (int round = 0; round < NUM_ROUNDS; ++round) {
+                    for (int i = 0; i < LARGE_SIZE; ++i) {
+                        buffer[i] = static_cast<char>(
+                                                (numWritten + i) % k_MODULUS);
+                    }
+
+                    btlb::Blob large(&bufferFactory, &ta);
+                    btlb::BlobUtil::append(&large, buffer, LARGE_SIZE);
+                    if (0 == round) {
+                        heldBuffer = large.buffer(0);
+                    }
+                    LOOP_ASSERT(round, 0 == mX.write(ids[0], large));
+                    numWritten += LARGE_SIZE;
+
+                    for (int i = 0; i < SMALL_SIZE; ++i) {
+                        buffer[i] = static_cast<char>(
+                                                (numWritten + i) % k_MODULUS);
+                    }
+
+                    btlb::Blob small(&bufferFactory, &ta);
+                    btlb::BlobUtil::append(&small, buffer, SMALL_SIZE);
+                    LOOP_ASSERT(round, 0 == mX.write(ids[0], small));
+                    numWritten += SMALL_SIZE;
+
+                    for (int i = 0; i < SMALL_SIZE; ++i) {
+                        buffer[i] = static_cast<char>(
+                                                (numWritten + i) % k_MODULUS);
+                    }
+
+                    btls::Iovec vec(buffer, SMALL_SIZE);
+                    LOOP_ASSERT(round, 0 == mX.write(ids[0], &vec, 1));
+                    numWritten += SMALL_SIZE;
+                }
+
+                bsls::Types::Int64 numRead = 0;
+                ASSERT(0 == receivePattern(clients[0], &numRead, numWritten));
+                LOOP2_ASSERT(numRead, numWritten, numWritten == numRead);
+
+                bsls::Types::Int64 total    = 0;
+                bsls::Types::Int64 zeroCopy = 0;
+                bsls::Types::Int64 copied   = 0;
+                for (int i = 0; i < 1000; ++i) {
+                    X.totalBytesWritten(&total);
+                    X.totalBytesWrittenZeroCopy(&zeroCopy);
+                    X.totalBytesWrittenCopied(&copied);
+                    if (numWritten == total && total == zeroCopy + copied) {
+                        break;
+                    }
+                    bslmt::ThreadUtil::microSleep(10000);
+                }
+                if (verbose) { P_(total) P_(zeroCopy) P(copied) }
+
+                LOOP2_ASSERT(numWritten, total, numWritten == total);
+                LOOP3_ASSERT(total, zeroCopy, copied,
+                             total == zeroCopy + copied);
+                LOOP2_ASSERT(ZERO_COPY_THRESHOLD, zeroCopy,
+                             0 != ZERO_COPY_THRESHOLD || 0 == zeroCopy);
+
+                // The small writes and the arrays are always copied.
+
+                LOOP_ASSERT(copied, 2 * NUM_ROUNDS * SMALL_SIZE <= copied);
+
+                LOOP_ASSERT(heldBuffer.buffer().use_count(),
+                            1 == heldBuffer.buffer().use_count());
+
+                ASSERT(0 == mX.stop());
+            }
+
+            for (int i = 0; i < (int)clients.size(); ++i) {
+                factory.deallocate(clients[i]);
+            }
+        }
+}
+
+void TestDriver::testCase41()
+{
+        // --------------------------------------------------------------------
+        // TESTING CHANNEL MIGRATION
+        //
+        // Concerns:
+        //: 1 'migrateChannel' moves a channel to the specified thread: after
+        //:   the migration completes, the data callbacks of the channel are
+        //:   invoked in that thread, which is reported by
+        //:   'getHandleStatistics'.
+        //:
+        //: 2 Incoming data is delivered in order, and without loss, while
+        //:   the channel is repeatedly migrated, and the callbacks of a
+        //:   channel are never invoked concurrently.
+        //:
+        //: 3 Data enqueued for writing is written in order, and without loss,
+        //:   while the channel is repeatedly migrated.
+        //:
+        //: 4 Each completed migration is counted by 'numChannelMigrations'
+        //:   and reported to the pool state callback.
+        //:
+        //: 5 'migrateChannel' fails for an unknown channel, an invalid thread
+        //:   index, or the thread already managing the channel.
+        //:
+        //: 6 'rebalanceChannels' migrates a channel from a saturated thread to
+        //:   an idle one, unless the threshold is not exceeded.
+        //:
+        //: 7 If the 'migrationThreshold' attribute of the configuration is
+        //:   positive, channels are rebalanced at each metrics interval.
+        //
+        // Plan:
+        //: 1 Connect a few clients to a pool managing three threads, and let
+        //:   them stream a known byte pattern while the test thread migrates
+        //:   their channels in turn to every thread.  Verify that the data
+        //:   callbacks receive the pattern in sequence, and never overlap.
+        //:   (C-2, 4)
+        //:
+        //: 2 Migrate each channel to a given thread, send one more byte on
+        //:   each client, and verify the thread of the data callbacks against
+        //:   the one reported by 'getHandleStatistics'.  Verify the failure
+        //:   modes of 'migrateChannel'.  (C-1, 5)
+        //:
+        //: 3 Enqueue the byte pattern for writing on each channel, while the
+        //:   clients are not reading, migrating the channels periodically.
+        //:   Then read it from the clients and verify it.  (C-3)
+        //:
+        //: 4 Migrate all the channels to one thread, and make the data
+        //:   callback busy-wait while the clients stream data.  Verify that
+        //:   'rebalanceChannels' does not migrate a channel with a threshold
+        //:   of 100, and does with a threshold of 10.  (C-6)
+        //:
+        //: 5 Repeat P-4 with a pool configured with a migration threshold and
+        //:   a short metrics interval, and wait for a migration.  (C-7)
+        //
+        // Testing:
+        //   CONCERN: Channel migration preserves ordering and state
+        //   int migrateChannel(int channelId, int threadIndex);
+        //   int rebalanceChannels(int threshold);
+        //   bsls::Types::Int64 numChannelMigrations() const;
+        // --------------------------------------------------------------------
 
-// ============================================================================
-//                     GLOBAL 'class' FOR TESTING
-// ----------------------------------------------------------------------------
+        if (verbose) cout << "\nTESTING CHANNEL MIGRATION"
+                          << "\n=========================" << endl;
 
-class TestDriver {
-    // This 'class' provide a namespace for testing 'btlmt::ChannelPool's
-    // functionality.
+        using namespace TEST_CASE_MIGRATION;
 
-  public:
-    // TEST CASES
-    static void testCase39();
-        // Test usage example.
+        enum {
+            NUM_THREADS  = 3,
+            NUM_CLIENTS  = 4,
+            BLOB_SIZE    = 1024,
+            NUM_BLOBS    = 4096      // written to each channel
+        };
 
-    static void testCase38();
-        // Test that the high and low watermark callbacks are always in
-        // sequence and only one of each type is outstanding at a time.
+        const int NUM_BYTES = 1 << 22;  // streamed by each client
 
-    static void testCase37();
-        // Test that platform-specific errors are returned.
+        btlso::InetStreamSocketFactory<btlso::IPv4Address> factory;
+        bslma::TestAllocator ta(veryVeryVerbose);
 
-    static void testCase36();
-        // Test the new constructor form that takes a BlobBufferFactory.
+        PoolObserver observer;
+        ChannelData  data[NUM_CLIENTS];
 
-    static void testCase35();
-        // Test that 'stopAndRemoveAllChannels' correctly releases all
-        // resources held by channels.
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(NUM_THREADS);
+        config.setMaxConnections(4 * NUM_CLIENTS);
+        config.setMetricsInterval(0.5);
+        config.setWriteQueueWatermarks(0, 1 << 26);
 
-    static void testCase34();
-        // Test that 'e_WRITE_QUEUE_LOWWATER' is invoked after the
-        // 'enqueueWatermark' is exceeded on the 'write'.
+        btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                       bdlf::BindUtil::bind(&channelStateCb,
+                                                            _1, _2, _3, _4,
+                                                            &observer));
+        btlmt::ChannelPool::PoolStateChangeCallback poolCb(
+                                       bdlf::BindUtil::bind(&poolStateCb,
+                                                            _1, _2, _3,
+                                                            &observer));
+        btlmt::ChannelPool::BlobBasedReadCallback dataCb(&readCb);
+
+        bsl::vector<ClientSocket *> clients;
+        bsl::vector<int>            ids;
+        bsls::Types::Int64          numSent[NUM_CLIENTS] = { 0 };
+        bsls::Types::Int64          numWritten[NUM_CLIENTS] = { 0 };
+        bsls::Types::Int64          numRead[NUM_CLIENTS] = { 0 };
+        bslmt::ThreadUtil::Handle   senders[NUM_CLIENTS];
+        {
+            Obj mX(channelCb, dataCb, poolCb, config, &ta);
+            const Obj& X = mX;
 
-    static void testCase33();
-        // Test that additional write statistics are reported as expected.
+            ASSERT(0 == mX.start());
+            ASSERT(0 == mX.listen(getLocalAddress(), 128, SERVER_ID));
+
+            ASSERT(NUM_CLIENTS == TEST_CASE_REUSE_PORT::connectClients(
+                                        &clients,
+                                        &factory,
+                                        getServerLocalAddress(&mX, SERVER_ID),
+                                        NUM_CLIENTS));
+            ASSERT(0 == setUpChannels(&ids, &mX, &observer, clients, data));
+            ASSERT(0 == X.numChannelMigrations());
+
+            if (verbose) cout << "\tMigrating while reading.\n";
+
+            for (int i = 0; i < NUM_CLIENTS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                    &senders[i],
+                                    bdlf::BindUtil::bind(
+                                                    &sendPattern<ClientSocket>,
+                                                    clients[i],
+                                                    &numSent[i],
+                                                    NUM_BYTES)));
+            }
 
-    static void testCase32();
-        // Test that 'peerAddress' is correctly returned.
+            bsls::Types::Int64 numInitiated = 0;
+            for (int round = 0; round < 5000; ++round) {
+                bool done = true;
+                for (int i = 0; i < NUM_CLIENTS; ++i) {
+                    if (0 == mX.migrateChannel(ids[i],
+                                               (round + i) % NUM_THREADS)) {
+                        ++numInitiated;
+                    }
+                    done = done && NUM_BYTES <= data[i].d_numReceived;
+                }
+                if (done) {
+                    break;
+                }
+                bslmt::ThreadUtil::microSleep(2000);
+            }
 
-    static void testCase31();
-        // Test that 'disableRead' when called from dispatcher thread stops
-        // reading from the socket.
+            for (int i = 0; i < NUM_CLIENTS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(senders[i]));
+                LOOP_ASSERT(i, waitFor(data[i].d_numReceived, NUM_BYTES));
+                LOOP2_ASSERT(i, data[i].d_numReceived,
+                             NUM_BYTES == data[i].d_numReceived);
+                LOOP2_ASSERT(i, data[i].d_numErrors,
+                             0 == data[i].d_numErrors);
+                LOOP2_ASSERT(i, data[i].d_numOverlaps,
+                             0 == data[i].d_numOverlaps);
+            }
 
-    static void testCase30();
-        // Test a queue processor implementation.
+            ASSERT(waitForMigrations(X, numInitiated));
+            LOOP2_ASSERT(numInitiated, X.numChannelMigrations(),
+                         numInitiated == X.numChannelMigrations());
+            LOOP_ASSERT(numInitiated, NUM_CLIENTS < numInitiated);
+            LOOP2_ASSERT(observer.d_numMigratedEvents,
+                         X.numChannelMigrations(),
+                         observer.d_numMigratedEvents
+                                                 == X.numChannelMigrations());
+            if (verbose) { P(numInitiated); }
+
+            if (verbose) cout << "\tMigrating to a given thread.\n";
+
+            for (int i = 0; i < NUM_CLIENTS; ++i) {
+                if (0 == mX.migrateChannel(ids[i], i % NUM_THREADS)) {
+                    ++numInitiated;
+                }
+            }
+            ASSERT(waitForMigrations(X, numInitiated));
+
+            bsls::Types::Uint64 threadIds[NUM_CLIENTS];
+            for (int i = 0; i < NUM_CLIENTS; ++i) {
+                sendPattern(clients[i], &numSent[i], 1);
+                LOOP_ASSERT(i, waitFor(data[i].d_numReceived, NUM_BYTES + 1));
+
+                threadIds[i] = threadIdOfChannel(X, ids[i]);
+                const bsls::Types::Uint64 callbackThreadId =
+                     static_cast<bsls::Types::Uint64>(data[i].d_threadId);
+                LOOP3_ASSERT(i, threadIds[i], callbackThreadId,
+                             threadIds[i] == callbackThreadId);
+
+                for (int j = 0; j < i; ++j) {
+                    const bool sameIndex = i % NUM_THREADS
+                                                         == j % NUM_THREADS;
+                    LOOP2_ASSERT(i, j,
+                                 sameIndex == (threadIds[i] == threadIds[j]));
+                }
 
-    static void testCase29();
-        // Test that channel pool does not read extra data even after
-        // numNeeded is set to 0.
+                LOOP_ASSERT(i, 0 != mX.migrateChannel(ids[i],
+                                                      i % NUM_THREADS));
+                LOOP_ASSERT(i, 0 != mX.migrateChannel(ids[i], -1));
+                LOOP_ASSERT(i, 0 != mX.migrateChannel(ids[i], NUM_THREADS));
+            }
+            ASSERT(0 != mX.migrateChannel(0x7FFFFFFF, 0));
 
-    static void testCase28();
-        // Test that providing socket options sets the appropriate options on
-        // the socket.
+            if (verbose) cout << "\tMigrating while writing.\n";
 
-    static void testCase27();
-        // Test that reading into a partially filled blob works as expected.
+            for (int k = 0; k < NUM_BLOBS; ++k) {
+                for (int i = 0; i < NUM_CLIENTS; ++i) {
+                    writePattern(&mX, ids[i], &numWritten[i], BLOB_SIZE);
+                    if (0 == k % 64
+                     && 0 == mX.migrateChannel(ids[i],
+                                               (k / 64 + i) % NUM_THREADS)) {
+                        ++numInitiated;
+                    }
+                }
+            }
 
-    static void testCase26();
-        // Test that blob-based 'read' works as expected.
+            for (int i = 0; i < NUM_CLIENTS; ++i) {
+                LOOP_ASSERT(i, 0 == receivePattern(clients[i],
+                                                   &numRead[i],
+                                                   numWritten[i]));
+                LOOP2_ASSERT(i, numRead[i],
+                             NUM_BLOBS * BLOB_SIZE == numRead[i]);
+            }
+            ASSERT(waitForMigrations(X, numInitiated));
 
-    static void testCase25();
-        // Test that the allocation of event managers works as expected.
+            if (verbose) cout << "\tRebalancing channels.\n";
 
-    static void testCase24();
-        // Test that the time metrics are correctly computed.
+            for (int i = 0; i < NUM_CLIENTS; ++i) {
+                if (0 == mX.migrateChannel(ids[i], 0)) {
+                    ++numInitiated;
+                }
+            }
+            ASSERT(waitForMigrations(X, numInitiated));
+            ASSERT(0 == mX.rebalanceChannels(100));
+
+            s_spinMicroseconds = 1000;
+
+            for (int i = 0; i < NUM_CLIENTS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::create(
+                                    &senders[i],
+                                    bdlf::BindUtil::bind(
+                                                    &sendPattern<ClientSocket>,
+                                                    clients[i],
+                                                    &numSent[i],
+                                                    NUM_BYTES)));
+            }
 
-    static void testCase23();
-        // Test that read operations time out correctly.
+            int numRebalanced = 0;
+            for (int i = 0; i < 100 && 0 == numRebalanced; ++i) {
+                bslmt::ThreadUtil::microSleep(100000);
+                numRebalanced = mX.rebalanceChannels(10);
+            }
+            ASSERT(1 == numRebalanced);
+            ASSERT(waitForMigrations(X, numInitiated + numRebalanced));
+
+            s_spinMicroseconds = 0;
+
+            for (int i = 0; i < NUM_CLIENTS; ++i) {
+                ASSERT(0 == bslmt::ThreadUtil::join(senders[i]));
+                LOOP_ASSERT(i, waitFor(data[i].d_numReceived, numSent[i]));
+                LOOP2_ASSERT(i, data[i].d_numErrors,
+                             0 == data[i].d_numErrors);
+                LOOP2_ASSERT(i, data[i].d_numOverlaps,
+                             0 == data[i].d_numOverlaps);
+            }
 
-    static void testCase22();
-        // Test that 'btlmt::ChannelPool_MessageUtil' class works as expected.
+            ASSERT(0 == mX.stop());
+        }
 
-    static void testCase21();
-        // Test that 'setWriteQueue[Hi|Low]Watermark' and
-        // 'setWriteQueueWatermarks' work as expected.
+        for (int i = 0; i < (int)clients.size(); ++i) {
+            factory.deallocate(clients[i]);
+        }
 
-    static void testCase20();
-        // Test that reading from OpenSSL sockets works as expected.
+        if (verbose) cout << "\tAutomatic rebalancing.\n";
+        {
+            enum { NUM_AUTO_CLIENTS = 2 };
 
-    static void testCase19();
-        // Test that 'import' works under high load.
+            PoolObserver autoObserver;
+            ChannelData  autoData[NUM_AUTO_CLIENTS];
 
-    static void testCase18();
-        // Test that channel pool fails to accept connections when its file
-        // descriptor limit is reached.
+            btlmt::ChannelPoolConfiguration autoConfig(config);
+            autoConfig.setMaxThreads(2);
+            autoConfig.setMetricsInterval(0.2);
+            ASSERT(0 == autoConfig.setMigrationThreshold(10));
 
-    static void testCase17();
-        // Test that channel pool only creates 'maxConnections' channels.
+            btlmt::ChannelPool::ChannelStateChangeCallback autoChannelCb(
+                                       bdlf::BindUtil::bind(&channelStateCb,
+                                                            _1, _2, _3, _4,
+                                                            &autoObserver));
+            btlmt::ChannelPool::PoolStateChangeCallback autoPoolCb(
+                                       bdlf::BindUtil::bind(&poolStateCb,
+                                                            _1, _2, _3,
+                                                            &autoObserver));
+
+            bsl::vector<ClientSocket *> autoClients;
+            bsls::Types::Int64          autoNumSent[NUM_AUTO_CLIENTS] = { 0 };
+            {
+                Obj mX(autoChannelCb, dataCb, autoPoolCb, autoConfig, &ta);
+                const Obj& X = mX;
 
-    static void testCase16();
-        // Test that CHANNEL_UP and CHANNEL_DOWN callbacks are correctly
-        // delivered.
+                ASSERT(0 == mX.start());
+                ASSERT(0 == mX.listen(getLocalAddress(), 128, SERVER_ID));
+
+                ASSERT(NUM_AUTO_CLIENTS ==
+                       TEST_CASE_REUSE_PORT::connectClients(
+                                        &autoClients,
+                                        &factory,
+                                        getServerLocalAddress(&mX, SERVER_ID),
+                                        NUM_AUTO_CLIENTS));
+                ASSERT(0 == setUpChannels(&ids,
+                                          &mX,
+                                          &autoObserver,
+                                          autoClients,
+                                          autoData));
+
+                bsls::Types::Int64 numInitiated = 0;
+                for (int i = 0; i < NUM_AUTO_CLIENTS; ++i) {
+                    if (0 == mX.migrateChannel(ids[i], 0)) {
+                        ++numInitiated;
+                    }
+                }
+                ASSERT(waitForMigrations(X, numInitiated));
+
+                s_spinMicroseconds = 1000;
+
+                for (int i = 0; i < NUM_AUTO_CLIENTS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::create(
+                                    &senders[i],
+                                    bdlf::BindUtil::bind(
+                                                    &sendPattern<ClientSocket>,
+                                                    autoClients[i],
+                                                    &autoNumSent[i],
+                                                    NUM_BYTES)));
+                }
 
-    static void testCase15();
-        // Test that 'shutdown' is correctly processed from within a channel
-        // state callback.
+                ASSERT(waitForMigrations(X, numInitiated + 1));
 
-    static void testCase14();
-        // Test that the 'getHandleStatistics' returns the correct statistics.
+                s_spinMicroseconds = 0;
 
-    static void testCase13();
-        // Test that 'numBytes*', 'totalBytes*' and related accessors return
-        // the right values.
+                for (int i = 0; i < NUM_AUTO_CLIENTS; ++i) {
+                    ASSERT(0 == bslmt::ThreadUtil::join(senders[i]));
+                    LOOP_ASSERT(i, waitFor(autoData[i].d_numReceived,
+                                           autoNumSent[i]));
+                    LOOP2_ASSERT(i, autoData[i].d_numErrors,
+                                 0 == autoData[i].d_numErrors);
+                }
+                ASSERT(threadIdOfChannel(X, ids[0])
+                                             != threadIdOfChannel(X, ids[1]));
+                LOOP2_ASSERT(autoObserver.d_numMigratedEvents,
+                             X.numChannelMigrations(),
+                             autoObserver.d_numMigratedEvents
+                                                 == X.numChannelMigrations());
 
-    static void testCase12();
-        // Test that 'reportWeightedAverageReset' works as expected.
+                ASSERT(0 == mX.stop());
+            }
 
-    static void testCase11();
-        // Test that HIGHWATER and LOWWATER callbacks are correctly invoked.
+            for (int i = 0; i < (int)autoClients.size(); ++i) {
+                factory.deallocate(autoClients[i]);
+            }
+        }
+}
 
-    static void testCase10();
-        // Test that 'enableRead' and 'disableRead' work as expected.
+void TestDriver::testCase40()
+{
+        // --------------------------------------------------------------------
+        // TESTING SHARDED LISTENERS
+        //
+        // Concerns:
+        //: 1 If 'reusePortListeners' is 'true' in the configuration, 'listen'
+        //:   opens one listening socket per managed thread, each registered
+        //:   with a distinct thread, and 'getHandleStatistics' reports all of
+        //:   them under the same server ID.
+        //:
+        //: 2 Connections to the server address are accepted on the listening
+        //:   sockets, and each accepted channel is managed by the thread that
+        //:   accepted it.
+        //:
+        //: 3 The number of connections accepted on each listening socket is
+        //:   reported by 'getHandleStatistics', and it is 0 for the other
+        //:   handles.
+        //:
+        //: 4 A timed server can be sharded.
+        //:
+        //: 5 'close' closes all the listening sockets of a server.
+        //:
+        //: 6 If 'reusePortListeners' is 'false', a single listening socket is
+        //:   opened.
+        //
+        // Plan:
+        //: 1 Create a channel pool configured with four threads and sharded
+        //:   listeners, listen on an ephemeral port, connect a number of
+        //:   client sockets, and verify the result of 'getHandleStatistics'.
+        //:   (C-1..3)
+        //:
+        //: 2 Listen with a timeout, connect a client, and wait for the
+        //:   channel.  (C-4)
+        //:
+        //: 3 Close the servers and verify that no listening socket remains.
+        //:   (C-5)
+        //:
+        //: 4 Repeat P-1 with a configuration having sharded listeners
+        //:   disabled.  (C-6)
+        //
+        // Testing:
+        //   CONCERN: 'reusePortListeners' opens one listener per thread
+        //   void getHandleStatistics(bsl::vector<HandleInfo> *) const;
+        // --------------------------------------------------------------------
 
-    static void testCase9();
-        // Test that 'registerClock' AND 'deregisterClock' work as expected.
+        if (verbose) cout << "\nTESTING SHARDED LISTENERS"
+                          << "\n=========================" << endl;
 
-    static void testCase8();
-        // Test that 'writeMessage' works as expected.
+#if defined(SO_REUSEPORT) && !defined(BSLS_PLATFORM_OS_WINDOWS)
+        using namespace TEST_CASE_REUSE_PORT;
 
-    static void testCase7();
-        // Test that 'shutdown' works as expected.
+        typedef btlmt::ChannelPool::HandleInfo HandleInfo;
 
-    static void testCase6();
-        // Test that a half-closed socket pair can be correctly imported and
-        // that the channel is correctly recognized as half-closed.
+        enum {
+            NUM_THREADS = 4,
+            NUM_CLIENTS = 64
+        };
 
-    static void testCase5();
-        // Test that 'import' works as expected.
+        btlso::InetStreamSocketFactory<btlso::IPv4Address> factory;
+        bslma::TestAllocator ta(veryVeryVerbose);
 
-    static void testCase4();
-        // Test that 'listen' works as expected.
+        for (int sharded = 1; sharded >= 0; --sharded) {
+            if (verbose) { P(sharded); }
 
-    static void testCase3();
-        // Test that 'connect' works as expected.
+            const int NUM_LISTENERS = sharded ? NUM_THREADS : 1;
 
-    static void testCase2();
-        // Test that 'start' and 'stop' work as expected.
+            btlmt::ChannelPoolConfiguration config;
+            config.setMaxThreads(NUM_THREADS);
+            config.setMaxConnections(2 * NUM_CLIENTS);
+            config.setReusePortListeners(sharded);
+            ASSERT(sharded == config.reusePortListeners());
 
-    static void testCase1();
-        // Breathing test.
-};
+            bsls::AtomicInt numChannels(0);
 
+            btlmt::ChannelPool::ChannelStateChangeCallback channelCb(
+                                    bdlf::BindUtil::bind(&channelStateCb,
+                                                         _1, _2, _3, _4,
+                                                         &numChannels));
+            btlmt::ChannelPool::PoolStateChangeCallback poolCb(&poolStateCb);
+            btlmt::ChannelPool::BlobBasedReadCallback   dataCb(
+                                                             &blobBasedReadCb);
 
-                               // --------------
-                               // TEST APPARATUS
-                               // --------------
+            bsl::vector<btlso::StreamSocket<btlso::IPv4Address> *> clients;
+            {
+                Obj mX(channelCb, dataCb, poolCb, config, &ta);
+                ASSERT(0 == mX.start());
+
+                ASSERT(0 == mX.listen(getLocalAddress(), 128, SERVER_ID));
+
+                bsl::vector<HandleInfo> handles;
+                mX.getHandleStatistics(&handles);
+                LOOP_ASSERT(handles.size(), NUM_LISTENERS == handles.size());
+
+                for (int i = 0; i < (int)handles.size(); ++i) {
+                    LOOP_ASSERT(i, btlmt::ChannelType::e_LISTENING_CHANNEL
+                                                 == handles[i].d_channelType);
+                    LOOP_ASSERT(i, SERVER_ID == handles[i].d_userId);
+                    LOOP_ASSERT(i, 0         == handles[i].d_numAccepted);
+                    for (int j = 0; j < i; ++j) {
+                        LOOP2_ASSERT(i, j, !bslmt::ThreadUtil::isEqual(
+                                                  handles[i].d_threadHandle,
+                                                  handles[j].d_threadHandle));
+                    }
+                }
+
+                btlso::IPv4Address address = getServerLocalAddress(&mX,
+                                                                   SERVER_ID);
+
+                ASSERT(NUM_CLIENTS == connectClients(&clients,
+                                                     &factory,
+                                                     address,
+                                                     NUM_CLIENTS));
+                waitForChannels(&numChannels, NUM_CLIENTS);
+                LOOP_ASSERT(numChannels, NUM_CLIENTS == numChannels);
+
+                handles.clear();
+                mX.getHandleStatistics(&handles);
+                LOOP_ASSERT(handles.size(),
+                            NUM_LISTENERS + NUM_CLIENTS == handles.size());
+
+                // Each listening socket accepted the channels of its thread.
+
+                bsls::Types::Int64 totalAccepted = 0;
+                for (int i = 0; i < (int)handles.size(); ++i) {
+                    const HandleInfo& info = handles[i];
+                    if (btlmt::ChannelType::e_LISTENING_CHANNEL
+                                                       != info.d_channelType) {
+                        LOOP_ASSERT(i, 0 == info.d_numAccepted);
+                        continue;
+                    }
+                    totalAccepted += info.d_numAccepted;
+
+                    if (!sharded) {
+                        continue;
+                    }
+
+                    bsls::Types::Int64 numOnThread = 0;
+                    for (int j = 0; j < (int)handles.size(); ++j) {
+                        if (btlmt::ChannelType::e_ACCEPTED_CHANNEL
+                                                   == handles[j].d_channelType
+                         && bslmt::ThreadUtil::isEqual(
+                                                  info.d_threadHandle,
+                                                  handles[j].d_threadHandle)) {
+                            ++numOnThread;
+                        }
+                    }
+                    LOOP3_ASSERT(i, info.d_numAccepted, numOnThread,
+                                 info.d_numAccepted == numOnThread);
+                }
+                LOOP_ASSERT(totalAccepted, NUM_CLIENTS == totalAccepted);
+                if (veryVerbose) { P(handles); }
+
+                if (verbose) cout << "\tTimed server.\n";
+
+                ASSERT(0 == mX.listen(getLocalAddress(),
+                                      128,
+                                      TIMED_SERVER_ID,
+                                      bsls::TimeInterval(10)));
+
+                address = getServerLocalAddress(&mX, TIMED_SERVER_ID);
+
+                ASSERT(NUM_THREADS == connectClients(&clients,
+                                                     &factory,
+                                                     address,
+                                                     NUM_THREADS));
+                waitForChannels(&numChannels, NUM_CLIENTS + NUM_THREADS);
+                LOOP_ASSERT(numChannels,
+                            NUM_CLIENTS + NUM_THREADS == numChannels);
+
+                if (verbose) cout << "\tClosing the servers.\n";
+
+                ASSERT(0 == mX.close(SERVER_ID));
+                ASSERT(0 == mX.close(TIMED_SERVER_ID));
+
+                handles.clear();
+                mX.getHandleStatistics(&handles);
+                for (int i = 0; i < (int)handles.size(); ++i) {
+                    LOOP_ASSERT(i, btlmt::ChannelType::e_LISTENING_CHANNEL
+                                                 != handles[i].d_channelType);
+                }
+
+                ASSERT(0 == mX.stop());
+            }
+
+            for (int i = 0; i < (int)clients.size(); ++i) {
+                factory.deallocate(clients[i]);
+            }
+        }
+#endif
+}
 
 void TestDriver::testCase39()
 {
@@ -15928,6 +17776,67 @@ static void negativeCase3()
 
 }
 
+static void negativeCase4()
+{
+        // --------------------------------------------------------------------
+        // BENCHMARK: LOCAL VS. LOOPBACK TCP CHANNELS
+        //
+        // Concern:
+        //   Local (Unix-domain) channels are expected to have a lower latency
+        //   and a higher throughput than TCP channels over the loopback
+        //   interface.
+        //
+        // Plan:
+        //   For a channel of each transport, time a number of round trips of
+        //   small messages echoed by the pool, then the transfer of a large
+        //   amount of data from a client to the pool, and report the
+        //   results.  Optionally specify the number of round trips, the
+        //   message size, and the number of megabytes transferred on the
+        //   command line.
+        //
+        // Testing:
+        //   BENCHMARK: local vs. loopback TCP channels
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nBENCHMARK: LOCAL VS. LOOPBACK TCP CHANNELS"
+                          << "\n=========================================="
+                          << endl;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        namespace TC = TEST_CASE_LOCAL_SOCKETS;
+
+        const int NUM_ROUND_TRIPS = ARGC > 2 ? atoi(ARGV[2]) : 20000;
+        const int MESSAGE_SIZE    = ARGC > 3 ? atoi(ARGV[3]) : 64;
+        const int NUM_MEGABYTES   = ARGC > 4 ? atoi(ARGV[4]) : 512;
+
+        ASSERT(0 < NUM_ROUND_TRIPS);
+        ASSERT(0 < MESSAGE_SIZE && MESSAGE_SIZE <= 64 * 1024);
+        ASSERT(0 < NUM_MEGABYTES && NUM_MEGABYTES < 2048);
+
+        const int NUM_BYTES = NUM_MEGABYTES * 1024 * 1024;
+
+        TC::benchmarkTransport("Loopback TCP",
+                               btlso::IPv4Address("127.0.0.1", 0),
+                               NUM_ROUND_TRIPS,
+                               MESSAGE_SIZE,
+                               NUM_BYTES);
+
+        const bsl::string PATH = TC::socketPath(".bench");
+        ::unlink(PATH.c_str());
+
+        TC::benchmarkTransport("Local (Unix-domain)",
+                               btlso::LocalAddress(PATH.c_str()),
+                               NUM_ROUND_TRIPS,
+                               MESSAGE_SIZE,
+                               NUM_BYTES);
+
+        ::unlink(PATH.c_str());
+#else
+        if (verbose) cout << "\tLocal sockets are not supported.\n";
+#endif
+}
+
+
 
 //=============================================================================
 //                              MAIN PROGRAM
@@ -15966,6 +17875,12 @@ int main(int argc, char **argv)
 
     switch (test) { case 0:  // Zero is always the leading case.
 #define CASE(NUMBER) case NUMBER: TestDriver::testCase##NUMBER(); break
+      CASE(45);
+      CASE(44);
+      CASE(43);
+      CASE(42);
+      CASE(41);
+      CASE(40);
       CASE(38);
       CASE(37);
       CASE(36);
@@ -16013,6 +17928,9 @@ int main(int argc, char **argv)
       case -3: {
         negativeCase3();
       } break;
+      case -4: {
+        negativeCase4();
+      } break;
 #undef CASE
       default: {
         cerr << "WARNING: CASE " << test << " NOT FOUND." << endl;
@@ -128,6 +128,34 @@ const bdlat_AttributeInfo
         sizeof("CollectTimeMetrics") - 1,      // name length
         "",// annotation
         bdlat_FormattingMode::e_DEFAULT
+    },
+    {
+        e_ATTRIBUTE_ID_REUSE_PORT_LISTENERS,
+        "ReusePortListeners",                  // name
+        sizeof("ReusePortListeners") - 1,      // name length
+        "",// annotation
+        bdlat_FormattingMode::e_DEFAULT
+    },
+    {
+        e_ATTRIBUTE_ID_MIGRATION_THRESHOLD,
+        "MigrationThreshold",                  // name
+        sizeof("MigrationThreshold") - 1,      // name length
+        "",// annotation
+        bdlat_FormattingMode::e_DEFAULT
+    },
+    {
+        e_ATTRIBUTE_ID_ZERO_COPY_THRESHOLD,
+        "ZeroCopyThreshold",                   // name
+        sizeof("ZeroCopyThreshold") - 1,       // name length
+        "",// annotation
+        bdlat_FormattingMode::e_DEFAULT
+    },
+    {
+        e_ATTRIBUTE_ID_BATCH_SUBMISSION,
+        "BatchSubmission",                     // name
+        sizeof("BatchSubmission") - 1,         // name length
+        "",// annotation
+        bdlat_FormattingMode::e_DEFAULT
     }
 };
 
@@ -191,6 +219,26 @@ const bdlat_AttributeInfo *ChannelPoolConfiguration::lookupAttributeInfo(
       } break;
       case 15: {
         switch(bsl::toupper(name[0])) {
+          case 'B': {
+            if (bsl::toupper(name[1])=='A'
+             && bsl::toupper(name[2])=='T'
+             && bsl::toupper(name[3])=='C'
+             && bsl::toupper(name[4])=='H'
+             && bsl::toupper(name[5])=='S'
+             && bsl::toupper(name[6])=='U'
+             && bsl::toupper(name[7])=='B'
+             && bsl::toupper(name[8])=='M'
+             && bsl::toupper(name[9])=='I'
+             && bsl::toupper(name[10])=='S'
+             && bsl::toupper(name[11])=='S'
+             && bsl::toupper(name[12])=='I'
+             && bsl::toupper(name[13])=='O'
+             && bsl::toupper(name[14])=='N') {
+                return
+                    &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_BATCH_SUBMISSION];
+                                                                      // RETURN
+            }
+          } break;
           case 'M': {
             if (bsl::toupper(name[1])=='E'
              && bsl::toupper(name[2])=='T'
@@ -455,30 +503,101 @@ const bdlat_AttributeInfo *ChannelPoolConfiguration::lookupAttributeInfo(
                                                                       // RETURN
             }
           } break;
+          case 'Z': {
+            if (bsl::toupper(name[1])=='E'
+             && bsl::toupper(name[2])=='R'
+             && bsl::toupper(name[3])=='O'
+             && bsl::toupper(name[4])=='C'
+             && bsl::toupper(name[5])=='O'
+             && bsl::toupper(name[6])=='P'
+             && bsl::toupper(name[7])=='Y'
+             && bsl::toupper(name[8])=='T'
+             && bsl::toupper(name[9])=='H'
+             && bsl::toupper(name[10])=='R'
+             && bsl::toupper(name[11])=='E'
+             && bsl::toupper(name[12])=='S'
+             && bsl::toupper(name[13])=='H'
+             && bsl::toupper(name[14])=='O'
+             && bsl::toupper(name[15])=='L'
+             && bsl::toupper(name[16])=='D') {
+                return
+                  &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD];
+                                                                      // RETURN
+            }
+          } break;
         }
       } break;
       case 18: {
-        if (bsl::toupper(name[0])=='C'
-         && bsl::toupper(name[1])=='O'
-         && bsl::toupper(name[2])=='L'
-         && bsl::toupper(name[3])=='L'
-         && bsl::toupper(name[4])=='E'
-         && bsl::toupper(name[5])=='C'
-         && bsl::toupper(name[6])=='T'
-         && bsl::toupper(name[7])=='T'
-         && bsl::toupper(name[8])=='I'
-         && bsl::toupper(name[9])=='M'
-         && bsl::toupper(name[10])=='E'
-         && bsl::toupper(name[11])=='M'
-         && bsl::toupper(name[12])=='E'
-         && bsl::toupper(name[13])=='T'
-         && bsl::toupper(name[14])=='R'
-         && bsl::toupper(name[15])=='I'
-         && bsl::toupper(name[16])=='C'
-         && bsl::toupper(name[17])=='S') {
-            return &ATTRIBUTE_INFO_ARRAY[
+        switch(bsl::toupper(name[0])) {
+          case 'C': {
+            if (bsl::toupper(name[1])=='O'
+             && bsl::toupper(name[2])=='L'
+             && bsl::toupper(name[3])=='L'
+             && bsl::toupper(name[4])=='E'
+             && bsl::toupper(name[5])=='C'
+             && bsl::toupper(name[6])=='T'
+             && bsl::toupper(name[7])=='T'
+             && bsl::toupper(name[8])=='I'
+             && bsl::toupper(name[9])=='M'
+             && bsl::toupper(name[10])=='E'
+             && bsl::toupper(name[11])=='M'
+             && bsl::toupper(name[12])=='E'
+             && bsl::toupper(name[13])=='T'
+             && bsl::toupper(name[14])=='R'
+             && bsl::toupper(name[15])=='I'
+             && bsl::toupper(name[16])=='C'
+             && bsl::toupper(name[17])=='S') {
+                return &ATTRIBUTE_INFO_ARRAY[
                                        e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS];
                                                                       // RETURN
+            }
+          } break;
+          case 'R': {
+            if (bsl::toupper(name[1])=='E'
+             && bsl::toupper(name[2])=='U'
+             && bsl::toupper(name[3])=='S'
+             && bsl::toupper(name[4])=='E'
+             && bsl::toupper(name[5])=='P'
+             && bsl::toupper(name[6])=='O'
+             && bsl::toupper(name[7])=='R'
+             && bsl::toupper(name[8])=='T'
+             && bsl::toupper(name[9])=='L'
+             && bsl::toupper(name[10])=='I'
+             && bsl::toupper(name[11])=='S'
+             && bsl::toupper(name[12])=='T'
+             && bsl::toupper(name[13])=='E'
+             && bsl::toupper(name[14])=='N'
+             && bsl::toupper(name[15])=='E'
+             && bsl::toupper(name[16])=='R'
+             && bsl::toupper(name[17])=='S') {
+                return &ATTRIBUTE_INFO_ARRAY[
+                                       e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS];
+                                                                      // RETURN
+            }
+          } break;
+          case 'M': {
+            if (bsl::toupper(name[1])=='I'
+             && bsl::toupper(name[2])=='G'
+             && bsl::toupper(name[3])=='R'
+             && bsl::toupper(name[4])=='A'
+             && bsl::toupper(name[5])=='T'
+             && bsl::toupper(name[6])=='I'
+             && bsl::toupper(name[7])=='O'
+             && bsl::toupper(name[8])=='N'
+             && bsl::toupper(name[9])=='T'
+             && bsl::toupper(name[10])=='H'
+             && bsl::toupper(name[11])=='R'
+             && bsl::toupper(name[12])=='E'
+             && bsl::toupper(name[13])=='S'
+             && bsl::toupper(name[14])=='H'
+             && bsl::toupper(name[15])=='O'
+             && bsl::toupper(name[16])=='L'
+             && bsl::toupper(name[17])=='D') {
+                return &ATTRIBUTE_INFO_ARRAY[
+                                        e_ATTRIBUTE_INDEX_MIGRATION_THRESHOLD];
+                                                                      // RETURN
+            }
+          } break;
         }
       } break;
     }
@@ -543,6 +662,22 @@ ChannelPoolConfiguration::lookupAttributeInfo(int id)
         return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS];
                                                                       // RETURN
       }
+      case e_ATTRIBUTE_ID_REUSE_PORT_LISTENERS: {
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS];
+                                                                      // RETURN
+      }
+      case e_ATTRIBUTE_ID_MIGRATION_THRESHOLD: {
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_MIGRATION_THRESHOLD];
+                                                                      // RETURN
+      }
+      case e_ATTRIBUTE_ID_ZERO_COPY_THRESHOLD: {
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD];
+                                                                      // RETURN
+      }
+      case e_ATTRIBUTE_ID_BATCH_SUBMISSION: {
+        return &ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_BATCH_SUBMISSION];
+                                                                      // RETURN
+      }
 
       default:
         return 0;                                                     // RETURN
@@ -565,6 +700,10 @@ ChannelPoolConfiguration::ChannelPoolConfiguration()
 , d_maxMessageSizeIn(1024)
 , d_threadStackSize(k_DEFAULT_THREAD_STACK_SIZE)
 , d_collectTimeMetrics(true)
+, d_reusePortListeners(false)
+, d_migrationThreshold(0)
+, d_zeroCopyThreshold(0)
+, d_batchSubmission(false)
 {
 }
 
@@ -584,6 +723,10 @@ ChannelPoolConfiguration::ChannelPoolConfiguration(
 , d_maxMessageSizeIn(original.d_maxMessageSizeIn)
 , d_threadStackSize(original.d_threadStackSize)
 , d_collectTimeMetrics(original.d_collectTimeMetrics)
+, d_reusePortListeners(original.d_reusePortListeners)
+, d_migrationThreshold(original.d_migrationThreshold)
+, d_zeroCopyThreshold(original.d_zeroCopyThreshold)
+, d_batchSubmission(original.d_batchSubmission)
 {
 }
 
@@ -602,6 +745,8 @@ ChannelPoolConfiguration::~ChannelPoolConfiguration()
              && d_minMessageSizeIn <= d_typMessageSizeIn
              && d_typMessageSizeIn <= d_maxMessageSizeIn);
     BSLS_ASSERT(0 <= d_threadStackSize);
+    BSLS_ASSERT(0 <= d_migrationThreshold && d_migrationThreshold <= 100);
+    BSLS_ASSERT(0 <= d_zeroCopyThreshold);
 }
 
 // MANIPULATORS
@@ -623,6 +768,10 @@ ChannelPoolConfiguration::operator=(const ChannelPoolConfiguration& rhs)
         d_maxMessageSizeIn   = rhs.d_maxMessageSizeIn;
         d_threadStackSize    = rhs.d_threadStackSize;
         d_collectTimeMetrics = rhs.d_collectTimeMetrics;
+        d_reusePortListeners = rhs.d_reusePortListeners;
+        d_migrationThreshold = rhs.d_migrationThreshold;
+        d_zeroCopyThreshold  = rhs.d_zeroCopyThreshold;
+        d_batchSubmission    = rhs.d_batchSubmission;
     }
     return *this;
 }
@@ -646,7 +795,11 @@ bool btlmt::operator==(const ChannelPoolConfiguration& lhs,
         && lhs.d_typMessageSizeIn   == rhs.d_typMessageSizeIn
         && lhs.d_maxMessageSizeIn   == rhs.d_maxMessageSizeIn
         && lhs.d_threadStackSize    == rhs.d_threadStackSize
-        && lhs.d_collectTimeMetrics == rhs.d_collectTimeMetrics;
+        && lhs.d_collectTimeMetrics == rhs.d_collectTimeMetrics
+        && lhs.d_reusePortListeners == rhs.d_reusePortListeners
+        && lhs.d_migrationThreshold == rhs.d_migrationThreshold
+        && lhs.d_zeroCopyThreshold  == rhs.d_zeroCopyThreshold
+        && lhs.d_batchSubmission    == rhs.d_batchSubmission;
 }
 
 bsl::ostream& btlmt::operator<<(bsl::ostream&                   output,
@@ -669,6 +822,14 @@ bsl::ostream& btlmt::operator<<(bsl::ostream&                   output,
            << "\tmaxIncomingMessageSize : " << config.d_maxMessageSizeIn <<"\n"
            << "\tthreadStackSize        : " << config.d_threadStackSize  <<"\n"
            << "\tcollectTimeMetrics     : " << config.d_collectTimeMetrics
+                                                                      <<"\n"
+           << "\treusePortListeners     : " << config.d_reusePortListeners
+                                                                      <<"\n"
+           << "\tmigrationThreshold     : " << config.d_migrationThreshold
+                                                                      <<"\n"
+           << "\tzeroCopyThreshold      : " << config.d_zeroCopyThreshold
+                                                                      <<"\n"
+           << "\tbatchSubmission        : " << config.d_batchSubmission
            << "\n]\n";
 
     return output;
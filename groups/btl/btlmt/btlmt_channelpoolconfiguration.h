@@ -85,6 +85,38 @@ BSLS_IDENT("$Id: $")
 //                               processing data, and if this value
 //                               is 'false', those metrics will not
 //                               be collected.
+//
+//   bool    reusePortListeners  indicates whether 'listen' opens one     false
+//                               'SO_REUSEPORT' listening socket
+//                               per managed thread, so that the
+//                               kernel distributes incoming
+//                               connections amongst the threads.
+//                               Ignored on platforms not supporting
+//                               'SO_REUSEPORT'.
+//
+//   int     migrationThreshold  difference, in percentage points,           0
+//                               between the busiest and the least
+//                               busy managed thread above which
+//                               the channel pool migrates a
+//                               channel from the former to the
+//                               latter at each metrics interval;
+//                               if this value is 0, channels are
+//                               never migrated automatically.
+//
+//   int     zeroCopyThreshold   minimum number of bytes pending              0
+//                               on a channel for them to be
+//                               written without copying them
+//                               into the kernel, on platforms
+//                               supporting it; if this value is
+//                               0, data is always copied.
+//
+//   bool    batchSubmission     indicates whether the managed            false
+//                               threads prefer a socket event
+//                               multiplexer that submits event
+//                               registrations in batches (i.e.,
+//                               'io_uring' on Linux 5.12 and
+//                               later).  Ignored on platforms
+//                               not providing one.
 //..
 // The constraints are as follows:
 //..
@@ -111,6 +143,10 @@ BSLS_IDENT("$Id: $")
 //   +--------------------+---------------------------------------------+
 //   | threadStackSize    | 0 <= threadStackSize                        |
 //   +--------------------+---------------------------------------------+
+//   | migrationThreshold | 0 <= migrationThreshold <= 100              |
+//   +--------------------+---------------------------------------------+
+//   | zeroCopyThreshold  | 0 <= zeroCopyThreshold                      |
+//   +--------------------+---------------------------------------------+
 //..
 //
 ///Thread Safety
@@ -199,6 +235,10 @@ BSLS_IDENT("$Id: $")
 //         maxIncomingMessageSize : 3
 //         threadStackSize        : 1024
 //         collectTimeMetrics     : 1
+//         reusePortListeners     : 0
+//         migrationThreshold     : 0
+//         zeroCopyThreshold      : 0
+//         batchSubmission        : 0
 // ]
 //..
 
@@ -308,6 +348,20 @@ class ChannelPoolConfiguration {
 
     bool                  d_collectTimeMetrics;
 
+    bool                  d_reusePortListeners;
+
+    int                   d_migrationThreshold;
+                                               // load difference (in
+                                               // percentage points) that
+                                               // triggers a migration
+
+    int                   d_zeroCopyThreshold; // minimum write size (in
+                                               // bytes) for zero-copy
+                                               // transmission
+
+    bool                  d_batchSubmission;   // prefer batching event
+                                               // multiplexer
+
     friend bsl::ostream& operator<<(bsl::ostream&,
                                     const ChannelPoolConfiguration&);
 
@@ -317,7 +371,7 @@ class ChannelPoolConfiguration {
   public:
     // TYPES
     enum {
-        k_NUM_ATTRIBUTES = 14 // the number of attributes in this class
+        k_NUM_ATTRIBUTES = 18 // the number of attributes in this class
 
 
     };
@@ -362,9 +416,21 @@ class ChannelPoolConfiguration {
         e_ATTRIBUTE_INDEX_THREAD_STACK_SIZE    = 12,
             // index for 'ThreadStackSize' attribute
 
-        e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS = 13
+        e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS = 13,
             // index for 'CollectTimeMetrics' attribute
 
+        e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS = 14,
+            // index for 'ReusePortListeners' attribute
+
+        e_ATTRIBUTE_INDEX_MIGRATION_THRESHOLD  = 15,
+            // index for 'MigrationThreshold' attribute
+
+        e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD  = 16,
+            // index for 'ZeroCopyThreshold' attribute
+
+        e_ATTRIBUTE_INDEX_BATCH_SUBMISSION     = 17
+            // index for 'BatchSubmission' attribute
+
 
     };
 
@@ -408,9 +474,21 @@ class ChannelPoolConfiguration {
         e_ATTRIBUTE_ID_THREAD_STACK_SIZE       = 13,
             // id for 'ThreadStackSize' attribute
 
-        e_ATTRIBUTE_ID_COLLECT_TIME_METRICS    = 14
+        e_ATTRIBUTE_ID_COLLECT_TIME_METRICS    = 14,
             // id for 'CollectTimeMetrics' attribute
 
+        e_ATTRIBUTE_ID_REUSE_PORT_LISTENERS    = 15,
+            // id for 'ReusePortListeners' attribute
+
+        e_ATTRIBUTE_ID_MIGRATION_THRESHOLD     = 16,
+            // id for 'MigrationThreshold' attribute
+
+        e_ATTRIBUTE_ID_ZERO_COPY_THRESHOLD     = 17,
+            // id for 'ZeroCopyThreshold' attribute
+
+        e_ATTRIBUTE_ID_BATCH_SUBMISSION        = 18
+            // id for 'BatchSubmission' attribute
+
 
     };
 
@@ -516,6 +594,48 @@ class ChannelPoolConfiguration {
         // estimate of work-load when it attempts to distribute work amongst
         // its managed threads.
 
+    int setReusePortListeners(bool reusePortListenersFlag);
+        // Set to the specified 'reusePortListenersFlag' whether the configured
+        // channel pool will open one listening socket per managed thread,
+        // each having the 'SO_REUSEPORT' socket option set, for every call to
+        // 'listen'.  Return 0.  If 'reusePortListenersFlag' is 'true', the
+        // operating system distributes incoming connections amongst the
+        // listening sockets, and each accepted channel is managed by the
+        // thread that accepted it.  Note that this value has no effect on
+        // platforms that do not support 'SO_REUSEPORT', or if the configured
+        // channel pool manages a single thread.
+
+    int setMigrationThreshold(int migrationThreshold);
+        // Set the migration threshold attribute of this object to the
+        // specified 'migrationThreshold' value if
+        // '0 <= migrationThreshold <= 100'.  Return 0 on success, and a
+        // non-zero value (with no effect on the state of this object)
+        // otherwise.  If 'migrationThreshold' is positive, and time metrics
+        // are collected, the configured channel pool migrates a channel from
+        // its busiest to its least busy managed thread at each metrics
+        // interval in which their busy percentages differ by more than
+        // 'migrationThreshold'.  A value of 0 disables automatic migration.
+
+    int setZeroCopyThreshold(int zeroCopyThreshold);
+        // Set the zero-copy threshold attribute of this object to the
+        // specified 'zeroCopyThreshold' value if '0 <= zeroCopyThreshold'.
+        // Return 0 on success, and a non-zero value (with no effect on the
+        // state of this object) otherwise.  If 'zeroCopyThreshold' is
+        // positive, the configured channel pool enables zero-copy
+        // transmission on its channels, where the platform supports it, and
+        // writes without copying them the data of blobs enqueued for writing
+        // whenever at least 'zeroCopyThreshold' bytes are pending on a
+        // channel.  A value of 0 disables zero-copy transmission.
+
+    int setBatchSubmission(bool batchSubmissionFlag);
+        // Set to the specified 'batchSubmissionFlag' whether the managed
+        // threads of the configured channel pool prefer a socket event
+        // multiplexer that submits the event registrations made while
+        // processing one batch of events together with the wait for the next
+        // batch.  Return 0.  Note that this value has an effect only on
+        // platforms providing such a multiplexer (i.e., 'io_uring' on Linux
+        // 5.12 and later; see 'btlmt_tcptimereventmanager').
+
     template<class MANIPULATOR>
     int manipulateAttributes(MANIPULATOR& manipulator);
         // Invoke the specified 'manipulator' sequentially on the address of
@@ -578,6 +698,24 @@ class ChannelPoolConfiguration {
         // pool cannot use that estimate of work-load when it attempts to
         // distribute work amongst its managed threads.
 
+    bool reusePortListeners() const;
+        // Return 'true' if the configured channel pool will open one
+        // 'SO_REUSEPORT' listening socket per managed thread for every call
+        // to 'listen', and 'false' otherwise.
+
+    int migrationThreshold() const;
+        // Return the migration threshold attribute of this object.  A value of
+        // 0 indicates that channels are never migrated automatically.
+
+    int zeroCopyThreshold() const;
+        // Return the zero-copy threshold attribute of this object.  A value of
+        // 0 indicates that zero-copy transmission is disabled.
+
+    bool batchSubmission() const;
+        // Return 'true' if the managed threads of the configured channel pool
+        // prefer a socket event multiplexer that submits event registrations
+        // in batches, and 'false' otherwise.
+
     const double& metricsInterval() const;
         // Return the metrics interval attribute of this object.
 
@@ -755,6 +893,41 @@ int ChannelPoolConfiguration::setCollectTimeMetrics(
     return 0;
 }
 
+inline
+int ChannelPoolConfiguration::setReusePortListeners(
+                                                   bool reusePortListenersFlag)
+{
+    d_reusePortListeners = reusePortListenersFlag;
+    return 0;
+}
+
+inline
+int ChannelPoolConfiguration::setMigrationThreshold(int migrationThreshold)
+{
+    if (0 <= migrationThreshold && migrationThreshold <= 100) {
+        d_migrationThreshold = migrationThreshold;
+        return 0;                                                     // RETURN
+    }
+    return -1;
+}
+
+inline
+int ChannelPoolConfiguration::setZeroCopyThreshold(int zeroCopyThreshold)
+{
+    if (0 <= zeroCopyThreshold) {
+        d_zeroCopyThreshold = zeroCopyThreshold;
+        return 0;                                                     // RETURN
+    }
+    return -1;
+}
+
+inline
+int ChannelPoolConfiguration::setBatchSubmission(bool batchSubmissionFlag)
+{
+    d_batchSubmission = batchSubmissionFlag;
+    return 0;
+}
+
 template <class MANIPULATOR>
 int ChannelPoolConfiguration::manipulateAttributes(MANIPULATOR& manipulator)
 {
@@ -855,6 +1028,34 @@ int ChannelPoolConfiguration::manipulateAttributes(MANIPULATOR& manipulator)
         return ret;                                                   // RETURN
     }
 
+    ret = manipulator(
+                 &d_reusePortListeners,
+                 ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = manipulator(
+                  &d_migrationThreshold,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_MIGRATION_THRESHOLD]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = manipulator(
+                  &d_zeroCopyThreshold,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = manipulator(
+                     &d_batchSubmission,
+                     ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_BATCH_SUBMISSION]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
     return ret;
 }
 
@@ -949,6 +1150,30 @@ int ChannelPoolConfiguration::manipulateAttribute(MANIPULATOR& manipulator,
                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS]);
                                                                       // RETURN
       } break;
+      case e_ATTRIBUTE_ID_REUSE_PORT_LISTENERS: {
+        return manipulator(
+                 &d_reusePortListeners,
+                 ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_MIGRATION_THRESHOLD: {
+        return manipulator(
+                  &d_migrationThreshold,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_MIGRATION_THRESHOLD]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_ZERO_COPY_THRESHOLD: {
+        return manipulator(
+                  &d_zeroCopyThreshold,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_BATCH_SUBMISSION: {
+        return manipulator(
+                     &d_batchSubmission,
+                     ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_BATCH_SUBMISSION]);
+                                                                      // RETURN
+      } break;
 
       default:
         return k_NOT_FOUND;                                           // RETURN
@@ -1059,6 +1284,26 @@ bool ChannelPoolConfiguration::collectTimeMetrics() const {
     return d_collectTimeMetrics;
 }
 
+inline
+bool ChannelPoolConfiguration::reusePortListeners() const {
+    return d_reusePortListeners;
+}
+
+inline
+int ChannelPoolConfiguration::migrationThreshold() const {
+    return d_migrationThreshold;
+}
+
+inline
+int ChannelPoolConfiguration::zeroCopyThreshold() const {
+    return d_zeroCopyThreshold;
+}
+
+inline
+bool ChannelPoolConfiguration::batchSubmission() const {
+    return d_batchSubmission;
+}
+
 template <class ACCESSOR>
 int ChannelPoolConfiguration::accessAttributes(ACCESSOR& accessor) const
 {
@@ -1157,6 +1402,33 @@ int ChannelPoolConfiguration::accessAttributes(ACCESSOR& accessor) const
         return ret;                                                   // RETURN
     }
 
+    ret = accessor(
+                 d_reusePortListeners,
+                 ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = accessor(
+                  d_migrationThreshold,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_MIGRATION_THRESHOLD]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = accessor(
+                  d_zeroCopyThreshold,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
+    ret = accessor(d_batchSubmission,
+                   ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_BATCH_SUBMISSION]);
+    if (ret) {
+        return ret;                                                   // RETURN
+    }
+
     return ret;
 }
 
@@ -1249,6 +1521,30 @@ ChannelPoolConfiguration::accessAttribute(ACCESSOR& accessor, int id) const
                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_COLLECT_TIME_METRICS]);
                                                                       // RETURN
       } break;
+      case e_ATTRIBUTE_ID_REUSE_PORT_LISTENERS: {
+        return accessor(
+                 d_reusePortListeners,
+                 ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_REUSE_PORT_LISTENERS]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_MIGRATION_THRESHOLD: {
+        return accessor(
+                  d_migrationThreshold,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_MIGRATION_THRESHOLD]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_ZERO_COPY_THRESHOLD: {
+        return accessor(
+                  d_zeroCopyThreshold,
+                  ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_ZERO_COPY_THRESHOLD]);
+                                                                      // RETURN
+      } break;
+      case e_ATTRIBUTE_ID_BATCH_SUBMISSION: {
+        return accessor(
+                     d_batchSubmission,
+                     ATTRIBUTE_INFO_ARRAY[e_ATTRIBUTE_INDEX_BATCH_SUBMISSION]);
+                                                                      // RETURN
+      } break;
 
       default:
         return k_NOT_FOUND;                                           // RETURN
@@ -142,6 +142,13 @@ const int THREADSTACKSIZE[NUM_VALUES]  = { 1048576, 512, 600, 700, 800, 900,
                                                                          999 };
 const bool COLLECTMETRICS[NUM_VALUES] =
                                      { true, false, true, false, true, false };
+const bool REUSEPORT[NUM_VALUES] =
+                                    { false, true, false, true, false, true };
+const int MIGRATIONTHRESHOLD[NUM_VALUES] = { 0, 10, 20, 50, 99, 100 };
+const int ZEROCOPYTHRESHOLD[NUM_VALUES]  = { 0, 1, 1024, 4096, 65536,
+                                             1048576, 16777216 };
+const bool BATCHSUBMISSION[NUM_VALUES] =
+                                    { false, true, false, true, false, true };
 
 //=============================================================================
 //                             HELPER CLASSES
@@ -348,6 +355,10 @@ int main(int argc, char *argv[])
                 "\tmaxIncomingMessageSize : 3" NL
                 "\tthreadStackSize        : 1024" NL
                 "\tcollectTimeMetrics     : 1" NL
+                "\treusePortListeners     : 0" NL
+                "\tmigrationThreshold     : 0" NL
+                "\tzeroCopyThreshold      : 0" NL
+                "\tbatchSubmission        : 0" NL
                 "]" NL
                 ;
             ASSERT(os.str().c_str() == s);
@@ -380,7 +391,7 @@ int main(int argc, char *argv[])
                           << "\n==========================" << endl;
 
         enum {
-            NUM_ATTRIBUTES = 14
+            NUM_ATTRIBUTES = 18
         };
 
         ASSERT(NUM_ATTRIBUTES == Obj::k_NUM_ATTRIBUTES);
@@ -390,7 +401,8 @@ int main(int argc, char *argv[])
         "MinMessageSizeOut", "TypMessageSizeOut", "MaxMessageSizeOut",
         "MinMessageSizeIn", "TypMessageSizeIn", "MaxMessageSizeIn",
         "WriteQueueLowWater", "WriteQueueHighWater", "ThreadStackSize",
-        "CollectTimeMetrics"
+        "CollectTimeMetrics", "ReusePortListeners", "MigrationThreshold",
+        "ZeroCopyThreshold", "BatchSubmission"
         };
 
         const int NUM_NAMES = sizeof NAMES / sizeof *NAMES;
@@ -564,6 +576,40 @@ int main(int argc, char *argv[])
                                                                     visitor,
                                                                     j + 1));
                   } break;
+                  case 14: {
+                    ASSERT(0 == mA.setReusePortListeners(REUSEPORT[i]));
+                    AssignValue<bool> visitor(REUSEPORT[i]);
+                    LOOP2_ASSERT(i, j, 0 ==
+                       bdlat_SequenceFunctions::manipulateAttribute(&mB,
+                                                                    visitor,
+                                                                    j + 1));
+                  } break;
+                  case 15: {
+                    ASSERT(0 ==
+                         mA.setMigrationThreshold(MIGRATIONTHRESHOLD[i]));
+                    AssignValue<int> visitor(MIGRATIONTHRESHOLD[i]);
+                    LOOP2_ASSERT(i, j, 0 ==
+                       bdlat_SequenceFunctions::manipulateAttribute(&mB,
+                                                                    visitor,
+                                                                    j + 1));
+                  } break;
+                  case 16: {
+                    ASSERT(0 ==
+                           mA.setZeroCopyThreshold(ZEROCOPYTHRESHOLD[i]));
+                    AssignValue<int> visitor(ZEROCOPYTHRESHOLD[i]);
+                    LOOP2_ASSERT(i, j, 0 ==
+                       bdlat_SequenceFunctions::manipulateAttribute(&mB,
+                                                                    visitor,
+                                                                    j + 1));
+                  } break;
+                  case 17: {
+                    ASSERT(0 == mA.setBatchSubmission(BATCHSUBMISSION[i]));
+                    AssignValue<bool> visitor(BATCHSUBMISSION[i]);
+                    LOOP2_ASSERT(i, j, 0 ==
+                       bdlat_SequenceFunctions::manipulateAttribute(&mB,
+                                                                    visitor,
+                                                                    j + 1));
+                  } break;
 
                   default:
                     ASSERT(0);
@@ -582,7 +628,7 @@ int main(int argc, char *argv[])
                                                                   avisitor,
                                                                   j + 1));
                 }
-                else if (j == 13) {
+                else if (j == 13 || j == 14 || j == 17) {
                     bool value;
                     GetValue<bool> gvisitor(&value);
                     ASSERT(0 ==
@@ -1136,6 +1182,194 @@ int main(int argc, char *argv[])
 
         // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
+        if (verbose) cout << "\t Change attribute 8." << endl;
+
+        ASSERT(0 == mX1.setReusePortListeners(REUSEPORT[1]));
+        ASSERT( MINMESSAGESIZEIN[0] == X1.minIncomingMessageSize());
+        ASSERT( TYPMESSAGESIZEIN[0] == X1.typicalIncomingMessageSize());
+        ASSERT( MAXMESSAGESIZEIN[0] == X1.maxIncomingMessageSize());
+        ASSERT(MINMESSAGESIZEOUT[0] == X1.minOutgoingMessageSize());
+        ASSERT(TYPMESSAGESIZEOUT[0] == X1.typicalOutgoingMessageSize());
+        ASSERT(MAXMESSAGESIZEOUT[0] == X1.maxOutgoingMessageSize());
+        ASSERT(   MAXCONNECTIONS[0] == X1.maxConnections());
+        ASSERT(    MAXNUMTHREADS[0] == X1.maxThreads());
+        ASSERT(  METRICSINTERVAL[0] == X1.metricsInterval());
+        ASSERT(      READTIMEOUT[0] == X1.readTimeout());
+        ASSERT(  THREADSTACKSIZE[0] == X1.threadStackSize());
+        ASSERT(   COLLECTMETRICS[0] == X1.collectTimeMetrics());
+        ASSERT(        REUSEPORT[1] == X1.reusePortListeners());
+        ASSERT(MIGRATIONTHRESHOLD[0] == X1.migrationThreshold());
+        ASSERT(ZEROCOPYTHRESHOLD[0] == X1.zeroCopyThreshold());
+
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(0 == (X1 == Z1));          ASSERT(1 == (X1 != Z1));
+        ASSERT(0 == (Z1 == X1));          ASSERT(1 == (Z1 != X1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+        {
+            Obj C(X1);
+            ASSERT(C == X1 == 1);          ASSERT(C != X1 == 0);
+        }
+
+        mY1 = X1;
+        ASSERT(1 == (Y1 == Y1));          ASSERT(0 == (Y1 != Y1));
+        ASSERT(1 == (Y1 == X1));          ASSERT(0 == (Y1 != X1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        ASSERT(0 == mX1.setReusePortListeners(REUSEPORT[0]));
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        mX1 = mY1 = Z1;
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+        if (verbose) cout << "\t Change attribute 9." << endl;
+
+        ASSERT(0 == mX1.setMigrationThreshold(MIGRATIONTHRESHOLD[1]));
+        ASSERT( MINMESSAGESIZEIN[0] == X1.minIncomingMessageSize());
+        ASSERT( TYPMESSAGESIZEIN[0] == X1.typicalIncomingMessageSize());
+        ASSERT( MAXMESSAGESIZEIN[0] == X1.maxIncomingMessageSize());
+        ASSERT(MINMESSAGESIZEOUT[0] == X1.minOutgoingMessageSize());
+        ASSERT(TYPMESSAGESIZEOUT[0] == X1.typicalOutgoingMessageSize());
+        ASSERT(MAXMESSAGESIZEOUT[0] == X1.maxOutgoingMessageSize());
+        ASSERT(   MAXCONNECTIONS[0] == X1.maxConnections());
+        ASSERT(    MAXNUMTHREADS[0] == X1.maxThreads());
+        ASSERT(  METRICSINTERVAL[0] == X1.metricsInterval());
+        ASSERT(      READTIMEOUT[0] == X1.readTimeout());
+        ASSERT(  THREADSTACKSIZE[0] == X1.threadStackSize());
+        ASSERT(   COLLECTMETRICS[0] == X1.collectTimeMetrics());
+        ASSERT(        REUSEPORT[0] == X1.reusePortListeners());
+        ASSERT(MIGRATIONTHRESHOLD[1] == X1.migrationThreshold());
+        ASSERT(ZEROCOPYTHRESHOLD[0] == X1.zeroCopyThreshold());
+
+        ASSERT(0 != mX1.setMigrationThreshold(-1));
+        ASSERT(0 != mX1.setMigrationThreshold(101));
+        ASSERT(MIGRATIONTHRESHOLD[1] == X1.migrationThreshold());
+
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(0 == (X1 == Z1));          ASSERT(1 == (X1 != Z1));
+        ASSERT(0 == (Z1 == X1));          ASSERT(1 == (Z1 != X1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+        {
+            Obj C(X1);
+            ASSERT(C == X1 == 1);          ASSERT(C != X1 == 0);
+        }
+
+        mY1 = X1;
+        ASSERT(1 == (Y1 == Y1));          ASSERT(0 == (Y1 != Y1));
+        ASSERT(1 == (Y1 == X1));          ASSERT(0 == (Y1 != X1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        ASSERT(0 == mX1.setMigrationThreshold(MIGRATIONTHRESHOLD[0]));
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        mX1 = mY1 = Z1;
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+        if (verbose) cout << "\t Change attribute 10." << endl;
+
+        ASSERT(0 == mX1.setZeroCopyThreshold(ZEROCOPYTHRESHOLD[1]));
+        ASSERT( MINMESSAGESIZEIN[0] == X1.minIncomingMessageSize());
+        ASSERT( TYPMESSAGESIZEIN[0] == X1.typicalIncomingMessageSize());
+        ASSERT( MAXMESSAGESIZEIN[0] == X1.maxIncomingMessageSize());
+        ASSERT(MINMESSAGESIZEOUT[0] == X1.minOutgoingMessageSize());
+        ASSERT(TYPMESSAGESIZEOUT[0] == X1.typicalOutgoingMessageSize());
+        ASSERT(MAXMESSAGESIZEOUT[0] == X1.maxOutgoingMessageSize());
+        ASSERT(   MAXCONNECTIONS[0] == X1.maxConnections());
+        ASSERT(    MAXNUMTHREADS[0] == X1.maxThreads());
+        ASSERT(  METRICSINTERVAL[0] == X1.metricsInterval());
+        ASSERT(      READTIMEOUT[0] == X1.readTimeout());
+        ASSERT(  THREADSTACKSIZE[0] == X1.threadStackSize());
+        ASSERT(   COLLECTMETRICS[0] == X1.collectTimeMetrics());
+        ASSERT(        REUSEPORT[0] == X1.reusePortListeners());
+        ASSERT(MIGRATIONTHRESHOLD[0] == X1.migrationThreshold());
+        ASSERT(ZEROCOPYTHRESHOLD[1] == X1.zeroCopyThreshold());
+
+        ASSERT(0 != mX1.setZeroCopyThreshold(-1));
+        ASSERT(ZEROCOPYTHRESHOLD[1] == X1.zeroCopyThreshold());
+
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(0 == (X1 == Z1));          ASSERT(1 == (X1 != Z1));
+        ASSERT(0 == (Z1 == X1));          ASSERT(1 == (Z1 != X1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+        {
+            Obj C(X1);
+            ASSERT(C == X1 == 1);          ASSERT(C != X1 == 0);
+        }
+
+        mY1 = X1;
+        ASSERT(1 == (Y1 == Y1));          ASSERT(0 == (Y1 != Y1));
+        ASSERT(1 == (Y1 == X1));          ASSERT(0 == (Y1 != X1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        ASSERT(0 == mX1.setZeroCopyThreshold(ZEROCOPYTHRESHOLD[0]));
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        mX1 = mY1 = Z1;
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
+        if (verbose) cout << "\t Change attribute 11." << endl;
+
+        ASSERT(0 == mX1.setBatchSubmission(BATCHSUBMISSION[1]));
+        ASSERT( MINMESSAGESIZEIN[0] == X1.minIncomingMessageSize());
+        ASSERT( TYPMESSAGESIZEIN[0] == X1.typicalIncomingMessageSize());
+        ASSERT( MAXMESSAGESIZEIN[0] == X1.maxIncomingMessageSize());
+        ASSERT(MINMESSAGESIZEOUT[0] == X1.minOutgoingMessageSize());
+        ASSERT(TYPMESSAGESIZEOUT[0] == X1.typicalOutgoingMessageSize());
+        ASSERT(MAXMESSAGESIZEOUT[0] == X1.maxOutgoingMessageSize());
+        ASSERT(   MAXCONNECTIONS[0] == X1.maxConnections());
+        ASSERT(    MAXNUMTHREADS[0] == X1.maxThreads());
+        ASSERT(  METRICSINTERVAL[0] == X1.metricsInterval());
+        ASSERT(      READTIMEOUT[0] == X1.readTimeout());
+        ASSERT(  THREADSTACKSIZE[0] == X1.threadStackSize());
+        ASSERT(   COLLECTMETRICS[0] == X1.collectTimeMetrics());
+        ASSERT(        REUSEPORT[0] == X1.reusePortListeners());
+        ASSERT(MIGRATIONTHRESHOLD[0] == X1.migrationThreshold());
+        ASSERT(ZEROCOPYTHRESHOLD[0] == X1.zeroCopyThreshold());
+        ASSERT(  BATCHSUBMISSION[1] == X1.batchSubmission());
+
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(0 == (X1 == Z1));          ASSERT(1 == (X1 != Z1));
+        ASSERT(0 == (Z1 == X1));          ASSERT(1 == (Z1 != X1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+        {
+            Obj C(X1);
+            ASSERT(C == X1 == 1);          ASSERT(C != X1 == 0);
+        }
+
+        mY1 = X1;
+        ASSERT(1 == (Y1 == Y1));          ASSERT(0 == (Y1 != Y1));
+        ASSERT(1 == (Y1 == X1));          ASSERT(0 == (Y1 != X1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        ASSERT(0 == mX1.setBatchSubmission(BATCHSUBMISSION[0]));
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(0 == (Y1 == Z1));          ASSERT(1 == (Y1 != Z1));
+
+        mX1 = mY1 = Z1;
+        ASSERT(1 == (X1 == X1));          ASSERT(0 == (X1 != X1));
+        ASSERT(1 == (X1 == Z1));          ASSERT(0 == (X1 != Z1));
+        ASSERT(1 == (Y1 == Z1));          ASSERT(0 == (Y1 != Z1));
+
+        // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+
         if (verbose) cout << "Testing output operator (<<)." << endl;
 
         ASSERT(0 == mY1.setIncomingMessageSizes(MINMESSAGESIZEIN[1],
@@ -1173,6 +1407,10 @@ int main(int argc, char *argv[])
                 "\tmaxIncomingMessageSize : 1024" NL
                 "\tthreadStackSize        : 1048576" NL
                 "\tcollectTimeMetrics     : 1" NL
+                "\treusePortListeners     : 0" NL
+                "\tmigrationThreshold     : 0" NL
+                "\tzeroCopyThreshold      : 0" NL
+                "\tbatchSubmission        : 0" NL
                 "]" NL
                 ;
             ASSERT(buf == s);
@@ -1198,6 +1436,10 @@ int main(int argc, char *argv[])
                 "\tmaxIncomingMessageSize : 17" NL
                 "\tthreadStackSize        : 512" NL
                 "\tcollectTimeMetrics     : 1" NL
+                "\treusePortListeners     : 0" NL
+                "\tmigrationThreshold     : 0" NL
+                "\tzeroCopyThreshold      : 0" NL
+                "\tbatchSubmission        : 0" NL
                 "]" NL
                 ;
             ASSERT(buf == s);
@@ -496,6 +496,10 @@ BSLS_IDENT("$Id: $")
 #include <btlso_ipv4address.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_LOCALADDRESS
+#include <btlso_localaddress.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_STREAMSOCKET
 #include <btlso_streamsocket.h>
 #endif
@@ -945,6 +949,27 @@ class SessionPool {
         // specified 'userData'.  The behavior is undefined unless
         // '0 < backlog'.
 
+    int listen(
+              int                                      *handleBuffer,
+              const SessionPool::SessionStateCallback&  callback,
+              const btlso::LocalAddress&                endpoint,
+              int                                       backlog,
+              SessionFactory                           *factory,
+              void                                     *userData = 0,
+              int                                      *platformErrorCode = 0);
+        // Asynchronously listen for connection requests on the local
+        // (Unix-domain) socket bound to the specified 'endpoint' path, with up
+        // to a maximum of 'backlog' concurrent connection requests, and
+        // allocate and start a session using the specified 'factory' for each
+        // accepted connection, as described above.  Load a handle for the
+        // listening connection into 'handleBuffer'.  Optionally specify
+        // 'platformErrorCode' that will be loaded with the platform-specific
+        // error code if this method fails.  Return 0 on success, and a
+        // non-zero value otherwise.  The behavior is undefined unless
+        // '0 < backlog'.  Note that the socket file created at 'endpoint' is
+        // not removed by this pool (see "Local (Unix-Domain) Sockets" in the
+        // 'btlmt_channelpool' component-level documentation).
+
                                   // *** client-related section ***
     int closeHandle(int handle);
         // Close the listener or the connection represented by the specified
@@ -1047,6 +1072,27 @@ class SessionPool {
         // non-zero value otherwise.  The behavior is undefined unless
         // '0 < numAttempts', and '0 < interval' or '1 == numAttempts'.
 
+    int connect(
+              int                                      *handleBuffer,
+              const SessionPool::SessionStateCallback&  callback,
+              const btlso::LocalAddress&                endpoint,
+              int                                       numAttempts,
+              const bsls::TimeInterval&                 interval,
+              SessionFactory                           *factory,
+              void                                     *userData = 0,
+              int                                      *platformErrorCode = 0);
+        // Asynchronously attempt to connect to the local (Unix-domain) server
+        // listening on the specified 'endpoint' path up to the specified
+        // 'numAttempts' delaying for the specified 'interval' between each
+        // attempt; once a connection is successfully established, allocate
+        // and start a session using the specified 'factory', as described
+        // above, and load a handle for the initiated connection into
+        // 'handleBuffer'.  Optionally specify 'platformErrorCode' that will be
+        // loaded with the platform-specific error code if this method fails.
+        // Return 0 on successful initiation, and a non-zero value otherwise.
+        // The behavior is undefined unless '0 < numAttempts', and
+        // '0 < interval' or '1 == numAttempts'.
+
     int import(int                                            *handleBuffer,
                const SessionPool::SessionStateCallback&        callback,
                btlso::StreamSocket<btlso::IPv4Address>        *streamSocket,
@@ -14,7 +14,9 @@
 #include <btlmt_session.h>
 #include <btlmt_sessionfactory.h>
 
+#include <btlb_blob.h>
 #include <btlb_blobutil.h>
+#include <btlb_pooledblobbufferfactory.h>
 
 #include <btlso_flag.h>
 
@@ -37,17 +39,25 @@
 
 #include <btlso_ipv4address.h>
 #include <btlso_inetstreamsocketfactory.h>
+#include <btlso_localaddress.h>
 #include <btlso_socketoptions.h>
 #include <btlso_streamsocket.h>
 
 #include <btlmt_channelpoolchannel.h>
 
 #include <bsls_atomic.h>
+#include <bsls_platform.h>
+#include <bsls_timeinterval.h>
 
 #include <bsl_iostream.h>
 #include <bsl_sstream.h>
+#include <bsl_string.h>
 #include <bsl_cstdlib.h>     // atoi()
 
+#ifdef BSLS_PLATFORM_OS_UNIX
+#include <unistd.h>
+#endif
+
 using namespace BloombergLP;
 using namespace bsl;
 using namespace bdlf::PlaceHolders;
@@ -83,9 +93,11 @@ using namespace bdlf::PlaceHolders;
 // [ 4] int listen(*h, sscb, port, backlog, reuse, *factory, *data, *options);
 // [  ] int listen(*h, sscb, endpoint, backlog, *factory, *data, *options);
 // [  ] int listen(*h, sscb, endpoint, backlog, reuse, *factory, *data, *opts);
+// [18] int listen(*h, sscb, LocalAddress&, backlog, *f, *data, *err);
 // [  ] int closeHandle(int handle);
 // [11] int connect(*h, sscb, *name, port, numAtts, time, *s, *f, *data, mode);
 // [11] int connect(*h, sscb, endpoint, numAtts, time, *s, *f, *userdata);
+// [18] int connect(*h, sscb, LocalAddress&, atts, time, *f, *data, *err);
 // [10] int connect(*h, cb, *name, port, atts, time, *f, *data, mode, *o, *la);
 // [10] int connect(*h, sscb, endpoint, numAtts, time, *f, *userdata, *o, *la);
 // [  ] int import(*h, sscb, *streamSocket, *factory, *sessionFactory, *data);
@@ -103,6 +115,9 @@ using namespace bdlf::PlaceHolders;
 // [ 6] Testing 'stop' updates numSessions correctly
 // [ 5] Testing peer address is set appropriately
 // [ 4] Testing removal of inefficiencies in read callback
+//
+// CONCERNS
+// [18] CONCERN: Local (Unix-domain) sessions transfer data
 //-----------------------------------------------------------------------------
 // [ 1] BREATHING TEST
 // [15] USAGE EXAMPLE
@@ -1423,6 +1438,105 @@ int Tester::portNumber() const
 
 }  // close namespace BTLMT_SESSION_POOL_CASE_ALLOCATE_SHARED_CHANNEL
 
+//=============================================================================
+//                      TEST CASE LOCAL SOCKETS
+//-----------------------------------------------------------------------------
+
+namespace BTLMT_SESSION_POOL_CASE_LOCAL_SOCKETS {
+
+typedef btlso::StreamSocket<btlso::LocalAddress> LocalSocket;
+
+struct Recorder {
+    // This 'struct' records the session established by a call to 'connect',
+    // and the data received by that session.
+
+    bsls::AtomicPointer<btlmt::Session> d_session_p;  // connected session
+    bslmt::Mutex                        d_mutex;
+    bsl::string                         d_received;   // data received,
+                                                      // guarded by 'd_mutex'
+};
+
+void sessionStateCallbackWithRecorder(int             state,
+                                      int             ,
+                                      btlmt::Session *session,
+                                      void           *,
+                                      Recorder       *recorder)
+{
+    if (btlmt::SessionPool::e_SESSION_UP == state) {
+        recorder->d_session_p = session;
+    }
+}
+
+void readCbWithRecorder(int         result,
+                        int        *numNeeded,
+                        btlb::Blob *data,
+                        int         ,
+                        Recorder   *recorder)
+{
+    if (result) {
+        // Session is going down.
+
+        return;                                                       // RETURN
+    }
+
+    const int length = data->length();
+
+    bsl::string received(length, '\0');
+    btlb::BlobUtil::copy(&received[0], *data, 0, length);
+    data->removeAll();
+
+    {
+        bslmt::LockGuard<bslmt::Mutex> guard(&recorder->d_mutex);
+        recorder->d_received += received;
+    }
+
+    *numNeeded = 1;
+}
+
+bool waitForData(Recorder *recorder, bsl::size_t length)
+    // Wait for at most 10 seconds until the specified 'recorder' has received
+    // at least the specified 'length' bytes.  Return 'true' if it has, and
+    // 'false' otherwise.
+{
+    for (int i = 0; i < 1000; ++i) {
+        {
+            bslmt::LockGuard<bslmt::Mutex> guard(&recorder->d_mutex);
+
+            if (length <= recorder->d_received.length()) {
+                return true;                                          // RETURN
+            }
+        }
+        bslmt::ThreadUtil::microSleep(10000);
+    }
+    return false;
+}
+
+bsl::string makePattern(int length)
+    // Return a string of the specified 'length' in which each character
+    // depends on its position.
+{
+    bsl::string pattern(length, '\0');
+    for (int i = 0; i < length; ++i) {
+        pattern[i] = static_cast<char>('a' + i % 26 + i / 26 % 3);
+    }
+    return pattern;
+}
+
+bsl::string socketPath(const char *suffix)
+    // Return a path, unique to this process, for a socket of this test
+    // driver, ending with the specified 'suffix'.
+{
+    bsl::ostringstream oss;
+#ifdef BSLS_PLATFORM_OS_UNIX
+    oss << "/tmp/btlmt_sessionpool.t." << ::getpid() << suffix;
+#else
+    oss << "btlmt_sessionpool.t." << suffix;
+#endif
+    return oss.str();
+}
+
+}  // close namespace BTLMT_SESSION_POOL_CASE_LOCAL_SOCKETS
+
 //=============================================================================
 //                                USAGE EXAMPLE
 //-----------------------------------------------------------------------------
@@ -1867,6 +1981,176 @@ int main(int argc, char *argv[])
     bslma::TestAllocator ta("ta", veryVeryVerbose);
 
     switch (test) { case 0:  // Zero is always the leading case.
+      case 18: {
+        // --------------------------------------------------------------------
+        // TESTING LOCAL (UNIX-DOMAIN) SESSIONS
+        //
+        // Concerns:
+        //: 1 'listen' on a 'btlso::LocalAddress' creates a server that
+        //:   allocates a session for each connection from a local stream
+        //:   socket, and a second server cannot listen on the same path.
+        //:
+        //: 2 Data is transferred in order, and without loss, in both
+        //:   directions of an accepted local session.
+        //:
+        //: 3 'connect' to a 'btlso::LocalAddress' establishes a session with
+        //:   a local server, through which data is exchanged.
+        //
+        // Plan:
+        //: 1 Listen on a path unique to this process, with a factory of
+        //:   sessions echoing the data they receive.  Verify that listening
+        //:   again on the same path fails.  (C-1)
+        //:
+        //: 2 Connect a local client socket to the server, send a pattern
+        //:   through it, and verify that the pattern is echoed back.
+        //:   (C-1..2)
+        //:
+        //: 3 Connect the pool to its own server, with a factory of sessions
+        //:   recording the data they receive.  Write the pattern to the
+        //:   connected session, and verify that the pattern echoed by the
+        //:   accepted session is received.  (C-3)
+        //:
+        //: 4 Stop the pool, and remove the socket file.
+        //
+        // Testing:
+        //   CONCERN: Local (Unix-domain) sessions transfer data
+        //   int listen(*h, sscb, LocalAddress&, backlog, *f, *data, *err);
+        //   int connect(*h, sscb, LocalAddress&, atts, time, *f, *data, *err);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "\nTESTING LOCAL (UNIX-DOMAIN) SESSIONS"
+                          << "\n====================================" << endl;
+
+#ifdef BSLS_PLATFORM_OS_UNIX
+        using namespace BTLMT_SESSION_POOL_GENERIC_TEST_NAMESPACE;
+        namespace TC = BTLMT_SESSION_POOL_CASE_LOCAL_SOCKETS;
+
+        typedef btlmt::SessionPool::SessionPoolStateCallback PoolStateCb;
+        typedef btlmt::SessionPool::SessionStateCallback     SessionStateCb;
+
+        enum { NUM_BYTES = 64 * 1024 };
+
+        const bsl::string PATH = TC::socketPath(".sock");
+        ::unlink(PATH.c_str());
+
+        const btlso::LocalAddress ADDRESS(PATH.c_str());
+        const bsl::string         PATTERN = TC::makePattern(NUM_BYTES);
+
+        btlmt::ChannelPoolConfiguration config;
+        config.setMaxThreads(2);
+
+        TC::Recorder     recorder;
+        BlobReadCallback recordingCb(bdlf::BindUtil::bind(
+                                                       &TC::readCbWithRecorder,
+                                                       _1, _2, _3, _4,
+                                                       &recorder));
+
+        TestFactory echoFactory;
+        TestFactory recordingFactory(&recordingCb);
+
+        PoolStateCb    poolCb    = &poolStateCallback;
+        SessionStateCb serverCb  = &sessionStateCallback;
+        SessionStateCb connectCb = bdlf::BindUtil::bind(
+                                         &TC::sessionStateCallbackWithRecorder,
+                                         _1, _2, _3, _4,
+                                         &recorder);
+
+        btlso::InetStreamSocketFactory<btlso::LocalAddress> socketFactory;
+        TC::LocalSocket *client = 0;
+        {
+            Obj mX(config, poolCb, &ta);
+
+            ASSERT(0 == mX.start());
+
+            if (verbose) cout << "\tListening on a local address.\n";
+
+            int serverHandle = -1;
+            ASSERT(0 == mX.listen(&serverHandle,
+                                  serverCb,
+                                  ADDRESS,
+                                  5,
+                                  &echoFactory));
+
+            int handle        = -1;
+            int platformError = 0;
+            ASSERT(0 != mX.listen(&handle,
+                                  serverCb,
+                                  ADDRESS,
+                                  5,
+                                  &echoFactory,
+                                  0,
+                                  &platformError));
+            if (verbose) { P(platformError); }
+
+            if (verbose) cout << "\tExchanging data with a local client.\n";
+
+            client = socketFactory.allocate();
+            ASSERT(client);
+            ASSERT(0 == client->connect(ADDRESS));
+
+            int numSent = 0;
+            while (numSent < NUM_BYTES) {
+                const int rc = client->write(PATTERN.data() + numSent,
+                                             NUM_BYTES - numSent);
+                if (rc <= 0) {
+                    break;
+                }
+                numSent += rc;
+            }
+            ASSERT(NUM_BYTES == numSent);
+
+            bsl::string echoed(NUM_BYTES, '\0');
+            int         numRead = 0;
+            while (numRead < NUM_BYTES) {
+                const int rc = client->read(&echoed[numRead],
+                                            NUM_BYTES - numRead);
+                if (rc <= 0) {
+                    break;
+                }
+                numRead += rc;
+            }
+            LOOP_ASSERT(numRead, NUM_BYTES == numRead);
+            ASSERT(PATTERN == echoed);
+
+            if (verbose) cout << "\tConnecting to a local server.\n";
+
+            int clientHandle = -1;
+            ASSERT(0 == mX.connect(&clientHandle,
+                                   connectCb,
+                                   ADDRESS,
+                                   1,
+                                   bsls::TimeInterval(0.1),
+                                   &recordingFactory));
+
+            for (int i = 0; i < 1000 && 0 == recorder.d_session_p; ++i) {
+                bslmt::ThreadUtil::microSleep(10000);
+            }
+            btlmt::Session *session = recorder.d_session_p;
+            ASSERT(session);
+
+            if (session) {
+                btlb::PooledBlobBufferFactory blobFactory(4096, &ta);
+                btlb::Blob                    blob(&blobFactory, &ta);
+                btlb::BlobUtil::append(&blob, PATTERN.data(), NUM_BYTES);
+
+                ASSERT(0 == session->channel()->write(blob));
+
+                ASSERT(TC::waitForData(&recorder, NUM_BYTES));
+
+                bslmt::LockGuard<bslmt::Mutex> guard(&recorder.d_mutex);
+                LOOP_ASSERT(recorder.d_received.length(),
+                            PATTERN == recorder.d_received);
+            }
+
+            ASSERT(0 == mX.stop());
+        }
+        socketFactory.deallocate(client);
+
+        ASSERT(0 == ::unlink(PATH.c_str()));
+#else
+        if (verbose) cout << "\tLocal sockets are not supported.\n";
+#endif
+      } break;
       case 17: {
         // --------------------------------------------------------------------
         // TEST USAGE EXAMPLE
@@ -15,6 +15,7 @@ BSLS_IDENT_RCSID(btlmt_tcptimereventmanager_cpp,"$Id$ $CSID$")
 #include <btlso_defaulteventmanager.h>
 #include <btlso_defaulteventmanager_devpoll.h>
 #include <btlso_defaulteventmanager_epoll.h>
+#include <btlso_defaulteventmanager_iouring.h>
 #include <btlso_defaulteventmanager_poll.h>
 #include <btlso_defaulteventmanager_select.h>
 #include <btlso_eventmanager.h>
@@ -387,7 +388,7 @@ class TcpTimerEventManager_ExpiredTimersManager {
 
     // MANIPULATORS
     void invokeCallbacksForExpiredTimers(
-                         bdlcc::TimeQueue<bsl::function<void()> > *timerQueue);
+                       bdlcc::TimingWheel<bsl::function<void()> > *timerQueue);
         // Invoke the callbacks for all timers registered with the specified
         // 'timerQueue' that have expired.
 
@@ -897,7 +898,7 @@ TcpTimerEventManager_ExpiredTimersManager::
 // MANIPULATORS
 void
 TcpTimerEventManager_ExpiredTimersManager::invokeCallbacksForExpiredTimers(
-                          bdlcc::TimeQueue<bsl::function<void()> > *timerQueue)
+                        bdlcc::TimingWheel<bsl::function<void()> > *timerQueue)
 {
     timerQueue->popLE(bdlt::CurrentTime::now(), &d_callbacks);
 
@@ -944,7 +945,7 @@ void TcpTimerEventManager_ExpiredTimersManager::disableAllCallbacks()
                          // --------------------------
 
 // PRIVATE METHODS
-void TcpTimerEventManager::initialize()
+void TcpTimerEventManager::initialize(Hint hint)
 {
     BSLS_ASSERT(d_allocator_p);
 
@@ -952,7 +953,13 @@ void TcpTimerEventManager::initialize()
 
     // Initialize the (managed) event manager.
 #ifdef BSLS_PLATFORM_OS_LINUX
-    if (btlso::DefaultEventManager<>::isSupported()) {
+    if (e_BATCH_SUBMISSION == hint
+     && btlso::DefaultEventManager<btlso::Platform::IO_URING>::isSupported()) {
+        d_manager_p = new (*d_allocator_p)
+          btlso::DefaultEventManager<btlso::Platform::IO_URING>(metrics,
+                                                                d_allocator_p);
+    }
+    else if (btlso::DefaultEventManager<>::isSupported()) {
         d_manager_p = new (*d_allocator_p)
                                    btlso::DefaultEventManager<>(metrics,
                                                                 d_allocator_p);
@@ -963,6 +970,8 @@ void TcpTimerEventManager::initialize()
                                                                 d_allocator_p);
     }
 #else
+    (void)hint;
+
     d_manager_p = new (*d_allocator_p)
                                    btlso::DefaultEventManager<>(metrics,
                                                                 d_allocator_p);
@@ -1310,11 +1319,33 @@ TcpTimerEventManager::TcpTimerEventManager(
 , d_numControlChannelReinitializations(0)
 , d_allocator_p(bslma::Default::allocator(threadSafeAllocator))
 {
-    initialize();
+    initialize(e_NO_HINT);
+}
+
+TcpTimerEventManager::TcpTimerEventManager(
+                                        bool               collectTimeMetrics,
+                                        bslma::Allocator  *threadSafeAllocator)
+: d_requestPool(sizeof(TcpTimerEventManager_Request), threadSafeAllocator)
+, d_requestQueue(threadSafeAllocator)
+, d_dispatcher(bslmt::ThreadUtil::invalidHandle())
+, d_state(e_DISABLED)
+, d_terminateThread(0)
+, d_expiredTimersManager_p(0)
+, d_timerQueue(threadSafeAllocator)
+, d_metrics(btlso::TimeMetrics::e_MIN_NUM_CATEGORIES,
+            btlso::TimeMetrics::e_IO_BOUND,
+            threadSafeAllocator)
+, d_collectMetrics(collectTimeMetrics)
+, d_numTotalSocketEvents(0)
+, d_numControlChannelReinitializations(0)
+, d_allocator_p(bslma::Default::allocator(threadSafeAllocator))
+{
+    initialize(e_NO_HINT);
 }
 
 TcpTimerEventManager::TcpTimerEventManager(
                                         bool               collectTimeMetrics,
+                                        bool               poolTimerMemory,
                                         bslma::Allocator  *threadSafeAllocator)
 : d_requestPool(sizeof(TcpTimerEventManager_Request), threadSafeAllocator)
 , d_requestQueue(threadSafeAllocator)
@@ -1331,10 +1362,13 @@ TcpTimerEventManager::TcpTimerEventManager(
 , d_numControlChannelReinitializations(0)
 , d_allocator_p(bslma::Default::allocator(threadSafeAllocator))
 {
-    initialize();
+    (void)poolTimerMemory;
+
+    initialize(e_NO_HINT);
 }
 
 TcpTimerEventManager::TcpTimerEventManager(
+                                        Hint               hint,
                                         bool               collectTimeMetrics,
                                         bool               poolTimerMemory,
                                         bslma::Allocator  *threadSafeAllocator)
@@ -1344,7 +1378,7 @@ TcpTimerEventManager::TcpTimerEventManager(
 , d_state(e_DISABLED)
 , d_terminateThread(0)
 , d_expiredTimersManager_p(0)
-, d_timerQueue(poolTimerMemory, threadSafeAllocator)
+, d_timerQueue(threadSafeAllocator)
 , d_metrics(btlso::TimeMetrics::e_MIN_NUM_CATEGORIES,
             btlso::TimeMetrics::e_IO_BOUND,
             threadSafeAllocator)
@@ -1353,7 +1387,9 @@ TcpTimerEventManager::TcpTimerEventManager(
 , d_numControlChannelReinitializations(0)
 , d_allocator_p(bslma::Default::allocator(threadSafeAllocator))
 {
-    initialize();
+    (void)poolTimerMemory;
+
+    initialize(hint);
 }
 
 TcpTimerEventManager::TcpTimerEventManager(
@@ -51,6 +51,16 @@ BSLS_IDENT("$Id: $")
 // should be provided to this event manager at construction for optimal
 // performance.
 //
+// On Linux, an event manager created with the 'e_BATCH_SUBMISSION' hint
+// monitors socket events with
+// 'btlso::DefaultEventManager<btlso::Platform::IO_URING>' if the running
+// kernel supports it.  With 'io_uring', the socket event registrations made
+// while processing one batch of events (e.g., the write registrations of a
+// 'btlmt::ChannelPool' having queued data) are submitted to the kernel by the
+// same system call that waits for the next batch.  Otherwise (and on other
+// platforms), the 'epoll' (or, failing that, 'poll') event manager is used on
+// Linux, and the platform's default event manager elsewhere.
+//
 ///Thread Safety
 ///-------------
 // This event manager is *thread* *safe*, i.e., operations can be invoked
@@ -81,9 +91,9 @@ BSLS_IDENT("$Id: $")
 //  +========================================================================+
 //  |        FUNCTION          | EXPECTED COMPLEXITY | WORST CASE COMPLEXITY |
 //  +------------------------------------------------------------------------+
-//  | registerTimer            |      O(log[T])      |      O(log[T])        |
+//  | registerTimer            |        O(1)         |        O(1)           |
 //  +------------------------------------------------------------------------+
-//  | deregisterTimer          |        O(T)         |        O(T)           |
+//  | deregisterTimer          |        O(1)         |        O(T)           |
 //  +------------------------------------------------------------------------+
 //  | registerSocketEvent      |        O(1)         |        O(S)           |
 //  +------------------------------------------------------------------------+
@@ -106,6 +116,12 @@ BSLS_IDENT("$Id: $")
 //  | numSocketEvents          |        O(1)         |        O(S)           |
 //  +========================================================================+
 //..
+// Timers are held in a 'bdlcc::TimingWheel', so that registering,
+// rescheduling, and deregistering a timer takes constant time, and does not
+// allocate memory once the number of timers has reached its peak (other than
+// for copying the callback).  The worst case of 'deregisterTimer' occurs when
+// it is called from a timer callback, while the other expired timers are
+// being invoked.
 //
 ///Usage
 ///-----
@@ -225,8 +241,8 @@ BSLS_IDENT("$Id: $")
 #include <bdlcc_queue.h>
 #endif
 
-#ifndef INCLUDED_BDLCC_TIMEQUEUE
-#include <bdlcc_timequeue.h>
+#ifndef INCLUDED_BDLCC_TIMINGWHEEL
+#include <bdlcc_timingwheel.h>
 #endif
 
 #ifndef INCLUDED_BDLMA_CONCURRENTPOOL
@@ -372,6 +388,16 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
     // from dedicated threads, created internally for this purpose by this
     // component.
 
+  public:
+    // TYPES
+    enum Hint {
+        e_NO_HINT          = 0,  // use the default socket event multiplexer
+        e_BATCH_SUBMISSION = 1   // prefer a multiplexer submitting the
+                                 // registrations of a batch of events along
+                                 // with the wait for the next batch
+    };
+
+  private:
     // PRIVATE TYPES
     enum State {
         e_ENABLED  = 0,  // dispatching thread is running
@@ -442,8 +468,8 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
                                                   // only in the dispatcher
                                                   // thread
 
-    bdlcc::TimeQueue<bsl::function<void()> >
-                                   d_timerQueue;      // queue of registered
+    bdlcc::TimingWheel<bsl::function<void()> >
+                                   d_timerQueue;      // wheel of registered
                                                       // timers
 
     mutable bslma::ManagedPtr<ControlChannel>
@@ -486,7 +512,7 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
     TcpTimerEventManager& operator=(const TcpTimerEventManager&);
 
     // PRIVATE MANIPULATORS
-    void initialize();
+    void initialize(Hint hint);
         // Initialize this event manager.
 
     void dispatchThreadEntryPoint();
@@ -519,15 +545,28 @@ class TcpTimerEventManager : public btlso::TimerEventManager {
         // manager will provide a categorization of the time it spends
         // processing data via 'timeMetrics()', and if 'collectTimeMetrics' is
         // 'false' the value of 'timeMetrics()' is unspecified.  Optionally
-        // specify 'poolTimerMemory' indicating whether the memory used for
-        // internal timers should be pooled.  If 'poolTimerMemory' is
-        // unspecified then the memory used for allocating timers will not be
-        // pooled.  Optionally specify a 'basicAllocator' used to supply
-        // memory.  If 'basicAllocator' is 0, the currently installed default
-        // allocator is used.  The behavior is undefined unless
-        // 'basicAllocator' refers to a *thread* *safe* allocator.  Note that
-        // the dispatcher thread is NOT started by this method (i.e., it must
-        // be started explicitly).
+        // specify 'poolTimerMemory', which is ignored (the memory used for
+        // internal timers is always reused).  Optionally specify a
+        // 'basicAllocator' used to supply memory.  If 'basicAllocator' is 0,
+        // the currently installed default allocator is used.  The behavior is
+        // undefined unless 'basicAllocator' refers to a *thread* *safe*
+        // allocator.  Note that the dispatcher thread is NOT started by this
+        // method (i.e., it must be started explicitly).
+
+    TcpTimerEventManager(Hint              hint,
+                         bool              collectTimeMetrics,
+                         bool              poolTimerMemory,
+                         bslma::Allocator *basicAllocator = 0);
+        // Create an event manager using the specified 'hint' to select the
+        // socket event multiplexer (see {Description}), the specified
+        // 'collectTimeMetrics' indicating whether this event manager should
+        // collect timing metrics, and the specified 'poolTimerMemory', which
+        // is ignored (the memory used for internal timers is always reused).
+        // Optionally specify a 'basicAllocator' used to supply memory.  If
+        // 'basicAllocator' is 0, the currently installed default allocator is
+        // used.  The behavior is undefined unless 'basicAllocator' refers to a
+        // *thread* *safe* allocator.  Note that the dispatcher thread is NOT
+        // started by this method (i.e., it must be started explicitly).
 
     TcpTimerEventManager(btlso::EventManager *rawEventManager,
                          bslma::Allocator    *basicAllocator = 0);
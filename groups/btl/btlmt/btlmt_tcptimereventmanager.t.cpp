@@ -62,6 +62,7 @@ using namespace BloombergLP;
 // [12] TcpTimerEventManager(bslma::Allocator *basicAllocator = 0);
 // [12] TcpTimerEventManager(collectTimeMetrics, *basicAllocator = 0);
 // [12] TcpTimerEventManager(collectTimeMetrics, poolTimer, *ba = 0);
+// [12] TcpTimerEventManager(hint, collectTimeMetrics, poolTimer, *ba = 0);
 // [  ] TcpTimerEventManager(rawEventManager, *basicAllocator = 0);
 // [12] ~TcpTimerEventManager();
 //
@@ -259,6 +260,16 @@ void waitForSomeTime()
     bslmt::ThreadUtil::microSleep(10000); // 10 ms
 }
 
+void readAndCount(btlso::SocketHandle::Handle  handle,
+                  bsls::AtomicInt             *numCalls)
+    // Read the data available on the specified 'handle' and increment the
+    // specified 'numCalls'.
+{
+    char buffer[64];
+    btlso::SocketImpUtil::read(buffer, handle, sizeof buffer);
+    ++*numCalls;
+}
+
 }  // close namespace TEST_CASE_COLLECT_TIME_METRICS
 
 //=============================================================================
@@ -1540,10 +1551,14 @@ int main(int argc, char *argv[])
         //           Verify 'timeMetrics' reflects a I/O bound (the default
         //           state).
         //
+        //   (Black Box) 4) Create a tcp timer event manager with each hint,
+        //           and verify that socket events are dispatched.
+        //
         // Testing:
         //  TcpTimerEventManager(bslma::Allocator *basicAllocator = 0);
         //  TcpTimerEventManager(collectTimeMetrics, *basicAllocator = 0);
         //  TcpTimerEventManager(collectTimeMetrics, poolTimer, *ba = 0);
+        //  TcpTimerEventManager(hint, collectTimeMetrics, poolTimer, *ba = 0);
         //  ~TcpTimerEventManager();
         //  bool hasTimeMetrics() const;
         // ----------------------------------------------------------------
@@ -1568,6 +1583,8 @@ int main(int argc, char *argv[])
             Obj mI(false, &testAllocator);
             Obj mJ(false, true, &testAllocator);
             Obj mK(false, false, &testAllocator);
+            Obj mL(Obj::e_NO_HINT, true, false, &testAllocator);
+            Obj mM(Obj::e_BATCH_SUBMISSION, false, true, &testAllocator);
 
             const Obj& A = mA;
             const Obj& G = mG;
@@ -1575,12 +1592,16 @@ int main(int argc, char *argv[])
             const Obj& I = mI;
             const Obj& J = mJ;
             const Obj& K = mK;
+            const Obj& L = mL;
+            const Obj& M = mM;
             ASSERT(true  == A.hasTimeMetrics());
             ASSERT(false == G.hasTimeMetrics());
             ASSERT(true  == H.hasTimeMetrics());
             ASSERT(false == I.hasTimeMetrics());
             ASSERT(false == J.hasTimeMetrics());
             ASSERT(false == K.hasTimeMetrics());
+            ASSERT(true  == L.hasTimeMetrics());
+            ASSERT(false == M.hasTimeMetrics());
         }
         {
             if (veryVerbose) {
@@ -1654,6 +1675,54 @@ int main(int argc, char *argv[])
             btlso::SocketImpUtil::close(handles[1]);
 
         }
+        {
+            if (veryVerbose) {
+                cout << "\tVerify socket events are dispatched with each hint"
+                     << endl;
+            }
+
+            const Obj::Hint HINTS[] = { Obj::e_NO_HINT,
+                                        Obj::e_BATCH_SUBMISSION };
+            const int NUM_HINTS = sizeof HINTS / sizeof *HINTS;
+
+            for (int ti = 0; ti < NUM_HINTS; ++ti) {
+                const Obj::Hint HINT = HINTS[ti];
+
+                btlso::SocketHandle::Handle handles[2];
+                ASSERT(0 ==
+                       btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+                             handles, btlso::SocketImpUtil::k_SOCKET_STREAM));
+
+                bsls::AtomicInt numCalls(0);
+
+                Obj mX(HINT, false, false, &testAllocator);
+                bsl::function<void()> callback(
+                                    bdlf::BindUtil::bind(&readAndCount,
+                                                         handles[1],
+                                                         &numCalls));
+                ASSERT(0 == mX.registerSocketEvent(handles[1],
+                                                   btlso::EventType::e_READ,
+                                                   callback));
+                ASSERT(0 == mX.enable());
+
+                for (int i = 1; i <= 3; ++i) {
+                    char byte = 'a';
+                    LOOP_ASSERT(ti, 1 == btlso::SocketImpUtil::write(
+                                                                handles[0],
+                                                                &byte,
+                                                                1));
+                    for (int j = 0; j < 1000 && i > numCalls; ++j) {
+                        bslmt::ThreadUtil::microSleep(1000); // 1 ms
+                    }
+                    LOOP3_ASSERT(ti, i, numCalls, i == numCalls);
+                }
+
+                ASSERT(0 == mX.disable());
+
+                btlso::SocketImpUtil::close(handles[0]);
+                btlso::SocketImpUtil::close(handles[1]);
+            }
+        }
       } break;
       case 11: {
         // ----------------------------------------------------------------
@@ -42,6 +42,8 @@ BSLS_IDENT("$Id: $")
 //  +------------------------------------------------------------------------+
 //  | <btlso::Platform::EPOLL>   |         epoll         |       Linux*      |
 //  +------------------------------------------------------------------------+
+//  | <btlso::Platform::IO_URING>|        io_uring       |  Linux (5.12+)    |
+//  +------------------------------------------------------------------------+
 //  | <btlso::Platform::POLLSET> |        pollset        |       AIX*        |
 //  +------------------------------------------------------------------------+
 //  | <btlso::Platform::POLL>    |          poll         | Solaris, AIX,     |
@@ -79,7 +81,16 @@ BSLS_IDENT("$Id: $")
 //  btlso::DefaultEventManager<btlso::Platform::DEVPOLL> fastEventManager;
 //..
 // Note that '/dev/poll' is available only on Solaris and this instantiation
-// fails (at compile time) on other platforms.
+// fails (at compile time) on other platforms.  Similarly, the 'io_uring' event
+// manager is available only on Linux, and additionally requires a check at run
+// time that the kernel supports it:
+//..
+//  typedef btlso::DefaultEventManager<btlso::Platform::IO_URING> IoUring;
+//  if (IoUring::isSupported()) {
+//      IoUring ringEventManager(&metrics);
+//      // ...
+//  }
+//..
 
 #ifndef INCLUDED_BTLSCM_VERSION
 #include <btlscm_version.h>
@@ -93,6 +104,10 @@ BSLS_IDENT("$Id: $")
 #include <btlso_defaulteventmanager_epoll.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_IOURING
+#include <btlso_defaulteventmanager_iouring.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_POLL
 #include <btlso_defaulteventmanager_poll.h>
 #endif
@@ -0,0 +1,933 @@
+// btlso_defaulteventmanager_iouring.cpp                              -*-C++-*-
+#include <btlso_defaulteventmanager_iouring.h>
+
+#include <bsls_ident.h>
+BSLS_IDENT_RCSID(btlso_defaulteventmanager_iouring_cpp,"$Id$ $CSID$")
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+#include <btlso_flag.h>
+#include <btlso_timemetrics.h>
+
+#include <bdlb_bitmaskutil.h>
+#include <bdlb_bitutil.h>
+#include <bdlt_currenttime.h>
+
+#include <bslma_default.h>
+
+#include <bsls_assert.h>
+#include <bsls_timeinterval.h>
+
+#include <bsl_algorithm.h>
+#include <bsl_c_errno.h>
+#include <bsl_cstdio.h>
+#include <bsl_cstring.h>
+
+#include <linux/version.h>
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 12, 0)
+#include <linux/io_uring.h>
+#define BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE 1
+#endif
+
+// IMPLEMENTATION NOTES
+// --------------------
+// The ring is driven directly through the 'io_uring_setup' and
+// 'io_uring_enter' system calls, rather than through 'liburing', to avoid an
+// external dependency.  The memory ordering rules are those of the kernel's
+// 'io_uring' documentation: the kernel-owned indices ('sq.head' and 'cq.tail')
+// are read with acquire semantics, and the user-owned indices ('sq.tail' and
+// 'cq.head') are written with release semantics.
+//
+// Each registered socket has at most one poll request that is meant to be
+// outstanding, identified by a 'user_data' value combining the socket handle
+// (in the low 32 bits) with a "generation" (in the high 32 bits) that is
+// unique among the requests of this event manager.  Every change of the
+// events monitored for a socket cancels the current request, if any, and
+// queues a new one with a new generation; completions of requests whose
+// generation is not the current one of a registered socket (i.e., cancelled
+// requests, or requests that completed before their cancellation was
+// processed) are ignored.  Generation 0 is reserved for the 'user_data' of
+// cancellation requests, whose completions are always ignored.
+//
+// Requests, including the re-arming of one-shot poll requests after their
+// callbacks are invoked, are only queued in the submission ring; they are
+// submitted by the 'io_uring_enter' call that waits for completions in the
+// next 'dispatch'.  Note that a request queued for a handle that is closed
+// (and possibly reused) before the request is submitted applies to whatever
+// file the handle refers to at submission time; this is harmless, since
+// such a request belongs to a deregistered socket, is cancelled by a request
+// queued after it, and its completion is ignored.
+
+namespace BloombergLP {
+
+namespace btlso {
+
+namespace {
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+
+enum {
+    k_NUM_ENTRIES            = 256,   // submission queue size
+
+    k_NUM_COMPLETION_ENTRIES = 4096,  // completion queue size (the kernel
+                                      // holds completions that overflow it)
+
+    k_CANCEL_TAG             = 0      // 'user_data' of cancellation requests
+};
+
+const unsigned int k_REQUIRED_FEATURES = IORING_FEAT_SINGLE_MMAP
+                                       | IORING_FEAT_NODROP
+                                       | IORING_FEAT_EXT_ARG
+                                       | IORING_FEAT_NATIVE_WORKERS;
+    // 'IORING_FEAT_NATIVE_WORKERS' is not used, but identifies kernels (5.12
+    // and later) that charge ring memory to the memory cgroup rather than to
+    // 'RLIMIT_MEMLOCK', whose (typically small) per-user limit would
+    // otherwise cap the number of event managers a process can create.
+
+inline
+unsigned int loadAcquire(const unsigned int *address)
+    // Return the value at the specified 'address', loaded with acquire
+    // semantics.
+{
+    return __atomic_load_n(address, __ATOMIC_ACQUIRE);
+}
+
+inline
+void storeRelease(unsigned int *address, unsigned int value)
+    // Store the specified 'value' at the specified 'address' with release
+    // semantics.
+{
+    __atomic_store_n(address, value, __ATOMIC_RELEASE);
+}
+
+inline
+int setup(unsigned int numEntries, struct io_uring_params *params)
+    // Invoke the 'io_uring_setup' system call with the specified 'numEntries'
+    // and 'params', and return its result.
+{
+    return static_cast<int>(::syscall(__NR_io_uring_setup,
+                                      numEntries,
+                                      params));
+}
+
+#endif
+
+int sleep(int                       *resultErrno,
+          const bsls::TimeInterval&  timeout,
+          int                        flags,
+          btlso::TimeMetrics        *metrics)
+{
+    bsls::TimeInterval now(bdlt::CurrentTime::now());
+
+    while (timeout > now) {
+        bsls::TimeInterval currTimeout(timeout - now);
+        struct timespec    ts;
+
+        ts.tv_sec  = static_cast<time_t>(currTimeout.seconds());
+        ts.tv_nsec = static_cast<long>(currTimeout.nanoseconds());
+
+        // Sleep till it's time.
+
+        int savedErrno;
+        int rc;
+        if (metrics) {
+            metrics->switchTo(btlso::TimeMetrics::e_IO_BOUND);
+            rc = nanosleep(&ts, 0);
+            savedErrno = errno;
+            metrics->switchTo(btlso::TimeMetrics::e_CPU_BOUND);
+        }
+        else {
+            rc = nanosleep(&ts, 0);
+            savedErrno = errno;
+        }
+
+        errno = 0;
+        *resultErrno = savedErrno;
+        if (0 > rc) {
+            BSLS_ASSERT(savedErrno == EINTR);
+
+            if (flags & btlso::Flag::k_ASYNC_INTERRUPT) {
+                // We're allowing async interrupts.
+
+                return -1;                                            // RETURN
+            }
+        }
+        now = bdlt::CurrentTime::now();
+    }
+    return 0;
+}
+
+const uint32_t k_POLLIN_EVENTS = bdlb::BitMaskUtil::eq(EventType::e_READ) |
+                                 bdlb::BitMaskUtil::eq(EventType::e_ACCEPT);
+
+const uint32_t k_POLLOUT_EVENTS = bdlb::BitMaskUtil::eq(EventType::e_WRITE) |
+                                  bdlb::BitMaskUtil::eq(EventType::e_CONNECT);
+
+inline
+bsls::Types::Uint64 makeUserData(int handle, unsigned int generation)
+    // Return the 'user_data' of the poll request having the specified
+    // 'generation' for the specified 'handle'.
+{
+    return static_cast<bsls::Types::Uint64>(generation) << 32
+         | static_cast<unsigned int>(handle);
+}
+
+}  // close unnamed namespace
+
+                    // -------------------------------------
+                    // class DefaultEventManager_IoUringRing
+                    // -------------------------------------
+
+// PRIVATE MANIPULATORS
+int DefaultEventManager_IoUringRing::enter(unsigned int  numToSubmit,
+                                           unsigned int  minComplete,
+                                           unsigned int  flags,
+                                           void         *argument,
+                                           bsl::size_t   argumentSize)
+{
+    return static_cast<int>(::syscall(__NR_io_uring_enter,
+                                      d_ringFd,
+                                      numToSubmit,
+                                      minComplete,
+                                      flags,
+                                      argument,
+                                      argumentSize));
+}
+
+int DefaultEventManager_IoUringRing::reap(bsl::vector<Completion> *completions)
+{
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+    const unsigned int head = *d_cqHead_p;
+    const unsigned int tail = loadAcquire(d_cqTail_p);
+
+    const struct io_uring_cqe *cqes =
+                               static_cast<const io_uring_cqe *>(d_cqes_p);
+
+    for (unsigned int i = head; i != tail; ++i) {
+        const struct io_uring_cqe& cqe = cqes[i & d_cqMask];
+
+        Completion completion;
+        completion.d_userData = cqe.user_data;
+        completion.d_result   = cqe.res;
+        completions->push_back(completion);
+    }
+
+    storeRelease(d_cqHead_p, tail);
+
+    return static_cast<int>(tail - head);
+#else
+    (void)completions;
+    return 0;
+#endif
+}
+
+// CLASS METHODS
+bool DefaultEventManager_IoUringRing::isSupported()
+{
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+    struct io_uring_params params;
+    bsl::memset(&params, 0, sizeof params);
+
+    const int fd = setup(1, &params);
+    if (0 > fd) {
+        return false;                                                 // RETURN
+    }
+
+    bool result = k_REQUIRED_FEATURES
+                                   == (params.features & k_REQUIRED_FEATURES);
+
+    if (result) {
+        // Poll requests were introduced before 'IORING_FEAT_EXT_ARG', but
+        // verify that they have not been restricted.
+
+        enum { k_NUM_PROBE_OPS = IORING_OP_POLL_REMOVE + 1 };
+
+        union {
+            struct io_uring_probe d_probe;
+            char                  d_buffer[
+                                      sizeof(struct io_uring_probe)
+                                      + k_NUM_PROBE_OPS
+                                        * sizeof(struct io_uring_probe_op)];
+        } probe;
+        bsl::memset(&probe, 0, sizeof probe);
+
+        const int rc = static_cast<int>(::syscall(__NR_io_uring_register,
+                                                  fd,
+                                                  IORING_REGISTER_PROBE,
+                                                  &probe.d_probe,
+                                                  k_NUM_PROBE_OPS));
+
+        result = 0 == rc
+              && probe.d_probe.last_op >= IORING_OP_POLL_REMOVE
+              && (probe.d_probe.ops[IORING_OP_POLL_ADD].flags
+                                                      & IO_URING_OP_SUPPORTED)
+              && (probe.d_probe.ops[IORING_OP_POLL_REMOVE].flags
+                                                      & IO_URING_OP_SUPPORTED);
+    }
+
+    ::close(fd);
+    return result;
+#else
+    return false;
+#endif
+}
+
+// CREATORS
+DefaultEventManager_IoUringRing::DefaultEventManager_IoUringRing()
+: d_ringFd(-1)
+, d_rings_p(0)
+, d_ringsSize(0)
+, d_entries_p(0)
+, d_entriesSize(0)
+, d_sqHead_p(0)
+, d_sqTail_p(0)
+, d_sqFlags_p(0)
+, d_sqArray_p(0)
+, d_sqMask(0)
+, d_sqEntries(0)
+, d_sqLocalTail(0)
+, d_cqHead_p(0)
+, d_cqTail_p(0)
+, d_cqMask(0)
+, d_cqes_p(0)
+{
+}
+
+DefaultEventManager_IoUringRing::~DefaultEventManager_IoUringRing()
+{
+    close();
+}
+
+// MANIPULATORS
+int DefaultEventManager_IoUringRing::open(unsigned int numEntries,
+                                          unsigned int numCompletionEntries)
+{
+    BSLS_ASSERT(-1 == d_ringFd);
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+    struct io_uring_params params;
+    bsl::memset(&params, 0, sizeof params);
+    params.flags      = IORING_SETUP_CQSIZE;
+    params.cq_entries = numCompletionEntries;
+
+    d_ringFd = setup(numEntries, &params);
+    if (0 > d_ringFd) {
+        const int savedErrno = errno;
+        d_ringFd = -1;
+        return savedErrno;                                            // RETURN
+    }
+
+    if (k_REQUIRED_FEATURES != (params.features & k_REQUIRED_FEATURES)) {
+        close();
+        return ENOSYS;                                                // RETURN
+    }
+
+    // With 'IORING_FEAT_SINGLE_MMAP', both rings share one mapping.
+
+    d_ringsSize = bsl::max(
+           params.sq_off.array + params.sq_entries * sizeof(unsigned int),
+           params.cq_off.cqes + params.cq_entries
+                                               * sizeof(struct io_uring_cqe));
+
+    d_rings_p = ::mmap(0,
+                       d_ringsSize,
+                       PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE,
+                       d_ringFd,
+                       IORING_OFF_SQ_RING);
+    if (MAP_FAILED == d_rings_p) {
+        const int savedErrno = errno;
+        d_rings_p = 0;
+        close();
+        return savedErrno;                                            // RETURN
+    }
+
+    d_entriesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    d_entries_p   = ::mmap(0,
+                           d_entriesSize,
+                           PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE,
+                           d_ringFd,
+                           IORING_OFF_SQES);
+    if (MAP_FAILED == d_entries_p) {
+        const int savedErrno = errno;
+        d_entries_p = 0;
+        close();
+        return savedErrno;                                            // RETURN
+    }
+
+    char *rings = static_cast<char *>(d_rings_p);
+
+    d_sqHead_p    = reinterpret_cast<unsigned int *>(rings
+                                                         + params.sq_off.head);
+    d_sqTail_p    = reinterpret_cast<unsigned int *>(rings
+                                                         + params.sq_off.tail);
+    d_sqFlags_p   = reinterpret_cast<unsigned int *>(rings
+                                                        + params.sq_off.flags);
+    d_sqArray_p   = reinterpret_cast<unsigned int *>(rings
+                                                        + params.sq_off.array);
+    d_sqMask      = *reinterpret_cast<unsigned int *>(rings
+                                                    + params.sq_off.ring_mask);
+    d_sqEntries   = params.sq_entries;
+    d_sqLocalTail = *d_sqTail_p;
+
+    d_cqHead_p    = reinterpret_cast<unsigned int *>(rings
+                                                         + params.cq_off.head);
+    d_cqTail_p    = reinterpret_cast<unsigned int *>(rings
+                                                         + params.cq_off.tail);
+    d_cqMask      = *reinterpret_cast<unsigned int *>(rings
+                                                    + params.cq_off.ring_mask);
+    d_cqes_p      = rings + params.cq_off.cqes;
+
+    return 0;
+#else
+    (void)numEntries;
+    (void)numCompletionEntries;
+    return ENOSYS;
+#endif
+}
+
+void DefaultEventManager_IoUringRing::close()
+{
+    if (d_entries_p) {
+        ::munmap(d_entries_p, d_entriesSize);
+        d_entries_p = 0;
+    }
+    if (d_rings_p) {
+        ::munmap(d_rings_p, d_ringsSize);
+        d_rings_p = 0;
+    }
+    if (-1 != d_ringFd) {
+        int rc = ::close(d_ringFd);
+        (void)rc; BSLS_ASSERT(0 == rc);
+        d_ringFd = -1;
+    }
+}
+
+void *DefaultEventManager_IoUringRing::nextSubmission()
+{
+    BSLS_ASSERT(-1 != d_ringFd);
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+    while (d_sqLocalTail - loadAcquire(d_sqHead_p) == d_sqEntries) {
+        // The submission queue is full: submit the queued requests without
+        // waiting for completions.
+
+        storeRelease(d_sqTail_p, d_sqLocalTail);
+
+        const int rc = enter(d_sqEntries, 0, 0, 0, 0);
+        (void)rc; BSLS_ASSERT_OPT(0 <= rc || EINTR == errno);
+    }
+
+    const unsigned int index = d_sqLocalTail & d_sqMask;
+    ++d_sqLocalTail;
+
+    d_sqArray_p[index] = index;
+
+    struct io_uring_sqe *entry =
+                            static_cast<struct io_uring_sqe *>(d_entries_p)
+                                                                       + index;
+    bsl::memset(entry, 0, sizeof *entry);
+    return entry;
+#else
+    return 0;
+#endif
+}
+
+int DefaultEventManager_IoUringRing::submitAndWait(
+                                  bsl::vector<Completion>   *completions,
+                                  bool                       wait,
+                                  const bsls::TimeInterval  *timeout)
+{
+    BSLS_ASSERT(completions);
+    BSLS_ASSERT(-1 != d_ringFd);
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+    completions->clear();
+
+    // Note that requests published by an interrupted submission in
+    // 'nextSubmission' may still be pending.
+
+    const unsigned int numToSubmit = d_sqLocalTail - loadAcquire(d_sqHead_p);
+    storeRelease(d_sqTail_p, d_sqLocalTail);
+
+    // Do not wait if completions are already available.
+
+    const bool block = wait
+                    && *d_cqHead_p == loadAcquire(d_cqTail_p);
+
+    if (numToSubmit || block) {
+        struct __kernel_timespec ts;
+        struct io_uring_getevents_arg argument;
+        bsl::memset(&argument, 0, sizeof argument);
+        argument.sigmask_sz = _NSIG / 8;
+
+        if (timeout) {
+            ts.tv_sec  = timeout->seconds();
+            ts.tv_nsec = timeout->nanoseconds();
+            argument.ts = reinterpret_cast<bsls::Types::Uint64>(&ts);
+        }
+
+        const int rc = enter(numToSubmit,
+                             block ? 1 : 0,
+                             IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG,
+                             &argument,
+                             sizeof argument);
+
+        if (0 > rc && ETIME != errno) {
+            BSLS_ASSERT(EINTR == errno || EBUSY == errno || EAGAIN == errno);
+            if (EINTR == errno) {
+                return -1;                                            // RETURN
+            }
+        }
+    }
+
+    int numCompletions = reap(completions);
+
+    if (loadAcquire(d_sqFlags_p) & IORING_SQ_CQ_OVERFLOW) {
+        // The kernel is holding completions that did not fit in the
+        // completion queue; flush them into the queue.
+
+        enter(0, 0, IORING_ENTER_GETEVENTS, 0, 0);
+        numCompletions += reap(completions);
+    }
+
+    return numCompletions;
+#else
+    (void)wait;
+    (void)timeout;
+    completions->clear();
+    return 0;
+#endif
+}
+
+           // ---------------------------------------------
+           // class DefaultEventManager<Platform::IO_URING>
+           // ---------------------------------------------
+
+typedef btlso::DefaultEventManager<btlso::Platform::IO_URING> EventManagerName;
+    // Alias for brevity.
+
+// PRIVATE MANIPULATORS
+void EventManagerName::arm(const SocketHandle::Handle&  handle,
+                           uint32_t                     eventMask,
+                           SocketState                 *state)
+{
+    BSLS_ASSERT(state);
+    BSLS_ASSERT(eventMask);
+
+    disarm(handle, state);
+
+    if (0 == ++d_generation) {
+        d_generation = 1;
+    }
+    state->d_generation = d_generation;
+    state->d_isArmed    = true;
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+    int pollinEvents  = bdlb::BitUtil::numBitsSet(eventMask & k_POLLIN_EVENTS);
+    int polloutEvents = bdlb::BitUtil::numBitsSet(eventMask
+                                                          & k_POLLOUT_EVENTS);
+    BSLS_ASSERT(2 > pollinEvents);
+    BSLS_ASSERT(2 > polloutEvents);
+    BSLS_ASSERT(!(pollinEvents && polloutEvents) ||
+                (eventMask & bdlb::BitMaskUtil::eq(EventType::e_READ) &&
+                 eventMask & bdlb::BitMaskUtil::eq(EventType::e_WRITE)));
+
+    unsigned int pollEvents = (POLLIN * pollinEvents)
+                            | (POLLOUT * polloutEvents);
+#if defined(BSLS_PLATFORM_IS_BIG_ENDIAN)
+    pollEvents = __builtin_bswap32(pollEvents);
+#endif
+
+    struct io_uring_sqe *entry =
+                   static_cast<struct io_uring_sqe *>(d_ring.nextSubmission());
+    entry->opcode        = IORING_OP_POLL_ADD;
+    entry->fd            = handle;
+    entry->poll32_events = pollEvents;
+    entry->user_data     = makeUserData(handle, d_generation);
+#endif
+}
+
+void EventManagerName::disarm(const SocketHandle::Handle& handle,
+                              SocketState                *state)
+{
+    BSLS_ASSERT(state);
+
+    if (!state->d_isArmed) {
+        return;                                                       // RETURN
+    }
+    state->d_isArmed = false;
+
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+    struct io_uring_sqe *entry =
+                   static_cast<struct io_uring_sqe *>(d_ring.nextSubmission());
+    entry->opcode    = IORING_OP_POLL_REMOVE;
+    entry->fd        = -1;
+    entry->addr      = makeUserData(handle, state->d_generation);
+    entry->user_data = k_CANCEL_TAG;
+#else
+    (void)handle;
+#endif
+}
+
+int EventManagerName::dispatchCallbacks(int numCompletions)
+{
+    // First, collect the events signaled by the completions of the current
+    // poll requests, so that (as with 'epoll') the events reported by this
+    // 'dispatch' do not depend on registrations changed by the callbacks.
+
+    d_signaled.clear();
+
+    for (int i = 0; i < numCompletions; ++i) {
+        const Ring::Completion& completion = d_completions[i];
+
+        const int          fd         =
+                      static_cast<int>(completion.d_userData & 0xFFFFFFFF);
+        const unsigned int generation =
+                      static_cast<unsigned int>(completion.d_userData >> 32);
+
+        SocketMap::iterator it = d_sockets.find(fd);
+        if (0 == generation
+         || d_sockets.end() == it
+         || generation != it->second.d_generation
+         || !it->second.d_isArmed) {
+            // A cancellation, or a stale poll request.
+
+            continue;
+        }
+
+        it->second.d_isArmed = false;
+
+        // A failed request (e.g., for an invalid handle) is reported as an
+        // error on the socket.
+
+        const uint32_t events = 0 > completion.d_result
+                              ? static_cast<uint32_t>(POLLERR)
+                              : static_cast<uint32_t>(completion.d_result);
+
+        d_signaled.push_back(bsl::make_pair(fd, events));
+    }
+
+    int numCallbacks = 0;
+
+    for (bsl::size_t i = 0; i < d_signaled.size(); ++i) {
+        const SocketHandle::Handle fd        = d_signaled[i].first;
+        const uint32_t             events    = d_signaled[i].second;
+        const uint32_t             eventMask =
+                                      d_callbacks.getRegisteredEventMask(fd);
+
+        // Read/Accept.
+
+        if (events & (POLLIN | POLLERR | POLLHUP)) {
+            if (eventMask & bdlb::BitMaskUtil::eq(EventType::e_READ)) {
+                numCallbacks += !d_callbacks.invoke(Event(fd,
+                                                          EventType::e_READ));
+            } else {
+                numCallbacks += !d_callbacks.invoke(
+                                               Event(fd, EventType::e_ACCEPT));
+            }
+        }
+
+        // Write/Connect.
+
+        if (events & POLLOUT) {
+            if (eventMask & bdlb::BitMaskUtil::eq(EventType::e_WRITE)) {
+                numCallbacks += !d_callbacks.invoke(Event(fd,
+                                                          EventType::e_WRITE));
+            } else {
+                numCallbacks += !d_callbacks.invoke(
+                                               Event(fd,
+                                                     EventType::e_CONNECT));
+            }
+        }
+    }
+
+    // Re-arm the one-shot poll requests of the signaled sockets that are
+    // still registered (and were not re-armed by a callback).
+
+    for (bsl::size_t i = 0; i < d_signaled.size(); ++i) {
+        const SocketHandle::Handle fd = d_signaled[i].first;
+
+        SocketMap::iterator it = d_sockets.find(fd);
+        if (d_sockets.end() != it && !it->second.d_isArmed) {
+            const uint32_t eventMask = d_callbacks.getRegisteredEventMask(fd);
+            if (eventMask) {
+                arm(fd, eventMask, &it->second);
+            }
+        }
+    }
+
+    return numCallbacks;
+}
+
+int EventManagerName::dispatchImp(int                       flags,
+                                  const bsls::TimeInterval *timeout)
+{
+    bsls::TimeInterval now;
+    if (timeout) {
+        now = bdlt::CurrentTime::now();
+    }
+    int numCallbacks = 0;                    // number of callbacks dispatched
+    const bool allowAsyncInterrupts =
+                               (0 != (btlso::Flag::k_ASYNC_INTERRUPT & flags));
+
+    do {
+        int numReady;                // number of reaped completions
+        int savedErrno = 0;          // saved errno value set by wait
+        while (1) {
+            bool               wait = true;
+            bsls::TimeInterval remaining;
+            if (timeout) {
+                if (*timeout <= now) {
+                    // Only submit, and collect the available completions.
+
+                    wait = false;
+                }
+                else {
+                    remaining = *timeout - now;
+                }
+            }
+
+            if (d_sockets.empty()) {
+                // No fds to wait for.  We'll just sleep if there is a timeout.
+
+                if (!timeout || !wait) {
+                    numReady = 0;
+                    break;
+                }
+                numReady = sleep(&savedErrno, *timeout, flags, d_timeMetric_p);
+            }
+            else {
+                if (d_timeMetric_p) {
+                    d_timeMetric_p->switchTo(btlso::TimeMetrics::e_IO_BOUND);
+                }
+
+                numReady = d_ring.submitAndWait(&d_completions,
+                                                wait,
+                                                timeout ? &remaining : 0);
+                savedErrno = errno;
+
+                if (d_timeMetric_p) {
+                    d_timeMetric_p->switchTo(btlso::TimeMetrics::e_CPU_BOUND);
+                }
+            }
+            errno = 0;
+            if (numReady > 0
+             || (numReady < 0
+              && EINTR == savedErrno
+              && allowAsyncInterrupts)) {
+                // Either a request completed or we've been interrupted and the
+                // user wants to know.
+
+                break;
+            }
+            if (timeout) {
+                now = bdlt::CurrentTime::now();
+                if (now >= *timeout) {
+                    // We reached the timeout.
+
+                    if (0 > numReady) {
+                        numReady = 0;
+                    }
+                    break;
+                }
+            }
+        }
+
+        if (0 >= numReady) {
+            return numReady
+                   ? -1 == numReady && EINTR == savedErrno
+                     ? -1
+                     : -2
+                   : 0;                                               // RETURN
+        }
+
+        numCallbacks += dispatchCallbacks(numReady);
+        if (timeout) {
+            now = bdlt::CurrentTime::now();
+        }
+    } while (0 == numCallbacks && (0 == timeout || now < *timeout));
+
+    return numCallbacks;
+}
+
+// PUBLIC CLASS METHODS
+bool EventManagerName::isSupported()
+{
+    return Ring::isSupported();
+}
+
+// CREATORS
+EventManagerName::DefaultEventManager(btlso::TimeMetrics *timeMetric,
+                                      bslma::Allocator   *basicAllocator)
+: d_ring()
+, d_sockets(basicAllocator)
+, d_generation(0)
+, d_completions(basicAllocator)
+, d_signaled(basicAllocator)
+, d_timeMetric_p(timeMetric)
+, d_callbacks(basicAllocator)
+, d_allocator_p(bslma::Default::allocator(basicAllocator))
+{
+#ifdef BTLSO_DEFAULTEVENTMANAGER_IOURING_AVAILABLE
+    const int rc = d_ring.open(k_NUM_ENTRIES, k_NUM_COMPLETION_ENTRIES);
+#else
+    const int rc = ENOSYS;
+#endif
+    if (0 != rc) {
+        errno = rc;
+        bsl::perror("io_uring_setup returned ");
+        BSLS_ASSERT_OPT("io_uring_setup() failed" && 0);
+    }
+}
+
+EventManagerName::~DefaultEventManager()
+{
+    // Closing the ring cancels all outstanding requests.
+
+    d_ring.close();
+}
+
+// MANIPULATORS
+void EventManagerName::deregisterAll()
+{
+    for (SocketMap::iterator it = d_sockets.begin();
+         it != d_sockets.end();
+         ++it) {
+        disarm(it->first, &it->second);
+    }
+    d_sockets.clear();
+    d_callbacks.removeAll();
+}
+
+void EventManagerName::deregisterSocketEvent(
+                                     const btlso::SocketHandle::Handle& handle,
+                                     btlso::EventType::Type             event)
+{
+    Event handleEvent(handle, event);
+
+    if (!d_callbacks.remove(handleEvent)) {
+        return;                                                       // RETURN
+    }
+
+    SocketMap::iterator it = d_sockets.find(handle);
+    BSLS_ASSERT(d_sockets.end() != it);
+
+    const uint32_t newMask = d_callbacks.getRegisteredEventMask(handle);
+    if (0 == newMask) {
+        // There are no more events to monitor for this handle.
+
+        disarm(handle, &it->second);
+        d_sockets.erase(it);
+        return;                                                       // RETURN
+    }
+
+    // We're still interested in another event for this fd.
+
+    arm(handle, newMask, &it->second);
+}
+
+int EventManagerName::deregisterSocket(
+                                     const btlso::SocketHandle::Handle& handle)
+{
+    SocketMap::iterator it = d_sockets.find(handle);
+    if (d_sockets.end() != it) {
+        disarm(handle, &it->second);
+        d_sockets.erase(it);
+    }
+
+    return d_callbacks.removeSocket(handle);
+}
+
+int EventManagerName::dispatch(const bsls::TimeInterval& timeout,
+                               int                       flags)
+{
+    if (0 == numEvents()) {
+        int dummy;
+        return sleep(&dummy, timeout, flags, d_timeMetric_p);         // RETURN
+    }
+    return dispatchImp(flags, &timeout);
+}
+
+int EventManagerName::dispatch(int flags)
+{
+    if (0 == numEvents()) {
+        return 0;                                                     // RETURN
+    }
+    return dispatchImp(flags, 0);
+}
+
+int EventManagerName::registerSocketEvent(
+                                 const btlso::SocketHandle::Handle&   handle,
+                                 const btlso::EventType::Type         event,
+                                 const btlso::EventManager::Callback& callback)
+{
+    Event handleEvent(handle, event);
+
+    const uint32_t eventMask = d_callbacks.registerCallback(handleEvent,
+                                                            callback);
+    if (0 == eventMask) {
+        // Event was already registered; we simply changed the callback.
+
+        return 0;                                                     // RETURN
+    }
+
+    SocketState initialState = { 0, false };
+
+    SocketMap::iterator it =
+            d_sockets.insert(bsl::make_pair(handle, initialState)).first;
+
+    arm(handle, eventMask, &it->second);
+    return 0;
+}
+
+// ACCESSORS
+int EventManagerName::numSocketEvents(
+                               const btlso::SocketHandle::Handle& handle) const
+{
+    return bdlb::BitUtil::numBitsSet(
+                                  d_callbacks.getRegisteredEventMask(handle));
+}
+
+int EventManagerName::numEvents() const
+{
+    return d_callbacks.numCallbacks();
+}
+
+int EventManagerName::isRegistered(
+                                const btlso::SocketHandle::Handle& handle,
+                                const btlso::EventType::Type       event) const
+{
+    return d_callbacks.contains(Event(handle, event));
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -0,0 +1,630 @@
+// btlso_defaulteventmanager_iouring.h                                -*-C++-*-
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGER_IOURING
+#define INCLUDED_BTLSO_DEFAULTEVENTMANAGER_IOURING
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide socket multiplexer implementation using Linux 'io_uring'.
+//
+//@CLASSES:
+//  btlso::DefaultEventManager<btlso::Platform::IO_URING>: 'io_uring' poller
+//
+//@SEE_ALSO: btlso_eventmanager btlso_defaulteventmanager btlso_timemetrics
+//
+//@DESCRIPTION: This component provides an implementation of an event manager,
+// 'btlso::DefaultEventManager<btlso::Platform::IO_URING>', that uses a Linux
+// 'io_uring' submission/completion ring to monitor for socket events and
+// adheres to the 'btlso::EventManager' protocol.  In particular, this protocol
+// supports the registration of level-triggered socket events, along with an
+// associated 'bsl::function' callback functor, which is invoked when the
+// corresponding socket event occurs.
+//
+// Registering a socket event requires specifying a socket handle and the type
+// of event to monitor on the indicated socket.  Socket event registrations
+// stay in effect until they are subsequently deregistered; the associated
+// callback is invoked each time the specified socket event occurs provided
+// that appropriate method (i.e., 'dispatch') is called.  Once deregistered,
+// the callback will no longer be invoked.
+//
+///Batched Submission
+///------------------
+// Each registered socket has one outstanding 'IORING_OP_POLL_ADD' request on
+// the ring, covering all of the events registered for that socket.  Unlike
+// 'epoll', where every change to the set of monitored events is a separate
+// 'epoll_ctl' system call, registering and deregistering events with this
+// event manager only queues poll (and poll-cancellation) requests in the
+// submission ring.  The queued requests are submitted to the kernel by the
+// same 'io_uring_enter' system call that 'dispatch' uses to wait for
+// completions, so a 'dispatch' costs exactly one system call regardless of
+// how many registrations changed since the previous one.  (Should the
+// submission ring fill up between two calls to 'dispatch', the queued requests
+// are submitted early, without waiting.)
+//
+// Poll requests are one-shot: when a request completes, the callbacks for the
+// signaled events are invoked and the request is re-queued for the next
+// 'dispatch', which provides the level-triggered semantics of the
+// 'btlso::EventManager' protocol.  (Multishot poll requests are edge-triggered
+// and are therefore not used.)  Note that, as a consequence of deferred
+// submission, 'registerSocketEvent' does not report an invalid socket
+// 'handle'; instead, the error is reported by 'dispatch' as a read (or
+// accept) event on 'handle', which the callback will discover when it
+// attempts to use 'handle'.
+//
+///Availability
+///------------
+// This component requires Linux 5.12 or later ('io_uring' itself is older,
+// but waiting with a timeout requires 5.11, and earlier kernels charge ring
+// memory against the per-user 'RLIMIT_MEMLOCK'); 'io_uring' may also be
+// disabled by the system administrator (e.g., via the
+// 'kernel.io_uring_disabled' sysctl) or by a seccomp filter.  Clients should
+// therefore call 'isSupported' before creating an event manager of this type,
+// and fall back to 'btlso::DefaultEventManager<btlso::Platform::EPOLL>'
+// otherwise.  Direct use of this library component on *any* platform may
+// result in non-portable software.
+//
+///Component Diagram
+///-----------------
+// This specialized component is one of the specializations of the
+// 'btlso_defaulteventmanager' component; the other components are shown
+// (schematically) on the following diagram:
+//..
+//                       _____btlso_defaulteventmanager_____
+//              ________/    |         |         |      \    \________
+//            *_poll   *_epoll  *_iouring  *_select  *_devpoll   *_pollset
+//..
+//
+///Thread Safety
+///-------------
+// This component depends on a 'bslma::Allocator' instance to supply memory.
+// If the allocator is not thread enabled then the instances of this component
+// that use the same allocator instance will consequently not be thread safe
+// Otherwise, this component provides the following guarantees.
+//
+// Accessing an instance of the event manager provided by this component from
+// different threads may result in undefined behavior.  Accessing distinct
+// instances from different threads is safe.  Distinct instances of the event
+// manager provided by this component are *thread* *enabled* meaning that
+// operations invoked on distinct instances from different threads can proceed
+// concurrently.  The event manager is not *async-safe*, meaning that one or
+// more functions cannot be invoked safely from a signal handler.
+//
+///Performance
+///-----------
+// Given that S is the number of socket events registered, and R the number of
+// signaled sockets, this component provides the following complexity
+// guarantees:
+//..
+//  +=======================================================================+
+//  |        FUNCTION          | EXPECTED COMPLEXITY | WORST CASE COMPLEXITY|
+//  +-----------------------------------------------------------------------+
+//  | dispatch                 |        O(R)         |       O(R*S)         |
+//  +-----------------------------------------------------------------------+
+//  | registerSocketEvent      |        O(1)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterSocketEvent    |        O(1)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterSocket         |        O(1)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | deregisterAll            |        O(S)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | numSocketEvents          |        O(1)         |        O(S)          |
+//  +-----------------------------------------------------------------------+
+//  | numEvents                |        O(1)         |        O(1)          |
+//  +-----------------------------------------------------------------------+
+//  | isRegistered             |        O(1)         |        O(S)          |
+//  +=======================================================================+
+//..
+//
+///Metrics
+///-------
+// The event manager provided by this component can use external (i.e.,
+// user-installed) time metrics (see 'btlso_timemetrics' component) to record
+// times spend in IO-bound and CPU-bound operations using the category IDs
+// defined in 'btlso::TimeMetrics'.
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Using an Event Manager
+///- - - - - - - - - - - - - - - - -
+// The following snippets of code illustrate how to use this event manager with
+// a non-blocking socket.  First, verify that the running kernel supports
+// 'io_uring', then create a 'btlso::TimeMetrics' object and a
+// 'btlso::DefaultEventManager<btlso::Platform::IO_URING>' object; also create
+// a (locally-connected) socket pair:
+//..
+//  typedef btlso::DefaultEventManager<btlso::Platform::IO_URING> Manager;
+//
+//  if (!Manager::isSupported()) {
+//      return;                                                   // RETURN
+//  }
+//
+//  btlso::TimeMetrics timeMetric(btlso::TimeMetrics::e_MIN_NUM_CATEGORIES,
+//                                btlso::TimeMetrics::e_CPU_BOUND);
+//
+//  Manager mX(&timeMetric);
+//
+//  btlso::SocketHandle::Handle socket[2];
+//
+//  int rc = btlso::SocketImpUtil::socketPair<btlso::IPv4Address>(
+//                                      socket,
+//                                      btlso::SocketImpUtil::k_SOCKET_STREAM);
+//
+//  assert(0 == rc);
+//..
+// Then, register two socket events, a read event for 'socket[0]' and a write
+// event for 'socket[1]'.  The callback installed as part of each registration
+// reads or writes the specified number of bytes:
+//..
+//  btlso::EventManager::Callback readCb(
+//                               bdlf::BindUtil::bind(&genericCb,
+//                                                    btlso::EventType::e_READ,
+//                                                    socket[0],
+//                                                    15,
+//                                                    &mX));
+//  mX.registerSocketEvent(socket[0], btlso::EventType::e_READ, readCb);
+//
+//  btlso::EventManager::Callback writeCb(
+//                              bdlf::BindUtil::bind(&genericCb,
+//                                                   btlso::EventType::e_WRITE,
+//                                                   socket[1],
+//                                                   15,
+//                                                   &mX));
+//  mX.registerSocketEvent(socket[1], btlso::EventType::e_WRITE, writeCb);
+//
+//  assert(2 == mX.numEvents());
+//  assert(1 == mX.isRegistered(socket[0], btlso::EventType::e_READ));
+//  assert(1 == mX.isRegistered(socket[1], btlso::EventType::e_WRITE));
+//..
+// Next, we call 'dispatch' with a timeout of 5 seconds from now.  Only the
+// write event is pending: 'socket[0]' has nothing to read until the write
+// callback has run.  Both registrations are submitted to the kernel by this
+// call:
+//..
+//  bsls::TimeInterval deadline(bdlt::CurrentTime::now());
+//  deadline += 5;
+//
+//  rc = mX.dispatch(deadline, 0);   assert(1 == rc);
+//..
+// Now, we deregister the write event, and dispatch again; the bytes written
+// by the write callback are now available to be read by the read callback:
+//..
+//  mX.deregisterSocketEvent(socket[1], btlso::EventType::e_WRITE);
+//  assert(1 == mX.numEvents());
+//
+//  rc = mX.dispatch(deadline, 0);   assert(1 == rc);
+//..
+// Finally, we remove all registrations by calling 'deregisterAll()' and verify
+// the state again:
+//..
+//  mX.deregisterAll();
+//  assert(0 == mX.numEvents());
+//  assert(0 == mX.numSocketEvents(socket[0]));
+//  assert(0 == mX.numSocketEvents(socket[1]));
+//..
+// The 'genericCb' callback is the same as in
+// 'btlso_defaulteventmanager_epoll'.
+
+#ifndef INCLUDED_BTLSCM_VERSION
+#include <btlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_DEFAULTEVENTMANAGERIMPL
+#include <btlso_defaulteventmanagerimpl.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENT
+#include <btlso_event.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENTCALLBACKREGISTRY
+#include <btlso_eventcallbackregistry.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENTMANAGER
+#include <btlso_eventmanager.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_EVENTTYPE
+#include <btlso_eventtype.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_PLATFORM
+#include <btlso_platform.h>
+#endif
+
+#ifndef INCLUDED_BTLSO_SOCKETHANDLE
+#include <btlso_sockethandle.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISBITWISEMOVEABLE
+#include <bslmf_isbitwisemoveable.h>
+#endif
+
+#ifndef INCLUDED_BSLS_PLATFORM
+#include <bsls_platform.h>
+#endif
+
+#ifndef INCLUDED_BSLS_TYPES
+#include <bsls_types.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTDDEF
+#include <bsl_cstddef.h>
+#endif
+
+#ifndef INCLUDED_BSL_UNORDERED_MAP
+#include <bsl_unordered_map.h>
+#endif
+
+#ifndef INCLUDED_BSL_UTILITY
+#include <bsl_utility.h>
+#endif
+
+#ifndef INCLUDED_BSL_VECTOR
+#include <bsl_vector.h>
+#endif
+
+#if defined(BSLS_PLATFORM_OS_LINUX)
+
+namespace BloombergLP {
+
+namespace bslma { class Allocator; }
+
+namespace bsls { class TimeInterval; }
+
+namespace btlso {
+
+class TimeMetrics;
+
+                    // =====================================
+                    // class DefaultEventManager_IoUringRing
+                    // =====================================
+
+class DefaultEventManager_IoUringRing {
+    // [!PRIVATE!] This class provides a minimal interface to the submission
+    // and completion queues of a Linux 'io_uring' instance, which are shared
+    // with the kernel through memory mappings of the ring file descriptor.
+    // Requests are queued with 'nextSubmission' and submitted, in a batch, by
+    // 'submitAndWait'.  This class is not thread-safe.
+
+  public:
+    // TYPES
+    struct Completion {
+        // A copy of one entry of the completion queue.
+
+        bsls::Types::Uint64 d_userData;  // 'user_data' of the request
+        int                 d_result;    // result of the request
+    };
+
+  private:
+    // DATA
+    int                  d_ringFd;         // ring file descriptor, or -1
+
+    void                *d_rings_p;        // mapped submission and completion
+                                           // queue rings
+
+    bsl::size_t          d_ringsSize;      // size of 'd_rings_p' mapping
+
+    void                *d_entries_p;      // mapped submission queue entries
+
+    bsl::size_t          d_entriesSize;    // size of 'd_entries_p' mapping
+
+    unsigned int        *d_sqHead_p;       // submission queue head (kernel)
+
+    unsigned int        *d_sqTail_p;       // submission queue tail (user)
+
+    unsigned int        *d_sqFlags_p;      // submission queue flags
+
+    unsigned int        *d_sqArray_p;      // submission queue index array
+
+    unsigned int         d_sqMask;         // submission queue index mask
+
+    unsigned int         d_sqEntries;      // submission queue capacity
+
+    unsigned int         d_sqLocalTail;    // tail including queued, not yet
+                                           // published, entries
+
+    unsigned int        *d_cqHead_p;       // completion queue head (user)
+
+    unsigned int        *d_cqTail_p;       // completion queue tail (kernel)
+
+    unsigned int         d_cqMask;         // completion queue index mask
+
+    void                *d_cqes_p;         // completion queue entries
+
+  private:
+    // NOT IMPLEMENTED
+    DefaultEventManager_IoUringRing(const DefaultEventManager_IoUringRing&);
+    DefaultEventManager_IoUringRing& operator=(
+                                       const DefaultEventManager_IoUringRing&);
+
+    // PRIVATE MANIPULATORS
+    int enter(unsigned int  numToSubmit,
+              unsigned int  minComplete,
+              unsigned int  flags,
+              void         *argument,
+              bsl::size_t   argumentSize);
+        // Invoke the 'io_uring_enter' system call on this ring with the
+        // specified 'numToSubmit', 'minComplete', 'flags', 'argument', and
+        // 'argumentSize'.  Return the result of the system call.
+
+    int reap(bsl::vector<Completion> *completions);
+        // Append to the specified 'completions' the entries of the completion
+        // queue, and remove them from the queue.  Return the number of
+        // entries appended.
+
+  public:
+    // CLASS METHODS
+    static bool isSupported();
+        // Return 'true' if the running kernel supports the features of
+        // 'io_uring' used by this class, and 'false' otherwise.
+
+    // CREATORS
+    DefaultEventManager_IoUringRing();
+        // Create a ring object that is not open.
+
+    ~DefaultEventManager_IoUringRing();
+        // Close this ring, if open, and destroy this object.
+
+    // MANIPULATORS
+    int open(unsigned int numEntries, unsigned int numCompletionEntries);
+        // Create an 'io_uring' instance having a submission queue of at least
+        // the specified 'numEntries' and a completion queue of at least the
+        // specified 'numCompletionEntries', and map its queues into this
+        // process.  Return 0 on success, and the native error code otherwise.
+        // The behavior is undefined if this ring is already open.
+
+    void close();
+        // Unmap the queues of this ring, and close its file descriptor,
+        // cancelling any outstanding requests.  This method has no effect if
+        // this ring is not open.
+
+    void *nextSubmission();
+        // Return the address of a zero-initialized submission queue entry
+        // (i.e., an 'io_uring_sqe') to be filled in by the caller.  The entry
+        // is submitted by the next call to 'submitAndWait' or, if the
+        // submission queue is full, by the next call to this method.  The
+        // behavior is undefined unless this ring is open.
+
+    int submitAndWait(bsl::vector<Completion>   *completions,
+                      bool                       wait,
+                      const bsls::TimeInterval  *timeout);
+        // Submit every queued request to the kernel and load into the
+        // specified 'completions' the pending completions.  If the specified
+        // 'wait' is 'true' and no completion is pending, block until one is
+        // posted or, if the specified 'timeout' is not 0, until the
+        // (relative) time interval '*timeout' elapses.  Return the number of
+        // completions loaded, or -1 with 'errno' set to 'EINTR' if the wait
+        // was interrupted by a signal.  The behavior is undefined unless this
+        // ring is open.
+};
+
+           // =============================================
+           // class DefaultEventManager<Platform::IO_URING>
+           // =============================================
+
+template <>
+class DefaultEventManager<Platform::IO_URING> : public EventManager
+{
+    // This class implements the 'btlso::EventManager' protocol using poll
+    // requests submitted to a Linux 'io_uring' instance.
+
+    // PRIVATE TYPES
+    typedef DefaultEventManager_IoUringRing Ring;
+
+    struct SocketState {
+        // The state of the poll request for one registered socket.
+
+        unsigned int d_generation;  // tag of the latest poll request
+        bool         d_isArmed;     // whether that request is outstanding
+    };
+
+    typedef bsl::unordered_map<SocketHandle::Handle, SocketState> SocketMap;
+
+    // DATA
+    Ring                      d_ring;         // submission/completion ring
+
+    SocketMap                 d_sockets;      // poll state per socket
+
+    unsigned int              d_generation;   // tag of the most recent poll
+                                              // request
+
+    bsl::vector<Ring::Completion>
+                              d_completions;  // completions reaped by the
+                                              // current 'dispatch'
+
+    bsl::vector<bsl::pair<SocketHandle::Handle, uint32_t> >
+                              d_signaled;     // sockets, and their signaled
+                                              // 'poll' events, whose poll
+                                              // requests completed in the
+                                              // current 'dispatch'
+
+    TimeMetrics              *d_timeMetric_p; // metrics to use for reporting
+                                              // percent-busy statistics
+
+    EventCallbackRegistry     d_callbacks;    // map of events to callbacks
+
+    bslma::Allocator         *d_allocator_p;  // supplies memory
+
+    // PRIVATE MANIPULATORS
+    void arm(const SocketHandle::Handle&  handle,
+             uint32_t                     eventMask,
+             SocketState                 *state);
+        // Queue a poll request for the events in the specified 'eventMask' on
+        // the specified 'handle', cancelling the outstanding poll request, if
+        // any, described by the specified 'state', and update 'state' to
+        // describe the new request.
+
+    void disarm(const SocketHandle::Handle& handle, SocketState *state);
+        // Queue the cancellation of the outstanding poll request, if any, on
+        // the specified 'handle' described by the specified 'state'.
+
+    int dispatchCallbacks(int numCompletions);
+        // Invoke any registered callbacks for the first 'numCompletions'
+        // completions in 'd_completions', and queue new poll requests for the
+        // sockets that remain registered.  Return the number of callbacks
+        // invoked.
+
+    int dispatchImp(int flags, const bsls::TimeInterval *timeout = 0);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.
+
+  private:
+    // NOT IMPLEMENTED
+    DefaultEventManager(const DefaultEventManager&);
+    DefaultEventManager& operator=(const DefaultEventManager&);
+
+  public:
+    // PUBLIC CLASS METHODS
+    static bool isSupported();
+        // Return true if the current kernel supports this event manager.
+
+    // CREATORS
+    explicit
+    DefaultEventManager(TimeMetrics      *timeMetric     = 0,
+                        bslma::Allocator *basicAllocator = 0);
+        // Create an 'io_uring'-based event manager.  Optionally specify a
+        // 'timeMetric' to report time spent in CPU-bound and IO-bound
+        // operations.  If 'timeMetric' is not specified or is 0, these metrics
+        // are not reported.  Optionally specify a 'basicAllocator' used to
+        // supply memory.  If 'basicAllocator' is 0, the currently installed
+        // default allocator is used.  The behavior is undefined unless
+        // 'isSupported()' is 'true'.
+
+    ~DefaultEventManager();
+        // Destroy this object.  Note that the registered callbacks are NOT
+        // invoked.
+
+    // MANIPULATORS
+    int dispatch(const bsls::TimeInterval& timeout, int flags);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.  If no event is pending, wait
+        // until either (1) at least one event occurs (in which case the
+        // corresponding callback(s) is invoked), (2) the specified absolute
+        // 'timeout' is reached, or (3) provided that the specified 'flags'
+        // contains 'btlso::Flag::k_ASYNC_INTERRUPT', an underlying system call
+        // is interrupted by a signal.  Return the number of dispatched
+        // callbacks on success, 0 if 'timeout' is reached, and a negative
+        // value otherwise; -1 is reserved to indicate that an underlying
+        // system call was interrupted.  When such an interruption occurs this
+        // method will return (-1) if 'flags' contains
+        // 'btlso::Flag::k_ASYNC_INTERRUPT', and otherwise will automatically
+        // restart (i.e., reissue the identical system call).  Note that all
+        // callbacks are invoked in the same thread that invokes 'dispatch',
+        // and the order of invocation, relative to the order of registration,
+        // is unspecified.  Also note that -1 is never returned unless 'flags'
+        // contains 'btlso::Flag::k_ASYNC_INTERRUPT'.
+
+    int dispatch(int flags);
+        // For each pending socket event, invoke the corresponding callback
+        // registered with this event manager.  If no event is pending, wait
+        // until either (1) at least one event occurs (in which case the
+        // corresponding callback(s) is invoked) or (2) provided that the
+        // specified 'flags' contains 'btlso::Flag::k_ASYNC_INTERRUPT', an
+        // underlying system call is interrupted by a signal.  Return the
+        // number of dispatched callbacks on success, and a negative value
+        // otherwise; -1 is reserved to indicate that an underlying system call
+        // was interrupted.  When such an interruption occurs this method will
+        // return (-1) if 'flags' contains 'btlso::Flag::k_ASYNC_INTERRUPT' and
+        // otherwise will automatically restart (i.e., reissue the identical
+        // system call).  Note that all callbacks are invoked in the same
+        // thread that invokes 'dispatch', and the order of invocation,
+        // relative to the order of registration, is unspecified.  Also note
+        // that -1 is never returned unless 'flags' contains
+        // 'btlso::Flag::k_ASYNC_INTERRUPT'.
+
+    int registerSocketEvent(const SocketHandle::Handle&   handle,
+                            const EventType::Type         event,
+                            const EventManager::Callback& callback);
+        // Register with this event manager the specified 'callback' to be
+        // invoked when the specified 'event' occurs on the specified socket
+        // 'handle'.  Each socket event registration stays in effect until it
+        // is subsequently deregistered; the callback is invoked each time the
+        // corresponding event is detected.  'EventType::e_READ' and
+        // 'EventType::e_WRITE' are the only events that can be registered
+        // simultaneously for a socket.  If a registration attempt is made for
+        // an event that is already registered, the callback associated with
+        // this event will be overwritten with the new one.  Simultaneous
+        // registration of incompatible events for the same socket 'handle'
+        // will result in undefined behavior.  Return 0.  Note that the poll
+        // request for 'handle' is submitted by the next call to 'dispatch';
+        // if 'handle' is invalid, that call reports a read (or accept) event
+        // on 'handle'.
+
+    void deregisterSocketEvent(const SocketHandle::Handle& handle,
+                               EventType::Type             event);
+        // Deregister from this event manager the callback associated with the
+        // specified 'event' on the specified 'handle' so that said callback
+        // will not be invoked should 'event' occur.
+
+    int deregisterSocket(const SocketHandle::Handle& handle);
+        // Deregister from this event manager all events associated with the
+        // specified socket 'handle'.  Return the number of deregistered
+        // callbacks.
+
+    void deregisterAll();
+        // Deregister from this event manager all events on every socket
+        // handle.
+
+    // ACCESSORS
+    bool hasLimitedSocketCapacity() const;
+        // Return 'true' if this event manager has a limited socket capacity,
+        // and 'false' otherwise.
+
+    int isRegistered(const SocketHandle::Handle& handle,
+                     const EventType::Type       event) const;
+        // Return 1 if the specified 'event' is registered with this event
+        // manager for the specified socket 'handle' and 0 otherwise.
+
+    int numEvents() const;
+        // Return the total number of all socket events currently registered
+        // with this event manager.
+
+    int numSocketEvents(const SocketHandle::Handle& handle) const;
+        // Return the number of socket events currently registered with this
+        // event manager for the specified 'handle'.
+};
+
+//-----------------------------------------------------------------------------
+//                      INLINE FUNCTION DEFINITIONS
+//-----------------------------------------------------------------------------
+
+           // ---------------------------------------------
+           // class DefaultEventManager<Platform::IO_URING>
+           // ---------------------------------------------
+
+// ACCESSORS
+inline
+bool DefaultEventManager<Platform::IO_URING>::hasLimitedSocketCapacity() const
+{
+    return false;
+}
+
+}  // close package namespace
+
+}  // close enterprise namespace
+
+#endif // BSLS_PLATFORM_OS_LINUX
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
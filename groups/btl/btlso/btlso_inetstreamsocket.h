@@ -13,14 +13,19 @@ BSLS_IDENT("$Id: $")
 //  btlso::InetStreamSocket: implementation of TCP-based stream-sockets
 //  btlso::InetStreamSocketCloseGuard: proctor for managing stream-sockets
 //
-//@SEE_ALSO: btlso_streamsocket, btlso_ipv4address, btlsos_tcpconnector
+//@SEE_ALSO: btlso_streamsocket, btlso_ipv4address, btlso_localaddress,
+//           btlsos_tcpconnector
 //
 //@DESCRIPTION: This component implements TCP-based stream sockets of type
 // 'btlso::InetStreamSocket<ADDRESS>' conforming to the
 // 'btlso::StreamSocket<ADDRESS>' protocol.  The classes are templatized to
-// provide type-safe address class specialization.  The only address type
-// currently supported is IPv4 (as provided by 'btlso_ipv4address' component).
-// Therefore, the template parameter will always be 'btlso::IPv4Address'.
+// provide type-safe address class specialization.  The supported address
+// types are IPv4 (as provided by 'btlso_ipv4address' component), and, on
+// platforms providing BSD sockets, local (Unix-domain) socket addresses (as
+// provided by 'btlso_localaddress' component).  The template parameter
+// 'btlso::LocalAddress' yields stream sockets that connect processes on the
+// same host without going through the TCP/IP stack; options specific to TCP
+// (e.g., 'TCP_NODELAY') are not supported by such sockets.
 //
 ///Thread Safety
 ///-------------
@@ -20,15 +20,17 @@ BSLS_IDENT("$Id: $")
 //@CLASSES:
 //  btlso::InetStreamSocketFactory: factory for TCP-based stream-sockets
 //
-//@SEE_ALSO: btlso_inetstreamsocket, btlso_ipv4address
+//@SEE_ALSO: btlso_inetstreamsocket, btlso_ipv4address, btlso_localaddress
 //
 //@DESCRIPTION: This component implements a factory to allocate and deallocate
 // them.  The stream sockets are of type 'btlso::InetStreamSocket<ADDRESS>'
 // conforming to the 'btlso::StreamSocket<ADDRESS>' protocol.  The classes are
-// templatized to provide type-safe address class specialization.  The only
-// address type currently supported is IPv4 (as provided by 'btlso_ipv4address'
-// component).  Therefore, the template parameter will always be
-// 'btlso::IPv4Address'.  The factory,
+// templatized to provide type-safe address class specialization.  The
+// supported address types are IPv4 (as provided by 'btlso_ipv4address'
+// component) and, on platforms providing BSD sockets, local (Unix-domain)
+// socket addresses (as provided by 'btlso_localaddress' component); e.g.,
+// 'btlso::InetStreamSocketFactory<btlso::LocalAddress>' allocates 'AF_UNIX'
+// stream sockets.  The factory,
 // 'btlso::InetStreamSocketFactory<ADDRESS>', creates and destroys instances of
 // the 'btlso::InetStreamSocket<ADDRESS>'.  Two interfaces are available for
 // creation of stream sockets.  One does not take a socket handle creates a new
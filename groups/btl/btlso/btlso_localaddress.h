@@ -0,0 +1,274 @@
+// btlso_localaddress.h                                               -*-C++-*-
+#ifndef INCLUDED_BTLSO_LOCALADDRESS
+#define INCLUDED_BTLSO_LOCALADDRESS
+
+#ifndef INCLUDED_BSLS_IDENT
+#include <bsls_ident.h>
+#endif
+BSLS_IDENT("$Id: $")
+
+//@PURPOSE: Provide a representation of a local (Unix-domain) socket address.
+//
+//@CLASSES:
+// btlso::LocalAddress: address of a local ('AF_UNIX') socket
+//
+//@SEE_ALSO: btlso_ipv4address, btlso_socketimputil
+//
+//@DESCRIPTION: This component provides a value-semantic class,
+// 'btlso::LocalAddress', that represents the address of a local (also known as
+// Unix-domain, or 'AF_UNIX') socket, i.e., a path name in the file system.
+// Local sockets connect processes running on the same host without going
+// through the network protocol stack, and are therefore typically faster than
+// TCP connections over the loopback interface.
+//
+// A 'btlso::LocalAddress' can be used as the 'ADDRESS' template parameter of
+// 'btlso::SocketImpUtil' operations, and of 'btlso::InetStreamSocketFactory'
+// and 'btlso::InetStreamSocket', which then operate on stream sockets of the
+// 'AF_UNIX' domain.  A default-constructed 'btlso::LocalAddress' has an empty
+// path, which identifies an unnamed socket (e.g., the peer address of a
+// connected client socket that was never bound).
+//
+// The length of the path is limited by the size of the 'sun_path' field of the
+// platform's 'sockaddr_un' structure.  This component uses the smallest such
+// limit among supported platforms, 'k_MAX_PATH_LENGTH' (103) characters, not
+// including the terminating null character.  Linux "abstract" socket names
+// (starting with a null character) are not supported.
+//
+// Note that binding a local socket creates a file at the specified path, which
+// is *not* removed when the socket is closed; it is the responsibility of the
+// application to 'unlink' that file when it is no longer needed (and before
+// binding again to the same path).
+//
+///Usage
+///-----
+// This section illustrates intended use of this component.
+//
+///Example 1: Basic Syntax
+///- - - - - - - - - - - -
+// First, we create a default object 'address1', which has an empty path:
+//..
+//  btlso::LocalAddress address1;
+//  assert(0 == bsl::strcmp("", address1.path()));
+//..
+// Then, we set 'address1' to a valid path:
+//..
+//  int rc = address1.setPath("/tmp/myservice.sock");
+//  assert(0 == rc);
+//  assert(0 == bsl::strcmp("/tmp/myservice.sock", address1.path()));
+//..
+// Next, we verify that a path that is too long is rejected, and that the
+// object is left unchanged:
+//..
+//  const bsl::string longPath(btlso::LocalAddress::k_MAX_PATH_LENGTH + 1,
+//                             'x');
+//  assert(false == btlso::LocalAddress::isValidPath(longPath.c_str()));
+//
+//  rc = address1.setPath(longPath.c_str());
+//  assert(0 != rc);
+//  assert(0 == bsl::strcmp("/tmp/myservice.sock", address1.path()));
+//..
+// Finally, we create 'address2' from the same path, and verify that the two
+// objects have the same value:
+//..
+//  btlso::LocalAddress address2("/tmp/myservice.sock");
+//  assert(address1 == address2);
+//..
+
+#ifndef INCLUDED_BTLSCM_VERSION
+#include <btlscm_version.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_ISTRIVIALLYCOPYABLE
+#include <bslmf_istriviallycopyable.h>
+#endif
+
+#ifndef INCLUDED_BSLMF_NESTEDTRAITDECLARATION
+#include <bslmf_nestedtraitdeclaration.h>
+#endif
+
+#ifndef INCLUDED_BSLS_ASSERT
+#include <bsls_assert.h>
+#endif
+
+#ifndef INCLUDED_BSL_CSTRING
+#include <bsl_cstring.h>
+#endif
+
+#ifndef INCLUDED_BSL_IOSFWD
+#include <bsl_iosfwd.h>
+#endif
+
+namespace BloombergLP {
+namespace btlso {
+
+                            // ==================
+                            // class LocalAddress
+                            // ==================
+
+class LocalAddress {
+    // This simply constrained (value-semantic) attribute class represents the
+    // address of a local ('AF_UNIX') socket, i.e., a file-system path of at
+    // most 'k_MAX_PATH_LENGTH' characters.  The path is stored inline, so
+    // objects of this class never allocate memory and are bitwise copyable.
+
+  public:
+    // CONSTANTS
+    enum {
+        k_MAX_PATH_LENGTH = 103  // maximum number of characters in a path
+                                 // (not including the null terminator)
+    };
+
+  private:
+    // DATA
+    char d_path[k_MAX_PATH_LENGTH + 1];  // null-terminated path
+
+  public:
+    // TRAITS
+    BSLMF_NESTED_TRAIT_DECLARATION(LocalAddress, bsl::is_trivially_copyable)
+
+    // CLASS METHODS
+    static bool isValidPath(const char *path);
+        // Return 'true' if the specified null-terminated 'path' has at most
+        // 'k_MAX_PATH_LENGTH' characters, and 'false' otherwise.
+
+    // CREATORS
+    LocalAddress();
+        // Create a 'LocalAddress' object having an empty path.
+
+    explicit LocalAddress(const char *path);
+        // Create a 'LocalAddress' object having the specified null-terminated
+        // 'path'.  The behavior is undefined unless 'isValidPath(path)'.
+
+    //! LocalAddress(const LocalAddress& original) = default;
+    //! ~LocalAddress() = default;
+
+    // MANIPULATORS
+    //! LocalAddress& operator=(const LocalAddress& rhs) = default;
+
+    int setPath(const char *path);
+        // Set the path of this object to the specified null-terminated 'path'.
+        // Return 0 on success, and a non-zero value (with no effect on this
+        // object) if 'path' has more than 'k_MAX_PATH_LENGTH' characters.
+
+    // ACCESSORS
+    const char *path() const;
+        // Return the null-terminated path of this object.
+
+    bsl::ostream& print(bsl::ostream& stream,
+                        int           level = 0,
+                        int           spacesPerLevel = 4) const;
+        // Format this object to the specified output 'stream' at the
+        // (absolute value of) the optionally specified indentation 'level' and
+        // return a reference to 'stream'.  If 'level' is specified, optionally
+        // specify 'spacesPerLevel', the number of spaces per indentation level
+        // for this and all of its nested objects.  If 'level' is negative,
+        // suppress indentation of the first line.  If 'spacesPerLevel' is
+        // negative, format the entire output on one line, suppressing all but
+        // the initial indentation (as governed by 'level').  If 'stream' is
+        // not valid on entry, this operation has no effect.
+};
+
+// FREE OPERATORS
+bool operator==(const LocalAddress& lhs, const LocalAddress& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects have the same
+    // value, and 'false' otherwise.  Two 'LocalAddress' objects have the same
+    // value if their paths compare equal.
+
+bool operator!=(const LocalAddress& lhs, const LocalAddress& rhs);
+    // Return 'true' if the specified 'lhs' and 'rhs' objects do not have the
+    // same value, and 'false' otherwise.  Two 'LocalAddress' objects do not
+    // have the same value if their paths do not compare equal.
+
+bsl::ostream& operator<<(bsl::ostream& stream, const LocalAddress& object);
+    // Write the path of the specified 'object' to the specified output
+    // 'stream' in a single-line format, and return a reference to 'stream'.
+
+// ============================================================================
+//                            INLINE DEFINITIONS
+// ============================================================================
+
+                            // ------------------
+                            // class LocalAddress
+                            // ------------------
+
+// CLASS METHODS
+inline
+bool LocalAddress::isValidPath(const char *path)
+{
+    BSLS_ASSERT_SAFE(path);
+
+    return bsl::strlen(path) <= k_MAX_PATH_LENGTH;
+}
+
+// CREATORS
+inline
+LocalAddress::LocalAddress()
+{
+    d_path[0] = '\0';
+}
+
+inline
+LocalAddress::LocalAddress(const char *path)
+{
+    BSLS_ASSERT_SAFE(path);
+    BSLS_ASSERT_SAFE(isValidPath(path));
+
+    d_path[0] = '\0';
+    setPath(path);
+}
+
+// MANIPULATORS
+inline
+int LocalAddress::setPath(const char *path)
+{
+    BSLS_ASSERT_SAFE(path);
+
+    const bsl::size_t length = bsl::strlen(path);
+    if (length > k_MAX_PATH_LENGTH) {
+        return -1;                                                    // RETURN
+    }
+    bsl::memcpy(d_path, path, length + 1);
+    return 0;
+}
+
+// ACCESSORS
+inline
+const char *LocalAddress::path() const
+{
+    return d_path;
+}
+
+}  // close package namespace
+
+// FREE OPERATORS
+inline
+bool btlso::operator==(const LocalAddress& lhs, const LocalAddress& rhs)
+{
+    return 0 == bsl::strcmp(lhs.path(), rhs.path());
+}
+
+inline
+bool btlso::operator!=(const LocalAddress& lhs, const LocalAddress& rhs)
+{
+    return !(lhs == rhs);
+}
+
+}  // close enterprise namespace
+
+#endif
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
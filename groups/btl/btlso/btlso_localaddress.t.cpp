@@ -0,0 +1,431 @@
+// btlso_localaddress.t.cpp                                           -*-C++-*-
+#include <btlso_localaddress.h>
+
+#include <bslma_default.h>
+#include <bslma_defaultallocatorguard.h>
+#include <bslma_testallocator.h>
+
+#include <bsls_assert.h>
+#include <bsls_asserttest.h>
+
+#include <bsl_cstdlib.h>
+#include <bsl_cstring.h>
+#include <bsl_iostream.h>
+#include <bsl_sstream.h>
+#include <bsl_string.h>
+
+using namespace BloombergLP;
+using namespace bsl;
+
+//=============================================================================
+//                             TEST PLAN
+//-----------------------------------------------------------------------------
+//                              Overview
+//                              --------
+// This component provides a simply-constrained value-semantic class holding a
+// bounded file-system path.  It is tested using its manipulators and
+// accessors, with paths at and around the length limit.
+//-----------------------------------------------------------------------------
+// CLASS METHODS
+// [ 3] static bool isValidPath(const char *path);
+//
+// CREATORS
+// [ 2] btlso::LocalAddress();
+// [ 2] btlso::LocalAddress(const char *path);
+// [ 2] btlso::LocalAddress(const btlso::LocalAddress& original);
+// [ 2] ~btlso::LocalAddress();
+//
+// MANIPULATORS
+// [ 2] btlso::LocalAddress& operator=(const btlso::LocalAddress& rhs);
+// [ 3] int setPath(const char *path);
+//
+// ACCESSORS
+// [ 2] const char *path() const;
+// [ 2] ostream& print(ostream& stream, level, spacesPerLevel) const;
+//
+// FREE OPERATORS
+// [ 2] bool operator==(lhs, rhs);
+// [ 2] bool operator!=(lhs, rhs);
+// [ 2] bsl::ostream& operator<<(stream, object);
+//-----------------------------------------------------------------------------
+// [ 1] BREATHING TEST
+// [ 4] USAGE EXAMPLE
+// [ 2] CONCERN: No memory is allocated.
+
+// ============================================================================
+//                    STANDARD BDE ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+static int testStatus = 0;
+
+static void aSsErT(int c, const char *s, int i)
+{
+    if (c) {
+        cout << "Error " << __FILE__ << "(" << i << "): " << s
+             << "    (failed)" << endl;
+        if (testStatus >= 0 && testStatus <= 100) ++testStatus;
+    }
+}
+# define ASSERT(X) { aSsErT(!(X), #X, __LINE__); }
+
+// ============================================================================
+//                  STANDARD BDE LOOP-ASSERT TEST MACROS
+// ----------------------------------------------------------------------------
+
+#define LOOP_ASSERT(I,X) {                                                    \
+    if (!(X)) { cout << #I << ": " << I << "\n"; aSsErT(1, #X, __LINE__);}}
+
+#define LOOP2_ASSERT(I,J,X) {                                                 \
+    if (!(X)) { cout << #I << ": " << I << "\t" << #J << ": "                 \
+              << J << "\n"; aSsErT(1, #X, __LINE__); } }
+
+#define LOOP3_ASSERT(I,J,K,X) {                                               \
+   if (!(X)) { cout << #I << ": " << I << "\t" << #J << ": " << J << "\t"     \
+              << #K << ": " << K << "\n"; aSsErT(1, #X, __LINE__); } }
+
+// ============================================================================
+//                  SEMI-STANDARD TEST OUTPUT MACROS
+// ----------------------------------------------------------------------------
+
+#define P(X) cout << #X " = " << (X) << endl; // Print identifier and value.
+#define Q(X) cout << "<| " #X " |>" << endl;  // Quote identifier literally.
+#define P_(X) cout << #X " = " << (X) << ", " << flush; // 'P(X)' without '\n'
+#define T_ cout << "\t" << flush;             // Print tab w/o newline.
+#define L_ __LINE__                           // current Line number
+
+// ============================================================================
+//                  NEGATIVE-TEST MACRO ABBREVIATIONS
+// ----------------------------------------------------------------------------
+
+#define ASSERT_SAFE_PASS(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_PASS(EXPR)
+#define ASSERT_SAFE_FAIL(EXPR) BSLS_ASSERTTEST_ASSERT_SAFE_FAIL(EXPR)
+#define ASSERT_PASS(EXPR)      BSLS_ASSERTTEST_ASSERT_PASS(EXPR)
+#define ASSERT_FAIL(EXPR)      BSLS_ASSERTTEST_ASSERT_FAIL(EXPR)
+#define ASSERT_OPT_PASS(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_PASS(EXPR)
+#define ASSERT_OPT_FAIL(EXPR)  BSLS_ASSERTTEST_ASSERT_OPT_FAIL(EXPR)
+
+// ============================================================================
+//                     GLOBAL TYPEDEFS FOR TESTING
+// ----------------------------------------------------------------------------
+
+typedef btlso::LocalAddress Obj;
+
+// ============================================================================
+//                            MAIN PROGRAM
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[])
+{
+    int                 test = argc > 1 ? atoi(argv[1]) : 0;
+    bool             verbose = argc > 2;
+    bool         veryVerbose = argc > 3;
+    bool     veryVeryVerbose = argc > 4;
+
+    cout << "TEST " << __FILE__ << " CASE " << test << endl;
+
+    switch (test) { case 0:
+      case 4: {
+        // --------------------------------------------------------------------
+        // USAGE EXAMPLE
+        //
+        // Concerns:
+        //: 1 The usage example provided in the component header file compiles,
+        //:   links, and runs as shown.
+        //
+        // Plan:
+        //: 1 Incorporate usage example from header into test driver, remove
+        //:   leading comment characters, and replace 'assert' with 'ASSERT'.
+        //:   (C-1)
+        //
+        // Testing:
+        //   USAGE EXAMPLE
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "USAGE EXAMPLE" << endl
+                          << "=============" << endl;
+
+///Example 1: Basic Syntax
+///- - - - - - - - - - - -
+// First, we create a default object 'address1', which has an empty path:
+//..
+    btlso::LocalAddress address1;
+    ASSERT(0 == bsl::strcmp("", address1.path()));
+//..
+// Then, we set 'address1' to a valid path:
+//..
+    int rc = address1.setPath("/tmp/myservice.sock");
+    ASSERT(0 == rc);
+    ASSERT(0 == bsl::strcmp("/tmp/myservice.sock", address1.path()));
+//..
+// Next, we verify that a path that is too long is rejected, and that the
+// object is left unchanged:
+//..
+    const bsl::string longPath(btlso::LocalAddress::k_MAX_PATH_LENGTH + 1,
+                               'x');
+    ASSERT(false == btlso::LocalAddress::isValidPath(longPath.c_str()));
+
+    rc = address1.setPath(longPath.c_str());
+    ASSERT(0 != rc);
+    ASSERT(0 == bsl::strcmp("/tmp/myservice.sock", address1.path()));
+//..
+// Finally, we create 'address2' from the same path, and verify that the two
+// objects have the same value:
+//..
+    btlso::LocalAddress address2("/tmp/myservice.sock");
+    ASSERT(address1 == address2);
+//..
+      } break;
+      case 3: {
+        // --------------------------------------------------------------------
+        // 'isValidPath' AND 'setPath'
+        //
+        // Concerns:
+        //: 1 'isValidPath' accepts paths of 0 to 'k_MAX_PATH_LENGTH'
+        //:   characters, and rejects longer paths.
+        //:
+        //: 2 'setPath' returns 0 and sets the path if and only if the path is
+        //:   valid, and otherwise leaves the object unchanged.
+        //:
+        //: 3 A path of maximal length is stored without truncation.
+        //:
+        //: 4 QoI: Asserted precondition violations are detected when enabled.
+        //
+        // Plan:
+        //: 1 Using the table-driven technique, call 'isValidPath' and
+        //:   'setPath' on paths of various lengths around the limit, and
+        //:   verify the result and the value of the object.  (C-1..3)
+        //:
+        //: 2 Verify that, in appropriate build modes, defensive checks are
+        //:   triggered for invalid arguments.  (C-4)
+        //
+        // Testing:
+        //   static bool isValidPath(const char *path);
+        //   int setPath(const char *path);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "'isValidPath' AND 'setPath'" << endl
+                          << "===========================" << endl;
+
+        const int MAX = Obj::k_MAX_PATH_LENGTH;
+
+        static const struct {
+            int d_line;    // source line number
+            int d_length;  // length of the path
+        } DATA[] = {
+            //LINE  LENGTH
+            //----  -------
+            { L_,   0       },
+            { L_,   1       },
+            { L_,   2       },
+            { L_,   MAX - 1 },
+            { L_,   MAX     },
+            { L_,   MAX + 1 },
+            { L_,   MAX + 2 },
+            { L_,   2 * MAX },
+        };
+        const int NUM_DATA = sizeof DATA / sizeof *DATA;
+
+        const Obj X0("/initial/path");
+
+        for (int ti = 0; ti < NUM_DATA; ++ti) {
+            const int  LINE   = DATA[ti].d_line;
+            const int  LENGTH = DATA[ti].d_length;
+            const bool VALID  = LENGTH <= MAX;
+
+            const bsl::string PATH(LENGTH, 'a' + ti);
+
+            if (veryVerbose) { T_ P_(LINE) P_(LENGTH) P(VALID) }
+
+            LOOP2_ASSERT(LINE, LENGTH,
+                         VALID == Obj::isValidPath(PATH.c_str()));
+
+            Obj mX(X0);  const Obj& X = mX;
+
+            const int rc = mX.setPath(PATH.c_str());
+            LOOP2_ASSERT(LINE, rc, VALID == (0 == rc));
+
+            if (VALID) {
+                LOOP_ASSERT(LINE, PATH == X.path());
+                LOOP_ASSERT(LINE, Obj(PATH.c_str()) == X);
+            }
+            else {
+                LOOP_ASSERT(LINE, X0 == X);
+            }
+        }
+
+        if (verbose) cout << "\nNegative Testing." << endl;
+        {
+            bsls::AssertTestHandlerGuard hG;
+
+            Obj mX;
+
+            ASSERT_SAFE_FAIL(Obj::isValidPath(0));
+            ASSERT_SAFE_FAIL(mX.setPath(0));
+            ASSERT_SAFE_FAIL(Obj(0));
+
+            const bsl::string LONG(MAX + 1, 'x');
+            ASSERT_SAFE_FAIL(Obj(LONG.c_str()));
+            ASSERT_SAFE_PASS(Obj(LONG.c_str() + 1));
+        }
+      } break;
+      case 2: {
+        // --------------------------------------------------------------------
+        // VALUE SEMANTICS
+        //
+        // Concerns:
+        //: 1 A default-constructed object has an empty path.
+        //:
+        //: 2 The value constructor, copy constructor, and assignment operator
+        //:   produce objects with the expected value.
+        //:
+        //: 3 Two objects compare equal if and only if their paths are equal.
+        //:
+        //: 4 'operator<<' writes the path, and 'print' writes the path as an
+        //:   attribute.
+        //:
+        //: 5 No memory is allocated.
+        //
+        // Plan:
+        //: 1 Create objects using each constructor and verify their value.
+        //:
+        //: 2 Compare all pairs of objects from a set of distinct values.
+        //:
+        //: 3 Format objects to a string stream and verify the output.
+        //:
+        //: 4 Install a test allocator as the default allocator and verify it
+        //:   is unused before formatting.  (C-1..5)
+        //
+        // Testing:
+        //   btlso::LocalAddress();
+        //   btlso::LocalAddress(const char *path);
+        //   btlso::LocalAddress(const btlso::LocalAddress& original);
+        //   ~btlso::LocalAddress();
+        //   btlso::LocalAddress& operator=(const btlso::LocalAddress& rhs);
+        //   const char *path() const;
+        //   ostream& print(ostream& stream, level, spacesPerLevel) const;
+        //   bool operator==(lhs, rhs);
+        //   bool operator!=(lhs, rhs);
+        //   bsl::ostream& operator<<(stream, object);
+        //   CONCERN: No memory is allocated.
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "VALUE SEMANTICS" << endl
+                          << "===============" << endl;
+
+        bslma::TestAllocator         da("default", veryVeryVerbose);
+        bslma::DefaultAllocatorGuard dag(&da);
+
+        static const char *VALUES[] = {
+            "",
+            "a",
+            "b",
+            "/tmp/a.sock",
+            "/tmp/a.soc",
+            "/tmp/a.sockx",
+            "relative/path",
+        };
+        const int NUM_VALUES = sizeof VALUES / sizeof *VALUES;
+
+        {
+            const Obj X;
+            ASSERT(0 == bsl::strcmp("", X.path()));
+        }
+
+        for (int i = 0; i < NUM_VALUES; ++i) {
+            const Obj X(VALUES[i]);
+            LOOP_ASSERT(i, 0 == bsl::strcmp(VALUES[i], X.path()));
+
+            const Obj Y(X);
+            LOOP_ASSERT(i, X == Y);
+
+            for (int j = 0; j < NUM_VALUES; ++j) {
+                Obj mZ(VALUES[j]);  const Obj& Z = mZ;
+
+                LOOP2_ASSERT(i, j, (i == j) == (X == Z));
+                LOOP2_ASSERT(i, j, (i != j) == (X != Z));
+
+                mZ = X;
+                LOOP2_ASSERT(i, j, X == Z);
+            }
+        }
+
+        LOOP_ASSERT(da.numBlocksTotal(), 0 == da.numBlocksTotal());
+
+        {
+            const Obj X("/tmp/a.sock");
+
+            bsl::ostringstream os;
+            os << X;
+            ASSERT("/tmp/a.sock" == os.str());
+
+            bsl::ostringstream ps;
+            X.print(ps, 0, -1);
+            if (veryVerbose) { P(ps.str()) }
+            ASSERT(bsl::string::npos != ps.str().find("/tmp/a.sock"));
+        }
+      } break;
+      case 1: {
+        // --------------------------------------------------------------------
+        // BREATHING TEST
+        //   This case exercises (but does not fully test) basic functionality.
+        //
+        // Concerns:
+        //: 1 The class is sufficiently functional to enable comprehensive
+        //:   testing in subsequent test cases.
+        //
+        // Plan:
+        //: 1 Perform and ad-hoc test of the primary modifiers and accessors.
+        //
+        // Testing:
+        //   BREATHING TEST
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << endl
+                          << "BREATHING TEST" << endl
+                          << "==============" << endl;
+
+        Obj mX;  const Obj& X = mX;
+        ASSERT(0 == bsl::strcmp("", X.path()));
+
+        ASSERT(0 == mX.setPath("/tmp/breathing.sock"));
+        ASSERT(0 == bsl::strcmp("/tmp/breathing.sock", X.path()));
+
+        Obj mY(X);  const Obj& Y = mY;
+        ASSERT(X == Y);
+
+        mY.setPath("/tmp/other.sock");
+        ASSERT(X != Y);
+
+        if (verbose) { P_(X) P(Y) }
+      } break;
+      default: {
+        cerr << "WARNING: CASE `" << test << "' NOT FOUND." << endl;
+        testStatus = -1;
+      }
+    }
+
+    if (testStatus > 0) {
+        cerr << "Error, non-zero test status = " << testStatus << "." << endl;
+    }
+
+    return testStatus;
+}
+
+// ----------------------------------------------------------------------------
+// Copyright 2016 Bloomberg Finance L.P.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ----------------------------- END-OF-FILE ----------------------------------
@@ -111,6 +111,7 @@ struct Platform {
 
         #ifdef BSLS_PLATFORM_OS_LINUX
             struct EPOLL {};
+            struct IO_URING {};   // 'io_uring', if the kernel supports it
             typedef EPOLL   DEFAULT_POLLING_MECHANISM;
         #endif
 
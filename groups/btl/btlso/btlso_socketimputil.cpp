@@ -19,6 +19,7 @@ BSLS_IDENT_RCSID(btlso_socketimputil_cpp,"$Id$ $CSID$")
 #include <bsls_types.h>
 
 #include <bsl_c_stdio.h>
+#include <bsl_cstring.h>
 
 #if defined(BTLSO_PLATFORM_WIN_SOCKETS)
 
@@ -101,6 +102,14 @@ int SocketImpUtil::startup(int *errorCode)
 #include <unistd.h>
 #include <bsl_c_errno.h>
 
+#if defined(BSLS_PLATFORM_OS_LINUX)
+#include <linux/errqueue.h>
+#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)                            \
+                         && defined(SO_EE_ORIGIN_ZEROCOPY)
+#define U_HAVE_ZEROCOPY 1
+#endif
+#endif
+
 // manifest constants for shutdown()
 #define SD_RECEIVE      0x00
 #define SD_SEND         0x01
@@ -798,6 +807,128 @@ int btlso::SocketImpUtil::writev(const btlso::SocketHandle::Handle&  socket,
                          static_cast<int>(rc);
 }
 
+int btlso::SocketImpUtil::enableZeroCopy(
+                                 const btlso::SocketHandle::Handle&  socket,
+                                 int                                *errorCode)
+{
+#if defined(U_HAVE_ZEROCOPY)
+    const int enable = 1;
+    const int rc = ::setsockopt(socket,
+                                SOL_SOCKET,
+                                SO_ZEROCOPY,
+                                &enable,
+                                sizeof enable);
+
+    int errorNumber = rc >= 0 ? 0 : SocketImpUtil_Util::getErrorCode();
+    if (errorNumber && errorCode) {
+        *errorCode = errorNumber;
+    }
+    return errorNumber ? SocketImpUtil_Util::mapErrorCode(errorNumber) : 0;
+#else
+    (void)socket;
+    (void)errorCode;
+
+    return btlso::SocketHandle::e_ERROR_UNCLASSIFIED;
+#endif
+}
+
+int btlso::SocketImpUtil::readZeroCopyCompletion(
+                                 unsigned int                       *first,
+                                 unsigned int                       *last,
+                                 bool                               *copied,
+                                 const btlso::SocketHandle::Handle&  socket,
+                                 int                                *errorCode)
+{
+    BSLS_ASSERT(first);
+    BSLS_ASSERT(last);
+    BSLS_ASSERT(copied);
+
+#if defined(U_HAVE_ZEROCOPY)
+    // The control buffer must be suitably aligned for 'cmsghdr'.
+
+    union {
+        char           d_buffer[CMSG_SPACE(sizeof(::sock_extended_err))];
+        ::cmsghdr      d_align;
+    } control;
+
+    ::msghdr msg;
+    bsl::memset(&msg, 0, sizeof msg);
+    msg.msg_control    = control.d_buffer;
+    msg.msg_controllen = sizeof control.d_buffer;
+
+    const ssize_t rc = ::recvmsg(socket, &msg, MSG_ERRQUEUE | MSG_DONTWAIT);
+
+    if (rc < 0) {
+        const int errorNumber = SocketImpUtil_Util::getErrorCode();
+        if (errorCode) {
+            *errorCode = errorNumber;
+        }
+        return SocketImpUtil_Util::mapErrorCode(errorNumber);         // RETURN
+    }
+
+    for (::cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+         cmsg;
+         cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        const bool isIpError   = IPPROTO_IP   == cmsg->cmsg_level
+                              && IP_RECVERR   == cmsg->cmsg_type;
+        const bool isIpv6Error = IPPROTO_IPV6 == cmsg->cmsg_level
+                              && IPV6_RECVERR == cmsg->cmsg_type;
+        if (!isIpError && !isIpv6Error) {
+            continue;
+        }
+
+        ::sock_extended_err error;
+        bsl::memcpy(&error, CMSG_DATA(cmsg), sizeof error);
+
+        if (0 == error.ee_errno
+         && SO_EE_ORIGIN_ZEROCOPY == error.ee_origin) {
+            *first  = error.ee_info;
+            *last   = error.ee_data;
+            *copied = 0 != (error.ee_code & SO_EE_CODE_ZEROCOPY_COPIED);
+            return 0;                                                 // RETURN
+        }
+    }
+    return 1;
+#else
+    (void)socket;
+    (void)errorCode;
+
+    return btlso::SocketHandle::e_ERROR_UNCLASSIFIED;
+#endif
+}
+
+int btlso::SocketImpUtil::writevZeroCopy(
+                                 const btlso::SocketHandle::Handle&  socket,
+                                 const btls::Ovec                   *ovec,
+                                 int                                 size,
+                                 int                                *errorCode)
+{
+    BSLS_ASSERT(ovec);
+    BSLS_ASSERT(size > 0);
+
+#if defined(U_HAVE_ZEROCOPY)
+    ::msghdr msg;
+    bsl::memset(&msg, 0, sizeof msg);
+    msg.msg_iov    = reinterpret_cast< ::iovec *>(const_cast<btls::Ovec *>(
+                                                                       ovec));
+    msg.msg_iovlen = size;
+
+    const ssize_t rc = ::sendmsg(socket, &msg, MSG_ZEROCOPY);
+
+    int errorNumber = rc > 0 ? 0 : SocketImpUtil_Util::getErrorCode();
+    if (errorNumber && errorCode) {
+        *errorCode = errorNumber;
+    }
+    return errorNumber ? SocketImpUtil_Util::mapErrorCode(errorNumber) :
+                         static_cast<int>(rc);
+#else
+    (void)socket;
+    (void)errorCode;
+
+    return btlso::SocketHandle::e_ERROR_UNCLASSIFIED;
+#endif
+}
+
 int btlso::SocketImpUtil::shutDown(
                                  const btlso::SocketHandle::Handle&  socket,
                                  btlso::SocketImpUtil::ShutDownType  how,
@@ -1078,6 +1209,32 @@ int btlso::SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
     return 0;
 }
 
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+template <>
+int btlso::SocketImpUtil_Imp<btlso::LocalAddress>::socketPair(
+                                       btlso::SocketHandle::Handle *newSockets,
+                                       btlso::SocketImpUtil::Type   type,
+                                       int                          protocol,
+                                       int                         *errorCode)
+{
+    BSLS_ASSERT(newSockets);
+
+    // Local sockets are connected directly by the native 'socketpair', which
+    // creates two unnamed sockets.
+
+    int rc = ::socketpair(AF_UNIX,
+                          static_cast<int>(type),
+                          protocol,
+                          newSockets);
+
+    int errorNumber = rc >= 0 ? 0 : SocketImpUtil_Util::getErrorCode();
+    if (errorNumber && errorCode) {
+        *errorCode = errorNumber;
+    }
+    return errorNumber ? SocketImpUtil_Util::mapErrorCode(errorNumber) : 0;
+}
+#endif
+
 }  // close package namespace
 }  // close enterprise namespace
 
@@ -86,6 +86,10 @@ BSLS_IDENT("$Id: $")
 //  | writeTo           | block otherwise;        | specify address, port     |
 //  |                   | specify address, port   |                           |
 //  +-------------------------------------------------------------------------+
+//  |                   | write data without      | write data without        |
+//  | writevZeroCopy    | copying if possible,    | copying if possible       |
+//  |                   | block otherwise         |                           |
+//  +-------------------------------------------------------------------------+
 //  |                   |                                                     |
 //  | shutDown          |                shut down the connection             |
 //  |                   |                                                     |
@@ -128,6 +132,33 @@ BSLS_IDENT("$Id: $")
 // particular address type, all further functions on this socket taking the
 // 'ADDRESS' parameter must use the same address type.
 //
+// On platforms providing BSD sockets, the address type 'btlso::LocalAddress'
+// selects the local (Unix-domain, AF_UNIX) socket domain, in which sockets are
+// identified by a path in the file system.  Local stream sockets can be used
+// with the same functions as TCP sockets, except for those specific to TCP
+// (e.g., setting the 'TCP_NODELAY' option).  Note that 'socketPair' on local
+// sockets creates a pair of connected, unnamed sockets (using the native
+// 'socketpair' function), and that binding a local socket creates a file that
+// is not removed when the socket is closed.
+//
+///Zero-Copy Writes
+///----------------
+// On platforms that support it (Linux 4.14 and later, for TCP sockets),
+// 'writevZeroCopy' sends data without copying it into the kernel: the kernel
+// instead references the pages of the buffers until their data has been
+// transmitted (and acknowledged, for TCP).  Zero-copy writes must first be
+// enabled on the socket with 'enableZeroCopy'.  Each successful call to
+// 'writevZeroCopy' on a socket is assigned a sequence number, starting with 0
+// and incremented by one (modulo 2^32) at each call, and the caller must not
+// modify or release the buffers of a call until a completion covering its
+// sequence number has been read with 'readZeroCopyCompletion'.  A completion
+// may cover a range of consecutive calls, and reports whether the kernel fell
+// back to copying the data (as it always does, e.g., on the loopback
+// interface).  Completions are queued on the error queue of the socket, and
+// therefore a pending completion is signaled as an error condition by
+// 'select', 'poll', and 'epoll'.  Note that zero-copy writes are generally
+// only worth their bookkeeping for writes of at least a few kilobytes.
+//
 ///Errors
 ///------
 // On success, all functions return a non-negative integer value.  On errors,
@@ -373,6 +404,10 @@ BSLS_IDENT("$Id: $")
 #include <btlso_ipv4address.h>
 #endif
 
+#ifndef INCLUDED_BTLSO_LOCALADDRESS
+#include <btlso_localaddress.h>
+#endif
+
 #ifndef INCLUDED_BTLSO_SOCKETHANDLE
 #include <btlso_sockethandle.h>
 #endif
@@ -414,10 +449,19 @@ BSLS_IDENT("$Id: $")
     #define INCLUDED_NETINET_IN
     #endif
 
+    #ifndef INCLUDED_SYS_UN
+    #include <sys/un.h>
+    #define INCLUDED_SYS_UN
+    #endif
+
     #ifndef INCLUDED_BSL_C_STRING
     #include <bsl_c_string.h> // memset
     #endif
 
+    #ifndef INCLUDED_BSL_CSTRING
+    #include <bsl_cstring.h>
+    #endif
+
 #endif
 
 namespace BloombergLP {
@@ -582,6 +626,15 @@ struct SocketImpUtil {
         // operation, the specified 'address' is used.  For receive operations,
         // only data from the specified 'address' is received.
 
+    static int enableZeroCopy(const SocketHandle::Handle&  socket,
+                              int                         *errorCode = 0);
+        // Enable zero-copy writes (see 'writevZeroCopy') on the specified
+        // 'socket'.  Load the optionally specified 'errorCode' with the
+        // platform-specific error number on error.  Return 0 on success, and a
+        // negative value otherwise representing an error classification.
+        // Note that this operation fails, with no effect on 'errorCode', if
+        // the platform does not support zero-copy writes.
+
     template <class ADDRESS>
     static int getLocalAddress(ADDRESS                     *localAddress,
                                const SocketHandle::Handle&  socket);
@@ -713,6 +766,26 @@ struct SocketImpUtil {
         // this call blocks until (a) data is read, (b) an EOF indication
         // occurs, or (c) an error occurs.
 
+    static int readZeroCopyCompletion(
+                                   unsigned int                *first,
+                                   unsigned int                *last,
+                                   bool                        *copied,
+                                   const SocketHandle::Handle&  socket,
+                                   int                         *errorCode = 0);
+        // Dequeue the next message from the error queue of the specified
+        // 'socket' without blocking, and if it is the completion of zero-copy
+        // writes (see 'writevZeroCopy'), load into the specified 'first' and
+        // 'last' the sequence numbers of the first and last calls it covers
+        // and into the specified 'copied' whether the kernel copied their
+        // data.  Load the optionally specified 'errorCode' with the
+        // platform-specific error number on error.  Return 0 if a completion
+        // was loaded, a positive value, with no effect on 'first', 'last',
+        // and 'copied', if another kind of message was dequeued, and a
+        // negative value otherwise representing an error classification, in
+        // particular 'SocketHandle::e_ERROR_WOULDBLOCK' if the error queue is
+        // empty.  Note that this operation fails, with no effect on
+        // 'errorCode', if the platform does not support zero-copy writes.
+
     template <class ADDRESS>
     static int socketPair(SocketHandle::Handle *newSockets,
                           SocketImpUtil::Type   type);
@@ -823,6 +896,27 @@ struct SocketImpUtil {
         // memory locations.  Note that if 'socket' is in blocking mode, this
         // call blocks until either data is written or an error occurs.
 
+    static int writevZeroCopy(const SocketHandle::Handle&  socket,
+                              const btls::Ovec            *ovec,
+                              int                          numBuffs,
+                              int                         *errorCode = 0);
+        // Send to the specified 'socket' from the buffers specified by 'ovec'
+        // where 'numBuffs' is the number of buffers, without copying their
+        // data if possible.  Load the optionally specified 'errorCode' with
+        // the platform-specific error number on error.  Return the positive
+        // number of bytes written on success, and a negative value otherwise
+        // representing an error classification.  On success, the kernel may
+        // reference the buffers (at least up to the number of bytes written)
+        // until a completion covering this call is read with
+        // 'readZeroCopyCompletion'; the behavior is undefined if they are
+        // modified or released before then.  The behavior is also undefined
+        // unless zero-copy writes have been enabled on 'socket' with
+        // 'enableZeroCopy', '0 < numBuffs', and 'ovec' refers to buffers at
+        // valid memory locations.  Note that if 'socket' is in blocking mode,
+        // this call blocks until either data is written or an error occurs.
+        // Note also that this operation fails, with no effect on 'errorCode',
+        // if the platform does not support zero-copy writes.
+
     static int shutDown(const SocketHandle::Handle&  socket,
                         SocketImpUtil::ShutDownType  value,
                         int                         *errorCode = 0);
@@ -968,6 +1062,53 @@ struct SocketImpUtil_Address<class IPv4Address> {
     }
 };
 
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+
+template <>
+struct SocketImpUtil_Address<class LocalAddress> {
+    // Encapsulate the 'sockaddr_un' structure and provide a mapping to the
+    // equivalent 'LocalAddress'.
+
+    sockaddr_un d_address;
+
+    enum {
+        SocketDomain = AF_UNIX
+    };
+
+    // CREATORS
+    SocketImpUtil_Address()
+    {
+        bsl::memset(&d_address, 0, sizeof d_address);
+    }
+
+    SocketImpUtil_Address(const LocalAddress& addr)
+    {
+        BSLMF_ASSERT(sizeof(d_address.sun_path) >
+                                              LocalAddress::k_MAX_PATH_LENGTH);
+
+        bsl::memset(&d_address, 0, sizeof d_address);
+        d_address.sun_family = SocketDomain;
+        bsl::strcpy(d_address.sun_path, addr.path());
+    }
+
+    // ACCESSORS
+    void fromSocketAddress(LocalAddress *addr) const
+    {
+        // The path returned by the system for an unnamed socket is empty, and
+        // it may not be null-terminated if it fills 'sun_path'.
+
+        char path[sizeof d_address.sun_path + 1];
+        bsl::memcpy(path, d_address.sun_path, sizeof d_address.sun_path);
+        path[sizeof d_address.sun_path] = '\0';
+
+        if (0 != addr->setPath(path)) {
+            addr->setPath("");
+        }
+    }
+};
+
+#endif
+
                           // ========================
                           // struct SocketImpUtil_Imp
                           // ========================
@@ -1051,6 +1192,15 @@ int SocketImpUtil_Imp<btlso::IPv4Address>::socketPair(
                                       int                          protocol,
                                       int                         *errorCode);
 
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+template <>
+int SocketImpUtil_Imp<btlso::LocalAddress>::socketPair(
+                                      btlso::SocketHandle::Handle *newSockets,
+                                      btlso::SocketImpUtil::Type   type,
+                                      int                          protocol,
+                                      int                         *errorCode);
+#endif
+
 // ============================================================================
 //                      INLINE FUNCTION DEFINITIONS
 // ============================================================================
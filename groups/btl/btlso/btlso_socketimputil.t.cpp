@@ -10,6 +10,7 @@
 #include <btlso_socketimputil.h>
 
 #include <btlso_ipv4address.h>
+#include <btlso_localaddress.h>
 
 #include <bslim_testutil.h>
 
@@ -20,16 +21,20 @@
 
 #include <bsls_platform.h>
 
+#include <bsl_cstdio.h>              // sprintf()
 #include <bsl_cstdlib.h>             // atoi()
 #include <bsl_cstring.h>             // memset()
 #include <bsl_iostream.h>
+#include <bsl_string.h>
 #include <bsl_utility.h>
+#include <bsl_vector.h>
 
 #if !defined(BSLS_PLATFORM_CMP_MSVC)
 // for getsockname
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <unistd.h>
 #endif
 
 using namespace BloombergLP;
@@ -438,7 +443,7 @@ int main(int argc, char *argv[])
     cout << "TEST " << __FILE__ << " CASE " << test << endl;
 
     switch (test) { case 0:  // Zero is always the leading case.
-      case 3: {
+      case 5: {
         // --------------------------------------------------------------------
         // USAGE TEST
         //
@@ -550,6 +555,286 @@ int main(int argc, char *argv[])
      ASSERT(0 == bslmt::ThreadUtil::join(stid));
      ASSERT(0 == bslmt::ThreadUtil::join(ctid));
       } break;
+#ifdef BTLSO_PLATFORM_BSD_SOCKETS
+      case 4: {
+        // --------------------------------------------------------------------
+        // TESTING LOCAL SOCKETS
+        //
+        // Concerns:
+        //: 1 Operations templatized on 'btlso::LocalAddress' act on sockets of
+        //:   the 'AF_UNIX' domain, named by their path.
+        //:
+        //: 2 The local address of a bound socket, and the peer address of an
+        //:   accepted socket, are reported as expected (an unbound client is
+        //:   reported with an empty path).
+        //:
+        //: 3 Data is transferred in both directions.
+        //:
+        //: 4 'socketPair' creates two connected, unnamed, local sockets.
+        //
+        // Plan:
+        //: 1 Bind a local stream socket to a path in the temporary directory,
+        //:   listen, connect a client socket, and accept the connection.
+        //:   Verify the addresses, then exchange data.  (C-1..3)
+        //:
+        //: 2 Create a pair of local stream sockets with 'socketPair' and
+        //:   exchange data over them.  (C-4)
+        //
+        // Testing:
+        //   SocketImpUtil_Address<LocalAddress>
+        //   int socketPair<LocalAddress>(Handle *, Type, int, int *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING LOCAL SOCKETS" << endl
+                          << "=====================" << endl;
+
+        typedef btlso::LocalAddress LA;
+
+        ASSERT(0 == T::startup());
+
+        bsl::string path("/tmp/btlso_socketimputil.t.");
+        {
+            char pid[32];
+            bsl::sprintf(pid, "%d", static_cast<int>(::getpid()));
+            path += pid;
+        }
+        ::unlink(path.c_str());
+
+        const LA ADDRESS(path.c_str());
+
+        SockType serverSocket, clientSocket, sessionSocket;
+
+        ASSERT(0 == T::open<LA>(&serverSocket, T::k_SOCKET_STREAM));
+        ASSERT(0 == T::bind<LA>(serverSocket, ADDRESS));
+        ASSERT(0 == T::listen(serverSocket, 1));
+
+        LA serverAddress;
+        ASSERT(0 == T::getLocalAddress<LA>(&serverAddress, serverSocket));
+        LOOP_ASSERT(serverAddress, ADDRESS == serverAddress);
+
+        ASSERT(0 == T::open<LA>(&clientSocket, T::k_SOCKET_STREAM));
+        ASSERT(0 == T::connect<LA>(clientSocket, ADDRESS));
+
+        LA peerAddress("/not/empty");
+        ASSERT(0 == T::accept<LA>(&sessionSocket,
+                                  &peerAddress,
+                                  serverSocket));
+        LOOP_ASSERT(peerAddress, LA() == peerAddress);
+
+        ASSERT(0 == T::getPeerAddress<LA>(&peerAddress, clientSocket));
+        LOOP_ASSERT(peerAddress, ADDRESS == peerAddress);
+
+        {
+            const char MESSAGE[] = "local socket";
+            char       buffer[sizeof MESSAGE];
+
+            ASSERT(int(sizeof MESSAGE) ==
+                          T::write(clientSocket, MESSAGE, sizeof MESSAGE));
+            ASSERT(int(sizeof MESSAGE) ==
+                               T::read(buffer, sessionSocket, sizeof buffer));
+            ASSERT(0 == bsl::memcmp(MESSAGE, buffer, sizeof MESSAGE));
+
+            ASSERT(int(sizeof MESSAGE) ==
+                         T::write(sessionSocket, MESSAGE, sizeof MESSAGE));
+            ASSERT(int(sizeof MESSAGE) ==
+                                T::read(buffer, clientSocket, sizeof buffer));
+            ASSERT(0 == bsl::memcmp(MESSAGE, buffer, sizeof MESSAGE));
+        }
+
+        T::close(sessionSocket);
+        T::close(clientSocket);
+        T::close(serverSocket);
+        ::unlink(path.c_str());
+
+        if (verbose) cout << "\tTesting 'socketPair'." << endl;
+        {
+            SockType sockets[2];
+            ASSERT(0 == T::socketPair<LA>(sockets, T::k_SOCKET_STREAM));
+
+            ASSERT(0 == T::getLocalAddress<LA>(&peerAddress, sockets[0]));
+            LOOP_ASSERT(peerAddress, LA() == peerAddress);
+
+            const char MESSAGE[] = "socket pair";
+            char       buffer[sizeof MESSAGE];
+
+            ASSERT(int(sizeof MESSAGE) ==
+                            T::write(sockets[0], MESSAGE, sizeof MESSAGE));
+            ASSERT(int(sizeof MESSAGE) ==
+                                  T::read(buffer, sockets[1], sizeof buffer));
+            ASSERT(0 == bsl::memcmp(MESSAGE, buffer, sizeof MESSAGE));
+
+            T::close(sockets[0]);
+            T::close(sockets[1]);
+        }
+
+        T::cleanup();
+      } break;
+#endif
+      case 3: {
+        // --------------------------------------------------------------------
+        // TESTING ZERO-COPY WRITES
+        //
+        // Concerns:
+        //: 1 'writevZeroCopy' transfers the data of all the buffers.
+        //:
+        //: 2 Each call to 'writevZeroCopy' is completed, and the completions
+        //:   read by 'readZeroCopyCompletion' cover consecutive sequence
+        //:   numbers, starting at 0.
+        //:
+        //: 3 'readZeroCopyCompletion' returns 'e_ERROR_WOULDBLOCK' if no
+        //:   completion is pending.
+        //
+        // Plan:
+        //: 1 Connect two TCP sockets over the loopback interface, enable
+        //:   zero-copy writes on one of them (skipping the test if the
+        //:   platform does not support them), and write a few messages made
+        //:   of several buffers to it with 'writevZeroCopy'.  Read the data
+        //:   on the other socket and verify it.  (C-1)
+        //:
+        //: 2 Read completions until all the writes are covered, verifying
+        //:   that the ranges are consecutive.  Then verify that no more
+        //:   completion is pending.  (C-2..3)
+        //
+        // Testing:
+        //   int enableZeroCopy(const Handle&, int *);
+        //   int readZeroCopyCompletion(uint *, uint *, bool *, Handle&, int*);
+        //   int writevZeroCopy(const Handle&, const Ovec *, int, int *);
+        // --------------------------------------------------------------------
+
+        if (verbose) cout << "TESTING ZERO-COPY WRITES" << endl
+                          << "========================" << endl;
+
+        enum {
+            NUM_WRITES  = 8,
+            NUM_BUFFERS = 4,
+            BUFFER_SIZE = 16 * 1024
+        };
+
+        ASSERT(0 == T::startup());
+
+        SockType serverSocket, clientSocket, sessionSocket;
+        int      errorCode = 0;
+
+        ASSERT(0 == T::open<A>(&serverSocket, T::k_SOCKET_STREAM));
+        ASSERT(0 == T::bind<A>(serverSocket, A("127.0.0.1", 0)));
+        ASSERT(0 == T::listen(serverSocket, 1));
+
+        A serverAddress;
+        ASSERT(0 == T::getLocalAddress<A>(&serverAddress, serverSocket));
+
+        ASSERT(0 == T::open<A>(&clientSocket, T::k_SOCKET_STREAM));
+
+        bsl::vector<char> buffer(NUM_BUFFERS * BUFFER_SIZE);
+        btls::Ovec        ovecs[NUM_BUFFERS];
+        for (int i = 0; i < NUM_BUFFERS; ++i) {
+            ovecs[i].setBuffer(&buffer[i * BUFFER_SIZE], BUFFER_SIZE);
+        }
+
+        if (0 != T::enableZeroCopy(clientSocket, &errorCode)) {
+            if (verbose) cout << "\tZero-copy writes are not supported: "
+                              << errorCode << endl;
+
+            T::close(clientSocket);
+            T::close(serverSocket);
+            T::cleanup();
+            break;
+        }
+
+        ASSERT(0 == T::connect<A>(clientSocket, serverAddress));
+        ASSERT(0 == T::accept<A>(&sessionSocket, serverSocket));
+
+        int numWrites = 0;
+        for (int i = 0; i < NUM_WRITES; ++i) {
+            for (int j = 0; j < NUM_BUFFERS * BUFFER_SIZE; ++j) {
+                buffer[j] = static_cast<char>(i + j);
+            }
+
+            // The buffers must not be modified until the write is completed
+            // unless the data was copied.  Reading all the data from the peer
+            // before modifying them guarantees that it was transmitted.
+
+            int numWritten = 0;
+            while (numWritten < NUM_BUFFERS * BUFFER_SIZE) {
+                const int first = numWritten / BUFFER_SIZE;
+                btls::Ovec remaining[NUM_BUFFERS];
+                for (int k = first; k < NUM_BUFFERS; ++k) {
+                    remaining[k - first] = ovecs[k];
+                }
+                remaining[0].setBuffer(
+                             &buffer[numWritten],
+                             (first + 1) * BUFFER_SIZE - numWritten);
+
+                const int rc = T::writevZeroCopy(clientSocket,
+                                                 remaining,
+                                                 NUM_BUFFERS - first,
+                                                 &errorCode);
+                LOOP2_ASSERT(rc, errorCode, 0 < rc);
+                if (0 >= rc) {
+                    break;
+                }
+                numWritten += rc;
+                ++numWrites;
+            }
+
+            bsl::vector<char> received(NUM_BUFFERS * BUFFER_SIZE);
+            int               numRead = 0;
+            while (numRead < NUM_BUFFERS * BUFFER_SIZE) {
+                const int rc = T::read(&received[numRead],
+                                       sessionSocket,
+                                       NUM_BUFFERS * BUFFER_SIZE - numRead);
+                LOOP_ASSERT(rc, 0 < rc);
+                if (0 >= rc) {
+                    break;
+                }
+                numRead += rc;
+            }
+            LOOP_ASSERT(i, received == buffer);
+        }
+
+        if (veryVerbose) { P(numWrites); }
+
+        unsigned int next = 0;
+        for (int i = 0; i < 1000 && next < unsigned(numWrites); ++i) {
+            unsigned int first, last;
+            bool         copied;
+
+            const int rc = T::readZeroCopyCompletion(&first,
+                                                     &last,
+                                                     &copied,
+                                                     clientSocket);
+            if (btlso::SocketHandle::e_ERROR_WOULDBLOCK == rc) {
+                bslmt::ThreadUtil::microSleep(10000);
+                continue;
+            }
+            LOOP_ASSERT(rc, 0 == rc);
+            if (0 != rc) {
+                break;
+            }
+
+            if (veryVerbose) { P_(first); P_(last); P(copied); }
+
+            LOOP2_ASSERT(next, first, next  == first);
+            LOOP2_ASSERT(first, last, first <= last);
+            next = last + 1;
+        }
+        LOOP2_ASSERT(next, numWrites, unsigned(numWrites) == next);
+
+        {
+            unsigned int first, last;
+            bool         copied;
+
+            ASSERT(btlso::SocketHandle::e_ERROR_WOULDBLOCK ==
+                       T::readZeroCopyCompletion(&first,
+                                                 &last,
+                                                 &copied,
+                                                 clientSocket));
+        }
+
+        T::close(sessionSocket);
+        T::close(clientSocket);
+        T::close(serverSocket);
+        T::cleanup();
+      } break;
       case 2: {
         // --------------------------------------------------------------------
         // TESTING 'writevTo'
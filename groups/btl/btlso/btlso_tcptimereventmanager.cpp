@@ -24,7 +24,7 @@ BSLS_IDENT_RCSID(btlso_tcptimereventmanager_cpp,"$Id$ $CSID$")
 #include <bsls_timeinterval.h>
 #include <bdlt_currenttime.h>
 
-#include <bdlcc_timequeue.h>
+#include <bdlcc_timingwheel.h>
 
 #include <bsls_assert.h>
 #include <bsls_types.h>
@@ -132,26 +132,34 @@ int TcpTimerEventManager::dispatch(int flags)
     int ret;
 
     if (d_timers.length()) {
-        bsls::TimeInterval minTime;
-        if (d_timers.minTime(&minTime)) {
-            return -1;                                                // RETURN
-        }
-        ret = d_manager_p->dispatch(minTime, flags);
-        bsls::TimeInterval now = bdlt::CurrentTime::now();
-        if (now >= minTime) {
-            bsl::vector<bdlcc::TimeQueueItem<bsl::function<void()> > >
+        bsl::vector<bdlcc::TimeQueueItem<bsl::function<void()> > >
                                                        requests(d_allocator_p);
+        while (1) {
+            bsls::TimeInterval minTime;
+            if (d_timers.minTime(&minTime)) {
+                return -1;                                            // RETURN
+            }
+            ret = d_manager_p->dispatch(minTime, flags);
+            bsls::TimeInterval now = bdlt::CurrentTime::now();
+            if (now < minTime) {
+                return ret;                                           // RETURN
+            }
+
             d_timers.popLE(now, &requests);
             int numTimers = static_cast<int>(requests.size());
+            if (0 == numTimers && 0 == ret) {
+                // 'minTime' is a lower bound of the expiration time of the
+                // next timer: wait again until a timer expires.
+
+                continue;
+            }
+
             for (int i = 0; i < numTimers; ++i) {
                 requests[i].data()();
             }
 
             return numTimers + (ret >= 0 ? ret : 0);                  // RETURN
         }
-        else {
-            return ret;                                               // RETURN
-        }
     }
     else {
         if (!d_manager_p->numEvents()) {
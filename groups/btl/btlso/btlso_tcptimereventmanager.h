@@ -74,13 +74,13 @@ BSLS_IDENT("$Id: $")
 //  +=======================================================================+
 //  |        FUNCTION          | EXPECTED COMPLEXITY | WORST CASE COMPLEXITY|
 //  +-----------------------------------------------------------------------+
-//  | dispatch                 |    O(S + log[T])    |    O(S^2 + log[T])   |
+//  | dispatch                 |        O(S)         |      O(S^2 + T)      |
 //  +-----------------------------------------------------------------------+
-//  | registerTimer            |      O(log[T])      |      O(log[T])       |
+//  | registerTimer            |        O(1)         |        O(1)          |
 //  +-----------------------------------------------------------------------+
-//  | rescheduleTimer          |      O(log[T])      |      O(log[T])       |
+//  | rescheduleTimer          |        O(1)         |        O(1)          |
 //  +-----------------------------------------------------------------------+
-//  | deregisterTimer          |        O(T)         |        O(T)          |
+//  | deregisterTimer          |        O(1)         |        O(1)          |
 //  +-----------------------------------------------------------------------+
 //  | registerSocketEvent      |        O(1)         |        O(S)          |
 //  +-----------------------------------------------------------------------+
@@ -103,6 +103,10 @@ BSLS_IDENT("$Id: $")
 //  | numSocketEvents          |        O(1)         |        O(S)          |
 //  +=======================================================================+
 //..
+// Timers are held in a 'bdlcc::TimingWheel'.  The complexity of 'dispatch'
+// excludes the invocation of the callbacks of the expired timers, and its
+// worst case occurs when timers are moved between the levels of the wheel
+// (each timer is moved at most 7 times).
 //
 ///Usage
 ///-----
@@ -259,8 +263,8 @@ BSLS_IDENT("$Id: $")
 #include <btlso_timemetrics.h>
 #endif
 
-#ifndef INCLUDED_BDLCC_TIMEQUEUE
-#include <bdlcc_timequeue.h>
+#ifndef INCLUDED_BDLCC_TIMINGWHEEL
+#include <bdlcc_timingwheel.h>
 #endif
 
 #ifndef INCLUDED_BSL_FUNCTIONAL
@@ -296,7 +300,7 @@ class TcpTimerEventManager : public TimerEventManager
     };
 
   private:
-    bdlcc::TimeQueue<bsl::function<void()> >
+    bdlcc::TimingWheel<bsl::function<void()> >
                         d_timers;          // registered timers
 
     EventManager       *d_manager_p;       // socket event manager